@@ -7,10 +7,14 @@ onnxruntime_add_static_library(onnxruntime_mlas
   ${MLAS_SRC_DIR}/platform.cpp
   ${MLAS_SRC_DIR}/threading.cpp
   ${MLAS_SRC_DIR}/sgemm.cpp
+  ${MLAS_SRC_DIR}/bf16gemm.cpp
+  ${MLAS_SRC_DIR}/sconvdepthwise.cpp
   ${MLAS_SRC_DIR}/qgemm.cpp
   ${MLAS_SRC_DIR}/qdwconv.cpp
   ${MLAS_SRC_DIR}/convolve.cpp
   ${MLAS_SRC_DIR}/pooling.cpp
+  ${MLAS_SRC_DIR}/gather.cpp
+  ${MLAS_SRC_DIR}/layernorm.cpp
   ${MLAS_SRC_DIR}/transpose.cpp
   ${MLAS_SRC_DIR}/reorder.cpp
   ${MLAS_SRC_DIR}/snchwc.cpp
@@ -159,6 +163,9 @@ if (onnxruntime_BUILD_WEBASSEMBLY)
     file(GLOB_RECURSE mlas_platform_srcs
       "${MLAS_SRC_DIR}/wasm_simd/*.cpp"
     )
+    list(APPEND mlas_platform_srcs
+      ${MLAS_SRC_DIR}/qgemm_kernel_wasmsimd.cpp
+    )
   else()
     file(GLOB_RECURSE mlas_platform_srcs
       "${MLAS_SRC_DIR}/wasm/*.cpp"
@@ -263,6 +270,18 @@ else()
           ${MLAS_SRC_DIR}/qgemm_kernel_neon.cpp
           ${MLAS_SRC_DIR}/qgemm_kernel_udot.cpp
         )
+        check_cxx_compiler_flag("-march=armv8.2-a+i8mm" HAS_ARM64_I8MM)
+        if(HAS_ARM64_I8MM)
+          set(mlas_platform_srcs_i8mm
+            ${MLAS_SRC_DIR}/qgemm_kernel_ummla.cpp
+          )
+          set_source_files_properties(${mlas_platform_srcs_i8mm} PROPERTIES COMPILE_FLAGS "-march=armv8.2-a+i8mm")
+          set_source_files_properties(${MLAS_SRC_DIR}/platform.cpp PROPERTIES COMPILE_FLAGS "-DMLAS_ARM64_I8MM")
+          set(mlas_platform_srcs
+            ${mlas_platform_srcs}
+            ${mlas_platform_srcs_i8mm}
+          )
+        endif()
         if(ONNXRUNTIME_MLAS_MULTI_ARCH)
             onnxruntime_add_static_library(onnxruntime_mlas_arm64 ${mlas_platform_srcs})
             set_target_properties(onnxruntime_mlas_arm64 PROPERTIES OSX_ARCHITECTURES "arm64")
@@ -40,6 +40,10 @@ endif()
 if (onnxruntime_ENABLE_TRAINING OR onnxruntime_ENABLE_TRAINING_OPS)
   target_include_directories(onnxruntime_session PRIVATE ${ORTTRAINING_ROOT})
 endif()
+if (onnxruntime_ENABLE_TRAINING)
+  # for the DLPack interop entry points in the C API
+  target_include_directories(onnxruntime_session PRIVATE ${PROJECT_SOURCE_DIR}/external/dlpack/include)
+endif()
 
 if (onnxruntime_ENABLE_TRAINING_TORCH_INTEROP)
   onnxruntime_add_include_to_target(onnxruntime_session Python::Module) 
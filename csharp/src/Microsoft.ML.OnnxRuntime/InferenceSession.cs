@@ -40,6 +40,13 @@ namespace Microsoft.ML.OnnxRuntime
         /// Dictionary that represents overridableInitializers metadata
         /// </summary>
         private Dictionary<string, NodeMetadata> _overridableInitializerMetadata;
+
+        /// <summary>
+        /// Unmanaged zero-terminated UTF-8 copies of the model's input/output/initializer names,
+        /// built once at session initialization so steady-state Run calls do not re-encode and
+        /// pin the names (and generate garbage) on every invocation.
+        /// </summary>
+        private Dictionary<string, IntPtr> _nameUtf8Pointers;
 		
         private SessionOptions _builtInSessionOptions = null;
         private RunOptions _builtInRunOptions = null;
@@ -632,6 +639,13 @@ namespace Microsoft.ML.OnnxRuntime
             for (int i = 0; i < inputs.Count; ++i)
             {
                 var name = extractor(inputs.ElementAt(i));
+                // Model names are cached as unmanaged UTF-8 at initialization, so the common
+                // case allocates and pins nothing per call.
+                if (_nameUtf8Pointers.TryGetValue(name, out IntPtr cachedName))
+                {
+                    result[i] = cachedName;
+                    continue;
+                }
                 var utf8Name = NativeOnnxValueHelper.StringToZeroTerminatedUtf8(name);
                 var pinnedHandle = new PinnedGCHandle(GCHandle.Alloc(utf8Name, GCHandleType.Pinned));
                 result[i] = pinnedHandle.Pointer;
@@ -871,7 +885,34 @@ namespace Microsoft.ML.OnnxRuntime
                 throw e;
             }
 
-            _builtInRunOptions = new RunOptions();  // create a default built-in run option, and avoid creating a new one every run() call  
+            // Cache unmanaged UTF-8 copies of the model's names, freed when the session is disposed.
+            _nameUtf8Pointers = new Dictionary<string, IntPtr>(
+                _inputMetadata.Count + _outputMetadata.Count + _overridableInitializerMetadata.Count);
+            foreach (var name in _inputMetadata.Keys)
+            {
+                CacheNameUtf8(name);
+            }
+            foreach (var name in _outputMetadata.Keys)
+            {
+                CacheNameUtf8(name);
+            }
+            foreach (var name in _overridableInitializerMetadata.Keys)
+            {
+                CacheNameUtf8(name);
+            }
+
+            _builtInRunOptions = new RunOptions();  // create a default built-in run option, and avoid creating a new one every run() call
+        }
+
+        private void CacheNameUtf8(string name)
+        {
+            if (!_nameUtf8Pointers.ContainsKey(name))
+            {
+                var utf8Name = NativeOnnxValueHelper.StringToZeroTerminatedUtf8(name);
+                IntPtr namePtr = Marshal.AllocHGlobal(utf8Name.Length);
+                Marshal.Copy(utf8Name, 0, namePtr, utf8Name.Length);
+                _nameUtf8Pointers.Add(name, namePtr);
+            }
         }
 
 
@@ -1086,6 +1127,15 @@ namespace Microsoft.ML.OnnxRuntime
             }
 
             // cleanup unmanaged resources
+            if (_nameUtf8Pointers != null)
+            {
+                // Dictionary is not finalizable so it is safe to walk it here.
+                foreach (var namePtr in _nameUtf8Pointers.Values)
+                {
+                    Marshal.FreeHGlobal(namePtr);
+                }
+                _nameUtf8Pointers = null;
+            }
             if (_nativeHandle != IntPtr.Zero)
             {
                 NativeMethods.OrtReleaseSession(_nativeHandle);
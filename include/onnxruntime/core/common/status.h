@@ -44,7 +44,8 @@ enum StatusCode {
   MODEL_LOADED = 8,
   NOT_IMPLEMENTED = 9,
   INVALID_GRAPH = 10,
-  EP_FAIL = 11
+  EP_FAIL = 11,
+  DEADLINE_EXCEEDED = 12
 };
 
 inline const char* StatusCodeToString(StatusCode status) noexcept {
@@ -73,6 +74,8 @@ inline const char* StatusCodeToString(StatusCode status) noexcept {
       return "INVALID_GRAPH";
     case StatusCode::EP_FAIL:
       return "EP_FAIL";
+    case StatusCode::DEADLINE_EXCEEDED:
+      return "DEADLINE_EXCEEDED";
     default:
       return "GENERAL ERROR";
   }
@@ -106,6 +109,8 @@ inline HRESULT StatusCodeToHRESULT(StatusCode status) noexcept {
         return __HRESULT_FROM_WIN32(ERROR_FILE_CORRUPT);
     case StatusCode::EP_FAIL:
         return __HRESULT_FROM_WIN32(ERROR_INTERNAL_ERROR);
+    case StatusCode::DEADLINE_EXCEEDED:
+        return __HRESULT_FROM_WIN32(ERROR_TIMEOUT);
     default:
         return E_FAIL;
     }
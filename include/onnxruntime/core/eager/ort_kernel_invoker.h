@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "core/common/common.h"
+#include "core/platform/ort_mutex.h"
 #include "core/framework/allocator.h"
 #include "core/framework/tensor.h"
 #include "core/framework/execution_provider.h"
@@ -44,11 +47,29 @@ class ORTInvoker {
                         const int version = -1);
 
  private:
+  // Pre-resolved graph node, kernel and value-index maps for one
+  // (op, attributes, input dtypes/devices) combination. Definition lives in
+  // the translation unit as it references internal framework types.
+  struct DispatchCacheEntry;
+
+  common::Status CreateDispatchEntry(const std::string& op_name,
+                                     const std::vector<OrtValue>& inputs,
+                                     size_t output_count,
+                                     const NodeAttributes* attributes,
+                                     const std::string& domain,
+                                     const int version,
+                                     std::shared_ptr<DispatchCacheEntry>& entry);
+
   std::shared_ptr<IExecutionProvider> execution_provider_;
   const logging::Logger& logger_;
   // custom ops for current execution provider
   // we need the op schema to resolve the output type during invoke
   const IOnnxRuntimeOpSchemaRegistryList& custom_op_registries_;
+  // Dispatch cache so repeated invocations of the same op skip graph
+  // construction, schema resolution and kernel creation. Entries are never
+  // evicted; eager workloads use a bounded set of op/dtype combinations.
+  std::unordered_map<std::string, std::shared_ptr<DispatchCacheEntry>> dispatch_cache_;
+  OrtMutex dispatch_cache_mutex_;
 };
 
 #ifdef __GNUC__
@@ -17,20 +17,30 @@ struct OrtArenaCfg {
                   arena_extend_strategy(-1),
                   initial_chunk_size_bytes(-1),
                   max_dead_bytes_per_chunk(-1),
-                  initial_growth_chunk_size_bytes(-1) {}
+                  initial_growth_chunk_size_bytes(-1),
+                  numa_aware(0),
+                  huge_page_threshold_bytes(0) {}
   OrtArenaCfg(size_t max_mem, int arena_extend_strategy, int initial_chunk_size_bytes,
-              int max_dead_bytes_per_chunk, int initial_growth_chunk_size_bytes)
+              int max_dead_bytes_per_chunk, int initial_growth_chunk_size_bytes,
+              int numa_aware = 0, size_t huge_page_threshold_bytes = 0)
       : max_mem(max_mem),
         arena_extend_strategy(arena_extend_strategy),
         initial_chunk_size_bytes(initial_chunk_size_bytes),
         max_dead_bytes_per_chunk(max_dead_bytes_per_chunk),
-        initial_growth_chunk_size_bytes(initial_growth_chunk_size_bytes) {}
+        initial_growth_chunk_size_bytes(initial_growth_chunk_size_bytes),
+        numa_aware(numa_aware),
+        huge_page_threshold_bytes(huge_page_threshold_bytes) {}
 
   size_t max_mem;                       // use 0 to allow ORT to choose the default
   int arena_extend_strategy;            // use -1 to allow ORT to choose the default, 0 = kNextPowerOfTwo, 1 = kSameAsRequested
   int initial_chunk_size_bytes;         // use -1 to allow ORT to choose the default
   int max_dead_bytes_per_chunk;         // use -1 to allow ORT to choose the default
   int initial_growth_chunk_size_bytes;  // use -1 to allow ORT to choose the default
+  int numa_aware;                       // use 1 to maintain one sub-arena per NUMA node, 0 for a single arena.
+                                        // Only honored by CPU based arenas on machines with more than one node.
+  size_t huge_page_threshold_bytes;     // ask the OS to back arena allocations of at least this many bytes with
+                                        // huge pages, reducing TLB pressure for large weight/activation buffers.
+                                        // Best effort; ignored where the platform has no support. use 0 to disable.
 };
 
 namespace onnxruntime {
@@ -70,6 +80,17 @@ class IAllocator {
 
   const OrtMemoryInfo& Info() const { return memory_info_; };
 
+  // Frees unused memory held back by an arena based allocator.
+  // The base implementation is a no-op so callers can request a shrink without knowing the
+  // concrete arena implementation behind the IAllocator interface.
+  virtual common::Status Shrink() { return common::Status::OK(); }
+
+  // A stronger form of Shrink() intended for explicit maintenance passes between requests:
+  // arena based allocators also return regions that Shrink() exempts (e.g. the initial
+  // allocation) to the system when they are entirely free.
+  // The base implementation forwards to Shrink().
+  virtual common::Status Compact() { return Shrink(); }
+
   // Each implementation of IAllocator can override and provide their own implementation
   virtual void GetStats(AllocatorStats* /*stats*/) { return; }
 
@@ -170,6 +170,55 @@ class IExecutionProvider {
   virtual common::Status SetComputeStream(void*) { return Status::OK(); }
   virtual void* GetComputeStream() const { return nullptr; }
 
+  /**
+     Indicate whether the provider supports having independent nodes dispatched concurrently by
+     the sequential executor. A provider that returns true receives the OnConcurrent* callbacks
+     below so it can order the concurrent work against its device queues (e.g. fork/join a group
+     of CUDA streams with events). Providers that execute synchronously on the dispatching thread
+     need no callbacks and simply return true.
+  */
+  virtual bool SupportsConcurrentNodeDispatch() const { return false; }
+
+  /**
+     Called on the dispatching thread before a group of independent nodes is executed
+     concurrently. The provider should make the concurrent work wait for all previously
+     submitted work (e.g. record a fork event on its main device queue).
+  */
+  virtual common::Status OnConcurrentDispatchBegin() const { return Status::OK(); }
+
+  /**
+     Called on the worker thread immediately before/after one node of a concurrent group is
+     executed, so the provider can bind the thread's device queue to the group's fork point and
+     publish its completion for OnConcurrentDispatchEnd.
+  */
+  virtual common::Status OnConcurrentNodeBegin() const { return Status::OK(); }
+  virtual common::Status OnConcurrentNodeEnd() const { return Status::OK(); }
+
+  /**
+     Called on the dispatching thread after every node of a concurrent group has been dispatched.
+     The provider should make all later work wait for the group (e.g. join the worker queues back
+     into its main device queue).
+  */
+  virtual common::Status OnConcurrentDispatchEnd() const { return Status::OK(); }
+
+  /**
+     Indicate whether the execution provider can capture the model into a device-side graph
+     (e.g. a CUDA graph) that is replayed on later runs instead of re-dispatching the kernels.
+  */
+  virtual bool IsGraphCaptureEnabled() const { return false; }
+
+  /**
+     Indicate whether a device-side graph has been captured. When this returns true the session
+     replays the captured graph via ReplayGraph instead of executing the kernels.
+  */
+  virtual bool IsGraphCaptured() const { return false; }
+
+  /**
+     Replay the captured device-side graph. Only valid after IsGraphCaptured returns true. The
+     feeds and fetches must occupy the same device buffers as the run that was captured.
+  */
+  virtual common::Status ReplayGraph() { return Status::OK(); }
+
   void InsertAllocator(AllocatorPtr allocator);
   void ReplaceAllocator(AllocatorPtr allocator);
   // TODO: temparary sulotion, need to unify the interface in EP and AllocatorManager
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <functional>
+
 namespace onnxruntime {
 
 using ProviderType = const std::string&;
@@ -49,6 +51,21 @@ class IFence {
   Called by executor before release OrtValue to see whether async data read is finished or not. This is non-blocking.
   */
   virtual bool CanRelease() = 0;
+
+  /**
+     Called by executor as an alternative to BeforeUsingAsInput when it is able to re-schedule the
+     dependent work instead of blocking the calling thread. If the wait for the previous write to
+     the OrtValue is still outstanding, arranges for ready_callback to be invoked once it completes
+     (possibly on an arbitrary thread, and possibly before this call returns) and returns true;
+     the caller must not use the OrtValue until the callback runs. Returns false when the value is
+     already safe to use, or when the fence does not support asynchronous waits, in which case the
+     caller should fall back to BeforeUsingAsInput. The default implementation does not support
+     asynchronous waits.
+  */
+  virtual bool RegisterInputReadyCallback(onnxruntime::ProviderType /*provider_type*/, int /*queue_id*/,
+                                          std::function<void()> /*ready_callback*/) {
+    return false;
+  }
 };
 using Fence_t = IFence*;
 using FencePtr = std::shared_ptr<IFence>;
@@ -96,6 +96,15 @@ class KernelRegistry {
   // key is opname+domain_name+provider_name
   KernelCreateMap kernel_creator_fn_map_;
 
+#if !defined(ORT_MINIMAL_BUILD)
+  // Op identifiers are interned at registration time: each distinct map key is assigned a dense id,
+  // and the kernels registered under it are stored contiguously in kernels_by_op_id_. TryFindKernel
+  // resolves a node with a single hash lookup plus a flat array scan instead of walking the
+  // string-keyed multimap, which matters when it is called once per node of a large model.
+  std::unordered_map<std::string, uint32_t> op_id_map_;
+  std::vector<std::vector<const KernelCreateInfo*>> kernels_by_op_id_;
+#endif
+
   // map from kernel def hash to entry in kernel_creator_fn_map_
   std::unordered_map<uint64_t, KernelCreateMap::iterator> kernel_def_hash_lookup_;
 };
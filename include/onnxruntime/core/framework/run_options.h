@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <atomic>
 #include "core/session/onnxruntime_c_api.h"
 #include "core/framework/config_options.h"
 
+namespace onnxruntime {
+class RunCostSummary;
+}
+
 /**
  * Configuration information for a Run call.
  */
@@ -38,6 +43,11 @@ struct OrtRunOptions {
   // /include/onnxruntime/core/session/onnxruntime_run_options_config_keys.h
   onnxruntime::ConfigOptions config_options;
 
+  // Cost breakdown of the most recent Run() call using this instance, populated when the
+  // kOrtRunOptionsConfigCollectCostBreakdown config entry is set to "1" and readable afterwards
+  // via the RunOptionsGetCostSummary API. mutable as Run() only receives the options const.
+  mutable std::shared_ptr<onnxruntime::RunCostSummary> cost_summary;
+
   OrtRunOptions() = default;
   ~OrtRunOptions() = default;
 };
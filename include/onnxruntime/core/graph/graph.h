@@ -20,6 +20,7 @@
 #include "core/graph/constants.h"
 #include "core/graph/graph_nodes.h"
 #include "core/graph/node_arg.h"
+#include "core/platform/ort_mutex.h"
 #if !defined(ORT_MINIMAL_BUILD)
 #include "onnx/defs/schema.h"
 #else
@@ -41,6 +42,7 @@ class Graph;
 struct IndexedSubGraph;
 class Model;
 class OpSignature;
+class ShapeInferenceMemo;
 
 namespace experimental {
 namespace fbs {
@@ -239,12 +241,12 @@ class Node {
 
   /** Gets a modifiable collection of the Node's input definitions. */
   std::vector<NodeArg*>& MutableInputDefs() noexcept {
-    return definitions_.input_defs;
+    return MutableDefinitions().input_defs;
   }
 
   /** Gets a modifiable collection of the Node's output definitions. */
   std::vector<NodeArg*>& MutableOutputDefs() noexcept {
-    return definitions_.output_defs;
+    return MutableDefinitions().output_defs;
   }
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 
@@ -663,6 +665,12 @@ class Graph {
   /** Removes all initializer tensors from this Graph and releases the memory they were using. */
   void CleanAllInitializedTensors() noexcept;
 
+  /** Releases the tensor data held by an initializer's TensorProto while keeping its metadata
+  (name, type, dims). Used during session state finalization to drop each weight's proto copy as
+  soon as its data has been transferred to an OrtValue, so two full copies of the model's weights
+  never coexist. The initializer can no longer be deserialized or saved afterwards. */
+  void ReleaseInitializerData(const std::string& initializer_name);
+
   /** Returns true if an initializer value can be overridden by a graph input with the same name. */
   bool CanOverrideInitializer() const noexcept { return ir_version_ >= 4; }
 
@@ -896,9 +904,36 @@ class Graph {
   This should be done after modifying any aspect of the Graph that changes the Nodes or relationships between them. */
   Graph& SetGraphResolveNeeded() noexcept {
     graph_resolve_needed_ = true;
+    ++mutation_epoch_;
     return *this;
   }
 
+  /** Record that a specific node was modified, so an incremental Resolve can limit type/shape
+  inference to the affected nodes. See ResolveOptions::incremental. */
+  void MarkNodeModified(NodeIndex node_index) {
+    modified_nodes_.insert(node_index);
+  }
+
+#if !defined(ORT_MINIMAL_BUILD)
+  /** Traversal orders computed by GraphViewer, cached on the Graph so repeated GraphViewer
+  construction between mutations (one per transformer, plus partitioning and planning) reuses the
+  flat index arrays instead of re-running the sorts. */
+  struct TraversalOrders {
+    std::vector<NodeIndex> root_nodes;
+    std::vector<NodeIndex> topological_order;
+    std::vector<NodeIndex> topological_order_with_priority;
+    std::vector<NodeIndex> topological_order_memory_efficient;
+    std::vector<NodeIndex> topological_order_locality_aware;
+  };
+
+  /** Copies the cached traversal orders into `orders` and returns true if a cache entry matching
+  the current graph contents exists. Any mutation of the graph invalidates the cache. */
+  bool GetCachedTraversalOrders(TraversalOrders& orders) const;
+
+  /** Stores traversal orders computed for the current graph contents. */
+  void CacheTraversalOrders(const TraversalOrders& orders) const;
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
   /** Gets flag indicating whether Graph::Resolve needs to be called before using the Graph. */
   bool GraphResolveNeeded() const noexcept {
     return graph_resolve_needed_;
@@ -1052,6 +1087,14 @@ class Graph {
   */
   void SetOutputs(const std::vector<const NodeArg*>& outputs);
 
+  /** Prune the graph to a subset of its current outputs.
+  Removes all nodes that do not contribute to any of the given outputs, sets the graph outputs to
+  the subset and marks the graph as needing to be Resolve-d.
+  @param outputs NodeArgs that must all be existing graph outputs.
+  @returns Status indicating success or providing an error message.
+  */
+  common::Status PruneToOutputs(const std::vector<const NodeArg*>& outputs);
+
   /** Sets the type of a NodeArg, replacing existing type/shape if any */
   void SetNodeArgType(NodeArg& arg, const ONNX_NAMESPACE::TypeProto& type_proto);
 
@@ -1118,6 +1161,12 @@ class Graph {
     // When set to true, graph resolve will be called for initialized function bodies as well. This is used 
     // in case of nested model local functions.
     bool traverse_function_body = false;
+    // When set to true, type/shape inference is re-run only for nodes modified since the last
+    // successful resolve and the nodes downstream of them. Structural validation (connections,
+    // topological sort) still covers the whole graph. Falls back to a full resolve when the graph
+    // has not been fully resolved before, contains subgraphs, or a change was made that cannot be
+    // attributed to individual nodes (e.g. SetInputs/SetOutputs or removing an initializer).
+    bool incremental = false;
   };
 
   /**
@@ -1242,6 +1291,9 @@ class Graph {
 
   Graph& GraphResolveNeeded(bool needed) noexcept {
     graph_resolve_needed_ = needed;
+    if (needed) {
+      ++mutation_epoch_;
+    }
     return *this;
   }
 
@@ -1303,7 +1355,10 @@ class Graph {
   // Iterate this Graph instance and all subgraphs, calling the provided function for each.
   common::Status ForThisAndAllSubgraphs(const std::vector<Graph*>& subgraphs, std::function<Status(Graph&)> func);
 
-  common::Status InferAndVerifyTypeMatch(Node& node, const ONNX_NAMESPACE::OpSchema& op, const ResolveOptions& options);
+  // memo, if provided, caches the per-node ONNX inference results so structurally identical nodes
+  // (clones of the same tower) only run the operator's inference function once.
+  common::Status InferAndVerifyTypeMatch(Node& node, const ONNX_NAMESPACE::OpSchema& op, const ResolveOptions& options,
+                                         ShapeInferenceMemo* memo = nullptr);
 
   // perform type and shape inferencing on the subgraph and Resolve to validate
   static common::Status InferAndVerifySubgraphTypes(const Node& node, Graph& subgraph,
@@ -1426,6 +1481,28 @@ class Graph {
   // A flag indicates whether <*this> graph needs to be resolved.
   bool graph_resolve_needed_ = false;
 
+  // nodes whose definitions/attributes changed since the last successful resolve. drives the
+  // ResolveOptions::incremental path; cleared on every successful resolve.
+  std::unordered_set<NodeIndex> modified_nodes_;
+
+  // true once a full resolve has completed and no change has been made since that cannot be
+  // attributed to individual nodes, i.e. an incremental resolve would be valid.
+  bool incremental_resolve_possible_ = false;
+
+  // when non-null (during an incremental resolve), the set of nodes type/shape inference must
+  // re-process; nodes outside the set keep the results of the previous resolve.
+  const std::unordered_set<NodeIndex>* nodes_to_reinfer_ = nullptr;
+
+  // bumped on every mutation; keys the traversal order cache below
+  uint64_t mutation_epoch_ = 1;
+
+#if !defined(ORT_MINIMAL_BUILD)
+  // cache of the traversal orders computed by GraphViewer. epoch 0 means no entry.
+  mutable OrtMutex traversal_orders_mutex_;
+  mutable TraversalOrders cached_traversal_orders_;
+  mutable uint64_t cached_traversal_orders_epoch_ = 0;
+#endif
+
   bool graph_proto_sync_needed_ = false;
 
   // The topological order of node index used to do node and op match verification temporarily.
@@ -179,6 +179,15 @@ class GraphViewer {
 #if !defined(ORT_MINIMAL_BUILD)
   // The NodeIndex values of the graph nodes sorted in topological order with priority.
   std::vector<NodeIndex> nodes_in_topological_order_with_priority_;
+
+  // The NodeIndex values of the graph nodes sorted in a topological order that greedily prefers
+  // nodes which grow the estimated live activation bytes the least, to lower peak planned memory.
+  std::vector<NodeIndex> nodes_in_topological_order_memory_efficient_;
+
+  // The NodeIndex values of the graph nodes sorted in a topological order that schedules
+  // consumers close to the producers of their largest inputs, to reduce cache thrash between
+  // kernels.
+  std::vector<NodeIndex> nodes_in_topological_order_locality_aware_;
 #endif
 
   // Graph root nodes.
@@ -157,7 +157,20 @@ class SchemaRegistryManager : public onnxruntime::IOnnxRuntimeOpSchemaCollection
  private:
   void GetDomainToVersionMapForRegistries(DomainToVersionMap& domain_version_map, bool is_onnx_only) const;
 
+  // the uncached lookup that GetSchemaAndHistory memoizes
+  void GetSchemaAndHistoryImpl(const std::string& key, int max_inclusive_version, const std::string& domain,
+                               const ONNX_NAMESPACE::OpSchema** latest_schema,
+                               int* earliest_opset_where_unchanged) const;
+
   std::deque<std::shared_ptr<IOnnxRuntimeOpSchemaCollection>> registries;
+
+  // Memo of previous GetSchemaAndHistory results, keyed by op type, domain and max inclusive
+  // version. A model usually has far fewer distinct (op, domain, version) combinations than nodes,
+  // so the greedy multi-registry search runs once per combination instead of once per node.
+  // Assumes the registered registries are not mutated while owned by this manager (the same
+  // assumption Node makes when caching its OpSchema pointer); cleared by RegisterRegistry.
+  mutable OrtMutex schema_cache_mutex_;
+  mutable std::unordered_map<std::string, std::pair<const ONNX_NAMESPACE::OpSchema*, int>> schema_cache_;
 };
 
 }  // namespace onnxruntime
@@ -13,6 +13,10 @@ namespace onnxruntime {
 struct FreeDimensionOverride;
 class IExecutionProvider;
 
+namespace concurrency {
+class ThreadPool;
+}
+
 namespace optimizer_utils {
 
 /** Generates all predefined rules for this level.
@@ -32,12 +36,14 @@ std::unique_ptr<RuleBasedGraphTransformer> GenerateRuleBasedGraphTransformer(
     const std::unordered_set<std::string>& compatible_execution_providers);
 
 /** Generates all predefined (both rule-based and non-rule-based) transformers for this level.
-    Any transformers or rewrite rules named in rules_and_transformers_to_disable will be excluded. */
+    Any transformers or rewrite rules named in rules_and_transformers_to_disable will be excluded.
+    If intra_op_thread_pool is provided, constant folding executes its kernels on that thread pool. */
 std::vector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
     TransformerLevel level,
     const SessionOptions& session_options,
     const IExecutionProvider& execution_provider /*required by constant folding*/,
-    const std::unordered_set<std::string>& rules_and_transformers_to_disable = {});
+    const std::unordered_set<std::string>& rules_and_transformers_to_disable = {},
+    concurrency::ThreadPool* intra_op_thread_pool = nullptr);
 
 }  // namespace optimizer_utils
 }  // namespace onnxruntime
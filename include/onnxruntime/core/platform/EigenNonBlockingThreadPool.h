@@ -37,6 +37,8 @@
 #include "core/common/spin_pause.h"
 #include "core/platform/ort_mutex.h"
 #include "core/platform/Barrier.h"
+#include "core/platform/threadpool.h"
+#include "core/platform/tracepoints.h"
 
 // ORT thread pool overview
 // ------------------------
@@ -317,6 +319,10 @@ class ExtendedThreadPoolInterface : public Eigen::ThreadPoolInterface {
                              unsigned n, std::ptrdiff_t block_size) = 0;
   virtual void StartProfiling()  = 0;
   virtual std::string StopProfiling() = 0;
+
+  // Always-on worker activity counters, see ThreadPoolStats.
+  virtual ThreadPoolStats GetStats() const = 0;
+  virtual void ResetStats() = 0;
 };
 
 
@@ -679,6 +685,36 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
     return profiler_.Stop();
   }
 
+  ThreadPoolStats GetStats() const override {
+    ThreadPoolStats stats;
+    stats.num_threads = num_threads_;
+    for (const auto& td : worker_data_) {
+      stats.tasks_executed += td.num_tasks_executed.load(std::memory_order_relaxed);
+      stats.steals += td.num_steals.load(std::memory_order_relaxed);
+      stats.parks += td.num_parks.load(std::memory_order_relaxed);
+      stats.unparks += td.num_unparks.load(std::memory_order_relaxed);
+      stats.queue_depth += td.queue.Size();
+    }
+    // counters are monotonic, so subtracting the baseline yields activity since the last reset
+    stats.tasks_executed -= stats_baseline_.tasks_executed;
+    stats.steals -= stats_baseline_.steals;
+    stats.parks -= stats_baseline_.parks;
+    stats.unparks -= stats_baseline_.unparks;
+    stats.blocked_threads = blocked_;
+    return stats;
+  }
+
+  void ResetStats() override {
+    ThreadPoolStats current;
+    for (const auto& td : worker_data_) {
+      current.tasks_executed += td.num_tasks_executed.load(std::memory_order_relaxed);
+      current.steals += td.num_steals.load(std::memory_order_relaxed);
+      current.parks += td.num_parks.load(std::memory_order_relaxed);
+      current.unparks += td.num_unparks.load(std::memory_order_relaxed);
+    }
+    stats_baseline_ = current;
+  }
+
   struct Tag {
     constexpr Tag() : v_(0) {
     }
@@ -722,7 +758,10 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
         env_(env),
         num_threads_(num_threads),
         allow_spinning_(allow_spinning),
+        worker_spin_count_(thread_options.worker_spin_count),
+        num_hot_standby_threads_(thread_options.num_hot_standby_threads),
         set_denormal_as_zero_(thread_options.set_denormal_as_zero),
+        worker_init_fn_(thread_options.worker_init_fn),
         worker_data_(num_threads),
         all_coprimes_(num_threads),
         blocked_(0),
@@ -1330,6 +1369,13 @@ int CurrentThreadId() const final {
     std::unique_ptr<Thread> thread;
     Queue queue;
 
+    // Always-on activity counters, written only by the owning worker thread with relaxed
+    // ordering and aggregated across workers in ThreadPoolTempl::GetStats.
+    std::atomic<uint64_t> num_tasks_executed{0};
+    std::atomic<uint64_t> num_steals{0};
+    std::atomic<uint64_t> num_parks{0};
+    std::atomic<uint64_t> num_unparks{0};
+
     // Each thread has a status, available read-only without locking, and protected
     // by the mutex field below for updates.  The status is used for three
     // purposes:
@@ -1419,12 +1465,19 @@ int CurrentThreadId() const final {
   Environment& env_;
   const unsigned num_threads_;
   const bool allow_spinning_;
+  const unsigned int worker_spin_count_;     // 0 selects the built-in spin duration
+  const int num_hot_standby_threads_;        // workers with id below this never park
   const bool set_denormal_as_zero_;
+  const std::function<void(int)> worker_init_fn_;  // user hook run once per worker before any work
   Eigen::MaxSizeVector<WorkerData> worker_data_;
   Eigen::MaxSizeVector<Eigen::MaxSizeVector<unsigned>> all_coprimes_;
   std::atomic<unsigned> blocked_;  // Count of blocked workers, used as a termination condition
   std::atomic<bool> done_;
 
+  // Snapshot of the cumulative worker counters at the last ResetStats call, subtracted from the
+  // live values in GetStats. Written only in ResetStats; callers serialize stats accesses.
+  ThreadPoolStats stats_baseline_;
+
   // Wake any blocked workers so that they can cleanly exit WorkerLoop().  For
   // a clean exit, each thread will observe (1) done_ set, indicating that the
   // destructor has been called, (2) all threads blocked, and (3) no
@@ -1448,27 +1501,51 @@ int CurrentThreadId() const final {
     assert(td.GetStatus() == WorkerData::ThreadStatus::Spinning);
 
     const int log2_spin = 20;
-    const int spin_count = allow_spinning_ ? (1ull<<log2_spin) : 0;
-    const int steal_count = spin_count/100;
+    // Hot standby workers spin even when spinning is otherwise disabled; they exist precisely to
+    // avoid the park/wake path.
+    const bool hot_standby = thread_id < num_hot_standby_threads_;
+    const int spin_count = (allow_spinning_ || hot_standby)
+                               ? (worker_spin_count_ > 0 ? static_cast<int>(worker_spin_count_) : (1 << log2_spin))
+                               : 0;
+    const int steal_count = spin_count > 100 ? spin_count / 100 : 1;
 
     SetDenormalAsZero(set_denormal_as_zero_);
+    if (worker_init_fn_) {
+      // user hook runs on the worker itself, after the built-in initialization above, so
+      // thread-local state it sets up is visible to all work this thread later runs.
+      // exceptions must not escape onto a pool thread.
+      ORT_TRY {
+        worker_init_fn_(thread_id);
+      }
+      ORT_CATCH(const std::exception&) {
+      }
+      ORT_CATCH(...) {
+      }
+    }
     profiler_.LogThreadId(thread_id);
 
     while (!should_exit) {
       Task t = q.PopFront();
       if (!t) {
-        // Spin waiting for work.
-        for (int i = 0; i < spin_count && !t && !done_; i++) {
-          if (((i+1)%steal_count == 0)) {
-            t = Steal(StealAttemptKind::TRY_ONE);
-          } else {
-            t = q.PopFront();
+        // Spin waiting for work.  A hot standby worker restarts the spin loop instead of falling
+        // through to block, so it is immediately available when the next request arrives; it only
+        // proceeds to the blocking path at shutdown, keeping the termination protocol below
+        // unchanged.
+        do {
+          for (int i = 0; i < spin_count && !t && !done_; i++) {
+            if (((i+1)%steal_count == 0)) {
+              t = Steal(StealAttemptKind::TRY_ONE);
+            } else {
+              t = q.PopFront();
+            }
+            onnxruntime::concurrency::SpinPause();
           }
-          onnxruntime::concurrency::SpinPause();
-        }
+        } while (hot_standby && !t && !done_);
 
         // Attempt to block
         if (!t) {
+          ORT_TRACEPOINT_THREADPOOL_PARK(thread_id);
+          td.num_parks.fetch_add(1, std::memory_order_relaxed);
           td.SetBlocked(// Pre-block test
                         [&]() -> bool {
                           bool should_block = true;
@@ -1525,6 +1602,8 @@ int CurrentThreadId() const final {
                         [&]() {
                           blocked_--;
                         });
+          ORT_TRACEPOINT_THREADPOOL_UNPARK(thread_id);
+          td.num_unparks.fetch_add(1, std::memory_order_relaxed);
           // Thread just unblocked.  Unless we picked up work while
           // blocking, or are exiting, then either work was pushed to
           // us, or it was pushed to an overloaded queue
@@ -1534,6 +1613,8 @@ int CurrentThreadId() const final {
       }
       if (t) {
         td.SetActive();
+        ORT_TRACEPOINT_THREADPOOL_TASK_START(thread_id);
+        td.num_tasks_executed.fetch_add(1, std::memory_order_relaxed);
         t();
         profiler_.LogRun(thread_id);
         td.SetSpinning();
@@ -1567,6 +1648,8 @@ int CurrentThreadId() const final {
       if (worker_data_[victim].GetStatus() == WorkerData::ThreadStatus::Active) {
         Task t = worker_data_[victim].queue.PopBack();
         if (t) {
+          ORT_TRACEPOINT_THREADPOOL_STEAL(pt->thread_id, victim);
+          worker_data_[pt->thread_id].num_steals.fetch_add(1, std::memory_order_relaxed);
           return t;
         }
       }
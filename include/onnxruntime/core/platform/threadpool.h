@@ -135,8 +135,23 @@ class ThreadPoolTempl;
 
 class ExtendedThreadPoolInterface;
 class LoopCounter;
+class LoopCostCalibrator;
 class ThreadPoolParallelSection;
 
+// Always-available activity counters for the worker threads of a pool, collected with relaxed
+// per-worker counters so they are cheap enough to stay enabled in production. The cumulative
+// counters cover activity since pool creation or the last ResetStats call; blocked_threads and
+// queue_depth are sampled at the time of the GetStats call.
+struct ThreadPoolStats {
+  uint64_t num_threads{0};      // number of worker threads in the pool
+  uint64_t tasks_executed{0};   // tasks run by the workers (excludes work run in calling threads)
+  uint64_t steals{0};           // tasks a worker stole from another worker's queue
+  uint64_t parks{0};            // times a worker gave up spinning and blocked on its condition variable
+  uint64_t unparks{0};          // times a blocked worker was woken
+  uint64_t blocked_threads{0};  // workers currently blocked
+  uint64_t queue_depth{0};      // total work items currently sitting in the worker queues
+};
+
 class ThreadPool {
  public:
 #ifdef _WIN32
@@ -222,6 +237,25 @@ class ThreadPool {
                   "Per-thread state should be trivially destructible");
   };
 
+  // Caps the degree of parallelism that parallel loops started from the current thread observe
+  // while the scope is alive.  Sessions sharing a global pool use this so that each Run only
+  // partitions its loops across the share of threads it was granted; work distribution itself
+  // still goes through the shared pool's scheduler.  Scopes may nest; the smallest cap wins.
+  // A cap of 0 leaves the degree of parallelism unchanged.  Has no effect with OpenMP.
+  class ParallelismCapScope {
+   public:
+    explicit ParallelismCapScope(int max_degree_of_parallelism);
+    ~ParallelismCapScope();
+
+   private:
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ParallelismCapScope);
+    friend class ThreadPool;
+
+    int previous_cap_;
+    // Per-thread cap observed by DegreeOfParallelism (0 means uncapped).
+    static thread_local int current_cap_;
+  };
+
   // Schedules fn() for execution in the pool of threads.  The function may run
   // synchronously if it cannot be enqueued.  This will occur if the thread pool's
   // degree-of-parallelism is 1, but it may also occur for implementation-dependent
@@ -384,6 +418,15 @@ class ThreadPool {
   static void StartProfiling(concurrency::ThreadPool* tp);
   static std::string StopProfiling(concurrency::ThreadPool* tp);
 
+  // Read the always-on worker activity counters. Returns zeroed stats when tp is nullptr or the
+  // pool runs work inline (degree of parallelism 1).
+  static ThreadPoolStats GetStats(const ThreadPool* tp);
+
+  // Fold the current counter values into the baseline so that subsequent GetStats calls report
+  // activity since this point. Concurrent GetStats/ResetStats calls must be serialized by the
+  // caller.
+  static void ResetStats(ThreadPool* tp);
+
  private:
   friend class LoopCounter;
 
@@ -443,6 +486,11 @@ class ThreadPool {
 
   // If used, underlying_threadpool_ is instantiated and owned by the ThreadPool.
   std::unique_ptr<ThreadPoolTempl<Env> > extended_eigen_threadpool_;
+
+  // Learns the measured per-iteration cost of parallel loops from their first few executions and
+  // uses it instead of the caller supplied TensorOpCost estimate for later scheduling decisions.
+  // Only instantiated when the pool actually has worker threads.
+  std::unique_ptr<LoopCostCalibrator> loop_cost_calibrator_;
 };
 
 }  // namespace concurrency
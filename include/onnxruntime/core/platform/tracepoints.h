@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Statically defined tracepoints (USDT) for correlating onnxruntime internals with system-wide
+// traces. Enabled on Linux with the onnxruntime_ENABLE_SDT_TRACEPOINTS build option; each probe
+// then compiles to a single nop plus an ELF note and can be attached to with perf, bpftrace or
+// systemtap under the sdt_onnxruntime provider, e.g.:
+//
+//   perf probe -x libonnxruntime.so sdt_onnxruntime:kernel_begin
+//   bpftrace -e 'usdt:libonnxruntime.so:onnxruntime:threadpool_park { @[tid] = count(); }'
+//
+// When disabled (the default) every macro expands to nothing, so these can sit on hot paths.
+// The equivalent ETW coverage of the run and kernel events on Windows already exists via
+// ONNXRUNTIME_ENABLE_INSTRUMENT and core/platform/tracing.h.
+
+#if defined(ENABLE_SDT_TRACEPOINTS) && !defined(_WIN32)
+
+#include <sys/sdt.h>
+
+// run_tag is the RunOptions tag of the request, usable to correlate run spans with kernel events
+#define ORT_TRACEPOINT_RUN_BEGIN(run_tag) DTRACE_PROBE1(onnxruntime, run_begin, (run_tag))
+#define ORT_TRACEPOINT_RUN_END(run_tag) DTRACE_PROBE1(onnxruntime, run_end, (run_tag))
+
+#define ORT_TRACEPOINT_KERNEL_BEGIN(op_type, node_name) \
+  DTRACE_PROBE2(onnxruntime, kernel_begin, (op_type), (node_name))
+#define ORT_TRACEPOINT_KERNEL_END(op_type, node_name) \
+  DTRACE_PROBE2(onnxruntime, kernel_end, (op_type), (node_name))
+
+// a worker thread starts executing a task from its own queue or a stolen one
+#define ORT_TRACEPOINT_THREADPOOL_TASK_START(thread_id) \
+  DTRACE_PROBE1(onnxruntime, threadpool_task_start, (thread_id))
+// a steal attempt succeeded against the given victim's queue
+#define ORT_TRACEPOINT_THREADPOOL_STEAL(thread_id, victim) \
+  DTRACE_PROBE2(onnxruntime, threadpool_steal, (thread_id), (victim))
+// brackets a worker's blocking attempt; the span between park and unpark is the time the worker
+// was unavailable for dispatch
+#define ORT_TRACEPOINT_THREADPOOL_PARK(thread_id) \
+  DTRACE_PROBE1(onnxruntime, threadpool_park, (thread_id))
+#define ORT_TRACEPOINT_THREADPOOL_UNPARK(thread_id) \
+  DTRACE_PROBE1(onnxruntime, threadpool_unpark, (thread_id))
+
+// the arena grew by extend_bytes to total_bytes of backing memory
+#define ORT_TRACEPOINT_ARENA_EXTEND(allocator_name, extend_bytes, total_bytes) \
+  DTRACE_PROBE3(onnxruntime, arena_extend, (allocator_name), (extend_bytes), (total_bytes))
+
+#else
+
+#define ORT_TRACEPOINT_RUN_BEGIN(run_tag)
+#define ORT_TRACEPOINT_RUN_END(run_tag)
+#define ORT_TRACEPOINT_KERNEL_BEGIN(op_type, node_name)
+#define ORT_TRACEPOINT_KERNEL_END(op_type, node_name)
+#define ORT_TRACEPOINT_THREADPOOL_TASK_START(thread_id)
+#define ORT_TRACEPOINT_THREADPOOL_STEAL(thread_id, victim)
+#define ORT_TRACEPOINT_THREADPOOL_PARK(thread_id)
+#define ORT_TRACEPOINT_THREADPOOL_UNPARK(thread_id)
+#define ORT_TRACEPOINT_ARENA_EXTEND(allocator_name, extend_bytes, total_bytes)
+
+#endif
@@ -7,6 +7,7 @@
 #include <memory>
 #include "core/common/common.h"
 #include "core/common/status.h"
+#include "core/platform/ort_mutex.h"
 #include "core/platform/threadpool.h"
 #include "core/common/logging/logging.h"
 #include "core/framework/allocator.h"
@@ -79,6 +80,26 @@ class Environment {
   */
   Status UnregisterAllocator(const OrtMemoryInfo& mem_info);
 
+  /**
+   * Registers a session's concurrency weight with the global thread pool governor.  Sessions
+   * sharing the global intra-op thread pool declare a weight, and each Run partitions its
+   * parallel loops across a share of the pool proportional to weight / (sum of all weights).
+   * Weights <= 0 are ignored (the session runs ungoverned).
+  */
+  void RegisterSessionConcurrencyWeight(int weight) const;
+
+  /**
+   * Removes a weight previously added with RegisterSessionConcurrencyWeight.
+  */
+  void UnregisterSessionConcurrencyWeight(int weight) const;
+
+  /**
+   * Returns the degree of parallelism a session with the given weight should cap its parallel
+   * loops at, or 0 if no cap applies (no global pool, weight <= 0, or the session is the only
+   * registered one).
+  */
+  int GetSessionRunParallelism(int weight) const;
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(Environment);
 
@@ -92,5 +113,10 @@ class Environment {
   std::unique_ptr<onnxruntime::concurrency::ThreadPool> inter_op_thread_pool_;
   bool create_global_thread_pools_{false};
   std::vector<AllocatorPtr> shared_allocators_;
+
+  // Global thread pool concurrency governor state.  Mutable so that sessions, which only hold
+  // a const reference to the environment, can register/unregister their weights.
+  mutable OrtMutex concurrency_weights_mutex_;
+  mutable int total_session_concurrency_weight_{0};
 };
 }  // namespace onnxruntime
@@ -168,6 +168,7 @@ typedef enum OrtErrorCode {
   ORT_NOT_IMPLEMENTED,
   ORT_INVALID_GRAPH,
   ORT_EP_FAIL,
+  ORT_DEADLINE_EXCEEDED,
 } OrtErrorCode;
 
 #define ORT_RUNTIME_CLASS(X) \
@@ -407,6 +408,25 @@ typedef struct OrtApiBase OrtApiBase;
 
 ORT_EXPORT const OrtApiBase* ORT_API_CALL OrtGetApiBase(void) NO_EXCEPTION;
 
+/**
+ * Callback invoked by RunAsync when the scheduled run completes.
+ *
+ * \param user_data the opaque pointer that was passed to RunAsync
+ * \param outputs the output values. On success entries that were passed in as nullptr have been
+ *                populated with newly created OrtValue instances that the callback owns
+ * \param num_outputs number of entries in outputs
+ * \param status nullptr on success, otherwise the failure status. Must be released with ReleaseStatus
+ */
+typedef void(ORT_API_CALL* RunAsyncCallbackFn)(void* user_data, OrtValue** outputs, size_t num_outputs,
+                                               OrtStatusPtr status);
+
+/**
+ * DLPack managed tensor, defined in dlpack/dlpack.h (https://github.com/dmlc/dlpack).
+ * Only the pointer type appears in this API so the DLPack header is not required to use
+ * the rest of OrtApi.
+ */
+struct DLManagedTensor;
+
 struct OrtApi {
   /**
 * \param msg A null-terminated string. Its content will be copied into the newly created OrtStatus
@@ -1777,6 +1797,202 @@ struct OrtApi {
    * \param[out] indices out param where the pointer to the internal buffer is returned. Do not free this buffer.
    */
   ORT_API2_STATUS(GetSparseTensorIndices, _In_ const OrtValue* ort_value, enum OrtSparseIndicesFormat indices_format, _Out_ size_t* num_indices, _Outptr_ const void** indices);
+
+  /**
+   * Run the model asynchronously on one of the session's thread pools and invoke run_async_callback
+   * on completion, so callers can drive many in-flight requests without blocking a thread per Run.
+   *
+   * The session must have an inter-op or intra-op thread pool with at least one thread available.
+   * input_names/inputs/output_names may be freed once this call returns; the outputs array must stay
+   * valid until the callback fires. As with Run, entries in outputs may be pre-allocated values or
+   * nullptr, in which case ORT allocates them and the callback owns them.
+   *
+   * \param[in] sess session to run the model with
+   * \param[in] run_options run options, may be nullptr for defaults
+   * \param[in] input_names names of the inputs, array of input_len elements
+   * \param[in] input input values, array of input_len elements
+   * \param[in] input_len number of inputs
+   * \param[in] output_names1 names of the outputs, array of output_names_len elements
+   * \param[in] output_names_len number of outputs
+   * \param[in,out] output array of output_names_len OrtValue* entries, populated on success
+   * \param[in] run_async_callback callback invoked on completion (success or failure)
+   * \param[in] user_data opaque pointer passed through to the callback, may be nullptr
+   */
+  ORT_API2_STATUS(RunAsync, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                  _In_reads_(input_len) const char* const* input_names,
+                  _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                  _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                  _Inout_updates_all_(output_names_len) OrtValue** output,
+                  _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data);
+
+  /**
+   * Create an OrtValue that wraps the memory of a DLPack managed tensor without copying it,
+   * including device (e.g. CUDA) memory. Ownership of dlmanaged_tensor transfers to the
+   * returned OrtValue; its deleter is invoked when the OrtValue is released, so the caller
+   * must not consume the DLPack tensor again.
+   *
+   * Only available in builds with DLPack support; otherwise a failure status is returned.
+   *
+   * \param[in] dlmanaged_tensor the DLPack tensor to wrap
+   * \param[in] is_bool_tensor non-zero if the 8-bit data should be interpreted as bool rather
+   *                           than uint8, which DLPack cannot distinguish
+   * \param[out] out newly created OrtValue. Must be freed with ReleaseValue
+   */
+  ORT_API2_STATUS(CreateValueFromDlpack, _In_ struct DLManagedTensor* dlmanaged_tensor, int is_bool_tensor,
+                  _Outptr_ OrtValue** out);
+
+  /**
+   * Export a tensor OrtValue as a DLPack managed tensor without copying the data. The returned
+   * tensor shares ownership of the underlying buffer, which stays valid even if the OrtValue is
+   * released first; the consumer must call the tensor's deleter when done with it (frameworks
+   * that consume DLPack, e.g. via from_dlpack, do this automatically).
+   *
+   * Only available in builds with DLPack support; otherwise a failure status is returned.
+   *
+   * \param[in] value tensor OrtValue to export
+   * \param[out] out DLPack managed tensor pointing at the OrtValue's buffer
+   */
+  ORT_API2_STATUS(CreateDlpackFromValue, _In_ OrtValue* value, _Outptr_ struct DLManagedTensor** out);
+
+  /**
+   * Fetch an allocator for temporary scratch allocations inside a custom operator kernel. The
+   * allocator is tied to the session running the kernel (typically arena-backed), so repeated
+   * Compute calls reuse memory instead of hitting the system allocator.
+   *
+   * Only valid during the KernelCompute callback of a custom op.
+   *
+   * \param[in] context kernel context passed to KernelCompute
+   * \param[out] out allocator for scratch memory. Must be freed with ReleaseAllocator; allocations
+   *                 made from it must not outlive the kernel context
+   */
+  ORT_API2_STATUS(KernelContext_GetTempSpaceAllocator, _In_ const OrtKernelContext* context,
+                  _Outptr_ OrtAllocator** out);
+
+  /**
+   * Run fn on the intra-op thread pool of the session running a custom operator kernel, invoking
+   * fn(usr_data, i) for every i in [0, total). When num_batch is non-zero the iteration space is
+   * chunked into batches of that size and each batch is one unit of scheduling work, which is
+   * preferred when individual iterations are small. Blocks until all iterations complete; when the
+   * session has no intra-op thread pool the iterations run sequentially on the calling thread.
+   *
+   * Only valid during the KernelCompute callback of a custom op.
+   *
+   * \param[in] context kernel context passed to KernelCompute
+   * \param[in] fn function to invoke per iteration or batch element
+   * \param[in] total number of iterations
+   * \param[in] num_batch number of iterations per scheduled batch, or 0 to let each iteration be
+   *                      scheduled individually
+   * \param[in] usr_data opaque pointer passed through as the first argument of fn, may be nullptr
+   */
+  ORT_API2_STATUS(KernelContext_ParallelFor, _In_ const OrtKernelContext* context,
+                  _In_ void (ORT_API_CALL* fn)(void*, size_t), _In_ size_t total, _In_ size_t num_batch,
+                  _In_opt_ void* usr_data);
+
+  /**
+   * Get the aggregated per-op-type execution statistics of a session as a JSON string. Statistics
+   * are collected when the session was created with the "session.collect_op_stats" config entry
+   * set to "1"; each op type maps to its invocation count, the total kernel time in nanoseconds
+   * and the total bytes of tensor input and output moved. Unlike profiling this is cheap enough
+   * to stay enabled in production and may be queried while other threads are running inference.
+   *
+   * \param[in] sess the session to query
+   * \param[in] allocator allocator used to allocate the returned string
+   * \param[out] out a null terminated JSON object keyed by op type, or "{}" when collection is
+   *                 disabled. Must be freed with OrtAllocator::Free
+   */
+  ORT_API2_STATUS(SessionGetOpTypeStats, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /**
+   * Get the live statistics of the allocator a session uses for the given memory location as a
+   * JSON string, so memory growth can be monitored in production without attaching a debugger.
+   * The object carries current and peak bytes in use, total bytes the allocator has reserved
+   * from the system, the largest single allocation seen, and allocation / arena extension /
+   * arena shrinkage counters. Counters that a particular allocator does not track (for example
+   * arena extensions on a non-arena allocator) are reported as 0.
+   *
+   * \param[in] sess the session to query
+   * \param[in] mem_info memory location identifying the allocator, as used with CreateAllocator
+   * \param[in] allocator allocator used to allocate the returned string
+   * \param[out] out a null terminated JSON object. Must be freed with OrtAllocator::Free
+   */
+  ORT_API2_STATUS(SessionGetAllocatorStats, _In_ const OrtSession* sess, _In_ const OrtMemoryInfo* mem_info,
+                  _Inout_ OrtAllocator* allocator, _Outptr_ char** out);
+
+  /**
+   * Get the cost breakdown of the most recent Run call that used the given run options as a JSON
+   * string. A breakdown is collected when the run options carry the "run.collect_cost_breakdown"
+   * config entry set to "1"; it splits the run wall time in nanoseconds into kernel compute time,
+   * data movement time (Memcpy nodes and cross-device input/output copies) and the remaining
+   * framework overhead. Collection costs two clock reads per node, so it can stay enabled on
+   * sampled production traffic. A collecting OrtRunOptions instance must not be shared by
+   * concurrent Run calls, as each run resets the summary.
+   *
+   * \param[in] options the run options the Run call was made with
+   * \param[in] allocator allocator used to allocate the returned string
+   * \param[out] out a null terminated JSON object with keys "total_ns", "kernel_ns", "copy_ns"
+   *                 and "framework_ns", or "{}" when no breakdown has been collected. Must be
+   *                 freed with OrtAllocator::Free
+   */
+  ORT_API2_STATUS(RunOptionsGetCostSummary, _In_ const OrtRunOptions* options, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /**
+   * Get the activity counters of the intra-op thread pool the session uses as a JSON string, so
+   * thread starvation or oversubscription can be diagnosed in production. The counters are
+   * always on (relaxed per-worker counters, no measurable overhead) and cover activity since
+   * pool creation or the last SessionResetIntraOpThreadPoolStats call: tasks executed by the
+   * workers, tasks stolen from another worker's queue, and how often workers parked on / were
+   * woken from their condition variable. The object additionally reports the number of worker
+   * threads, the workers currently blocked and the work items currently queued, both sampled at
+   * call time.
+   *
+   * \param[in] sess the session to query
+   * \param[in] allocator allocator used to allocate the returned string
+   * \param[out] out a null terminated JSON object, or "{}" when the session runs work inline
+   *                 (no worker threads). Must be freed with OrtAllocator::Free
+   */
+  ORT_API2_STATUS(SessionGetIntraOpThreadPoolStats, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /**
+   * Reset the intra-op thread pool counters reported by SessionGetIntraOpThreadPoolStats so
+   * that subsequent reads report activity since this point, supporting per-interval monitoring.
+   * When sessions share the global thread pool the counters are reset for all of them.
+   *
+   * \param[in] sess the session whose intra-op thread pool counters are reset
+   */
+  ORT_API2_STATUS(SessionResetIntraOpThreadPoolStats, _Inout_ OrtSession* sess);
+
+  /**
+   * Set the global random seed used by random number generating operators, so a captured request
+   * can be re-executed with the same random sequence (see the "session.replay_capture_file"
+   * session option). Affects all sessions in the process; existing generator state is reset.
+   *
+   * \param[in] seed the seed value to use
+   */
+  ORT_API2_STATUS(SetGlobalRandomSeed, int64_t seed);
+
+  /**
+   * Point an existing OrtValue at a new user-provided buffer and shape, reusing the OrtValue
+   * and the tensor it wraps instead of allocating fresh ones per request. Bindings that feed
+   * many tensors per request can create their OrtValues once with
+   * CreateTensorWithDataAsOrtValue and rebind them here each request, eliminating the per-call
+   * wrapper allocation and destruction in steady state. As with
+   * CreateTensorWithDataAsOrtValue, p_data is not copied and must stay valid until the value
+   * is released or rebound again; any buffer the value previously owned is released.
+   *
+   * \param[in,out] value the value to rebind; must be a tensor or an uninitialized value
+   * \param[in] info memory description of where p_data resides
+   * \param[in,out] p_data the new tensor data
+   * \param[in] p_data_len the length of p_data in bytes
+   * \param[in] shape the new tensor shape
+   * \param[in] shape_len the number of dimensions in shape
+   * \param[in] type the element type of p_data; may differ from the previous binding
+   */
+  ORT_API2_STATUS(RebindTensorWithDataAsOrtValue, _Inout_ OrtValue* value, _In_ const OrtMemoryInfo* info,
+                  _Inout_ void* p_data, size_t p_data_len, _In_ const int64_t* shape, size_t shape_len,
+                  ONNXTensorElementDataType type);
 };
 
 /*
@@ -1827,6 +2043,14 @@ struct OrtCustomOp {
   // Returns the characteristics of the input & output tensors
   OrtCustomOpInputOutputCharacteristic(ORT_API_CALL* GetInputCharacteristic)(_In_ const struct OrtCustomOp* op, _In_ size_t index);
   OrtCustomOpInputOutputCharacteristic(ORT_API_CALL* GetOutputCharacteristic)(_In_ const struct OrtCustomOp* op, _In_ size_t index);
+
+  // Performs prepacking of constant initializer inputs, mirroring OpKernel::PrePack. Called once per
+  // constant initializer input of the kernel at session initialization. Set out_is_packed to non-zero
+  // if the kernel keeps a packed copy, which MUST be allocated with the supplied allocator; the
+  // original initializer may then be released before inference and will not be available in
+  // KernelCompute. Only consulted when version is 10 or later; may be null.
+  OrtStatusPtr(ORT_API_CALL* KernelPrePack)(_In_ void* op_kernel, _In_ const OrtValue* tensor, _In_ int input_idx,
+                                            _Inout_ OrtAllocator* allocator, _Out_ int* out_is_packed);
 };
 
 /*
@@ -874,6 +874,10 @@ struct CustomOpApi {
   const OrtValue* KernelContext_GetInput(const OrtKernelContext* context, _In_ size_t index);
   size_t KernelContext_GetOutputCount(const OrtKernelContext* context);
   OrtValue* KernelContext_GetOutput(OrtKernelContext* context, _In_ size_t index, _In_ const int64_t* dim_values, size_t dim_count);
+  OrtAllocator* KernelContext_GetTempSpaceAllocator(const OrtKernelContext* context);
+  void ReleaseAllocator(OrtAllocator* allocator);
+  void KernelContext_ParallelFor(const OrtKernelContext* context, void (ORT_API_CALL* fn)(void*, size_t), size_t total,
+                                 size_t num_batch, void* usr_data);
 
   void ThrowOnError(OrtStatus* result);
 
@@ -901,6 +905,9 @@ struct CustomOpBase : OrtCustomOp {
 
     OrtCustomOp::GetInputCharacteristic = [](const OrtCustomOp* this_, size_t index) { return static_cast<const TOp*>(this_)->GetInputCharacteristic(index); };
     OrtCustomOp::GetOutputCharacteristic = [](const OrtCustomOp* this_, size_t index) { return static_cast<const TOp*>(this_)->GetOutputCharacteristic(index); };
+
+    // Kernels that want prepacking should set this to a bridge into their own implementation
+    OrtCustomOp::KernelPrePack = nullptr;
   }
 
   // Default implementation of GetExecutionProviderType that returns nullptr to default to the CPU provider
@@ -1132,6 +1132,22 @@ inline OrtValue* CustomOpApi::KernelContext_GetOutput(OrtKernelContext* context,
   return out;
 }
 
+inline OrtAllocator* CustomOpApi::KernelContext_GetTempSpaceAllocator(const OrtKernelContext* context) {
+  OrtAllocator* out;
+  ThrowOnError(api_.KernelContext_GetTempSpaceAllocator(context, &out));
+  return out;
+}
+
+inline void CustomOpApi::ReleaseAllocator(OrtAllocator* allocator) {
+  api_.ReleaseAllocator(allocator);
+}
+
+inline void CustomOpApi::KernelContext_ParallelFor(const OrtKernelContext* context,
+                                                   void(ORT_API_CALL* fn)(void*, size_t), size_t total,
+                                                   size_t num_batch, void* usr_data) {
+  ThrowOnError(api_.KernelContext_ParallelFor(context, fn, total, num_batch, usr_data));
+}
+
 inline SessionOptions& SessionOptions::DisablePerSessionThreads() {
   ThrowOnError(GetApi().DisablePerSessionThreads(p_));
   return *this;
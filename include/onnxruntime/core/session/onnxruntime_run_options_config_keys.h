@@ -25,3 +25,27 @@
 // Example usage: "cpu:0;gpu:0" (or) "gpu:0"
 // By default, the value for this key is empty (i.e.) no memory arenas are shrunk
 static const char* const kOrtRunOptionsConfigEnableMemoryArenaShrinkage = "memory.enable_memory_arena_shrinkage";
+
+// Key for setting a time budget for a single Run() call, in microseconds. Expects a positive integer.
+// The deadline is checked between kernel dispatches, so a run is abandoned shortly after the budget
+// elapses (a long-running kernel is never interrupted mid-flight) and Run() returns a status with
+// code DEADLINE_EXCEEDED. Checking is cheap but not free, so the check only happens when this key
+// is set. By default, the value for this key is empty (i.e.) runs have no deadline
+static const char* const kOrtRunOptionsConfigRunDeadlineMicroseconds = "run.deadline_microseconds";
+
+// Key for collecting a coarse per-run cost breakdown (kernel compute vs. data movement vs.
+// framework overhead). Set to "1" to collect, the breakdown can be read back after Run() via the
+// RunOptionsGetCostSummary API. Collection costs two clock reads per node, so it is cheap enough
+// for sampled production traffic. Kernel and copy buckets are only filled under sequential
+// execution (the default); under parallel execution only the total is reported. A RunOptions
+// instance collecting a breakdown must not be shared by concurrent Run() calls, as each run
+// resets the summary. "0" = disabled. Default is "0"
+static const char* const kOrtRunOptionsConfigCollectCostBreakdown = "run.collect_cost_breakdown";
+
+// Key for selecting the priority lane of a Run() call. "high" marks the run as latency sensitive;
+// while at least one high-priority run is active, any run marked "low" pauses between kernel
+// dispatches (a kernel already executing is never interrupted), so batch traffic stops competing
+// for the intra-op thread pool. Runs that do not set this key are unaffected and never wait.
+// Priority only takes effect under sequential execution (the default). Valid values are "high"
+// and "low". By default, the value for this key is empty (i.e.) the run uses the normal lane
+static const char* const kOrtRunOptionsConfigRunPriority = "run.priority";
@@ -32,6 +32,14 @@ static const char* const kOrtSessionOptionsConfigLoadModelFormat = "session.load
 // If unset, format will default to ONNX unless optimized_model_filepath ends in '.ort'.
 static const char* const kOrtSessionOptionsConfigSaveModelFormat = "session.save_model_format";
 
+// Set to an existing directory to enable the persistent optimized-model cache. The first
+// initialization of a model writes the fully optimized graph and kernel assignments there in ORT
+// format, keyed on the model contents, ORT version, execution provider set and optimization level.
+// Later sessions with a matching key load the cached artifact and skip graph optimization and
+// partitioning. Artifacts may contain hardware specific optimizations, so the cache directory
+// should not be shared between machines. Only models loaded from a file are cached.
+static const char* const kOrtSessionOptionsConfigOptimizedModelCacheDir = "session.optimized_model_cache_dir";
+
 // If a value is "1", flush-to-zero and denormal-as-zero are applied. The default is "0".
 // When multiple sessions are created, a main thread doesn't override changes from succeeding session options,
 // but threads in session thread pools follow option changes.
@@ -41,6 +49,13 @@ static const char* const kOrtSessionOptionsConfigSaveModelFormat = "session.save
 // and that's recommended because turning this option on may hurt model accuracy.
 static const char* const kOrtSessionOptionsConfigSetDenormalAsZero = "session.set_denormal_as_zero";
 
+// "1": at session initialization, measure this machine's thread pool dispatch overhead and single
+// threaded GEMM rate once per process and derive the MLAS threading thresholds from them, replacing
+// the static heuristics. Helps high-core-count machines that otherwise overshard small GEMMs, and
+// small cores that leave threading unused. "0" (the default) keeps the static thresholds. The
+// measurement takes a few milliseconds and runs on the first session that enables it.
+static const char* const kOrtSessionOptionsConfigMlasThreadingCalibration = "session.mlas_threading_calibration";
+
 // It controls to run quantization model in QDQ (QuantizelinearDeQuantizelinear) format or not.
 // "0": enable. ORT does fusion logic for QDQ format.
 // "1": disable. ORT doesn't do fusion logic for QDQ format.
@@ -51,6 +66,30 @@ static const char* const kOrtSessionOptionsDisableQuantQDQ = "session.disable_qu
 // GeluApproximation has side effects which may change the inference results. It is disabled by default due to this.
 static const char* const kOrtSessionOptionsEnableGeluApproximation = "optimization.enable_gelu_approximation";
 
+// Quantize large constant MatMul weights to this many bits ("4" or "8") and compute with
+// on-the-fly dequantization. "0" leaves weights in float. The default is "0".
+// The rounding changes the inference results slightly, so this is disabled by default.
+static const char* const kOrtSessionOptionsWeightOnlyQuantBits = "optimization.weight_only_quant_bits";
+
+// Split eligible chains of stride-1 Conv and elementwise activation nodes into this many horizontal
+// bands executed independently, so each band's intermediate activations stay in cache instead of
+// streaming whole feature maps through memory between layers. "0" (the default) disables tiling.
+// The results are unchanged; this is opt-in because the best band count depends on the model's
+// activation sizes and the target's cache hierarchy.
+static const char* const kOrtSessionOptionsSpatialTilingTileCount = "optimization.spatial_tiling_tile_count";
+
+// Enable or disable automatic mixed precision conversion for the CUDA EP. "0": disable; "1": enable.
+// The default is "0". When enabled, fp16-safe ops (MatMul/Gemm/Conv, the attention and gelu contrib
+// ops, ...) assigned to the CUDA EP are converted to float16 with casts at the region boundaries,
+// while reductions, Softmax and the normalization ops keep accumulating in float.
+// This changes the inference results, so it is disabled by default.
+static const char* const kOrtSessionOptionsEnableAutoMixedPrecision = "optimization.enable_auto_mixed_precision";
+
+// Comma separated op types added to (allow) or removed from (deny) the default mixed precision
+// allow list. Only read when kOrtSessionOptionsEnableAutoMixedPrecision is "1".
+static const char* const kOrtSessionOptionsAutoMixedPrecisionAllowOps = "optimization.auto_mixed_precision_allow_ops";
+static const char* const kOrtSessionOptionsAutoMixedPrecisionDenyOps = "optimization.auto_mixed_precision_deny_ops";
+
 // Enable or disable using device allocator for allocating initialized tensor memory. "1": enable; "0": disable. The default is "0".
 // Using device allocators means the memory allocation is made using malloc/new.
 static const char* const kOrtSessionOptionsUseDeviceAllocatorForInitializers = "session.use_device_allocator_for_initializers";
@@ -61,6 +100,52 @@ static const char* const kOrtSessionOptionsUseDeviceAllocatorForInitializers = "
 static const char* const kOrtSessionOptionsConfigAllowInterOpSpinning = "session.inter_op.allow_spinning";
 static const char* const kOrtSessionOptionsConfigAllowIntraOpSpinning = "session.intra_op.allow_spinning";
 
+// Explicit affinity masks for the threads of the per-session intra-op thread pool.
+// The value is one entry per thread, entries separated by ";", where each entry is a
+// ","-separated list of logical processor ids the thread may run on. For example "0,1;2,3"
+// binds the first thread to processors 0 and 1 and the second thread to processors 2 and 3.
+// When set, the pool is sized to the number of entries unless an explicit intra-op thread
+// count is also configured. Takes precedence over the NUMA node and SMT sibling options below.
+// The default is "" (no explicit binding).
+static const char* const kOrtSessionOptionsConfigIntraOpThreadAffinities = "session.intra_op.thread_affinities";
+
+// Binds every thread of the per-session intra-op thread pool to the logical processors of the
+// given NUMA node, keeping the threads and the memory they touch node local. The value is a
+// non-negative node id; the default is "-1" (no NUMA binding). Ignored when explicit thread
+// affinities are configured.
+static const char* const kOrtSessionOptionsConfigIntraOpNumaNode = "session.intra_op.numa_node";
+
+// Number of iterations a worker of the per-session intra-op thread pool spins waiting for work
+// before parking. "0" (the default) keeps the built-in spin duration. Larger values lower the
+// wakeup latency at the start of a parallel region at the cost of CPU time. No effect when
+// spinning is disabled via kOrtSessionOptionsConfigAllowIntraOpSpinning.
+static const char* const kOrtSessionOptionsConfigIntraOpSpinCount = "session.intra_op.spin_count";
+
+// Keeps the first N workers of the per-session intra-op thread pool busy-polling between
+// requests instead of parking them, so short parallel regions never pay the futex wakeup cost.
+// The hot workers each consume a processor continuously, trading power for dispatch latency;
+// suitable for latency critical serving on dedicated hardware. The default is "0" (disabled).
+static const char* const kOrtSessionOptionsConfigIntraOpHotStandbyThreads = "session.intra_op.hot_standby_threads";
+
+// Nice value each worker of the per-session thread pools applies to itself, as an integer.
+// Positive values lower the workers' scheduling priority relative to the application's own
+// threads, useful for background sessions that should yield to latency critical work. The
+// default is "0" (keep the inherited priority). Ignored on platforms without per-thread
+// scheduling priority.
+static const char* const kOrtSessionOptionsConfigWorkerNiceValue = "session.worker_nice_value";
+
+// If "1", the processors automatically selected for the per-session intra-op thread pool are
+// restricted to one logical processor per physical core, so pool threads don't contend with
+// their SMT (hyper-thread) siblings for core resources. The default is "0".
+static const char* const kOrtSessionOptionsConfigIntraOpAvoidSmtSiblings = "session.intra_op.avoid_smt_siblings";
+
+// Relative weight of this session for sharing the global intra-op thread pool, as a positive
+// integer. When several sessions created with global thread pools declare weights, each Run caps
+// the degree of parallelism of its loops at its proportional share of the pool, so a heavy
+// session cannot starve a light one. "0" (the default) leaves the session ungoverned. Only
+// meaningful when the environment was created with global thread pools.
+static const char* const kOrtSessionOptionsConfigGlobalPoolConcurrencyWeight = "session.global_pool_concurrency_weight";
+
 // Key for using model bytes directly for ORT format
 // If a session is created using an input byte array contains the ORT format model data,
 // By default we will copy the model bytes at the time of session creation to ensure the model bytes
@@ -69,6 +154,138 @@ static const char* const kOrtSessionOptionsConfigAllowIntraOpSpinning = "session
 // has to guarantee that the model bytes are valid until the ORT session using the model bytes is destroyed.
 static const char* const kOrtSessionOptionsConfigUseORTModelBytesDirectly = "session.use_ort_model_bytes_directly";
 
+// Deduplicate identical CPU-resident initializer tensors (by content) across all sessions in the
+// process that enable this option. "1": enable; "0": disable. The default is "0".
+// Sessions loading variants of the same base model then keep a single shared read-only copy of
+// each common weight instead of one per session. Shared buffers live for the remainder of the
+// process, like PrepackedWeightsContainer based sharing.
+static const char* const kOrtSessionOptionsConfigShareInitializersAcrossSessions = "session.share_initializers_across_sessions";
+
+// Memory-map CPU-resident initializers stored as external data instead of copying them into
+// allocated buffers. "1": enable; "0": disable. The default is "0".
+// The weight bytes then stay in the OS page cache and are paged in on first use, so session
+// creation does not read or duplicate them, and processes loading the same weights file share
+// the clean pages. Requires the external data file to outlive the session. Initializers that
+// are pre-packed or modified by an optimizer are materialized as usual and are unaffected.
+static const char* const kOrtSessionOptionsConfigUseMemoryMappedInitializers = "session.use_memory_mapped_initializers";
+
+// Let session creation return before the initializers have been materialized. "1": enable;
+// "0": disable. The default is "0".
+// Weight loading continues on a background thread and the executor blocks per node until the
+// initializers that node consumes are present, so nodes near the graph inputs can start running
+// while deeper layers' weights are still loading and time to first inference shrinks accordingly.
+// Only takes effect for sequential execution on models without subgraphs, when pre-packing is
+// disabled (kOrtSessionOptionsConfigDisablePrepacking = "1", since pre-packing needs every
+// constant initializer up front) and no initializer is also a graph output; otherwise the usual
+// synchronous initialization runs. Errors hit while loading surface on the first Run call that
+// reaches an affected initializer.
+static const char* const kOrtSessionOptionsConfigProgressiveInitializerLoading = "session.progressive_initializer_loading";
+
+// Enables server-side dynamic batching when set to a positive integer greater than 1.
+// Concurrent Run() calls with identical feed/fetch names are coalesced along dimension 0 (up to the
+// configured batch size) into a single execution, and the outputs are scattered back per request.
+// Only suitable for models where every input and output carries the batch on dimension 0.
+// The default is "0" (disabled).
+static const char* const kOrtSessionOptionsConfigDynamicBatchingMaxBatchSize = "session.dynamic_batching_max_batch_size";
+
+// How long (in microseconds) the first request of a forming batch waits for other requests to join
+// before executing when dynamic batching is enabled. The default is "1000" (1ms).
+static const char* const kOrtSessionOptionsConfigDynamicBatchingTimeoutMicroseconds = "session.dynamic_batching_timeout_microseconds";
+
+// Allow InferenceSession::Clone to be called on this session after it is initialized.
+// "1": enable; "0": disable. The default is "0".
+// An enabled session keeps the initializer tensors in its Graph instance after session state
+// finalization (normally they are freed) so that clones can build their own session state from the
+// shared, already optimized graph. Combine with
+// kOrtSessionOptionsConfigShareInitializersAcrossSessions to also share the initializer buffers
+// between the original session and its clones.
+static const char* const kOrtSessionOptionsConfigEnableSessionCloning = "session.enable_cloning";
+
+// Route kernel temp-space (scratch) allocations on CPU through a per-Run bump allocator that is
+// reclaimed in a single step when the Run completes. "1": enable; "0": disable. The default is "0".
+// Avoids transient kernel workspace allocations fragmenting the session allocator on long-running
+// services. Individual scratch allocations are not freed until the Run completes, so peak memory
+// during a Run can be somewhat higher than with the default allocator.
+static const char* const kOrtSessionOptionsConfigUsePerRunScratchArena = "session.use_per_run_scratch_arena";
+
+// Bucket input shapes when looking up cached memory patterns. The value is a positive integer
+// granularity; every dynamic dimension is rounded up to the next multiple of it for the cache key,
+// so e.g. with "64" all sequence lengths from 1 to 64 share one cached pattern. Smaller shapes in a
+// bucket are placed in the (padded) blocks of the bucket's pattern, turning the per-tensor
+// allocations of a run into one block allocation even when exact shapes rarely repeat.
+// Trades some extra memory (padding up to the bucket ceiling) for allocation-free steady state.
+// The default is "0" (patterns are keyed on exact shapes). Only effective when memory pattern
+// optimization is enabled.
+static const char* const kOrtSessionOptionsConfigMemoryPatternBucketGranularity = "session.memory_pattern_bucket_granularity";
+
+// Compact the session's memory arenas automatically after every N completed Run() calls.
+// A compaction pass returns every arena region that holds no live allocation to the system,
+// including the initial region, so long-running processes with mixed-shape traffic do not
+// accumulate fragmented arena memory indefinitely.
+// Expects a non-negative integer; "0" (the default) disables automatic compaction.
+// An explicit pass can also be run at any time (e.g. from a maintenance thread between
+// requests) by calling Compact() on an arena based allocator obtained from the session.
+static const char* const kOrtSessionOptionsConfigArenaCompactionIntervalRuns = "session.arena_compaction_interval_runs";
+
+// Maximum number of independent, fence free CPU nodes the sequential executor may dispatch
+// concurrently. The dispatched kernels cooperatively share the session's intra-op thread pool
+// through its work stealing scheduler, so a kernel that cannot occupy every thread leaves the
+// remaining threads to its neighbours; useful when individual nodes are too small to saturate
+// the machine. "1" (the default) preserves strictly sequential execution. Only effective with
+// the sequential execution mode, and ignored while memory pattern optimization is enabled,
+// since planned memory patterns assume strictly sequential value lifetimes.
+static const char* const kOrtSessionOptionsConfigMaxInterNodeParallelism = "session.max_inter_node_parallelism";
+
+// Restrict the session to a subset of the model's declared outputs. The value is a ";"-delimited
+// list of output names, e.g. "score;embedding". At initialization every node that does not
+// contribute to one of the listed outputs is pruned from the graph before optimization and
+// partitioning, so a deployment that consumes only some heads of a multi-task model neither plans
+// nor executes the remaining ones. The listed names become the session's only fetchable outputs.
+// The default is "" (keep all declared outputs). Not supported for ORT format models.
+static const char* const kOrtSessionOptionsConfigActiveGraphOutputs = "session.active_graph_outputs";
+
+// Number of initial Run() calls over which to record per-tensor min/max of float activations.
+// "0" (default) disables tracking. When the configured number of runs completes, the collected
+// ranges are written to the file given by kOrtSessionOptionsConfigActivationRangeTrackingFile,
+// after which recording stops. The range file substitutes for an offline calibration step when
+// statically quantizing the model from production traffic.
+static const char* const kOrtSessionOptionsConfigActivationRangeTrackingRuns =
+    "session.activation_range_tracking_runs";
+
+// Path of the JSON file the collected activation ranges are written to.
+// The default is "activation_ranges.json" in the working directory.
+static const char* const kOrtSessionOptionsConfigActivationRangeTrackingFile =
+    "session.activation_range_tracking_file";
+
+// "1": collect aggregated per-op-type execution statistics (invocation count, total time, bytes
+// moved) in per-node counters updated with relaxed atomics, cheap enough to stay enabled in
+// production. "0" (default): disabled. The aggregated statistics can be fetched at any time,
+// including while other threads are running inference, via SessionGetOpTypeStats.
+static const char* const kOrtSessionOptionsConfigCollectOpStats = "session.collect_op_stats";
+
+// "1": while profiling is enabled, sample hardware performance counters (CPU cycles, retired
+// instructions, last-level cache misses) around each kernel invocation and record them as a
+// "<node>_kernel_hw_counters" event next to the kernel time event, to separate bandwidth-bound
+// from compute-bound nodes. Requires Linux perf_event support and sufficient privileges (see
+// /proc/sys/kernel/perf_event_paranoid); silently skipped when counters cannot be opened. The
+// counters follow the executor thread, so work a kernel fans out over the intra-op thread pool
+// is not attributed. "0" (default): disabled.
+static const char* const kOrtSessionOptionsConfigProfilePerfCounters = "session.profile_perf_counters";
+
+// Path of a replay capture file. When set, sampled Run calls serialize their feeds, run options
+// and the global random seed to this file so the exact request can be re-executed offline with
+// the profiler attached (see the perf test tool's -R option). Each capture overwrites the file,
+// so disk usage stays bounded to the most recent sampled request. Only primitive-typed tensor
+// feeds can be captured; a failed capture is logged and never fails the Run call.
+// The default is "" (capture disabled).
+static const char* const kOrtSessionOptionsConfigReplayCaptureFile = "session.replay_capture_file";
+
+// Capture every Nth Run call when kOrtSessionOptionsConfigReplayCaptureFile is set, counting from
+// the first. Larger intervals reduce the capture overhead on hot paths by sampling requests.
+// The value must be a positive integer. The default is "1" (capture every run).
+static const char* const kOrtSessionOptionsConfigReplayCaptureIntervalRuns =
+    "session.replay_capture_interval_runs";
+
 // NNAPI EP keys begin
 // Note: These options should be specified prior to appending the NNAPI EP to the session options object in order for
 // them to take effect.
@@ -236,6 +236,26 @@ public class OrtSession implements AutoCloseable {
     return run(inputs, requestedOutputs, null);
   }
 
+  /**
+   * Scores an input feed dict, writing each output into the caller-provided tensor pinned for it.
+   *
+   * <p>Pinned output tensors are typically created over direct ByteBuffers via {@link
+   * OnnxTensor#createTensor(OrtEnvironment,java.nio.ByteBuffer,long[])} so the results land in the
+   * caller's buffer without a copy. The pinned tensors remain owned by the caller and are not
+   * closed when the returned {@link Result} is closed.
+   *
+   * @param inputs The inputs to score.
+   * @param pinnedOutputs The requested outputs, each backed by a caller-provided tensor of the
+   *     right type and shape.
+   * @return The inferred outputs.
+   * @throws OrtException If there was an error in native code, the input or output names are
+   *     invalid, or if there are zero or too many inputs or outputs.
+   */
+  public Result run(Map<String, OnnxTensor> inputs, Map<String, OnnxTensor> pinnedOutputs)
+      throws OrtException {
+    return run(inputs, pinnedOutputs.keySet(), pinnedOutputs, null);
+  }
+
   /**
    * Scores an input feed dict, returning the map of requested inferred outputs.
    *
@@ -251,6 +271,31 @@ public class OrtSession implements AutoCloseable {
   public Result run(
       Map<String, OnnxTensor> inputs, Set<String> requestedOutputs, RunOptions runOptions)
       throws OrtException {
+    return run(inputs, requestedOutputs, Collections.emptyMap(), runOptions);
+  }
+
+  /**
+   * Scores an input feed dict, returning the map of requested inferred outputs. Outputs which have
+   * a tensor pinned for them in pinnedOutputs are written directly into that tensor's buffer
+   * instead of a freshly allocated one.
+   *
+   * <p>The outputs are sorted based on the supplied set traversal order. Pinned tensors remain
+   * owned by the caller and are not closed when the returned {@link Result} is closed.
+   *
+   * @param inputs The inputs to score.
+   * @param requestedOutputs The requested outputs, must contain all pinned output names.
+   * @param pinnedOutputs Caller-provided tensors to receive the named outputs, may be empty.
+   * @param runOptions The RunOptions to control this run.
+   * @return The inferred outputs.
+   * @throws OrtException If there was an error in native code, the input or output names are
+   *     invalid, or if there are zero or too many inputs or outputs.
+   */
+  public Result run(
+      Map<String, OnnxTensor> inputs,
+      Set<String> requestedOutputs,
+      Map<String, OnnxTensor> pinnedOutputs,
+      RunOptions runOptions)
+      throws OrtException {
     if (!closed) {
       if (inputs.isEmpty() || (inputs.size() > numInputs)) {
         throw new OrtException(
@@ -287,6 +332,22 @@ public class OrtSession implements AutoCloseable {
               "Unknown output name " + s + ", expected one of " + outputNames.toString());
         }
       }
+      for (String s : pinnedOutputs.keySet()) {
+        if (!requestedOutputs.contains(s)) {
+          throw new OrtException(
+              "Pinned output name " + s + " not found in the requested outputs");
+        }
+      }
+      long[] outputHandles = new long[outputNamesArray.length];
+      boolean[] ownedByResult = new boolean[outputNamesArray.length];
+      for (int j = 0; j < outputNamesArray.length; j++) {
+        OnnxTensor pinned = pinnedOutputs.get(outputNamesArray[j]);
+        if (pinned != null) {
+          outputHandles[j] = pinned.getNativeHandle();
+        } else {
+          ownedByResult[j] = true;
+        }
+      }
       long runOptionsHandle = runOptions == null ? 0 : runOptions.nativeHandle;
 
       OnnxValue[] outputValues =
@@ -298,9 +359,16 @@ public class OrtSession implements AutoCloseable {
               inputHandles,
               inputNamesArray.length,
               outputNamesArray,
+              outputHandles,
               outputNamesArray.length,
               runOptionsHandle);
-      return new Result(outputNamesArray, outputValues);
+      // Pinned outputs are written in place, the native call leaves their slots null.
+      for (int j = 0; j < outputValues.length; j++) {
+        if (outputValues[j] == null) {
+          outputValues[j] = pinnedOutputs.get(outputNamesArray[j]);
+        }
+      }
+      return new Result(outputNamesArray, outputValues, ownedByResult);
     } else {
       throw new IllegalStateException("Trying to score a closed OrtSession.");
     }
@@ -411,6 +479,9 @@ public class OrtSession implements AutoCloseable {
    * @param inputs The input tensors.
    * @param numInputs The number of inputs.
    * @param outputNamesArray The requested output names.
+   * @param outputHandles The pointers to caller-provided output tensors, zero when the output
+   *     should be allocated by the runtime. Pinned outputs are written in place and their slots in
+   *     the returned array are left null.
    * @param numOutputs The number of requested outputs.
    * @param runOptionsHandle The (possibly null) pointer to the run options.
    * @return The OnnxValues produced by this run.
@@ -424,6 +495,7 @@ public class OrtSession implements AutoCloseable {
       long[] inputs,
       long numInputs,
       String[] outputNamesArray,
+      long[] outputHandles,
       long numOutputs,
       long runOptionsHandle)
       throws OrtException;
@@ -1182,6 +1254,8 @@ public class OrtSession implements AutoCloseable {
 
     private final List<OnnxValue> list;
 
+    private final boolean[] ownedByResult;
+
     private boolean closed;
 
     /**
@@ -1191,6 +1265,18 @@ public class OrtSession implements AutoCloseable {
      * @param values The output values.
      */
     Result(String[] names, OnnxValue[] values) {
+      this(names, values, null);
+    }
+
+    /**
+     * Creates a Result from the names and values produced by {@link OrtSession#run(Map)}.
+     *
+     * @param names The output names.
+     * @param values The output values.
+     * @param ownedByResult For each value, true when closing the Result should close it. Values
+     *     pinned by the caller stay owned by the caller. Null means all values are owned.
+     */
+    Result(String[] names, OnnxValue[] values, boolean[] ownedByResult) {
       map = new LinkedHashMap<>();
       list = new ArrayList<>();
 
@@ -1206,6 +1292,7 @@ public class OrtSession implements AutoCloseable {
         map.put(names[i], values[i]);
         list.add(values[i]);
       }
+      this.ownedByResult = ownedByResult;
       this.closed = false;
     }
 
@@ -1213,8 +1300,12 @@ public class OrtSession implements AutoCloseable {
     public void close() {
       if (!closed) {
         closed = true;
-        for (OnnxValue t : map.values()) {
-          t.close();
+        int i = 0;
+        for (OnnxValue t : list) {
+          if (ownedByResult == null || ownedByResult[i]) {
+            t.close();
+          }
+          i++;
         }
       } else {
         logger.warning("Closing an already closed Result");
@@ -239,11 +239,11 @@ JNIEXPORT jobjectArray JNICALL Java_ai_onnxruntime_OrtSession_getOutputInfo
 /*
  * Class:     ai_onnxruntime_OrtSession
  * Method:    run
- * Signature: (JJJ[Ljava/lang/String;[JJ[Ljava/lang/String;JJ)[Lai/onnxruntime/OnnxValue;
- * private native OnnxValue[] run(long apiHandle, long nativeHandle, long allocatorHandle, String[] inputNamesArray, long[] inputs, long numInputs, String[] outputNamesArray, long numOutputs)
+ * Signature: (JJJ[Ljava/lang/String;[JJ[Ljava/lang/String;[JJJ)[Lai/onnxruntime/OnnxValue;
+ * private native OnnxValue[] run(long apiHandle, long nativeHandle, long allocatorHandle, String[] inputNamesArray, long[] inputs, long numInputs, String[] outputNamesArray, long[] outputHandles, long numOutputs)
  */
 JNIEXPORT jobjectArray JNICALL Java_ai_onnxruntime_OrtSession_run
-  (JNIEnv * jniEnv, jobject jobj, jlong apiHandle, jlong sessionHandle, jlong allocatorHandle, jobjectArray inputNamesArr, jlongArray tensorArr, jlong numInputs, jobjectArray outputNamesArr, jlong numOutputs, jlong runOptionsHandle) {
+  (JNIEnv * jniEnv, jobject jobj, jlong apiHandle, jlong sessionHandle, jlong allocatorHandle, jobjectArray inputNamesArr, jlongArray tensorArr, jlong numInputs, jobjectArray outputNamesArr, jlongArray outputHandlesArr, jlong numOutputs, jlong runOptionsHandle) {
     (void) jobj; // Required JNI parameter not needed by functions which don't need to access their host object.
     const OrtApi* api = (const OrtApi*) apiHandle;
     OrtAllocator* allocator = (OrtAllocator*) allocatorHandle;
@@ -273,13 +273,17 @@ JNIEXPORT jobjectArray JNICALL Java_ai_onnxruntime_OrtSession_run
         inputValues[i] = (OrtValue*)inputTensors[i];
     }
 
+    // Extract a C array of longs which are pointers to caller-provided (pinned) output tensors.
+    // A zero entry means the runtime allocates that output.
+    jlong* pinnedOutputTensors = (*jniEnv)->GetLongArrayElements(jniEnv,outputHandlesArr,NULL);
+
     // Extract the names of the output values, and allocate their output array.
     OrtValue** outputValues;
     checkOrtStatus(jniEnv,api,api->AllocatorAlloc(allocator,sizeof(OrtValue*)*numOutputs,(void**)&outputValues));
     for (int i = 0; i < numOutputs; i++) {
         javaOutputStrings[i] = (*jniEnv)->GetObjectArrayElement(jniEnv,outputNamesArr,i);
         outputNames[i] = (*jniEnv)->GetStringUTFChars(jniEnv,javaOutputStrings[i],NULL);
-        outputValues[i] = NULL;
+        outputValues[i] = (OrtValue*) pinnedOutputTensors[i];
     }
 
     // Actually score the inputs.
@@ -295,13 +299,16 @@ JNIEXPORT jobjectArray JNICALL Java_ai_onnxruntime_OrtSession_run
     jobjectArray outputArray = (*jniEnv)->NewObjectArray(jniEnv,safecast_int64_to_jsize(numOutputs), onnxValueClass, NULL);
 
     // Convert the output tensors into ONNXValues and release the output strings.
+    // Pinned outputs were written in place - their Java objects already exist, so their
+    // array slots are left null for the caller to fill.
     for (int i = 0; i < numOutputs; i++) {
-        if (outputValues[i] != NULL) {
+        if ((outputValues[i] != NULL) && (pinnedOutputTensors[i] == 0)) {
             jobject onnxValue = convertOrtValueToONNXValue(jniEnv,api,allocator,outputValues[i]);
             (*jniEnv)->SetObjectArrayElement(jniEnv,outputArray,i,onnxValue);
         }
         (*jniEnv)->ReleaseStringUTFChars(jniEnv,javaOutputStrings[i],outputNames[i]);
     }
+    (*jniEnv)->ReleaseLongArrayElements(jniEnv,outputHandlesArr,pinnedOutputTensors,JNI_ABORT);
     checkOrtStatus(jniEnv,api,api->AllocatorFree(allocator,outputValues));
 
     // Release the Java input strings
@@ -33,6 +33,7 @@ import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.ArrayList;
 import java.util.Arrays;
+import java.util.Collections;
 import java.util.EnumSet;
 import java.util.HashMap;
 import java.util.HashSet;
@@ -207,6 +208,55 @@ public class InferenceTest {
     }
   }
 
+  @Test
+  public void pinnedOutputsTest() throws OrtException {
+    String modelPath = getResourcePath("/partial-inputs-test-2.onnx").toString();
+    try (OrtEnvironment env =
+            OrtEnvironment.getEnvironment(OrtLoggingLevel.ORT_LOGGING_LEVEL_FATAL, "pinnedOutputs");
+        OrtSession.SessionOptions options = new SessionOptions();
+        OrtSession session = env.createSession(modelPath, options)) {
+      Map<String, OnnxTensor> inputMap = new HashMap<>();
+      OnnxTensor a = OnnxTensor.createTensor(env, new float[] {2.0f});
+      OnnxTensor b = OnnxTensor.createTensor(env, new float[] {3.0f});
+      inputMap.put("a:0", a);
+      inputMap.put("b:0", b);
+
+      // Pin the output into a caller-provided direct buffer.
+      ByteBuffer outputBuffer = ByteBuffer.allocateDirect(4).order(ByteOrder.nativeOrder());
+      OnnxTensor pinned =
+          OnnxTensor.createTensor(env, outputBuffer, new long[] {1}, OnnxJavaType.FLOAT);
+      Map<String, OnnxTensor> pinnedOutputs = new HashMap<>();
+      pinnedOutputs.put("ab:0", pinned);
+
+      try (Result r = session.run(inputMap, pinnedOutputs)) {
+        assertEquals(1, r.size());
+        Assertions.assertSame(pinned, r.get("ab:0").get());
+        // The result landed directly in the caller's buffer.
+        assertEquals(6.0f, outputBuffer.asFloatBuffer().get(0), 1e-10);
+      }
+
+      // Closing the Result must not close the pinned tensor.
+      assertEquals(6.0f, ((float[]) pinned.getValue())[0], 1e-10);
+
+      // Pinning an output which wasn't requested throws.
+      try {
+        session.run(inputMap, Collections.singleton("ab:0"), pinnedOutputs, null).close();
+      } catch (OrtException e) {
+        fail("Pinned output was requested, should not throw");
+      }
+      try (Result r =
+          session.run(inputMap, Collections.singleton("missing"), pinnedOutputs, null)) {
+        fail("Expected to throw OrtException due to an unknown requested output");
+      } catch (OrtException e) {
+        // pass
+      }
+
+      pinned.close();
+      a.close();
+      b.close();
+    }
+  }
+
   @Test
   public void partialInputsTest() throws OrtException {
     String modelPath = getResourcePath("/partial-inputs-test.onnx").toString();
@@ -16,6 +16,15 @@ export declare namespace Session {
   export interface Config {
     backendHint?: string;
     profiler?: Profiler.Config;
+
+    /**
+     * shapes to use for pre-warming the session after the model is loaded, keyed by model input name.
+     *
+     * When specified, the session runs the model once with zero-filled tensors of these shapes so that all kernel
+     * programs are compiled and cached before the first real inference. Free dimensions must be given concrete values
+     * that match the shapes used for inference.
+     */
+    warmupShapes?: {[inputName: string]: readonly number[]};
   }
 
   export interface Context {
@@ -29,6 +38,7 @@ export class Session {
   constructor(config: Session.Config = {}) {
     this._initialized = false;
     this.backendHint = config.backendHint;
+    this.warmupShapes = config.warmupShapes;
     this.profiler = Profiler.create(config.profiler);
     this.context = {profiler: this.profiler, graphInputTypes: [], graphInputDims: []};
   }
@@ -79,6 +89,39 @@ export class Session {
         this.initialize(arg);
       }
     });
+
+    if (this.warmupShapes) {
+      await this.warmup(this.warmupShapes);
+    }
+  }
+
+  /**
+   * run the model once with zero-filled inputs so that all kernel programs are compiled and cached ahead of the
+   * first real inference.
+   *
+   * Free dimensions default to 1 when no shape is supplied for an input. Since the framework assumes static input
+   * shapes across runs, any supplied shapes must match the shapes used for inference.
+   */
+  async warmup(inputShapes?: {[inputName: string]: readonly number[]}): Promise<void> {
+    if (!this._initialized) {
+      throw new Error('session not initialized yet');
+    }
+
+    await this.profiler.event('session', 'Session.warmup', async () => {
+      const modelInputNames = this._model.graph.getInputNames();
+      const modelInputIndices = this._model.graph.getInputIndices();
+      const modelValues = this._model.graph.getValues();
+
+      const inputs = new Map<string, Tensor>();
+      for (let i = 0; i < modelInputIndices.length; ++i) {
+        const graphInput = modelValues[modelInputIndices[i]];
+        const givenDims = inputShapes ? inputShapes[modelInputNames[i]] : undefined;
+        const dims = givenDims ?? graphInput.type!.shape.dims.map(d => (d === 0 ? 1 : d));
+        inputs.set(modelInputNames[i], new Tensor(dims, graphInput.type!.tensorType));
+      }
+
+      await this.run(inputs);
+    });
   }
 
   private initialize(modelProtoBlob: Uint8Array, isOrtFormat?: boolean): void {
@@ -251,6 +294,7 @@ export class Session {
   private _executionPlan: ExecutionPlan;
 
   private backendHint?: string;
+  private warmupShapes?: {[inputName: string]: readonly number[]};
 
   private sessionHandler: SessionHandlerType;
   private context: Session.Context;
@@ -42,6 +42,51 @@ class AttentionCPUBase : public AttentionBase {
     // Total sequence length including that of past state: S* = S' + S
     const int all_sequence_length = past_sequence_length + sequence_length;
 
+    bool has_unidirectional = (is_unidirectional_ && sequence_length > 1);
+
+    const int32_t* mask_index_data = mask_index != nullptr ? mask_index->template Data<int32_t>() : nullptr;
+    const std::vector<int64_t>* mask_index_dims = mask_index != nullptr ? &(mask_index->Shape().GetDims()) : nullptr;
+    const T* past_data = past != nullptr ? past->template Data<T>() : nullptr;
+    T* present_data = present != nullptr ? present->template MutableData<T>() : nullptr;
+
+    const T* extra_add_qk_data = nullptr;
+    if (extra_add_qk != nullptr) {
+      extra_add_qk_data = extra_add_qk->template Data<T>();
+    }
+
+    // For long sequences without past state, use the tiled attention path,
+    // which streams K/V blocks and carries running softmax statistics
+    // instead of materializing the S x S* score matrix.
+    if constexpr (std::is_same_v<T, float>) {
+      if (past == nullptr && present == nullptr &&
+          all_sequence_length >= kTiledAttentionMinSequenceLength &&
+          (mask_index_dims == nullptr || mask_index_dims->size() < 4)) {
+        ComputeTiledAttention(output->template MutableData<float>(), Q, K, V,
+                              mask_index_data, mask_index_dims, has_unidirectional,
+                              batch_size, sequence_length,
+                              qk_head_size == 0 ? v_head_size : qk_head_size,
+                              v_head_size, v_hidden_size, extra_add_qk_data, tp);
+        return Status::OK();
+      }
+    }
+
+    // Decode fast path: a single query token attending over the cached past.
+    // Appends the new K/V rows to the present state and computes the
+    // attention for the one query row directly, skipping the intermediate
+    // mask, attention_probs and out_tmp buffers of the general path.
+    if constexpr (std::is_same_v<T, float>) {
+      if (sequence_length == 1 && past != nullptr && present != nullptr &&
+          (qk_head_size == 0 || qk_head_size == v_head_size) &&
+          (mask_index_dims == nullptr || mask_index_dims->size() < 4)) {
+        ComputeSingleQueryAttention(output->template MutableData<float>(), Q, K, V,
+                                    mask_index_data, mask_index_dims,
+                                    past_data, present_data,
+                                    batch_size, past_sequence_length,
+                                    v_head_size, v_hidden_size, extra_add_qk_data, tp);
+        return Status::OK();
+      }
+    }
+
     // Compute the attention score. It does 2 things:
     //         I. attention_probs(B, N, S, S*) = 1/sqrt(H) x Q(B, N, S, H) x K'(B, N, S*, H -> B, N, H, S*) +
     //                                           1 x mask_data(B, N, S, S*)
@@ -50,8 +95,6 @@ class AttentionCPUBase : public AttentionBase {
     auto attention_probs = allocator->Alloc(attention_probs_bytes);
     BufferUniquePtr scratch_buffer(attention_probs, BufferDeleter(allocator));
 
-    bool has_unidirectional = (is_unidirectional_ && sequence_length > 1);
-
     void* mask_data = nullptr;
     if (mask_index != nullptr || has_unidirectional) {
       size_t mask_data_bytes = SafeInt<size_t>(batch_size) * sequence_length * all_sequence_length * sizeof(T);
@@ -60,16 +103,6 @@ class AttentionCPUBase : public AttentionBase {
     }
     BufferUniquePtr mask_data_buffer(mask_data, BufferDeleter(allocator));
 
-    const int32_t* mask_index_data = mask_index != nullptr ? mask_index->template Data<int32_t>() : nullptr;
-    const std::vector<int64_t>* mask_index_dims = mask_index != nullptr ? &(mask_index->Shape().GetDims()) : nullptr;
-    const T* past_data = past != nullptr ? past->template Data<T>() : nullptr;
-    T* present_data = present != nullptr ? present->template MutableData<T>() : nullptr;
-
-    const T* extra_add_qk_data = nullptr;
-    if (extra_add_qk != nullptr) {
-      extra_add_qk_data = extra_add_qk->template Data<T>();
-    }
-
     ComputeAttentionProbs<T>(static_cast<T*>(attention_probs), Q, K,
                              mask_index_data, mask_index_dims, static_cast<T*>(mask_data), has_unidirectional,
                              batch_size, sequence_length, past_sequence_length, qk_head_size == 0 ? v_head_size : qk_head_size,
@@ -88,6 +121,295 @@ class AttentionCPUBase : public AttentionBase {
   }
 
  private:
+  // Sequence length at which the S x S* score matrix stops fitting in cache
+  // and the tiled attention path starts to pay off.
+  static constexpr int kTiledAttentionMinSequenceLength = 512;
+
+  // Block sizes for the tiled attention path. The query block bounds the
+  // output accumulator held per tile and the key block bounds the score tile,
+  // so a (kQueryBlockSize x kKeyBlockSize) score tile plus one key block stay
+  // cache resident while K/V are streamed exactly once.
+  static constexpr int kQueryBlockSize = 32;
+  static constexpr int kKeyBlockSize = 256;
+
+  // Tiled attention for long sequences without past state. Instead of
+  // materializing attention_probs(B, N, S, S*), each (batch, head, query
+  // block) work item streams K and V in blocks of kKeyBlockSize rows,
+  // carrying the running row maximum and normalizer of the softmax and
+  // rescaling the partial output accumulator when the maximum grows. The
+  // mask and extra-add terms are applied to each score tile in flight, with
+  // values matching what PrepareMask and the unidirectional fixup would have
+  // produced, so the result only differs from the reference path by
+  // floating point summation order.
+  void ComputeTiledAttention(float* output,                                // output with size BxSxNxH_v
+                             const float* Q,                               // Q data with size BxNxSxH
+                             const float* K,                               // K data with size BxNxSxH
+                             const float* V,                               // V data with size BxNxSxH_v
+                             const int32_t* mask_index,                    // mask index. nullptr if no mask
+                             const std::vector<int64_t>* mask_index_dims,  // mask index shape
+                             bool has_unidirectional,                      // has unidirectional mask
+                             int batch_size,                               // batch size
+                             int sequence_length,                          // sequence length (no past state, so S* == S)
+                             int head_size,                                // qk head size
+                             int v_head_size,                              // v head size
+                             int v_hidden_size,                            // v hidden size
+                             ThreadPool* tp                                // thread pool
+  ) const {
+    const float alpha = 1.0f / sqrt(static_cast<float>(head_size));
+
+    const bool is_3d_mask = (nullptr != mask_index_dims && mask_index_dims->size() == 3);
+    const bool is_raw_attention_mask = (nullptr != mask_index_dims && mask_index_dims->size() == 2);
+    const bool has_mask_start_position = (nullptr != mask_index_dims && mask_index_dims->size() == 1 &&
+                                          static_cast<int>(mask_index_dims->at(0)) == 2 * batch_size);
+    const bool has_row_invariant_mask = (nullptr != mask_index && !is_3d_mask);
+
+    const size_t q_chunk_length = static_cast<size_t>(sequence_length) * head_size;    // S x H
+    const size_t v_chunk_length = static_cast<size_t>(sequence_length) * v_head_size;  // S x H_v
+
+    const int query_block_count = (sequence_length + kQueryBlockSize - 1) / kQueryBlockSize;
+    const std::ptrdiff_t loop_len = static_cast<std::ptrdiff_t>(batch_size) * num_heads_ * query_block_count;
+
+    // The cost of the two GEMMs for one query block.
+    const double cost = static_cast<double>(kQueryBlockSize) * sequence_length * (head_size + v_head_size);
+
+    ThreadPool::TryParallelFor(tp, loop_len, cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+      // Per-partition scratch: score tile, output accumulator, softmax
+      // statistics and the per-batch row-invariant additive mask.
+      std::vector<float> scratch(static_cast<size_t>(kQueryBlockSize) * kKeyBlockSize +
+                                 static_cast<size_t>(kQueryBlockSize) * v_head_size +
+                                 static_cast<size_t>(kQueryBlockSize) * 2 +
+                                 (has_row_invariant_mask ? static_cast<size_t>(sequence_length) : 0));
+      float* scores = scratch.data();
+      float* out_acc = scores + static_cast<size_t>(kQueryBlockSize) * kKeyBlockSize;
+      float* row_max = out_acc + static_cast<size_t>(kQueryBlockSize) * v_head_size;
+      float* row_sum = row_max + kQueryBlockSize;
+      float* batch_mask = row_sum + kQueryBlockSize;
+
+      int cached_mask_batch = -1;
+
+      for (std::ptrdiff_t i = begin; i != end; ++i) {
+        const int bn = static_cast<int>(i) / query_block_count;
+        const int query_block = static_cast<int>(i) % query_block_count;
+        const int batch_index = bn / num_heads_;
+        const int head_index = bn % num_heads_;
+
+        const int q_start = query_block * kQueryBlockSize;
+        const int q_count = std::min(kQueryBlockSize, sequence_length - q_start);
+
+        const float* q = Q + q_chunk_length * bn + static_cast<size_t>(q_start) * head_size;
+        const float* k = K + q_chunk_length * bn;
+        const float* v = V + v_chunk_length * bn;
+
+        // Build the additive mask shared by all rows of this batch, matching
+        // the values PrepareMask produces for the 1D and 2D mask layouts.
+        if (has_row_invariant_mask && batch_index != cached_mask_batch) {
+          if (is_raw_attention_mask) {
+            const int32_t* raw_mask = mask_index + static_cast<size_t>(batch_index) * sequence_length;
+            for (int m_i = 0; m_i < sequence_length; m_i++) {
+              batch_mask[m_i] = (raw_mask[m_i] > 0) ? 0.0f : -10000.0f;
+            }
+          } else {
+            const int end_position = mask_index[batch_index];
+            const int start_position =
+                has_mask_start_position ? std::min(mask_index[batch_index + batch_size], sequence_length) : 0;
+            for (int m_i = 0; m_i < sequence_length; m_i++) {
+              batch_mask[m_i] = (m_i < start_position || m_i >= end_position) ? -10000.0f : 0.0f;
+            }
+          }
+          cached_mask_batch = batch_index;
+        }
+
+        std::fill_n(out_acc, static_cast<size_t>(q_count) * v_head_size, 0.0f);
+        std::fill_n(row_max, q_count, -std::numeric_limits<float>::infinity());
+        std::fill_n(row_sum, q_count, 0.0f);
+
+        for (int key_start = 0; key_start < sequence_length; key_start += kKeyBlockSize) {
+          const int key_count = std::min(kKeyBlockSize, sequence_length - key_start);
+
+          // scores(q_count, key_count) = 1/sqrt(H) x Q block x K block'
+          math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasTrans, q_count, key_count, head_size, alpha,
+                                          q, head_size,
+                                          k + static_cast<size_t>(key_start) * head_size, head_size,
+                                          0.0f, scores, kKeyBlockSize, nullptr);
+
+          for (int r = 0; r < q_count; r++) {
+            float* score_row = scores + static_cast<size_t>(r) * kKeyBlockSize;
+            const int s_i = q_start + r;
+
+            // Apply the mask and the extra add data the same way the
+            // reference path does: masked-off causal positions take the mask
+            // value instead of the dot product.
+            for (int c = 0; c < key_count; c++) {
+              const int m_i = key_start + c;
+
+              float mask_value = 0.0f;
+              if (has_row_invariant_mask) {
+                mask_value = batch_mask[m_i];
+              } else if (is_3d_mask) {
+                mask_value = (mask_index[(static_cast<size_t>(batch_index) * sequence_length + s_i) * sequence_length + m_i] > 0)
+                                 ? 0.0f
+                                 : -10000.0f;
+              }
+
+              if (has_unidirectional && m_i > s_i) {
+                score_row[c] = mask_value - 10000.0f;
+              } else {
+                score_row[c] += mask_value;
+              }
+
+              if (nullptr != extra_add_qk_data) {
+                score_row[c] += extra_add_qk_data[(static_cast<size_t>(bn) * sequence_length + s_i) * sequence_length + m_i];
+              }
+            }
+
+            // Fold this tile into the running softmax statistics.
+            float block_max = row_max[r];
+            for (int c = 0; c < key_count; c++) {
+              block_max = std::max(block_max, score_row[c]);
+            }
+
+            const float rescale = expf(row_max[r] - block_max);
+            row_max[r] = block_max;
+
+            float block_sum = 0.0f;
+            for (int c = 0; c < key_count; c++) {
+              score_row[c] = expf(score_row[c] - block_max);
+              block_sum += score_row[c];
+            }
+            row_sum[r] = row_sum[r] * rescale + block_sum;
+
+            if (rescale != 1.0f) {
+              float* acc_row = out_acc + static_cast<size_t>(r) * v_head_size;
+              for (int h = 0; h < v_head_size; h++) {
+                acc_row[h] *= rescale;
+              }
+            }
+          }
+
+          // out_acc(q_count, H_v) += scores x V block
+          math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasNoTrans, q_count, v_head_size, key_count, 1.0f,
+                                          scores, kKeyBlockSize,
+                                          v + static_cast<size_t>(key_start) * v_head_size, v_head_size,
+                                          1.0f, out_acc, v_head_size, nullptr);
+        }
+
+        // Normalize and write to the transposed output: out(B, S, N, H_v).
+        for (int r = 0; r < q_count; r++) {
+          const float inv_sum = 1.0f / row_sum[r];
+          const float* acc_row = out_acc + static_cast<size_t>(r) * v_head_size;
+          float* dest = output +
+                        (static_cast<size_t>(batch_index) * sequence_length + q_start + r) * v_hidden_size +
+                        static_cast<size_t>(head_index) * v_head_size;
+          for (int h = 0; h < v_head_size; h++) {
+            dest[h] = acc_row[h] * inv_sum;
+          }
+        }
+      }
+    });
+  }
+
+  // Decode attention for a single query token (S == 1) with past state.
+  // Each (batch, head) work item appends its new K/V rows to the present
+  // state, computes the one score row against the cached keys, applies the
+  // mask, runs softmax on the row and accumulates the weighted values
+  // straight into the output. Since S == 1 there is no unidirectional fixup
+  // and no (B, S, N, H) transpose, and the S x S* buffers of the general
+  // path reduce to a single row of scratch per thread.
+  void ComputeSingleQueryAttention(float* output,                                // output with size Bx1xNxH
+                                   const float* Q,                               // Q data with size BxNx1xH
+                                   const float* K,                               // K data with size BxNx1xH
+                                   const float* V,                               // V data with size BxNx1xH
+                                   const int32_t* mask_index,                    // mask index. nullptr if no mask
+                                   const std::vector<int64_t>* mask_index_dims,  // mask index shape
+                                   const float* past,                            // past state with size 2xBxNxS'xH
+                                   float* present,                               // present state with size 2xBxNxS*xH
+                                   int batch_size,                               // batch size
+                                   int past_sequence_length,                     // sequence length of past state
+                                   int head_size,                                // head size
+                                   int hidden_size,                              // hidden size
+                                   const float* extra_add_qk_data,               // extra add matrix with shape BxNx1xS*
+                                   ThreadPool* tp                                // thread pool
+  ) const {
+    const int all_sequence_length = past_sequence_length + 1;                               // S* = S' + 1
+    const size_t past_chunk_length = static_cast<size_t>(past_sequence_length) * head_size;  // S' x H
+    const size_t present_chunk_length = past_chunk_length + head_size;                       // S* x H
+
+    const float alpha = 1.0f / sqrt(static_cast<float>(head_size));
+
+    const bool is_raw_attention_mask = (nullptr != mask_index_dims && mask_index_dims->size() >= 2);
+    const bool has_mask_start_position = (nullptr != mask_index_dims && mask_index_dims->size() == 1 &&
+                                          static_cast<int>(mask_index_dims->at(0)) == 2 * batch_size);
+
+    // Offsets from the key section to the value section of past and present.
+    const size_t past_v_offset = static_cast<size_t>(batch_size) * num_heads_ * past_chunk_length;
+    const size_t present_v_offset = static_cast<size_t>(batch_size) * num_heads_ * present_chunk_length;
+
+    // The cost of the two matrix-vector products plus the state append.
+    const double cost = static_cast<double>(all_sequence_length) * head_size * 3.0;
+
+    ThreadPool::TryParallelFor(tp, batch_size * num_heads_, cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+      std::vector<float> scores(all_sequence_length);
+
+      for (std::ptrdiff_t i = begin; i != end; ++i) {
+        const int batch_index = static_cast<int>(i) / num_heads_;
+        const int head_index = static_cast<int>(i) % num_heads_;
+
+        // Append the new key and value rows to the present state.
+        const float* k = ConcatStateChunk(past, K + static_cast<size_t>(i) * head_size, present,
+                                          past_chunk_length, present_chunk_length, i);
+        const float* v = ConcatStateChunk(past + past_v_offset, V + static_cast<size_t>(i) * head_size,
+                                          present + present_v_offset,
+                                          past_chunk_length, present_chunk_length, i);
+
+        // scores(1, S*) = 1/sqrt(H) x q(1, H) x K'(S*, H -> H, S*)
+        math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasTrans, 1, all_sequence_length, head_size, alpha,
+                                        Q + static_cast<size_t>(i) * head_size, head_size,
+                                        k, head_size,
+                                        0.0f, scores.data(), all_sequence_length, nullptr);
+
+        // Apply the additive mask the same way PrepareMask does. The 2D raw
+        // mask and the 3D mask collapse to the same per-batch row when S == 1.
+        if (nullptr != mask_index) {
+          if (is_raw_attention_mask) {
+            const int32_t* raw_mask = mask_index + static_cast<size_t>(batch_index) * all_sequence_length;
+            for (int m_i = 0; m_i < all_sequence_length; m_i++) {
+              if (raw_mask[m_i] <= 0) {
+                scores[m_i] += -10000.0f;
+              }
+            }
+          } else {
+            const int end_position = mask_index[batch_index];
+            for (int m_i = end_position; m_i < all_sequence_length; m_i++) {
+              scores[m_i] += -10000.0f;
+            }
+            if (has_mask_start_position) {
+              const int start_position = std::min(mask_index[batch_index + batch_size], all_sequence_length);
+              for (int m_i = 0; m_i < start_position; m_i++) {
+                scores[m_i] += -10000.0f;
+              }
+            }
+          }
+        }
+
+        if (nullptr != extra_add_qk_data) {
+          for (int m_i = 0; m_i < all_sequence_length; m_i++) {
+            scores[m_i] += extra_add_qk_data[static_cast<size_t>(i) * all_sequence_length + m_i];
+          }
+        }
+
+        ComputeAttentionSoftmaxInplace(scores.data(), 1, all_sequence_length, nullptr);
+
+        // out(1, H) = scores(1, S*) x V(S*, H), written directly to the
+        // (B, 1, N, H) output slot of this head.
+        float* dest = output + (static_cast<size_t>(batch_index) * num_heads_ + head_index) * head_size;
+        math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasNoTrans, 1, head_size, all_sequence_length, 1.0f,
+                                        scores.data(), all_sequence_length,
+                                        v, head_size,
+                                        0.0f, dest, hidden_size, nullptr);
+      }
+    });
+  }
+
   // Helper function to compute the attention probs. It does 2 things:
   //  I. attention_probs(B, N, S, S*) = 1/sqrt(H) x Q(B, N, S, H) x K'(B, N, S*, H -> B, N, H, S*) +
   //                                    1 x mask_data(B, N, S, S*)
@@ -0,0 +1,244 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "fused_elementwise.h"
+
+#include <algorithm>
+
+#include "core/platform/threadpool.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    FusedElementwise,
+    kMSDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    FusedElementwise);
+
+FusedElementwise::FusedElementwise(const OpKernelInfo& info) : OpKernel(info) {
+  std::vector<std::string> op_names;
+  ORT_ENFORCE(info.GetAttrs<std::string>("ops", op_names).IsOK() && !op_names.empty(),
+              "Missing or empty 'ops' attribute");
+
+  ops_.reserve(op_names.size());
+  for (const auto& op_name : op_names) {
+    if (op_name == "Add") {
+      ops_.push_back(Op::kAdd);
+    } else if (op_name == "Sub") {
+      ops_.push_back(Op::kSub);
+    } else if (op_name == "SubRev") {
+      ops_.push_back(Op::kSubRev);
+    } else if (op_name == "Mul") {
+      ops_.push_back(Op::kMul);
+    } else if (op_name == "Div") {
+      ops_.push_back(Op::kDiv);
+    } else if (op_name == "DivRev") {
+      ops_.push_back(Op::kDivRev);
+    } else {
+      ORT_THROW("FusedElementwise: unsupported op '", op_name, "' in 'ops' attribute");
+    }
+  }
+}
+
+namespace {
+
+// How each operand is addressed relative to the output
+enum class OperandKind : uint8_t {
+  kScalar,     // single value broadcast to every output element
+  kFull,       // one value per output element, same flat order
+  kBroadcast,  // addressed via strides that are zero on broadcast dims
+};
+
+struct OperandInfo {
+  OperandKind kind;
+  const float* data;
+  // strides aligned to the output dims; only populated for kBroadcast
+  std::vector<int64_t> strides;
+};
+
+// Gathers the operand values corresponding to flat output indices [start, start + count)
+// into 'buffer' by walking an output coordinate with carries, so the cost is amortized O(1)
+// per element regardless of rank.
+void GatherBroadcastedOperand(const OperandInfo& operand, const std::vector<int64_t>& output_dims,
+                              int64_t start, int64_t count,
+                              std::vector<int64_t>& coordinates, float* buffer) {
+  const size_t rank = output_dims.size();
+  const int64_t* strides = operand.strides.data();
+
+  // decompose the starting flat index into a coordinate and the matching operand offset
+  int64_t remainder = start;
+  int64_t operand_offset = 0;
+  for (size_t d = rank; d-- > 0;) {
+    coordinates[d] = remainder % output_dims[d];
+    remainder /= output_dims[d];
+    operand_offset += coordinates[d] * strides[d];
+  }
+
+  for (int64_t i = 0; i < count; ++i) {
+    buffer[i] = operand.data[operand_offset];
+
+    for (size_t d = rank; d-- > 0;) {
+      operand_offset += strides[d];
+      if (++coordinates[d] < output_dims[d]) {
+        break;
+      }
+      coordinates[d] = 0;
+      operand_offset -= output_dims[d] * strides[d];
+    }
+  }
+}
+
+}  // namespace
+
+void FusedElementwise::ApplyWithVector(Op op, float* accumulator, const float* operand, int64_t count) {
+  switch (op) {
+    case Op::kAdd:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] += operand[i];
+      break;
+    case Op::kSub:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] -= operand[i];
+      break;
+    case Op::kSubRev:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] = operand[i] - accumulator[i];
+      break;
+    case Op::kMul:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] *= operand[i];
+      break;
+    case Op::kDiv:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] /= operand[i];
+      break;
+    case Op::kDivRev:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] = operand[i] / accumulator[i];
+      break;
+  }
+}
+
+void FusedElementwise::ApplyWithScalar(Op op, float* accumulator, float operand, int64_t count) {
+  switch (op) {
+    case Op::kAdd:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] += operand;
+      break;
+    case Op::kSub:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] -= operand;
+      break;
+    case Op::kSubRev:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] = operand - accumulator[i];
+      break;
+    case Op::kMul:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] *= operand;
+      break;
+    case Op::kDiv:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] /= operand;
+      break;
+    case Op::kDivRev:
+      for (int64_t i = 0; i < count; ++i) accumulator[i] = operand / accumulator[i];
+      break;
+  }
+}
+
+Status FusedElementwise::Compute(OpKernelContext* context) const {
+  const auto* X = context->Input<Tensor>(0);
+  const auto& output_shape = X->Shape();
+  const int64_t output_size = output_shape.Size();
+
+  const int num_operands = context->InputCount() - 1;
+  if (static_cast<size_t>(num_operands) != ops_.size()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "FusedElementwise: 'ops' lists ", ops_.size(), " steps but ",
+                           num_operands, " operands were provided");
+  }
+
+  Tensor* Y = context->Output(0, output_shape);
+  if (output_size == 0) {
+    return Status::OK();
+  }
+
+  const auto& output_dims = output_shape.GetDims();
+  const size_t rank = output_dims.size();
+
+  // classify each operand once - a scalar, a same-sized tensor, or a strided broadcast
+  std::vector<OperandInfo> operands(num_operands);
+  for (int i = 0; i < num_operands; ++i) {
+    const auto* operand = context->Input<Tensor>(i + 1);
+    const auto& operand_dims = operand->Shape().GetDims();
+    OperandInfo& info = operands[i];
+    info.data = operand->Data<float>();
+
+    if (operand->Shape().Size() == 1) {
+      info.kind = OperandKind::kScalar;
+      continue;
+    }
+
+    if (operand_dims.size() > rank) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "FusedElementwise: operand ", i, " with shape ", operand->Shape(),
+                             " does not broadcast to the output shape ", output_shape);
+    }
+
+    // right-align the operand dims against the output dims; broadcast dims get stride 0
+    info.strides.assign(rank, 0);
+    int64_t stride = 1;
+    for (size_t d = operand_dims.size(); d-- > 0;) {
+      const size_t output_d = rank - operand_dims.size() + d;
+      if (operand_dims[d] == output_dims[output_d]) {
+        info.strides[output_d] = stride;
+      } else if (operand_dims[d] != 1) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "FusedElementwise: operand ", i, " with shape ", operand->Shape(),
+                               " does not broadcast to the output shape ", output_shape);
+      }
+      stride *= operand_dims[d];
+    }
+
+    info.kind = operand->Shape().Size() == output_size ? OperandKind::kFull : OperandKind::kBroadcast;
+  }
+
+  const float* x_data = X->Data<float>();
+  float* y_data = Y->MutableData<float>();
+
+  // blocks sized to stay resident in L1/L2 while every step of the chain is applied to them
+  constexpr int64_t kBlockSize = 4096;
+  const std::ptrdiff_t block_count = static_cast<std::ptrdiff_t>((output_size + kBlockSize - 1) / kBlockSize);
+  const double cost_per_block = static_cast<double>(kBlockSize) * static_cast<double>(ops_.size()) * 2.0;
+
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), block_count, cost_per_block,
+      [&](std::ptrdiff_t block_first, std::ptrdiff_t block_last) {
+        // scratch shared by all blocks this partition processes
+        std::vector<float> gathered(static_cast<size_t>(kBlockSize));
+        std::vector<int64_t> coordinates(rank);
+
+        for (std::ptrdiff_t block = block_first; block < block_last; ++block) {
+          const int64_t start = block * kBlockSize;
+          const int64_t count = std::min(kBlockSize, output_size - start);
+          float* accumulator = y_data + start;
+
+          std::copy_n(x_data + start, count, accumulator);
+
+          for (size_t step = 0; step < ops_.size(); ++step) {
+            const OperandInfo& operand = operands[step];
+            switch (operand.kind) {
+              case OperandKind::kScalar:
+                ApplyWithScalar(ops_[step], accumulator, operand.data[0], count);
+                break;
+              case OperandKind::kFull:
+                ApplyWithVector(ops_[step], accumulator, operand.data + start, count);
+                break;
+              case OperandKind::kBroadcast:
+                GatherBroadcastedOperand(operand, output_dims, start, count, coordinates, gathered.data());
+                ApplyWithVector(ops_[step], accumulator, gathered.data(), count);
+                break;
+            }
+          }
+        }
+      });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Applies a chain of binary elementwise operations (recorded in the 'ops' attribute by the
+// ElementwiseFusion graph transformer) in a single pass over the data, one cache-sized block
+// at a time, instead of streaming the tensor through memory once per original node.
+class FusedElementwise final : public OpKernel {
+ public:
+  explicit FusedElementwise(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  enum class Op : uint8_t {
+    kAdd,
+    kSub,
+    kSubRev,  // operand - accumulator
+    kMul,
+    kDiv,
+    kDivRev,  // operand / accumulator
+  };
+
+  static void ApplyWithVector(Op op, float* accumulator, const float* operand, int64_t count);
+  static void ApplyWithScalar(Op op, float* accumulator, float operand, int64_t count);
+
+  std::vector<Op> ops_;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
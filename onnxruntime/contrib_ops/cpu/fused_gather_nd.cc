@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/fused_gather_nd.h"
+
+#include "core/platform/threadpool.h"
+#include "core/util/math_cpuonly.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(FusedGatherND, kMSDomain, 1, float, kCpuExecutionProvider,
+                              KernelDefBuilder()
+                                  .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+                                  .TypeConstraint("Tind", DataTypeImpl::GetTensorType<int64_t>()),
+                              FusedGatherND);
+
+namespace {
+
+// An epilogue operand is absent, a scalar, or a vector covering exactly one gathered slice.
+Status GetEpilogueOperand(const Tensor* tensor, int64_t slice_size, const char* name,
+                          const float*& data, bool& is_scalar) {
+  data = nullptr;
+  is_scalar = false;
+  if (tensor == nullptr) {
+    return Status::OK();
+  }
+
+  const int64_t size = tensor->Shape().Size();
+  if (size == 1) {
+    is_scalar = true;
+  } else if (size != slice_size) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, name, " must be a scalar or have ", slice_size,
+                           " elements to match one gathered slice, but has ", size);
+  }
+
+  data = tensor->Data<float>();
+  return Status::OK();
+}
+
+}  // namespace
+
+Status FusedGatherND::Compute(OpKernelContext* context) const {
+  const auto* input_tensor = context->Input<Tensor>(0);
+  const auto* indices_tensor = context->Input<Tensor>(1);
+  const auto* scale_tensor = context->Input<Tensor>(2);
+  const auto* bias_tensor = context->Input<Tensor>(3);
+
+  ORT_ENFORCE(input_tensor != nullptr && indices_tensor != nullptr,
+              "FusedGatherND Compute: Input count mismatch");
+
+  const auto& input_shape = input_tensor->Shape();
+  const auto& indices_shape = indices_tensor->Shape();
+
+  int64_t last_indices_dimension = batch_dims_ + indices_shape[indices_shape.NumDimensions() - 1];
+  if (last_indices_dimension > static_cast<int64_t>(input_shape.NumDimensions())) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "last dimension of indices must not be larger than rank of input tensor");
+  }
+
+  std::vector<int64_t> shape(indices_shape.GetDims().begin(), indices_shape.GetDims().end() - 1);
+  shape.insert(shape.end(), input_shape.GetDims().begin() + last_indices_dimension,
+               input_shape.GetDims().end());
+
+  auto* output_tensor = context->Output(0, TensorShape(std::move(shape)));
+
+  if (output_tensor->Shape().Size() == 0) {
+    return Status::OK();
+  }
+
+  Prepare p;
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+  ORT_RETURN_IF_ERROR(
+      PrepareForCompute<int64_t>(input_shape, indices_tensor, input_tensor->DataType()->Size(), p, tp));
+
+  const int64_t slice_size = static_cast<int64_t>(p.element_count_per_slice);
+  const float* scale_data;
+  bool scale_is_scalar;
+  ORT_RETURN_IF_ERROR(GetEpilogueOperand(scale_tensor, slice_size, "scale", scale_data, scale_is_scalar));
+  const float* bias_data;
+  bool bias_is_scalar;
+  ORT_RETURN_IF_ERROR(GetEpilogueOperand(bias_tensor, slice_size, "bias", bias_data, bias_is_scalar));
+
+  const auto* input_data = input_tensor->Data<float>();
+  auto* output_data = output_tensor->MutableData<float>();
+
+  // Apply the epilogue while the gathered slice is still in cache rather than re-streaming
+  // the whole output afterwards.
+  auto lambda = [&](int64_t slice_idx) {
+    ConstEigenVectorArrayMap<float> x(input_data + p.slice_offsets[slice_idx], slice_size);
+    EigenVectorArrayMap<float> y(output_data + slice_idx * slice_size, slice_size);
+
+    if (scale_data != nullptr) {
+      if (scale_is_scalar) {
+        y = x * *scale_data;
+      } else {
+        y = x * ConstEigenVectorArrayMap<float>(scale_data, slice_size);
+      }
+    } else {
+      y = x;
+    }
+
+    if (bias_data != nullptr) {
+      if (bias_is_scalar) {
+        y += *bias_data;
+      } else {
+        y += ConstEigenVectorArrayMap<float>(bias_data, slice_size);
+      }
+    }
+  };
+  concurrency::ThreadPool::TryParallelFor(
+      tp, p.slice_offsets.size(), static_cast<double>(p.bytes_per_slice),
+      [&lambda](ptrdiff_t first, ptrdiff_t last) {
+        for (int slice_idx = static_cast<int>(first), end = static_cast<int>(last); slice_idx < end; ++slice_idx) {
+          lambda(slice_idx);
+        }
+      });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+#include "core/providers/cpu/tensor/gather_nd.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// GatherND with a scale/bias epilogue folded into the gather copy, so the gathered data is
+// only streamed through memory once instead of being re-read by trailing Mul/Add nodes.
+// Produced by the GatherNDFusion graph transformer.
+class FusedGatherND final : public OpKernel, protected GatherNDBase {
+ public:
+  explicit FusedGatherND(const OpKernelInfo& info) : OpKernel(info) {
+    info.GetAttrOrDefault("batch_dims", &batch_dims_, static_cast<int64_t>(0));
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -21,6 +21,16 @@ class FusedGemm final : public Gemm<T> {
       }
     }
     ORT_THROW_IF_ERROR(functors::ElementWiseRangedTransform<T>::Create(activation, attrs, this->activation_));
+
+    // Map the parameterless activations onto their MLAS equivalents so that Gemm<T>::Compute can
+    // apply them as a GEMM epilogue rather than through the generic element-wise transform.
+    if (activation == "Relu") {
+      this->mlas_activation_.ActivationKind = MlasReluActivation;
+    } else if (activation == "Tanh") {
+      this->mlas_activation_.ActivationKind = MlasTanhActivation;
+    } else if (activation == "Sigmoid") {
+      this->mlas_activation_.ActivationKind = MlasLogisticActivation;
+    }
   }
 };
 
@@ -5,6 +5,7 @@
 
 #include "core/common/safeint.h"
 #include "core/framework/tensor.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 #include "core/util/math_cpuonly.h"
@@ -101,6 +102,16 @@ Status LayerNorm<T, simplified>::Compute(OpKernelContext* p_ctx) const {
     inv_std_dev_data = static_cast<T*>(inv_std_dev_data_buf_ptr.get());
   }
 
+  if constexpr (std::is_same_v<T, float>) {
+    // Use the single-pass vectorized MLAS kernel, which fuses the statistics
+    // accumulation with the normalization passes.
+    MlasComputeLayerNorm(X_data, nullptr, nullptr, scale_data, bias_data,
+                         Y_data, mean_data, inv_std_dev_data,
+                         static_cast<size_t>(norm_count), static_cast<size_t>(norm_size),
+                         epsilon_, simplified, p_ctx->GetOperatorThreadPool());
+    return Status::OK();
+  }
+
   concurrency::ThreadPool::TryBatchParallelFor(
       p_ctx->GetOperatorThreadPool(), static_cast<int32_t>(norm_count),
       [&](ptrdiff_t task_idx) {
@@ -4,6 +4,7 @@
 #if !defined(DISABLE_SPARSE_TENSORS)
 
 #include "core/framework/sparse_tensor.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/cpu/math/gemm_matmul_common.h"
 #include "core/providers/cpu/math/matmul_helper.h"
 #include "core/util/math.h"
@@ -98,6 +99,68 @@ struct SparseToDenseCsr {
 
 #endif  //!defined(__i386__) && !defined(_M_IX86) && !defined(__wasm__) && !defined(__ANDROID__)
 
+// Hand-written CSR row-block x dense panel kernel for the common float non-transposed case.
+// Each output row is a sparse combination of rows of B, so walking B and the output in
+// row-major panels keeps both streams sequential, and processing four nonzeros per pass keeps
+// their scale factors in registers instead of re-reading the output row per nonzero. Work is
+// split over blocks of output rows as Eigen's sparse-dense product is strictly sequential.
+constexpr int64_t kSpMMRowsPerBlock = 8;
+constexpr int64_t kSpMMPanelWidth = 256;
+
+void SparseDenseMatMulFloatCsr(const ComputeCtx& ctx, const SparseTensor& A, const Tensor& B, Tensor& output,
+                               concurrency::ThreadPool* thread_pool) {
+  const auto& a_dims = A.DenseShape().GetDims();
+  const auto& b_dims = B.Shape().GetDims();
+  const int64_t M = a_dims[0];
+  const int64_t N = b_dims[1];
+
+  auto csr_view = A.AsCsr();
+  const int64_t* outer = csr_view.Outer().Data<int64_t>();
+  const int64_t* inner = csr_view.Inner().Data<int64_t>();
+  const float* a_values = A.Values().Data<float>();
+  const float* b_data = B.Data<float>();
+  float* out_data = output.MutableData<float>();
+  const float alpha = ctx.alpha;
+
+  const int64_t num_row_blocks = (M + kSpMMRowsPerBlock - 1) / kSpMMRowsPerBlock;
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(num_row_blocks),
+      [&](std::ptrdiff_t block) {
+        const int64_t row_begin = block * kSpMMRowsPerBlock;
+        const int64_t row_end = std::min(row_begin + kSpMMRowsPerBlock, M);
+        for (int64_t m = row_begin; m < row_end; ++m) {
+          float* out_row = out_data + m * N;
+          const int64_t idx_begin = outer[m];
+          const int64_t idx_end = outer[m + 1];
+          for (int64_t n_begin = 0; n_begin < N; n_begin += kSpMMPanelWidth) {
+            const int64_t n_end = std::min(n_begin + kSpMMPanelWidth, N);
+            std::fill(out_row + n_begin, out_row + n_end, 0.f);
+            int64_t idx = idx_begin;
+            for (; idx + 3 < idx_end; idx += 4) {
+              const float a0 = alpha * a_values[idx];
+              const float a1 = alpha * a_values[idx + 1];
+              const float a2 = alpha * a_values[idx + 2];
+              const float a3 = alpha * a_values[idx + 3];
+              const float* b0 = b_data + inner[idx] * N;
+              const float* b1 = b_data + inner[idx + 1] * N;
+              const float* b2 = b_data + inner[idx + 2] * N;
+              const float* b3 = b_data + inner[idx + 3] * N;
+              for (int64_t n = n_begin; n < n_end; ++n) {
+                out_row[n] += a0 * b0[n] + a1 * b1[n] + a2 * b2[n] + a3 * b3[n];
+              }
+            }
+            for (; idx < idx_end; ++idx) {
+              const float a_value = alpha * a_values[idx];
+              const float* b_row = b_data + inner[idx] * N;
+              for (int64_t n = n_begin; n < n_end; ++n) {
+                out_row[n] += a_value * b_row[n];
+              }
+            }
+          }
+        }
+      });
+}
+
 template<typename T> inline
 T Mul(T a_value, float, T b_value) {
   return a_value * b_value;
@@ -195,7 +258,11 @@ Status SparseToDenseMatMul::Compute(OpKernelContext* ctx) const {
     ORT_RETURN_IF_NOT(A->Values().Shape().Size() == csr_view.Inner().Shape().Size(),
                       "Expecting the same number NNZ == size of Inner indices");
     ORT_RETURN_IF_NOT((A_shape.GetDims()[0] + 1) == csr_view.Outer().Shape().Size(), "Outer size must be M + 1");
-    t_disp.Invoke<SparseToDenseCsr>(compute_ctx, *A, *B, *output);
+    if (A->IsDataType<float>() && !compute_ctx.trans_A && !compute_ctx.trans_B) {
+      SparseDenseMatMulFloatCsr(compute_ctx, *A, *B, *output, ctx->GetOperatorThreadPool());
+    } else {
+      t_disp.Invoke<SparseToDenseCsr>(compute_ctx, *A, *B, *output);
+    }
   } else {
     return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Currently support only COO and CSR(x64) formats");
   }
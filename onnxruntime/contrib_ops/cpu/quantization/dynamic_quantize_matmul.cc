@@ -43,8 +43,12 @@ class MatMulIntegerToFloatBase : public MatMulIntegerBase {
   enum OutputTensors : int { OUT_Y = 0 };
 
  protected:
+  // Exactly one of a_data (already quantized) and a_fp32_data must be non-null. When a_fp32_data
+  // is given, the activation is quantized with a_scale/a_zp inside, in row blocks that stay cache
+  // resident for the following QGEMM instead of materializing the whole quantized activation.
   Status ComputeCommon(OpKernelContext* ctx,
                        const uint8_t* a_data,
+                       const float* a_fp32_data,
                        const TensorShape& a_shape,
                        float a_scale,
                        uint8_t a_zp,
@@ -56,6 +60,7 @@ class MatMulIntegerToFloatBase : public MatMulIntegerBase {
 
 Status MatMulIntegerToFloatBase::ComputeCommon(OpKernelContext* ctx,
                                                const uint8_t* a_data,
+                                               const float* a_fp32_data,
                                                const TensorShape& a_shape,
                                                float a_scale,
                                                uint8_t a_zp,
@@ -133,7 +138,7 @@ Status MatMulIntegerToFloatBase::ComputeCommon(OpKernelContext* ctx,
                                   is_b_scale_per_column ? MLAS_QUANTIZATION_GRANULARITY::PerColumn : MLAS_QUANTIZATION_GRANULARITY::PerMatrix);
     auto& params = gemm_data_vec[gemm_idx];
     params.OutputProcessor = &(gemm_scale_procs[gemm_idx]);
-    params.A = a_data + helper.LeftOffsets()[gemm_idx];
+    params.A = a_data != nullptr ? a_data + helper.LeftOffsets()[gemm_idx] : nullptr;
     params.lda = gemm_shape.K;
     params.ZeroPointA = a_zp;
     params.BIsPacked = bool(packed_b_);
@@ -145,6 +150,55 @@ Status MatMulIntegerToFloatBase::ComputeCommon(OpKernelContext* ctx,
     params.ldc = gemm_shape.N;
   }
 
+  if (a_fp32_data != nullptr) {
+    AllocatorPtr allocator;
+    ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&allocator));
+
+    if (num_gemms > 1) {
+      // batched matmul: quantize the whole activation so the batch can still run as one
+      // MlasGemmBatch call and keep all gemms in flight across the thread pool
+      const int64_t num_of_elements = a_shape.Size();
+      auto a_quant = IAllocator::MakeUniquePtr<uint8_t>(allocator, SafeInt<size_t>(num_of_elements));
+      ParQuantizeLinear(a_fp32_data, a_quant.get(), num_of_elements, a_scale, a_zp,
+                        ctx->GetOperatorThreadPool());
+      for (size_t gemm_idx = 0; gemm_idx < num_gemms; gemm_idx++) {
+        gemm_data_vec[gemm_idx].A = a_quant.get() + helper.LeftOffsets()[gemm_idx];
+      }
+      MlasGemmBatch(gemm_shape, gemm_data_vec.data(), num_gemms, ctx->GetOperatorThreadPool());
+      return Status::OK();
+    }
+
+    // Quantize a block of rows and multiply it while the quantized bytes are still in cache,
+    // so the QGEMM packing stage never has to fetch the intermediate buffer from memory.
+    const int64_t M = helper.M();
+    const int64_t K = helper.K();
+    constexpr int64_t kQuantBlockBytes = 128 * 1024;
+    const int64_t block_rows = std::max<int64_t>(1, std::min<int64_t>(M, kQuantBlockBytes / std::max<int64_t>(K, 1)));
+    auto a_quant_block = IAllocator::MakeUniquePtr<uint8_t>(allocator, SafeInt<size_t>(block_rows) * K);
+
+    for (int64_t row_start = 0; row_start < M; row_start += block_rows) {
+      const int64_t rows = std::min(block_rows, M - row_start);
+      ParQuantizeLinear(a_fp32_data + row_start * K, a_quant_block.get(), rows * K, a_scale, a_zp,
+                        ctx->GetOperatorThreadPool());
+
+      MLAS_QGEMM_SCALE_BIAS_OUTPUT_PROCESSOR block_proc(y_data + row_start * gemm_shape.N,
+                                                        gemm_shape.N,
+                                                        b_scale_data,
+                                                        bias_data,
+                                                        MLAS_QGEMM_OUTPUT_MODE::ZeroMode,
+                                                        is_b_scale_per_column ? MLAS_QUANTIZATION_GRANULARITY::PerColumn : MLAS_QUANTIZATION_GRANULARITY::PerMatrix);
+      MLAS_GEMM_U8X8_SHAPE_PARAMS block_shape = gemm_shape;
+      block_shape.M = static_cast<size_t>(rows);
+      MLAS_GEMM_U8X8_DATA_PARAMS block_params = gemm_data_vec[0];
+      block_params.OutputProcessor = &block_proc;
+      block_params.A = a_quant_block.get();
+      block_params.C = reinterpret_cast<int32_t*>(y_data + row_start * gemm_shape.N);
+      MlasGemm(block_shape, block_params, ctx->GetOperatorThreadPool());
+    }
+
+    return Status::OK();
+  }
+
   MlasGemmBatch(gemm_shape, gemm_data_vec.data(), num_gemms, ctx->GetOperatorThreadPool());
 
   return Status::OK();
@@ -208,17 +262,11 @@ Status DynamicQuantizeMatMul::Compute(OpKernelContext* ctx) const {
   uint8_t a_zero_point;
   GetQuantizationParameter(a_data, num_of_elements, a_scale, a_zero_point, ctx->GetOperatorThreadPool());
 
-  AllocatorPtr allocator;
-  ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&allocator));
-  uint8_t* a_data_quant = static_cast<uint8_t*>(allocator->Alloc(SafeInt<size_t>(num_of_elements) * sizeof(uint8_t)));
-  BufferUniquePtr a_buffer_quant_holder(a_data_quant, BufferDeleter(allocator));
-
-  ParQuantizeLinear(a_data, a_data_quant, num_of_elements, a_scale, a_zero_point, ctx->GetOperatorThreadPool());
-
   bool is_b_scale_supported = IsBQuantParamSupported(b_scale_tensor->Shape(), b ? b->Shape() : b_shape_);
   ORT_RETURN_IF_ERROR(ComputeCommon(
       ctx,
-      a_data_quant,
+      nullptr,
+      a_data,
       a->Shape(),
       a_scale,
       a_zero_point,
@@ -273,6 +321,7 @@ Status MatMulIntegerToFloat::Compute(OpKernelContext* ctx) const {
   ORT_RETURN_IF_ERROR(ComputeCommon(
       ctx,
       a->Data<uint8_t>(),
+      nullptr,
       a->Shape(),
       is_a_scale_scalar ? *a_scale_tensor->template Data<float>() : 1.f,
       a_zero_point,
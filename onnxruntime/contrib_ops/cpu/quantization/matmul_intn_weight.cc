@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/safeint.h"
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+#include "core/providers/common.h"
+
+#include <algorithm>
+
+namespace onnxruntime {
+namespace contrib {
+
+// Matrix product of a float activation with a weight stored as 4 bit or 8 bit unsigned integers
+// with per-group scales. The weight is dequantized group by group into a small reusable buffer
+// that is immediately consumed by an accumulating SGEMM, so the fp32 copy of a weight block stays
+// cache resident and only the quantized bytes are read from memory.
+class MatMulIntNWeight final : public OpKernel {
+ public:
+  MatMulIntNWeight(const OpKernelInfo& info) : OpKernel(info) {
+    ORT_ENFORCE(info.GetAttr<int64_t>("K", &K_).IsOK());
+    bits_ = info.GetAttrOrDefault<int64_t>("bits", 8);
+    ORT_ENFORCE(bits_ == 4 || bits_ == 8, "bits must be 4 or 8, got ", bits_);
+    group_size_ = info.GetAttrOrDefault<int64_t>("group_size", 0);
+    ORT_ENFORCE(group_size_ >= 0, "group_size must be non-negative, got ", group_size_);
+  }
+
+  Status Compute(OpKernelContext* ctx) const override;
+
+ private:
+  int64_t K_;
+  int64_t bits_;
+  int64_t group_size_;
+};
+
+Status MatMulIntNWeight::Compute(OpKernelContext* ctx) const {
+  const Tensor* a = ctx->Input<Tensor>(0);
+  const Tensor* b = ctx->Input<Tensor>(1);
+  const Tensor* scales = ctx->Input<Tensor>(2);
+  const Tensor* zero_points = ctx->Input<Tensor>(3);
+
+  const auto& a_shape = a->Shape();
+  ORT_RETURN_IF_NOT(a_shape.NumDimensions() >= 1 && a_shape[a_shape.NumDimensions() - 1] == K_,
+                    "Last dimension of input A must be K (", K_, ")");
+  const int64_t M = a_shape.SizeToDimension(a_shape.NumDimensions() - 1);
+
+  const auto& b_shape = b->Shape();
+  const int64_t packed_k = bits_ == 4 ? (K_ + 1) / 2 : K_;
+  ORT_RETURN_IF_NOT(b_shape.NumDimensions() == 2 && b_shape[0] == packed_k,
+                    "Input B must be 2-D with ", packed_k, " rows");
+  const int64_t N = b_shape[1];
+
+  const int64_t rows_per_group = group_size_ == 0 ? K_ : group_size_;
+  const int64_t group_count = K_ == 0 ? 0 : (K_ + rows_per_group - 1) / rows_per_group;
+  const auto& scales_shape = scales->Shape();
+  ORT_RETURN_IF_NOT(scales_shape.NumDimensions() == 2 &&
+                        scales_shape[0] == group_count && scales_shape[1] == N,
+                    "Input scales must have shape {", group_count, ", ", N, "}");
+  if (zero_points != nullptr) {
+    ORT_RETURN_IF_NOT(zero_points->Shape() == scales_shape,
+                      "Input zero_points must have the same shape as scales");
+  }
+
+  std::vector<int64_t> output_dims = a_shape.GetDims();
+  output_dims.back() = N;
+  Tensor* y = ctx->Output(0, TensorShape(output_dims));
+  if (y->Shape().Size() == 0) {
+    return Status::OK();
+  }
+
+  const float* a_data = a->Data<float>();
+  const uint8_t* b_data = b->Data<uint8_t>();
+  const float* scales_data = scales->Data<float>();
+  const uint8_t* zp_data = zero_points != nullptr ? zero_points->Data<uint8_t>() : nullptr;
+  const uint8_t default_zp = bits_ == 4 ? 8 : 128;
+  float* y_data = y->MutableData<float>();
+
+  if (K_ == 0) {
+    std::fill_n(y_data, M * N, 0.f);
+    return Status::OK();
+  }
+
+  // Dequantize at most this many rows of B at a time so the fp32 block stays cache sized even
+  // when a group (or the whole of K for group_size 0) is large.
+  constexpr int64_t kMaxBlockRows = 128;
+  const int64_t block_rows = std::min(rows_per_group, kMaxBlockRows);
+
+  AllocatorPtr allocator;
+  ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&allocator));
+  auto block_buffer = IAllocator::MakeUniquePtr<float>(allocator, SafeInt<size_t>(block_rows) * N);
+  float* block_data = block_buffer.get();
+
+  concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
+
+  for (int64_t k_start = 0; k_start < K_;) {
+    const int64_t group = k_start / rows_per_group;
+    // a block never crosses a group boundary so one scale/zero point row covers it
+    const int64_t rows = std::min({block_rows, (group + 1) * rows_per_group - k_start, K_ - k_start});
+    const float* group_scales = scales_data + group * N;
+    const uint8_t* group_zps = zp_data != nullptr ? zp_data + group * N : nullptr;
+
+    for (int64_t r = 0; r < rows; ++r) {
+      const int64_t k = k_start + r;
+      float* block_row = block_data + r * N;
+      if (bits_ == 4) {
+        const uint8_t* b_row = b_data + (k >> 1) * N;
+        const int shift = (k & 1) ? 4 : 0;
+        for (int64_t n = 0; n < N; ++n) {
+          const int32_t q = (b_row[n] >> shift) & 0x0F;
+          const int32_t zp = group_zps != nullptr ? (group_zps[n] & 0x0F) : default_zp;
+          block_row[n] = static_cast<float>(q - zp) * group_scales[n];
+        }
+      } else {
+        const uint8_t* b_row = b_data + k * N;
+        for (int64_t n = 0; n < N; ++n) {
+          const int32_t zp = group_zps != nullptr ? group_zps[n] : default_zp;
+          block_row[n] = static_cast<float>(b_row[n] - zp) * group_scales[n];
+        }
+      }
+    }
+
+    MlasGemm(CblasNoTrans, CblasNoTrans,
+             static_cast<size_t>(M), static_cast<size_t>(N), static_cast<size_t>(rows),
+             1.f,
+             a_data + k_start, static_cast<size_t>(K_),
+             block_data, static_cast<size_t>(N),
+             k_start == 0 ? 0.f : 1.f,
+             y_data, static_cast<size_t>(N),
+             thread_pool);
+
+    k_start += rows;
+  }
+
+  return Status::OK();
+}
+
+ONNX_OPERATOR_KERNEL_EX(
+    MatMulIntNWeight,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("T2", DataTypeImpl::GetTensorType<uint8_t>()),
+    MatMulIntNWeight);
+
+}  // namespace contrib
+}  // namespace onnxruntime
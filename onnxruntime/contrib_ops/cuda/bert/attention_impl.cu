@@ -75,6 +75,17 @@ bool QkvToContext(
 
   const int max_threads_per_block(prop.maxThreadsPerBlock);
 
+  // Decoder generation runs this kernel once per generated token with sequence_length 1.
+  // That step is launch bound, so fold the transpose, cache concat, both gemms and the
+  // softmax into one kernel when the attention weights of a head fit in shared memory.
+  if (1 == sequence_length && nullptr != present && nullptr == mask_index) {
+    if (LaunchSingleTokenAttention(stream, prop, all_sequence_length, batch_size, num_heads, head_size,
+                                   input, past, present, output)) {
+      return true;
+    }
+    // fall through to the general path
+  }
+
   // input should be BxSx3xNxH => scratch3: 3xBxNxSxH
   if (!LaunchTransQkv(stream, sequence_length, batch_size, head_size, num_heads, max_threads_per_block, input, scratch3)) {
     return false;
@@ -38,6 +38,21 @@ bool LaunchAttentionKernel(
     void* present                                 // Present state output
 );
 
+// Fused decoding step: appends the new k/v to present and computes the attention output
+// of the single query token in one launch. Returns false (without touching any output)
+// when the shared memory requirement exceeds the device limit.
+bool LaunchSingleTokenAttention(cudaStream_t stream,
+                                const cudaDeviceProp& prop,
+                                const int all_sequence_length, const int batch_size,
+                                const int num_heads, const int head_size,
+                                const float* input, const float* past, float* present, float* output);
+
+bool LaunchSingleTokenAttention(cudaStream_t stream,
+                                const cudaDeviceProp& prop,
+                                const int all_sequence_length, const int batch_size,
+                                const int num_heads, const int head_size,
+                                const half* input, const half* past, half* present, half* output);
+
 bool LaunchTransCtx(cudaStream_t stream,
                     const int sequence_length, const int batch_size, const int head_size, const int num_heads,
                     const int max_threads_per_block, const float* input, float* output);
@@ -0,0 +1,173 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Fused attention for the decoding case (sequence_length == 1). Each generated token runs
+// the attention subgraph once, so the per-step cost is dominated by kernel launch and gemm
+// setup overhead rather than arithmetic. This kernel folds the whole step -- appending the
+// new k/v to the present cache, Q*K', softmax and the weighted sum over V -- into a single
+// launch per step, with one block per (batch, head) attention problem.
+
+#include <cuda_fp16.h>
+#include <math_constants.h>
+#include "core/providers/cuda/cuda_common.h"
+#include "attention_impl.h"
+
+using namespace onnxruntime::cuda;
+
+namespace onnxruntime {
+namespace contrib {
+namespace cuda {
+
+template <typename T, int TPB>
+__global__ void SingleTokenAttentionKernel(
+    const int all_sequence_length,
+    const int head_size,
+    const float rsqrt_head_size,
+    const T* input,   // Bx1x3xNxH
+    const T* past,    // 2xBxNxS'xH, nullptr when this is the first step
+    T* present,       // 2xBxNxS*xH
+    T* output) {      // Bx1xNxH
+  const int n = blockIdx.x;
+  const int b = blockIdx.y;
+  const int num_heads = gridDim.x;
+  const int batch_size = gridDim.y;
+  const int H = head_size;
+  const int NH = num_heads * H;
+  const int past_sequence_length = all_sequence_length - 1;
+
+  extern __shared__ float smem[];
+  float* scores = smem;                   // all_sequence_length
+  float* q = scores + all_sequence_length;  // head_size
+  float* reduce = q + head_size;          // TPB
+
+  const int present_size_per_batch = all_sequence_length * H;
+  T* present_k = present + (b * num_heads + n) * present_size_per_batch;
+  T* present_v = present_k + batch_size * num_heads * present_size_per_batch;
+
+  // the input is BxSx3xNxH with S == 1; q, k and v of (b, n) sit NH elements apart
+  const T* qkv = input + b * 3 * NH + n * H;
+  for (int h = threadIdx.x; h < H; h += TPB) {
+    q[h] = float(qkv[h]);
+    present_k[past_sequence_length * H + h] = qkv[NH + h];
+    present_v[past_sequence_length * H + h] = qkv[2 * NH + h];
+  }
+
+  // the past rows of present are a straight copy: both caches are BxNxSxH with the new
+  // token appended at the end of the sequence axis
+  if (nullptr != past) {
+    const int past_size_per_batch = past_sequence_length * H;
+    const T* past_k = past + (b * num_heads + n) * past_size_per_batch;
+    const T* past_v = past_k + batch_size * num_heads * past_size_per_batch;
+    for (int i = threadIdx.x; i < past_size_per_batch; i += TPB) {
+      present_k[i] = past_k[i];
+      present_v[i] = past_v[i];
+    }
+  }
+  __syncthreads();
+
+  // scores = scaled Q*K' over the full cache. With a single query at the last position
+  // every key is visible, so the unidirectional mask is a no-op here.
+  for (int s = threadIdx.x; s < all_sequence_length; s += TPB) {
+    const T* k = present_k + s * H;
+    float sum = 0.f;
+    for (int h = 0; h < H; h++) {
+      sum += q[h] * float(k[h]);
+    }
+    scores[s] = sum * rsqrt_head_size;
+  }
+  __syncthreads();
+
+  // block-wide softmax max and sum reductions, accumulated in float for both T
+  float thread_max = -CUDART_INF_F;
+  for (int s = threadIdx.x; s < all_sequence_length; s += TPB) {
+    thread_max = fmaxf(thread_max, scores[s]);
+  }
+  reduce[threadIdx.x] = thread_max;
+  __syncthreads();
+  for (int offset = TPB / 2; offset > 0; offset >>= 1) {
+    if (threadIdx.x < offset) {
+      reduce[threadIdx.x] = fmaxf(reduce[threadIdx.x], reduce[threadIdx.x + offset]);
+    }
+    __syncthreads();
+  }
+  const float max_score = reduce[0];
+  __syncthreads();
+
+  float thread_sum = 0.f;
+  for (int s = threadIdx.x; s < all_sequence_length; s += TPB) {
+    const float e = expf(scores[s] - max_score);
+    scores[s] = e;
+    thread_sum += e;
+  }
+  reduce[threadIdx.x] = thread_sum;
+  __syncthreads();
+  for (int offset = TPB / 2; offset > 0; offset >>= 1) {
+    if (threadIdx.x < offset) {
+      reduce[threadIdx.x] += reduce[threadIdx.x + offset];
+    }
+    __syncthreads();
+  }
+  // the sum includes expf(max - max) == 1 so it cannot be zero
+  const float inverse_sum = 1.f / reduce[0];
+  __syncthreads();
+
+  // context = P*V. BxNx1xH and Bx1xNxH flatten identically, so the result goes straight
+  // to the output without the usual transpose.
+  T* context = output + b * NH + n * H;
+  for (int h = threadIdx.x; h < H; h += TPB) {
+    float sum = 0.f;
+    for (int s = 0; s < all_sequence_length; s++) {
+      sum += scores[s] * float(present_v[s * H + h]);
+    }
+    context[h] = T(sum * inverse_sum);
+  }
+}
+
+template <typename T>
+bool LaunchSingleTokenAttentionKernel(
+    cudaStream_t stream,
+    const cudaDeviceProp& prop,
+    const int all_sequence_length,
+    const int batch_size,
+    const int num_heads,
+    const int head_size,
+    const T* input,
+    const T* past,
+    T* present,
+    T* output) {
+  constexpr int TPB = 256;
+  const size_t shared_bytes = (static_cast<size_t>(all_sequence_length) + head_size + TPB) * sizeof(float);
+  if (shared_bytes > prop.sharedMemPerBlock) {
+    // very long generations fall back to the general multi-kernel path
+    return false;
+  }
+
+  const float rsqrt_head_size = 1.f / sqrtf(static_cast<float>(head_size));
+  const dim3 grid(num_heads, batch_size, 1);
+  SingleTokenAttentionKernel<T, TPB><<<grid, TPB, shared_bytes, stream>>>(
+      all_sequence_length, head_size, rsqrt_head_size, input, past, present, output);
+
+  return CUDA_CALL(cudaPeekAtLastError());
+}
+
+bool LaunchSingleTokenAttention(cudaStream_t stream,
+                                const cudaDeviceProp& prop,
+                                const int all_sequence_length, const int batch_size,
+                                const int num_heads, const int head_size,
+                                const float* input, const float* past, float* present, float* output) {
+  return LaunchSingleTokenAttentionKernel<float>(stream, prop, all_sequence_length, batch_size,
+                                                 num_heads, head_size, input, past, present, output);
+}
+
+bool LaunchSingleTokenAttention(cudaStream_t stream,
+                                const cudaDeviceProp& prop,
+                                const int all_sequence_length, const int batch_size,
+                                const int num_heads, const int head_size,
+                                const half* input, const half* past, half* present, half* output) {
+  return LaunchSingleTokenAttentionKernel<half>(stream, prop, all_sequence_length, batch_size,
+                                                num_heads, head_size, input, past, present, output);
+}
+
+}  // namespace cuda
+}  // namespace contrib
+}  // namespace onnxruntime
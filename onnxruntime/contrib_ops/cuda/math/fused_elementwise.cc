@@ -0,0 +1,146 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cuda/math/fused_elementwise.h"
+
+#include <algorithm>
+
+#include "core/providers/cpu/tensor/utils.h"
+
+using namespace onnxruntime::cuda;
+
+namespace onnxruntime {
+namespace contrib {
+namespace cuda {
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    FusedElementwise,
+    kMSDomain,
+    1,
+    float,
+    kCudaExecutionProvider,
+    (*KernelDefBuilder::Create()).TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    FusedElementwise);
+
+FusedElementwise::FusedElementwise(const OpKernelInfo& info) : CudaKernel(info) {
+  std::vector<std::string> op_names;
+  ORT_ENFORCE(info.GetAttrs<std::string>("ops", op_names).IsOK() && !op_names.empty(),
+              "Missing or empty 'ops' attribute");
+
+  ops_.reserve(op_names.size());
+  for (const auto& op_name : op_names) {
+    if (op_name == "Add") {
+      ops_.push_back(FusedElementwiseOp::kAdd);
+    } else if (op_name == "Sub") {
+      ops_.push_back(FusedElementwiseOp::kSub);
+    } else if (op_name == "SubRev") {
+      ops_.push_back(FusedElementwiseOp::kSubRev);
+    } else if (op_name == "Mul") {
+      ops_.push_back(FusedElementwiseOp::kMul);
+    } else if (op_name == "Div") {
+      ops_.push_back(FusedElementwiseOp::kDiv);
+    } else if (op_name == "DivRev") {
+      ops_.push_back(FusedElementwiseOp::kDivRev);
+    } else {
+      ORT_THROW("FusedElementwise: unsupported op '", op_name, "' in 'ops' attribute");
+    }
+  }
+}
+
+Status FusedElementwise::ComputeInternal(OpKernelContext* context) const {
+  const auto* X = context->Input<Tensor>(0);
+  const auto& output_shape = X->Shape();
+  const int64_t output_size = output_shape.Size();
+
+  const int num_operands = context->InputCount() - 1;
+  if (static_cast<size_t>(num_operands) != ops_.size()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "FusedElementwise: 'ops' lists ", ops_.size(), " steps but ",
+                           num_operands, " operands were provided");
+  }
+
+  Tensor* Y = context->Output(0, output_shape);
+  if (output_size == 0) {
+    return Status::OK();
+  }
+
+  const auto& output_dims = output_shape.GetDims();
+  const size_t rank = output_dims.size();
+
+  // classify each operand once - a scalar, a same-sized tensor, or a strided broadcast
+  bool any_broadcast = false;
+  std::vector<FusedElementwiseStep> steps(num_operands);
+  for (int i = 0; i < num_operands; ++i) {
+    const auto* operand = context->Input<Tensor>(i + 1);
+    const auto& operand_dims = operand->Shape().GetDims();
+    FusedElementwiseStep& step = steps[i];
+    step.op = ops_[i];
+    step.data = operand->Data<float>();
+
+    if (operand->Shape().Size() == 1) {
+      step.kind = FusedElementwiseOperandKind::kScalar;
+      continue;
+    }
+
+    if (operand_dims.size() > rank) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "FusedElementwise: operand ", i, " with shape ", operand->Shape(),
+                             " does not broadcast to the output shape ", output_shape);
+    }
+
+    // right-align the operand dims against the output dims; broadcast dims get stride 0
+    std::vector<int64_t> strides(rank, 0);
+    int64_t stride = 1;
+    for (size_t d = operand_dims.size(); d-- > 0;) {
+      const size_t output_d = rank - operand_dims.size() + d;
+      if (operand_dims[d] == output_dims[output_d]) {
+        strides[output_d] = stride;
+      } else if (operand_dims[d] != 1) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "FusedElementwise: operand ", i, " with shape ", operand->Shape(),
+                               " does not broadcast to the output shape ", output_shape);
+      }
+      stride *= operand_dims[d];
+    }
+
+    if (operand->Shape().Size() == output_size) {
+      step.kind = FusedElementwiseOperandKind::kFull;
+    } else {
+      step.kind = FusedElementwiseOperandKind::kBroadcast;
+      step.padded_strides = TArray<int64_t>(strides);
+      any_broadcast = true;
+    }
+  }
+
+  // the output coordinate decomposition is only needed when some step broadcasts
+  int32_t output_rank = 0;
+  TArray<fast_divmod> fdm_output_strides;
+  if (any_broadcast) {
+    output_rank = gsl::narrow_cast<int32_t>(rank);
+    TensorPitches original_output_strides(output_dims);
+    fdm_output_strides.SetSize(output_rank);
+    for (int32_t i = 0; i < output_rank; ++i) {
+      fdm_output_strides[i] = fast_divmod(gsl::narrow_cast<int>(original_output_strides[i]));
+    }
+  }
+
+  const float* input_data = X->Data<float>();
+  float* output_data = Y->MutableData<float>();
+
+  // long chains take several launches; each launch after the first re-reads the output
+  for (int first = 0; first < num_operands; first += kMaxFusedElementwiseStepsPerLaunch) {
+    FusedElementwiseStepBatch batch;
+    batch.count = std::min(kMaxFusedElementwiseStepsPerLaunch, num_operands - first);
+    std::copy_n(steps.data() + first, batch.count, batch.steps);
+
+    FusedElementwiseImpl(Stream(), output_rank, fdm_output_strides,
+                         first == 0 ? input_data : output_data,
+                         batch, output_data, static_cast<size_t>(output_size));
+  }
+
+  return Status::OK();
+}
+
+}  // namespace cuda
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/providers/cuda/cuda_kernel.h"
+#include "contrib_ops/cuda/math/fused_elementwise_impl.h"
+
+namespace onnxruntime {
+namespace contrib {
+namespace cuda {
+
+// CUDA counterpart of the CPU FusedElementwise kernel: applies the chain of binary
+// elementwise operations recorded by the ElementwiseFusion graph transformer in a single
+// pass, keeping the accumulator in registers instead of materializing every intermediate
+// in global memory. The op program is interpreted per element, so one kernel serves every
+// chain the transformer produces.
+class FusedElementwise final : public ::onnxruntime::cuda::CudaKernel {
+ public:
+  explicit FusedElementwise(const OpKernelInfo& info);
+
+  Status ComputeInternal(OpKernelContext* context) const override;
+
+ private:
+  std::vector<FusedElementwiseOp> ops_;
+};
+
+}  // namespace cuda
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cuda/math/fused_elementwise_impl.h"
+
+#include "core/providers/cuda/cu_inc/common.cuh"
+
+using namespace onnxruntime::cuda;
+
+namespace onnxruntime {
+namespace contrib {
+namespace cuda {
+
+namespace {
+
+__device__ __forceinline__ float ApplyFusedElementwiseOp(FusedElementwiseOp op, float accumulator, float operand) {
+  switch (op) {
+    case FusedElementwiseOp::kAdd:
+      return accumulator + operand;
+    case FusedElementwiseOp::kSub:
+      return accumulator - operand;
+    case FusedElementwiseOp::kSubRev:
+      return operand - accumulator;
+    case FusedElementwiseOp::kMul:
+      return accumulator * operand;
+    case FusedElementwiseOp::kDiv:
+      return accumulator / operand;
+    case FusedElementwiseOp::kDivRev:
+      return operand / accumulator;
+  }
+  return accumulator;
+}
+
+}  // namespace
+
+template <int NumThreadsPerBlock, int NumElementsPerThread>
+__global__ void _FusedElementwise(
+    int32_t output_rank,
+    const TArray<fast_divmod> fdm_output_strides,
+    const float* input_data,
+    const FusedElementwiseStepBatch steps,
+    float* output_data,
+    CUDA_LONG N) {
+  CUDA_LONG start = NumElementsPerThread * NumThreadsPerBlock * blockIdx.x + threadIdx.x;
+
+  CUDA_LONG id = start;
+#pragma unroll
+  for (int i = 0; i < NumElementsPerThread; i++) {
+    if (id < N) {
+      float accumulator = input_data[id];
+
+      for (int32_t s = 0; s < steps.count; s++) {
+        const FusedElementwiseStep& step = steps.steps[s];
+
+        CUDA_LONG index = 0;
+        if (step.kind == FusedElementwiseOperandKind::kFull) {
+          index = id;
+        } else if (step.kind == FusedElementwiseOperandKind::kBroadcast) {
+          // compute the operand index with broadcasting rules, as in binary_elementwise_impl.cuh
+          CUDA_LONG offset = id;
+#pragma unroll
+          for (auto dim = 0; dim < fdm_output_strides.Capacity(); dim++) {
+            if (dim >= output_rank) {
+              break;
+            }
+            int q, r;
+            fdm_output_strides[dim].divmod(offset, q, r);
+            index += static_cast<int>(step.padded_strides[dim]) * q;
+            offset = r;
+          }
+        }
+
+        accumulator = ApplyFusedElementwiseOp(step.op, accumulator, step.data[index]);
+      }
+
+      output_data[id] = accumulator;
+
+      id += NumThreadsPerBlock;
+    }
+  }
+}
+
+void FusedElementwiseImpl(
+    cudaStream_t stream,
+    int32_t output_rank,
+    const TArray<fast_divmod>& fdm_output_strides,
+    const float* input_data,
+    const FusedElementwiseStepBatch& steps,
+    float* output_data,
+    size_t count) {
+  if (count == 0)
+    return;
+
+  int blocksPerGrid = static_cast<int>(CeilDiv(count, GridDim::maxThreadsPerBlock * GridDim::maxElementsPerThread));
+  CUDA_LONG N = static_cast<CUDA_LONG>(count);
+  _FusedElementwise<GridDim::maxThreadsPerBlock, GridDim::maxElementsPerThread>
+      <<<blocksPerGrid, GridDim::maxThreadsPerBlock, 0, stream>>>(
+          output_rank,
+          fdm_output_strides,
+          input_data,
+          steps,
+          output_data,
+          N);
+}
+
+}  // namespace cuda
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "core/providers/cuda/shared_inc/cuda_utils.h"
+#include "core/providers/cuda/shared_inc/fast_divmod.h"
+
+namespace onnxruntime {
+namespace contrib {
+namespace cuda {
+
+// The operation applied at each step of the chain. Kept in sync with the op names the
+// ElementwiseFusion graph transformer records in the 'ops' attribute.
+enum class FusedElementwiseOp : int8_t {
+  kAdd = 0,
+  kSub,
+  kSubRev,  // operand - accumulator
+  kMul,
+  kDiv,
+  kDivRev,  // operand / accumulator
+};
+
+// How a step's operand is addressed relative to the output, mirroring the CPU kernel.
+enum class FusedElementwiseOperandKind : int8_t {
+  kScalar = 0,  // single value broadcast to every output element
+  kFull,        // one value per output element, same flat order
+  kBroadcast,   // addressed via strides that are zero on broadcast dims
+};
+
+struct FusedElementwiseStep {
+  FusedElementwiseOp op;
+  FusedElementwiseOperandKind kind;
+  const float* data;
+  // operand strides right-aligned to the output dims; only read for kBroadcast
+  onnxruntime::cuda::TArray<int64_t> padded_strides;
+};
+
+// Chains longer than this take additional launches; every launch after the first re-reads
+// the output written by the previous one. The batch is passed to the kernel by value, so
+// the limit also bounds the kernel parameter size.
+constexpr int32_t kMaxFusedElementwiseStepsPerLaunch = 8;
+
+struct FusedElementwiseStepBatch {
+  int32_t count;
+  FusedElementwiseStep steps[kMaxFusedElementwiseStepsPerLaunch];
+};
+
+// Applies 'steps' to every element of 'input_data', keeping the accumulator in a register,
+// and writes the result to 'output_data'. 'output_rank' is 0 when no step broadcasts, in
+// which case 'fdm_output_strides' is not read. In-place operation is supported.
+void FusedElementwiseImpl(
+    cudaStream_t stream,
+    int32_t output_rank,
+    const onnxruntime::cuda::TArray<onnxruntime::cuda::fast_divmod>& fdm_output_strides,
+    const float* input_data,
+    const FusedElementwiseStepBatch& steps,
+    float* output_data,
+    size_t count);
+
+}  // namespace cuda
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -13,6 +13,9 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <atomic>
+#include <chrono>
+#include <cstring>
 #include <memory>
 
 #include "core/platform/threadpool.h"
@@ -366,6 +369,87 @@ class alignas(CACHE_LINE_BYTES) LoopCounter {
 #pragma warning(pop) /* Padding added in LoopCounterShard, LoopCounter */
 #endif
 
+// Runtime calibration of the per-iteration cost estimates supplied to the parallel loop
+// functions.  The hand written TensorOpCost values at many call-sites are off by large factors,
+// which either overshards loops (dispatch overhead dominates) or undershards them (cores stay
+// idle).  The calibrator measures the time actually spent inside the loop body during the first
+// few executions of each distinct cost signature and uses the measured per-iteration cost for
+// subsequent scheduling decisions.  The cost signature (the three TensorOpCost components)
+// serves as a proxy for the call-site: a call-site computes its estimate with the same formula
+// every time, while unrelated call-sites rarely agree on all three components.
+class LoopCostCalibrator {
+ public:
+  // Number of measured executions of a signature before the learned cost is trusted.
+  static constexpr uint32_t kCalibrationRuns = 4;
+
+  // Nominal frequency used to convert measured wall time into the cycle unit of TensorOpCost.
+  // The scheduling heuristics only need the order of magnitude to be right, so a fixed nominal
+  // frequency is sufficient; querying the actual clock rate portably is not worth the complexity.
+  static constexpr double kNominalCyclesPerNanosecond = 2.0;
+
+  // Returns true and sets cycles_per_unit to the learned per-iteration cost once the signature
+  // has been measured kCalibrationRuns times.  Returns false when the caller should measure the
+  // loop it is about to run and report the result via Record().
+  bool TryGetCalibratedCost(const TensorOpCost& cost, double& cycles_per_unit) {
+    const uint64_t key = Hash(cost);
+    Entry& entry = entries_[key % kNumEntries];
+    if (entry.key.load(std::memory_order_relaxed) != key) {
+      // Claim (or evict the previous occupant of) the slot.  Races between concurrent loops are
+      // benign: the loser's measurements are attributed to the winner's signature at worst for
+      // one execution, and the affected slot simply re-calibrates.
+      entry.key.store(key, std::memory_order_relaxed);
+      entry.num_runs.store(0, std::memory_order_relaxed);
+      return false;
+    }
+    if (entry.num_runs.load(std::memory_order_relaxed) < kCalibrationRuns) {
+      return false;
+    }
+    cycles_per_unit = entry.cycles_per_unit.load(std::memory_order_relaxed);
+    return true;
+  }
+
+  void Record(const TensorOpCost& cost, double measured_cycles_per_unit) {
+    const uint64_t key = Hash(cost);
+    Entry& entry = entries_[key % kNumEntries];
+    if (entry.key.load(std::memory_order_relaxed) != key) {
+      return;  // evicted while the loop was running
+    }
+    const uint32_t num_runs = entry.num_runs.load(std::memory_order_relaxed);
+    const double previous = entry.cycles_per_unit.load(std::memory_order_relaxed);
+    // Exponential moving average smooths over cold caches on the first execution and transient
+    // interference from other loops sharing the machine.
+    const double updated = (num_runs == 0) ? measured_cycles_per_unit
+                                           : 0.5 * previous + 0.5 * measured_cycles_per_unit;
+    entry.cycles_per_unit.store(updated, std::memory_order_relaxed);
+    entry.num_runs.store(num_runs + 1, std::memory_order_relaxed);
+  }
+
+ private:
+  // Direct-mapped: collisions evict, so a pathological mix of signatures degrades to permanent
+  // re-measurement of the colliding loops rather than to wrong decisions.
+  static constexpr unsigned kNumEntries = 64;
+
+  struct Entry {
+    std::atomic<uint64_t> key{0};
+    std::atomic<uint32_t> num_runs{0};
+    std::atomic<double> cycles_per_unit{0.0};
+  };
+
+  static uint64_t Hash(const TensorOpCost& cost) {
+    // FNV-1a over the bit patterns of the three cost components
+    uint64_t h = 1469598103934665603ULL;
+    for (double component : {cost.bytes_loaded, cost.bytes_stored, cost.compute_cycles}) {
+      uint64_t bits;
+      static_assert(sizeof(bits) == sizeof(component), "Expected 64-bit double");
+      std::memcpy(&bits, &component, sizeof(bits));
+      h = (h ^ bits) * 1099511628211ULL;
+    }
+    return h;
+  }
+
+  Entry entries_[kNumEntries];
+};
+
 ThreadPool::ThreadPool(Env* env,
                        const ThreadOptions& thread_options,
                        const NAME_CHAR_TYPE* name,
@@ -385,6 +469,7 @@ ThreadPool::ThreadPool(Env* env,
                                                         *env,
                                                         thread_options_);
     underlying_threadpool_ = extended_eigen_threadpool_.get();
+    loop_cost_calibrator_ = std::make_unique<LoopCostCalibrator>();
   }
 }
 
@@ -461,6 +546,20 @@ std::string ThreadPool::StopProfiling() {
 
 thread_local ThreadPool::ParallelSection* ThreadPool::ParallelSection::current_parallel_section{nullptr};
 
+thread_local int ThreadPool::ParallelismCapScope::current_cap_{0};
+
+ThreadPool::ParallelismCapScope::ParallelismCapScope(int max_degree_of_parallelism)
+    : previous_cap_(current_cap_) {
+  if (max_degree_of_parallelism > 0 &&
+      (current_cap_ == 0 || max_degree_of_parallelism < current_cap_)) {
+    current_cap_ = max_degree_of_parallelism;
+  }
+}
+
+ThreadPool::ParallelismCapScope::~ParallelismCapScope() {
+  current_cap_ = previous_cap_;
+}
+
 ThreadPool::ParallelSection::ParallelSection(ThreadPool* tp) {
 #ifdef _OPENMP
   // Nothing
@@ -589,15 +688,54 @@ void ThreadPool::ParallelFor(std::ptrdiff_t n, const TensorOpCost& c,
   ORT_ENFORCE(n >= 0);
   Eigen::TensorOpCost cost{c.bytes_loaded, c.bytes_stored, c.compute_cycles};
   auto d_of_p = DegreeOfParallelism(this);
-  // Compute small problems directly in the caller thread.
+
+  // Prefer a measured per-iteration cost over the caller's estimate once calibration for this
+  // cost signature has completed; until then measure this execution to refine the estimate.
+  bool measure_this_run = false;
+  if (loop_cost_calibrator_ && n > 0) {
+    double calibrated_cycles = 0.0;
+    if (loop_cost_calibrator_->TryGetCalibratedCost(c, calibrated_cycles)) {
+      cost = Eigen::TensorOpCost{c.bytes_loaded, c.bytes_stored, calibrated_cycles};
+    } else {
+      measure_this_run = true;
+    }
+  }
+
+  if (!measure_this_run) {
+    // Compute small problems directly in the caller thread.
+    if ((!ShouldParallelizeLoop(n)) ||
+        CostModel::numThreads(static_cast<double>(n), cost, d_of_p) == 1) {
+      f(0, n);
+      return;
+    }
+
+    ptrdiff_t block = CalculateParallelForBlock(n, cost, nullptr, d_of_p);
+    ParallelForFixedBlockSizeScheduling(n, block, f);
+    return;
+  }
+
+  // Calibration run: time the work done inside the loop body.  Summing the busy time across
+  // blocks (rather than timing the loop end to end) keeps the measurement independent of how
+  // many threads happened to help with this particular execution.
+  std::atomic<int64_t> busy_ns{0};
+  auto timed_fn = [&f, &busy_ns](std::ptrdiff_t first, std::ptrdiff_t last) {
+    const auto start = std::chrono::steady_clock::now();
+    f(first, last);
+    busy_ns.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count(),
+        std::memory_order_relaxed);
+  };
+
   if ((!ShouldParallelizeLoop(n)) ||
       CostModel::numThreads(static_cast<double>(n), cost, d_of_p) == 1) {
-    f(0, n);
-    return;
+    timed_fn(0, n);
+  } else {
+    ptrdiff_t block = CalculateParallelForBlock(n, cost, nullptr, d_of_p);
+    ParallelForFixedBlockSizeScheduling(n, block, timed_fn);
   }
 
-  ptrdiff_t block = CalculateParallelForBlock(n, cost, nullptr, d_of_p);
-  ParallelForFixedBlockSizeScheduling(n, block, f);
+  loop_cost_calibrator_->Record(c, static_cast<double>(busy_ns.load(std::memory_order_relaxed)) *
+                                       LoopCostCalibrator::kNominalCyclesPerNanosecond / static_cast<double>(n));
 }
 
 void ThreadPool::ParallelFor(std::ptrdiff_t total, double cost_per_unit,
@@ -619,13 +757,17 @@ int ThreadPool::DegreeOfParallelism(const concurrency::ThreadPool* tp) {
   return (omp_get_num_threads() == 1) ? omp_get_max_threads() : 1;
 #else
   // When not using OpenMP, we parallelise over the N threads created by the pool
-  // tp, plus 1 for the thread entering a loop.
+  // tp, plus 1 for the thread entering a loop.  An enclosing ParallelismCapScope
+  // can reduce the degree of parallelism that loops started here aim for.
   if (tp) {
+    int dop;
     if (CPUIDInfo::GetCPUIDInfo().IsHybrid()) {
-      return ((tp->NumThreads() + 1)) * TaskGranularityFactor;
+      dop = ((tp->NumThreads() + 1)) * TaskGranularityFactor;
     } else {
-      return ((tp->NumThreads() + 1));
+      dop = ((tp->NumThreads() + 1));
     }
+    int cap = ParallelismCapScope::current_cap_;
+    return (cap > 0 && cap < dop) ? cap : dop;
   } else {
     return 1;
   }
@@ -646,6 +788,19 @@ std::string ThreadPool::StopProfiling(concurrency::ThreadPool* tp) {
   }
 }
 
+ThreadPoolStats ThreadPool::GetStats(const ThreadPool* tp) {
+  if (tp && tp->underlying_threadpool_) {
+    return tp->underlying_threadpool_->GetStats();
+  }
+  return {};
+}
+
+void ThreadPool::ResetStats(ThreadPool* tp) {
+  if (tp && tp->underlying_threadpool_) {
+    tp->underlying_threadpool_->ResetStats();
+  }
+}
+
 // Return the number of threads created by the pool.
 int ThreadPool::NumThreads() const {
   if (underlying_threadpool_) {
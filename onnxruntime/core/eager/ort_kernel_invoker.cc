@@ -9,50 +9,101 @@
 #include "core/session/ort_env.h"
 #include "core/graph/constants.h"
 
+#include <algorithm>
+#include <sstream>
+
 namespace onnxruntime {
 
 #define ORT_EAGER_ONNX_OPSET_VERSION 14
 
-common::Status ORTInvoker::Invoke(const std::string& op_name,
-                                  //optional inputs / outputs?
-                                  const std::vector<OrtValue>& inputs,
-                                  std::vector<OrtValue>& outputs,
-                                  const NodeAttributes* attributes,
-                                  const std::string& domain,
-                                  const int version) {
+// Pre-resolved state reused across invocations of the same op signature.
+// The model owns the graph and node; the Info holds the value-index maps
+// the execution frame needs. The kernel is created without constant
+// initializers so it never captures a particular call's input values,
+// which keeps it valid for any inputs matching the cache key.
+struct ORTInvoker::DispatchCacheEntry {
+  std::unique_ptr<Model> model;
+  const Node* node{nullptr};
+  std::unique_ptr<OptimizerExecutionFrame::Info> info;
+  std::unique_ptr<const OpKernel> kernel;
+  std::vector<int> feed_mlvalue_idxs;
+  std::vector<int> fetch_mlvalue_idxs;
+};
+
+// Builds the cache key from everything that affects kernel resolution:
+// op identity, opset version, attributes, the number of requested outputs,
+// and each input's element type and device. Input shapes are deliberately
+// excluded; the graph is resolved without shapes and output shapes are
+// determined per execution.
+static std::string MakeDispatchKey(const std::string& op_name,
+                                   const std::vector<OrtValue>& inputs,
+                                   const size_t output_count,
+                                   const NodeAttributes* attributes,
+                                   const std::string& domain,
+                                   const int version) {
+  std::ostringstream key;
+  key << domain << ':' << op_name << ':' << version << ':' << output_count;
+  for (const auto& input : inputs) {
+    const Tensor& input_tensor = input.Get<Tensor>();
+    const auto& location = input_tensor.Location();
+    key << '|' << input_tensor.GetElementType() << '@' << location.name << ':' << location.id;
+  }
+  if (attributes) {
+    std::vector<const NodeAttributes::value_type*> sorted_attributes;
+    sorted_attributes.reserve(attributes->size());
+    for (const auto& attribute : *attributes) {
+      sorted_attributes.push_back(&attribute);
+    }
+    std::sort(sorted_attributes.begin(), sorted_attributes.end(),
+              [](const NodeAttributes::value_type* l, const NodeAttributes::value_type* r) {
+                return l->first < r->first;
+              });
+    for (const auto* attribute : sorted_attributes) {
+      const std::string serialized = attribute->second.SerializeAsString();
+      key << '|' << attribute->first << '=' << serialized.size() << ':' << serialized;
+    }
+  }
+  return key.str();
+}
+
+common::Status ORTInvoker::CreateDispatchEntry(const std::string& op_name,
+                                               const std::vector<OrtValue>& inputs,
+                                               const size_t output_count,
+                                               const NodeAttributes* attributes,
+                                               const std::string& domain,
+                                               const int version,
+                                               std::shared_ptr<DispatchCacheEntry>& entry) {
   std::unordered_map<std::string, int> domain_version_map = {{kOnnxDomain, ORT_EAGER_ONNX_OPSET_VERSION},
                                                              {kMSDomain, 1}};
   //create a graph
-  Model model("test", 
-              false, 
-              ModelMetaData(),
-              ORT_TSTR(""),
-              custom_op_registries_,
-              domain_version_map,
-              {},
-              logger_);
+  auto model = std::make_unique<Model>("test",
+                                       false,
+                                       ModelMetaData(),
+                                       ORT_TSTR(""),
+                                       custom_op_registries_,
+                                       domain_version_map,
+                                       std::vector<ONNX_NAMESPACE::FunctionProto>{},
+                                       logger_);
 
   std::vector<onnxruntime::NodeArg*> input_args;
   std::vector<onnxruntime::NodeArg*> output_args;
 
   input_args.reserve(inputs.size());
-  output_args.reserve(outputs.size());
+  output_args.reserve(output_count);
 
-  Graph& graph = model.MainGraph();
-  std::unordered_map<std::string, OrtValue> initializer_map;
+  Graph& graph = model->MainGraph();
   size_t i = 0;
 
-  for (auto input : inputs) {
+  for (const auto& input : inputs) {
     std::string name = "I" + std::to_string(i++);
     const Tensor& input_tensor = input.Get<Tensor>();
     ONNX_NAMESPACE::TypeProto input_tensor_type;
     input_tensor_type.mutable_tensor_type()->set_elem_type(input_tensor.GetElementType());
     auto& arg = graph.GetOrCreateNodeArg(name, &input_tensor_type);
     input_args.push_back(&arg);
-    initializer_map[name] = input;
   }
 
-  for (i = 0; i < outputs.size(); ++i) {
+  for (i = 0; i < output_count; ++i) {
     auto& arg = graph.GetOrCreateNodeArg("O" + std::to_string(i), nullptr);
     output_args.push_back(&arg);
   }
@@ -61,22 +112,63 @@ common::Status ORTInvoker::Invoke(const std::string& op_name,
   ORT_RETURN_IF_ERROR(graph.Resolve());
 
   node.SetExecutionProviderType(execution_provider_->Type());
-  std::vector<const Node*> frame_nodes{&node};
 
-  OptimizerExecutionFrame::Info info({&node}, initializer_map, graph.ModelPath(), *execution_provider_, [](std::string const& ) { return false; });
-  auto kernel = info.CreateKernel(&node);
+  // Inputs are fed through the execution frame per invocation, so the Info
+  // carries no initializers and the kernel cannot treat any input as constant.
+  auto info = std::make_unique<OptimizerExecutionFrame::Info>(
+      std::vector<const Node*>{&node}, std::unordered_map<std::string, OrtValue>{},
+      graph.ModelPath(), *execution_provider_, [](std::string const&) { return false; });
+  auto kernel = info->CreateKernel(&node);
   if (!kernel) {
     ORT_THROW("Could not find kernel name:", op_name, ", domain:", domain, ", version:", version);
   }
 
-  std::vector<int> fetch_mlvalue_idxs;
+  auto new_entry = std::make_shared<DispatchCacheEntry>();
+  for (const auto* node_in : node.InputDefs()) {
+    new_entry->feed_mlvalue_idxs.push_back(info->GetMLValueIndex(node_in->Name()));
+  }
   for (const auto* node_out : node.OutputDefs()) {
-    fetch_mlvalue_idxs.push_back(info.GetMLValueIndex(node_out->Name()));
+    new_entry->fetch_mlvalue_idxs.push_back(info->GetMLValueIndex(node_out->Name()));
+  }
+  new_entry->model = std::move(model);
+  new_entry->node = &node;
+  new_entry->info = std::move(info);
+  new_entry->kernel = std::move(kernel);
+  entry = std::move(new_entry);
+
+  return Status::OK();
+}
+
+common::Status ORTInvoker::Invoke(const std::string& op_name,
+                                  //optional inputs / outputs?
+                                  const std::vector<OrtValue>& inputs,
+                                  std::vector<OrtValue>& outputs,
+                                  const NodeAttributes* attributes,
+                                  const std::string& domain,
+                                  const int version) {
+  const std::string key = MakeDispatchKey(op_name, inputs, outputs.size(), attributes, domain, version);
+
+  std::shared_ptr<DispatchCacheEntry> entry;
+  {
+    std::lock_guard<OrtMutex> lock(dispatch_cache_mutex_);
+    auto it = dispatch_cache_.find(key);
+    if (it != dispatch_cache_.end()) {
+      entry = it->second;
+    }
+  }
+
+  if (!entry) {
+    ORT_RETURN_IF_ERROR(CreateDispatchEntry(op_name, inputs, outputs.size(), attributes, domain, version, entry));
+    std::lock_guard<OrtMutex> lock(dispatch_cache_mutex_);
+    // Keep the first entry if another thread raced us here; both are equivalent.
+    entry = dispatch_cache_.emplace(key, std::move(entry)).first->second;
   }
 
-  OptimizerExecutionFrame frame(info, fetch_mlvalue_idxs, outputs);
-  OpKernelContext op_kernel_context(&frame, kernel.get(), nullptr, logger_);
-  ORT_RETURN_IF_ERROR(kernel->Compute(&op_kernel_context));
+  // Temporary output OrtValues are allocated through the execution provider's
+  // allocator (arena-backed where the provider uses an arena).
+  OptimizerExecutionFrame frame(*entry->info, entry->feed_mlvalue_idxs, inputs, entry->fetch_mlvalue_idxs, outputs);
+  OpKernelContext op_kernel_context(&frame, entry->kernel.get(), nullptr, logger_);
+  ORT_RETURN_IF_ERROR(entry->kernel->Compute(&op_kernel_context));
 
   return frame.GetOutputs(outputs);
 }
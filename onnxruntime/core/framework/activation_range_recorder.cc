@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/activation_range_recorder.h"
+
+#include <fstream>
+#include <iomanip>
+
+#include "core/framework/op_kernel.h"
+#include "core/framework/tensor.h"
+#include "core/graph/graph.h"
+
+namespace onnxruntime {
+
+static void AppendEscapedJsonString(const std::string& value, std::ostream& out) {
+  for (char c : value) {
+    if (c == '"' || c == '\\') {
+      out << '\\';
+    }
+    out << c;
+  }
+}
+
+void ActivationRangeRecorder::RecordNodeOutputs(OpKernelContext& context, const Node& node) {
+  const auto& output_defs = node.OutputDefs();
+
+  for (int i = 0, end = context.OutputCount(); i < end; ++i) {
+    if (!output_defs[i]->Exists()) {
+      continue;
+    }
+
+    const auto* type = context.OutputType(i);
+    if (type == nullptr || !type->IsTensorType()) {
+      continue;
+    }
+
+    const Tensor* tensor = context.Output<Tensor>(i);
+    if (tensor == nullptr || !tensor->IsDataType<float>() ||
+        tensor->Location().device.Type() != OrtDevice::CPU) {
+      continue;
+    }
+
+    const int64_t num_elements = tensor->Shape().Size();
+    if (num_elements == 0) {
+      continue;
+    }
+
+    const float* data = tensor->Data<float>();
+    float tensor_min = data[0];
+    float tensor_max = data[0];
+    for (int64_t j = 1; j < num_elements; ++j) {
+      tensor_min = std::min(tensor_min, data[j]);
+      tensor_max = std::max(tensor_max, data[j]);
+    }
+
+    std::lock_guard<OrtMutex> lock(mutex_);
+    auto result = ranges_.emplace(output_defs[i]->Name(), TensorRange{tensor_min, tensor_max});
+    if (!result.second) {
+      TensorRange& range = result.first->second;
+      range.min = std::min(range.min, tensor_min);
+      range.max = std::max(range.max, tensor_max);
+    }
+  }
+}
+
+common::Status ActivationRangeRecorder::OnRunEnd() {
+  // only the run that completes the configured count writes the file; later runs see IsActive()
+  // false at the call site and never get here
+  if (completed_runs_.fetch_add(1, std::memory_order_relaxed) + 1 != num_runs_) {
+    return Status::OK();
+  }
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  std::ofstream range_file(output_file_, std::ios::trunc);
+  ORT_RETURN_IF_NOT(range_file, "Failed to open activation range file for writing: ", output_file_);
+
+  range_file << std::setprecision(9) << "{\n";
+  bool first = true;
+  for (const auto& entry : ranges_) {
+    if (!first) {
+      range_file << ",\n";
+    }
+    first = false;
+    range_file << "  \"";
+    AppendEscapedJsonString(entry.first, range_file);
+    range_file << "\": [" << entry.second.min << ", " << entry.second.max << "]";
+  }
+  range_file << "\n}\n";
+
+  ORT_RETURN_IF_NOT(range_file.good(), "Failed to write activation range file: ", output_file_);
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <unordered_map>
+
+#include "core/common/common.h"
+#include "core/common/status.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+class Node;
+class OpKernelContext;
+
+// Records running per-tensor min/max of float activations over the first N runs of a session, then
+// writes the collected ranges to a JSON file. The ranges substitute for an offline calibration step:
+// the file can be fed to the static quantization tooling to produce an int8 QDQ model from
+// production traffic, after which the service reloads the quantized model.
+//
+// Enabled via kOrtSessionOptionsConfigActivationRangeTrackingRuns; recording stops (and the cost
+// drops to one atomic load per node) once the configured number of runs has completed.
+class ActivationRangeRecorder {
+ public:
+  ActivationRangeRecorder(size_t num_runs, std::string output_file)
+      : num_runs_(num_runs), output_file_(std::move(output_file)) {}
+
+  // false once the configured number of runs has completed and the ranges have been written
+  bool IsActive() const {
+    return completed_runs_.load(std::memory_order_relaxed) < num_runs_;
+  }
+
+  // updates the running ranges with the float CPU outputs of the node that just executed
+  void RecordNodeOutputs(OpKernelContext& context, const Node& node);
+
+  // called after each top level run. The run that completes the configured count writes the
+  // range file.
+  common::Status OnRunEnd();
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ActivationRangeRecorder);
+
+  struct TensorRange {
+    float min;
+    float max;
+  };
+
+  const size_t num_runs_;
+  const std::string output_file_;
+  std::atomic<size_t> completed_runs_{0};
+
+  OrtMutex mutex_;
+  std::unordered_map<std::string, TensorRange> ranges_;
+};
+
+}  // namespace onnxruntime
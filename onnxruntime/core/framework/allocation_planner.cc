@@ -359,6 +359,32 @@ class PlannerImpl {
     return false;
   }
 
+  // Find if output_arg_num-th output of the node is declared as a pure alias of one of its inputs
+  // via Alias in the kernel def (as opposed to MayInplace, which implies a real computation).
+  // Such kernels (e.g. Reshape/Identity/Squeeze) only copy the input when the two buffers differ.
+  bool FindAliasedInput(const onnxruntime::Node& node, int output_arg_num, OrtValueIndex* aliased_input) {
+    const KernelCreateInfo& ci = GetKernelCreateInfo(kernel_create_info_map_, node.Index());
+
+    if (ci.kernel_def == nullptr) {
+      return false;
+    }
+
+    auto input_args = node.InputDefs();
+    for (auto pair : ci.kernel_def->Alias()) {
+      if (pair.second == output_arg_num) {
+        if ((0 <= pair.first) && (static_cast<size_t>(pair.first) < input_args.size())) {
+          auto p_input_arg = input_args[pair.first];
+          if (p_input_arg->Exists()) {
+            *aliased_input = Index(p_input_arg->Name());
+            return true;
+          }
+        }
+      }
+    }
+
+    return false;
+  }
+
   static bool SameShape(const TensorShapeProto& shape1, const TensorShapeProto& shape2) {
     // TODO: This should probably be defined to be the equality operator on TensorShapeProto.
     namespace on = ONNX_NAMESPACE;
@@ -869,6 +895,28 @@ class PlannerImpl {
               }
             }
           }
+
+          // A pure aliasing kernel producing a graph output cannot alias here, so its Compute has
+          // to copy the aliased input into the separately allocated output buffer. When that input
+          // is a single-use CPU intermediate in the same location, plan the input to borrow the
+          // output's buffer instead: the producer then writes straight into the output buffer (the
+          // user-provided buffer when the output was pre-bound via IOBinding), and the aliasing
+          // kernel's copy short-circuits to a no-op as source and target match.
+          OrtValueIndex aliased_input;
+          if (!context_.IsParallelExecutionEnabled() &&
+              AllocPlan(current).alloc_kind == AllocKind::kAllocateOutput &&
+              FindAliasedInput(*pnode, static_cast<int>(output_arg_def_index), &aliased_input) &&
+              AllocPlan(aliased_input).alloc_kind == AllocKind::kAllocate &&
+              Buffer(aliased_input) == aliased_input &&
+              1 == UseCount(aliased_input) &&
+              AllocPlan(aliased_input).location == AllocPlan(current).location &&
+              AllocPlan(current).location.device.Type() == OrtDevice::CPU) {
+            Reuse(current, aliased_input, AllocKind::kReuse);
+            AllocPlan(current).reused_by_aliased_input = true;
+#if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
+            InplaceReuse(current, aliased_input);
+#endif
+          }
         } else if (IsNonTensor(*node_output)) {
           // we do not try sharing-optimization for non-tensors
           AllocPlan(current).alloc_kind = AllocKind::kAllocate;
@@ -5,6 +5,7 @@
 #include "core/framework/bfc_arena.h"
 #include "core/framework/mimalloc_allocator.h"
 #include "core/common/logging/logging.h"
+#include "core/platform/env.h"
 #include <mutex>
 #include <sstream>
 #include <unordered_map>
@@ -52,13 +53,25 @@ AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
     return std::shared_ptr<IAllocator>(
         std::make_unique<MiMallocAllocator>(max_mem));
 #else
+    if (info.arena_cfg.numa_aware != 0 && Env::Default().GetNumNumaNodes() > 1) {
+      return std::shared_ptr<IAllocator>(
+          std::make_unique<NumaAwareArena>([&info]() { return info.device_alloc_factory(info.device_id); },
+                                           max_mem,
+                                           arena_extend_str,
+                                           initial_chunk_size_bytes,
+                                           max_dead_bytes_per_chunk,
+                                           initial_growth_chunk_size_bytes,
+                                           info.arena_cfg.huge_page_threshold_bytes));
+    }
+
     return std::shared_ptr<IAllocator>(
         std::make_unique<BFCArena>(std::move(device_allocator),
                                    max_mem,
                                    arena_extend_str,
                                    initial_chunk_size_bytes,
                                    max_dead_bytes_per_chunk,
-                                   initial_growth_chunk_size_bytes));
+                                   initial_growth_chunk_size_bytes,
+                                   info.arena_cfg.huge_page_threshold_bytes));
 #endif
   }
 
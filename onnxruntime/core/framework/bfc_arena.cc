@@ -3,6 +3,8 @@
 
 #include "core/framework/allocator.h"
 #include "core/framework/bfc_arena.h"
+#include "core/platform/env.h"
+#include "core/platform/tracepoints.h"
 #include <type_traits>
 
 namespace onnxruntime {
@@ -11,7 +13,8 @@ BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
                    ArenaExtendStrategy arena_extend_strategy,
                    int initial_chunk_size_bytes,
                    int max_dead_bytes_per_chunk,
-                   int initial_growth_chunk_size_bytes)
+                   int initial_growth_chunk_size_bytes,
+                   size_t huge_page_threshold_bytes)
     : IAllocator(OrtMemoryInfo(resource_allocator->Info().name,
                                OrtAllocatorType::OrtArenaAllocator,
                                resource_allocator->Info().device,
@@ -22,7 +25,8 @@ BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
       next_allocation_id_(1),
       initial_chunk_size_bytes_(initial_chunk_size_bytes),
       max_dead_bytes_per_chunk_(max_dead_bytes_per_chunk),
-      initial_growth_chunk_size_bytes_(initial_growth_chunk_size_bytes) {
+      initial_growth_chunk_size_bytes_(initial_growth_chunk_size_bytes),
+      huge_page_threshold_bytes_(huge_page_threshold_bytes) {
   LOGS_DEFAULT(INFO) << "Creating BFCArena for " << device_allocator_->Info().name
                      << " with following configs: initial_chunk_size_bytes: " << initial_chunk_size_bytes_
                      << " max_dead_bytes_per_chunk: " << max_dead_bytes_per_chunk_
@@ -183,11 +187,18 @@ Status BFCArena::Extend(size_t rounded_bytes) {
                            "Failed to allocate memory for requested buffer of size ", rounded_bytes);
   }
 
+  if (huge_page_threshold_bytes_ > 0 && bytes >= huge_page_threshold_bytes_) {
+    // region stays mapped until the arena shrinks or is destroyed, so the one-off advice pays
+    // for itself over every chunk carved out of it.
+    Env::Default().AdviseHugePages(mem_addr, bytes);
+  }
+
   LOGS_DEFAULT(INFO) << "Extended allocation by " << bytes << " bytes.";
 
   stats_.total_allocated_bytes += bytes;
   LOGS_DEFAULT(INFO) << "Total allocated bytes: "
                      << stats_.total_allocated_bytes;
+  ORT_TRACEPOINT_ARENA_EXTEND(Info().name, bytes, stats_.total_allocated_bytes);
 
   LOGS_DEFAULT(INFO) << "Allocated memory at " << mem_addr << " to "
                      << static_cast<void*>(static_cast<char*>(mem_addr) + bytes);
@@ -256,6 +267,13 @@ void* BFCArena::Reserve(size_t size) {
   LOGS_DEFAULT(INFO) << "Reserving memory in BFCArena for " << device_allocator_->Info().name << " size: " << size;
 
   void* ptr = device_allocator_->Alloc(size);
+
+  if (huge_page_threshold_bytes_ > 0 && size >= huge_page_threshold_bytes_ && ptr != nullptr) {
+    // reserved chunks back initializers and memory pattern buffers, which are exactly the
+    // long-lived large buffers that benefit from huge pages.
+    Env::Default().AdviseHugePages(ptr, size);
+  }
+
   ORT_ENFORCE(reserved_chunks_.find(ptr) == reserved_chunks_.end());
   reserved_chunks_.insert(std::pair<void*, size_t>(ptr, size));
   stats_.bytes_in_use += size;
@@ -434,6 +452,14 @@ void BFCArena::Free(void* p) {
 }
 
 Status BFCArena::Shrink() {
+  return FreeEmptyRegions(consider_first_allocation_region_for_shrinkage_);
+}
+
+Status BFCArena::Compact() {
+  return FreeEmptyRegions(true /*consider_first_allocation_region*/);
+}
+
+Status BFCArena::FreeEmptyRegions(bool consider_first_allocation_region) {
   std::lock_guard<OrtMutex> lock(lock_);
   auto num_regions = region_manager_.regions().size();
   std::vector<void*> region_ptrs;
@@ -442,7 +468,7 @@ Status BFCArena::Shrink() {
   region_sizes.reserve(num_regions);
 
   for (const auto& region : region_manager_.regions()) {
-    if (consider_first_allocation_region_for_shrinkage_ || region.id() != 0) {
+    if (consider_first_allocation_region || region.id() != 0) {
       region_ptrs.push_back(region.ptr());
       region_sizes.push_back(region.memory_size());
     }
@@ -715,4 +741,131 @@ void BFCArena::DumpMemoryLog(size_t num_bytes) {
   LOGS_DEFAULT(INFO) << "Stats: \n"
                      << stats_.DebugString();
 }
+
+bool BFCArena::OwnsAllocation(const void* p) {
+  std::lock_guard<OrtMutex> lock(lock_);
+
+  if (reserved_chunks_.find(const_cast<void*>(p)) != reserved_chunks_.end()) {
+    return true;
+  }
+
+  for (const auto& region : region_manager_.regions()) {
+    if (p >= region.ptr() && p < region.end_ptr()) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+NumaAwareArena::NumaAwareArena(const DeviceAllocatorFactory& device_allocator_factory,
+                               size_t total_memory,
+                               ArenaExtendStrategy arena_extend_strategy,
+                               int initial_chunk_size_bytes,
+                               int max_dead_bytes_per_chunk,
+                               int initial_growth_chunk_size_bytes,
+                               size_t huge_page_threshold_bytes)
+    : IAllocator([&device_allocator_factory]() {
+        auto device_allocator = device_allocator_factory();
+        return OrtMemoryInfo(device_allocator->Info().name,
+                             OrtAllocatorType::OrtArenaAllocator,
+                             device_allocator->Info().device,
+                             device_allocator->Info().id,
+                             device_allocator->Info().mem_type);
+      }()) {
+  int num_nodes = Env::Default().GetNumNumaNodes();
+  ORT_ENFORCE(num_nodes >= 1, "Invalid NUMA node count: ", num_nodes);
+
+  LOGS_DEFAULT(INFO) << "Creating NumaAwareArena with " << num_nodes << " sub-arena(s)";
+
+  sub_arenas_.reserve(num_nodes);
+  for (int node = 0; node < num_nodes; ++node) {
+    sub_arenas_.push_back(std::make_unique<BFCArena>(device_allocator_factory(),
+                                                     total_memory,
+                                                     arena_extend_strategy,
+                                                     initial_chunk_size_bytes,
+                                                     max_dead_bytes_per_chunk,
+                                                     initial_growth_chunk_size_bytes,
+                                                     huge_page_threshold_bytes));
+  }
+}
+
+BFCArena& NumaAwareArena::ArenaForCurrentThread() const {
+  size_t node = static_cast<size_t>(Env::Default().GetCurrentNumaNode());
+  // a thread may report a node beyond what was seen at construction (e.g. hot-added nodes);
+  // fall back to node 0 rather than fail the allocation.
+  if (node >= sub_arenas_.size()) {
+    node = 0;
+  }
+  return *sub_arenas_[node];
+}
+
+void* NumaAwareArena::Alloc(size_t size) {
+  return ArenaForCurrentThread().Alloc(size);
+}
+
+void NumaAwareArena::Free(void* p) {
+  if (p == nullptr) {
+    return;
+  }
+
+  // the freeing thread is not necessarily on the node that allocated, so locate the owning
+  // sub-arena. the arena count is tiny (one per node) so a linear scan is fine.
+  for (auto& arena : sub_arenas_) {
+    if (arena->OwnsAllocation(p)) {
+      arena->Free(p);
+      return;
+    }
+  }
+
+  ORT_THROW("NumaAwareArena::Free: ", p, " was not allocated by any sub-arena.");
+}
+
+void* NumaAwareArena::Reserve(size_t size) {
+  return ArenaForCurrentThread().Reserve(size);
+}
+
+Status NumaAwareArena::Shrink() {
+  Status status = Status::OK();
+  for (auto& arena : sub_arenas_) {
+    auto arena_status = arena->Shrink();
+    if (!arena_status.IsOK() && status.IsOK()) {
+      status = arena_status;
+    }
+  }
+  return status;
+}
+
+Status NumaAwareArena::Compact() {
+  Status status = Status::OK();
+  for (auto& arena : sub_arenas_) {
+    auto arena_status = arena->Compact();
+    if (!arena_status.IsOK() && status.IsOK()) {
+      status = arena_status;
+    }
+  }
+  return status;
+}
+
+void NumaAwareArena::GetStats(AllocatorStats* stats) {
+  stats->Clear();
+  AllocatorStats arena_stats;
+  for (auto& arena : sub_arenas_) {
+    arena->GetStats(&arena_stats);
+    stats->num_allocs += arena_stats.num_allocs;
+    stats->num_reserves += arena_stats.num_reserves;
+    stats->num_arena_extensions += arena_stats.num_arena_extensions;
+    stats->num_arena_shrinkages += arena_stats.num_arena_shrinkages;
+    stats->bytes_in_use += arena_stats.bytes_in_use;
+    stats->total_allocated_bytes += arena_stats.total_allocated_bytes;
+    stats->max_bytes_in_use += arena_stats.max_bytes_in_use;
+    stats->max_alloc_size = std::max(stats->max_alloc_size, arena_stats.max_alloc_size);
+    stats->bytes_limit += arena_stats.bytes_limit;
+  }
+}
+
+FencePtr NumaAwareArena::CreateFence(const SessionState* session_state) {
+  // all sub-arenas share the same device allocator type, so any of them can create the fence
+  return sub_arenas_[0]->CreateFence(session_state);
+}
 }  // namespace onnxruntime
\ No newline at end of file
@@ -63,7 +63,8 @@ class BFCArena : public IAllocator {
            ArenaExtendStrategy arena_extend_strategy = DEFAULT_ARENA_EXTEND_STRATEGY,
            int initial_chunk_size_bytes = DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
            int max_dead_bytes_per_chunk = DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
-           int initial_growth_chunk_size_bytes = DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES);
+           int initial_growth_chunk_size_bytes = DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES,
+           size_t huge_page_threshold_bytes = 0);
 
   ~BFCArena() override;
 
@@ -81,10 +82,21 @@ class BFCArena : public IAllocator {
   // `initial_growth_chunk_size_bytes_` but ultimately all
   // future allocation sizes are determined by the arena growth strategy
   // and the allocation request.
-  Status Shrink();
+  Status Shrink() override;
+
+  // A stronger form of Shrink() meant for explicit maintenance passes between requests:
+  // every allocation region in which no chunk is in use is returned to the system,
+  // including the initial region that Shrink() exempts under kNextPowerOfTwo.
+  // Free chunks are already coalesced eagerly on Free(), so after this call the arena
+  // holds only regions that still contain live allocations.
+  // Safe to call concurrently with Alloc()/Free() from other threads.
+  Status Compact() override;
 
   void* Reserve(size_t size) override;
 
+  // Returns true if 'p' was handed out by this arena (either from a chunk or via Reserve()).
+  bool OwnsAllocation(const void* p);
+
   FencePtr CreateFence(const SessionState* session_state) override {
     // arena always rely on its device allocator to create fence
     return device_allocator_->CreateFence(session_state);
@@ -100,6 +112,11 @@ class BFCArena : public IAllocator {
   void* AllocateRawInternal(size_t num_bytes, bool dump_log_on_failure);
   void DeallocateRawInternal(void* ptr);
 
+  // Shared implementation of Shrink()/Compact(). Frees every allocation region in which
+  // no chunk is in use; the first allocation region is only considered when
+  // `consider_first_allocation_region` is true.
+  Status FreeEmptyRegions(bool consider_first_allocation_region);
+
   // A ChunkHandle is an index into the chunks_ vector in BFCAllocator
   // kInvalidChunkHandle means an invalid chunk
   using ChunkHandle = size_t;
@@ -469,6 +486,10 @@ class BFCArena : public IAllocator {
   const int max_dead_bytes_per_chunk_;
   const int initial_growth_chunk_size_bytes_;
 
+  // allocations from the device allocator of at least this size are advised to use huge pages.
+  // 0 disables the advice.
+  const size_t huge_page_threshold_bytes_;
+
   // This flag is only relevant if Shrink() is invoked.
   // This is a boolean flag that controls whether the first allocation region
   // is to be considered for shrinkage or not.
@@ -476,6 +497,51 @@ class BFCArena : public IAllocator {
 
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(BFCArena);
 };
+
+// An arena that maintains one BFCArena per NUMA node and routes each allocation to the sub-arena
+// of the node the calling thread is currently running on. A sub-arena's chunks are requested from
+// the device allocator and first touched by the threads running on its own node, so with the
+// operating system's default first-touch page placement policy each sub-arena's memory ends up
+// resident on that node and kernels read their inputs locally instead of across the interconnect.
+// Enabled via OrtArenaCfg::numa_aware; machines with a single node get a plain BFCArena instead.
+class NumaAwareArena : public IAllocator {
+ public:
+  using DeviceAllocatorFactory = std::function<std::unique_ptr<IAllocator>()>;
+
+  NumaAwareArena(const DeviceAllocatorFactory& device_allocator_factory,
+                 size_t total_memory,
+                 ArenaExtendStrategy arena_extend_strategy = BFCArena::DEFAULT_ARENA_EXTEND_STRATEGY,
+                 int initial_chunk_size_bytes = BFCArena::DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
+                 int max_dead_bytes_per_chunk = BFCArena::DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
+                 int initial_growth_chunk_size_bytes = BFCArena::DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES,
+                 size_t huge_page_threshold_bytes = 0);
+
+  void* Alloc(size_t size) override;
+
+  void Free(void* p) override;
+
+  void* Reserve(size_t size) override;
+
+  // Shrinks every sub-arena. Returns the first error encountered, if any.
+  Status Shrink() override;
+
+  // Compacts every sub-arena. Returns the first error encountered, if any.
+  Status Compact() override;
+
+  // Aggregates the stats of all sub-arenas.
+  void GetStats(AllocatorStats* stats) override;
+
+  FencePtr CreateFence(const SessionState* session_state) override;
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(NumaAwareArena);
+
+  // The sub-arena serving the NUMA node the calling thread currently runs on.
+  BFCArena& ArenaForCurrentThread() const;
+
+  std::vector<std::unique_ptr<BFCArena>> sub_arenas_;
+};
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
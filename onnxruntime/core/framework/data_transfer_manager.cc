@@ -118,15 +118,37 @@ common::Status DataTransferManager::CopyTensors(const std::vector<IDataTransfer:
     return first_dt->CopyTensors(src_dst_pairs);
   }
 
-  // there are a mix of devices requiring copies. we don't expect this to happen, so just iterate the pairs
-  // copying one at a time. if this becomes expected we could create a list for each IDataTransfer instance so we
-  // batch as much as possible.
+  // there are a mix of devices requiring copies. group the pairs by the IDataTransfer instance that
+  // handles them, preserving their relative order, so each instance still receives one batched call
+  // and can overlap its copies instead of synchronizing per tensor.
+  std::vector<std::pair<const IDataTransfer*, std::vector<IDataTransfer::SrcDstPair>>> batches;
+
+  for (const auto& pair : src_dst_pairs) {
+    const OrtDevice& pair_src_device = pair.src.get().Location().device;
+    const OrtDevice& pair_dst_device = pair.dst.get().Location().device;
+
+    const IDataTransfer* data_transfer = GetDataTransfer(pair_src_device, pair_dst_device);
+    if (data_transfer == nullptr) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME,
+                             FAIL,
+                             "There's no data transfer registered for copying tensors from ",
+                             pair_src_device.ToString(),
+                             " to ",
+                             pair_dst_device.ToString());
+    }
+
+    auto batch = std::find_if(batches.begin(), batches.end(),
+                              [data_transfer](const auto& entry) { return entry.first == data_transfer; });
+    if (batch == batches.end()) {
+      batches.push_back({data_transfer, {}});
+      batch = batches.end() - 1;
+    }
 
-  // copy the first one as we already did the IDataTransfer lookup
-  ORT_RETURN_IF_ERROR(first_dt->CopyTensor(first_pair.src.get(), first_pair.dst.get(), first_pair.exec_queue_id));
+    batch->second.push_back(pair);
+  }
 
-  for (auto cur_pair = src_dst_pairs.cbegin() + 1, end_pair = src_dst_pairs.cend(); cur_pair != end_pair; ++cur_pair) {
-    ORT_RETURN_IF_ERROR(CopyTensor(cur_pair->src, cur_pair->dst, cur_pair->exec_queue_id));
+  for (const auto& batch : batches) {
+    ORT_RETURN_IF_ERROR(batch.first->CopyTensors(batch.second));
   }
 
   return Status::OK();
@@ -170,15 +192,36 @@ common::Status DataTransferManager::CopySparseTensors(const std::vector<IDataTra
     return first_dt->CopySparseTensors(src_dst_pairs);
   }
 
-  // there are a mix of devices requiring copies. we don't expect this to happen, so just iterate the pairs
-  // copying one at a time. if this becomes expected we could create a list for each IDataTransfer instance so we
-  // batch as much as possible.
+  // there are a mix of devices requiring copies. group the pairs by the IDataTransfer instance that
+  // handles them, preserving their relative order, so each instance still receives one batched call.
+  std::vector<std::pair<const IDataTransfer*, std::vector<IDataTransfer::SparseSrcDstPair>>> batches;
+
+  for (const auto& pair : src_dst_pairs) {
+    const OrtDevice& pair_src_device = pair.src.get().Location().device;
+    const OrtDevice& pair_dst_device = pair.dst.get().Location().device;
+
+    const IDataTransfer* data_transfer = GetDataTransfer(pair_src_device, pair_dst_device);
+    if (data_transfer == nullptr) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME,
+                             FAIL,
+                             "There's no data transfer registered for copying tensors from ",
+                             pair_src_device.ToString(),
+                             " to ",
+                             pair_dst_device.ToString());
+    }
+
+    auto batch = std::find_if(batches.begin(), batches.end(),
+                              [data_transfer](const auto& entry) { return entry.first == data_transfer; });
+    if (batch == batches.end()) {
+      batches.push_back({data_transfer, {}});
+      batch = batches.end() - 1;
+    }
 
-  // copy the first one as we already did the IDataTransfer lookup
-  ORT_RETURN_IF_ERROR(first_pair.src.get().Copy(*first_dt, first_pair.dst, first_pair.exec_queue_id));
+    batch->second.push_back(pair);
+  }
 
-  for (auto cur_pair = src_dst_pairs.cbegin() + 1, end_pair = src_dst_pairs.cend(); cur_pair != end_pair; ++cur_pair) {
-    ORT_RETURN_IF_ERROR(CopySparseTensor(cur_pair->src, cur_pair->dst, cur_pair->exec_queue_id));
+  for (const auto& batch : batches) {
+    ORT_RETURN_IF_ERROR(batch.first->CopySparseTensors(batch.second));
   }
 
   return Status::OK();
@@ -13,6 +13,7 @@
 #include "core/framework/sparse_utils.h"
 #include "core/framework/node_index_info.h"
 #include "core/framework/op_kernel.h"
+#include "core/framework/scratch_buffer_allocator.h"
 #include "core/framework/session_state.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/utils.h"
@@ -148,7 +149,15 @@ Status IExecutionFrame::GetOrCreateNodeOutputMLValue(const int output_index, int
     if (p_ort_value->IsAllocated()) {
       // already allocated. verify shape matches if tensor.
       if (p_ort_value->IsTensor()) {
-        const Tensor& tensor = p_ort_value->Get<Tensor>();
+        Tensor& tensor = *p_ort_value->GetMutable<Tensor>();
+
+        // a graph output buffer that was borrowed by an aliased input may still carry that input's
+        // shape. give it the requested shape now that the producing node claims the output.
+        if (shape != nullptr && IsReusedByAliasedInput(ort_value_idx) &&
+            tensor.Shape() != *shape && tensor.Shape().Size() == shape->Size()) {
+          tensor.Reshape(*shape);
+        }
+
         ORT_ENFORCE(shape && tensor.Shape() == *shape,
                     "OrtValue shape verification failed. Current shape:", tensor.Shape(),
                     " Requested shape:", shape ? shape->ToString() : "null");
@@ -219,6 +228,9 @@ void IExecutionFrame::Init(const std::vector<int>& feed_mlvalue_idxs, const std:
   AllocatorPtr cpu_allocator = GetAllocator(cpu_mem_info);
 
   // 1. resize the all_value_ vector
+  // clear first in case pooled storage was adopted; this value-initializes every entry while
+  // retaining any previously allocated capacity
+  all_values_.clear();
   all_values_.resize(all_values_size_);
 
   // 2. Handle non-empty output vector
@@ -323,6 +335,17 @@ bool IExecutionFrame::IsOutput(int ort_value_idx) const {
   return std::find(fetch_mlvalue_idxs_.begin(), fetch_mlvalue_idxs_.end(), ort_value_idx) != fetch_mlvalue_idxs_.end();
 }
 
+void IExecutionFrame::AdoptValueBuffer(std::vector<OrtValue>&& buffer) {
+  all_values_ = std::move(buffer);
+}
+
+std::vector<OrtValue> IExecutionFrame::ReleaseValueBuffer() {
+  // drop all value references now so tensors are freed at the end of the run, not when the
+  // pooled buffer is eventually reused
+  all_values_.clear();
+  return std::move(all_values_);
+}
+
 ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds,
                                const std::vector<int>& fetch_mlvalue_idxs, const std::vector<OrtValue>& fetches,
                                const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators,
@@ -331,6 +354,19 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
       session_state_(session_state),
       mem_patterns_(nullptr),
       planner_(nullptr) {
+  // reuse pooled value table storage from a previous run of this graph if available
+  AdoptValueBuffer(session_state.GetOrtValueBufferFromPool());
+
+  // nullptr unless the per-Run scratch arena option is enabled for the session
+  scratch_buffer_allocator_ = session_state.AcquireScratchBufferAllocator();
+
+  // non-empty only while progressive initializer loading is in flight. the snapshot is taken
+  // before Init so an initializer that arrives in between is present in both places, which is
+  // benign: the back-fill in WaitForPendingInitializers re-assigns the same value.
+  pending_initializers_ = session_state.SnapshotPendingInitializers();
+
+  // the lock is unowned unless the background loader may be mutating the initializer map
+  auto initializers_lock = session_state.AcquireInitializedTensorsLock();
   Init(
       feed_mlvalue_idxs, feeds, session_state.GetInitializedTensors(),
 #if !defined(DISABLE_SPARSE_TENSORS)
@@ -348,6 +384,10 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
 #endif
       fetches);
 
+  if (initializers_lock.owns_lock()) {
+    initializers_lock.unlock();
+  }
+
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   MemoryInfo::IncreaseIteration();
 #endif
@@ -396,42 +436,53 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
           if (mem_patterns_->patterns[i].PeakSize() > 0) {
             AllocatorPtr alloc = GetAllocator(location);
             void* buffer = nullptr;
-            // it's possible we can't allocate the large block. if we have memory patterns we know we have successfully
-            // executed once before, so if there's an arena involved it probably has smaller blocks available.
-            // due to that we can still run and use those blocks (inside the arena logic) instead of one large one.
-            // it's less efficient (the arena will add some overhead to coalesce individual allocations
-            // back into blocks on 'free'), but better than failing completely.
-            ORT_TRY {
-              auto peak_size = mem_patterns_->patterns[i].PeakSize();
-              // Planning of one memory type should only happen once.
+            const auto peak_size = mem_patterns_->patterns[i].PeakSize();
+
+            // Planning of one memory type should only happen once.
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
-              ORT_ENFORCE(
-                  static_activation_memory_sizes_in_byte_.find(location.name) ==
-                      static_activation_memory_sizes_in_byte_.end(),
-                  "Memory type ",
-                  location.name,
-                  " should only appear once.");
-              // static_activation_memory_in_bytes_ is max virtual memory size the planner computes.
-              // Memory dynamically allocated when executing kernels is not recorded using this field.
-              static_activation_memory_sizes_in_byte_[location.name] = peak_size;
+            ORT_ENFORCE(
+                static_activation_memory_sizes_in_byte_.find(location.name) ==
+                    static_activation_memory_sizes_in_byte_.end(),
+                "Memory type ",
+                location.name,
+                " should only appear once.");
+            // static_activation_memory_in_bytes_ is max virtual memory size the planner computes.
+            // Memory dynamically allocated when executing kernels is not recorded using this field.
+            static_activation_memory_sizes_in_byte_[location.name] = peak_size;
 #endif
-              buffer = alloc->Alloc(peak_size);
-              // handle allocator that doesn't throw
-              if (buffer == nullptr) {
-                // INFO level as this may fire on every run and there may not be much a user can do
-                LOGS(session_state_.Logger(), INFO) << "Allocation of memory pattern buffer for "
-                                                    << location.ToString() << " returned nullptr";
+
+            // a completed frame for this graph may have returned a chunk of the same size to the
+            // pool. adopting it skips the allocator round trip, which matters most for control flow
+            // subgraphs where a frame is created per Loop iteration.
+            BufferUniquePtr pooled_buffer = session_state.AcquirePatternBuffer(location, peak_size);
+            if (pooled_buffer) {
+              buffer = pooled_buffer.get();
+              buffers_[location] = std::move(pooled_buffer);
+            } else {
+              // it's possible we can't allocate the large block. if we have memory patterns we know we have successfully
+              // executed once before, so if there's an arena involved it probably has smaller blocks available.
+              // due to that we can still run and use those blocks (inside the arena logic) instead of one large one.
+              // it's less efficient (the arena will add some overhead to coalesce individual allocations
+              // back into blocks on 'free'), but better than failing completely.
+              ORT_TRY {
+                buffer = alloc->Alloc(peak_size);
+                // handle allocator that doesn't throw
+                if (buffer == nullptr) {
+                  // INFO level as this may fire on every run and there may not be much a user can do
+                  LOGS(session_state_.Logger(), INFO) << "Allocation of memory pattern buffer for "
+                                                      << location.ToString() << " returned nullptr";
+                }
+              }
+              ORT_CATCH(const OnnxRuntimeException& ex) {
+                ORT_HANDLE_EXCEPTION([&]() {
+                  LOGS(session_state_.Logger(), INFO) << "Allocation of memory pattern buffer for "
+                                                      << location.ToString() << " failed. Error:" << ex.what();
+                });
               }
-            }
-            ORT_CATCH(const OnnxRuntimeException& ex) {
-              ORT_HANDLE_EXCEPTION([&]() {
-                LOGS(session_state_.Logger(), INFO) << "Allocation of memory pattern buffer for "
-                                                    << location.ToString() << " failed. Error:" << ex.what();
-              });
-            }
 
-            if (buffer != nullptr) {
-              buffers_[location] = BufferUniquePtr(buffer, alloc);
+              if (buffer != nullptr) {
+                buffers_[location] = BufferUniquePtr(buffer, alloc);
+              }
             }
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
             //Record activation memory pattern
@@ -451,7 +502,66 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
   }
 }
 
-ExecutionFrame::~ExecutionFrame() = default;
+ExecutionFrame::~ExecutionFrame() {
+  session_state_.ReturnOrtValueBufferToPool(ReleaseValueBuffer());
+
+  // recycle the memory pattern chunks so the next frame for this graph starts with them.
+  // all values pointing into the chunks were just released with the value table.
+  if (mem_patterns_) {
+    for (auto& entry : buffers_) {
+      const MemoryPattern* pattern = mem_patterns_->GetPatterns(entry.first);
+      if (pattern) {
+        session_state_.ReturnPatternBuffer(entry.first, pattern->PeakSize(), std::move(entry.second));
+      }
+    }
+    buffers_.clear();
+  }
+
+  if (scratch_buffer_allocator_) {
+    // no kernel is in flight anymore, so all scratch memory can be reclaimed with one reset
+    session_state_.ReturnScratchBufferAllocator(std::move(scratch_buffer_allocator_));
+  }
+}
+
+AllocatorPtr ExecutionFrame::GetScratchBufferAllocator() const {
+  return scratch_buffer_allocator_;
+}
+
+Status ExecutionFrame::WaitForPendingInitializers(const Node& node) {
+  ORT_RETURN_IF_ERROR(session_state_.WaitForNodeInitializers(node));
+
+  // back-fill the value table entries for the node's inputs that were missing when the frame was
+  // created. only initializer indexes can be in the pending set, so other inputs are skipped.
+  auto backfill = [this](const NodeArg* def) -> Status {
+    int idx = -1;
+    if (def->Name().empty() ||
+        !session_state_.GetOrtValueNameIdxMap().GetIdx(def->Name(), idx).IsOK()) {
+      return Status::OK();
+    }
+
+    auto it = pending_initializers_.find(idx);
+    if (it == pending_initializers_.end()) {
+      return Status::OK();
+    }
+
+    OrtValue value;
+    ORT_RETURN_IF_NOT(session_state_.GetProgressivelyLoadedInitializer(idx, value),
+                      "Initializer for '", def->Name(), "' was not materialized by the background loader.");
+    GetMutableMLValue(idx) = value;
+    pending_initializers_.erase(it);
+
+    return Status::OK();
+  };
+
+  for (const NodeArg* def : node.InputDefs()) {
+    ORT_RETURN_IF_ERROR(backfill(def));
+  }
+  for (const NodeArg* def : node.ImplicitInputDefs()) {
+    ORT_RETURN_IF_ERROR(backfill(def));
+  }
+
+  return Status::OK();
+}
 
 Status ExecutionFrame::CopyTensor(const Tensor& src, Tensor& dest) const {
   return session_state_.GetDataTransferMgr().CopyTensor(src, dest);
@@ -514,8 +624,15 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
       if (block) {
         auto it = buffers_.find(location);
         if (it != buffers_.end()) {
+          // a bucketed pattern is traced at whatever shapes the first run in the bucket used, so a
+          // smaller tensor may land in a larger block. the unused tail of the block is padding
+          // inside the big chunk; blocks never overlap so using a prefix of one is safe.
+          const bool block_usable =
+              block->size_ == size ||
+              (session_state_.GetMemoryPatternBucketGranularity() > 0 && block->size_ > size);
+
           // if the block is not correct, log message then fall back to default behavior
-          if (block->size_ == size) {
+          if (block_usable) {
             void* buffer = it->second.get();
             auto status = AllocateTensorWithPreAllocateBufferHelper(
                 ort_value, static_cast<void*>(static_cast<char*>(buffer) + block->offset_), element_type, location,
@@ -779,6 +896,13 @@ Status ExecutionFrame::ReleaseMLValueImpl(int ort_value_idx) {
   return Status::OK();
 }
 
+bool ExecutionFrame::IsReusedByAliasedInput(int ort_value_idx) const {
+  const SequentialExecutionPlan* p_seq_exec_plan = session_state_.GetExecutionPlan();
+  const auto& alloc_plan = p_seq_exec_plan->allocation_plan;
+  ORT_ENFORCE(ort_value_idx >= 0 && static_cast<size_t>(ort_value_idx) < alloc_plan.size());
+  return alloc_plan[ort_value_idx].reused_by_aliased_input;
+}
+
 const AllocPlanPerValue& ExecutionFrame::GetAllocationPlan(int ort_value_idx) {
   const SequentialExecutionPlan* p_seq_exec_plan = session_state_.GetExecutionPlan();
   const auto& alloc_plan = p_seq_exec_plan->allocation_plan;
@@ -848,10 +972,12 @@ bool ExecutionFrame::TryGetInferredShape(int index, TensorShape& shape) const {
 
   // Search for inferred shape.
   // If inferred shape is found, it's assigned to "shape" so that caller can use it.
-  auto it = inferred_shapes_.find(ort_value_idx);
-  if (it != inferred_shapes_.end()) {
-    shape = it->second;
-    return true;
+  if (inferred_shapes_ != nullptr) {
+    auto it = inferred_shapes_->find(ort_value_idx);
+    if (it != inferred_shapes_->end()) {
+      shape = it->second;
+      return true;
+    }
   }
 
   // Tell the caller if the search is successful or not.
@@ -6,6 +6,7 @@
 #include <mutex>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
@@ -25,6 +26,7 @@ class OrtValueNameIdxMap;
 class OrtValuePatternPlanner;
 struct MemoryPatternGroup;
 class NodeIndexInfo;
+class ScratchBufferAllocator;
 
 class IExecutionFrame {
  protected:
@@ -79,6 +81,10 @@ class IExecutionFrame {
 
   AllocatorPtr GetAllocator(const OrtMemoryInfo& info) const;
 
+  // Allocator for kernel scratch memory that is reclaimed in one step when the frame completes.
+  // nullptr if the frame doesn't provide one; callers fall back to the regular allocator.
+  virtual AllocatorPtr GetScratchBufferAllocator() const { return nullptr; }
+
   Status ReleaseMLValue(int ort_value_idx);
 
  protected:
@@ -92,6 +98,14 @@ class IExecutionFrame {
   // returns true if the ort_value_idx is an output from the graph
   bool IsOutput(int ort_value_idx) const;
 
+  // adopt pooled storage for the value table so its capacity is reused across frames.
+  // must be called before Init.
+  void AdoptValueBuffer(std::vector<OrtValue>&& buffer);
+
+  // release the value table storage. entries are cleared but capacity is retained so the
+  // buffer can be returned to a pool.
+  std::vector<OrtValue> ReleaseValueBuffer();
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(IExecutionFrame);
 
@@ -104,6 +118,10 @@ class IExecutionFrame {
   // for the node.
   virtual void VerifyOutputSizes(int /*output_index*/, const Node& /*node*/, const TensorShape& /*output_shape*/) {}
 
+  // returns true if the buffer backing ort_value_idx may have been created with a different (same sized)
+  // shape than the one the producing node requests. See AllocPlanPerValue::reused_by_aliased_input.
+  virtual bool IsReusedByAliasedInput(int /*ort_value_idx*/) const { return false; }
+
   virtual AllocatorPtr GetAllocatorImpl(const OrtMemoryInfo& info) const = 0;
 
   virtual Status CreateNodeOutputMLValueImpl(OrtValue& ort_value, int ort_value_idx, const TensorShape* shape) = 0;
@@ -147,6 +165,15 @@ class ExecutionFrame final : public IExecutionFrame {
                                                 const OrtMemoryInfo& location, const TensorShape& shape,
                                                 bool create_fence = false);
 
+  // true if any initializer was still being loaded in the background when this frame was
+  // created (progressive initializer loading). The executor must then call
+  // WaitForPendingInitializers for each node before executing it.
+  bool HasPendingInitializers() const { return !pending_initializers_.empty(); }
+
+  // Blocks until the initializers consumed by 'node' are available and back-fills the
+  // corresponding value table entries that were missing when the frame was created.
+  Status WaitForPendingInitializers(const Node& node);
+
   // thread-safe
   Status GeneratePatterns(MemoryPatternGroup* out) const;
 
@@ -158,6 +185,8 @@ class ExecutionFrame final : public IExecutionFrame {
   // If the retrival is sucessful, this function returns true and false otherwise.
   bool TryGetInferredShape(int index, TensorShape& shape) const override;
 
+  AllocatorPtr GetScratchBufferAllocator() const override;
+
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Return the size of virtual memory allocated in runtime.
   // The memory is usually used for activations in forward and backward passes.
@@ -187,6 +216,7 @@ class ExecutionFrame final : public IExecutionFrame {
   Status ReleaseMLValueImpl(int ort_value_idx) override;
   Status CreateNodeOutputMLValueImpl(OrtValue& ort_value, int ort_value_idx, const TensorShape* shape) override;
   void VerifyOutputSizes(int output_index, const Node& node, const TensorShape& output_shape) override;
+  bool IsReusedByAliasedInput(int ort_value_idx) const override;
   Status CopyTensor(const Tensor& src, Tensor& dest) const override;
   const DataTransferManager& GetDataTransferManager() const override;
 
@@ -206,6 +236,10 @@ class ExecutionFrame final : public IExecutionFrame {
 
   const SessionState& session_state_;
 
+  // ort value indexes of initializers that were still loading in the background when this frame
+  // was created. entries are back-filled and removed by WaitForPendingInitializers.
+  std::unordered_set<int> pending_initializers_;
+
   // map of index to custom allocator
   std::unordered_map<int, IExecutor::CustomAllocator> custom_allocators_;
 
@@ -221,11 +255,17 @@ class ExecutionFrame final : public IExecutionFrame {
   // Big chunks on different locations that will be used by mem_pattern.
   std::map<OrtMemoryInfo, BufferUniquePtr> buffers_;
 
+  // per-Run bump allocator handed to kernels for CPU scratch memory. acquired from the
+  // SessionState pool when the option is enabled; reset and returned in the destructor.
+  std::shared_ptr<ScratchBufferAllocator> scratch_buffer_allocator_;
+
   // Given the input shapes of the executed graph, ExecutionFrame tries inferring
-  // all symbolic shapes. inferred_shapes_[i] is the shape of OrtValue indexed
+  // all symbolic shapes. (*inferred_shapes_)[i] is the shape of OrtValue indexed
   // by i, if the key i exists.
-  // inferred_shapes_ is generated together with mem_patterns_.
-  std::unordered_map<int, TensorShape> inferred_shapes_;
+  // inferred_shapes_ points at the SessionState owned shape table cached together with
+  // mem_patterns_, so resolving a shape on later runs is a table lookup. nullptr if there is
+  // no cached pattern for the current input shapes.
+  const std::unordered_map<int, TensorShape>* inferred_shapes_{nullptr};
 
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Size of virtual memory allocated before any kernel execution.
@@ -0,0 +1,341 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/execution_plan_cache.h"
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include <fstream>
+
+#include "core/framework/allocator.h"
+#include "core/framework/data_types.h"
+#include "core/framework/ort_value_name_idx_map.h"
+#include "core/framework/session_state.h"
+#include "core/graph/graph_viewer.h"
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+#include "onnx/defs/data_type_utils.h"
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+namespace onnxruntime {
+namespace execution_plan_cache {
+
+namespace {
+
+// bumped whenever the layout below changes. an artifact with a different version is rejected and
+// the caller re-runs the planner, so no backwards compatibility logic is needed.
+constexpr uint64_t kPlanCacheMagic = 0x4e414c504554524fULL;  // "ORTEPLAN"
+constexpr uint32_t kPlanCacheVersion = 1;
+
+// strings in the artifact are type names and allocator names; anything larger means corruption.
+constexpr uint64_t kMaxStringLength = 4096;
+
+template <typename T>
+void WriteValue(std::ostream& out, const T& value) {
+  static_assert(std::is_trivially_copyable<T>::value, "WriteValue requires a trivially copyable type");
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool ReadValue(std::istream& in, T& value) {
+  static_assert(std::is_trivially_copyable<T>::value, "ReadValue requires a trivially copyable type");
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return static_cast<bool>(in);
+}
+
+void WriteString(std::ostream& out, const std::string& str) {
+  WriteValue(out, static_cast<uint64_t>(str.size()));
+  out.write(str.data(), str.size());
+}
+
+bool ReadString(std::istream& in, std::string& str) {
+  uint64_t length = 0;
+  if (!ReadValue(in, length) || length > kMaxStringLength) {
+    return false;
+  }
+
+  str.resize(static_cast<size_t>(length));
+  in.read(&str[0], length);
+  return static_cast<bool>(in);
+}
+
+void WriteIndexVector(std::ostream& out, const std::vector<OrtValueIndex>& values) {
+  WriteValue(out, static_cast<uint64_t>(values.size()));
+  for (OrtValueIndex value : values) {
+    WriteValue(out, static_cast<int64_t>(value));
+  }
+}
+
+bool ReadIndexVector(std::istream& in, size_t num_values, std::vector<OrtValueIndex>& values) {
+  uint64_t count = 0;
+  if (!ReadValue(in, count) || count > num_values) {
+    return false;
+  }
+
+  values.resize(static_cast<size_t>(count));
+  for (auto& value : values) {
+    int64_t raw = 0;
+    if (!ReadValue(in, raw) || raw < 0 || static_cast<uint64_t>(raw) >= num_values) {
+      return false;
+    }
+    value = static_cast<OrtValueIndex>(raw);
+  }
+
+  return true;
+}
+
+Status SerializeAllocPlan(std::ostream& out, const AllocPlanPerValue& alloc_plan) {
+  WriteValue(out, static_cast<int8_t>(alloc_plan.alloc_kind));
+
+  // the type registry is keyed by the ONNX type string, so that is what is persisted.
+  std::string type_str;
+  if (alloc_plan.value_type != nullptr) {
+    const auto* type_proto = alloc_plan.value_type->GetTypeProto();
+    ORT_RETURN_IF(type_proto == nullptr,
+                  "The execution plan contains a non-ONNX value type which cannot be serialized.");
+    type_str = *ONNX_NAMESPACE::Utils::DataTypeUtils::ToType(*type_proto);
+  }
+  WriteString(out, type_str);
+
+  const OrtMemoryInfo& location = alloc_plan.location;
+  ORT_RETURN_IF(location.name == nullptr, "The execution plan contains a location without a name.");
+  WriteString(out, location.name);
+  WriteValue(out, static_cast<int32_t>(location.id));
+  WriteValue(out, static_cast<int32_t>(location.mem_type));
+  WriteValue(out, static_cast<int32_t>(location.alloc_type));
+
+  WriteValue(out, static_cast<int64_t>(alloc_plan.reused_buffer));
+  WriteValue(out, static_cast<uint8_t>(alloc_plan.create_fence_if_async));
+  WriteValue(out, static_cast<uint8_t>(alloc_plan.reused_by_aliased_input));
+
+  const auto& starts = alloc_plan.program_counter.Starts();
+  const auto& ends = alloc_plan.program_counter.Ends();
+  ORT_RETURN_IF(starts.size() != ends.size(), "The execution plan contains an unterminated program counter entry.");
+  WriteValue(out, static_cast<uint64_t>(starts.size()));
+  for (size_t i = 0; i < starts.size(); ++i) {
+    WriteValue(out, static_cast<uint64_t>(starts[i]));
+    WriteValue(out, static_cast<uint64_t>(ends[i]));
+  }
+
+  return Status::OK();
+}
+
+bool DeserializeAllocPlan(std::istream& in, size_t num_values, const SessionState& session_state,
+                          AllocPlanPerValue& alloc_plan) {
+  int8_t alloc_kind = 0;
+  if (!ReadValue(in, alloc_kind) ||
+      alloc_kind < static_cast<int8_t>(AllocKind::kNotSet) ||
+      alloc_kind > static_cast<int8_t>(AllocKind::kAllocatedExternally)) {
+    return false;
+  }
+  alloc_plan.alloc_kind = static_cast<AllocKind>(alloc_kind);
+
+  std::string type_str;
+  if (!ReadString(in, type_str)) {
+    return false;
+  }
+
+  if (type_str.empty()) {
+    alloc_plan.value_type = nullptr;
+  } else {
+    alloc_plan.value_type = DataTypeImpl::GetDataType(type_str);
+    if (alloc_plan.value_type == nullptr) {
+      return false;
+    }
+  }
+
+  std::string location_name;
+  int32_t location_id = 0;
+  int32_t mem_type = 0;
+  int32_t alloc_type = 0;
+  if (!ReadString(in, location_name) || location_name.empty() ||
+      !ReadValue(in, location_id) || !ReadValue(in, mem_type) || !ReadValue(in, alloc_type)) {
+    return false;
+  }
+
+  // every location the planner assigns belongs to an allocator registered with the session, so
+  // resolve the serialized fields through the session to get back the canonical OrtMemoryInfo
+  // (whose name is a string with static storage duration). A location that no longer resolves
+  // means the artifact was produced with a different provider configuration.
+  const OrtMemoryInfo lookup_info(location_name.c_str(), static_cast<OrtAllocatorType>(alloc_type),
+                                  OrtDevice(), location_id, static_cast<OrtMemType>(mem_type));
+  AllocatorPtr allocator = session_state.GetAllocator(lookup_info);
+  if (allocator == nullptr) {
+    return false;
+  }
+  alloc_plan.location = allocator->Info();
+
+  int64_t reused_buffer = 0;
+  uint8_t create_fence_if_async = 0;
+  uint8_t reused_by_aliased_input = 0;
+  if (!ReadValue(in, reused_buffer) || reused_buffer < 0 || static_cast<uint64_t>(reused_buffer) >= num_values ||
+      !ReadValue(in, create_fence_if_async) || !ReadValue(in, reused_by_aliased_input)) {
+    return false;
+  }
+  alloc_plan.reused_buffer = static_cast<OrtValueIndex>(reused_buffer);
+  alloc_plan.create_fence_if_async = create_fence_if_async != 0;
+  alloc_plan.reused_by_aliased_input = reused_by_aliased_input != 0;
+
+  // no meaningful upper bound exists for the counter count; a corrupt value fails below when the
+  // stream runs out or the monotonicity check trips.
+  uint64_t num_counters = 0;
+  if (!ReadValue(in, num_counters)) {
+    return false;
+  }
+
+  uint64_t previous_end = 0;
+  for (uint64_t i = 0; i < num_counters; ++i) {
+    uint64_t start = 0;
+    uint64_t end = 0;
+    if (!ReadValue(in, start) || !ReadValue(in, end) || end < start || (i > 0 && start <= previous_end)) {
+      return false;  // AddStart/AddEnd would reject these, so validate up front instead of throwing
+    }
+    alloc_plan.program_counter.AddStart(static_cast<size_t>(start));
+    alloc_plan.program_counter.AddEnd(static_cast<size_t>(end));
+    previous_end = end;
+  }
+
+  return true;
+}
+
+}  // namespace
+
+Status SaveExecutionPlan(const std::basic_string<PATH_CHAR_TYPE>& path, const SequentialExecutionPlan& plan) {
+  std::ofstream out(path.c_str(), std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+  ORT_RETURN_IF_NOT(out, "Failed to open the execution plan cache artifact for writing: ", ToMBString(path));
+
+  WriteValue(out, kPlanCacheMagic);
+  WriteValue(out, kPlanCacheVersion);
+
+  WriteValue(out, static_cast<uint64_t>(plan.allocation_plan.size()));
+  for (const auto& alloc_plan : plan.allocation_plan) {
+    ORT_RETURN_IF_ERROR(SerializeAllocPlan(out, alloc_plan));
+  }
+
+  WriteIndexVector(out, plan.initializer_allocation_order);
+  WriteIndexVector(out, plan.activation_allocation_order);
+
+  WriteValue(out, static_cast<uint64_t>(plan.execution_plan.size()));
+  for (const auto& step : plan.execution_plan) {
+    WriteValue(out, static_cast<uint64_t>(step.node_index));
+    WriteValue(out, static_cast<int64_t>(step.free_from_index));
+    WriteValue(out, static_cast<int64_t>(step.free_to_index));
+  }
+
+  WriteValue(out, static_cast<uint64_t>(plan.node_has_fence.size()));
+  for (const bool has_fence : plan.node_has_fence) {
+    WriteValue(out, static_cast<uint8_t>(has_fence));
+  }
+
+  WriteIndexVector(out, plan.to_be_freed);
+
+  out.flush();
+  ORT_RETURN_IF_NOT(out, "Failed to write the execution plan cache artifact: ", ToMBString(path));
+
+  return Status::OK();
+}
+
+Status LoadExecutionPlan(const std::basic_string<PATH_CHAR_TYPE>& path,
+                         const GraphViewer& graph_viewer,
+                         const OrtValueNameIdxMap& ort_value_name_idx_map,
+                         const SessionState& session_state,
+                         SequentialExecutionPlan& plan) {
+  std::ifstream in(path.c_str(), std::ifstream::in | std::ifstream::binary);
+  ORT_RETURN_IF_NOT(in, "Failed to open the execution plan cache artifact: ", ToMBString(path));
+
+  const auto invalid_artifact = [&path](const char* reason) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Invalid execution plan cache artifact ", ToMBString(path),
+                           ": ", reason);
+  };
+
+  uint64_t magic = 0;
+  uint32_t version = 0;
+  if (!ReadValue(in, magic) || magic != kPlanCacheMagic || !ReadValue(in, version)) {
+    return invalid_artifact("unrecognized header");
+  }
+
+  if (version != kPlanCacheVersion) {
+    return invalid_artifact("version mismatch");
+  }
+
+  const size_t num_values = static_cast<size_t>(ort_value_name_idx_map.MaxIdx()) + 1;
+  uint64_t stored_num_values = 0;
+  if (!ReadValue(in, stored_num_values) || stored_num_values != num_values) {
+    return invalid_artifact("value count does not match the graph");
+  }
+
+  plan.allocation_plan.resize(num_values);
+  for (auto& alloc_plan : plan.allocation_plan) {
+    if (!DeserializeAllocPlan(in, num_values, session_state, alloc_plan)) {
+      return invalid_artifact("unusable allocation plan entry");
+    }
+  }
+
+  if (!ReadIndexVector(in, num_values, plan.initializer_allocation_order) ||
+      !ReadIndexVector(in, num_values, plan.activation_allocation_order)) {
+    return invalid_artifact("invalid allocation order");
+  }
+
+  uint64_t num_steps = 0;
+  if (!ReadValue(in, num_steps) || num_steps != static_cast<uint64_t>(graph_viewer.NumberOfNodes())) {
+    return invalid_artifact("node count does not match the graph");
+  }
+
+  plan.execution_plan.clear();
+  plan.execution_plan.reserve(static_cast<size_t>(num_steps));
+  for (uint64_t i = 0; i < num_steps; ++i) {
+    uint64_t node_index = 0;
+    int64_t free_from_index = 0;
+    int64_t free_to_index = 0;
+    if (!ReadValue(in, node_index) || !ReadValue(in, free_from_index) || !ReadValue(in, free_to_index) ||
+        graph_viewer.GetNode(static_cast<NodeIndex>(node_index)) == nullptr) {
+      return invalid_artifact("invalid execution step");
+    }
+
+    SequentialExecutionPlan::NodeExecutionPlan step(static_cast<NodeIndex>(node_index));
+    step.free_from_index = static_cast<int>(free_from_index);
+    step.free_to_index = static_cast<int>(free_to_index);
+    plan.execution_plan.push_back(step);
+  }
+
+  uint64_t num_fence_entries = 0;
+  if (!ReadValue(in, num_fence_entries) ||
+      num_fence_entries != static_cast<uint64_t>(graph_viewer.MaxNodeIndex())) {
+    return invalid_artifact("fence table does not match the graph");
+  }
+
+  plan.node_has_fence.resize(static_cast<size_t>(num_fence_entries));
+  for (size_t i = 0; i < plan.node_has_fence.size(); ++i) {
+    uint8_t has_fence = 0;
+    if (!ReadValue(in, has_fence)) {
+      return invalid_artifact("invalid fence table");
+    }
+    plan.node_has_fence[i] = has_fence != 0;
+  }
+
+  if (!ReadIndexVector(in, num_values, plan.to_be_freed)) {
+    return invalid_artifact("invalid free list");
+  }
+
+  // the free ranges of each step index into to_be_freed, so they can only be checked once both
+  // are loaded.
+  for (const auto& step : plan.execution_plan) {
+    if (step.free_from_index <= step.free_to_index &&
+        (step.free_from_index < 0 || static_cast<size_t>(step.free_to_index) >= plan.to_be_freed.size())) {
+      return invalid_artifact("execution step frees out of range values");
+    }
+  }
+
+  return Status::OK();
+}
+
+}  // namespace execution_plan_cache
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
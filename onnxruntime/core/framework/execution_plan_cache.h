@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include "core/common/common.h"
+#include "core/framework/sequential_execution_plan.h"
+#include "core/platform/path_lib.h"
+
+namespace onnxruntime {
+class GraphViewer;
+class OrtValueNameIdxMap;
+class SessionState;
+
+namespace execution_plan_cache {
+
+// Writes 'plan' to 'path' as a compact versioned binary artifact so a later session for the same
+// graph can skip the allocation planner. Fails if the plan contains a value type or location that
+// cannot be round-tripped; the caller is expected to treat a failed write as best effort.
+common::Status SaveExecutionPlan(const std::basic_string<PATH_CHAR_TYPE>& path,
+                                 const SequentialExecutionPlan& plan);
+
+// Populates 'plan' from the artifact at 'path'. The artifact is validated against the loaded
+// graph: the value count must match 'ort_value_name_idx_map', every recorded node must exist in
+// 'graph_viewer', every value type must be registered and every location must resolve to an
+// allocator registered with 'session_state'. Any mismatch fails the load so the caller can fall
+// back to running the planner.
+common::Status LoadExecutionPlan(const std::basic_string<PATH_CHAR_TYPE>& path,
+                                 const GraphViewer& graph_viewer,
+                                 const OrtValueNameIdxMap& ort_value_name_idx_map,
+                                 const SessionState& session_state,
+                                 SequentialExecutionPlan& plan);
+
+}  // namespace execution_plan_cache
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
@@ -8,6 +8,7 @@
 #include "onnx/defs/data_type_utils.h"
 
 #include "core/framework/op_kernel.h"
+#include "core/platform/env.h"
 
 using namespace ONNX_NAMESPACE::Utils;
 
@@ -16,6 +17,73 @@ namespace onnxruntime {
 namespace {
 const int64_t kSmallInitializerThreshold = 100;
 
+// Outputs larger than this are considered real data rather than shape computation, and the
+// producing node is kept on the target EP even if its inputs are CPU tensors. Shape calculation
+// chains produce rank-0/1 tensors orders of magnitude below this.
+const int64_t kCpuPreferredMaxOutputElements = 8192;
+
+// Environment variables holding comma separated node names that override the heuristics below:
+// nodes in the force list are always placed on CPU, nodes in the disable list never are.
+constexpr const char* kForceCpuFallbackNodesEnv = "ORT_FORCE_CPU_FALLBACK_NODES";
+constexpr const char* kDisableCpuFallbackNodesEnv = "ORT_DISABLE_CPU_FALLBACK_NODES";
+
+// Ops whose arithmetic cost grows with the data, so falling them back to CPU by topology alone
+// would forfeit a large device speedup. This is a coarse stand-in for a per-node FLOP estimate.
+static bool IsComputeIntensiveOp(const std::string& op_type) {
+  static const std::unordered_set<std::string> compute_intensive_ops{
+      "Conv", "ConvTranspose", "Gemm", "MatMul", "Einsum", "LSTM", "GRU", "RNN"};
+  return compute_intensive_ops.count(op_type) != 0;
+}
+
+// Largest fully known output element count of the node, or -1 when no output has a fully known
+// shape, in which case the size test is skipped rather than guessed.
+static int64_t MaxOutputElementCount(const Node& node) {
+  int64_t max_elements = -1;
+  for (const auto* def : node.OutputDefs()) {
+    if (def == nullptr || !def->Exists()) {
+      continue;
+    }
+
+    const auto* shape = def->Shape();
+    if (shape == nullptr) {
+      continue;
+    }
+
+    int64_t elements = 1;
+    bool known = true;
+    for (const auto& dim : shape->dim()) {
+      if (!dim.has_dim_value() || dim.dim_value() < 0) {
+        known = false;
+        break;
+      }
+      elements *= dim.dim_value();
+    }
+
+    if (known) {
+      max_elements = std::max(max_elements, elements);
+    }
+  }
+
+  return max_elements;
+}
+
+static std::unordered_set<std::string> ParseNodeListFromEnv(const char* env_var) {
+  std::unordered_set<std::string> node_names;
+  const std::string value = Env::Default().GetEnvironmentVar(env_var);
+  size_t start = 0;
+  while (start < value.size()) {
+    size_t end = value.find(',', start);
+    if (end == std::string::npos) {
+      end = value.size();
+    }
+    if (end > start) {
+      node_names.insert(value.substr(start, end - start));
+    }
+    start = end + 1;
+  }
+  return node_names;
+}
+
 static bool IsSmallInitializer(const onnxruntime::GraphViewer& graph, const NodeArg* arg) {
   // 'true' in the function call is to let the searching for the initializer
   // continue in the outer scopes of the current (sub-)graph if applicable
@@ -90,6 +158,20 @@ std::unordered_set<NodeIndex> GetCpuPreferredNodes(const onnxruntime::GraphViewe
         }));
   }
 
+  // Per-node overrides let users correct placement decisions without code changes; see the
+  // environment variable comments above.
+  const std::unordered_set<std::string> force_cpu_fallback_nodes = ParseNodeListFromEnv(kForceCpuFallbackNodesEnv);
+  const std::unordered_set<std::string> disable_cpu_fallback_nodes = ParseNodeListFromEnv(kDisableCpuFallbackNodesEnv);
+
+  if (!force_cpu_fallback_nodes.empty()) {
+    for (auto& node_id : tentative_nodes) {
+      const Node* node = graph.GetNode(node_id);
+      if (force_cpu_fallback_nodes.count(node->Name()) != 0) {
+        candidates.push(node_id);
+      }
+    }
+  }
+
   const std::vector<const NodeArg*>& graph_inputs = graph.GetInputs();
   std::unordered_set<NodeIndex> cpu_nodes;
   // The algo below is trying to identity a subgraph that only depends on cpu tensors.
@@ -109,32 +191,44 @@ std::unordered_set<NodeIndex> GetCpuPreferredNodes(const onnxruntime::GraphViewe
 
     auto* node = graph.GetNode(cur);
     bool place_in_cpu = true;
-    for (size_t i = 0; i < node->InputDefs().size(); ++i) {
-      auto* input = node->InputDefs()[i];
 
-      // skip placing on CPU if the data typs is float16 or bfloat16
-      if (input->Type() == DataTypeUtils::ToType("float16") ||
-          input->Type() == DataTypeUtils::ToType("bfloat16")) {
+    if (disable_cpu_fallback_nodes.count(node->Name()) != 0) {
+      place_in_cpu = false;
+    } else if (force_cpu_fallback_nodes.count(node->Name()) == 0) {
+      // topology says the node consumes CPU tensors, but only follow that when the compute and
+      // data sizes are small enough that the device speedup would not outweigh the saved copies
+      if (IsComputeIntensiveOp(node->OpType()) ||
+          MaxOutputElementCount(*node) > kCpuPreferredMaxOutputElements) {
         place_in_cpu = false;
-        break;
-      }
-
-      // allow placing on CPU if it's a small initializer or graph input
-      if (IsSmallInitializer(graph, input) ||
-          std::find(graph_inputs.begin(), graph_inputs.end(), input) != graph_inputs.end()) {
-        continue;
       }
 
-      // the input is not a CPU tensor
-      if (cpu_output_args.find(input) == cpu_output_args.end()) {
-        place_in_cpu = false;
-        break;
-      }
-
-      // input is a CPU tensor, but it's intended to be consumed as CPU input by the target EP
-      if (node_to_kernel[cur]->kernel_def->IsInputOnCpu(i)) {
-        place_in_cpu = false;
-        break;
+      for (size_t i = 0; place_in_cpu && i < node->InputDefs().size(); ++i) {
+        auto* input = node->InputDefs()[i];
+
+        // skip placing on CPU if the data typs is float16 or bfloat16
+        if (input->Type() == DataTypeUtils::ToType("float16") ||
+            input->Type() == DataTypeUtils::ToType("bfloat16")) {
+          place_in_cpu = false;
+          break;
+        }
+
+        // allow placing on CPU if it's a small initializer or graph input
+        if (IsSmallInitializer(graph, input) ||
+            std::find(graph_inputs.begin(), graph_inputs.end(), input) != graph_inputs.end()) {
+          continue;
+        }
+
+        // the input is not a CPU tensor
+        if (cpu_output_args.find(input) == cpu_output_args.end()) {
+          place_in_cpu = false;
+          break;
+        }
+
+        // input is a CPU tensor, but it's intended to be consumed as CPU input by the target EP
+        if (node_to_kernel[cur]->kernel_def->IsInputOnCpu(i)) {
+          place_in_cpu = false;
+          break;
+        }
       }
     }
 
@@ -4,6 +4,9 @@
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 
 #include "core/framework/graph_partitioner.h"
+
+#include "onnx/defs/data_type_utils.h"
+
 #include "core/framework/kernel_registry_manager.h"
 #include "core/graph/function.h"
 #include "core/graph/graph_viewer.h"
@@ -41,6 +44,8 @@ NonCudaOps non_cuda;
 #endif
 
 using namespace ::onnxruntime::common;
+using ONNX_NAMESPACE::Utils::DataTypeUtils;
+
 namespace onnxruntime {
 
 // minimal KernelDef based on MetaDef instead of a Function based node
@@ -333,6 +338,130 @@ static Status PartitionOnnxFormatModelImpl(Graph& graph, bool export_dll, FuncMa
   return Status::OK();
 }
 
+// Ops whose device compute speedup is assumed to dominate any transfer savings, so the partition
+// refinement below never moves them off the provider that claimed them.
+static bool IsComputeHeavyOp(const std::string& op_type) {
+  static const std::unordered_set<std::string> compute_heavy_ops{
+      "Conv", "ConvTranspose", "Gemm", "MatMul", "FusedMatMul", "Einsum",
+      "LSTM", "GRU", "RNN", "Attention", "FusedConv"};
+  return compute_heavy_ops.count(op_type) != 0;
+}
+
+// Approximate cost of transferring the value behind a NodeArg between devices. The element count
+// is used as the proxy; symbolic or missing dimensions are assumed to be large so that edges with
+// unknown shapes still count as expensive to cross.
+static int64_t EdgeTransferCost(const NodeArg* arg) {
+  constexpr int64_t kUnknownDimSize = 128;
+  constexpr int64_t kUnknownShapeCost = 1 << 20;
+
+  if (arg == nullptr || !arg->Exists()) {
+    return 0;
+  }
+
+  const auto* shape = arg->Shape();
+  if (shape == nullptr) {
+    return kUnknownShapeCost;
+  }
+
+  int64_t cost = 1;
+  for (const auto& dim : shape->dim()) {
+    cost *= (dim.has_dim_value() && dim.dim_value() > 0) ? dim.dim_value() : kUnknownDimSize;
+  }
+
+  return cost;
+}
+
+// Re-home nodes at partition boundaries to reduce cross-provider transfers. The greedy
+// per-provider assignment can leave runs of nodes on one provider broken up by single nodes
+// assigned elsewhere, and every such crossing later becomes a MemcpyFromHost/MemcpyToHost pair.
+// For each non-fused node this compares the transfer cost of the edges shared with each
+// neighboring provider and moves the node when another provider already owns the majority of its
+// traffic, provided that provider has a kernel registered for the node and the node's compute is
+// not expected to dominate the saved transfers. Moves can expose further candidates (a chain of
+// boundary nodes un-crossing one by one), so the pass repeats until it settles.
+static void ReduceCrossPartitionTransfers(Graph& graph, const KernelRegistryManager& kernel_registry_mgr) {
+  // recurse into nested graphs first; Memcpy nodes are inserted per graph level.
+  for (auto& node : graph.Nodes()) {
+    for (auto& entry : node.GetAttributeNameToMutableSubgraphMap()) {
+      ReduceCrossPartitionTransfers(*entry.second, kernel_registry_mgr);
+    }
+  }
+
+  constexpr int kMaxRefinementPasses = 8;
+
+  bool changed = true;
+  for (int pass = 0; changed && pass < kMaxRefinementPasses; ++pass) {
+    changed = false;
+
+    GraphViewer graph_viewer(graph);
+    for (NodeIndex node_index : graph_viewer.GetNodesInTopologicalOrder()) {
+      Node* node = graph.GetNode(node_index);
+      if (node == nullptr || node->GetExecutionProviderType().empty() ||
+          node->NodeType() == Node::Type::Fused || node->ContainsSubgraph() ||
+          IsComputeHeavyOp(node->OpType())) {
+        continue;
+      }
+
+      // tally the transfer cost of the edges shared with each provider
+      std::unordered_map<std::string, int64_t> provider_edge_cost;
+      for (auto edge = node->InputEdgesBegin(), end = node->InputEdgesEnd(); edge != end; ++edge) {
+        const std::string& producer_type = edge->GetNode().GetExecutionProviderType();
+        if (!producer_type.empty()) {
+          provider_edge_cost[producer_type] += EdgeTransferCost(node->InputDefs()[edge->GetDstArgIndex()]);
+        }
+      }
+
+      for (auto edge = node->OutputEdgesBegin(), end = node->OutputEdgesEnd(); edge != end; ++edge) {
+        const std::string& consumer_type = edge->GetNode().GetExecutionProviderType();
+        if (!consumer_type.empty()) {
+          provider_edge_cost[consumer_type] += EdgeTransferCost(node->OutputDefs()[edge->GetSrcArgIndex()]);
+        }
+      }
+
+      const std::string current_type = node->GetExecutionProviderType();
+      const std::string* best_type = nullptr;
+      int64_t best_cost = provider_edge_cost[current_type];
+
+      for (const auto& entry : provider_edge_cost) {
+        if (entry.first != current_type && entry.second > best_cost) {
+          best_cost = entry.second;
+          best_type = &entry.first;
+        }
+      }
+
+      if (best_type == nullptr) {
+        continue;
+      }
+
+      // CPU kernels do not support the reduced precision float types
+      if (*best_type == kCpuExecutionProvider) {
+        bool has_reduced_precision_float = false;
+        for (const auto* def : node->InputDefs()) {
+          if (def->Exists() &&
+              (def->Type() == DataTypeUtils::ToType("float16") ||
+               def->Type() == DataTypeUtils::ToType("bfloat16"))) {
+            has_reduced_precision_float = true;
+            break;
+          }
+        }
+
+        if (has_reduced_precision_float) {
+          continue;
+        }
+      }
+
+      if (!KernelRegistryManager::HasImplementationOf(kernel_registry_mgr, *node, *best_type)) {
+        continue;
+      }
+
+      LOGS_DEFAULT(INFO) << "Re-homing node " << node->Name() << " from " << current_type
+                         << " to " << *best_type << " to reduce cross-partition transfers.";
+      node->SetExecutionProviderType(*best_type);
+      changed = true;
+    }
+  }
+}
+
 // expand any nodes that have an ONNX function definition but no matching ORT kernel
 static Status InlineNodes(Graph& graph, bool& modified_graph) {
   // recurse into nested graphs first so we process from bottom up
@@ -384,6 +513,13 @@ Status GraphPartitioner::PartitionOnnxFormatModel(Graph& graph, bool export_dll,
     }
   } while (modified_graph);
 
+  // Refine the greedy assignment: re-home boundary nodes whose traffic is mostly with another
+  // provider so fewer Memcpy pairs are inserted later. kAssignOnly aims for maximal assignment
+  // per EP and must not second-guess it.
+  if (mode == Mode::kNormal) {
+    ReduceCrossPartitionTransfers(graph, kernel_registry_mgr_);
+  }
+
   return Status::OK();
 }
 
@@ -241,18 +241,20 @@ Status KernelRegistry::TryFindKernel(const onnxruntime::Node& node,
   const auto& node_provider = node.GetExecutionProviderType();
   const auto& expected_provider = (node_provider.empty() ? exec_provider : node_provider);
 
-  auto range = kernel_creator_fn_map_.equal_range(GetMapKey(node.OpType(), node.Domain(), expected_provider));
   if (out) *out = nullptr;
 
   std::vector<std::string> verify_kernel_def_error_strs;
 
-  for (auto i = range.first; i != range.second; ++i) {
-    std::string error_str;
-    if (VerifyKernelDef(node, *i->second.kernel_def, error_str)) {
-      if (out) *out = &i->second;
-      return Status::OK();
+  auto op_id_it = op_id_map_.find(GetMapKey(node.OpType(), node.Domain(), expected_provider));
+  if (op_id_it != op_id_map_.end()) {
+    for (const KernelCreateInfo* candidate : kernels_by_op_id_[op_id_it->second]) {
+      std::string error_str;
+      if (VerifyKernelDef(node, *candidate->kernel_def, error_str)) {
+        if (out) *out = candidate;
+        return Status::OK();
+      }
+      verify_kernel_def_error_strs.push_back(error_str);
     }
-    verify_kernel_def_error_strs.push_back(error_str);
   }
 
   if (!verify_kernel_def_error_strs.empty()) {
@@ -310,6 +312,17 @@ Status KernelRegistry::Register(KernelCreateInfo&& create_info) {
   // Ownership of the KernelDef is transferred to kernel_creator_fn_map_.
   auto it = kernel_creator_fn_map_.emplace(key, std::move(create_info));
   kernel_def_hash_lookup_.emplace(kernel_def_hash, it);
+
+#if !defined(ORT_MINIMAL_BUILD)
+  // intern the op identifier and add the kernel to the dense-id lookup used by TryFindKernel.
+  // multimap nodes are stable so the stored pointer remains valid.
+  auto op_id_entry = op_id_map_.emplace(key, static_cast<uint32_t>(kernels_by_op_id_.size()));
+  if (op_id_entry.second) {
+    kernels_by_op_id_.emplace_back();
+  }
+  kernels_by_op_id_[op_id_entry.first->second].push_back(&it->second);
+#endif
+
   return Status::OK();
 }
 
@@ -91,6 +91,17 @@ Status OpKernelContext::GetTempSpaceAllocator(AllocatorPtr* output) const {
   *output = execution_frame_->GetAllocator(kernel_->Allocator(0, OrtMemTypeDefault));
   if (!*output)
     return Status(common::ONNXRUNTIME, common::FAIL, "TempSpace allocator not found");
+
+  // when the frame provides a per-Run scratch arena, route CPU scratch allocations there so they
+  // are reclaimed in one step when the frame completes instead of churning the session allocator.
+  // the scratch arena is CPU memory only; other devices keep their regular allocator.
+  if ((*output)->Info().device.Type() == OrtDevice::CPU) {
+    AllocatorPtr scratch_allocator = execution_frame_->GetScratchBufferAllocator();
+    if (scratch_allocator) {
+      *output = std::move(scratch_allocator);
+    }
+  }
+
   return Status::OK();
 }
 
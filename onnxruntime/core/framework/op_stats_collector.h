@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+
+/**
+ * Aggregated per-kernel execution statistics designed to stay enabled in production.
+ *
+ * Unlike profiling::Profiler, which records an event with string copies for every kernel
+ * invocation, this collector keeps one fixed slot per node in the execution plan and updates it
+ * with relaxed atomic adds, so the per-invocation cost is an indexed access plus a few
+ * uncontended atomics. Slots are cache-line aligned so concurrently executing nodes (parallel
+ * executor) do not false-share. Aggregation by op type happens at read time and may run
+ * concurrently with inference.
+ */
+class OpStatsCollector {
+ public:
+  OpStatsCollector() = default;
+
+  // One slot per node, indexed by NodeIndex. Must be called before the first Record; the slot
+  // count is fixed afterwards.
+  explicit OpStatsCollector(size_t num_slots) : slots_(num_slots) {}
+
+  // Called from the executor after a kernel completes. op_type must outlive this collector,
+  // which holds for the node's op type string owned by the session's graph.
+  void Record(size_t slot_index, const char* op_type, uint64_t duration_ns, uint64_t total_bytes) {
+    ORT_ENFORCE(slot_index < slots_.size(), "Invalid op stats slot index: ", slot_index);
+    Slot& slot = slots_[slot_index];
+    slot.op_type.store(op_type, std::memory_order_relaxed);
+    slot.count.fetch_add(1, std::memory_order_relaxed);
+    slot.total_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+    slot.total_bytes.fetch_add(total_bytes, std::memory_order_relaxed);
+  }
+
+  struct OpTypeStats {
+    uint64_t count = 0;
+    uint64_t total_ns = 0;
+    uint64_t total_bytes = 0;
+  };
+
+  // Aggregates the per-node slots by op type. Safe to call while inference traffic is running;
+  // concurrent updates may or may not be included in the snapshot.
+  std::map<std::string, OpTypeStats> Aggregate() const {
+    std::map<std::string, OpTypeStats> result;
+    for (const Slot& slot : slots_) {
+      const char* op_type = slot.op_type.load(std::memory_order_relaxed);
+      if (op_type == nullptr) {
+        continue;  // node never executed
+      }
+      OpTypeStats& stats = result[op_type];
+      stats.count += slot.count.load(std::memory_order_relaxed);
+      stats.total_ns += slot.total_ns.load(std::memory_order_relaxed);
+      stats.total_bytes += slot.total_bytes.load(std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(OpStatsCollector);
+
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> total_ns{0};
+    std::atomic<uint64_t> total_bytes{0};
+    // set on first execution; nullptr identifies slots of nodes that never ran
+    std::atomic<const char*> op_type{nullptr};
+  };
+
+  std::vector<Slot> slots_;
+};
+
+}  // namespace onnxruntime
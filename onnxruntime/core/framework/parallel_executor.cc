@@ -21,9 +21,9 @@ namespace onnxruntime {
 ParallelExecutor::ParallelExecutor(const SessionState& session_state, const bool& terminate_flag)
     : out_standings_(0), terminate_flag_(terminate_flag), executor_pool_(session_state.GetInterOpThreadPool()) {
   const auto& graph_viewer = session_state.GetGraphViewer();
-  node_refs_.resize(graph_viewer.MaxNodeIndex());
+  node_refs_ = std::vector<std::atomic<size_t>>(graph_viewer.MaxNodeIndex());
   for (auto& node : graph_viewer.Nodes()) {
-    node_refs_[node.Index()] = node.GetInputEdgesCount();
+    node_refs_[node.Index()].store(node.GetInputEdgesCount(), std::memory_order_relaxed);
   }
 }
 
@@ -53,7 +53,7 @@ Status ParallelExecutor::Execute(const SessionState& session_state, const std::v
   // Wait for finish.
   {
     std::unique_lock<OrtMutex> lock(complete_mutex_);
-    while (out_standings_ > 0) complete_cv_.wait(lock);
+    while (out_standings_.load(std::memory_order_acquire) > 0) complete_cv_.wait(lock);
   }
 
   Status status = Status::OK();
@@ -147,6 +147,52 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
     // sync before compute
     int queue_id = p_op_kernel->KernelDef().ExecQueueId();
     if (exec_plan.NodeHasFence(node_index)) {
+      // Prefer an event-driven wait over parking this worker in a fence: if a producing device
+      // queue has not signalled yet, ask the fence to re-schedule this node once it does and
+      // give the worker back to the pool. The re-run probes all fences again, so deferring on
+      // the first unready fence at a time is sufficient. The outstanding count is bumped before
+      // registration so the executor cannot observe completion while the node is in flight.
+      bool deferred = false;
+      auto try_defer_on_fence = [&](Fence_t fence, const std::string& execution_provider_type) {
+        out_standings_.fetch_add(1, std::memory_order_relaxed);
+        if (fence->RegisterInputReadyCallback(execution_provider_type, queue_id,
+                                              [this, node_index, &session_state, &logger]() {
+                                                ScheduleNode(node_index, session_state, logger);
+                                              })) {
+          deferred = true;
+        } else {
+          // still counted by the current run; safe to undo without notifying
+          out_standings_.fetch_sub(1, std::memory_order_relaxed);
+        }
+      };
+
+      for (int input_index = 0; !deferred && input_index < op_kernel_context.InputCount(); ++input_index) {
+        Fence_t fence = op_kernel_context.InputFence(input_index);
+        if (fence) {
+          auto execution_provider_type = node.GetExecutionProviderType();
+          if (OrtMemTypeCPUInput == p_op_kernel->KernelDef().InputMemoryType(input_index)) {
+            execution_provider_type = kCpuExecutionProvider;
+          }
+          try_defer_on_fence(fence, execution_provider_type);
+        }
+      }
+
+      for (int input_index = 0; !deferred && input_index < op_kernel_context.ImplicitInputCount(); ++input_index) {
+        Fence_t fence = op_kernel_context.ImplicitInputFence(input_index);
+        if (fence) {
+          auto execution_provider_type = node.GetExecutionProviderType();
+          if (OrtMemTypeCPUInput == p_op_kernel->KernelDef().InputMemoryType(input_index)) {
+            execution_provider_type = kCpuExecutionProvider;
+          }
+          try_defer_on_fence(fence, execution_provider_type);
+        }
+      }
+
+      if (deferred) {
+        // the fence callback re-enqueues the node; this task is done
+        return status;
+      }
+
       for (int input_index = 0; input_index < op_kernel_context.InputCount(); ++input_index) {
         Fence_t fence = op_kernel_context.InputFence(input_index);
         if (fence) {
@@ -260,14 +306,18 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
     keep_running = false;
 
     // Checking which output nodes ready for running.
+    // The dependency counters are per-node atomics, so concurrently completing nodes
+    // no longer serialize on a shared mutex here; the thread that takes a counter to
+    // zero owns scheduling that successor.
     {
       auto begin = node.OutputEdgesBegin();
       auto end = node.OutputEdgesEnd();
 
-      std::lock_guard<OrtMutex> lock(ref_mutex_);
       for (auto it = begin; it != end; it++) {
         auto idx = (*it).GetNode().Index();
-        if ((--node_refs_[idx]) == 0) {
+        // release pairs with the acquire of the thread that schedules the successor,
+        // making this node's outputs visible to it
+        if (node_refs_[idx].fetch_sub(1, std::memory_order_acq_rel) == 1) {
           if (!keep_running) {
             node_index = idx;
             keep_running = true;
@@ -287,14 +337,18 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
 }
 
 void ParallelExecutor::EnqueueNode(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger) {
-  {
-    std::unique_lock<OrtMutex> lock(complete_mutex_);
-    // if there are errors there's no point queuing more work
-    if (!errors_.empty())
-      return;
+  // if there are errors there's no point queuing more work
+  if (have_errors_.load(std::memory_order_relaxed))
+    return;
 
-    out_standings_++;
-  }
+  out_standings_.fetch_add(1, std::memory_order_relaxed);
+  ScheduleNode(p_node_index, session_state, logger);
+}
+
+void ParallelExecutor::ScheduleNode(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger) {
+  // Schedule() pushes onto the calling worker's lock-free run queue when invoked from a pool
+  // thread, and idle workers steal from each other's queues - so ready successors fan out
+  // across the inter-op pool without a shared ready-queue lock.
 
   onnxruntime::concurrency::ThreadPool::Schedule(executor_pool_, [this, p_node_index, &session_state, &logger]() {
     auto create_exception_message = [p_node_index, &session_state](const std::exception* ex) {
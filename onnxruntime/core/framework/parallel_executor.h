@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include "core/common/common.h"
 #include "core/common/status.h"
@@ -35,29 +36,38 @@ class ParallelExecutor : public IExecutor {
 
   void EnqueueNode(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger);
 
+  // Schedules a node that is already accounted for in out_standings_, e.g. one whose run was
+  // deferred until a device fence signalled. Unlike EnqueueNode this never drops the node, as
+  // its outstanding count must be balanced by a FinishNodeRun.
+  void ScheduleNode(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger);
+
   void FinishNodeRun(const Status& status) {
-    bool finished = false;
-    {
-      //Because we have a mutex here, it's not possible another thread is doing the test("while (out_standings_ > 0)"
+    if (!status.IsOK()) {
       std::lock_guard<OrtMutex> lock(complete_mutex_);
-      finished = --out_standings_ == 0;
-      if (!status.IsOK())
-        errors_.push_back(status);
+      have_errors_.store(true, std::memory_order_relaxed);
+      errors_.push_back(status);
     }
 
-    if (finished) {
+    // acquire/release so the completing node's writes are visible to the thread that observes
+    // the counter hitting zero and goes on to finalize the frame
+    if (out_standings_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      // hold the lock while notifying so the notification cannot slip in between the waiting
+      // thread's check of out_standings_ and its wait()
+      std::lock_guard<OrtMutex> lock(complete_mutex_);
       //std::cout << "all out standing nodes are completed." << std::endl;
       complete_cv_.notify_all();
     }
   }
 
   std::unique_ptr<ExecutionFrame> root_frame_;
-  std::vector<size_t> node_refs_;
-  OrtMutex ref_mutex_;
-  int out_standings_;  //protected by complete_mutex_
+  // Per-node dependency counters. Completing nodes decrement their successors' counters
+  // atomically, so wide graphs with many tiny nodes don't serialize on a shared mutex.
+  std::vector<std::atomic<size_t>> node_refs_;
+  std::atomic<int> out_standings_;
   OrtMutex complete_mutex_;
   OrtCondVar complete_cv_;
-  std::vector<Status> errors_;
+  std::atomic<bool> have_errors_{false};
+  std::vector<Status> errors_;  // protected by complete_mutex_
 
   const bool& terminate_flag_;
   // TODO: Temporary threadpool for the executor.  This is a costly way to handle the problem.
@@ -2,10 +2,62 @@
 // Licensed under the MIT License.
 
 #include "core/framework/prepacked_weights_container.h"
+
+#include <cstring>
+#include <fstream>
+
+#include "core/common/cpuid_info.h"
 #include "core/framework/allocatormgr.h"
 
 namespace onnxruntime {
 
+namespace {
+
+// Reads as the bytes "ORTP" at the start of the file on a little-endian machine
+constexpr uint32_t kCacheFileMagic = 0x5054524F;
+
+// Pre-packed buffers are expected to be at least 64-byte aligned (the alignment the CPU
+// allocators provide), so each buffer is written at a 64-byte aligned file offset - the
+// memory mapping itself is page aligned.
+constexpr uint64_t kCacheBufferAlignment = 64;
+
+// The pack formats MLAS selects depend on the instruction sets available, so a cache file is
+// only usable on hardware with the same capabilities it was produced on.
+uint64_t CpuCapabilityFingerprint() {
+  const CPUIDInfo& cpuid_info = CPUIDInfo::GetCPUIDInfo();
+
+  uint64_t fingerprint = 0;
+  fingerprint |= static_cast<uint64_t>(cpuid_info.HasSSE3()) << 0;
+  fingerprint |= static_cast<uint64_t>(cpuid_info.HasSSE4_1()) << 1;
+  fingerprint |= static_cast<uint64_t>(cpuid_info.HasAVX()) << 2;
+  fingerprint |= static_cast<uint64_t>(cpuid_info.HasAVX2()) << 3;
+  fingerprint |= static_cast<uint64_t>(cpuid_info.HasAVX512f()) << 4;
+  fingerprint |= static_cast<uint64_t>(cpuid_info.HasAVX512Skylake()) << 5;
+  fingerprint |= static_cast<uint64_t>(cpuid_info.HasF16C()) << 6;
+  fingerprint |= static_cast<uint64_t>(cpuid_info.HasArmNeonDot()) << 7;
+
+  return fingerprint;
+}
+
+template <typename T>
+void WriteScalar(std::ofstream& stream, T value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+Status ReadScalar(const char* data, size_t data_length, size_t& offset, T& value) {
+  if (data_length - offset < sizeof(T)) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "The pre-packed weights cache file is truncated");
+  }
+
+  std::memcpy(&value, data + offset, sizeof(T));
+  offset += sizeof(T);
+
+  return Status::OK();
+}
+
+}  // namespace
+
 AllocatorPtr PrepackedWeightsContainer::GetOrCreateAllocator(const std::string& device_name) {
   auto iter = allocators_.find(device_name);
 
@@ -49,4 +101,139 @@ size_t PrepackedWeightsContainer::GetNumberOfElements() const {
   return prepacked_weights_map_.size();
 }
 
+Status PrepackedWeightsContainer::SaveToFile(const PathString& file_path) const {
+  std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Unable to open the pre-packed weights cache file for writing: ",
+                           ToMBString(file_path));
+  }
+
+  WriteScalar(file, kCacheFileMagic);
+  WriteScalar(file, kCacheFormatVersion);
+  WriteScalar(file, CpuCapabilityFingerprint());
+  WriteScalar(file, static_cast<uint64_t>(prepacked_weights_map_.size()));
+
+  for (const auto& entry : prepacked_weights_map_) {
+    const std::string& key = entry.first;
+    const PrePackedWeights& weights = entry.second;
+
+    WriteScalar(file, static_cast<uint64_t>(key.size()));
+    file.write(key.data(), key.size());
+
+    WriteScalar(file, static_cast<uint64_t>(weights.buffers_.size()));
+    for (size_t i = 0; i < weights.buffers_.size(); ++i) {
+      // some pre-packed buffers may be null if they were just "place-holders" occupying an index
+      // in the "buffers_" vector - record those as absent
+      WriteScalar(file, static_cast<uint8_t>(weights.buffers_[i].get() != nullptr));
+      WriteScalar(file, static_cast<uint64_t>(weights.buffer_sizes_[i]));
+    }
+
+    for (size_t i = 0; i < weights.buffers_.size(); ++i) {
+      if (weights.buffers_[i].get() == nullptr) {
+        continue;
+      }
+
+      // pad so the buffer starts at an aligned offset in the file (and thereby in the mapping)
+      for (auto pos = static_cast<uint64_t>(file.tellp()); pos % kCacheBufferAlignment != 0; ++pos) {
+        file.put(0);
+      }
+
+      file.write(reinterpret_cast<const char*>(weights.buffers_[i].get()),
+                 static_cast<std::streamsize>(weights.buffer_sizes_[i]));
+    }
+  }
+
+  if (!file) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed while writing the pre-packed weights cache file: ",
+                           ToMBString(file_path));
+  }
+
+  return Status::OK();
+}
+
+Status PrepackedWeightsContainer::LoadFromFile(const PathString& file_path) {
+  size_t file_length = 0;
+  ORT_RETURN_IF_ERROR(Env::Default().GetFileLength(file_path.c_str(), file_length));
+
+  Env::MappedMemoryPtr mapped_file;
+  ORT_RETURN_IF_ERROR(Env::Default().MapFileIntoMemory(file_path.c_str(), 0, file_length, mapped_file));
+
+  const char* data = mapped_file.get();
+  size_t offset = 0;
+
+  uint32_t magic = 0;
+  ORT_RETURN_IF_ERROR(ReadScalar(data, file_length, offset, magic));
+  if (magic != kCacheFileMagic) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "The file is not a pre-packed weights cache file: ",
+                           ToMBString(file_path));
+  }
+
+  uint32_t version = 0;
+  ORT_RETURN_IF_ERROR(ReadScalar(data, file_length, offset, version));
+  if (version != kCacheFormatVersion) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "The pre-packed weights cache file was produced by an incompatible ",
+                           "cache format version ", version, ", expected version ",
+                           static_cast<uint32_t>(kCacheFormatVersion));
+  }
+
+  uint64_t cpu_fingerprint = 0;
+  ORT_RETURN_IF_ERROR(ReadScalar(data, file_length, offset, cpu_fingerprint));
+  if (cpu_fingerprint != CpuCapabilityFingerprint()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "The pre-packed weights cache file was produced on hardware with ",
+                           "different CPU capabilities and cannot be used on this machine");
+  }
+
+  uint64_t num_entries = 0;
+  ORT_RETURN_IF_ERROR(ReadScalar(data, file_length, offset, num_entries));
+
+  for (uint64_t entry = 0; entry < num_entries; ++entry) {
+    uint64_t key_length = 0;
+    ORT_RETURN_IF_ERROR(ReadScalar(data, file_length, offset, key_length));
+    if (file_length - offset < key_length) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "The pre-packed weights cache file is truncated");
+    }
+
+    std::string key(data + offset, static_cast<size_t>(key_length));
+    offset += static_cast<size_t>(key_length);
+
+    uint64_t num_buffers = 0;
+    ORT_RETURN_IF_ERROR(ReadScalar(data, file_length, offset, num_buffers));
+
+    std::vector<uint8_t> buffer_present(static_cast<size_t>(num_buffers), 0);
+    std::vector<uint64_t> buffer_sizes(static_cast<size_t>(num_buffers), 0);
+    for (size_t i = 0; i < num_buffers; ++i) {
+      ORT_RETURN_IF_ERROR(ReadScalar(data, file_length, offset, buffer_present[i]));
+      ORT_RETURN_IF_ERROR(ReadScalar(data, file_length, offset, buffer_sizes[i]));
+    }
+
+    PrePackedWeights weights;
+    for (size_t i = 0; i < num_buffers; ++i) {
+      if (!buffer_present[i]) {
+        weights.buffers_.emplace_back(nullptr, BufferDeleter(nullptr));
+        weights.buffer_sizes_.push_back(static_cast<size_t>(buffer_sizes[i]));
+        continue;
+      }
+
+      offset += (kCacheBufferAlignment - offset % kCacheBufferAlignment) % kCacheBufferAlignment;
+      if (offset > file_length || file_length - offset < buffer_sizes[i]) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "The pre-packed weights cache file is truncated");
+      }
+
+      // the buffer is not owned - it points into the file mapping which this container keeps
+      // alive in mapped_cache_file_
+      weights.buffers_.emplace_back(const_cast<char*>(data) + offset, BufferDeleter(nullptr));
+      weights.buffer_sizes_.push_back(static_cast<size_t>(buffer_sizes[i]));
+      offset += static_cast<size_t>(buffer_sizes[i]);
+    }
+
+    // an entry written by another process is identical to one this process would produce
+    // (the key embeds the hash of the packed bytes), so keep the existing one on collision
+    prepacked_weights_map_.emplace(std::move(key), std::move(weights));
+  }
+
+  mapped_cache_file_ = std::move(mapped_file);
+
+  return Status::OK();
+}
+
 }  // namespace onnxruntime
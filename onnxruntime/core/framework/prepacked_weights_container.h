@@ -8,9 +8,11 @@
 #include <string>
 #include <cstdint>
 
+#include "core/common/path_string.h"
 #include "core/framework/buffer_deleter.h"
 
 #include "core/framework/allocator.h"
+#include "core/platform/env.h"
 #include "core/platform/ort_mutex.h"
 #include "prepacked_weights.h"
 
@@ -47,6 +49,27 @@ class PrepackedWeightsContainer final {
   // Returns the number of elements in the container
   size_t GetNumberOfElements() const;
 
+  // Serializes the contents of the container to the given file so that other processes can
+  // re-use the pre-packed buffers via LoadFromFile().
+  // The file records the cache format version and a fingerprint of the CPU capabilities the
+  // buffers were packed for, alongside each entry's key and raw buffer bytes.
+  // Not safe to call concurrently with WriteWeight() - invoke after the sessions sharing
+  // this container have been initialized.
+  Status SaveToFile(const PathString& file_path) const;
+
+  // Populates the container with the entries of a file produced by SaveToFile().
+  // The file is memory-mapped and the loaded buffers point directly into the mapping, so the
+  // packed pages are file-backed and shared between processes using the same cache file
+  // instead of each process holding a private copy.
+  // Returns an error if the file was produced by an incompatible cache format version or on
+  // hardware with different CPU capabilities (the pack formats MLAS picks depend on the
+  // instruction sets available).
+  // Invoke before the sessions sharing this container are initialized.
+  Status LoadFromFile(const PathString& file_path);
+
+  // Bump when the serialization layout or any kernel's pre-pack format changes.
+  static constexpr uint32_t kCacheFormatVersion = 1;
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(PrepackedWeightsContainer);
 
   // Resource to be acquired by the method that is going to invoke calls to the kernels'
@@ -64,6 +87,10 @@ class PrepackedWeightsContainer final {
   // to PrePackedWeights instances.
   // The key is : op_type + "+" + hash_of_prepacked_buffers_in_the_PrepackedWeights_instance.
   std::unordered_map<std::string, PrePackedWeights> prepacked_weights_map_;
+
+  // Keeps the mapping of a cache file loaded via LoadFromFile() alive for the lifetime of
+  // this container, as the PrePackedWeights buffers loaded from it point into the mapping.
+  Env::MappedMemoryPtr mapped_cache_file_;
 };
 
 }  // namespace onnxruntime
@@ -0,0 +1,185 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/replay_capture.h"
+
+#include <cstring>
+#include <fstream>
+
+#include "core/common/common.h"
+#include "core/framework/data_types.h"
+#include "core/framework/tensor.h"
+#include "core/framework/random_seed.h"
+
+namespace onnxruntime {
+
+namespace {
+
+constexpr char kReplayMagic[8] = {'O', 'R', 'T', 'R', 'P', 'L', 'Y', '1'};
+constexpr uint32_t kReplayVersion = 1;
+
+template <typename T>
+void WritePod(std::ofstream& out, T value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void WriteString(std::ofstream& out, const std::string& value) {
+  WritePod(out, static_cast<uint32_t>(value.size()));
+  out.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+template <typename T>
+common::Status ReadPod(std::ifstream& in, T& value) {
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  if (!in) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Replay capture is truncated.");
+  }
+  return common::Status::OK();
+}
+
+common::Status ReadString(std::ifstream& in, std::string& value) {
+  uint32_t length;
+  ORT_RETURN_IF_ERROR(ReadPod(in, length));
+  value.resize(length);
+  in.read(&value[0], static_cast<std::streamsize>(length));
+  if (!in) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Replay capture is truncated.");
+  }
+  return common::Status::OK();
+}
+
+}  // namespace
+
+common::Status SaveReplayCapture(const std::string& path, const std::vector<std::string>& feed_names,
+                                 const std::vector<OrtValue>& feeds, const RunOptions& run_options) {
+  ORT_RETURN_IF_NOT(feed_names.size() == feeds.size(), "Number of feed names does not match number of feeds.");
+
+  // validate all feeds up front so an unsupported feed does not leave a partial capture behind
+  for (size_t i = 0; i < feeds.size(); ++i) {
+    if (!feeds[i].IsTensor()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Replay capture only supports tensor feeds. Feed '",
+                             feed_names[i], "' is not a tensor.");
+    }
+    if (feeds[i].Get<Tensor>().IsDataTypeString()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Replay capture does not support string tensors. Feed '",
+                             feed_names[i], "' is a string tensor.");
+    }
+  }
+
+  std::ofstream out{path, std::ios::binary | std::ios::trunc};
+  if (!out) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to open replay capture file for writing: ", path);
+  }
+
+  out.write(kReplayMagic, sizeof(kReplayMagic));
+  WritePod(out, kReplayVersion);
+  WritePod(out, static_cast<int64_t>(utils::GetRandomSeed()));
+  WriteString(out, run_options.run_tag);
+
+  const auto& config_entries = run_options.config_options.configurations;
+  WritePod(out, static_cast<uint32_t>(config_entries.size()));
+  for (const auto& entry : config_entries) {
+    WriteString(out, entry.first);
+    WriteString(out, entry.second);
+  }
+
+  WritePod(out, static_cast<uint32_t>(feeds.size()));
+  for (size_t i = 0; i < feeds.size(); ++i) {
+    const Tensor& tensor = feeds[i].Get<Tensor>();
+    WriteString(out, feed_names[i]);
+    WritePod(out, tensor.GetElementType());
+    const auto dims = tensor.Shape().GetDims();
+    WritePod(out, static_cast<uint32_t>(dims.size()));
+    for (int64_t dim : dims) {
+      WritePod(out, dim);
+    }
+    WritePod(out, static_cast<uint64_t>(tensor.SizeInBytes()));
+    out.write(reinterpret_cast<const char*>(tensor.DataRaw()),
+              static_cast<std::streamsize>(tensor.SizeInBytes()));
+  }
+
+  out.flush();
+  if (!out) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to write replay capture file: ", path);
+  }
+  return common::Status::OK();
+}
+
+common::Status LoadReplayCapture(const std::string& path, const AllocatorPtr& allocator,
+                                 ReplayCapture& capture) {
+  std::ifstream in{path, std::ios::binary};
+  if (!in) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to open replay capture file: ", path);
+  }
+
+  char magic[sizeof(kReplayMagic)];
+  in.read(magic, sizeof(magic));
+  if (!in || std::memcmp(magic, kReplayMagic, sizeof(kReplayMagic)) != 0) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "File is not a replay capture: ", path);
+  }
+
+  uint32_t version;
+  ORT_RETURN_IF_ERROR(ReadPod(in, version));
+  if (version != kReplayVersion) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Unsupported replay capture version ", version, " in ", path);
+  }
+
+  ORT_RETURN_IF_ERROR(ReadPod(in, capture.random_seed));
+  ORT_RETURN_IF_ERROR(ReadString(in, capture.run_tag));
+
+  uint32_t num_config_entries;
+  ORT_RETURN_IF_ERROR(ReadPod(in, num_config_entries));
+  capture.run_config_entries.resize(num_config_entries);
+  for (auto& entry : capture.run_config_entries) {
+    ORT_RETURN_IF_ERROR(ReadString(in, entry.first));
+    ORT_RETURN_IF_ERROR(ReadString(in, entry.second));
+  }
+
+  uint32_t num_feeds;
+  ORT_RETURN_IF_ERROR(ReadPod(in, num_feeds));
+  capture.feed_names.resize(num_feeds);
+  capture.feeds.resize(num_feeds);
+  for (uint32_t i = 0; i < num_feeds; ++i) {
+    ORT_RETURN_IF_ERROR(ReadString(in, capture.feed_names[i]));
+
+    int32_t elem_type;
+    ORT_RETURN_IF_ERROR(ReadPod(in, elem_type));
+    // validate before mapping to a type as TensorTypeFromONNXEnum throws on unknown values,
+    // which a corrupt file must not trigger. Save rejects string tensors, so they can't appear.
+    if (elem_type <= ONNX_NAMESPACE::TensorProto_DataType_UNDEFINED ||
+        elem_type > ONNX_NAMESPACE::TensorProto_DataType_BFLOAT16 ||
+        elem_type == ONNX_NAMESPACE::TensorProto_DataType_STRING ||
+        elem_type == ONNX_NAMESPACE::TensorProto_DataType_COMPLEX64 ||
+        elem_type == ONNX_NAMESPACE::TensorProto_DataType_COMPLEX128) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Replay capture feed '", capture.feed_names[i],
+                             "' has unsupported element type ", elem_type);
+    }
+    const auto* tensor_type = DataTypeImpl::TensorTypeFromONNXEnum(elem_type);
+
+    uint32_t rank;
+    ORT_RETURN_IF_ERROR(ReadPod(in, rank));
+    std::vector<int64_t> dims(rank);
+    for (auto& dim : dims) {
+      ORT_RETURN_IF_ERROR(ReadPod(in, dim));
+    }
+
+    uint64_t data_size;
+    ORT_RETURN_IF_ERROR(ReadPod(in, data_size));
+
+    OrtValue& value = capture.feeds[i];
+    Tensor::InitOrtValue(tensor_type->GetElementType(), TensorShape(dims), allocator, value);
+    Tensor& tensor = *value.GetMutable<Tensor>();
+    if (data_size != static_cast<uint64_t>(tensor.SizeInBytes())) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Replay capture feed '", capture.feed_names[i],
+                             "' data size ", data_size, " does not match its shape.");
+    }
+    in.read(reinterpret_cast<char*>(tensor.MutableDataRaw()), static_cast<std::streamsize>(data_size));
+    if (!in) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Replay capture is truncated.");
+    }
+  }
+
+  return common::Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/common/status.h"
+#include "core/framework/allocator.h"
+#include "core/framework/ort_value.h"
+#include "core/framework/run_options.h"
+
+namespace onnxruntime {
+
+/**
+ * Serialization of a single Run call's inputs for offline reproduction: the feeds, the run tag
+ * and run config entries, and the global random seed at capture time. Captures are written by
+ * InferenceSession::Run on sampled requests (see kOrtSessionOptionsConfigReplayCaptureFile) and
+ * replayed by the perf test tool's -R option.
+ *
+ * File format (all integers little-endian, strings length-prefixed with a uint32):
+ *   char[8]  magic "ORTRPLY1"
+ *   uint32   version (1)
+ *   int64    global random seed at capture time
+ *   string   run tag
+ *   uint32   number of run config entries, then per entry: string key, string value
+ *   uint32   number of feeds, then per feed:
+ *     string   feed name
+ *     int32    element type (ONNX TensorProto_DataType value)
+ *     uint32   rank, then int64 dims[rank]
+ *     uint64   data size in bytes, then the raw tensor data
+ *
+ * Only primitive-typed tensor feeds are supported; a capture with string tensors or non-tensor
+ * feeds fails without touching the file.
+ */
+
+// Write the feeds and run options of a Run call to 'path', overwriting any previous capture.
+common::Status SaveReplayCapture(const std::string& path, const std::vector<std::string>& feed_names,
+                                 const std::vector<OrtValue>& feeds, const RunOptions& run_options);
+
+// A capture loaded back into memory, with the feeds materialized as CPU tensors.
+struct ReplayCapture {
+  int64_t random_seed{0};
+  std::string run_tag;
+  std::vector<std::pair<std::string, std::string>> run_config_entries;
+  std::vector<std::string> feed_names;
+  std::vector<OrtValue> feeds;
+};
+
+// Read a capture written by SaveReplayCapture, allocating the feed tensors from 'allocator'.
+common::Status LoadReplayCapture(const std::string& path, const AllocatorPtr& allocator,
+                                 ReplayCapture& capture);
+
+}  // namespace onnxruntime
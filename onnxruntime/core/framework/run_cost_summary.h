@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+
+/**
+ * Coarse cost breakdown of a single Run call: kernel compute time, data movement time (Memcpy
+ * nodes plus cross-device feed/fetch copies) and framework overhead (everything else).
+ *
+ * Collection is a pair of clock reads per node, cheap enough to enable on sampled production
+ * traffic. The instance lives on the RunOptions of the run so the caller can read it back after
+ * Run returns; see kOrtRunOptionsConfigCollectCostBreakdown.
+ */
+class RunCostSummary {
+ public:
+  RunCostSummary() = default;
+
+  static bool IsCopyOp(const std::string& op_type) {
+    return op_type == "MemcpyFromHost" || op_type == "MemcpyToHost";
+  }
+
+  // called by the executor after a kernel completes; is_copy routes Memcpy nodes to the copy
+  // bucket
+  void AddKernelTime(bool is_copy, uint64_t duration_ns) noexcept {
+    (is_copy ? copy_time_ns_ : kernel_time_ns_).fetch_add(duration_ns, std::memory_order_relaxed);
+  }
+
+  // cross-device feed/fetch copies around graph execution
+  void AddCopyTime(uint64_t duration_ns) noexcept {
+    copy_time_ns_.fetch_add(duration_ns, std::memory_order_relaxed);
+  }
+
+  // wall time of the whole run; set once by the session when the run completes
+  void SetTotalTime(uint64_t duration_ns) noexcept { total_time_ns_ = duration_ns; }
+
+  uint64_t KernelTimeNs() const noexcept { return kernel_time_ns_.load(std::memory_order_relaxed); }
+  uint64_t CopyTimeNs() const noexcept { return copy_time_ns_.load(std::memory_order_relaxed); }
+  uint64_t TotalTimeNs() const noexcept { return total_time_ns_; }
+
+  // total minus kernel and copy time; zero when the run did not complete normally
+  uint64_t FrameworkTimeNs() const noexcept {
+    const uint64_t accounted = KernelTimeNs() + CopyTimeNs();
+    return total_time_ns_ > accounted ? total_time_ns_ - accounted : 0;
+  }
+
+  std::string ToJson() const {
+    std::ostringstream oss;
+    oss << "{\"total_ns\":" << TotalTimeNs()
+        << ",\"kernel_ns\":" << KernelTimeNs()
+        << ",\"copy_ns\":" << CopyTimeNs()
+        << ",\"framework_ns\":" << FrameworkTimeNs() << "}";
+    return oss.str();
+  }
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(RunCostSummary);
+
+  std::atomic<uint64_t> kernel_time_ns_{0};
+  std::atomic<uint64_t> copy_time_ns_{0};
+  uint64_t total_time_ns_{0};
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,37 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/run_priority.h"
+
+namespace onnxruntime {
+
+RunPriorityGate& RunPriorityGate::Instance() {
+  static RunPriorityGate instance;
+  return instance;
+}
+
+void RunPriorityGate::EnterHighPriorityRun() {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  active_high_priority_runs_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RunPriorityGate::LeaveHighPriorityRun() {
+  {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    active_high_priority_runs_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  high_priority_runs_done_.notify_all();
+}
+
+void RunPriorityGate::YieldToHighPriorityRuns() {
+  if (active_high_priority_runs_.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
+
+  std::unique_lock<OrtMutex> lock(mutex_);
+  high_priority_runs_done_.wait(lock, [this]() {
+    return active_high_priority_runs_.load(std::memory_order_relaxed) == 0;
+  });
+}
+
+}  // namespace onnxruntime
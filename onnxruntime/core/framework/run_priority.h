@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+
+#include "core/common/common.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+// Priority lane a Run executes in. Normal runs neither preempt nor yield;
+// low-priority runs pause at their next kernel boundary whenever a
+// high-priority run is active, and resume once none is.
+enum class RunPriority {
+  kNormal = 0,
+  kLow,
+  kHigh,
+};
+
+// Process-wide gate coordinating the two priority lanes. The gate is global
+// rather than per session because co-hosted latency-critical and batch
+// traffic typically run in separate sessions sharing one intra-op thread
+// pool: a low-priority run paused between kernels holds no pool threads, so
+// the pool's full parallelism is available to the high-priority run.
+class RunPriorityGate {
+ public:
+  static RunPriorityGate& Instance();
+
+  void EnterHighPriorityRun();
+  void LeaveHighPriorityRun();
+
+  // Blocks while any high-priority run is active. Called by low-priority
+  // sequential execution between kernel dispatches; the fast path is a single
+  // relaxed atomic load when no high-priority run is in flight.
+  void YieldToHighPriorityRuns();
+
+ private:
+  RunPriorityGate() = default;
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(RunPriorityGate);
+
+  std::atomic<int> active_high_priority_runs_{0};
+  OrtMutex mutex_;
+  OrtCondVar high_priority_runs_done_;
+};
+
+// Marks a high-priority run for its duration: low-priority runs yield at
+// kernel boundaries while any instance is alive.
+class HighPriorityRunScope {
+ public:
+  HighPriorityRunScope() { RunPriorityGate::Instance().EnterHighPriorityRun(); }
+  ~HighPriorityRunScope() { RunPriorityGate::Instance().LeaveHighPriorityRun(); }
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(HighPriorityRunScope);
+};
+
+}  // namespace onnxruntime
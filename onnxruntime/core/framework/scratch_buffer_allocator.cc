@@ -0,0 +1,82 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/scratch_buffer_allocator.h"
+
+#include <algorithm>
+
+namespace onnxruntime {
+
+ScratchBufferAllocator::ScratchBufferAllocator(AllocatorPtr upstream)
+    // report the upstream location so tensors placed on scratch memory keep the
+    // device/memory type the kernel expects.
+    : IAllocator(upstream->Info()),
+      upstream_(std::move(upstream)) {
+}
+
+ScratchBufferAllocator::~ScratchBufferAllocator() {
+  for (const auto& slab : slabs_) {
+    upstream_->Free(slab.base);
+  }
+}
+
+void* ScratchBufferAllocator::Alloc(size_t size) {
+  if (size == 0) {
+    return nullptr;
+  }
+
+  // keep every returned pointer aligned the same way the upstream allocators do.
+  size_t aligned_size = 0;
+  if (!CalcMemSizeForArrayWithAlignment<kAllocAlignment>(size, 1, &aligned_size)) {
+    return nullptr;
+  }
+
+  std::lock_guard<OrtMutex> guard(lock_);
+
+  if (slabs_.empty() || aligned_size > slabs_.back().size - offset_in_current_slab_) {
+    // the current slab (if any) can't satisfy the request. grab a new one and leave the
+    // old one in place; Reset will coalesce down to the largest slab so later runs don't
+    // pay for the overflow again.
+    size_t slab_size = std::max(aligned_size, static_cast<size_t>(kInitialSlabSize));
+    if (!slabs_.empty()) {
+      // grow geometrically so a slowly rising high-water mark doesn't produce a long
+      // chain of slabs before Reset gets a chance to consolidate.
+      slab_size = std::max(slab_size, slabs_.back().size * 2);
+    }
+
+    void* base = upstream_->Alloc(slab_size);
+    if (base == nullptr) {
+      return nullptr;
+    }
+
+    slabs_.push_back({base, slab_size});
+    offset_in_current_slab_ = 0;
+  }
+
+  void* p = static_cast<char*>(slabs_.back().base) + offset_in_current_slab_;
+  offset_in_current_slab_ += aligned_size;
+  return p;
+}
+
+void ScratchBufferAllocator::Free(void* /*p*/) {
+}
+
+void ScratchBufferAllocator::Reset() {
+  std::lock_guard<OrtMutex> guard(lock_);
+
+  if (slabs_.size() > 1) {
+    auto largest = std::max_element(slabs_.begin(), slabs_.end(),
+                                    [](const Slab& a, const Slab& b) { return a.size < b.size; });
+    Slab keep = *largest;
+    slabs_.erase(largest);
+    for (const auto& slab : slabs_) {
+      upstream_->Free(slab.base);
+    }
+    slabs_.clear();
+    slabs_.push_back(keep);
+  }
+
+  offset_in_current_slab_ = 0;
+}
+
+}  // namespace onnxruntime
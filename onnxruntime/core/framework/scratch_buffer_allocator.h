@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <vector>
+
+#include "core/framework/allocator.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+/**
+ * Bump allocator for kernel scratch memory that lives for the duration of a single Run.
+ *
+ * Allocations are carved sequentially out of slabs obtained from the upstream allocator.
+ * Free is a no-op; all memory is reclaimed at once by Reset when the owning ExecutionFrame
+ * completes, which in the steady state (a single slab sized by the first few runs) is just
+ * an offset rewind. Instances are pooled by SessionState so the slab survives across runs
+ * and the upstream allocator is only hit while the high-water mark is still growing.
+ *
+ * Thread safe for concurrent Alloc calls, as the parallel executor runs multiple kernels
+ * against the same frame. Reset must not race with Alloc; the frame destructor guarantees
+ * that as no kernel is in flight by then.
+ */
+class ScratchBufferAllocator final : public IAllocator {
+ public:
+  explicit ScratchBufferAllocator(AllocatorPtr upstream);
+  ~ScratchBufferAllocator() override;
+
+  void* Alloc(size_t size) override;
+
+  // no-op. memory is only reclaimed by Reset.
+  void Free(void* p) override;
+
+  /**
+   * Rewind the allocator so the next Alloc starts from offset 0 again.
+   * Keeps only the largest slab; any overflow slabs are released to the upstream allocator
+   * so repeated runs converge on one slab sized to the peak scratch usage.
+   */
+  void Reset();
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ScratchBufferAllocator);
+
+  struct Slab {
+    void* base;
+    size_t size;
+  };
+
+  // minimum slab size. requests larger than this get a dedicated slab.
+  static constexpr size_t kInitialSlabSize = 1 * 1024 * 1024;
+
+  AllocatorPtr upstream_;
+  std::vector<Slab> slabs_;
+  // bump offset into the last slab. slabs before the last one are full.
+  size_t offset_in_current_slab_{0};
+  OrtMutex lock_;
+};
+
+}  // namespace onnxruntime
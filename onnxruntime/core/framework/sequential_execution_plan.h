@@ -35,6 +35,11 @@ struct AllocPlanPerValue {
   // if the value is used in async kernel, a fence object would be created
   // note the fence object would be shared between MLValues reusing the same buffer
   bool create_fence_if_async{false};
+  // set on a graph output whose buffer a pure aliasing kernel's input was planned to borrow
+  // (see the reversed alias reuse in the allocation planner). When the borrowing input is
+  // allocated first, the buffer carries that input's shape until the producing node claims
+  // this output.
+  bool reused_by_aliased_input{false};
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE) 
   IntervalT life_interval{0, 0};
   IntervalT allocate_interval{0, 0};
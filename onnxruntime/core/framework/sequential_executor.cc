@@ -3,17 +3,22 @@
 
 #include "core/framework/sequential_executor.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
+#include <unordered_set>
 #include <vector>
 #include <sstream>
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
+#include "core/common/optional.h"
 #include "core/framework/allocation_planner.h"
 #include "core/framework/execution_frame.h"
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/utils.h"
+#include "core/platform/perf_counters.h"
+#include "core/platform/tracepoints.h"
 
 #if defined DEBUG_NODE_INPUTS_OUTPUTS
 #include "core/framework/debug_node_inputs_outputs_utils.h"
@@ -122,15 +127,157 @@ static Status ReleaseNodeMLValues(ExecutionFrame& frame,
                                   const SequentialExecutionPlan::NodeExecutionPlan& node_exec_plan,
                                   const logging::Logger& logger);
 
+// Number of consecutive execution plan entries, starting at start_idx, that are safe to run
+// concurrently. Group members must run on the CPU provider, or on a provider that opts into
+// concurrent dispatch (see IExecutionProvider::SupportsConcurrentNodeDispatch), without fences.
+// They must not consume a value produced by an earlier member, and may only write freshly
+// allocated buffers: a reused buffer's planned lifetime assumes the strictly sequential order and
+// could still be read by a concurrent neighbour. Returns 1 when no parallelism is available at
+// this position.
+static size_t GetIndependentGroupLength(const SessionState& session_state,
+                                        const GraphViewer& graph_viewer,
+                                        const SequentialExecutionPlan& seq_exec_plan,
+                                        size_t start_idx, size_t max_group_size) {
+  const auto& exec_plan_vec = seq_exec_plan.execution_plan;
+  const auto& name_idx_map = session_state.GetOrtValueNameIdxMap();
+  std::unordered_set<NodeIndex> group_nodes;
+  size_t len = 0;
+  while (len < max_group_size && start_idx + len < exec_plan_vec.size()) {
+    const auto node_index = exec_plan_vec[start_idx + len].node_index;
+    const Node* node = graph_viewer.GetNode(node_index);
+    if (node == nullptr || seq_exec_plan.NodeHasFence(node_index)) {
+      break;
+    }
+
+    if (node->GetExecutionProviderType() != kCpuExecutionProvider) {
+      const auto* ep = session_state.GetExecutionProviders().Get(node->GetExecutionProviderType());
+      if (ep == nullptr || !ep->SupportsConcurrentNodeDispatch()) {
+        break;
+      }
+      // control-flow kernels execute a nested graph with device state bound at kernel creation
+      // time, which the per-dispatch fencing does not cover
+      if (node->ContainsSubgraph()) {
+        break;
+      }
+      // kernels on a non-default exec queue (e.g. the CUDA EP's copy kernels) submit work to
+      // device queues outside the provider's concurrent-dispatch fencing, so keep them sequential
+      const auto* kernel = session_state.GetKernel(node_index);
+      if (kernel == nullptr || kernel->KernelDef().ExecQueueId() != 0) {
+        break;
+      }
+    }
+
+    bool writes_reused_buffer = false;
+    for (const auto* output_def : node->OutputDefs()) {
+      if (!output_def->Exists()) {
+        continue;
+      }
+      int ort_value_idx = -1;
+      if (!name_idx_map.GetIdx(output_def->Name(), ort_value_idx).IsOK()) {
+        writes_reused_buffer = true;  // unknown value; treat conservatively
+        break;
+      }
+      const auto alloc_kind = seq_exec_plan.allocation_plan[ort_value_idx].alloc_kind;
+      if (alloc_kind != AllocKind::kAllocate && alloc_kind != AllocKind::kAllocateOutput) {
+        writes_reused_buffer = true;
+        break;
+      }
+    }
+    if (writes_reused_buffer) {
+      break;
+    }
+
+    bool depends_on_group = false;
+    for (auto edge_it = node->InputEdgesBegin(); edge_it != node->InputEdgesEnd(); ++edge_it) {
+      if (group_nodes.count(edge_it->GetNode().Index()) != 0) {
+        depends_on_group = true;
+        break;
+      }
+    }
+    if (depends_on_group) {
+      break;
+    }
+
+    group_nodes.insert(node_index);
+    ++len;
+  }
+  return std::max<size_t>(len, 1);
+}
+
+// Lean execution path for a node dispatched as part of a concurrent group: kernel compute and
+// error wrapping only. Fences, profiling and node dumping are handled by the sequential main
+// loop, which does not form groups while any of those are active.
+static Status ExecuteKernelStandalone(const SessionState& session_state, ExecutionFrame& frame,
+                                      NodeIndex node_index, const logging::Logger& logger,
+                                      const bool& terminate_flag) {
+  auto p_op_kernel = session_state.GetKernel(node_index);
+  if (p_op_kernel == nullptr)
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Got nullptr from GetKernel for node index: ", node_index);
+
+  OpKernelContextInternal op_kernel_context(session_state, frame, *p_op_kernel, logger, terminate_flag);
+
+  OpStatsCollector* op_stats = session_state.GetOpStatsCollector();
+  TimePoint op_stats_begin_time;
+  size_t input_activation_sizes = 0;
+  size_t input_parameter_sizes = 0;
+  if (op_stats != nullptr) {
+    CalculateTotalInputSizes(&op_kernel_context, p_op_kernel,
+                             input_activation_sizes, input_parameter_sizes, std::string{});
+    op_stats_begin_time = std::chrono::high_resolution_clock::now();
+  }
+
+  Status compute_status;
+  ORT_TRACEPOINT_KERNEL_BEGIN(p_op_kernel->Node().OpType().c_str(), p_op_kernel->Node().Name().c_str());
+  ORT_TRY {
+#ifdef ENABLE_TRAINING
+    if (p_op_kernel->KernelDef().AllocateInputsContiguously()) {
+      ORT_RETURN_IF_ERROR(utils::VerifyInputTensorsAllocatedContiguously(&op_kernel_context));
+    }
+#endif
+
+    compute_status = p_op_kernel->Compute(&op_kernel_context);
+  }
+  ORT_CATCH(const std::exception& ex) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      compute_status = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+    });
+  }
+  ORT_TRACEPOINT_KERNEL_END(p_op_kernel->Node().OpType().c_str(), p_op_kernel->Node().Name().c_str());
+
+  if (!compute_status.IsOK()) {
+    std::ostringstream ss;
+    ss << "Non-zero status code returned while running " << p_op_kernel->Node().OpType() << " node. Name:'"
+       << p_op_kernel->Node().Name() << "' Status Message: " << compute_status.ErrorMessage();
+    const auto msg_string = ss.str();
+    LOGS(logger, ERROR) << msg_string;
+    return Status(compute_status.Category(), compute_status.Code(), msg_string);
+  }
+
+  if (op_stats != nullptr) {
+    const uint64_t op_stats_duration_ns =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::high_resolution_clock::now() - op_stats_begin_time)
+                                  .count());
+    size_t total_output_sizes = 0;
+    CalculateTotalOutputSizes(&op_kernel_context, total_output_sizes, std::string{});
+    op_stats->Record(node_index, p_op_kernel->Node().OpType().c_str(), op_stats_duration_ns,
+                     input_activation_sizes + input_parameter_sizes + total_output_sizes);
+  }
+
+  return Status::OK();
+}
+
 Status SequentialExecutor::Execute(const SessionState& session_state, const std::vector<int>& feed_mlvalue_idxs,
                                    const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
                                    std::vector<OrtValue>& fetches,
                                    const std::unordered_map<size_t, CustomAllocator>& fetch_allocators,
                                    const logging::Logger& logger) {
   const bool is_profiler_enabled = session_state.Profiler().IsEnabled();
+  OpStatsCollector* op_stats = session_state.GetOpStatsCollector();
   TimePoint tp;
   TimePoint sync_time_begin;
   TimePoint kernel_begin_time;
+  TimePoint op_stats_begin_time;
   size_t input_activation_sizes = 0;
   size_t input_parameter_sizes = 0;
   size_t total_output_sizes = 0;
@@ -139,10 +286,26 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     tp = session_state.Profiler().StartTime();
   }
 
+  // Optional hardware counter annotation of kernel profiling events. The counters follow this
+  // thread, so they attribute the executor thread's share of each kernel only.
+  optional<ThreadPerfCounters> perf_counters;
+  if (is_profiler_enabled && session_state.GetProfilePerfCounters()) {
+    perf_counters.emplace();
+    if (!perf_counters->IsValid()) {
+      LOGS(logger, WARNING) << "Hardware performance counters could not be opened; "
+                               "kernel profiling events will not be annotated.";
+      perf_counters.reset();
+    }
+  }
+
   ExecutionFrame frame{feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs, fetches, fetch_allocators, session_state};
 
 #if !defined(ORT_MINIMAL_BUILD)
-  const auto* const to_be_executed_nodes = session_state.GetToBeExecutedNodes(fetch_mlvalue_idxs);
+  // Only resolve the fetch-reachable node set when the caller asked to restrict execution to it.
+  // The lookup copies and sorts the fetch ids, which subgraph re-entry (e.g. every Loop iteration)
+  // would otherwise pay for just to throw the result away.
+  const auto* const to_be_executed_nodes =
+      only_execute_path_to_fetches_ ? session_state.GetToBeExecutedNodes(fetch_mlvalue_idxs) : nullptr;
   const bool only_execute_path_to_fetches = only_execute_path_to_fetches_ && (to_be_executed_nodes != nullptr);
 
   if (only_execute_path_to_fetches) {
@@ -192,12 +355,39 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
 #endif
 
 
-  for (const auto& node_exec_plan : exec_plan_vec) {
+  // Upper bound on independent CPU nodes dispatched concurrently over the shared intra-op pool.
+  // Groups are not formed while profiling or per-node instrumentation is active (their events
+  // assume the plan order), or while memory patterns may be in use (planned offsets assume
+  // strictly sequential value lifetimes).
+#if defined(DEBUG_NODE_INPUTS_OUTPUTS) || defined(ENABLE_NVTX_PROFILE) || defined(CONCURRENCY_VISUALIZER) || \
+    defined(ONNXRUNTIME_ENABLE_INSTRUMENT)
+  const size_t max_inter_node_parallelism = 1;
+#else
+  const size_t max_inter_node_parallelism =
+      (is_profiler_enabled || cost_summary_ != nullptr || session_state.GetEnableMemoryPattern() ||
+       session_state.GetThreadPool() == nullptr)
+          ? 1
+          : static_cast<size_t>(session_state.GetMaxInterNodeParallelism());
+#endif
+
+  for (size_t plan_idx = 0; plan_idx < exec_plan_vec.size(); ++plan_idx) {
+    const auto& node_exec_plan = exec_plan_vec[plan_idx];
     if (terminate_flag_) {
       LOGS(logger, WARNING) << "Exiting due to terminate flag being set to true.";
       return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to terminate flag being set to true.");
     }
 
+    if (deadline_ != TimePoint::max() && std::chrono::high_resolution_clock::now() >= deadline_) {
+      LOGS(logger, WARNING) << "Exiting due to the run deadline being exceeded.";
+      return ORT_MAKE_STATUS(ONNXRUNTIME, DEADLINE_EXCEEDED, "Exiting due to the run deadline being exceeded.");
+    }
+
+    // A low-priority run pauses here while a high-priority run is active, so it stops competing
+    // for the intra-op thread pool until the high-priority run completes.
+    if (priority_ == RunPriority::kLow) {
+      RunPriorityGate::Instance().YieldToHighPriorityRuns();
+    }
+
     auto node_index = node_exec_plan.node_index;
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -207,8 +397,105 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     }
 #endif
 
+    if (max_inter_node_parallelism > 1
+#if !defined(ORT_MINIMAL_BUILD)
+        && !only_execute_path_to_fetches
+#endif
+    ) {
+      const size_t group_size = GetIndependentGroupLength(session_state, graph_viewer, seq_exec_plan,
+                                                          plan_idx, max_inter_node_parallelism);
+      if (group_size > 1) {
+        VLOGS(logger, 1) << "Executing " << group_size << " independent nodes concurrently.";
+
+        // providers that opted into concurrent dispatch fence the group against their device
+        // queues: per-member slots so workers can reach their provider without a lookup
+        std::vector<const IExecutionProvider*> slot_eps(group_size, nullptr);
+        std::vector<const IExecutionProvider*> group_eps;
+        for (size_t i = 0; i < group_size; ++i) {
+          const Node* group_node = graph_viewer.GetNode(exec_plan_vec[plan_idx + i].node_index);
+          if (group_node->GetExecutionProviderType() != kCpuExecutionProvider) {
+            const auto* ep = session_state.GetExecutionProviders().Get(group_node->GetExecutionProviderType());
+            slot_eps[i] = ep;
+            if (std::find(group_eps.begin(), group_eps.end(), ep) == group_eps.end()) {
+              group_eps.push_back(ep);
+            }
+          }
+        }
+
+        Status begin_status = Status::OK();
+        size_t num_begun = 0;
+        for (; num_begun < group_eps.size(); ++num_begun) {
+          begin_status = group_eps[num_begun]->OnConcurrentDispatchBegin();
+          if (!begin_status.IsOK()) {
+            break;
+          }
+        }
+        if (!begin_status.IsOK()) {
+          // unwind the providers that did begin so their dispatch state is not left dangling
+          for (size_t i = 0; i < num_begun; ++i) {
+            ORT_IGNORE_RETURN_VALUE(group_eps[i]->OnConcurrentDispatchEnd());
+          }
+          return begin_status;
+        }
+
+        std::vector<Status> statuses(group_size);
+        // one task per node; each kernel's own parallel loops claim further threads from the
+        // same pool via work stealing, so the group cooperatively shares the available cores
+        concurrency::ThreadPool::TrySimpleParallelFor(
+            session_state.GetThreadPool(), static_cast<std::ptrdiff_t>(group_size),
+            [&](std::ptrdiff_t i) {
+              const auto* ep = slot_eps[i];
+              if (ep != nullptr) {
+                statuses[i] = ep->OnConcurrentNodeBegin();
+                if (!statuses[i].IsOK()) {
+                  return;
+                }
+              }
+
+              statuses[i] = ExecuteKernelStandalone(session_state, frame,
+                                                    exec_plan_vec[plan_idx + i].node_index, logger,
+                                                    terminate_flag_);
+
+              if (ep != nullptr) {
+                Status end_status = ep->OnConcurrentNodeEnd();
+                if (statuses[i].IsOK()) {
+                  statuses[i] = std::move(end_status);
+                }
+              }
+            });
+
+        // the join must happen even if a member failed, so the provider's queues are left in a
+        // consistent state before the error is surfaced
+        Status join_status = Status::OK();
+        for (const auto* ep : group_eps) {
+          Status status = ep->OnConcurrentDispatchEnd();
+          if (join_status.IsOK()) {
+            join_status = std::move(status);
+          }
+        }
+
+        for (size_t i = 0; i < group_size; ++i) {
+          ORT_RETURN_IF_ERROR(statuses[i]);
+        }
+        ORT_RETURN_IF_ERROR(join_status);
+        // release values in plan order only after every group member finished, so no release
+        // races with a neighbour that still reads the value
+        for (size_t i = 0; i < group_size; ++i) {
+          ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, exec_plan_vec[plan_idx + i], logger));
+        }
+        plan_idx += group_size - 1;
+        continue;
+      }
+    }
+
     const auto& node = *graph_viewer.GetNode(node_exec_plan.node_index);
 
+    // progressive initializer loading: block until this node's weights have been materialized by
+    // the background loader and back-fill the frame entries that were missing at frame creation
+    if (frame.HasPendingInitializers()) {
+      ORT_RETURN_IF_ERROR(frame.WaitForPendingInitializers(node));
+    }
+
 #ifdef CONCURRENCY_VISUALIZER
     series.write_flag(node.Name().c_str());
 #endif
@@ -303,6 +590,18 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
                                input_activation_sizes, input_parameter_sizes, node_name_for_profiling);
     }
 
+    if (op_stats != nullptr || cost_summary_ != nullptr) {
+      if (op_stats != nullptr && !is_profiler_enabled) {
+        CalculateTotalInputSizes(&op_kernel_context, p_op_kernel,
+                                 input_activation_sizes, input_parameter_sizes, node_name_for_profiling);
+      }
+      op_stats_begin_time = std::chrono::high_resolution_clock::now();
+    }
+
+    if (perf_counters.has_value()) {
+      perf_counters->Start();
+    }
+
     Status compute_status;
     {
 #ifdef CONCURRENCY_VISUALIZER
@@ -313,6 +612,7 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
           MakeString(node.OpType(), ".", node.Index(), "(", node.Name(), ")"), profile::Color::Yellow);
       node_compute_range.Begin();
 #endif
+      ORT_TRACEPOINT_KERNEL_BEGIN(node.OpType().c_str(), node.Name().c_str());
       ORT_TRY {
 #ifdef ENABLE_TRAINING
         if (p_op_kernel->KernelDef().AllocateInputsContiguously()) {
@@ -327,12 +627,18 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
           compute_status = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
         });
       }
+      ORT_TRACEPOINT_KERNEL_END(node.OpType().c_str(), node.Name().c_str());
 
 #ifdef ENABLE_NVTX_PROFILE
       node_compute_range.End();
 #endif
     }
 
+    ThreadPerfCounters::Values perf_counter_values;
+    if (perf_counters.has_value()) {
+      perf_counter_values = perf_counters->Stop();
+    }
+
     if (!compute_status.IsOK()) {
       std::ostringstream ss;
       ss << "Non-zero status code returned while running " << node.OpType() << " node. Name:'" << node.Name()
@@ -347,6 +653,21 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       return Status(compute_status.Category(), compute_status.Code(), msg_string);
     }
 
+    if (op_stats != nullptr || cost_summary_ != nullptr) {
+      const uint64_t op_stats_duration_ns =
+          static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::high_resolution_clock::now() - op_stats_begin_time)
+                                    .count());
+      if (op_stats != nullptr) {
+        CalculateTotalOutputSizes(&op_kernel_context, total_output_sizes, node_name_for_profiling);
+        op_stats->Record(node_index, node.OpType().c_str(), op_stats_duration_ns,
+                         input_activation_sizes + input_parameter_sizes + total_output_sizes);
+      }
+      if (cost_summary_ != nullptr) {
+        cost_summary_->AddKernelTime(RunCostSummary::IsCopyOp(node.OpType()), op_stats_duration_ns);
+      }
+    }
+
     if (is_profiler_enabled) {
       // Calculate total output sizes for this operation.
       CalculateTotalOutputSizes(&op_kernel_context, total_output_sizes, node_name_for_profiling);
@@ -378,6 +699,20 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
                                                          {"output_size", std::to_string(total_output_sizes)},
                                                          {"thread_scheduling_stats", concurrency::ThreadPool::StopProfiling(session_state.GetThreadPool())},
                                                      });
+
+      if (perf_counters.has_value()) {
+        // companion event so the hardware view of the kernel lines up with its time event
+        session_state.Profiler().EndTimeAndRecordEvent(profiling::NODE_EVENT,
+                                                       node_name_for_profiling + "_kernel_hw_counters",
+                                                       kernel_begin_time,
+                                                       {
+                                                           {"op_name", p_op_kernel->KernelDef().OpName()},
+                                                           {"cycles", std::to_string(perf_counter_values.cycles)},
+                                                           {"instructions", std::to_string(perf_counter_values.instructions)},
+                                                           {"llc_misses", std::to_string(perf_counter_values.llc_misses)},
+                                                       });
+      }
+
       sync_time_begin = session_state.Profiler().StartTime();
     }
 
@@ -428,6 +763,11 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     utils::DumpNodeOutputs(dump_context, op_kernel_context, p_op_kernel->Node(), session_state);
 #endif
 
+    ActivationRangeRecorder* range_recorder = session_state.GetActivationRangeRecorder();
+    if (range_recorder != nullptr && range_recorder->IsActive()) {
+      range_recorder->RecordNodeOutputs(op_kernel_context, p_op_kernel->Node());
+    }
+
     // free ml-values corresponding to this node
     VLOGS(logger, 1) << "Releasing node ML values.";
     ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, node_exec_plan, logger));
@@ -14,12 +14,17 @@
 #include "core/framework/session_state.h"
 #include "core/graph/graph_viewer.h"
 #include "core/framework/op_kernel_context_internal.h"
+#include "core/framework/run_cost_summary.h"
+#include "core/framework/run_priority.h"
 
 namespace onnxruntime {
 class SequentialExecutor : public IExecutor {
  public:
-  SequentialExecutor(const bool& terminate_flag = false, const bool only_execute_path_to_fetches = false)
-      : terminate_flag_{terminate_flag}, only_execute_path_to_fetches_(only_execute_path_to_fetches) {}
+  SequentialExecutor(const bool& terminate_flag = false, const bool only_execute_path_to_fetches = false,
+                     TimePoint deadline = TimePoint::max(), RunCostSummary* cost_summary = nullptr,
+                     RunPriority priority = RunPriority::kNormal)
+      : terminate_flag_{terminate_flag}, only_execute_path_to_fetches_(only_execute_path_to_fetches),
+        deadline_(deadline), cost_summary_(cost_summary), priority_(priority) {}
 
   common::Status Execute(const SessionState& session_state, const std::vector<int>& feed_mlvalue_idxs,
                          const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
@@ -31,5 +36,11 @@ class SequentialExecutor : public IExecutor {
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SequentialExecutor);
   const bool& terminate_flag_;
   const bool only_execute_path_to_fetches_;
+  // absolute point in time after which execution is abandoned. TimePoint::max() means no deadline.
+  const TimePoint deadline_;
+  // per-run cost breakdown to accumulate kernel/copy time into. nullptr means collection is off.
+  RunCostSummary* const cost_summary_;
+  // priority lane of this run. kLow yields to active high-priority runs between kernel dispatches.
+  const RunPriority priority_;
 };
 }  // namespace onnxruntime
@@ -13,8 +13,18 @@
 namespace onnxruntime {
 
 enum class ExecutionOrder {
-  DEFAULT = 0,        // default topological sort
-  PRIORITY_BASED = 1  // priority-based topological sort
+  DEFAULT = 0,         // default topological sort
+  PRIORITY_BASED = 1,  // priority-based topological sort
+  // topological sort that greedily schedules, among the ready nodes, those that grow the
+  // estimated live activation bytes the least. Shortens activation lifetimes and thereby the
+  // peak memory the allocation planner reserves; useful for wide models whose default order
+  // keeps many large activations alive simultaneously.
+  MEMORY_EFFICIENT = 2,
+  // topological sort that schedules consumers close to the producers of their largest inputs:
+  // among the ready nodes, the next one scheduled is the one whose estimated input bytes are the
+  // "warmest" (large tensors produced few steps ago score highest). Reduces cache thrash between
+  // kernels on graphs where the default order interleaves independent branches.
+  LOCALITY_AWARE = 3
 };
 
 enum class FreeDimensionOverrideType {
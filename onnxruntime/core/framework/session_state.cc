@@ -7,12 +7,15 @@
 
 #include "core/platform/ort_mutex.h"
 #include "core/common/logging/logging.h"
+#include "core/common/parse_string.h"
 #include "core/common/safeint.h"
 #include "core/flatbuffers/schema/ort.fbs.h"
 #include "core/framework/allocator.h"
+#include "core/framework/execution_plan_cache.h"
 #include "core/framework/node_index_info.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/ort_value_pattern_planner.h"
+#include "core/framework/scratch_buffer_allocator.h"
 #include "core/framework/session_state_flatbuffers_utils.h"
 #include "core/framework/session_state_utils.h"
 #include "core/framework/utils.h"
@@ -117,10 +120,43 @@ void SessionState::CreateGraphInfo() {
 #if !defined(ORT_MINIMAL_BUILD)
 Status SessionState::PopulateKernelCreateInfo(const KernelRegistryManager& kernel_registry_manager,
                                               bool saving_ort_format) {
+  // Structurally identical nodes resolve to the same KernelCreateInfo, so the registry search is
+  // memoized on the node's kernel signature: everything the registries examine during lookup.
+  // Models with many repeated structures (e.g. hundreds of per-feature towers) otherwise repeat
+  // the same search once per node.
+  auto make_kernel_signature = [](const Node& node) {
+    std::ostringstream signature;
+    signature << node.GetExecutionProviderType() << '|' << node.Domain() << '|' << node.OpType()
+              << '|' << node.SinceVersion();
+    for (const auto* def : node.InputDefs()) {
+      signature << '|' << (def->Exists() && def->Type() != nullptr ? *def->Type() : std::string());
+    }
+    signature << '#';
+    for (const auto* def : node.OutputDefs()) {
+      signature << '|' << (def->Exists() && def->Type() != nullptr ? *def->Type() : std::string());
+    }
+    return signature.str();
+  };
+
+  std::unordered_map<std::string, const KernelCreateInfo*> kernel_lookup_cache;
+
   for (auto& node : graph_.Nodes()) {
     const KernelCreateInfo* kci = nullptr;
 
+    const std::string signature = make_kernel_signature(node);
+    auto cached = kernel_lookup_cache.find(signature);
+    if (cached != kernel_lookup_cache.end()) {
+      ORT_IGNORE_RETURN_VALUE(
+          kernel_create_info_map_.insert({node.Index(), gsl::not_null<const KernelCreateInfo*>(cached->second)}));
+      continue;
+    }
+
     auto status = kernel_registry_manager.SearchKernelRegistry(node, &kci);
+    if (status.IsOK()) {
+      // Only direct hits are cached: the fallback below changes the node's execution provider,
+      // a side effect every node that needs it has to go through.
+      kernel_lookup_cache.insert({signature, kci});
+    }
     if (!status.IsOK() && saving_ort_format) {
       // if we didn't find the kernel and are saving to ORT format an EP that compiles nodes is enabled.
       // in that case we assigned the node to that EP but do not compile it into a fused node.
@@ -188,6 +224,12 @@ const SequentialExecutionPlan* SessionState::GetExecutionPlan() const { return p
 
 Status SessionState::AddInitializedTensor(int ort_value_index, const OrtValue& ort_value, const OrtCallback* d,
                                           bool constant, bool sparse) {
+  // when the background loader is adding entries, readers synchronize through the same lock
+  std::unique_lock<OrtMutex> lock;
+  if (progressive_init_configured_) {
+    lock = std::unique_lock<OrtMutex>(progressive_init_mutex_);
+  }
+
   auto p = initialized_tensors_.insert({ort_value_index, ort_value});
   if (!p.second)
     return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "duplicated ort_value index:", ort_value_index,
@@ -207,9 +249,241 @@ Status SessionState::AddInitializedTensor(int ort_value_index, const OrtValue& o
   }
 #endif
 
+  if (lock.owns_lock()) {
+    pending_initializers_.erase(ort_value_index);
+    lock.unlock();
+    progressive_init_cv_.notify_all();
+  }
+
+  return Status::OK();
+}
+
+Status SessionState::BeginProgressiveInitializerLoading(std::unordered_set<int> pending,
+                                                        std::function<Status()> load_fn) {
+  ORT_RETURN_IF(progressive_init_configured_, "Progressive initializer loading has already been started.");
+
+  pending_initializers_ = std::move(pending);
+  progressive_init_configured_ = true;
+
+  progressive_init_thread_ = std::thread([this, fn = std::move(load_fn)]() {
+    Status status = Status::OK();
+    ORT_TRY {
+      status = fn();
+    }
+    ORT_CATCH(const std::exception& ex) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Progressive initializer loading failed: ", ex.what());
+      });
+    }
+
+    {
+      std::lock_guard<OrtMutex> guard(progressive_init_mutex_);
+      progressive_init_status_ = status;
+      progressive_init_done_ = true;
+    }
+    progressive_init_cv_.notify_all();
+  });
+
   return Status::OK();
 }
 
+Status SessionState::WaitForNodeInitializers(const Node& node) const {
+  {
+    std::lock_guard<OrtMutex> guard(progressive_init_mutex_);
+    if (progressive_init_done_) {
+      return progressive_init_status_;
+    }
+  }
+
+  // collect the ort value indexes of the node's inputs. only initializers can be pending, and
+  // waiting on an index that is not an initializer is a no-op as it is never in the pending set.
+  std::vector<int> input_indices;
+  auto collect = [this, &input_indices](const NodeArg* def) {
+    int idx = -1;
+    if (!def->Name().empty() && ort_value_name_idx_map_.GetIdx(def->Name(), idx).IsOK()) {
+      input_indices.push_back(idx);
+    }
+  };
+  for (const NodeArg* def : node.InputDefs()) {
+    collect(def);
+  }
+  for (const NodeArg* def : node.ImplicitInputDefs()) {
+    collect(def);
+  }
+
+  std::unique_lock<OrtMutex> lock(progressive_init_mutex_);
+  progressive_init_cv_.wait(lock, [&]() {
+    if (progressive_init_done_) {
+      return true;
+    }
+    for (int idx : input_indices) {
+      if (pending_initializers_.count(idx) > 0) {
+        return false;
+      }
+    }
+    return true;
+  });
+
+  return progressive_init_done_ ? progressive_init_status_ : Status::OK();
+}
+
+std::unordered_set<int> SessionState::SnapshotPendingInitializers() const {
+  if (!progressive_init_configured_) {
+    return {};
+  }
+  std::lock_guard<OrtMutex> guard(progressive_init_mutex_);
+  return progressive_init_done_ && progressive_init_status_.IsOK() ? std::unordered_set<int>{}
+                                                                   : pending_initializers_;
+}
+
+std::unique_lock<OrtMutex> SessionState::AcquireInitializedTensorsLock() const {
+  if (!progressive_init_configured_ && !weight_updates_enabled_.load(std::memory_order_acquire)) {
+    return {};
+  }
+  return std::unique_lock<OrtMutex>(progressive_init_mutex_);
+}
+
+bool SessionState::GetProgressivelyLoadedInitializer(int ort_value_index, OrtValue& value) const {
+  std::lock_guard<OrtMutex> guard(progressive_init_mutex_);
+  auto it = initialized_tensors_.find(ort_value_index);
+  if (it == initialized_tensors_.end()) {
+    return false;
+  }
+  value = it->second;
+  return true;
+}
+
+Status SessionState::StageWeightUpdate(const std::string& name, const OrtValue& new_value) {
+  int ort_value_idx = -1;
+  ORT_RETURN_IF_ERROR(ort_value_name_idx_map_.GetIdx(name, ort_value_idx));
+
+  ORT_RETURN_IF_NOT(new_value.IsTensor(), "Weight updates are only supported for tensor initializers: ", name);
+
+  // from here on the initialized tensor readers take the lock, so the swap below cannot race an
+  // ExecutionFrame picking up the weights. sticky by design - staging is expected to be rare and
+  // an uncontended lock on the reader side is cheap.
+  weight_updates_enabled_.store(true, std::memory_order_release);
+
+  {
+    std::lock_guard<OrtMutex> guard(progressive_init_mutex_);
+
+    auto it = initialized_tensors_.find(ort_value_idx);
+    ORT_RETURN_IF(it == initialized_tensors_.end(), "'", name, "' is not an initializer in this session.");
+
+    ORT_RETURN_IF(prepacked_initializer_indexes_.count(ort_value_idx) > 0,
+                  "'", name, "' is consumed through a kernel's pre-packed form and cannot be updated in place.");
+
+#if !defined(DISABLE_SPARSE_TENSORS)
+    ORT_RETURN_IF(sparse_initialized_tensors_.count(ort_value_idx) > 0,
+                  "'", name, "' is a sparse initializer and cannot be updated in place.");
+#endif
+
+    const Tensor& old_tensor = it->second.Get<Tensor>();
+    const Tensor& new_tensor = new_value.Get<Tensor>();
+    ORT_RETURN_IF(old_tensor.DataType() != new_tensor.DataType(),
+                  "Data type mismatch for weight update of '", name, "'.");
+    ORT_RETURN_IF(old_tensor.Shape() != new_tensor.Shape(),
+                  "Shape mismatch for weight update of '", name, "'. Expected ", old_tensor.Shape(),
+                  " got ", new_tensor.Shape());
+    ORT_RETURN_IF(old_tensor.Location().device != new_tensor.Location().device,
+                  "Device mismatch for weight update of '", name, "'.");
+  }
+
+  std::lock_guard<OrtMutex> guard(staged_weight_updates_mutex_);
+  staged_weight_updates_[ort_value_idx] = new_value;
+  return Status::OK();
+}
+
+// One read per cache line is enough to fault the page back in and pull the line toward cache.
+// The XOR accumulator is ultimately written to a volatile so the reads cannot be optimized away.
+static unsigned char TouchBuffer(const void* data, size_t num_bytes) {
+  constexpr size_t kCacheLineBytes = 64;
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  unsigned char accum = 0;
+  for (size_t offset = 0; offset < num_bytes; offset += kCacheLineBytes) {
+    accum ^= bytes[offset];
+  }
+  return accum;
+}
+
+void SessionState::WarmUpMemory() const {
+  unsigned char accum = 0;
+
+  {
+    auto lock = AcquireInitializedTensorsLock();
+    for (const auto& entry : initialized_tensors_) {
+      const OrtValue& value = entry.second;
+      if (!value.IsAllocated() || !value.IsTensor()) {
+        continue;
+      }
+
+      const Tensor& tensor = value.Get<Tensor>();
+      if (tensor.Location().device.Type() != OrtDevice::CPU) {
+        continue;
+      }
+
+      const void* data = tensor.DataRaw();
+      if (data != nullptr) {
+        accum ^= TouchBuffer(data, tensor.SizeInBytes());
+      }
+    }
+  }
+
+  // shared pre-packed weights, including entries memory-mapped from a cache file whose pages the
+  // OS may have reclaimed during the idle period. The container is stable once the sessions
+  // sharing it are initialized, so no locking is needed for the reads.
+  if (prepacked_weights_container_ != nullptr) {
+    for (const auto& entry : prepacked_weights_container_->prepacked_weights_map_) {
+      const auto& packed = entry.second;
+      for (size_t i = 0; i < packed.buffers_.size(); ++i) {
+        if (packed.buffers_[i] != nullptr) {
+          accum ^= TouchBuffer(packed.buffers_[i].get(), packed.buffer_sizes_[i]);
+        }
+      }
+    }
+  }
+
+  static volatile unsigned char warm_up_sink;
+  warm_up_sink = accum;
+
+  for (const auto& node_entry : subgraph_session_states_) {
+    for (const auto& attr_entry : node_entry.second) {
+      attr_entry.second->WarmUpMemory();
+    }
+  }
+}
+
+bool SessionState::ApplyStagedWeightUpdates() {
+  std::unordered_map<int, OrtValue> staged;
+  {
+    std::lock_guard<OrtMutex> guard(staged_weight_updates_mutex_);
+    if (staged_weight_updates_.empty()) {
+      return false;
+    }
+    staged.swap(staged_weight_updates_);
+  }
+
+  // swap all staged values in under the readers' lock so a run picks up either the old or the new
+  // version of every weight, never a mix with a partially applied batch. Runs already in flight
+  // hold their own OrtValue references to the old buffers; the last one to complete releases them.
+  std::lock_guard<OrtMutex> guard(progressive_init_mutex_);
+  for (auto& entry : staged) {
+    auto it = initialized_tensors_.find(entry.first);
+    if (it == initialized_tensors_.end()) {
+      continue;
+    }
+    it->second = entry.second;
+
+    auto constant_it = constant_initialized_tensors_.find(entry.first);
+    if (constant_it != constant_initialized_tensors_.end()) {
+      constant_it->second = entry.second;
+    }
+  }
+
+  weights_version_.fetch_add(1, std::memory_order_acq_rel);
+  return true;
+}
+
 const std::unordered_map<int, OrtValue>& SessionState::GetInitializedTensors() const { return initialized_tensors_; }
 
 const std::unordered_map<int, OrtValue>& SessionState::GetConstantInitializedTensors() const {
@@ -389,6 +663,10 @@ Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::s
                 if (is_packed) {
                   ++number_of_prepacks_counter_;
 
+                  // the kernel now holds its own (re-laid-out) copy of this initializer, so it can
+                  // no longer be hot-swapped via StageWeightUpdate
+                  st->prepacked_initializer_indexes_.insert(ort_value_idx);
+
                   if (constant_initializers_use_count.count(input_name) && --constant_initializers_use_count[input_name] == 0) {
                     // release the constant initialized tensor
                     st->initialized_tensors_.erase(ort_value_idx);
@@ -425,14 +703,33 @@ Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::s
   }
 }
 
-static int64_t CalculateMemoryPatternsKey(const std::vector<std::reference_wrapper<const TensorShape>>& shapes) {
+static int64_t CalculateMemoryPatternsKey(const std::vector<std::reference_wrapper<const TensorShape>>& shapes,
+                                          int64_t bucket_granularity = 0) {
   int64_t key = 0;
   for (auto shape : shapes) {
-    for (auto dim : shape.get().GetDims()) key ^= dim;
+    for (auto dim : shape.get().GetDims()) {
+      // when bucketing is enabled all shapes whose dynamic dims round up to the same multiple of
+      // the granularity share a key, and thereby a cached memory pattern.
+      if (bucket_granularity > 0 && dim > 0) {
+        dim = ((dim + bucket_granularity - 1) / bucket_granularity) * bucket_granularity;
+      }
+      key ^= dim;
+    }
   }
   return key;
 }
 
+int64_t SessionState::GetMemoryPatternsKey(const std::vector<std::reference_wrapper<const TensorShape>>& shapes) const {
+#ifdef ENABLE_TRAINING
+  // the training pattern generation path caches inferred shapes resolved from the exact input
+  // shapes alongside the pattern. those would be wrong for other shapes in a bucket, so always
+  // use the exact key when it may be in play.
+  return CalculateMemoryPatternsKey(shapes);
+#else
+  return CalculateMemoryPatternsKey(shapes, mem_pattern_bucket_granularity_);
+#endif
+}
+
 #ifdef ENABLE_TRAINING
 namespace {
 Status ResolveDimParams(const GraphViewer& graph,
@@ -654,19 +951,20 @@ Status SessionState::GeneratePatternGroupCache(const std::vector<std::reference_
 
 const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
                                                               const std::vector<int>& feed_mlvalue_idxs,
-                                                              std::unordered_map<int, TensorShape>& inferred_shapes) const {
-  int64_t key = CalculateMemoryPatternsKey(input_shapes);
+                                                              const std::unordered_map<int, TensorShape>*& inferred_shapes) const {
+  int64_t key = GetMemoryPatternsKey(input_shapes);
 
   std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
   auto it = mem_patterns_.find(key);
   if (it == mem_patterns_.end()) {
 #ifdef ENABLE_TRAINING
     auto mem_patterns = std::make_unique<MemoryPatternGroup>();
-    if (GeneratePatternGroupCache(input_shapes, feed_mlvalue_idxs, mem_patterns.get(), inferred_shapes).IsOK()) {
-      key = CalculateMemoryPatternsKey(input_shapes);
+    std::unordered_map<int, TensorShape> generated_shapes;
+    if (GeneratePatternGroupCache(input_shapes, feed_mlvalue_idxs, mem_patterns.get(), generated_shapes).IsOK()) {
+      key = GetMemoryPatternsKey(input_shapes);
       auto ptr = mem_patterns.get();
       mem_patterns_[key] = std::move(mem_patterns);
-      shape_patterns_[key] = inferred_shapes;
+      inferred_shapes = &(shape_patterns_[key] = std::move(generated_shapes));
       return ptr;
     }
     return nullptr;
@@ -676,7 +974,10 @@ const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const std::vector<
 #endif
   }
 
-  inferred_shapes = shape_patterns_[key];
+  // hand out a pointer to the cached shape table rather than copying it per Run.
+  // entries are only ever inserted under the lock and are stable once created, so steady-state
+  // runs with the same input shapes resolve every inferred shape via table lookup.
+  inferred_shapes = &shape_patterns_[key];
   return it->second.get();
 }
 
@@ -693,17 +994,135 @@ void SessionState::ResolveMemoryPatternFlag() {
 
 Status SessionState::UpdateMemoryPatternGroupCache(const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
                                                    std::unique_ptr<MemoryPatternGroup> mem_patterns) const {
-  int64_t key = CalculateMemoryPatternsKey(input_shapes);
+  int64_t key = GetMemoryPatternsKey(input_shapes);
 
   std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
   auto it = mem_patterns_.find(key);
   if (it == mem_patterns_.end()) {
     mem_patterns_[key] = std::move(mem_patterns);
+  } else if (mem_pattern_bucket_granularity_ > 0) {
+    // with bucketing multiple shapes map to one entry. keep the pattern with the largest footprint
+    // so the cached plan converges on the bucket ceiling and covers the smaller shapes via padding.
+    auto total_peak_size = [](const MemoryPatternGroup& group) {
+      size_t total = 0;
+      for (const auto& pattern : group.patterns) total += pattern.PeakSize();
+      return total;
+    };
+
+    if (total_peak_size(*mem_patterns) > total_peak_size(*it->second)) {
+      // an in-flight ExecutionFrame may still hold a pointer to the displaced group, so retire it
+      // rather than free it. growth is bounded as the peak only increases up to the bucket ceiling.
+      retired_mem_patterns_.push_back(std::move(it->second));
+      it->second = std::move(mem_patterns);
+    }
   }
 
   return Status::OK();
 }
 
+void SessionState::SetMemoryPatternBucketGranularity(int64_t granularity) {
+  mem_pattern_bucket_granularity_ = granularity;
+  for (auto& node_entry : subgraph_session_states_) {
+    for (auto& attr_entry : node_entry.second) {
+      attr_entry.second->SetMemoryPatternBucketGranularity(granularity);
+    }
+  }
+}
+
+std::vector<OrtValue> SessionState::GetOrtValueBufferFromPool() const {
+  {
+    std::lock_guard<OrtMutex> lock(ort_value_buffer_pool_lock_);
+    if (!ort_value_buffer_pool_.empty()) {
+      std::vector<OrtValue> buffer = std::move(ort_value_buffer_pool_.back());
+      ort_value_buffer_pool_.pop_back();
+      return buffer;
+    }
+  }
+
+  return {};
+}
+
+void SessionState::ReturnOrtValueBufferToPool(std::vector<OrtValue>&& buffer) const {
+  // nothing to gain from pooling a buffer that never allocated
+  if (buffer.capacity() == 0)
+    return;
+
+  std::lock_guard<OrtMutex> lock(ort_value_buffer_pool_lock_);
+  if (ort_value_buffer_pool_.size() < kMaxPooledOrtValueBuffers) {
+    ort_value_buffer_pool_.push_back(std::move(buffer));
+  }
+}
+
+void SessionState::SetPerRunScratchArenaEnabled(bool enable) {
+  per_run_scratch_arena_enabled_ = enable;
+  for (auto& node_entry : subgraph_session_states_) {
+    for (auto& attr_entry : node_entry.second) {
+      attr_entry.second->SetPerRunScratchArenaEnabled(enable);
+    }
+  }
+}
+
+std::shared_ptr<ScratchBufferAllocator> SessionState::AcquireScratchBufferAllocator() const {
+  if (!per_run_scratch_arena_enabled_) {
+    return nullptr;
+  }
+
+  {
+    std::lock_guard<OrtMutex> lock(scratch_allocator_pool_lock_);
+    if (!scratch_allocator_pool_.empty()) {
+      std::shared_ptr<ScratchBufferAllocator> allocator = std::move(scratch_allocator_pool_.back());
+      scratch_allocator_pool_.pop_back();
+      return allocator;
+    }
+  }
+
+  AllocatorPtr cpu_allocator = GetAllocator(OrtDevice());
+  if (!cpu_allocator) {
+    return nullptr;
+  }
+
+  return std::make_shared<ScratchBufferAllocator>(std::move(cpu_allocator));
+}
+
+void SessionState::ReturnScratchBufferAllocator(std::shared_ptr<ScratchBufferAllocator>&& allocator) const {
+  allocator->Reset();
+
+  std::lock_guard<OrtMutex> lock(scratch_allocator_pool_lock_);
+  if (scratch_allocator_pool_.size() < kMaxPooledScratchAllocators) {
+    scratch_allocator_pool_.push_back(std::move(allocator));
+  }
+}
+
+BufferUniquePtr SessionState::AcquirePatternBuffer(const OrtMemoryInfo& location, size_t size) const {
+  std::lock_guard<OrtMutex> lock(pattern_buffer_pool_lock_);
+  auto it = pattern_buffer_pool_.find(location);
+  if (it != pattern_buffer_pool_.end()) {
+    auto& entries = it->second;
+    for (auto entry = entries.begin(); entry != entries.end(); ++entry) {
+      // only an exact match can be handed out. the pattern records block offsets relative to a
+      // chunk of exactly this size, and a larger chunk would pin more memory than the run needs.
+      if (entry->first == size) {
+        BufferUniquePtr buffer = std::move(entry->second);
+        entries.erase(entry);
+        return buffer;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+void SessionState::ReturnPatternBuffer(const OrtMemoryInfo& location, size_t size, BufferUniquePtr buffer) const {
+  if (!buffer)
+    return;
+
+  std::lock_guard<OrtMutex> lock(pattern_buffer_pool_lock_);
+  auto& entries = pattern_buffer_pool_[location];
+  if (entries.size() < kMaxPooledPatternBuffersPerLocation) {
+    entries.emplace_back(size, std::move(buffer));
+  }
+}
+
 bool SessionState::GetEnableMemoryPattern() const { return enable_mem_pattern_; }
 
 bool SessionState::GetEnableMemoryReuse() const { return enable_mem_reuse_; }
@@ -1233,12 +1652,70 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
   SubgraphsKernelCreateInfoMaps subgraphs_kernel_create_info_maps;
   AccumulateAllNestedSubgraphsInfo(*this, "", 0, subgraphs_kernel_create_info_maps);
 
-  SequentialPlannerContext context(session_options.execution_mode, session_options.execution_order, session_options.enable_mem_reuse);
-  ORT_RETURN_IF_ERROR(SequentialPlanner::CreatePlan(parent_node, *graph_viewer_, valid_outer_scope_node_args,
-                                                    execution_providers_, kernel_create_info_map_,
-                                                    subgraphs_kernel_create_info_maps,
-                                                    outer_scope_node_arg_to_location_map,
-                                                    ort_value_name_idx_map_, context, p_seq_exec_plan_));
+  {
+    const std::string max_inter_node_parallelism_str = session_options.config_options.GetConfigOrDefault(
+        kOrtSessionOptionsConfigMaxInterNodeParallelism, "1");
+    int max_inter_node_parallelism = 1;
+    if (!TryParseStringWithClassicLocale(max_inter_node_parallelism_str, max_inter_node_parallelism) ||
+        max_inter_node_parallelism < 1) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid value for ",
+                             kOrtSessionOptionsConfigMaxInterNodeParallelism, ": ",
+                             max_inter_node_parallelism_str);
+    }
+    max_inter_node_parallelism_ = max_inter_node_parallelism;
+  }
+
+  if (session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigCollectOpStats, "0") == "1") {
+    op_stats_collector_ = std::make_unique<OpStatsCollector>(static_cast<size_t>(graph_.MaxNodeIndex()));
+  }
+
+  profile_perf_counters_ =
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigProfilePerfCounters, "0") == "1";
+
+  bool execution_plan_loaded_from_cache = false;
+#if !defined(ORT_MINIMAL_BUILD) && !defined(ORT_MEMORY_PROFILE)
+  // subgraph plans are not cached; only the main graph plan is large enough to matter.
+  const bool execution_plan_cache_enabled = parent_node == nullptr && !execution_plan_cache_path_.empty();
+  if (execution_plan_cache_enabled) {
+    size_t artifact_size = 0;
+    if (Env::Default().GetFileLength(execution_plan_cache_path_.c_str(), artifact_size).IsOK()) {
+      auto cached_plan = std::make_unique<SequentialExecutionPlan>();
+      const Status load_status = execution_plan_cache::LoadExecutionPlan(execution_plan_cache_path_, *graph_viewer_,
+                                                                        ort_value_name_idx_map_, *this, *cached_plan);
+      if (load_status.IsOK()) {
+        p_seq_exec_plan_ = std::move(cached_plan);
+        execution_plan_loaded_from_cache = true;
+        LOGS(logger_, INFO) << "Loaded the execution plan from the cache, skipping the allocation planner.";
+      } else {
+        // a stale or corrupt artifact must not fail initialization; re-plan and overwrite it below.
+        LOGS(logger_, WARNING) << "Ignoring unusable execution plan cache artifact "
+                               << ToMBString(execution_plan_cache_path_) << ": " << load_status.ErrorMessage();
+      }
+    }
+  }
+#endif
+
+  if (!execution_plan_loaded_from_cache) {
+    SequentialPlannerContext context(session_options.execution_mode, session_options.execution_order,
+                                     session_options.enable_mem_reuse);
+    ORT_RETURN_IF_ERROR(SequentialPlanner::CreatePlan(parent_node, *graph_viewer_, valid_outer_scope_node_args,
+                                                      execution_providers_, kernel_create_info_map_,
+                                                      subgraphs_kernel_create_info_maps,
+                                                      outer_scope_node_arg_to_location_map,
+                                                      ort_value_name_idx_map_, context, p_seq_exec_plan_));
+
+#if !defined(ORT_MINIMAL_BUILD) && !defined(ORT_MEMORY_PROFILE)
+    if (execution_plan_cache_enabled) {
+      // the cache is best effort, so a failed write only costs the next session its fast start
+      const Status save_status = execution_plan_cache::SaveExecutionPlan(execution_plan_cache_path_,
+                                                                        *p_seq_exec_plan_);
+      if (!save_status.IsOK()) {
+        LOGS(logger_, WARNING) << "Failed to write the execution plan cache artifact "
+                               << ToMBString(execution_plan_cache_path_) << ": " << save_status.ErrorMessage();
+      }
+    }
+#endif
+  }
   //Record the allocation plan
 
   // Uncomment the below to dump the allocation plan to std::cout
@@ -1271,26 +1748,79 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
 
   const auto& initializer_allocation_order = p_seq_exec_plan_->initializer_allocation_order;
 
-  // move initializers from TensorProto instances in Graph to OrtValue instances in SessionState
-  ORT_RETURN_IF_ERROR(
-      session_state_utils::SaveInitializedTensors(
-          Env::Default(), graph_location, *graph_viewer_,
-          execution_providers_.GetDefaultCpuAllocator(),
-          ort_value_name_idx_map_, initializer_allocation_order, *tensor_allocator,
-          [this](int idx, const OrtValue& value, const OrtCallback& d, bool constant, bool sparse) -> Status {
-            return AddInitializedTensor(idx, value, &d, constant, sparse);
-          },
-          logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options));
+  // when the initializers will be removed from the graph anyway, release each weight's proto data
+  // as soon as it has been saved instead of keeping two full copies of the weights alive until
+  // CleanInitializedTensorsFromGraph below
+  session_state_utils::ReleaseInitializerDataFunction release_initializer_data_func;
+  if (remove_initializers) {
+    release_initializer_data_func = [this](const std::string& name) { graph_.ReleaseInitializerData(name); };
+  }
+
+  // progressive initializer loading defers weight materialization to a background thread so the
+  // session becomes runnable immediately, with the executor gating each node on the arrival of
+  // its weights. It is limited to configurations where nothing after this point needs the
+  // materialized weights: sequential single-node dispatch (the frame back-fill is not
+  // synchronized for concurrently executing nodes), no pre-packing, no subgraphs, and no
+  // initializer doubling as a graph output (the frame copies those to fetch buffers up front).
+  bool progressive_init = false;
+  if (parent_node == nullptr &&
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigProgressiveInitializerLoading,
+                                                        "0") == "1") {
+#ifndef ENABLE_TRAINING
+    const bool prepacking_disabled =
+        session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigDisablePrepacking, "0") == "1";
+#else
+    const bool prepacking_disabled = true;  // no pre-packing under training
+#endif
+
+    bool initializer_is_output = false;
+    for (const NodeArg* output : graph_viewer_->GetOutputs()) {
+      if (graph_.GetAllInitializedTensors().count(output->Name()) > 0) {
+        initializer_is_output = true;
+        break;
+      }
+    }
+
+    // if the optimized model is written out after initialization it reads the graph proto the
+    // loader would concurrently be releasing, so load synchronously in that case
+    const bool model_saved_after_init =
+        !session_options.optimized_model_filepath.empty() ||
+        !session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigOptimizedModelCacheDir,
+                                                           "").empty();
+
+    progressive_init = prepacking_disabled && !initializer_is_output && !model_saved_after_init &&
+                       subgraph_session_states_.empty() &&
+                       session_options.execution_mode == ExecutionMode::ORT_SEQUENTIAL &&
+                       max_inter_node_parallelism_ <= 1;
+    if (!progressive_init) {
+      LOGS(logger_, INFO) << "Progressive initializer loading was requested but is not applicable to this "
+                             "session configuration; initializers load synchronously.";
+    }
+  }
+
+  if (!progressive_init) {
+    // move initializers from TensorProto instances in Graph to OrtValue instances in SessionState
+    ORT_RETURN_IF_ERROR(
+        session_state_utils::SaveInitializedTensors(
+            Env::Default(), graph_location, *graph_viewer_,
+            execution_providers_.GetDefaultCpuAllocator(),
+            ort_value_name_idx_map_, initializer_allocation_order, *tensor_allocator,
+            [this](int idx, const OrtValue& value, const OrtCallback& d, bool constant, bool sparse) -> Status {
+              return AddInitializedTensor(idx, value, &d, constant, sparse);
+            },
+            logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options,
+            release_initializer_data_func, thread_pool_));
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
-  //Record Weight allocation info on device
-  MemoryInfo::RecordInitializerAllocInfo(GetInitializedTensors());
+    //Record Weight allocation info on device
+    MemoryInfo::RecordInitializerAllocInfo(GetInitializedTensors());
 #endif
 
-  // remove weights from the graph now to save memory but in many cases it won't save memory, if the tensor was
-  // preallocated with the some other tensors in a single 'allocate' call, which is very common.
-  // TODO: make it better
-  if (remove_initializers) {
-    CleanInitializedTensorsFromGraph();
+    // remove weights from the graph now to save memory but in many cases it won't save memory, if the tensor was
+    // preallocated with the some other tensors in a single 'allocate' call, which is very common.
+    // TODO: make it better
+    if (remove_initializers) {
+      CleanInitializedTensorsFromGraph();
+    }
   }
 
   ORT_RETURN_IF_ERROR(CreateKernels(kernel_registry_manager));
@@ -1354,6 +1884,45 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
     }
   }
 
+  if (progressive_init) {
+    std::unordered_set<int> pending;
+    for (const auto& entry : graph_.GetAllInitializedTensors()) {
+      int idx = -1;
+      if (ort_value_name_idx_map_.GetIdx(entry.first, idx).IsOK()) {
+        pending.insert(idx);
+      }
+    }
+
+    LOGS(logger_, INFO) << "Loading " << pending.size()
+                        << " initializers in the background; nodes become runnable as their weights arrive.";
+
+    ORT_RETURN_IF_ERROR(BeginProgressiveInitializerLoading(
+        std::move(pending),
+        // the loader may outlive the caller's stack, so everything it needs that is not owned by
+        // this SessionState is captured by value
+        [this, graph_location,
+         tensor_allocator = std::shared_ptr<ITensorAllocator>(tensor_allocator.release()),
+         session_options = session_options,
+         release_initializer_data_func, remove_initializers]() -> Status {
+          ORT_RETURN_IF_ERROR(
+              session_state_utils::SaveInitializedTensors(
+                  Env::Default(), graph_location, *graph_viewer_,
+                  execution_providers_.GetDefaultCpuAllocator(),
+                  ort_value_name_idx_map_, p_seq_exec_plan_->initializer_allocation_order, *tensor_allocator,
+                  [this](int idx, const OrtValue& value, const OrtCallback& d, bool constant, bool sparse) -> Status {
+                    return AddInitializedTensor(idx, value, &d, constant, sparse);
+                  },
+                  logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options,
+                  release_initializer_data_func, thread_pool_));
+
+          if (remove_initializers) {
+            CleanInitializedTensorsFromGraph();
+          }
+
+          return Status::OK();
+        }));
+  }
+
   return Status::OK();
 }
 
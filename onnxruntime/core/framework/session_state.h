@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <map>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -32,6 +34,9 @@
 #include "core/platform/ort_mutex.h"
 #include "core/platform/path_lib.h"
 #include "core/platform/threadpool.h"
+#include "core/framework/activation_range_recorder.h"
+#include "core/framework/op_stats_collector.h"
+
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
 #include "core/framework/memory_info.h"
 #endif
@@ -54,6 +59,7 @@ class ExecutionProviders;
 class KernelDef;
 class OpKernel;
 class NodeIndexInfo;
+class ScratchBufferAllocator;
 struct SequentialExecutionPlan;
 struct MemoryPatternGroup;
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
@@ -111,6 +117,10 @@ class SessionState {
   }
 
   ~SessionState() {
+    // a progressive initializer loader still running references this instance
+    if (progressive_init_thread_.joinable()) {
+      progressive_init_thread_.join();
+    }
     for (auto* p : session_kernels_) {
       delete p;
     }
@@ -169,6 +179,50 @@ class SessionState {
      */
   const std::unordered_map<int, OrtValue>& GetConstantInitializedTensors() const;
 
+  // Progressive initializer loading (see kOrtSessionOptionsConfigProgressiveInitializerLoading):
+  // FinalizeSessionStateImpl registers 'pending' as the set of initializer ort value indexes that
+  // are not yet materialized and runs 'load_fn' - which must materialize them all via
+  // AddInitializedTensor - on a background thread. The executor gates each node on
+  // WaitForNodeInitializers until loading completes.
+  Status BeginProgressiveInitializerLoading(std::unordered_set<int> pending, std::function<Status()> load_fn);
+
+  // Blocks until every initializer consumed by 'node' has been added, or loading failed.
+  // Returns the loader's status on failure. Cheap no-op once loading has completed.
+  Status WaitForNodeInitializers(const Node& node) const;
+
+  // Indexes of initializers that are still being loaded. Empty unless progressive loading is
+  // active. Used by ExecutionFrame to know which value table entries to back-fill later.
+  std::unordered_set<int> SnapshotPendingInitializers() const;
+
+  // Lock that makes reading GetInitializedTensors() safe against the background loader adding
+  // entries and against staged weight updates being swapped in. Returns an unowned lock when
+  // neither progressive loading nor weight updates have ever been used.
+  std::unique_lock<OrtMutex> AcquireInitializedTensorsLock() const;
+
+  // Thread-safe lookup of a single initializer added by the background loader.
+  // Returns false if it has not been added (loading failed or is still in flight).
+  bool GetProgressivelyLoadedInitializer(int ort_value_index, OrtValue& value) const;
+
+  // Weight hot-swap (see InferenceSession::StageWeightUpdate): validates that 'new_value' matches
+  // the existing initializer's data type, shape and device and stages it for the next swap.
+  // Initializers consumed through a kernel's pre-packed form cannot be updated as the packed copy
+  // would go stale.
+  Status StageWeightUpdate(const std::string& name, const OrtValue& new_value);
+
+  // Swaps all staged weight updates into the initializer store in one step and bumps the weights
+  // version. Returns true if anything was applied. Runs already in flight hold their own
+  // references to the previous buffers, so those are released only once the last such run
+  // completes.
+  bool ApplyStagedWeightUpdates();
+
+  // Monotonic version of the initializer store; starts at 0 and increments per applied swap.
+  uint64_t GetWeightsVersion() const { return weights_version_.load(std::memory_order_acquire); }
+
+  // Touches the CPU initializer buffers and the shared pre-packed weight buffers (one read per
+  // cache line) so an idle session's weight pages are faulted back in and pulled toward cache
+  // before the next Run. Recurses into subgraph session states. See InferenceSession::WarmUp.
+  void WarmUpMemory() const;
+
 #if !defined(DISABLE_SPARSE_TENSORS)
   bool IsSparseInitializer(int ort_value_index) const;
 #endif
@@ -207,13 +261,38 @@ class SessionState {
   */
   profiling::Profiler& Profiler() const noexcept { return profiler_; }
 
+  /**
+  Get the activation range recorder for this session, or nullptr when runtime activation range
+  tracking is not enabled.
+  */
+  ActivationRangeRecorder* GetActivationRangeRecorder() const noexcept {
+    return activation_range_recorder_.get();
+  }
+
+  void SetActivationRangeRecorder(std::unique_ptr<ActivationRangeRecorder> recorder) {
+    activation_range_recorder_ = std::move(recorder);
+  }
+
+  /**
+  Get the aggregated per-op statistics collector for this session, or nullptr when op stats
+  collection is not enabled.
+  */
+  OpStatsCollector* GetOpStatsCollector() const noexcept { return op_stats_collector_.get(); }
+
+  /**
+  Whether kernel profiling events should be annotated with hardware performance counters.
+  Configured via kOrtSessionOptionsConfigProfilePerfCounters; only honored while profiling
+  is enabled.
+  */
+  bool GetProfilePerfCounters() const noexcept { return profile_perf_counters_; }
+
   /**
   Get cached memory pattern based on input shapes
   */
   const MemoryPatternGroup* GetMemoryPatternGroup(
       const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
       const std::vector<int>& feed_mlvalue_idxs,
-      std::unordered_map<int, TensorShape>& inferred_shapes) const;
+      const std::unordered_map<int, TensorShape>*& inferred_shapes) const;
 
   /**
   Set generated memory pattern with a given input shapes.
@@ -222,6 +301,62 @@ class SessionState {
   Status UpdateMemoryPatternGroupCache(const std::vector<std::reference_wrapper<const TensorShape>>& input_shape,
                                        std::unique_ptr<MemoryPatternGroup> mem_patterns) const;
 
+  /**
+  Set the granularity used to bucket input shapes when looking up cached memory patterns.
+  All shapes whose dynamic dims round up to the same multiple of the granularity share one
+  cached pattern; smaller shapes in a bucket are placed in the (padded) blocks of that pattern.
+  0 disables bucketing and keys the cache on exact shapes.
+  Applied recursively to subgraph session states, so call after FinalizeSessionState.
+  */
+  void SetMemoryPatternBucketGranularity(int64_t granularity);
+  int64_t GetMemoryPatternBucketGranularity() const { return mem_pattern_bucket_granularity_; }
+
+  /**
+  Get a pooled OrtValue buffer for use as an ExecutionFrame value table.
+  Returns an empty vector (possibly with retained capacity) that the frame resizes to its needs.
+  Const as it's an internal cache only.
+  */
+  std::vector<OrtValue> GetOrtValueBufferFromPool() const;
+
+  /**
+  Return an OrtValue buffer to the pool so a later ExecutionFrame can reuse its capacity.
+  The buffer must no longer reference any values.
+  */
+  void ReturnOrtValueBufferToPool(std::vector<OrtValue>&& buffer) const;
+
+  /**
+  Enable or disable routing kernel temp-space allocations through a per-Run scratch arena.
+  Applied recursively to subgraph session states, so call after FinalizeSessionState.
+  */
+  void SetPerRunScratchArenaEnabled(bool enable);
+  bool GetPerRunScratchArenaEnabled() const { return per_run_scratch_arena_enabled_; }
+
+  /**
+  Get a pooled per-Run scratch allocator for an ExecutionFrame's temp-space allocations.
+  Returns nullptr if the per-Run scratch arena is disabled or no CPU allocator is registered.
+  Const as it's an internal cache only.
+  */
+  std::shared_ptr<ScratchBufferAllocator> AcquireScratchBufferAllocator() const;
+
+  /**
+  Reset a scratch allocator and return it to the pool so a later ExecutionFrame reuses its slab.
+  No allocation made from it may still be in use.
+  */
+  void ReturnScratchBufferAllocator(std::shared_ptr<ScratchBufferAllocator>&& allocator) const;
+
+  /**
+  Get a pooled memory pattern chunk buffer of exactly 'size' bytes on 'location', or a null
+  BufferUniquePtr if none is available. Lets a new ExecutionFrame adopt the chunk a completed
+  frame of the same graph used, which matters most for control flow subgraphs where a frame is
+  created per Loop iteration. Const as it's an internal cache only.
+  */
+  BufferUniquePtr AcquirePatternBuffer(const OrtMemoryInfo& location, size_t size) const;
+
+  /**
+  Return a memory pattern chunk buffer to the pool. Nothing may still point into the buffer.
+  */
+  void ReturnPatternBuffer(const OrtMemoryInfo& location, size_t size, BufferUniquePtr buffer) const;
+
   bool GetUseDeterministicCompute() const { return use_deterministic_compute_; }
 
   /**
@@ -278,6 +413,13 @@ class SessionState {
   concurrency::ThreadPool* GetThreadPool() const noexcept { return thread_pool_; }
   concurrency::ThreadPool* GetInterOpThreadPool() const noexcept { return inter_op_thread_pool_; }
 
+  /**
+  Maximum number of independent, fence free CPU nodes the sequential executor may dispatch
+  concurrently over the shared intra-op thread pool. 1 means strictly sequential execution.
+  Configured via kOrtSessionOptionsConfigMaxInterNodeParallelism.
+  */
+  int GetMaxInterNodeParallelism() const noexcept { return max_inter_node_parallelism_; }
+
   bool ExportDll() const noexcept { return export_fused_dll_; }
   void SetExportDllFlag(bool flag) noexcept { export_fused_dll_ = flag; }
 
@@ -306,6 +448,17 @@ class SessionState {
                            const KernelRegistryManager& kernel_registry_manager);
 #endif
 
+#if !defined(ORT_MINIMAL_BUILD)
+  // Sets the path of the serialized execution plan artifact that rides alongside the optimized
+  // model cache. When set, FinalizeSessionState loads the execution plan from the artifact instead
+  // of running the allocation planner, or writes the artifact after planning if it does not exist
+  // yet. Only valid for a session whose graph was loaded from the matching cached model, as the
+  // plan records value and node indexes of that graph.
+  void SetExecutionPlanCachePath(const std::basic_string<PATH_CHAR_TYPE>& path) {
+    execution_plan_cache_path_ = path;
+  }
+#endif
+
   Status FinalizeSessionState(const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
                               KernelRegistryManager& kernel_registry_manager,
                               const SessionOptions& session_options = {},
@@ -464,15 +617,68 @@ class SessionState {
   // This data structure is for uninitializing string tensors and
   // munmap memory region and close file descriptor
   std::unordered_map<int, OrtCallback> deleter_for_initialized_tensors_;
+
+  // progressive initializer loading state (see BeginProgressiveInitializerLoading).
+  // progressive_init_configured_ is set once, before the loader thread starts, and makes
+  // AddInitializedTensor and the initialized tensor readers take progressive_init_mutex_.
+  bool progressive_init_configured_ = false;
+  mutable OrtMutex progressive_init_mutex_;
+  mutable OrtCondVar progressive_init_cv_;
+  std::unordered_set<int> pending_initializers_;
+  bool progressive_init_done_ = false;
+  Status progressive_init_status_;
+  std::thread progressive_init_thread_;
+
+  // staged weight updates (hot reload). weight_updates_enabled_ is set (and stays set) on first
+  // use and makes the initialized tensor readers take progressive_init_mutex_, so a swap never
+  // races an ExecutionFrame picking up the weights.
+  mutable OrtMutex staged_weight_updates_mutex_;
+  std::unordered_map<int, OrtValue> staged_weight_updates_;
+  std::atomic<bool> weight_updates_enabled_{false};
+  std::atomic<uint64_t> weights_version_{0};
+
+  // ort_value indexes whose consuming kernels hold a pre-packed copy of the initializer
+  std::unordered_set<int> prepacked_initializer_indexes_;
+
   std::vector<BufferUniquePtr> weights_buffers_;
   std::unique_ptr<SequentialExecutionPlan> p_seq_exec_plan_ = nullptr;
 
   const logging::Logger& logger_;
   profiling::Profiler& profiler_;
 
+  // non-null only when runtime activation range tracking is enabled for this session
+  std::unique_ptr<ActivationRangeRecorder> activation_range_recorder_;
+
+  // non-null only when aggregated per-op statistics collection is enabled for this session
+  std::unique_ptr<OpStatsCollector> op_stats_collector_;
+
+  // annotate kernel profiling events with hardware performance counters
+  bool profile_perf_counters_ = false;
+
   // switch for enable memory pattern optimization or not.
   bool enable_mem_pattern_;
 
+  // pool of ExecutionFrame value table buffers so steady-state Run calls reuse their capacity.
+  // capped so a burst of concurrent runs doesn't pin memory indefinitely.
+  static constexpr size_t kMaxPooledOrtValueBuffers = 32;
+  mutable OrtMutex ort_value_buffer_pool_lock_;
+  mutable std::vector<std::vector<OrtValue>> ort_value_buffer_pool_;
+
+  // switch for routing kernel temp-space allocations through a per-Run scratch arena.
+  bool per_run_scratch_arena_enabled_ = false;
+
+  // pool of per-Run scratch allocators. same capping rationale as the value table buffer pool.
+  static constexpr size_t kMaxPooledScratchAllocators = 32;
+  mutable OrtMutex scratch_allocator_pool_lock_;
+  mutable std::vector<std::shared_ptr<ScratchBufferAllocator>> scratch_allocator_pool_;
+
+  // compute the memory pattern cache key for the given input shapes, applying shape bucketing
+  // when enabled.
+  int64_t GetMemoryPatternsKey(const std::vector<std::reference_wrapper<const TensorShape>>& shapes) const;
+
+  // granularity for bucketing input shapes in the memory pattern cache. 0 means exact shapes.
+  int64_t mem_pattern_bucket_granularity_ = 0;
+
   // lock for the mem_patterns_
   mutable OrtMutex mem_patterns_lock_;
 
@@ -480,6 +686,16 @@ class SessionState {
   mutable std::map<int64_t, std::unique_ptr<MemoryPatternGroup>> mem_patterns_;
   mutable std::map<int64_t, std::unordered_map<int, TensorShape>> shape_patterns_;
 
+  // pattern groups displaced from mem_patterns_ by a larger pattern for the same shape bucket.
+  // kept alive for the session lifetime as ExecutionFrames hold raw pointers to cached groups.
+  mutable std::vector<std::unique_ptr<MemoryPatternGroup>> retired_mem_patterns_;
+
+  // pool of memory pattern chunk buffers, keyed by location with (size, buffer) entries.
+  // kept small as these chunks cover a whole run's planned activations and can be large.
+  static constexpr size_t kMaxPooledPatternBuffersPerLocation = 8;
+  mutable OrtMutex pattern_buffer_pool_lock_;
+  mutable std::map<OrtMemoryInfo, std::vector<std::pair<size_t, BufferUniquePtr>>> pattern_buffer_pool_;
+
   NameNodeInfoMapType input_names_to_nodeinfo_mapping_;
   NameNodeInfoMapType output_names_to_nodeinfo_mapping_;
 
@@ -489,6 +705,15 @@ class SessionState {
   concurrency::ThreadPool* const thread_pool_{};
   concurrency::ThreadPool* const inter_op_thread_pool_{};
 
+  // upper bound on independent nodes the sequential executor dispatches concurrently.
+  // set during FinalizeSessionState from the session configuration; 1 disables the feature.
+  int max_inter_node_parallelism_ = 1;
+
+#if !defined(ORT_MINIMAL_BUILD)
+  // non-empty when the serialized execution plan cache is enabled. see SetExecutionPlanCachePath.
+  std::basic_string<PATH_CHAR_TYPE> execution_plan_cache_path_;
+#endif
+
   bool export_fused_dll_ = false;
   FuncManager fused_funcs_mgr_;
   const DataTransferManager& data_transfer_mgr_;
@@ -22,9 +22,12 @@
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
 #include "core/framework/bfc_arena.h"
+#include "core/framework/endian.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
 #include "core/framework/mem_buffer.h"
+#include "core/framework/shared_initializer_container.h"
 #include "core/framework/tensor_allocator.h"
+#include "core/platform/threadpool.h"
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
 #include "core/framework/memory_info.h"
 #endif
@@ -127,6 +130,38 @@ static common::Status DeserializeTensorProto(const Env& env, const std::basic_st
   return common::Status::OK();
 }
 
+// Creates an OrtValue over a memory mapping of the tensor's external data file region instead of
+// copying the bytes into an allocated buffer. The mapping is private (copy-on-write), so the clean
+// pages are shared with other processes mapping the same file and nothing can write through to it.
+// Ownership of the mapping is returned in 'deleter', which the caller must invoke (or register with
+// the session state) to release it.
+static common::Status DeserializeMappedTensorProto(const Env& env, const std::basic_string<PATH_CHAR_TYPE>& proto_path,
+                                                   const ONNX_NAMESPACE::TensorProto& tensor_proto,
+                                                   const AllocatorPtr& cpu_alloc,
+                                                   OrtValue& ort_value, OrtCallback& deleter) {
+  std::basic_string<ORTCHAR_T> external_file_path;
+  FileOffsetType file_offset;
+  size_t tensor_byte_size;
+  ORT_RETURN_IF_ERROR(utils::GetExternalDataInfo(tensor_proto, proto_path.c_str(), external_file_path,
+                                                 file_offset, tensor_byte_size));
+
+  TensorShape tensor_shape{utils::GetTensorShapeFromTensorProto(tensor_proto)};
+  const DataTypeImpl* const type = DataTypeImpl::TensorTypeFromONNXEnum(tensor_proto.data_type())->GetElementType();
+
+  Env::MappedMemoryPtr mapped_memory{};
+  ORT_RETURN_IF_ERROR(env.MapFileIntoMemory(external_file_path.c_str(), file_offset, tensor_byte_size,
+                                            mapped_memory));
+
+  auto p_tensor = std::make_unique<Tensor>(type, tensor_shape, mapped_memory.get(), cpu_alloc->Info());
+
+  deleter = mapped_memory.get_deleter().callback;
+  mapped_memory.release();
+
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  ort_value.Init(p_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+  return common::Status::OK();
+}
+
 common::Status SaveInitializedTensors(
     const Env& env, const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
     const GraphViewer& graph, const AllocatorPtr& default_cpu_alloc,
@@ -136,7 +171,9 @@ common::Status SaveInitializedTensors(
     const SaveTensorFunction& save_tensor_func,
     const logging::Logger& logger, const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
-    const SessionOptions& session_options) {
+    const SessionOptions& session_options,
+    const ReleaseInitializerDataFunction& release_initializer_data_func,
+    concurrency::ThreadPool* thread_pool) {
   LOGS(logger, INFO) << "Saving initialized tensors.";
   ORT_ENFORCE(ort_value_name_idx_map.MaxIdx() > -1, "OrtValue indexes should have been populated.");
 
@@ -169,6 +206,37 @@ common::Status SaveInitializedTensors(
     return retval;
   };
 
+  // cross-session sharing only applies to CPU-resident non-string initializers. shared tensors get
+  // their own buffer (outside the planned arena block) so a deduplicated copy can actually be freed.
+  const bool share_initializers_across_sessions =
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigShareInitializersAcrossSessions,
+                                                        "0") == "1";
+  auto use_shared_initializer = [share_initializers_across_sessions, &exec_plan](
+                                    int ort_value_index, const ONNX_NAMESPACE::TensorProto& tensor_proto) -> bool {
+    return share_initializers_across_sessions &&
+           tensor_proto.data_type() != ONNX_NAMESPACE::TensorProto_DataType_STRING &&
+           exec_plan.GetLocation(ort_value_index).device.Type() == OrtDevice::CPU;
+  };
+
+  // zero-copy loading only applies to CPU-resident non-string initializers stored as external
+  // data. the raw little-endian file bytes become the tensor buffer directly, so big-endian
+  // targets (which need a byte swap on load) go through the usual copying path.
+  const bool memory_map_initializers =
+      endian::native == endian::little &&
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigUseMemoryMappedInitializers,
+                                                        "0") == "1";
+  auto use_memory_mapped_initializer = [memory_map_initializers, &exec_plan, &initializer_allocation_order](
+                                           int ort_value_index, const ONNX_NAMESPACE::TensorProto& tensor_proto) -> bool {
+    // tensors with a required allocation order must land in the planned contiguous block,
+    // which a file mapping cannot satisfy
+    return memory_map_initializers &&
+           utils::HasExternalData(tensor_proto) &&
+           tensor_proto.data_type() != ONNX_NAMESPACE::TensorProto_DataType_STRING &&
+           exec_plan.GetLocation(ort_value_index).device.Type() == OrtDevice::CPU &&
+           std::find(initializer_allocation_order.cbegin(), initializer_allocation_order.cend(),
+                     ort_value_index) == initializer_allocation_order.cend();
+  };
+
   //1. first plan the memory
   const onnxruntime::InitializedTensorSet& initialized_tensor_set = graph.GetAllInitializedTensors();
   std::unordered_map<int, const ONNX_NAMESPACE::TensorProto*> id_to_initialized_tensor;
@@ -201,6 +269,14 @@ common::Status SaveInitializedTensors(
       // do not trace string tensor
       continue;
     }
+    if (use_memory_mapped_initializer(entry.first, *entry.second)) {
+      // memory-mapped initializers wrap the file mapping directly and need no planned buffer
+      continue;
+    }
+    if (use_shared_initializer(entry.first, *entry.second)) {
+      // candidates for cross-session sharing are individually allocated, not placed in the arena block
+      continue;
+    }
     ORT_RETURN_IF_ERROR(planner.Trace(entry.first, entry.second));
   }
   //2. allocate weight buffer on different locations
@@ -220,46 +296,106 @@ common::Status SaveInitializedTensors(
                        << i.second << " bytes for " << i.first << std::endl;
   }
 
-  OrtCallback deleter{nullptr, nullptr};
+  //3. create weight tensors based on weights buffer.
+  // materialization of the individual tensors is independent work: the planned buffers are
+  // disjoint slices of the already allocated block and the allocators are thread safe, so the
+  // deserialization (endian handling, memcpy, device copies) is spread over the intra-op pool.
+  // registration with the session state stays on this thread, in a deterministic order.
+  const bool use_device_allocator_for_initializers =
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
+
+  std::vector<std::pair<int, const ONNX_NAMESPACE::TensorProto*>> entries(id_to_initialized_tensor.cbegin(),
+                                                                          id_to_initialized_tensor.cend());
+  std::vector<OrtValue> ort_values(entries.size());
+  std::vector<OrtCallback> deleters(entries.size(), OrtCallback{nullptr, nullptr});
+  std::vector<Status> deserialize_statuses(entries.size());
+
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(entries.size()),
+      [&](std::ptrdiff_t i) {
+        const int ort_value_index = entries[i].first;
+        const ONNX_NAMESPACE::TensorProto& tensor_proto = *entries[i].second;
+        const char* name = (tensor_proto.name().empty()) ? "" : tensor_proto.name().c_str();
+        OrtValue& ort_value = ort_values[i];
+
+        if (user_supplied_initializer_ids.find(ort_value_index) != user_supplied_initializer_ids.end()) {
+          ort_value = *(session_options.initializers_to_share_map.at(name));
+          LOGS(logger, INFO) << "Using user supplied initializer with name (" << name << ").";
+          return;
+        }
 
-  //3. create weight tensors based on weights buffer
-  for (const auto& entry : id_to_initialized_tensor) {
-    int ort_value_index = entry.first;
-    const char* name = (entry.second->name().empty()) ? "" : entry.second->name().c_str();
-    OrtValue ort_value;
+        // memory mapping supersedes cross-session sharing: the mapped pages are already shared
+        // through the page cache
+        const bool memory_mapped = use_memory_mapped_initializer(ort_value_index, tensor_proto);
+        const bool shareable = !memory_mapped && use_shared_initializer(ort_value_index, tensor_proto);
+
+        Status st;
+        if (memory_mapped) {
+          st = DeserializeMappedTensorProto(env, graph_loc, tensor_proto, default_cpu_alloc, ort_value, deleters[i]);
+        } else {
+          std::unique_ptr<MemBuffer> m;
+          AllocatorPtr alloc;
+          if (shareable) {
+            // use a standalone CPU allocation so a duplicate can be dropped in favor of the shared copy
+            alloc = default_cpu_alloc;
+          } else {
+            // TODO: if the tensor need be copied, does it have enough room?
+            st = planner.GetPreallocatedBuffer(ort_value_index, name, m, alloc);
+            if (!st.IsOK()) {
+              deserialize_statuses[i] = st;
+              return;
+            }
+          }
+
+          st = DeserializeTensorProto(env, graph_loc, tensor_proto, m.get(), alloc, default_cpu_alloc, ort_value,
+                                      data_transfer_mgr, use_device_allocator_for_initializers);
+        }
+        if (!st.IsOK()) {
+          std::ostringstream oss;
+          oss << "Deserialize tensor " << name << " failed." << st.ErrorMessage();
+          deserialize_statuses[i] = Status(st.Category(), st.Code(), oss.str());
+          return;
+        }
 
-    if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
-      ort_value = *(session_options.initializers_to_share_map.at(name));
-      LOGS(logger, INFO) << "Using user supplied initializer with name (" << name << ").";
-    } else {
-      const ONNX_NAMESPACE::TensorProto& tensor_proto = *(entry.second);
-
-      std::unique_ptr<MemBuffer> m;
-      AllocatorPtr alloc;
-      // TODO: if the tensor need be copied, does it have enough room?
-      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m, alloc));
-      bool use_device_allocator_for_initializers =
-          session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
-
-      Status st = DeserializeTensorProto(env, graph_loc, tensor_proto, m.get(), alloc, default_cpu_alloc, ort_value,
-                                         data_transfer_mgr, use_device_allocator_for_initializers);
-      if (!st.IsOK()) {
-        std::ostringstream oss;
-        oss << "Deserialize tensor " << name << " failed." << st.ErrorMessage();
-        return Status(st.Category(), st.Code(), oss.str());
+        if (shareable) {
+          // adopt an identical tensor registered by another session if one exists, releasing ours
+          ort_value = SharedInitializerContainer::GetInstance().GetOrAdd(ort_value);
+        }
+      });
+
+  for (const auto& status : deserialize_statuses) {
+    if (!status.IsOK()) {
+      // none of the values have been registered yet, so release any mappings created for the others
+      // before bailing out
+      for (auto& d : deleters) {
+        if (d.f != nullptr) {
+          d.f(d.param);
+        }
       }
+      return status;
     }
+  }
+
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const int ort_value_index = entries[i].first;
+    const char* name = (entries[i].second->name().empty()) ? "" : entries[i].second->name().c_str();
 
     // any outer scope value is shadowed by a local value and can't override it.
     // due to that check_outer_scope is false
     const bool constant = graph.IsConstantInitializer(name, /* check_outer_scope */ false);
 #if !defined(DISABLE_SPARSE_TENSORS)
     const bool sparse = graph.GetGraph().IsSparseInitializer(name);
-    ORT_RETURN_IF_ERROR(save_tensor_func(ort_value_index, ort_value, deleter, constant, sparse));
+    ORT_RETURN_IF_ERROR(save_tensor_func(ort_value_index, ort_values[i], deleters[i], constant, sparse));
 #else
-    ORT_RETURN_IF_ERROR(save_tensor_func(ort_value_index, ort_value, deleter, constant, false));
+    ORT_RETURN_IF_ERROR(save_tensor_func(ort_value_index, ort_values[i], deleters[i], constant, false));
 #endif
 
+    // release the TensorProto copy of the data as each weight is saved so it does not outlive
+    // session state finalization
+    if (release_initializer_data_func) {
+      release_initializer_data_func(entries[i].second->name());
+    }
+
     VLOGS(logger, 1) << "Added weight with name : " << name << " with index: " << ort_value_index;
   }
 
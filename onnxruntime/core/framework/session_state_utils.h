@@ -29,9 +29,16 @@ namespace logging {
 class Logger;
 }
 
+namespace concurrency {
+class ThreadPool;
+}
+
 namespace session_state_utils {
 using SaveTensorFunction = std::function<Status(int idx, const OrtValue& value, const OrtCallback& d,
                                                 bool constant, bool sparse)>;
+// called after an initializer has been saved to the session state so the caller can release the
+// TensorProto copy of the data. may be empty if the proto copies need to outlive finalization.
+using ReleaseInitializerDataFunction = std::function<void(const std::string& name)>;
 common::Status SaveInitializedTensors(
     const Env& env, const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
     const GraphViewer& graph, const AllocatorPtr& default_cpu_memory_info,
@@ -41,7 +48,9 @@ common::Status SaveInitializedTensors(
     const logging::Logger& logger,
     const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
-    const SessionOptions& session_options);
+    const SessionOptions& session_options,
+    const ReleaseInitializerDataFunction& release_initializer_data_func = {},
+    concurrency::ThreadPool* thread_pool = nullptr);
 common::Status SaveInputOutputNamesToNodeMapping(const GraphViewer& graph,
                                                  SessionState& session_state,
                                                  const std::vector<const NodeArg*>& implicit_inputs);
@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/shared_initializer_container.h"
+
+#include <cstring>
+
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+
+namespace {
+// FNV-1a, matching the simple content hashing used elsewhere for weight caching
+uint64_t HashBytes(const void* data, size_t num_bytes, uint64_t hash) {
+  constexpr uint64_t kPrime = 1099511628211ULL;
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < num_bytes; ++i) {
+    hash = (hash ^ bytes[i]) * kPrime;
+  }
+  return hash;
+}
+}  // namespace
+
+SharedInitializerContainer& SharedInitializerContainer::GetInstance() {
+  static SharedInitializerContainer instance;
+  return instance;
+}
+
+uint64_t SharedInitializerContainer::HashTensor(const Tensor& tensor) {
+  uint64_t hash = 14695981039346656037ULL;  // FNV offset basis
+
+  const int32_t element_type = tensor.GetElementType();
+  hash = HashBytes(&element_type, sizeof(element_type), hash);
+
+  const auto& dims = tensor.Shape().GetDims();
+  if (!dims.empty()) {
+    hash = HashBytes(dims.data(), dims.size() * sizeof(int64_t), hash);
+  }
+
+  const size_t num_bytes = tensor.SizeInBytes();
+  if (num_bytes > 0) {
+    hash = HashBytes(tensor.DataRaw(), num_bytes, hash);
+  }
+
+  return hash;
+}
+
+bool SharedInitializerContainer::TensorsAreIdentical(const Tensor& lhs, const Tensor& rhs) {
+  if (lhs.GetElementType() != rhs.GetElementType() || lhs.Shape() != rhs.Shape()) {
+    return false;
+  }
+
+  const size_t num_bytes = lhs.SizeInBytes();
+  return num_bytes == 0 || memcmp(lhs.DataRaw(), rhs.DataRaw(), num_bytes) == 0;
+}
+
+OrtValue SharedInitializerContainer::GetOrAdd(const OrtValue& value) {
+  const Tensor& tensor = value.Get<Tensor>();
+
+  // string tensors own per-element allocations that can't be shared by buffer identity
+  if (tensor.IsDataTypeString()) {
+    return value;
+  }
+
+  const uint64_t hash = HashTensor(tensor);
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+  auto& bucket = values_[hash];
+  for (const OrtValue& existing : bucket) {
+    if (TensorsAreIdentical(existing.Get<Tensor>(), tensor)) {
+      return existing;
+    }
+  }
+
+  bucket.push_back(value);
+  return value;
+}
+
+size_t SharedInitializerContainer::GetNumberOfElements() const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  size_t count = 0;
+  for (const auto& entry : values_) {
+    count += entry.second.size();
+  }
+  return count;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/ort_value.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+class Tensor;
+
+/**
+ * Process-wide container that deduplicates identical initializer tensors across sessions.
+ *
+ * Sessions that enable kOrtSessionOptionsConfigShareInitializersAcrossSessions register each
+ * CPU-resident initializer here after deserialization. If another session already registered a
+ * tensor with the same type, shape and content, the freshly deserialized copy is dropped and the
+ * shared OrtValue is used instead, so N sessions of the same base model keep one copy of each
+ * weight. The shared buffers must be treated as read-only.
+ *
+ * The container keeps one reference to every registered value for the lifetime of the process,
+ * mirroring the lifetime contract of PrepackedWeightsContainer based sharing.
+ */
+class SharedInitializerContainer final {
+ public:
+  static SharedInitializerContainer& GetInstance();
+
+  // Returns an already registered OrtValue whose tensor is identical in type, shape and content
+  // to 'value', registering 'value' as the shared copy if no such entry exists yet.
+  OrtValue GetOrAdd(const OrtValue& value);
+
+  // Returns the number of distinct tensors held by the container.
+  size_t GetNumberOfElements() const;
+
+ private:
+  SharedInitializerContainer() = default;
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SharedInitializerContainer);
+
+  static uint64_t HashTensor(const Tensor& tensor);
+  static bool TensorsAreIdentical(const Tensor& lhs, const Tensor& rhs);
+
+  mutable OrtMutex mutex_;
+
+  // values bucketed by content hash. the bucket is a vector so hash collisions fall back to a
+  // full comparison instead of incorrectly sharing.
+  std::unordered_map<uint64_t, std::vector<OrtValue>> values_;
+};
+
+}  // namespace onnxruntime
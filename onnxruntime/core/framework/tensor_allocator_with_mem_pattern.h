@@ -41,7 +41,8 @@ class TensorAllocatorWithMemPattern : public ITensorAllocator {
       if (alloc->Info().alloc_type == OrtArenaAllocator) {
         // Arena has a specific way to store static memory.
         // Arena does not reuse static memory allocated by Reserve.
-        buffer = static_cast<BFCArena*>(alloc.get())->Reserve(peak_size);
+        // Reserve is virtual on IAllocator so this dispatches to the concrete arena implementation.
+        buffer = alloc->Reserve(peak_size);
       } else {
         buffer = alloc->Alloc(peak_size);
       }
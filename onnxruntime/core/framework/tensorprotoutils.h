@@ -57,6 +57,22 @@ common::Status TensorProtoToTensor(const Env& env, const ORTCHAR_T* model_path,
                                    const ONNX_NAMESPACE::TensorProto& tensor_proto,
                                    Tensor& tensor);
 
+/**
+ * @brief Resolve the file path, offset and byte size of a TensorProto's external data
+ * @param tensor_proto    must have external data
+ * @param model_path      path of the model the tensor belongs to. Relative external data paths are
+ *                        resolved against its directory. Can be NULL, in which case they are
+ *                        resolved against the current working directory.
+ * @param external_file_path  resolved path of the file holding the data
+ * @param file_offset     byte offset of the data within the file
+ * @param tensor_byte_size    byte size of the data, validated against the tensor's type and shape
+*/
+common::Status GetExternalDataInfo(const ONNX_NAMESPACE::TensorProto& tensor_proto,
+                                   const ORTCHAR_T* model_path,
+                                   std::basic_string<ORTCHAR_T>& external_file_path,
+                                   FileOffsetType& file_offset,
+                                   size_t& tensor_byte_size);
+
 /** Creates a TensorProto from a Tensor.
     @param[in] tensor the Tensor whose data and shape will be used to create the TensorProto.
     @param[in] tensor_proto_name the name of the TensorProto.
@@ -3,8 +3,10 @@
 #include "core/graph/onnx_protobuf.h"
 #include "core/framework/utils.h"
 
+#include <chrono>
 #include <iomanip>
 
+#include "core/common/optional.h"
 #include "core/graph/graph_viewer.h"
 #include "core/framework/data_transfer_manager.h"
 #include "core/framework/execution_frame.h"
@@ -579,17 +581,28 @@ static common::Status ExecuteGraphImpl(const SessionState& session_state,
                                        const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
                                        const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators,
                                        ExecutionMode execution_mode, const bool& terminate_flag,
-                                       const logging::Logger& logger, const bool only_execute_path_to_fetches = false) {
-  std::unique_ptr<IExecutor> p_exec;
+                                       const logging::Logger& logger, const bool only_execute_path_to_fetches = false,
+                                       TimePoint deadline = TimePoint::max(),
+                                       RunCostSummary* cost_summary = nullptr,
+                                       RunPriority priority = RunPriority::kNormal) {
+  // The executors only hold the flags captured at construction, so they live on the stack.
+  // Subgraph re-entry (each If branch, Loop/Scan iteration) runs through here once per
+  // iteration and should not pay a heap allocation every time.
+  optional<SequentialExecutor> sequential_executor;
+  optional<ParallelExecutor> parallel_executor;
+  IExecutor* p_exec = nullptr;
   if (execution_mode == ExecutionMode::ORT_SEQUENTIAL) {
-    p_exec = std::unique_ptr<IExecutor>(new SequentialExecutor(terminate_flag, only_execute_path_to_fetches));
+    sequential_executor.emplace(terminate_flag, only_execute_path_to_fetches, deadline, cost_summary, priority);
+    p_exec = &*sequential_executor;
   } else if (execution_mode == ExecutionMode::ORT_PARALLEL) {
     auto* p_inter_op_thread_pool = session_state.GetInterOpThreadPool();
     if (!p_inter_op_thread_pool) {
       LOGS(logger, WARNING) << "Only one thread was configured for parallel execution. Hence will use sequential execution.";
-      p_exec = std::unique_ptr<IExecutor>(new SequentialExecutor(terminate_flag, only_execute_path_to_fetches));
+      sequential_executor.emplace(terminate_flag, only_execute_path_to_fetches, deadline, cost_summary, priority);
+      p_exec = &*sequential_executor;
     } else {
-      p_exec = std::unique_ptr<IExecutor>(new ParallelExecutor(session_state, terminate_flag));
+      parallel_executor.emplace(session_state, terminate_flag);
+      p_exec = &*parallel_executor;
     }
   }
 
@@ -611,7 +624,13 @@ static common::Status ExecuteGraphImpl(const SessionState& session_state,
 
     if (device_copy_checks.input_copy_needed == DeviceCopyCheck::Copy) {
       const auto& feed_copy_info = feeds_fetches_manager.GetFeedsDeviceCopyInfo();
+      const TimePoint copy_start = cost_summary != nullptr ? std::chrono::high_resolution_clock::now() : TimePoint{};
       ORT_RETURN_IF_ERROR(CopyInputsAcrossDevices(session_state, feeds, device_feeds, feed_copy_info));
+      if (cost_summary != nullptr) {
+        cost_summary->AddCopyTime(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                            std::chrono::high_resolution_clock::now() - copy_start)
+                                                            .count()));
+      }
       p_feeds = &device_feeds;
     }
 
@@ -640,7 +659,13 @@ static common::Status ExecuteGraphImpl(const SessionState& session_state,
                                         logger));
 
     if (device_copy_checks.output_copy_needed == DeviceCopyCheck::Copy) {
+      const TimePoint copy_start = cost_summary != nullptr ? std::chrono::high_resolution_clock::now() : TimePoint{};
       ORT_RETURN_IF_ERROR(CopyOutputsAcrossDevices(session_state, *p_fetches, fetches, fetch_copy_info));
+      if (cost_summary != nullptr) {
+        cost_summary->AddCopyTime(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                            std::chrono::high_resolution_clock::now() - copy_start)
+                                                            .count()));
+      }
     }
   }
 
@@ -651,14 +676,16 @@ common::Status ExecuteGraph(const SessionState& session_state,
                             FeedsFetchesManager& feeds_fetches_manager,
                             const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
                             ExecutionMode execution_mode, const bool& terminate_flag,
-                            const logging::Logger& logger, bool only_execute_path_to_fetches) {
+                            const logging::Logger& logger, bool only_execute_path_to_fetches,
+                            TimePoint deadline, RunCostSummary* cost_summary, RunPriority priority) {
   ORT_RETURN_IF_ERROR(utils::InitializeFeedFetchCopyInfo(session_state, feeds_fetches_manager));
 
   // finalize the copy info using the provided feeds and fetches. will update device_copy_checks in the background
   FinalizeFeedFetchCopyInfo(feeds_fetches_manager, feeds, fetches);
 
   auto status = ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, {},
-                                 execution_mode, terminate_flag, logger, only_execute_path_to_fetches);
+                                 execution_mode, terminate_flag, logger, only_execute_path_to_fetches,
+                                 deadline, cost_summary, priority);
 
   return status;
 }
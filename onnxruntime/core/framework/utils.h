@@ -8,6 +8,7 @@
 #include "core/framework/data_types.h"
 #include "core/framework/framework_common.h"
 #include "core/framework/iexecutor.h"
+#include "core/framework/run_priority.h"
 #include "core/framework/session_state.h"
 #include "core/framework/session_options.h"
 #ifdef ENABLE_TRAINING
@@ -30,6 +31,7 @@ class KernelDef;
 class KernelRegistryManager;
 class IExecutionProvider;
 class Node;
+class RunCostSummary;
 class Tensor;
 struct KernelCreateInfo;
 
@@ -86,10 +88,18 @@ void FinalizeFeedFetchCopyInfo(FeedsFetchesManager& feeds_fetches_manager,
                                const std::vector<const OrtMemoryInfo*>& fetch_alloc_info);
 
 // Execute the main graph. The feed_fetches_manager will be finalized based on the provided feeds and fetches.
+// If 'deadline' is not TimePoint::max(), sequential execution checks it between kernel dispatches and aborts
+// with a DEADLINE_EXCEEDED status once it has passed.
+// If 'cost_summary' is provided, sequential execution accumulates per-category (kernel/copy) time into it.
+// 'priority' selects the run's priority lane: a low-priority run yields to active high-priority runs
+// between kernel dispatches (see RunPriorityGate).
 common::Status ExecuteGraph(const SessionState& session_state, FeedsFetchesManager& feeds_fetches_manager,
                             const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
                             ExecutionMode execution_mode, const bool& terminate_flag, const logging::Logger& logger,
-                            bool only_execute_path_to_fetches = false);
+                            bool only_execute_path_to_fetches = false,
+                            TimePoint deadline = TimePoint::max(),
+                            RunCostSummary* cost_summary = nullptr,
+                            RunPriority priority = RunPriority::kNormal);
 
 #ifdef ENABLE_TRAINING
 common::Status ExecutePartialGraph(const SessionState& session_state, FeedsFetchesManager& feeds_fetches_manager,
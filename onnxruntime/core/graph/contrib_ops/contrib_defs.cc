@@ -2636,6 +2636,91 @@ It's an extension of Gelu. It takes the sum of input A and bias input B as the i
           "Constrain input and output types to float tensors.")
       .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput);
 
+  static const char* FusedElementwise_ver1_doc =
+      R"DOC(Applies a chain of binary elementwise operations to an input in a single pass over the data.
+Step i computes 'acc = acc op[i] operands[i]' starting with acc = X; the 'SubRev' and 'DivRev'
+variants place the operand on the left-hand side instead. Each operand must be unidirectionally
+broadcastable to the shape of X, which is also the shape of the output.
+This op is internal, produced by the ElementwiseFusion graph transformer.)DOC";
+  ONNX_CONTRIB_OPERATOR_SCHEMA(FusedElementwise)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(FusedElementwise_ver1_doc)
+      .Attr("ops",
+            "The operation applied at each step. Each entry is one of "
+            "'Add', 'Sub', 'SubRev', 'Mul', 'Div', 'DivRev'.",
+            AttributeProto::STRINGS)
+      .Input(0, "X", "The input the operation chain starts from.", "T")
+      .Input(1, "operands", "The second operand of each step, in order.", "T", OpSchema::Variadic)
+      .Output(0, "Y", "The output, with the same shape as X.", "T")
+      .TypeConstraint(
+          "T",
+          {"tensor(float)"},
+          "Constrain input and output types to float tensors.")
+      .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput);
+
+  static const char* FusedGatherND_ver1_doc =
+      R"DOC(GatherND with a scale/bias epilogue applied while each slice is gathered, computing
+'output = GatherND(data, indices) * scale + bias' in a single pass over the gathered data.
+Both 'scale' and 'bias' are optional and must be a scalar or have exactly as many elements
+as one gathered slice, in which case they apply elementwise to every slice.
+This op is internal, produced by the GatherNDFusion graph transformer.)DOC";
+  ONNX_CONTRIB_OPERATOR_SCHEMA(FusedGatherND)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(FusedGatherND_ver1_doc)
+      .Attr("batch_dims",
+            "The number of batch dimensions. The gather of indexing starts from dimension of data[batch_dims:]",
+            AttributeProto::INT,
+            static_cast<int64_t>(0))
+      .Input(0, "data", "Tensor of rank r >= 1.", "T")
+      .Input(1, "indices", "Tensor of rank q >= 1.", "Tind")
+      .Input(2, "scale", "Multiplied into the gathered output.", "T", OpSchema::Optional)
+      .Input(3, "bias", "Added to the gathered output.", "T", OpSchema::Optional)
+      .Output(0, "output", "Tensor of rank q + r - indices_shape[-1] - 1 - batch_dims.", "T")
+      .TypeConstraint(
+          "T",
+          {"tensor(float)"},
+          "Constrain input and output types to float tensors.")
+      .TypeConstraint(
+          "Tind",
+          {"tensor(int64)"},
+          "Constrain indices to int64")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 0, 0);
+        if (!hasNInputShapes(ctx, 2)) {
+          return;
+        }
+        auto& data_shape = ctx.getInputType(0)->tensor_type().shape();
+        auto& indices_shape = ctx.getInputType(1)->tensor_type().shape();
+        auto data_rank = data_shape.dim_size();
+        auto indices_rank = indices_shape.dim_size();
+        if (data_rank < 1 || indices_rank < 1) {
+          fail_shape_inference("both data and indices tensor need to have rank larger than zero.");
+        }
+        const auto* batch_dims_attr = ctx.getAttribute("batch_dims");
+        const int64_t batch_dims = batch_dims_attr != nullptr ? batch_dims_attr->i() : 0;
+        if (!indices_shape.dim(indices_rank - 1).has_dim_value()) {
+          return;
+        }
+        auto last_indices_dimension = batch_dims + indices_shape.dim(indices_rank - 1).dim_value();
+        if (last_indices_dimension > data_rank) {
+          fail_shape_inference("last dimension of indices must not be larger than rank of data tensor");
+        }
+        for (int i = 0; i < indices_rank - 1; ++i) {
+          *ctx.getOutputType(0)
+               ->mutable_tensor_type()
+               ->mutable_shape()
+               ->add_dim() = indices_shape.dim(i);
+        }
+        for (int i = static_cast<int>(last_indices_dimension); i < data_rank; ++i) {
+          *ctx.getOutputType(0)
+               ->mutable_tensor_type()
+               ->mutable_shape()
+               ->add_dim() = data_shape.dim(i);
+        }
+      });
+
   // Used to be ONNX 1.7 Inverse(12)
   // Comment out docs not to increase the binary size
   //
@@ -428,6 +428,59 @@ C (int32) = (A - A_zero_point) * (B - B_zero_point)
         ONNX_NAMESPACE::matmulShapeInference(ctx, 0, 1);
       });
 
+  ONNX_CONTRIB_OPERATOR_SCHEMA(MatMulIntNWeight)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(
+          "Matrix product of a float activation A and a weight-only quantized matrix B, "
+          "where B is stored as 4 bit or 8 bit unsigned integers with per-group scales and is "
+          "dequantized on the fly as (q - zero_point) * scale. "
+          "For bits == 8 input B has shape [K, N]. For bits == 4 input B has shape [ceil(K / 2), N] "
+          "with two consecutive rows packed into one byte: row 2 * i in the low nibble and row "
+          "2 * i + 1 in the high nibble. A group is 'group_size' consecutive rows of the unpacked B "
+          "sharing one scale and zero point per column; group_size 0 means a single group spanning "
+          "all of K. When zero_points is not provided the zero point is 8 for bits == 4 and 128 for "
+          "bits == 8.")
+      .Attr("K", "Number of rows of the unpacked weight B.", AttributeProto::INT)
+      .Attr("bits", "Number of bits per weight element, 4 or 8.", AttributeProto::INT, static_cast<int64_t>(8))
+      .Attr("group_size",
+            "Number of rows of the unpacked weight B sharing one scale, 0 means a single group "
+            "spanning all of K.",
+            AttributeProto::INT, static_cast<int64_t>(0))
+      .Input(0, "A", "N-dimensional float matrix A, with last dimension K", "T1")
+      .Input(1, "B", "Quantized weight, [K, N] for bits == 8 or [ceil(K / 2), N] for bits == 4", "T2")
+      .Input(2, "scales", "Per-group, per-column scales of B, [ceil(K / group_size), N]", "T1")
+      .Input(3, "zero_points",
+             "Per-group, per-column zero points of B, [ceil(K / group_size), N]. Optional; "
+             "for bits == 4 the value is stored unpacked in the low nibble.",
+             "T2",
+             OpSchema::Optional)
+      .Output(0, "Y", "Matrix multiply results from A * dequantize(B)", "T1")
+      .TypeConstraint(
+          "T1",
+          {"tensor(float)"},
+          "Constrain input A, scales and output Y data type as float tensor.")
+      .TypeConstraint(
+          "T2",
+          {"tensor(uint8)"},
+          "Constrain input B and zero_points data type to 8-bit unsigned integer tensor.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 0, 0);
+        if (!hasInputShape(ctx, 0) || !hasInputShape(ctx, 2)) {
+          return;
+        }
+        const auto& a_shape = getInputShape(ctx, 0);
+        const auto& scales_shape = getInputShape(ctx, 2);
+        if (a_shape.dim_size() < 1 || scales_shape.dim_size() != 2) {
+          fail_shape_inference("Input A must be at least 1-D and scales must be 2-D");
+        }
+        auto* output_shape = ctx.getOutputType(0)->mutable_tensor_type()->mutable_shape();
+        for (int i = 0; i < a_shape.dim_size() - 1; ++i) {
+          *output_shape->add_dim() = a_shape.dim(i);
+        }
+        *output_shape->add_dim() = scales_shape.dim(1);
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(QLinearAdd)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -753,6 +753,7 @@ Node::Definitions& Node::MutableDefinitions() noexcept {
   // someone fetching these is going to change something
   graph_->SetGraphResolveNeeded();
   graph_->SetGraphProtoSyncNeeded();
+  graph_->MarkNodeModified(index_);
   return definitions_;
 }
 
@@ -760,6 +761,7 @@ Node::Relationships& Node::MutableRelationships() noexcept {
   // someone fetching these is going to change something
   graph_->SetGraphResolveNeeded();
   graph_->SetGraphProtoSyncNeeded();
+  graph_->MarkNodeModified(index_);
   return relationships_;
 }
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
@@ -781,6 +783,7 @@ void Node::CreateSubgraph(const std::string& attr_name) {
 void Node::AddAttribute(const std::string& attr_name, const AttributeProto& value) {
   graph_->SetGraphResolveNeeded();
   graph_->SetGraphProtoSyncNeeded();
+  graph_->MarkNodeModified(index_);
   attributes_[attr_name] = value;
 }
 
@@ -788,6 +791,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
   void Node::AddAttribute(const std::string& attr_name, const type& value) { \
     graph_->SetGraphResolveNeeded();                                         \
     graph_->SetGraphProtoSyncNeeded();                                       \
+    graph_->MarkNodeModified(index_);                                        \
     AttributeProto a;                                                        \
     a.set_name(attr_name);                                                   \
     a.set_type(enumType);                                                    \
@@ -799,6 +803,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
   void Node::AddAttribute(const std::string& attr_name, const type& value) { \
     graph_->SetGraphResolveNeeded();                                         \
     graph_->SetGraphProtoSyncNeeded();                                       \
+    graph_->MarkNodeModified(index_);                                        \
     AttributeProto a;                                                        \
     a.set_name(attr_name);                                                   \
     a.set_type(enumType);                                                    \
@@ -811,6 +816,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
                           const std::vector<type>& values) { \
     graph_->SetGraphResolveNeeded();                         \
     graph_->SetGraphProtoSyncNeeded();                       \
+    graph_->MarkNodeModified(index_);                        \
     AttributeProto a;                                        \
     a.set_name(attr_name);                                   \
     a.set_type(enumType);                                    \
@@ -823,6 +829,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
 void Node::AddAttribute(const std::string& attr_name, const GraphProto& value) {
   graph_->SetGraphResolveNeeded();
   graph_->SetGraphProtoSyncNeeded();
+  graph_->MarkNodeModified(index_);
   AttributeProto a;
   a.set_name(attr_name);
   a.set_type(AttributeProto_AttributeType::AttributeProto_AttributeType_GRAPH);
@@ -855,6 +862,7 @@ ADD_LIST_ATTR_IMPL(SparseTensorProto, AttributeProto_AttributeType::AttributePro
 bool Node::ClearAttribute(const std::string& attr_name) {
   graph_->SetGraphResolveNeeded();
   graph_->SetGraphProtoSyncNeeded();
+  graph_->MarkNodeModified(index_);
   return attributes_.erase(attr_name) > 0;
 }
 
@@ -1075,9 +1083,12 @@ Graph::Graph(const Model& owning_model,
 
     // Remove sparse_initializers from protobuf to save memory as they are converted to dense now
     graph_proto_->mutable_sparse_initializer()->Clear();
-    const int sparse_num_cleared = graph_proto_->sparse_initializer().ClearedCount();
-    for (int i = 0; i < sparse_num_cleared; ++i) {
-      delete graph_proto_->mutable_sparse_initializer()->ReleaseCleared();
+    // cleared elements of an arena-allocated proto belong to the arena and must not be deleted
+    if (graph_proto_->GetArena() == nullptr) {
+      const int sparse_num_cleared = graph_proto_->sparse_initializer().ClearedCount();
+      for (int i = 0; i < sparse_num_cleared; ++i) {
+        delete graph_proto_->mutable_sparse_initializer()->ReleaseCleared();
+      }
     }
   }
 #endif
@@ -1945,6 +1956,13 @@ class InferenceContextImpl : public ONNX_NAMESPACE::InferenceContext {
   }
 
   const TensorProto* getInputData(size_t index) const override {
+    // record the access so ShapeInferenceMemo knows the inference result depends on this
+    // input's data and not just its type.
+    if (std::find(read_input_data_indices_.cbegin(), read_input_data_indices_.cend(), index) ==
+        read_input_data_indices_.cend()) {
+      read_input_data_indices_.push_back(index);
+    }
+
     auto def = node_.InputDefs()[index];
     if (!def)
       return nullptr;
@@ -1955,6 +1973,9 @@ class InferenceContextImpl : public ONNX_NAMESPACE::InferenceContext {
     return initializer;
   }
 
+  // the input indices whose data the inference function read via getInputData
+  const std::vector<size_t>& ReadInputDataIndices() const { return read_input_data_indices_; }
+
   // ORT does not implement partial data propagation yet so just return nullptr.
   const TensorShapeProto* getSymbolicInput(size_t) const override {
     return nullptr;
@@ -1991,6 +2012,124 @@ class InferenceContextImpl : public ONNX_NAMESPACE::InferenceContext {
   std::vector<std::unique_ptr<GraphInferencerImpl>> graph_inferencers_;
   const Graph& graph_;
   const Graph::ResolveOptions& options_;
+  mutable std::vector<size_t> read_input_data_indices_;
+};
+
+// Memo of per-node ONNX shape inference results, scoped to one resolve pass.
+// Models that tile many structurally identical towers pay the operator inference cost for every
+// clone, although the cloned nodes differ only in names. A node's inference result is determined
+// by its schema, attributes and input types, so results are shared across clones via a key built
+// from those. Inference functions may additionally read constant input data (e.g. Reshape reads
+// its shape input); each entry records the data that was read and a hit requires it to match.
+class ShapeInferenceMemo {
+ public:
+  struct Entry {
+    std::vector<TypeProto> output_types;
+    // serialized constant data of each input the inference function read, by input index
+    std::vector<std::pair<size_t, std::string>> read_input_data;
+  };
+
+  // Builds the lookup key for a node. Returns false if the node's result should not be memoized:
+  // subgraph inference mutates the subgraph so control flow nodes are excluded, and oversized
+  // attributes (e.g. Constant tensors) would make the key more expensive than the inference.
+  static bool BuildKey(const Node& node, const OpSchema& op, std::string& key) {
+    if (node.ContainsSubgraph()) {
+      return false;
+    }
+
+    key.clear();
+    const auto op_identity = reinterpret_cast<uintptr_t>(&op);
+    key.append(reinterpret_cast<const char*>(&op_identity), sizeof(op_identity));
+    key.append(std::to_string(node.InputDefs().size())).append(1, ' ');
+    key.append(std::to_string(node.OutputDefs().size())).append(1, ' ');
+
+    std::vector<const NodeAttributes::value_type*> attrs;
+    attrs.reserve(node.GetAttributes().size());
+    for (const auto& attr : node.GetAttributes()) {
+      attrs.push_back(&attr);
+    }
+    std::sort(attrs.begin(), attrs.end(),
+              [](const NodeAttributes::value_type* l, const NodeAttributes::value_type* r) {
+                return l->first < r->first;
+              });
+
+    for (const auto* attr : attrs) {
+      const std::string attr_bytes = attr->second.SerializeAsString();
+      if (attr_bytes.size() > kMaxSerializedBytes) {
+        return false;
+      }
+      key.append(attr->first).append(1, '\0').append(attr_bytes).append(1, '\0');
+    }
+
+    for (const auto* def : node.InputDefs()) {
+      if (def == nullptr || !def->Exists() || def->TypeAsProto() == nullptr) {
+        key.append(1, '\0');
+      } else {
+        key.append(def->TypeAsProto()->SerializeAsString());
+      }
+      key.append(1, '\1');
+    }
+
+    return true;
+  }
+
+  // returns the entry for the key if one exists and the constant data it depends on matches
+  // what the given node sees, nullptr otherwise
+  const Entry* Lookup(const std::string& key, const Node& node, const Graph& graph) const {
+    auto range = entries_.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+      const Entry& entry = it->second;
+      const bool data_matches =
+          std::all_of(entry.read_input_data.cbegin(), entry.read_input_data.cend(),
+                      [&node, &graph](const std::pair<size_t, std::string>& read) {
+                        return SerializedConstantData(node, graph, read.first) == read.second;
+                      });
+      if (data_matches) {
+        return &entry;
+      }
+    }
+
+    return nullptr;
+  }
+
+  void Add(std::string&& key, const Node& node, const Graph& graph,
+           const std::vector<size_t>& read_input_data_indices,
+           const std::vector<TypeProto>& output_types) {
+    Entry entry;
+    entry.output_types = output_types;
+    entry.read_input_data.reserve(read_input_data_indices.size());
+    for (size_t index : read_input_data_indices) {
+      std::string data = SerializedConstantData(node, graph, index);
+      if (data.size() > kMaxSerializedBytes) {
+        return;  // not worth caching against a large constant
+      }
+      entry.read_input_data.emplace_back(index, std::move(data));
+    }
+
+    entries_.emplace(std::move(key), std::move(entry));
+  }
+
+ private:
+  static constexpr size_t kMaxSerializedBytes = 4096;
+
+  static std::string SerializedConstantData(const Node& node, const Graph& graph, size_t index) {
+    const auto* def = index < node.InputDefs().size() ? node.InputDefs()[index] : nullptr;
+    if (def == nullptr || !def->Exists()) {
+      return std::string();
+    }
+
+    const TensorProto* initializer = graph.GetConstantInitializer(def->Name(), true);
+    if (initializer == nullptr) {
+      return std::string();
+    }
+
+    // leading marker distinguishes "constant with empty serialization" from "not a constant"
+    std::string data(1, '\1');
+    data.append(initializer->SerializeAsString());
+    return data;
+  }
+
+  std::unordered_multimap<std::string, Entry> entries_;
 };
 
 Status Graph::InferAndVerifySubgraphTypes(const Node& node, Graph& subgraph,
@@ -2085,7 +2224,8 @@ Status Graph::UpdateShapeInference(Node& node) {
 
 // Implementation of type-inference and type-checking for a single node
 GSL_SUPPRESS(f .23)  // spurious warning about inferred_type never being checked for null
-Status Graph::InferAndVerifyTypeMatch(Node& node, const OpSchema& op, const ResolveOptions& options) {
+Status Graph::InferAndVerifyTypeMatch(Node& node, const OpSchema& op, const ResolveOptions& options,
+                                      ShapeInferenceMemo* memo) {
   auto& node_name = node.Name();
 
   // if we're building a graph we permit outer scope node args to have no type
@@ -2179,7 +2319,12 @@ Status Graph::InferAndVerifyTypeMatch(Node& node, const OpSchema& op, const Reso
   SubgraphInferencingFunc func(Graph::InferAndVerifySubgraphTypes);
   InferenceContextImpl context(node, func, *this, options);
 
-  {
+  std::string memo_key;
+  const bool use_memo = memo != nullptr && ShapeInferenceMemo::BuildKey(node, op, memo_key);
+  const ShapeInferenceMemo::Entry* memo_entry = use_memo ? memo->Lookup(memo_key, node, *this) : nullptr;
+
+  std::vector<TypeProto> inferred_types_storage;
+  if (memo_entry == nullptr) {
     auto status = Status::OK();
     ORT_TRY {
       context.RunInferencing();
@@ -2190,9 +2335,15 @@ Status Graph::InferAndVerifyTypeMatch(Node& node, const OpSchema& op, const Reso
       });
     }
     ORT_RETURN_IF_ERROR(status);
+
+    inferred_types_storage = context.InferredOutputTypes();
+    if (use_memo) {
+      memo->Add(std::move(memo_key), node, *this, context.ReadInputDataIndices(), inferred_types_storage);
+    }
   }
 
-  const auto& onnx_inferred_types(context.InferredOutputTypes());
+  const std::vector<TypeProto>& onnx_inferred_types =
+      memo_entry != nullptr ? memo_entry->output_types : inferred_types_storage;
 
   // Infer and verify node output arg type information.
   int i = -1;
@@ -2387,10 +2538,27 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
   // and need to call Resolve
   lsc.output_names.insert(outer_scope_node_arg_names_.cbegin(), outer_scope_node_arg_names_.cend());
 
+  // shared across the nodes in this pass so structurally identical nodes infer once
+  ShapeInferenceMemo shape_inference_memo;
+
   for (auto node_index : nodes_in_topological_order_) {
     // Node verification.
     auto& node = *GetNode(node_index);
 
+    // during an incremental resolve, nodes outside the re-inference set were validated by a
+    // previous resolve and neither they nor anything upstream has changed, so their existing
+    // type/shape results stand. only their outputs need to be added to the lexical scope so
+    // later (new) nodes validate against them.
+    if (nodes_to_reinfer_ != nullptr && node.Op() != nullptr &&
+        nodes_to_reinfer_->count(node_index) == 0) {
+      for (const auto* output_def : node.OutputDefs()) {
+        if (output_def->Exists()) {
+          lsc.output_names.insert(output_def->Name());
+        }
+      }
+      continue;
+    }
+
     NodeProto node_proto;
     node.ToProto(node_proto);
     auto& node_name = node.Name();
@@ -2474,7 +2642,7 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
       }
     }
 
-    NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *p_op, options)));
+    NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *p_op, options, &shape_inference_memo)));
 
     // Accumulate output names of the iterated Node
     for (auto& output_name : node_proto.output()) {
@@ -2633,6 +2801,22 @@ Status Graph::ForThisAndAllSubgraphs(const std::vector<Graph*>& subgraphs, std::
   return status;
 }
 
+bool Graph::GetCachedTraversalOrders(TraversalOrders& orders) const {
+  std::lock_guard<OrtMutex> lock(traversal_orders_mutex_);
+  if (cached_traversal_orders_epoch_ != mutation_epoch_) {
+    return false;
+  }
+
+  orders = cached_traversal_orders_;
+  return true;
+}
+
+void Graph::CacheTraversalOrders(const TraversalOrders& orders) const {
+  std::lock_guard<OrtMutex> lock(traversal_orders_mutex_);
+  cached_traversal_orders_ = orders;
+  cached_traversal_orders_epoch_ = mutation_epoch_;
+}
+
 Status Graph::Resolve(const ResolveOptions& options) {
   if (parent_graph_) {
     // Resolve must start at the top level graph in-order to handle outer scope
@@ -2671,15 +2855,51 @@ Status Graph::Resolve(const ResolveOptions& options) {
   auto topo_sort_func = [](Graph& graph) { return graph.PerformTopologicalSortAndCheckIsAcyclic(); };
   ORT_RETURN_IF_ERROR(ForThisAndAllSubgraphs(all_subgraphs, topo_sort_func));
 
+  // an incremental resolve limits type/shape inference to the nodes modified since the last
+  // successful resolve plus everything downstream of them. it is only valid when a previous full
+  // resolve succeeded and every change since then was attributed to individual nodes. subgraphs
+  // complicate the cone computation (outer scope values), so their presence forces a full pass.
+  std::unordered_set<NodeIndex> reinfer_cone;
+  const bool incremental = options.incremental && incremental_resolve_possible_ &&
+                           num_resolves_ > 0 && all_subgraphs.empty();
+  if (incremental) {
+    // nodes are visited in topological order, so a node is in the cone once any of its
+    // predecessors is. new nodes (without a resolved op) are always re-processed.
+    for (NodeIndex node_index : nodes_in_topological_order_) {
+      const Node* node = GetNode(node_index);
+      if (node == nullptr) continue;
+
+      bool in_cone = node->Op() == nullptr || modified_nodes_.count(node_index) != 0;
+      if (!in_cone) {
+        for (auto edge_it = node->InputEdgesBegin(), end = node->InputEdgesEnd(); edge_it != end; ++edge_it) {
+          if (reinfer_cone.count(edge_it->GetNode().Index()) != 0) {
+            in_cone = true;
+            break;
+          }
+        }
+      }
+
+      if (in_cone) {
+        reinfer_cone.insert(node_index);
+      }
+    }
+
+    nodes_to_reinfer_ = &reinfer_cone;
+  }
+
   // type/shape validation and inferencing on this and any subgraphs
   // recurses into subgraphs via the ONNX checker, which descends into the GraphProto in node attributes
   // which define a subgraph.
-  ORT_RETURN_IF_ERROR(PerformTypeAndShapeInferencing(options));
+  auto inferencing_status = PerformTypeAndShapeInferencing(options);
+  nodes_to_reinfer_ = nullptr;
+  ORT_RETURN_IF_ERROR(inferencing_status);
 
   // perform the final steps for this graph and all subgraphs
   auto finalize_func = [&options](Graph& graph) {
             graph.CleanUnusedInitializers(options.initializer_names_to_preserve);
             graph.GraphResolveNeeded(false);
+            graph.modified_nodes_.clear();
+            graph.incremental_resolve_possible_ = true;
 
             // if we are resolving immediately after loading from a GraphProto, we don't need to
             // do a proto sync
@@ -2778,6 +2998,9 @@ void Graph::RemoveInitializedTensor(const std::string& tensor_name) {
     sparse_tensor_names_.erase(tensor_name);
 #endif
     SetGraphResolveNeeded();
+    // an initializer may be removed and re-added with different contents; the consumers are not
+    // individually marked so an incremental resolve cannot be trusted after this
+    incremental_resolve_possible_ = false;
   } else {
 #if !defined(DISABLE_SPARSE_TENSORS)
     ORT_ENFORCE(sparse_tensor_names_.count(tensor_name) == 0, "sparse_tensor_names_ not in sync with name_to_initial_tensor_");
@@ -2855,12 +3078,32 @@ void Graph::CleanAllInitializedTensors() noexcept {
   // and can be reused. Need to explicitly release the cleared objects and free the
   // memory.
   graph_proto_->mutable_initializer()->Clear();
-  const int num_cleared = graph_proto_->initializer().ClearedCount();
-  for (int i = 0; i < num_cleared; i++) {
-    delete graph_proto_->mutable_initializer()->ReleaseCleared();
+  // cleared elements of an arena-allocated proto belong to the arena and must not be deleted
+  if (graph_proto_->GetArena() == nullptr) {
+    const int num_cleared = graph_proto_->initializer().ClearedCount();
+    for (int i = 0; i < num_cleared; i++) {
+      delete graph_proto_->mutable_initializer()->ReleaseCleared();
+    }
   }
 }
 
+void Graph::ReleaseInitializerData(const std::string& initializer_name) {
+  auto iter = name_to_initial_tensor_.find(initializer_name);
+  if (name_to_initial_tensor_.end() == iter) {
+    return;
+  }
+
+  // the entry points into graph_proto_, which this graph owns, so dropping const here is safe
+  auto& tensor_proto = *const_cast<ONNX_NAMESPACE::TensorProto*>(iter->second);
+  tensor_proto.clear_raw_data();
+  tensor_proto.clear_float_data();
+  tensor_proto.clear_int32_data();
+  tensor_proto.clear_string_data();
+  tensor_proto.clear_int64_data();
+  tensor_proto.clear_double_data();
+  tensor_proto.clear_uint64_data();
+}
+
 const ONNX_NAMESPACE::TensorProto* Graph::GetConstantInitializer(const std::string& initializer_name,
                                                                  bool check_outer_scope) const {
   const ONNX_NAMESPACE::TensorProto* initializer = nullptr;
@@ -3915,6 +4158,7 @@ void Graph::SetInputs(const std::vector<const NodeArg*>& inputs) {
   graph_inputs_manually_set_ = true;
   GraphProtoSyncNeeded(true);
   GraphResolveNeeded(true);
+  incremental_resolve_possible_ = false;
 }
 
 void Graph::SetOutputs(const std::vector<const NodeArg*>& outputs) {
@@ -3923,6 +4167,50 @@ void Graph::SetOutputs(const std::vector<const NodeArg*>& outputs) {
   graph_outputs_manually_set_ = true;
   GraphProtoSyncNeeded(true);
   GraphResolveNeeded(true);
+  incremental_resolve_possible_ = false;
+}
+
+common::Status Graph::PruneToOutputs(const std::vector<const NodeArg*>& outputs) {
+  std::vector<const Node*> output_nodes;
+  output_nodes.reserve(outputs.size());
+  for (const auto* output : outputs) {
+    ORT_RETURN_IF(output == nullptr || !output->Exists(), "Output to prune the graph to must exist.");
+    ORT_RETURN_IF(std::find(graph_outputs_.cbegin(), graph_outputs_.cend(), output) == graph_outputs_.cend(),
+                  output->Name(), " is not an output of this graph.");
+
+    const Node* producer = GetProducerNode(output->Name());
+    if (producer != nullptr) {
+      output_nodes.push_back(producer);
+    }
+  }
+
+  std::unordered_set<NodeIndex> reachable;
+  ReverseDFSFrom(output_nodes,
+                 [&reachable](const Node* node) { reachable.insert(node->Index()); },
+                 {});
+
+  std::vector<NodeIndex> nodes_to_remove;
+  for (const auto& node : Nodes()) {
+    if (reachable.count(node.Index()) == 0) {
+      nodes_to_remove.push_back(node.Index());
+    }
+  }
+
+  for (NodeIndex index : nodes_to_remove) {
+    Node* node = GetNode(index);
+    // An unreachable node can only feed other unreachable nodes, so dropping its output edges
+    // up front cannot disconnect anything that is kept.
+    auto output_edges = node->GetRelationships().output_edges;
+    for (const auto& output_edge : output_edges) {
+      RemoveEdge(index, output_edge.GetNode().Index(), output_edge.GetSrcArgIndex(), output_edge.GetDstArgIndex());
+    }
+
+    ORT_RETURN_IF_NOT(RemoveNode(index), "Failed to remove node ", node->Name(), " while pruning the graph.");
+  }
+
+  // Resolve recomputes the graph inputs and cleans up initializers that only fed removed nodes.
+  SetOutputs(outputs);
+  return Status::OK();
 }
 
 void Graph::SetNodeArgType(NodeArg& arg, const ONNX_NAMESPACE::TypeProto& type_proto) {
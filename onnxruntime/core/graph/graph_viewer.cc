@@ -7,6 +7,8 @@
 #endif
 
 #include "core/graph/graph_viewer.h"
+
+#include "core/framework/data_types.h"
 #include "core/graph/indexed_sub_graph.h"
 
 namespace onnxruntime {
@@ -44,6 +46,36 @@ struct PriorityNodeCompare {
     return n1->Index() > n2->Index();
   }
 };
+
+// Estimated size in bytes of the tensor behind `node_arg`, based on the ONNX inferred shape.
+// Symbolic/unknown dimensions count as 1, so the estimate is a lower bound. Non-tensor args and
+// args without type or shape information contribute 0 as there is nothing to base an estimate on.
+static int64_t EstimateNodeArgBytes(const NodeArg* node_arg) {
+  if (node_arg == nullptr || !node_arg->Exists()) {
+    return 0;
+  }
+
+  const auto* type_proto = node_arg->TypeAsProto();
+  if (type_proto == nullptr || type_proto->value_case() != ONNX_NAMESPACE::TypeProto::kTensorType) {
+    return 0;
+  }
+
+  const auto& tensor_type = type_proto->tensor_type();
+  if (!tensor_type.has_shape() ||
+      tensor_type.elem_type() == ONNX_NAMESPACE::TensorProto_DataType_UNDEFINED) {
+    return 0;
+  }
+
+  int64_t num_elements = 1;
+  for (const auto& dim : tensor_type.shape().dim()) {
+    if (dim.has_dim_value() && dim.dim_value() > 0) {
+      num_elements *= dim.dim_value();
+    }
+  }
+
+  const auto* tensor_type_base = DataTypeImpl::TensorTypeFromONNXEnum(tensor_type.elem_type());
+  return num_elements * static_cast<int64_t>(tensor_type_base->GetElementType()->Size());
+}
 #endif
 
 GraphViewer::GraphViewer(const Graph& graph)
@@ -61,32 +93,157 @@ GraphViewer::GraphViewer(const Graph& graph, const IndexedSubGraph* filter_info)
           filter_info ? [this](NodeIndex idx) { return filtered_node_indices_.count(idx) == 0; }
                       : ConstGraphNodes::NodeFilterFunc(nullptr))},
       filter_info_{filter_info} {
+#if !defined(ORT_MINIMAL_BUILD)
+  // the traversal orders only depend on the graph contents, so between mutations every
+  // GraphViewer over the same graph (one per transformer pass, plus partitioning and the
+  // allocation planner) can reuse the orders computed by the first one.
+  Graph::TraversalOrders cached_orders;
+  const bool have_cached_orders = graph.GetCachedTraversalOrders(cached_orders);
+  if (have_cached_orders) {
+    root_nodes_ = std::move(cached_orders.root_nodes);
+    nodes_in_topological_order_ = std::move(cached_orders.topological_order);
+    nodes_in_topological_order_with_priority_ = std::move(cached_orders.topological_order_with_priority);
+    nodes_in_topological_order_memory_efficient_ = std::move(cached_orders.topological_order_memory_efficient);
+    nodes_in_topological_order_locality_aware_ = std::move(cached_orders.topological_order_locality_aware);
+  }
+#else
+  const bool have_cached_orders = false;
+#endif
+
   std::vector<const Node*> leaf_nodes;
-  for (auto& node : graph_->Nodes()) {
-    // This is a leaf node (without any output node)
-    if (node.OutputNodesBegin() == node.OutputNodesEnd()) {
-      leaf_nodes.push_back(&node);
-    }
-    // This is a root node (without any input node)
-    if (node.InputEdgesBegin() == node.InputEdgesEnd()) {
-      root_nodes_.push_back(node.Index());
+  if (!have_cached_orders) {
+    for (auto& node : graph_->Nodes()) {
+      // This is a leaf node (without any output node)
+      if (node.OutputNodesBegin() == node.OutputNodesEnd()) {
+        leaf_nodes.push_back(&node);
+      }
+      // This is a root node (without any input node)
+      if (node.InputEdgesBegin() == node.InputEdgesEnd()) {
+        root_nodes_.push_back(node.Index());
+      }
     }
-  }
 
-  graph.ReverseDFSFrom(
-      leaf_nodes,
-      nullptr,
-      [this](const Node* n) {
-        nodes_in_topological_order_.push_back(n->Index());
-      },
-      NodeCompare());
+    graph.ReverseDFSFrom(
+        leaf_nodes,
+        nullptr,
+        [this](const Node* n) {
+          nodes_in_topological_order_.push_back(n->Index());
+        },
+        NodeCompare());
+  }
 
 #if !defined(ORT_MINIMAL_BUILD)
-  graph.KahnsTopologicalSort(
-      [this](const Node* n) {
-        nodes_in_topological_order_with_priority_.push_back(n->Index());
-      },
-      PriorityNodeCompare());
+  if (!have_cached_orders) {
+    graph.KahnsTopologicalSort(
+        [this](const Node* n) {
+          nodes_in_topological_order_with_priority_.push_back(n->Index());
+        },
+        PriorityNodeCompare());
+
+    // Kahn's sort that greedily schedules, among the ready nodes, those that grow the set of live
+    // activation bytes the least (or shrink it the most). A node's score is the estimated bytes of
+    // its outputs minus the estimated bytes of its inputs, so consumers of large activations run as
+    // soon as their dependencies allow. This shortens activation lifetimes, which lowers the peak
+    // memory the allocation planner has to reserve for the resulting execution order.
+    std::unordered_map<NodeIndex, int64_t> net_activation_bytes;
+    for (auto& node : graph_->Nodes()) {
+      int64_t net_bytes = 0;
+      for (const auto* output_def : node.OutputDefs()) {
+        net_bytes += EstimateNodeArgBytes(output_def);
+      }
+      for (const auto* input_def : node.InputDefs()) {
+        net_bytes -= EstimateNodeArgBytes(input_def);
+      }
+      net_activation_bytes.insert({node.Index(), net_bytes});
+    }
+
+    graph.KahnsTopologicalSort(
+        [this](const Node* n) {
+          nodes_in_topological_order_memory_efficient_.push_back(n->Index());
+        },
+        [&net_activation_bytes](const Node* n1, const Node* n2) {
+          // priority_queue comparator: returning true means n2 is output first
+          const int64_t bytes_1 = net_activation_bytes.find(n1->Index())->second;
+          const int64_t bytes_2 = net_activation_bytes.find(n2->Index())->second;
+          if (bytes_1 != bytes_2) {
+            return bytes_1 > bytes_2;
+          }
+
+          // fall back to node index so the order is deterministic
+          return n1->Index() > n2->Index();
+        });
+
+    // Greedy topological sort that keeps consumers close to the producers of their largest
+    // inputs. Among the ready nodes, the next one scheduled is the one whose inputs are the
+    // "warmest": each tensor input contributes its estimated size scaled down by the number of
+    // nodes scheduled since it was produced, so the consumer of a large, recently produced tensor
+    // runs before a node whose inputs have long since left the cache. The selection is stateful
+    // (scores change as nodes are scheduled), so this cannot be expressed as a priority_queue
+    // comparator for KahnsTopologicalSort.
+    {
+      std::unordered_map<NodeIndex, size_t> in_degree;
+      std::vector<const Node*> ready;
+      for (auto& node : graph_->Nodes()) {
+        size_t input_edge_count = node.GetInputEdgesCount();
+        in_degree.insert({node.Index(), input_edge_count});
+        if (input_edge_count == 0) {
+          ready.push_back(&node);
+        }
+      }
+
+      std::unordered_map<NodeIndex, size_t> scheduled_position;
+      size_t position = 0;
+
+      while (!ready.empty()) {
+        size_t best = 0;
+        double best_score = -1.;
+        for (size_t i = 0; i < ready.size(); ++i) {
+          const Node* candidate = ready[i];
+          double score = 0.;
+          for (auto edge = candidate->InputEdgesBegin(); edge != candidate->InputEdgesEnd(); ++edge) {
+            auto it = scheduled_position.find(edge->GetNode().Index());
+            if (it == scheduled_position.end()) {
+              continue;
+            }
+            const auto* produced = edge->GetNode().OutputDefs()[edge->GetSrcArgIndex()];
+            const double distance = static_cast<double>(position - it->second);
+            score += static_cast<double>(EstimateNodeArgBytes(produced)) / (1. + distance);
+          }
+
+          // tie-break on node index so the order is deterministic
+          if (score > best_score ||
+              (score == best_score && candidate->Index() < ready[best]->Index())) {
+            best_score = score;
+            best = i;
+          }
+        }
+
+        const Node* chosen = ready[best];
+        ready.erase(ready.begin() + best);
+        scheduled_position.insert({chosen->Index(), position});
+        ++position;
+        nodes_in_topological_order_locality_aware_.push_back(chosen->Index());
+
+        for (auto node_it = chosen->OutputNodesBegin(); node_it != chosen->OutputNodesEnd(); ++node_it) {
+          if (--in_degree[node_it->Index()] == 0) {
+            ready.push_back(&*node_it);
+          }
+        }
+      }
+
+      ORT_ENFORCE(nodes_in_topological_order_locality_aware_.size() ==
+                      static_cast<size_t>(graph_->NumberOfNodes()),
+                  "Some nodes are not included in the topological sort, graph have a cycle.");
+    }
+
+    Graph::TraversalOrders computed_orders;
+    computed_orders.root_nodes = root_nodes_;
+    computed_orders.topological_order = nodes_in_topological_order_;
+    computed_orders.topological_order_with_priority = nodes_in_topological_order_with_priority_;
+    computed_orders.topological_order_memory_efficient = nodes_in_topological_order_memory_efficient_;
+    computed_orders.topological_order_locality_aware = nodes_in_topological_order_locality_aware_;
+    graph.CacheTraversalOrders(computed_orders);
+  }
 #endif
 
   if (filter_info_) {
@@ -233,6 +390,10 @@ const std::vector<NodeIndex>& GraphViewer::GetNodesInTopologicalOrder(ExecutionO
 #if !defined(ORT_MINIMAL_BUILD)
     case ExecutionOrder::PRIORITY_BASED:
       return nodes_in_topological_order_with_priority_;
+    case ExecutionOrder::MEMORY_EFFICIENT:
+      return nodes_in_topological_order_memory_efficient_;
+    case ExecutionOrder::LOCALITY_AWARE:
+      return nodes_in_topological_order_locality_aware_;
 #endif
     default:
       ORT_THROW("Invalid ExecutionOrder");
@@ -18,6 +18,12 @@ template <typename T>
 struct Offset;
 }  // namespace flatbuffers
 
+namespace google {
+namespace protobuf {
+class Arena;
+}  // namespace protobuf
+}  // namespace google
+
 namespace onnxruntime {
 
 namespace experimental {
@@ -81,8 +87,19 @@ class Model {
                  const IOnnxRuntimeOpSchemaRegistryList* local_registries,
                  const logging::Logger& logger);
 
+  // NOTE: <model_proto> must have been allocated on <arena>, ownership of which is taken by
+  // <*this> model. Parsing directly into an arena avoids the per-submessage heap allocations
+  // that dominate load time for large graphs.
+  explicit Model(ONNX_NAMESPACE::ModelProto* model_proto,
+                 std::unique_ptr<google::protobuf::Arena> arena,
+                 const PathString& model_path,
+                 const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+                 const logging::Logger& logger);
+
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
+  ~Model();
+
 #if !defined(ORT_MINIMAL_BUILD)
   // Get model's IR version.
   // Return <kNoVersion> if not specified.
@@ -275,9 +292,21 @@ class Model {
  private:
   Model();
 
+#if !defined(ORT_MINIMAL_BUILD)
+  // shared tail of the ModelProto-based constructors. expects <model_proto_> to be set and
+  // throws (as the constructors always have) if the proto is not a valid model.
+  void InitializeFromModelProto(const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+                                const logging::Logger& logger);
+#endif
+
   // Model data.
 #if !defined(ORT_MINIMAL_BUILD)
-  ONNX_NAMESPACE::ModelProto model_proto_;
+  // <model_proto_> points at either <*owned_model_proto_> or a message allocated on <arena_>.
+  // The arena is populated when the model is parsed directly from a file or byte buffer and is
+  // released as a whole when the model is destroyed.
+  std::unique_ptr<google::protobuf::Arena> arena_;
+  std::unique_ptr<ONNX_NAMESPACE::ModelProto> owned_model_proto_;
+  ONNX_NAMESPACE::ModelProto* model_proto_ = nullptr;
 #else
   // properties that would normally come from ModelProto
   std::string producer_version_;
@@ -159,6 +159,10 @@ void OnnxRuntimeOpSchemaRegistry::GetSchemaAndHistory(
 
 void SchemaRegistryManager::RegisterRegistry(std::shared_ptr<IOnnxRuntimeOpSchemaCollection> registry) {
   registries.push_front(registry);
+
+  // a new registry can change the result of any previous lookup
+  std::lock_guard<OrtMutex> lock(schema_cache_mutex_);
+  schema_cache_.clear();
 }
 
 void SchemaRegistryManager::GetDomainToVersionMapForRegistries(DomainToVersionMap& domain_version_map, bool is_onnx_only) const {
@@ -248,6 +252,31 @@ void SchemaRegistryManager::GetSchemaAndHistory(
     const std::string& domain,
     const ONNX_NAMESPACE::OpSchema** latest_schema,
     int* earliest_opset_where_unchanged) const {
+  std::string cache_key(key);
+  cache_key.append(1, ' ').append(domain).append(1, ' ').append(std::to_string(op_set_version));
+
+  {
+    std::lock_guard<OrtMutex> lock(schema_cache_mutex_);
+    auto cached = schema_cache_.find(cache_key);
+    if (cached != schema_cache_.end()) {
+      *latest_schema = cached->second.first;
+      *earliest_opset_where_unchanged = cached->second.second;
+      return;
+    }
+  }
+
+  GetSchemaAndHistoryImpl(key, op_set_version, domain, latest_schema, earliest_opset_where_unchanged);
+
+  std::lock_guard<OrtMutex> lock(schema_cache_mutex_);
+  schema_cache_.emplace(std::move(cache_key), std::make_pair(*latest_schema, *earliest_opset_where_unchanged));
+}
+
+void SchemaRegistryManager::GetSchemaAndHistoryImpl(
+    const std::string& key,
+    const int op_set_version,
+    const std::string& domain,
+    const ONNX_NAMESPACE::OpSchema** latest_schema,
+    int* earliest_opset_where_unchanged) const {
   // A greedy algorithm is used to search for a schema registration in some registry,
   // while potentially inferring from other registries the allowed schema version
   // given the op-set version.  Each time a registry fails to locate the schema
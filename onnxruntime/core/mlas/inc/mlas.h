@@ -110,6 +110,19 @@ MlasGetPreferredBufferAlignment(
     void
     );
 
+//
+// Measures the thread pool dispatch overhead and the single threaded GEMM
+// rate of this machine and derives the threading thresholds from them,
+// replacing the library's static heuristics. Runs once per process; later
+// calls return immediately.
+//
+
+void
+MLASCALL
+MlasThreadingCalibrate(
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Activation routines.
 //
@@ -159,6 +172,53 @@ MlasActivation(
 // op(X) = X or op(X) = transpose(X) or op(X) = conjg(transpose(X))
 //
 
+class MLAS_SGEMM_POSTPROCESSOR {
+public:
+    virtual
+    void
+    Process(
+        float*, // Supplies the address of matrix to process
+        size_t, // Supplies the start row index of matrix
+        size_t, // Supplies the start col index of matrix
+        size_t, // Supplies the element count per row to process
+        size_t, // Supplies the element count per col to process
+        size_t  // Supplies the leading dimension of matrix
+        ) const = 0;
+
+    virtual ~MLAS_SGEMM_POSTPROCESSOR() {}
+};
+
+class MLAS_SGEMM_ACTIVATION_PROCESSOR : public MLAS_SGEMM_POSTPROCESSOR {
+public:
+    MLAS_SGEMM_ACTIVATION_PROCESSOR(
+        const MLAS_ACTIVATION& Activation,
+        const float* Bias = nullptr,
+        const float* AddSource = nullptr,
+        size_t LeadingDimensionAddSource = 0) :
+            Activation_(Activation),
+            Bias_(Bias),
+            AddSource_(AddSource),
+            LeadingDimensionAddSource_(LeadingDimensionAddSource)
+    {
+    }
+
+    void
+    Process(
+        float* C,
+        size_t StartM,
+        size_t StartN,
+        size_t CountM,
+        size_t CountN,
+        size_t ldc
+        ) const override;
+
+private:
+    const MLAS_ACTIVATION Activation_;
+    const float* Bias_;
+    const float* AddSource_;
+    size_t LeadingDimensionAddSource_;
+};
+
 /**
  * @brief Supply matrices data information to single precision gemm functions
  */
@@ -172,6 +232,7 @@ struct MLAS_SGEMM_DATA_PARAMS {
     float alpha = 1.0f;       /**< Supplies the scalar alpha multiplier (see SGEMM definition) */
     float beta = 0.0f;        /**< Supplies the scalar beta multiplier (see SGEMM definition) */
     bool BIsPacked = false;   /**< Whether B is pre-packed */
+    const MLAS_SGEMM_POSTPROCESSOR* OutputProcessor = nullptr; /**< Optional epilogue applied to completed output blocks */
 };
 
 /**
@@ -630,9 +691,7 @@ enum MLAS_CONV_ALGORITHM {
     MlasConvAlgorithmGemmDirect,
     MlasConvAlgorithmExpandThenGemm,
     MlasConvAlgorithmExpandThenGemmSegmented,
-#if defined(MLAS_TARGET_WASM_SCALAR)
     MlasConvAlgorithmDepthwise,
-#endif
 };
 
 struct MLAS_CONV_PARAMETERS {
@@ -766,6 +825,31 @@ MlasComputeExp(
     size_t N
     );
 
+//
+// Computes layer normalization over each of the N rows of D columns, with
+// optional fused residual (Skip) and bias additions to the input, and
+// optional per-row Mean and InvStdDev outputs. SimplifiedLayerNorm omits the
+// mean subtraction and normalizes by the root mean square of the row.
+//
+
+void
+MLASCALL
+MlasComputeLayerNorm(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    const float* Gamma,
+    const float* Beta,
+    float* Output,
+    float* Mean,
+    float* InvStdDev,
+    size_t N,
+    size_t D,
+    float Epsilon,
+    bool SimplifiedLayerNorm,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 void
 MLASCALL
 MlasComputeLogistic(
@@ -806,6 +890,68 @@ MlasConvertHalfToFloatBuffer(
     size_t Count
     );
 
+//
+// Brain floating-point (bfloat16) routines.
+//
+
+void
+MLASCALL
+MlasConvertFloatToBFloat16Buffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
+void
+MLASCALL
+MlasConvertBFloat16ToFloatBuffer(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    );
+
+/**
+ * @brief Supply matrices data information to bfloat16 gemm functions
+ */
+struct MLAS_BF16GEMM_DATA_PARAMS {
+    const unsigned short* A = nullptr; /**< Supplies the address of matrix A as bfloat16 values */
+    size_t lda = 0;                    /**< Supplies the first dimension of matrix A. */
+    const unsigned short* B = nullptr; /**< Supplies the address of matrix B as bfloat16 values */
+    size_t ldb = 0;                    /**< Supplies the first dimension of matrix B. */
+    float* C = nullptr;                /**< Supplies the address of matrix C */
+    size_t ldc = 0;                    /**< Supplies the first dimension of matrix C. */
+    float alpha = 1.0f;                /**< Supplies the scalar alpha multiplier (see GEMM definition) */
+    float beta = 0.0f;                 /**< Supplies the scalar beta multiplier (see GEMM definition) */
+};
+
+/**
+ * @brief  Batched bfloat16 matrix/matrix multiply operation with single
+ *         precision accumulation
+ *
+ * @param TransA     Supplies the transpose operation for matrix A.
+ * @param TransB     Supplies the transpose operation for matrix B.
+ * @param M          Supplies the number of rows of matrix A and matrix C.
+ * @param N          Supplies the number of columns of matrix B and matrix C.
+ * @param K          Supplies the number of columns of matrix A and the number
+                     of rows of matrix B.
+ * @param Data       A array of matrices data parameters
+ * @param BatchSize  Supplies number of multiplications in this batch
+ * @param ThreadPool Supplies the thread pool object to use, else nullptr if the
+                     base library threading support should be used.
+ */
+void
+MLASCALL
+MlasBf16GemmBatch(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    const MLAS_BF16GEMM_DATA_PARAMS* Data,
+    size_t BatchSize,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Transpose routines.
 //
@@ -819,6 +965,15 @@ MlasTranspose(
     size_t N
     );
 
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N
+    );
+
 void
 MLASCALL
 MlasTranspose(
@@ -828,6 +983,15 @@ MlasTranspose(
     size_t N
     );
 
+void
+MLASCALL
+MlasTranspose(
+    const uint64_t* Input,
+    uint64_t* Output,
+    size_t M,
+    size_t N
+    );
+
 void
 MLASCALL
 MlasTranspose(
@@ -837,6 +1001,82 @@ MlasTranspose(
     size_t N
     );
 
+//
+// Transpose routines with threaded tiling. The operation is partitioned into
+// bands of input columns when the matrix is large enough to overcome the
+// dispatch overhead.
+//
+
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    uint32_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint64_t* Input,
+    uint64_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const float* Input,
+    float* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+//
+// Gather routine for embedding table lookups. The indices have been
+// validated by the caller to be within the inclusive range
+// [-RowCount, RowCount - 1] and negative indices are wrapped by the
+// row count of the table.
+//
+
+template<typename IndexType>
+void
+MLASCALL
+MlasGather(
+    const uint8_t* Input,
+    const IndexType* Indices,
+    uint8_t* Output,
+    size_t IndexCount,
+    size_t RowCount,
+    size_t RowBytes,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Buffer reordering routines.
 //
@@ -972,6 +1212,17 @@ MlasQuantizeLinear(
     OutputType ZeroPoint
     );
 
+template<typename InputType>
+void
+MLASCALL
+MlasDequantizeLinear(
+    const InputType* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    InputType ZeroPoint
+    );
+
 /**
  * @brief Requantize a block of the intermediate buffer to the output buffer,
  *        optionally adding the supplied bias
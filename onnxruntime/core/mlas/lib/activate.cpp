@@ -511,3 +511,72 @@ Return Value:
         }
     }
 }
+
+void
+MLAS_SGEMM_ACTIVATION_PROCESSOR::Process(
+    float* C,
+    size_t StartM,
+    size_t StartN,
+    size_t CountM,
+    size_t CountN,
+    size_t ldc
+    ) const
+/*++
+
+Routine Description:
+
+    This routine applies the optional per-column bias vector, the optional
+    residual matrix and the activation function to a completed block of the
+    output matrix of a single precision GEMM operation.
+
+Arguments:
+
+    C - Supplies the address of the output matrix.
+
+    StartM - Supplies the starting row of the block.
+
+    StartN - Supplies the starting column of the block.
+
+    CountM - Supplies the number of rows of the block.
+
+    CountN - Supplies the number of columns of the block.
+
+    ldc - Supplies the first dimension of the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    float* c = C + StartM * ldc + StartN;
+
+    if (Bias_ != nullptr || AddSource_ != nullptr) {
+
+        const float* bias = (Bias_ != nullptr) ? Bias_ + StartN : nullptr;
+        const float* add = (AddSource_ != nullptr) ?
+            AddSource_ + StartM * LeadingDimensionAddSource_ + StartN : nullptr;
+
+        float* buffer = c;
+
+        for (size_t m = 0; m < CountM; m++) {
+
+            if (bias != nullptr) {
+                for (size_t n = 0; n < CountN; n++) {
+                    buffer[n] += bias[n];
+                }
+            }
+
+            if (add != nullptr) {
+                for (size_t n = 0; n < CountN; n++) {
+                    buffer[n] += add[n];
+                }
+                add += LeadingDimensionAddSource_;
+            }
+
+            buffer += ldc;
+        }
+    }
+
+    MlasActivation(&Activation_, c, nullptr, CountM, CountN, ldc);
+}
@@ -0,0 +1,568 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    bf16gemm.cpp
+
+Abstract:
+
+    This module implements the bfloat16 matrix/matrix multiply operation with
+    single precision accumulation.
+
+    The operands stay in bfloat16 format in memory and are expanded to single
+    precision panel by panel inside the cache blocking loops, so the memory
+    traffic of a bandwidth bound multiply is halved while the dispatched
+    single precision kernels perform the arithmetic. Hardware bfloat16 kernels
+    can later replace the expand step behind the same entry points.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the number of rows from matrix A to expand to a local buffer.
+//
+
+#define MLAS_BF16GEMM_EXPANDA_ROWS          12
+
+//
+// Define the strides to step through slices of the input matrices. The K
+// stride is half of the SGEMM stride to leave room for the staging buffer
+// used to expand the bfloat16 panel of matrix B.
+//
+
+#define MLAS_BF16GEMM_STRIDEN               128
+#define MLAS_BF16GEMM_STRIDEK               64
+
+MLAS_FORCEINLINE
+float
+MlasBFloat16ToFloat(
+    unsigned short Value
+    )
+{
+    uint32_t IntegerValue = uint32_t(Value) << 16;
+    float FloatValue;
+    memcpy(&FloatValue, &IntegerValue, sizeof(FloatValue));
+    return FloatValue;
+}
+
+MLAS_FORCEINLINE
+unsigned short
+MlasFloatToBFloat16(
+    float Value
+    )
+{
+    uint32_t IntegerValue;
+    memcpy(&IntegerValue, &Value, sizeof(IntegerValue));
+
+    if ((IntegerValue & 0x7FFFFFFF) > 0x7F800000) {
+
+        //
+        // Quiet any NaN value rather than rounding it, which could otherwise
+        // overflow the significand into the exponent and produce infinity.
+        //
+
+        return (unsigned short)((IntegerValue >> 16) | 0x0040);
+    }
+
+    //
+    // Round to nearest even by adding in the carry from the discarded bits.
+    //
+
+    IntegerValue += 0x7FFF + ((IntegerValue >> 16) & 1);
+
+    return (unsigned short)(IntegerValue >> 16);
+}
+
+void
+MLASCALL
+MlasConvertFloatToBFloat16Buffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a buffer of single precision values to bfloat16
+    values using round to nearest even.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer of single precision
+        values.
+
+    Destination - Supplies the address of the destination buffer of bfloat16
+        values.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = MlasFloatToBFloat16(Source[n]);
+    }
+}
+
+void
+MLASCALL
+MlasConvertBFloat16ToFloatBuffer(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a buffer of bfloat16 values to single precision
+    values.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer of bfloat16 values.
+
+    Destination - Supplies the address of the destination buffer of single
+        precision values.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = MlasBFloat16ToFloat(Source[n]);
+    }
+}
+
+MLAS_FORCEINLINE
+float*
+MlasBf16GemmKernelLoop(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha,
+    bool ZeroMode
+    )
+/*++
+
+Routine Description:
+
+    This routine steps through the rows of the expanded input panel and the
+    output matrix calling the single precision kernel until all rows have been
+    processed.
+
+Arguments:
+
+    A - Supplies the address of the panel of matrix A expanded to single
+        precision.
+
+    B - Supplies the address of the panel of matrix B expanded to single
+        precision and packed using MlasSgemmCopyPackB or
+        MlasSgemmTransposePackB.
+
+    C - Supplies the address of matrix C.
+
+    CountK - Supplies the number of columns from matrix A and the number of rows
+        from matrix B to iterate over.
+
+    CountM - Supplies the number of rows from matrix A and matrix C to iterate
+        over.
+
+    CountN - Supplies the number of columns from matrix B and matrix C to
+        iterate over.
+
+    lda - Supplies the first dimension of the expanded panel of matrix A.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    alpha - Supplies the scalar alpha multiplier (see GEMM definition).
+
+    ZeroMode - Supplies true if the output matrix must be zero initialized,
+        else false if the output matrix is accumulated into.
+
+Return Value:
+
+    Returns the next address of matrix C.
+
+--*/
+{
+    while (CountM > 0) {
+
+        size_t RowsHandled;
+
+#if defined(MLAS_TARGET_AMD64_IX86) || defined(MLAS_TARGET_POWER)
+        RowsHandled = MlasPlatform.GemmFloatKernel(A, B, C, CountK, CountM, CountN, lda, ldc, alpha, ZeroMode);
+#else
+        if (ZeroMode) {
+            RowsHandled = MlasSgemmKernelZero(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+        } else {
+            RowsHandled = MlasSgemmKernelAdd(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+        }
+#endif
+
+        C += ldc * RowsHandled;
+        A += lda * RowsHandled;
+        CountM -= RowsHandled;
+    }
+
+    return C;
+}
+
+void
+MlasBf16GemmOperation(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const unsigned short* A,
+    size_t lda,
+    const unsigned short* B,
+    size_t ldb,
+    float beta,
+    float* C,
+    size_t ldc
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the bfloat16 matrix/matrix multiply operation with
+    single precision accumulation.
+
+Arguments:
+
+    TransA - Supplies the transpose operation for matrix A.
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and the number of rows of
+        matrix B.
+
+    alpha - Supplies the scalar alpha multiplier (see GEMM definition).
+
+    A - Supplies the address of matrix A as bfloat16 values.
+
+    lda - Supplies the first dimension of matrix A.
+
+    B - Supplies the address of matrix B as bfloat16 values.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    beta - Supplies the scalar beta multiplier (see GEMM definition).
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    float PanelA[MLAS_BF16GEMM_EXPANDA_ROWS * MLAS_BF16GEMM_STRIDEK];
+    MLAS_DECLSPEC_ALIGN(float PanelB[MLAS_BF16GEMM_STRIDEN * MLAS_BF16GEMM_STRIDEK], 16 * sizeof(float));
+    MLAS_DECLSPEC_ALIGN(float StageB[MLAS_BF16GEMM_STRIDEN * MLAS_BF16GEMM_STRIDEK], 16 * sizeof(float));
+
+    //
+    // Handle the special case of K equals zero. Apply the beta multiplier to
+    // the output matrix and exit.
+    //
+
+    if (K == 0) {
+        MlasSgemmMultiplyBeta(C, M, N, ldc, beta);
+        return;
+    }
+
+    //
+    // Step through each slice of matrix B along the N dimension.
+    //
+
+    size_t CountN;
+
+    for (size_t n = 0; n < N; n += CountN) {
+
+        CountN = std::min(N - n, size_t(MLAS_BF16GEMM_STRIDEN));
+
+        //
+        // Multiply the output matrix by beta as needed.
+        //
+
+        if (beta != 0.0f && beta != 1.0f) {
+            MlasSgemmMultiplyBeta(C + n, M, CountN, ldc, beta);
+        }
+
+        //
+        // Step through each slice of matrix B along the K dimension.
+        //
+
+        size_t CountK;
+        bool ZeroMode = (beta == 0.0f);
+
+        for (size_t k = 0; k < K; k += CountK) {
+
+            CountK = std::min(K - k, size_t(MLAS_BF16GEMM_STRIDEK));
+
+            //
+            // Expand a panel of matrix B to single precision in a staging
+            // buffer, then pack it with the single precision packing routines
+            // so the layout matches the dispatched kernels.
+            //
+
+            if (TransB == CblasNoTrans) {
+
+                const unsigned short* b = B + n + k * ldb;
+
+                for (size_t y = 0; y < CountK; y++) {
+                    MlasConvertBFloat16ToFloatBuffer(b, &StageB[y * CountN], CountN);
+                    b += ldb;
+                }
+
+                MlasSgemmCopyPackB(PanelB, StageB, CountN, CountN, CountK);
+
+            } else {
+
+                const unsigned short* b = B + k + n * ldb;
+
+                for (size_t y = 0; y < CountN; y++) {
+                    MlasConvertBFloat16ToFloatBuffer(b, &StageB[y * CountK], CountK);
+                    b += ldb;
+                }
+
+                MlasSgemmTransposePackB(PanelB, StageB, CountK, CountN, CountK);
+            }
+
+            //
+            // Step through each slice of matrix A along the M dimension,
+            // expanding a group of rows to single precision in a local buffer.
+            //
+
+            float* c = C + n;
+            size_t RowsRemaining = M;
+            size_t RowsDone = 0;
+
+            while (RowsRemaining > 0) {
+
+                size_t RowsExpanded = std::min(RowsRemaining, size_t(MLAS_BF16GEMM_EXPANDA_ROWS));
+
+                if (TransA == CblasNoTrans) {
+
+                    const unsigned short* a = A + RowsDone * lda + k;
+
+                    for (size_t y = 0; y < RowsExpanded; y++) {
+                        MlasConvertBFloat16ToFloatBuffer(a, &PanelA[y * CountK], CountK);
+                        a += lda;
+                    }
+
+                } else {
+
+                    const unsigned short* a = A + k * lda + RowsDone;
+
+                    for (size_t y = 0; y < RowsExpanded; y++) {
+                        for (size_t x = 0; x < CountK; x++) {
+                            PanelA[y * CountK + x] = MlasBFloat16ToFloat(a[x * lda + y]);
+                        }
+                    }
+                }
+
+                c = MlasBf16GemmKernelLoop(PanelA, PanelB, c, CountK, RowsExpanded, CountN, CountK, ldc, alpha, ZeroMode);
+
+                RowsRemaining -= RowsExpanded;
+                RowsDone += RowsExpanded;
+            }
+
+            ZeroMode = false;
+        }
+    }
+}
+
+void
+MlasBf16GemmThreaded(
+    const ptrdiff_t ThreadCountM,
+    const ptrdiff_t ThreadCountN,
+    const CBLAS_TRANSPOSE TransA,
+    const CBLAS_TRANSPOSE TransB,
+    const size_t M,
+    const size_t N,
+    const size_t K,
+    const MLAS_BF16GEMM_DATA_PARAMS* DataParams,
+    ptrdiff_t ThreadId
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    bfloat16 GEMM operation.
+
+Arguments:
+
+    ThreadCountM - Supplies the total thread partition on the M dimension.
+
+    ThreadCountN - Supplies the total thread partition on the N dimension.
+
+    TransA - Supplies the transpose operation on A matrix
+
+    TransB - Supplies the transpose operation on B matrix
+
+    M, N, K - Supplies the shape of the multiplication
+
+    DataParams - Supplies the data position and layout of the matrices
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+
+    const ptrdiff_t ThreadIdM = ThreadId / ThreadCountN;
+    const ptrdiff_t ThreadIdN = ThreadId % ThreadCountN;
+
+    //
+    // Partition the operation along the M dimension.
+    //
+
+    size_t RangeStartM;
+    size_t RangeCountM;
+
+    MlasPartitionWork(ThreadIdM, ThreadCountM, M, &RangeStartM, &RangeCountM);
+
+    //
+    // Partition the operation along the N dimension.
+    //
+
+    size_t RangeStartN;
+    size_t RangeCountN;
+
+    const size_t BlockedN = (N + MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1) /
+        MLAS_SGEMM_STRIDEN_THREAD_ALIGN;
+
+    MlasPartitionWork(ThreadIdN, ThreadCountN, BlockedN, &RangeStartN,
+        &RangeCountN);
+
+    RangeStartN *= MLAS_SGEMM_STRIDEN_THREAD_ALIGN;
+    RangeCountN *= MLAS_SGEMM_STRIDEN_THREAD_ALIGN;
+
+    RangeCountN = std::min(N - RangeStartN, RangeCountN);
+
+    //
+    // Dispatch the partitioned operation.
+    //
+
+    const size_t lda = DataParams->lda;
+    const size_t ldb = DataParams->ldb;
+    const size_t ldc = DataParams->ldc;
+
+    const unsigned short* A = DataParams->A + RangeStartM * ((TransA == CblasNoTrans) ? lda : 1);
+    const unsigned short* B = DataParams->B + RangeStartN * ((TransB == CblasNoTrans) ? 1 : ldb);
+    float* C = DataParams->C + RangeStartM * ldc + RangeStartN;
+
+    MlasBf16GemmOperation(TransA, TransB, RangeCountM, RangeCountN, K,
+        DataParams->alpha, A, lda, B, ldb, DataParams->beta, C, ldc);
+}
+
+void
+MLASCALL
+MlasBf16GemmBatch(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    const MLAS_BF16GEMM_DATA_PARAMS* Data,
+    size_t BatchSize,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+
+    //
+    // Compute the number of target threads given the complexity of the GEMM
+    // operation. Small requests should run using the single threaded path.
+    //
+
+    const double Complexity = double(M) * double(N) * double(K);
+
+    ptrdiff_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_BF16GEMM_THREAD_COMPLEXITY * MlasPlatform.MaximumThreadCount)) {
+        TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_BF16GEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MlasPlatform.MaximumThreadCount;
+    }
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    //
+    // Segment the operation across multiple threads.
+    //
+    // N.B. Currently, the operation is segmented as a 1D partition, which
+    // works okay for operations involving skinny matrices.
+    //
+
+    ptrdiff_t ThreadsPerGemm = (TargetThreadCount + BatchSize - 1) / BatchSize;
+    ptrdiff_t ThreadCountM;
+    ptrdiff_t ThreadCountN;
+
+    if (N > M) {
+
+        const size_t BlockedN = (N + MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1) /
+            MLAS_SGEMM_STRIDEN_THREAD_ALIGN;
+
+        if (size_t(ThreadsPerGemm) > BlockedN) {
+            ThreadsPerGemm = ptrdiff_t(BlockedN);
+        }
+
+        ThreadCountM = 1;
+        ThreadCountN = ThreadsPerGemm;
+
+    } else {
+
+        if (size_t(ThreadsPerGemm) > M) {
+            ThreadsPerGemm = ptrdiff_t(M);
+        }
+
+        ThreadCountM = ThreadsPerGemm;
+        ThreadCountN = 1;
+    }
+
+    MlasTrySimpleParallel(ThreadPool,
+        ThreadsPerGemm * static_cast<ptrdiff_t>(BatchSize),
+        [=](ptrdiff_t tid)
+    {
+        ptrdiff_t GemmIdx = tid / ThreadsPerGemm;
+        ptrdiff_t ThreadIdx = tid % ThreadsPerGemm;
+        MlasBf16GemmThreaded(ThreadCountM, ThreadCountN,
+            TransA, TransB, M, N, K, &(Data[GemmIdx]), ThreadIdx);
+    });
+}
@@ -728,6 +728,86 @@ Return Value:
     }
 }
 
+void
+MlasConvDepthwiseThreaded(
+    void* Context,
+    ptrdiff_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    depthwise convolution operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_CONV_WORK_BLOCK* WorkBlock = (MLAS_CONV_WORK_BLOCK*)Context;
+
+    const MLAS_CONV_PARAMETERS* Parameters = WorkBlock->Parameters;
+
+    //
+    // Compute the range of indices to use for this thread.
+    //
+
+    const size_t GroupCount = Parameters->GroupCount;
+    const size_t BatchGroupCount = Parameters->BatchCount * GroupCount;
+
+    size_t BatchGroupStart;
+    size_t BatchGroupRemaining;
+
+    MlasPartitionWork(Index, WorkBlock->TargetThreadCount, BatchGroupCount,
+        &BatchGroupStart, &BatchGroupRemaining);
+
+    size_t BatchGroupEnd = BatchGroupStart + BatchGroupRemaining;
+
+    //
+    // Iterate over the batch and groups allocated to this thread. Each group
+    // is a single channel for the depthwise convolution.
+    //
+
+    const size_t OutputSize = Parameters->OutputSize;
+
+    const size_t InputGroupSize = Parameters->InputSize;
+    const size_t OutputGroupSize = OutputSize;
+    const size_t FilterGroupSize = Parameters->K;
+
+    for (size_t bg = BatchGroupStart; bg < BatchGroupEnd; bg++) {
+
+        size_t group = bg % GroupCount;
+
+        const float* input = WorkBlock->Input + bg * InputGroupSize;
+        const float* filter = WorkBlock->Filter + group * FilterGroupSize;
+        float* output = WorkBlock->Output + bg * OutputGroupSize;
+
+        MlasConvDepthwiseFloat_CHW(Parameters, input, filter, output,
+            WorkBlock->WorkingBuffer);
+
+        //
+        // Apply the activation with optional bias.
+        //
+
+        const float* bias = WorkBlock->Bias;
+
+        if (bias != nullptr) {
+            bias += group;
+        }
+
+        MlasActivation(Parameters->Activation, output, bias, 1, OutputSize,
+            OutputSize);
+    }
+}
+
 inline
 bool
 MlasConvTryMultithread(
@@ -873,11 +953,20 @@ Return Value:
 
     const MLAS_CONV_ALGORITHM Algorithm = Parameters->Algorithm;
 
+    if (Algorithm == MlasConvAlgorithmDepthwise) {
+        // Fill the Working Buffer with Zero for use by the depthwise kernel.
+        // The length for the zeros are input image wide + 2 currently.
+        std::fill_n(WorkingBuffer, Parameters->InputShape[1] + 2, 0.0f);
+    }
+
     //
-    // Schedule batches of GEMMs across multiple threads.
+    // Schedule batches of GEMMs or direct depthwise kernels across multiple
+    // threads.
     //
 
-    if (Algorithm == MlasConvAlgorithmGemmDirect && ((BatchCount > 1) || (GroupCount > 1))) {
+    if ((Algorithm == MlasConvAlgorithmGemmDirect ||
+        Algorithm == MlasConvAlgorithmDepthwise) &&
+        ((BatchCount > 1) || (GroupCount > 1))) {
 
         const size_t BatchGroupCount = BatchCount * GroupCount;
 
@@ -893,25 +982,19 @@ Return Value:
         WorkBlock.Input = Input;
         WorkBlock.Filter = Filter;
         WorkBlock.Bias = Bias;
-        WorkBlock.WorkingBuffer = nullptr;
+        WorkBlock.WorkingBuffer = WorkingBuffer;
         WorkBlock.Output = Output;
         WorkBlock.TargetThreadCount = TargetThreadCount;
 
-        MlasExecuteThreaded(MlasConvGemmDirectThreaded, &WorkBlock, TargetThreadCount, ThreadPool);
+        if (Algorithm == MlasConvAlgorithmDepthwise) {
+            MlasExecuteThreaded(MlasConvDepthwiseThreaded, &WorkBlock, TargetThreadCount, ThreadPool);
+        } else {
+            MlasExecuteThreaded(MlasConvGemmDirectThreaded, &WorkBlock, TargetThreadCount, ThreadPool);
+        }
 
         return;
     }
 
-#if defined(MLAS_TARGET_WASM_SCALAR)
-
-    if (Algorithm == MlasConvAlgorithmDepthwise) {
-        // Fill the Working Buffer with Zero for use by the depthwise kernel.
-        // The length for the zeros are input image wide + 2 currently.
-        std::fill_n(WorkingBuffer, Parameters->InputShape[1] + 2, 0.0f);
-    }
-
-#endif
-
     //
     // Iterate over each batch and group.
     //
@@ -974,8 +1057,6 @@ Return Value:
                     break;
                 }
 
-#if defined(MLAS_TARGET_WASM_SCALAR)
-
                 case MlasConvAlgorithmDepthwise:
                 {
                     MlasConvDepthwiseFloat_CHW(Parameters, Input, filter, Output, WorkingBuffer);
@@ -983,8 +1064,6 @@ Return Value:
                     break;
                 }
 
-#endif
-
                 case MlasConvAlgorithmExpandThenGemmSegmented:
                 {
                     //
@@ -1216,17 +1295,19 @@ Return Value:
 
     } else {
 
-#if defined(MLAS_TARGET_WASM_SCALAR)
-
-        // Scalar direct conv for depthwise convolution.
-        // Currently only support 3x3 kernel with padding <=1 and dilations = 1.
-        // TODO: support more general depthwise convolution.
+        //
+        // Direct convolution for the depthwise case, where each group is a
+        // single input channel convolved with a single filter channel. A
+        // tuned kernel covers the common 3x3 shape and a generic kernel
+        // covers the remaining kernel shapes with dilations of one.
+        //
 
         if (Dimensions == 2
                 && Parameters->FilterCount == 1 && Parameters->InputChannels == 1
-                && Parameters->KernelShape[0] == 3 && Parameters->KernelShape[1] == 3
-                && Parameters->Padding[0] <= 1 && Parameters->Padding[1] <= 1
-                && Parameters->Padding[2] <= 1 && Parameters->Padding[3] <= 1
+                && Parameters->Padding[0] < Parameters->KernelShape[0]
+                && Parameters->Padding[1] < Parameters->KernelShape[1]
+                && Parameters->Padding[2] < Parameters->KernelShape[0]
+                && Parameters->Padding[3] < Parameters->KernelShape[1]
                 && Parameters->DilationShape[0] == 1 && Parameters->DilationShape[1] == 1) {
 
             *WorkingBufferSize = Parameters->InputShape[1] + 2;
@@ -1234,8 +1315,6 @@ Return Value:
             return;
         }
 
-#endif
-
         //
         // Segment the operation across multiple threads by slicing the N
         // dimension (see MlasSgemmTryMultithread).
@@ -1248,8 +1327,8 @@ Return Value:
         ptrdiff_t TargetThreadCount;
         double Complexity = double(FilterCount) * double(OutputSize) * double(K);
 
-        if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MLAS_MAXIMUM_THREAD_COUNT)) {
-            TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+        if (Complexity < double(MlasPlatform.GemmThreadComplexity) * double(MLAS_MAXIMUM_THREAD_COUNT)) {
+            TargetThreadCount = ptrdiff_t(Complexity / double(MlasPlatform.GemmThreadComplexity)) + 1;
         } else {
             TargetThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
         }
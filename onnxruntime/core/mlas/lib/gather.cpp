@@ -0,0 +1,305 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    gather.cpp
+
+Abstract:
+
+    This module implements the gather operation, which copies a batch of rows
+    selected by an index vector from a source table to an output buffer. This
+    is the inner primitive for embedding table lookups.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the number of per-thread output bytes to target per worker thread.
+// Small gather operations should run on a single thread to avoid the
+// dispatch overhead of the thread pool.
+//
+
+#define MLAS_GATHER_THREAD_COMPLEXITY       (64 * 1024)
+
+//
+// Define the number of rows to prefetch ahead of the row being copied and
+// the maximum number of bytes to prefetch from each row. The hardware
+// prefetcher covers the remainder of rows longer than this limit.
+//
+
+#define MLAS_GATHER_PREFETCH_ROW_DISTANCE   8
+#define MLAS_GATHER_PREFETCH_MAXIMUM_BYTES  128
+
+MLAS_FORCEINLINE
+void
+MlasGatherPrefetchRow(
+    const uint8_t* Row,
+    size_t PrefetchBytes
+    )
+/*++
+
+Routine Description:
+
+    This routine issues software prefetches for the leading cache lines of a
+    row that a later loop iteration copies.
+
+Arguments:
+
+    Row - Supplies the address of the row to prefetch.
+
+    PrefetchBytes - Supplies the number of bytes to prefetch.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_SSE2_INTRINSICS)
+    for (size_t offset = 0; offset < PrefetchBytes; offset += 64) {
+        _mm_prefetch(reinterpret_cast<const char*>(Row + offset), _MM_HINT_T0);
+    }
+#elif defined(__GNUC__)
+    for (size_t offset = 0; offset < PrefetchBytes; offset += 64) {
+        __builtin_prefetch(Row + offset);
+    }
+#else
+    MLAS_UNREFERENCED_PARAMETER(Row);
+    MLAS_UNREFERENCED_PARAMETER(PrefetchBytes);
+#endif
+}
+
+template<typename IndexType>
+static
+void
+MlasGatherRows(
+    const uint8_t* Input,
+    const IndexType* Indices,
+    uint8_t* Output,
+    size_t IndexCount,
+    size_t RowCount,
+    size_t RowBytes
+    )
+/*++
+
+Routine Description:
+
+    This routine gathers a range of rows on a single thread.
+
+Arguments:
+
+    Input - Supplies the base address of the source table.
+
+    Indices - Supplies the row indices to gather. Negative indices are
+        wrapped by the row count of the table.
+
+    Output - Supplies the output buffer.
+
+    IndexCount - Supplies the number of rows to gather.
+
+    RowCount - Supplies the number of rows in the source table.
+
+    RowBytes - Supplies the number of bytes per row.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t PrefetchBytes = std::min(RowBytes, size_t(MLAS_GATHER_PREFETCH_MAXIMUM_BYTES));
+
+    //
+    // Copy rows with vector loads and stores when the row size permits, else
+    // fall back to a byte copy. The branch is hoisted out of the index loop
+    // to keep the copy loops tight.
+    //
+
+    if ((RowBytes % sizeof(MLAS_FLOAT32X4)) == 0) {
+
+        for (size_t i = 0; i < IndexCount; i++) {
+
+            if (i + MLAS_GATHER_PREFETCH_ROW_DISTANCE < IndexCount) {
+                IndexType PrefetchIndex = Indices[i + MLAS_GATHER_PREFETCH_ROW_DISTANCE];
+                if (PrefetchIndex < 0) {
+                    PrefetchIndex += IndexType(RowCount);
+                }
+                MlasGatherPrefetchRow(Input + size_t(PrefetchIndex) * RowBytes, PrefetchBytes);
+            }
+
+            IndexType Index = Indices[i];
+            if (Index < 0) {
+                Index += IndexType(RowCount);
+            }
+
+            const float* Row = reinterpret_cast<const float*>(Input + size_t(Index) * RowBytes);
+            float* RowOutput = reinterpret_cast<float*>(Output);
+            size_t RowBytesRemaining = RowBytes;
+
+            while (RowBytesRemaining >= 4 * sizeof(MLAS_FLOAT32X4)) {
+                MLAS_FLOAT32X4 Vector0 = MlasLoadFloat32x4(Row);
+                MLAS_FLOAT32X4 Vector1 = MlasLoadFloat32x4(Row + 4);
+                MLAS_FLOAT32X4 Vector2 = MlasLoadFloat32x4(Row + 8);
+                MLAS_FLOAT32X4 Vector3 = MlasLoadFloat32x4(Row + 12);
+                MlasStoreFloat32x4(RowOutput, Vector0);
+                MlasStoreFloat32x4(RowOutput + 4, Vector1);
+                MlasStoreFloat32x4(RowOutput + 8, Vector2);
+                MlasStoreFloat32x4(RowOutput + 12, Vector3);
+                Row += 16;
+                RowOutput += 16;
+                RowBytesRemaining -= 4 * sizeof(MLAS_FLOAT32X4);
+            }
+
+            while (RowBytesRemaining > 0) {
+                MlasStoreFloat32x4(RowOutput, MlasLoadFloat32x4(Row));
+                Row += 4;
+                RowOutput += 4;
+                RowBytesRemaining -= sizeof(MLAS_FLOAT32X4);
+            }
+
+            Output += RowBytes;
+        }
+
+    } else {
+
+        for (size_t i = 0; i < IndexCount; i++) {
+
+            if (i + MLAS_GATHER_PREFETCH_ROW_DISTANCE < IndexCount) {
+                IndexType PrefetchIndex = Indices[i + MLAS_GATHER_PREFETCH_ROW_DISTANCE];
+                if (PrefetchIndex < 0) {
+                    PrefetchIndex += IndexType(RowCount);
+                }
+                MlasGatherPrefetchRow(Input + size_t(PrefetchIndex) * RowBytes, PrefetchBytes);
+            }
+
+            IndexType Index = Indices[i];
+            if (Index < 0) {
+                Index += IndexType(RowCount);
+            }
+
+            memcpy(Output, Input + size_t(Index) * RowBytes, RowBytes);
+
+            Output += RowBytes;
+        }
+    }
+}
+
+template<typename IndexType>
+void
+MLASCALL
+MlasGather(
+    const uint8_t* Input,
+    const IndexType* Indices,
+    uint8_t* Output,
+    size_t IndexCount,
+    size_t RowCount,
+    size_t RowBytes,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine gathers rows from a source table into an output buffer.
+
+Arguments:
+
+    Input - Supplies the base address of the source table.
+
+    Indices - Supplies the row indices to gather. Negative indices are
+        wrapped by the row count of the table. The caller has validated that
+        all indices are within the inclusive range [-RowCount, RowCount - 1].
+
+    Output - Supplies the output buffer to receive the gathered rows.
+
+    IndexCount - Supplies the number of rows to gather.
+
+    RowCount - Supplies the number of rows in the source table.
+
+    RowBytes - Supplies the number of bytes per row.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (IndexCount == 0) {
+        return;
+    }
+
+    //
+    // Compute the number of target threads given the size of the gathered
+    // output. Small requests should run using the single threaded path.
+    //
+
+    const double Complexity = double(IndexCount) * double(RowBytes);
+
+    ptrdiff_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_GATHER_THREAD_COMPLEXITY * MlasPlatform.MaximumThreadCount)) {
+        TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_GATHER_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MlasPlatform.MaximumThreadCount;
+    }
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    if (size_t(TargetThreadCount) > IndexCount) {
+        TargetThreadCount = ptrdiff_t(IndexCount);
+    }
+
+    //
+    // Partition the indices across the target threads, with each thread
+    // gathering a contiguous range of rows.
+    //
+
+    MlasTrySimpleParallel(ThreadPool, TargetThreadCount, [&](ptrdiff_t tid) {
+
+        size_t RowIndex;
+        size_t RowsToGather;
+
+        MlasPartitionWork(tid, TargetThreadCount, IndexCount, &RowIndex, &RowsToGather);
+
+        MlasGatherRows(Input, Indices + RowIndex, Output + RowIndex * RowBytes,
+            RowsToGather, RowCount, RowBytes);
+    });
+}
+
+template
+void
+MLASCALL
+MlasGather<int32_t>(
+    const uint8_t* Input,
+    const int32_t* Indices,
+    uint8_t* Output,
+    size_t IndexCount,
+    size_t RowCount,
+    size_t RowBytes,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+template
+void
+MLASCALL
+MlasGather<int64_t>(
+    const uint8_t* Input,
+    const int64_t* Indices,
+    uint8_t* Output,
+    size_t IndexCount,
+    size_t RowCount,
+    size_t RowBytes,
+    MLAS_THREADPOOL* ThreadPool
+    );
@@ -0,0 +1,416 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    layernorm.cpp
+
+Abstract:
+
+    This module implements the layer normalization routine.
+
+    The layer normalization is computed in a single pass over each row: the
+    optional residual and bias additions are fused with the accumulation of
+    the sum and sum of squares, so the combined input value is read and
+    written exactly once before the normalization pass.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the parameters to execute segments of a layer normalization
+// operation on worker threads.
+//
+
+struct MLAS_LAYERNORM_WORK_BLOCK {
+    ptrdiff_t ThreadCountN;
+    bool SimplifiedLayerNorm;
+    const float* Input;
+    const float* Skip;
+    const float* Bias;
+    const float* Gamma;
+    const float* Beta;
+    float* Output;
+    float* Mean;
+    float* InvStdDev;
+    size_t N;
+    size_t D;
+    float Epsilon;
+};
+
+template<bool HasSkip, bool HasBias>
+static
+void
+MlasLayerNormAccumulateRow(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    float* Output,
+    size_t D,
+    float& Sum,
+    float& SumSquares
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the combined input value of one row, stores it to
+    the output buffer, and accumulates the sum and sum of squares of the row
+    in the same pass.
+
+Arguments:
+
+    Input - Supplies the input row.
+
+    Skip - Supplies the residual row added to the input, if HasSkip is true.
+
+    Bias - Supplies the bias vector added to the input, if HasBias is true.
+
+    Output - Supplies the output row receiving the combined input value.
+
+    D - Supplies the number of columns per row.
+
+    Sum - Receives the sum of the combined row.
+
+    SumSquares - Receives the sum of squares of the combined row.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_FLOAT32X4 SumVector = MlasZeroFloat32x4();
+    MLAS_FLOAT32X4 SumSquaresVector = MlasZeroFloat32x4();
+
+    size_t d = 0;
+
+    for (; d + 4 <= D; d += 4) {
+
+        MLAS_FLOAT32X4 Value = MlasLoadFloat32x4(Input + d);
+
+        if (HasSkip) {
+            Value = MlasAddFloat32x4(Value, MlasLoadFloat32x4(Skip + d));
+        }
+
+        if (HasBias) {
+            Value = MlasAddFloat32x4(Value, MlasLoadFloat32x4(Bias + d));
+        }
+
+        MlasStoreFloat32x4(Output + d, Value);
+
+        SumVector = MlasAddFloat32x4(SumVector, Value);
+        SumSquaresVector = MlasMultiplyAddFloat32x4(Value, Value, SumSquaresVector);
+    }
+
+    Sum = MlasReduceAddFloat32x4(SumVector);
+    SumSquares = MlasReduceAddFloat32x4(SumSquaresVector);
+
+    for (; d < D; d++) {
+
+        float Value = Input[d];
+
+        if (HasSkip) {
+            Value += Skip[d];
+        }
+
+        if (HasBias) {
+            Value += Bias[d];
+        }
+
+        Output[d] = Value;
+
+        Sum += Value;
+        SumSquares += Value * Value;
+    }
+}
+
+template<bool HasBeta>
+static
+void
+MlasLayerNormOutputRow(
+    const float* Gamma,
+    const float* Beta,
+    float* Output,
+    size_t D,
+    float Mean,
+    float InvStdDev
+    )
+/*++
+
+Routine Description:
+
+    This routine normalizes one row in place using the supplied row
+    statistics and applies the scale and optional shift vectors.
+
+Arguments:
+
+    Gamma - Supplies the scale vector.
+
+    Beta - Supplies the shift vector, if HasBeta is true.
+
+    Output - Supplies the row holding the combined input value, and receives
+        the normalized output.
+
+    D - Supplies the number of columns per row.
+
+    Mean - Supplies the mean of the row, else zero for the simplified form.
+
+    InvStdDev - Supplies the reciprocal standard deviation of the row.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_FLOAT32X4 MeanVector = MlasBroadcastFloat32x4(Mean);
+    MLAS_FLOAT32X4 InvStdDevVector = MlasBroadcastFloat32x4(InvStdDev);
+
+    size_t d = 0;
+
+    for (; d + 4 <= D; d += 4) {
+
+        MLAS_FLOAT32X4 Value = MlasLoadFloat32x4(Output + d);
+
+        Value = MlasMultiplyFloat32x4(MlasSubtractFloat32x4(Value, MeanVector), InvStdDevVector);
+        Value = MlasMultiplyFloat32x4(Value, MlasLoadFloat32x4(Gamma + d));
+
+        if (HasBeta) {
+            Value = MlasAddFloat32x4(Value, MlasLoadFloat32x4(Beta + d));
+        }
+
+        MlasStoreFloat32x4(Output + d, Value);
+    }
+
+    for (; d < D; d++) {
+
+        float Value = (Output[d] - Mean) * InvStdDev * Gamma[d];
+
+        if (HasBeta) {
+            Value += Beta[d];
+        }
+
+        Output[d] = Value;
+    }
+}
+
+static
+void
+MlasComputeLayerNormThreaded(
+    void* Context,
+    ptrdiff_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    layer normalization operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_LAYERNORM_WORK_BLOCK*)Context;
+
+    //
+    // Partition the operation along the N dimension.
+    //
+
+    size_t n;
+    size_t CountN;
+
+    MlasPartitionWork(Index, WorkBlock->ThreadCountN, WorkBlock->N, &n, &CountN);
+
+    const size_t D = WorkBlock->D;
+    const float Epsilon = WorkBlock->Epsilon;
+    const bool SimplifiedLayerNorm = WorkBlock->SimplifiedLayerNorm;
+
+    const float* Input = WorkBlock->Input + n * D;
+    const float* Skip = (WorkBlock->Skip != nullptr) ? WorkBlock->Skip + n * D : nullptr;
+    const float* Bias = WorkBlock->Bias;
+    const float* Gamma = WorkBlock->Gamma;
+    const float* Beta = WorkBlock->Beta;
+    float* Output = WorkBlock->Output + n * D;
+
+    while (CountN > 0) {
+
+        float Sum;
+        float SumSquares;
+
+        if (Skip != nullptr) {
+            if (Bias != nullptr) {
+                MlasLayerNormAccumulateRow<true, true>(Input, Skip, Bias, Output, D, Sum, SumSquares);
+            } else {
+                MlasLayerNormAccumulateRow<true, false>(Input, Skip, Bias, Output, D, Sum, SumSquares);
+            }
+        } else {
+            if (Bias != nullptr) {
+                MlasLayerNormAccumulateRow<false, true>(Input, Skip, Bias, Output, D, Sum, SumSquares);
+            } else {
+                MlasLayerNormAccumulateRow<false, false>(Input, Skip, Bias, Output, D, Sum, SumSquares);
+            }
+        }
+
+        float Mean = 0.0f;
+        float Variance = SumSquares / float(D);
+
+        if (!SimplifiedLayerNorm) {
+            Mean = Sum / float(D);
+            Variance -= Mean * Mean;
+        }
+
+        float InvStdDev = 1.0f / sqrtf(Variance + Epsilon);
+
+        if (Beta != nullptr) {
+            MlasLayerNormOutputRow<true>(Gamma, Beta, Output, D, Mean, InvStdDev);
+        } else {
+            MlasLayerNormOutputRow<false>(Gamma, Beta, Output, D, Mean, InvStdDev);
+        }
+
+        if (WorkBlock->Mean != nullptr) {
+            WorkBlock->Mean[n] = Mean;
+        }
+
+        if (WorkBlock->InvStdDev != nullptr) {
+            WorkBlock->InvStdDev[n] = InvStdDev;
+        }
+
+        Input += D;
+        if (Skip != nullptr) {
+            Skip += D;
+        }
+        Output += D;
+        n += 1;
+        CountN--;
+    }
+}
+
+void
+MLASCALL
+MlasComputeLayerNorm(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    const float* Gamma,
+    const float* Beta,
+    float* Output,
+    float* Mean,
+    float* InvStdDev,
+    size_t N,
+    size_t D,
+    float Epsilon,
+    bool SimplifiedLayerNorm,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the layer normalization function:
+
+        Output = (Input + Skip + Bias - mean) / stddev * Gamma + Beta
+
+    with the mean and standard deviation taken over each row. The simplified
+    form omits the mean subtraction and normalizes by the root mean square of
+    the row.
+
+    N.B. This implementation supports in place updates of the output buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer with N rows of D columns.
+
+    Skip - Supplies the optional residual buffer added to the input, else
+        nullptr.
+
+    Bias - Supplies the optional bias vector of length D added to the input,
+        else nullptr.
+
+    Gamma - Supplies the scale vector of length D.
+
+    Beta - Supplies the optional shift vector of length D, else nullptr.
+
+    Output - Supplies the output buffer.
+
+    Mean - Supplies the optional buffer receiving the mean of each row, else
+        nullptr.
+
+    InvStdDev - Supplies the optional buffer receiving the reciprocal
+        standard deviation of each row, else nullptr.
+
+    N - Supplies the number of rows to process.
+
+    D - Supplies the number of columns per row to process.
+
+    Epsilon - Supplies the epsilon value added to the variance.
+
+    SimplifiedLayerNorm - Supplies true to skip the mean subtraction, else
+        false for the standard layer normalization.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_LAYERNORM_WORK_BLOCK WorkBlock;
+
+    //
+    // Capture the layer normalization parameters to the work block.
+    //
+
+    WorkBlock.SimplifiedLayerNorm = SimplifiedLayerNorm;
+    WorkBlock.Input = Input;
+    WorkBlock.Skip = Skip;
+    WorkBlock.Bias = Bias;
+    WorkBlock.Gamma = Gamma;
+    WorkBlock.Beta = Beta;
+    WorkBlock.Output = Output;
+    WorkBlock.Mean = Mean;
+    WorkBlock.InvStdDev = InvStdDev;
+    WorkBlock.N = N;
+    WorkBlock.D = D;
+    WorkBlock.Epsilon = Epsilon;
+
+    //
+    // Compute the number of target threads given the complexity of the layer
+    // normalization operation. Limit the number of threads to the number of
+    // rows and try to keep each thread processing a minimum number of
+    // elements before using another thread.
+    //
+
+    ptrdiff_t ThreadCountN = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (size_t(ThreadCountN) > N) {
+        ThreadCountN = ptrdiff_t(N);
+    }
+
+    constexpr size_t MinimumElementsPerThread = 16384;
+
+    size_t BlockCount = ((N * D) / MinimumElementsPerThread) + 1;
+
+    if (size_t(ThreadCountN) > BlockCount) {
+        ThreadCountN = ptrdiff_t(BlockCount);
+    }
+
+    WorkBlock.ThreadCountN = ThreadCountN;
+
+    MlasExecuteThreaded(MlasComputeLayerNormThreaded, &WorkBlock, ThreadCountN, ThreadPool);
+}
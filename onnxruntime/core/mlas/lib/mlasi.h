@@ -627,6 +627,7 @@ extern "C" {
 #define MLAS_SGEMM_THREAD_COMPLEXITY                (64 * 1024)
 #define MLAS_DGEMM_THREAD_COMPLEXITY                (64 * 1024)
 #define MLAS_QGEMM_THREAD_COMPLEXITY                (64 * 1024)
+#define MLAS_BF16GEMM_THREAD_COMPLEXITY             (64 * 1024)
 
 //
 // Single-threaded single precision matrix/matrix multiply operation.
@@ -649,6 +650,39 @@ MlasSgemmOperation(
     size_t ldc
     );
 
+//
+// Helper routines from the single precision operation shared with the
+// bfloat16 operation, which expands its panels to single precision and reuses
+// the same packed layout and kernels.
+//
+
+void
+MlasSgemmMultiplyBeta(
+    float* C,
+    size_t CountM,
+    size_t CountN,
+    size_t ldc,
+    float beta
+    );
+
+void
+MlasSgemmCopyPackB(
+    float* D,
+    const float* B,
+    size_t ldb,
+    size_t CountX,
+    size_t CountY
+    );
+
+void
+MlasSgemmTransposePackB(
+    float* D,
+    const float* B,
+    size_t ldb,
+    size_t CountY,
+    size_t CountX
+    );
+
 //
 // Quantized integer matrix/matrix dispatch structure.
 //
@@ -662,6 +696,8 @@ extern const MLAS_GEMM_U8X8_DISPATCH MlasGemmU8U8DispatchAvx2;
 extern const MLAS_GEMM_U8X8_DISPATCH MlasGemmU8X8DispatchNeon;
 extern const MLAS_GEMM_U8X8_DISPATCH MlasGemmS8S8DispatchNeon;
 extern const MLAS_GEMM_U8X8_DISPATCH MlasGemmU8X8DispatchUdot;
+extern const MLAS_GEMM_U8X8_DISPATCH MlasGemmU8X8DispatchUmmla;
+extern const MLAS_GEMM_U8X8_DISPATCH MlasGemmU8X8DispatchWasmSimd;
 extern const MLAS_GEMM_U8X8_DISPATCH MlasGemmU8X8DispatchDefault;
 
 //
@@ -745,6 +781,14 @@ struct MLAS_PLATFORM {
     static constexpr int32_t MaximumThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
 #endif
 
+    //
+    // Per-thread work quantum (in M*N*K elements) used to decide how many
+    // threads a GEMM should target. Holds the static heuristic until
+    // MlasThreadingCalibrate measures the actual crossover for this machine.
+    //
+
+    int32_t GemmThreadComplexity{MLAS_SGEMM_THREAD_COMPLEXITY};
+
 #if defined(MLAS_TARGET_ARM64)
     const MLAS_GEMM_U8X8_DISPATCH* GemmU8X8Dispatch;
 #endif
@@ -868,8 +912,6 @@ MlasFp32FromBits(
 }
 
 
-#if defined(MLAS_TARGET_WASM_SCALAR)
-
 void
 MLASCALL
 MlasConvDepthwiseFloat_CHW(
@@ -880,8 +922,6 @@ MlasConvDepthwiseFloat_CHW(
     const float* Zeros
     );
 
-#endif
-
 
 //
 // Define the missing ARM64 NEON intrinsic macros from arm64_neon.h that enable
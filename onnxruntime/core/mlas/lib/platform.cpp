@@ -35,6 +35,9 @@ Abstract:
 #ifndef HWCAP_ASIMDDP
 #define HWCAP_ASIMDDP (1 << 20)
 #endif
+#ifndef HWCAP2_I8MM
+#define HWCAP2_I8MM (1 << 13)
+#endif
 #endif
 #endif // MLAS_TARGET_ARM64
 
@@ -308,7 +311,9 @@ Return Value:
 
                     //
                     // Check if the processor supports AVX512 core features
-                    // (AVX512BW/AVX512DQ/AVX512VL).
+                    // (AVX512BW/AVX512DQ/AVX512VL). These quantized kernels
+                    // share the AVX2 packed layouts but compute with 512-bit
+                    // registers.
                     //
 
                     if ((Cpuid7[1] & 0xC0020000) == 0xC0020000) {
@@ -318,7 +323,10 @@ Return Value:
                         this->GemmU8U8Kernel = MlasGemmU8U8KernelAvx512Core;
 
                         //
-                        // Check if the processor supports AVX512VNNI.
+                        // Check if the processor supports AVX512VNNI. The VNNI
+                        // kernels use vpdpbusd for the u8s8 inner product, so
+                        // the u8u8 path is also routed through the u8s8 packed
+                        // layout to use them.
                         //
 
                         if ((Cpuid7[2] & 0x800) != 0) {
@@ -363,6 +371,20 @@ Return Value:
         this->GemmU8X8Dispatch = &MlasGemmU8X8DispatchUdot;
     }
 
+#if defined(__linux__) && defined(MLAS_ARM64_I8MM)
+
+    //
+    // Check if the processor supports the int8 matrix multiply instructions.
+    //
+
+    bool HasUmmlaInstructions = ((getauxval(AT_HWCAP2) & HWCAP2_I8MM) != 0);
+
+    if (HasUmmlaInstructions) {
+        this->GemmU8X8Dispatch = &MlasGemmU8X8DispatchUmmla;
+    }
+
+#endif
+
 #endif // MLAS_TARGET_ARM64
 #if defined(MLAS_TARGET_POWER)
   this->GemmFloatKernel = MlasSgemmKernel;
@@ -60,6 +60,14 @@ void
 
 #define MLAS_POOL_REDUCTION_BUFFER_PADDING  ((sizeof(MLAS_FLOAT32X4) / sizeof(float)) - 1)
 
+//
+// Define the number of per-thread input elements to allocate per worker
+// thread. Small pooling operations should run on a single thread to avoid
+// the dispatch overhead of the thread pool.
+//
+
+#define MLAS_POOL_THREAD_COMPLEXITY         (16 * 1024)
+
 //
 // Abstraction for maximum pooling.
 //
@@ -1036,10 +1044,32 @@ Return Value:
         size_t InputSizeRemaining = InputSize;
 
         //
-        // Iterate over the input buffer a vector at a time.
+        // Iterate over the input buffer four vectors at a time. Multiple
+        // accumulators hide the latency of the reduction operation when
+        // pooling over a large spatial area.
         //
 
         MLAS_FLOAT32X4 Reduction = PoolingType::InitialVector();
+        MLAS_FLOAT32X4 Reduction1 = Reduction;
+        MLAS_FLOAT32X4 Reduction2 = Reduction;
+        MLAS_FLOAT32X4 Reduction3 = Reduction;
+
+        while (InputSizeRemaining >= 16) {
+            Reduction = PoolingType::Reduce(Reduction, MlasLoadFloat32x4(Input));
+            Reduction1 = PoolingType::Reduce(Reduction1, MlasLoadFloat32x4(Input + 4));
+            Reduction2 = PoolingType::Reduce(Reduction2, MlasLoadFloat32x4(Input + 8));
+            Reduction3 = PoolingType::Reduce(Reduction3, MlasLoadFloat32x4(Input + 12));
+            Input += 16;
+            InputSizeRemaining -= 16;
+        }
+
+        Reduction = PoolingType::Reduce(Reduction, Reduction1);
+        Reduction2 = PoolingType::Reduce(Reduction2, Reduction3);
+        Reduction = PoolingType::Reduce(Reduction, Reduction2);
+
+        //
+        // Iterate over the remaining input buffer a vector at a time.
+        //
 
         while (InputSizeRemaining >= 4) {
             Reduction = PoolingType::Reduce(Reduction, MlasLoadFloat32x4(Input));
@@ -1295,12 +1325,46 @@ Return Value:
 #endif
 #else
     //
-    // Use an external thread pool if one is provided.
-    // TODO: change to use MlasExecuteThreaded
-    onnxruntime::concurrency::ThreadPool::TryBatchParallelFor(ThreadPool, static_cast<ptrdiff_t>(TotalChannelCount), [&](ptrdiff_t c) {
-      PoolKernelRoutine(&WorkBlock, 1, Input + c * InputSize, Output + c * OutputSize);
-    }, 0);
-    return;
+    // Compute the number of target threads given the complexity of the pooling
+    // operation. Small requests should run using the single threaded path.
+    //
+
+    const double Complexity = double(InputSize) * double(TotalChannelCount);
+
+    ptrdiff_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_POOL_THREAD_COMPLEXITY * MlasPlatform.MaximumThreadCount)) {
+        TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_POOL_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MlasPlatform.MaximumThreadCount;
+    }
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    if (size_t(TargetThreadCount) > TotalChannelCount) {
+        TargetThreadCount = ptrdiff_t(TotalChannelCount);
+    }
+
+    //
+    // Partition the channels across the target threads, with each thread
+    // processing a contiguous range of channels to amortize the dispatch
+    // overhead of the thread pool.
+    //
+
+    MlasTrySimpleParallel(ThreadPool, TargetThreadCount, [&](ptrdiff_t tid) {
+
+        size_t ChannelIndex;
+        size_t ChannelCount;
+
+        MlasPartitionWork(tid, TargetThreadCount, TotalChannelCount, &ChannelIndex, &ChannelCount);
+
+        PoolKernelRoutine(&WorkBlock, ChannelCount, Input + ChannelIndex * InputSize,
+            Output + ChannelIndex * OutputSize);
+    });
 #endif
 }
 
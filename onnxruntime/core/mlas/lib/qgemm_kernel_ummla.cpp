@@ -0,0 +1,659 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    qgemm_kernel_ummla.cpp
+
+Abstract:
+
+    This module implements the QGEMM kernel for the ARM64 i8mm matrix multiply
+    extension.
+
+    The UMMLA instruction computes a 2x2 block of 32-bit accumulators from a
+    2x8 block of matrix A and a 8x2 block of matrix B per issue, doubling the
+    int8 multiply/accumulate rate over the UDOT kernel. Signed matrix B data
+    is converted to unsigned data with an offset in order to share a common
+    kernel, matching the UDOT implementation.
+
+--*/
+
+#include "mlasi.h"
+#include "qgemm.h"
+
+struct MLAS_GEMM_U8X8_KERNEL_UMMLA
+{
+    typedef uint8_t PackedAType;
+    typedef uint8_t PackedBType;
+    typedef uint8_t OffsetBType;
+
+    static constexpr size_t PackedK = 8;
+    static constexpr MLAS_GEMM_U8X8_STRIDES Strides{ 24, 128, 256 };
+    static constexpr MLAS_GEMM_U8X8_STRIDES PackedStrides{ 24, 128, 384 };
+};
+
+constexpr size_t MLAS_GEMM_U8X8_KERNEL_UMMLA::PackedK;
+constexpr MLAS_GEMM_U8X8_STRIDES MLAS_GEMM_U8X8_KERNEL_UMMLA::Strides;
+constexpr MLAS_GEMM_U8X8_STRIDES MLAS_GEMM_U8X8_KERNEL_UMMLA::PackedStrides;
+
+template<>
+MLAS_FORCEINLINE
+int32_t
+MlasGemmU8X8FixupZeroPointB<MLAS_GEMM_U8X8_KERNEL_UMMLA>(
+    int32_t ZeroPointB,
+    bool BIsSigned
+    )
+{
+    if (BIsSigned) {
+        ZeroPointB = MLAS_GEMM_U8X8_KERNEL_UMMLA::OffsetBType(ZeroPointB ^ 0x80);
+    }
+
+    return ZeroPointB;
+}
+
+MLAS_FORCEINLINE
+int32_t
+MlasGemmU8X8ReduceRowSumUmmla(
+    uint32x2_t RowSum
+    )
+{
+    return int32_t(vget_lane_u32(vpadd_u32(RowSum, RowSum), 0));
+}
+
+template<>
+void
+MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_UMMLA>(
+    MLAS_GEMM_U8X8_KERNEL_UMMLA::PackedAType* D,
+    const uint8_t* A,
+    size_t lda,
+    size_t CountM,
+    size_t CountK,
+    int32_t* RowSumBuffer
+    )
+{
+    uint8_t PaddedMatrixAData[8];
+
+    //
+    // Process four rows of matrix A.
+    //
+    // The buffer is packed as a series of 8 byte vectors where four rows are
+    // interleaved with the following pattern:
+    //
+    //      [ A0 A1 A2 A3 A4 A5 A6 A7 ]
+    //      [ B0 B1 B2 B3 B4 B5 B6 B7 ]
+    //      [ C0 C1 C2 C3 C4 C5 C6 C7 ]
+    //      [ D0 D1 D2 D3 D4 D5 D6 D7 ]
+    //
+    // The UMMLA kernel consumes pairs of rows as the 2x8 matrix A operand.
+    //
+    // This pattern is repeated (CountK / 8) times.
+    //
+    // If CountK is not aligned to a multiple of eight, then the vector is
+    // padded with zeroes.
+    //
+
+    while (CountM >= 4) {
+
+        const uint8_t* a0 = A;
+        const uint8_t* a1 = a0 + lda;
+        const uint8_t* a2 = a1 + lda;
+        const uint8_t* a3 = a2 + lda;
+
+        size_t k = CountK;
+        uint32x2_t RowSums0 = vmov_n_u32(0);
+        uint32x2_t RowSums1 = vmov_n_u32(0);
+        uint32x2_t RowSums2 = vmov_n_u32(0);
+        uint32x2_t RowSums3 = vmov_n_u32(0);
+
+        while (k >= 8) {
+
+            uint8x8_t v0 = vld1_u8(a0);
+            a0 += 8;
+            uint8x8_t v1 = vld1_u8(a1);
+            a1 += 8;
+            uint8x8_t v2 = vld1_u8(a2);
+            a2 += 8;
+            uint8x8_t v3 = vld1_u8(a3);
+            a3 += 8;
+
+            vst1_u8(&D[0], v0);
+            vst1_u8(&D[8], v1);
+            vst1_u8(&D[16], v2);
+            vst1_u8(&D[24], v3);
+
+            RowSums0 = vadd_u32(RowSums0, vpaddl_u16(vpaddl_u8(v0)));
+            RowSums1 = vadd_u32(RowSums1, vpaddl_u16(vpaddl_u8(v1)));
+            RowSums2 = vadd_u32(RowSums2, vpaddl_u16(vpaddl_u8(v2)));
+            RowSums3 = vadd_u32(RowSums3, vpaddl_u16(vpaddl_u8(v3)));
+
+            D += 32;
+            k -= 8;
+        }
+
+        if (k > 0) {
+
+            //
+            // Copy the remaining bytes of each row through the zero padded
+            // stack buffer.
+            //
+
+            const uint8_t* a[4] = { a0, a1, a2, a3 };
+            uint32x2_t* RowSums[4] = { &RowSums0, &RowSums1, &RowSums2, &RowSums3 };
+
+            for (size_t row = 0; row < 4; row++) {
+
+                vst1_u8(PaddedMatrixAData, vmov_n_u8(0));
+
+                for (size_t kk = 0; kk < k; kk++) {
+                    PaddedMatrixAData[kk] = a[row][kk];
+                }
+
+                uint8x8_t v = vld1_u8(PaddedMatrixAData);
+                vst1_u8(D, v);
+
+                *RowSums[row] = vadd_u32(*RowSums[row], vpaddl_u16(vpaddl_u8(v)));
+
+                D += 8;
+            }
+        }
+
+        RowSumBuffer[0] = MlasGemmU8X8ReduceRowSumUmmla(RowSums0);
+        RowSumBuffer[1] = MlasGemmU8X8ReduceRowSumUmmla(RowSums1);
+        RowSumBuffer[2] = MlasGemmU8X8ReduceRowSumUmmla(RowSums2);
+        RowSumBuffer[3] = MlasGemmU8X8ReduceRowSumUmmla(RowSums3);
+
+        RowSumBuffer += 4;
+
+        A = A + lda * 4;
+        CountM -= 4;
+    }
+
+    //
+    // Process two rows of matrix A.
+    //
+
+    if (CountM >= 2) {
+
+        const uint8_t* a0 = A;
+        const uint8_t* a1 = a0 + lda;
+
+        size_t k = CountK;
+        uint32x2_t RowSums0 = vmov_n_u32(0);
+        uint32x2_t RowSums1 = vmov_n_u32(0);
+
+        while (k >= 8) {
+
+            uint8x8_t v0 = vld1_u8(a0);
+            a0 += 8;
+            uint8x8_t v1 = vld1_u8(a1);
+            a1 += 8;
+
+            vst1_u8(&D[0], v0);
+            vst1_u8(&D[8], v1);
+
+            RowSums0 = vadd_u32(RowSums0, vpaddl_u16(vpaddl_u8(v0)));
+            RowSums1 = vadd_u32(RowSums1, vpaddl_u16(vpaddl_u8(v1)));
+
+            D += 16;
+            k -= 8;
+        }
+
+        if (k > 0) {
+
+            const uint8_t* a[2] = { a0, a1 };
+            uint32x2_t* RowSums[2] = { &RowSums0, &RowSums1 };
+
+            for (size_t row = 0; row < 2; row++) {
+
+                vst1_u8(PaddedMatrixAData, vmov_n_u8(0));
+
+                for (size_t kk = 0; kk < k; kk++) {
+                    PaddedMatrixAData[kk] = a[row][kk];
+                }
+
+                uint8x8_t v = vld1_u8(PaddedMatrixAData);
+                vst1_u8(D, v);
+
+                *RowSums[row] = vadd_u32(*RowSums[row], vpaddl_u16(vpaddl_u8(v)));
+
+                D += 8;
+            }
+        }
+
+        RowSumBuffer[0] = MlasGemmU8X8ReduceRowSumUmmla(RowSums0);
+        RowSumBuffer[1] = MlasGemmU8X8ReduceRowSumUmmla(RowSums1);
+
+        RowSumBuffer += 2;
+
+        A = A + lda * 2;
+        CountM -= 2;
+    }
+
+    //
+    // Process the last row of matrix A. The kernel zeroes the second row of
+    // the 2x8 matrix A operand, so only the row data itself is packed.
+    //
+
+    if (CountM > 0) {
+
+        const uint8_t* a = A;
+        size_t k = CountK;
+        uint32x2_t RowSums = vmov_n_u32(0);
+
+        while (k >= 8) {
+
+            uint8x8_t v = vld1_u8(a);
+            a += 8;
+
+            vst1_u8(D, v);
+
+            RowSums = vadd_u32(RowSums, vpaddl_u16(vpaddl_u8(v)));
+
+            D += 8;
+            k -= 8;
+        }
+
+        if (k > 0) {
+
+            vst1_u8(PaddedMatrixAData, vmov_n_u8(0));
+
+            for (size_t kk = 0; kk < k; kk++) {
+                PaddedMatrixAData[kk] = a[kk];
+            }
+
+            uint8x8_t v = vld1_u8(PaddedMatrixAData);
+            vst1_u8(D, v);
+
+            RowSums = vadd_u32(RowSums, vpaddl_u16(vpaddl_u8(v)));
+        }
+
+        *RowSumBuffer = MlasGemmU8X8ReduceRowSumUmmla(RowSums);
+    }
+}
+
+MLAS_FORCEINLINE
+void
+MlasGemmU8X8CopyPackBProcessUmmla(
+    MLAS_GEMM_U8X8_KERNEL_UMMLA::PackedBType* D,
+    uint8x8_t BytesRow[8],
+    uint8x16_t BitFlipVector,
+    uint32x4_t ColumnSums[2]
+    )
+{
+    //
+    // Transpose the 8x8 block of matrix B so that the eight values of each
+    // column are contiguous, forming the 8x2 matrix B operand pairs consumed
+    // by the UMMLA kernel. Signed buffers are converted to unsigned buffers
+    // in order to share a common kernel.
+    //
+
+    uint8x8_t BitFlip = vget_low_u8(BitFlipVector);
+
+    uint8x8_t r0 = veor_u8(BytesRow[0], BitFlip);
+    uint8x8_t r1 = veor_u8(BytesRow[1], BitFlip);
+    uint8x8_t r2 = veor_u8(BytesRow[2], BitFlip);
+    uint8x8_t r3 = veor_u8(BytesRow[3], BitFlip);
+    uint8x8_t r4 = veor_u8(BytesRow[4], BitFlip);
+    uint8x8_t r5 = veor_u8(BytesRow[5], BitFlip);
+    uint8x8_t r6 = veor_u8(BytesRow[6], BitFlip);
+    uint8x8_t r7 = veor_u8(BytesRow[7], BitFlip);
+
+    uint8x8x2_t t01 = vtrn_u8(r0, r1);
+    uint8x8x2_t t23 = vtrn_u8(r2, r3);
+    uint8x8x2_t t45 = vtrn_u8(r4, r5);
+    uint8x8x2_t t67 = vtrn_u8(r6, r7);
+
+    uint16x4x2_t u02 = vtrn_u16(vreinterpret_u16_u8(t01.val[0]), vreinterpret_u16_u8(t23.val[0]));
+    uint16x4x2_t u13 = vtrn_u16(vreinterpret_u16_u8(t01.val[1]), vreinterpret_u16_u8(t23.val[1]));
+    uint16x4x2_t u46 = vtrn_u16(vreinterpret_u16_u8(t45.val[0]), vreinterpret_u16_u8(t67.val[0]));
+    uint16x4x2_t u57 = vtrn_u16(vreinterpret_u16_u8(t45.val[1]), vreinterpret_u16_u8(t67.val[1]));
+
+    uint32x2x2_t v04 = vtrn_u32(vreinterpret_u32_u16(u02.val[0]), vreinterpret_u32_u16(u46.val[0]));
+    uint32x2x2_t v15 = vtrn_u32(vreinterpret_u32_u16(u13.val[0]), vreinterpret_u32_u16(u57.val[0]));
+    uint32x2x2_t v26 = vtrn_u32(vreinterpret_u32_u16(u02.val[1]), vreinterpret_u32_u16(u46.val[1]));
+    uint32x2x2_t v37 = vtrn_u32(vreinterpret_u32_u16(u13.val[1]), vreinterpret_u32_u16(u57.val[1]));
+
+    vst1_u8(&D[0], vreinterpret_u8_u32(v04.val[0]));
+    vst1_u8(&D[8], vreinterpret_u8_u32(v15.val[0]));
+    vst1_u8(&D[16], vreinterpret_u8_u32(v26.val[0]));
+    vst1_u8(&D[24], vreinterpret_u8_u32(v37.val[0]));
+    vst1_u8(&D[32], vreinterpret_u8_u32(v04.val[1]));
+    vst1_u8(&D[40], vreinterpret_u8_u32(v15.val[1]));
+    vst1_u8(&D[48], vreinterpret_u8_u32(v26.val[1]));
+    vst1_u8(&D[56], vreinterpret_u8_u32(v37.val[1]));
+
+    //
+    // Accumulate the column sums from the row vectors before the transpose,
+    // folding the 16-bit partial sums into the 32-bit accumulators.
+    //
+
+    uint16x8_t BlockSum = vaddq_u16(
+        vaddq_u16(vaddl_u8(r0, r1), vaddl_u8(r2, r3)),
+        vaddq_u16(vaddl_u8(r4, r5), vaddl_u8(r6, r7)));
+
+    ColumnSums[0] = vaddw_u16(ColumnSums[0], vget_low_u16(BlockSum));
+    ColumnSums[1] = vaddw_u16(ColumnSums[1], vget_high_u16(BlockSum));
+}
+
+template<>
+void
+MlasGemmU8X8CopyPackB<MLAS_GEMM_U8X8_KERNEL_UMMLA>(
+    MLAS_GEMM_U8X8_KERNEL_UMMLA::PackedBType* D,
+    const uint8_t* B,
+    size_t ldb,
+    size_t CountN,
+    size_t CountK,
+    int32_t* ColumnSumBuffer,
+    bool BIsSigned
+    )
+{
+    const uint8x16_t BitFlipVector = vdupq_n_u8(BIsSigned ? 0x80 : 0);
+    uint8x8_t BytesRow[8];
+
+    //
+    // Process 8 columns of matrix B in a loop.
+    //
+    // The buffer is packed as a series of 8 byte vectors where each vector
+    // holds eight rows of one column:
+    //
+    //      [ A0 A1 A2 A3 A4 A5 A6 A7 ]
+    //      [ B0 B1 B2 B3 B4 B5 B6 B7 ]
+    //      ...
+    //      [ H0 H1 H2 H3 H4 H5 H6 H7 ]
+    //
+    // Adjacent column vectors form the 8x2 matrix B operand pairs consumed by
+    // the UMMLA kernel. This pattern is repeated (CountK / 8) times.
+    //
+    // If CountK is not aligned to a multiple of eight, then the rows are
+    // padded with the bit flip value so the converted values are zeroes.
+    //
+    // If CountN is not aligned to a multiple of eight, then the extra columns
+    // are padded with zeroes.
+    //
+
+    while (CountN >= 8) {
+
+        const uint8_t* b = B;
+        size_t k = CountK;
+        uint32x4_t ColumnSums[2];
+
+        ColumnSums[0] = vmovq_n_u32(0);
+        ColumnSums[1] = vmovq_n_u32(0);
+
+        while (k >= 8) {
+
+            BytesRow[0] = vld1_u8(&b[ldb * 0]);
+            BytesRow[1] = vld1_u8(&b[ldb * 1]);
+            BytesRow[2] = vld1_u8(&b[ldb * 2]);
+            BytesRow[3] = vld1_u8(&b[ldb * 3]);
+            BytesRow[4] = vld1_u8(&b[ldb * 4]);
+            BytesRow[5] = vld1_u8(&b[ldb * 5]);
+            BytesRow[6] = vld1_u8(&b[ldb * 6]);
+            BytesRow[7] = vld1_u8(&b[ldb * 7]);
+
+            MlasGemmU8X8CopyPackBProcessUmmla(D, BytesRow, BitFlipVector, ColumnSums);
+
+            b += ldb * 8;
+            D += 64;
+            k -= 8;
+        }
+
+        if (k > 0) {
+
+            for (size_t kk = 0; kk < 8; kk++) {
+                BytesRow[kk] = (kk < k) ? vld1_u8(&b[ldb * kk]) : vget_low_u8(BitFlipVector);
+            }
+
+            MlasGemmU8X8CopyPackBProcessUmmla(D, BytesRow, BitFlipVector, ColumnSums);
+
+            D += 64;
+        }
+
+        vst1q_s32(&ColumnSumBuffer[0], vreinterpretq_s32_u32(ColumnSums[0]));
+        vst1q_s32(&ColumnSumBuffer[4], vreinterpretq_s32_u32(ColumnSums[1]));
+        ColumnSumBuffer += 8;
+
+        B += 8;
+        CountN -= 8;
+    }
+
+    //
+    // Process the remaining columns of matrix B.
+    //
+
+    if (CountN > 0) {
+
+        const uint8_t* b = B;
+        size_t k = CountK;
+        uint8_t PaddedMatrixBData[8];
+        uint32x4_t ColumnSums[2];
+
+        ColumnSums[0] = vmovq_n_u32(0);
+        ColumnSums[1] = vmovq_n_u32(0);
+
+        //
+        // Interleave rows of matrix B using an intermediate padded stack
+        // buffer and write to the packed buffer. The padding value is
+        // converted to zero by the bit flip in the block copy below.
+        //
+
+        while (k > 0) {
+
+            for (size_t kk = 0; kk < 8; kk++) {
+
+                vst1_u8(PaddedMatrixBData, vget_low_u8(BitFlipVector));
+
+                if (kk < k) {
+                    for (size_t n = 0; n < CountN; n++) {
+                        PaddedMatrixBData[n] = b[ldb * kk + n];
+                    }
+                }
+
+                BytesRow[kk] = vld1_u8(PaddedMatrixBData);
+            }
+
+            MlasGemmU8X8CopyPackBProcessUmmla(D, BytesRow, BitFlipVector, ColumnSums);
+
+            b += ldb * 8;
+            D += 64;
+            k -= (k >= 8) ? 8 : k;
+        }
+
+        vst1q_s32(&ColumnSumBuffer[0], vreinterpretq_s32_u32(ColumnSums[0]));
+        vst1q_s32(&ColumnSumBuffer[4], vreinterpretq_s32_u32(ColumnSums[1]));
+    }
+}
+
+template<size_t Rows>
+MLAS_FORCEINLINE
+void
+MlasGemmU8X8KernelUmmlaLoop(
+    const uint8_t* a,
+    const uint8_t* b,
+    size_t PackedCountK,
+    uint32x4_t Accumulators[2][4]
+    )
+{
+    for (size_t k = 0; k < PackedCountK; k++) {
+
+        uint8x16_t b0 = vld1q_u8(&b[0]);
+        uint8x16_t b1 = vld1q_u8(&b[16]);
+        uint8x16_t b2 = vld1q_u8(&b[32]);
+        uint8x16_t b3 = vld1q_u8(&b[48]);
+
+        uint8x16_t a01;
+
+        if (Rows == 1) {
+            a01 = vcombine_u8(vld1_u8(a), vmov_n_u8(0));
+            a += 8;
+        } else {
+            a01 = vld1q_u8(a);
+            a += 16;
+        }
+
+        Accumulators[0][0] = vmmlaq_u32(Accumulators[0][0], a01, b0);
+        Accumulators[0][1] = vmmlaq_u32(Accumulators[0][1], a01, b1);
+        Accumulators[0][2] = vmmlaq_u32(Accumulators[0][2], a01, b2);
+        Accumulators[0][3] = vmmlaq_u32(Accumulators[0][3], a01, b3);
+
+        if (Rows == 4) {
+
+            uint8x16_t a23 = vld1q_u8(a);
+            a += 16;
+
+            Accumulators[1][0] = vmmlaq_u32(Accumulators[1][0], a23, b0);
+            Accumulators[1][1] = vmmlaq_u32(Accumulators[1][1], a23, b1);
+            Accumulators[1][2] = vmmlaq_u32(Accumulators[1][2], a23, b2);
+            Accumulators[1][3] = vmmlaq_u32(Accumulators[1][3], a23, b3);
+        }
+
+        b += 64;
+    }
+}
+
+MLAS_FORCEINLINE
+void
+MlasGemmU8X8KernelUmmlaStoreRow(
+    int32x4_t RowLow,
+    int32x4_t RowHigh,
+    int32_t RowSum,
+    int32_t* c,
+    size_t CountN,
+    const int32_t* ColumnSumBuffer,
+    const int32_t* ZeroPointB,
+    bool ZeroMode
+    )
+{
+    int32x4_t RowSumLow = vdupq_n_s32(RowSum);
+    int32x4_t RowSumHigh = RowSumLow;
+
+    if (ZeroPointB != nullptr) {
+        RowSumLow = vmulq_s32(RowSumLow, vld1q_s32(&ZeroPointB[0]));
+        RowSumHigh = vmulq_s32(RowSumHigh, vld1q_s32(&ZeroPointB[4]));
+    }
+
+    RowLow = vaddq_s32(RowLow, vaddq_s32(RowSumLow, vld1q_s32(&ColumnSumBuffer[0])));
+    RowHigh = vaddq_s32(RowHigh, vaddq_s32(RowSumHigh, vld1q_s32(&ColumnSumBuffer[4])));
+
+    if (CountN >= 8) {
+
+        if (!ZeroMode) {
+            RowLow = vaddq_s32(RowLow, vld1q_s32(&c[0]));
+            RowHigh = vaddq_s32(RowHigh, vld1q_s32(&c[4]));
+        }
+
+        vst1q_s32(&c[0], RowLow);
+        vst1q_s32(&c[4], RowHigh);
+
+    } else {
+
+        int32_t Columns[8];
+
+        vst1q_s32(&Columns[0], RowLow);
+        vst1q_s32(&Columns[4], RowHigh);
+
+        for (size_t n = 0; n < CountN; n++) {
+
+            int32_t Accumulator = Columns[n];
+
+            if (!ZeroMode) {
+                Accumulator += c[n];
+            }
+
+            c[n] = Accumulator;
+        }
+    }
+}
+
+template<>
+size_t
+MlasGemmU8X8Kernel<MLAS_GEMM_U8X8_KERNEL_UMMLA>(
+    const MLAS_GEMM_U8X8_KERNEL_UMMLA::PackedAType* A,
+    const MLAS_GEMM_U8X8_KERNEL_UMMLA::PackedBType* B,
+    int32_t* C,
+    size_t PackedCountK,
+    size_t CountM,
+    size_t CountN,
+    size_t ldc,
+    const int32_t* RowSumBuffer,
+    const int32_t* ColumnSumBuffer,
+    const int32_t* ZeroPointB,
+    bool ZeroMode
+    )
+{
+    size_t RowsHandled = (CountM >= 4) ? 4 : (CountM >= 2) ? 2 : 1;
+
+    //
+    // Process 8 columns of matrix B in a loop, computing the 2x2 accumulator
+    // blocks for each pair of packed rows and pair of packed columns.
+    //
+
+    while (CountN > 0) {
+
+        uint32x4_t Accumulators[2][4];
+
+        for (size_t p = 0; p < 2; p++) {
+            for (size_t q = 0; q < 4; q++) {
+                Accumulators[p][q] = vmovq_n_u32(0);
+            }
+        }
+
+        if (RowsHandled == 4) {
+            MlasGemmU8X8KernelUmmlaLoop<4>(A, B, PackedCountK, Accumulators);
+        } else if (RowsHandled == 2) {
+            MlasGemmU8X8KernelUmmlaLoop<2>(A, B, PackedCountK, Accumulators);
+        } else {
+            MlasGemmU8X8KernelUmmlaLoop<1>(A, B, PackedCountK, Accumulators);
+        }
+
+        //
+        // Rearrange the 2x2 accumulator blocks into per-row vectors and apply
+        // the sum fixups while the results are still in registers.
+        //
+
+        for (size_t p = 0; p < (RowsHandled + 1) / 2; p++) {
+
+            int32x4_t Row0Low = vreinterpretq_s32_u32(vcombine_u32(
+                vget_low_u32(Accumulators[p][0]), vget_low_u32(Accumulators[p][1])));
+            int32x4_t Row0High = vreinterpretq_s32_u32(vcombine_u32(
+                vget_low_u32(Accumulators[p][2]), vget_low_u32(Accumulators[p][3])));
+
+            MlasGemmU8X8KernelUmmlaStoreRow(Row0Low, Row0High, RowSumBuffer[p * 2],
+                C + (p * 2) * ldc, CountN, ColumnSumBuffer, ZeroPointB, ZeroMode);
+
+            if (p * 2 + 1 < RowsHandled) {
+
+                int32x4_t Row1Low = vreinterpretq_s32_u32(vcombine_u32(
+                    vget_high_u32(Accumulators[p][0]), vget_high_u32(Accumulators[p][1])));
+                int32x4_t Row1High = vreinterpretq_s32_u32(vcombine_u32(
+                    vget_high_u32(Accumulators[p][2]), vget_high_u32(Accumulators[p][3])));
+
+                MlasGemmU8X8KernelUmmlaStoreRow(Row1Low, Row1High, RowSumBuffer[p * 2 + 1],
+                    C + (p * 2 + 1) * ldc, CountN, ColumnSumBuffer, ZeroPointB, ZeroMode);
+            }
+        }
+
+        B += PackedCountK * 64;
+        C += 8;
+        ColumnSumBuffer += 8;
+
+        if (ZeroPointB != nullptr) {
+            ZeroPointB += 8;
+        }
+
+        CountN -= (CountN >= 8) ? 8 : CountN;
+    }
+
+    return RowsHandled;
+}
+
+const MLAS_GEMM_U8X8_DISPATCH MlasGemmU8X8DispatchUmmla = {
+    MlasGemmU8X8Operation<MLAS_GEMM_U8X8_KERNEL_UMMLA>,
+    MlasGemmU8X8PackedOperation<MLAS_GEMM_U8X8_KERNEL_UMMLA>,
+    MlasGemmU8X8CopyPackB<MLAS_GEMM_U8X8_KERNEL_UMMLA>,
+    MLAS_GEMM_U8X8_KERNEL_UMMLA::PackedK,
+    MLAS_GEMM_U8X8_KERNEL_UMMLA::PackedStrides.K,
+};
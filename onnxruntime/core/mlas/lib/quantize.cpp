@@ -350,6 +350,241 @@ MlasQuantizeLinear<uint8_t>(
     );
 #endif
 
+#if defined(MLAS_NEON64_INTRINSICS) || defined(MLAS_SSE2_INTRINSICS)
+
+//
+// DequantizeLinear implementation using NEON or SSE2 intrinsics.
+//
+
+template<typename InputType>
+MLAS_FORCEINLINE
+void
+MlasDequantizeLinearUnpackBytes(
+    MLAS_INT32X4 IntegerVector[4],
+    const InputType* Input
+    );
+
+#if defined(MLAS_NEON64_INTRINSICS)
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasDequantizeLinearUnpackBytes<uint8_t>(
+    MLAS_INT32X4 IntegerVector[4],
+    const uint8_t* Input
+    )
+{
+    uint8x16_t ByteVector = vld1q_u8(Input);
+    uint16x8_t WordVectorLow = vmovl_u8(vget_low_u8(ByteVector));
+    uint16x8_t WordVectorHigh = vmovl_u8(vget_high_u8(ByteVector));
+
+    IntegerVector[0] = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(WordVectorLow)));
+    IntegerVector[1] = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(WordVectorLow)));
+    IntegerVector[2] = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(WordVectorHigh)));
+    IntegerVector[3] = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(WordVectorHigh)));
+}
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasDequantizeLinearUnpackBytes<int8_t>(
+    MLAS_INT32X4 IntegerVector[4],
+    const int8_t* Input
+    )
+{
+    int8x16_t ByteVector = vld1q_s8(Input);
+    int16x8_t WordVectorLow = vmovl_s8(vget_low_s8(ByteVector));
+    int16x8_t WordVectorHigh = vmovl_s8(vget_high_s8(ByteVector));
+
+    IntegerVector[0] = vmovl_s16(vget_low_s16(WordVectorLow));
+    IntegerVector[1] = vmovl_s16(vget_high_s16(WordVectorLow));
+    IntegerVector[2] = vmovl_s16(vget_low_s16(WordVectorHigh));
+    IntegerVector[3] = vmovl_s16(vget_high_s16(WordVectorHigh));
+}
+
+#else
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasDequantizeLinearUnpackBytes<uint8_t>(
+    MLAS_INT32X4 IntegerVector[4],
+    const uint8_t* Input
+    )
+{
+    __m128i ByteVector = _mm_loadu_si128((const __m128i*)Input);
+    __m128i ZeroVector = _mm_setzero_si128();
+    __m128i WordVectorLow = _mm_unpacklo_epi8(ByteVector, ZeroVector);
+    __m128i WordVectorHigh = _mm_unpackhi_epi8(ByteVector, ZeroVector);
+
+    IntegerVector[0] = _mm_unpacklo_epi16(WordVectorLow, ZeroVector);
+    IntegerVector[1] = _mm_unpackhi_epi16(WordVectorLow, ZeroVector);
+    IntegerVector[2] = _mm_unpacklo_epi16(WordVectorHigh, ZeroVector);
+    IntegerVector[3] = _mm_unpackhi_epi16(WordVectorHigh, ZeroVector);
+}
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasDequantizeLinearUnpackBytes<int8_t>(
+    MLAS_INT32X4 IntegerVector[4],
+    const int8_t* Input
+    )
+{
+    //
+    // Sign extend by duplicating each byte into the high byte of the word and
+    // then shifting the word arithmetically back down.
+    //
+
+    __m128i ByteVector = _mm_loadu_si128((const __m128i*)Input);
+    __m128i WordVectorLow = _mm_srai_epi16(_mm_unpacklo_epi8(ByteVector, ByteVector), 8);
+    __m128i WordVectorHigh = _mm_srai_epi16(_mm_unpackhi_epi8(ByteVector, ByteVector), 8);
+
+    IntegerVector[0] = _mm_srai_epi32(_mm_unpacklo_epi16(WordVectorLow, WordVectorLow), 16);
+    IntegerVector[1] = _mm_srai_epi32(_mm_unpackhi_epi16(WordVectorLow, WordVectorLow), 16);
+    IntegerVector[2] = _mm_srai_epi32(_mm_unpacklo_epi16(WordVectorHigh, WordVectorHigh), 16);
+    IntegerVector[3] = _mm_srai_epi32(_mm_unpackhi_epi16(WordVectorHigh, WordVectorHigh), 16);
+}
+
+#endif
+
+template<typename InputType>
+void
+MLASCALL
+MlasDequantizeLinear(
+    const InputType* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    InputType ZeroPoint
+    )
+/*++
+
+Routine Description:
+
+    This routine dequantizes the input buffer using the supplied quantization
+    parameters.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+    Scale - Supplies the quantization scale.
+
+    ZeroPoint - Supplies the quantization zero point value.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    auto ScaleVector = MlasBroadcastFloat32x4(Scale);
+    auto ZeroPointVector = MlasBroadcastInt32x4(ZeroPoint);
+
+    while (N >= 16) {
+
+        MLAS_INT32X4 IntegerVector[4];
+
+        MlasDequantizeLinearUnpackBytes<InputType>(IntegerVector, Input);
+
+        for (size_t i = 0; i < 4; i++) {
+
+#if defined(MLAS_NEON64_INTRINSICS)
+            IntegerVector[i] = vsubq_s32(IntegerVector[i], ZeroPointVector);
+            MLAS_FLOAT32X4 FloatVector = vmulq_f32(vcvtq_f32_s32(IntegerVector[i]), ScaleVector);
+#else
+            IntegerVector[i] = _mm_sub_epi32(IntegerVector[i], ZeroPointVector);
+            MLAS_FLOAT32X4 FloatVector = _mm_mul_ps(_mm_cvtepi32_ps(IntegerVector[i]), ScaleVector);
+#endif
+
+            MlasStoreFloat32x4(Output + i * 4, FloatVector);
+        }
+
+        Input += 16;
+        Output += 16;
+        N -= 16;
+    }
+
+    for (size_t n = 0; n < N; n++) {
+        Output[n] = float(int32_t(Input[n]) - int32_t(ZeroPoint)) * Scale;
+    }
+}
+
+#else
+
+//
+// DequantizeLinear implementation using the C++ runtime.
+//
+
+template<typename InputType>
+void
+MLASCALL
+MlasDequantizeLinear(
+    const InputType* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    InputType ZeroPoint
+    )
+/*++
+
+Routine Description:
+
+    This routine dequantizes the input buffer using the supplied quantization
+    parameters.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+    Scale - Supplies the quantization scale.
+
+    ZeroPoint - Supplies the quantization zero point value.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t n = 0; n < N; n++) {
+        Output[n] = float(int32_t(Input[n]) - int32_t(ZeroPoint)) * Scale;
+    }
+}
+
+#endif
+
+template
+void
+MLASCALL
+MlasDequantizeLinear<int8_t>(
+    const int8_t* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    int8_t ZeroPoint
+    );
+
+template
+void
+MLASCALL
+MlasDequantizeLinear<uint8_t>(
+    const uint8_t* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    uint8_t ZeroPoint
+    );
+
 #if defined(MLAS_SSE2_INTRINSICS)
 
 void
@@ -0,0 +1,399 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    sconvdepthwise.cpp
+
+Abstract:
+
+    This module implements the single precision direct depthwise convolution
+    kernels.
+
+    Depthwise convolutions lower to matrix/matrix multiplies with a single
+    output row per group, which have poor arithmetic intensity and pay for the
+    im2col expansion. The direct kernels below compute each output image from
+    the input image in one pass, with a tuned path for the common 3x3 kernel
+    and a generic path for other kernel shapes.
+
+--*/
+
+#include "mlasi.h"
+
+static
+void
+MlasConv2dSingleChannel_CHW_Kernel3x3_Pad01_Dilation1(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    float* Output,
+    const float* Zeros
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute convolution on one channel input with one filter channel.
+
+Arguments:
+
+    Parameters - conv parameters calculated based on conv parameters like padding, strides, dilations, etc.
+
+    Input - input channel data start. Input is NCHW, so this pointer point to single H x W image data.
+
+    Filter - Whole filters are of F x CpG x FH x FW, this filter point to single FH x FW filter data.
+
+    Output - whole output are of N x F x OH x OW. This pointer point to single OH x OW output image data.
+
+    Zeroes - Point to working buffer where all 0.0f are filled.
+
+--*/
+{
+    const size_t W = Parameters->InputShape[1];
+
+    if (W > 1) {
+
+        const float w00 = Filter[0];
+        const float w01 = Filter[1];
+        const float w02 = Filter[2];
+        const float w10 = Filter[3];
+        const float w11 = Filter[4];
+        const float w12 = Filter[5];
+        const float w20 = Filter[6];
+        const float w21 = Filter[7];
+        const float w22 = Filter[8];
+
+        const size_t H = Parameters->InputShape[0];
+        const size_t pad_top = Parameters->Padding[0];
+        const size_t pad_left = Parameters->Padding[1];
+        const size_t stride_h = Parameters->StrideShape[0];
+        const size_t stride_w = Parameters->StrideShape[1];
+
+        // We treat pad_left, pad_top are hard require.
+        // While pad_right and pad_bottom could be adjusted if they do not 100% match other parameters.
+        const size_t pad_right = (((Parameters->OutputShape[1] - 1) * stride_w + 3) > (pad_left + W)) ? 1 : 0;
+
+        const float* row0 = (pad_top > 0) ? Zeros : (Input - pad_left);
+        // Need to handle effective pad_bottom is 2 when H == 1
+        const float* row1 = (H + pad_top <= 1) ? Zeros : (Input + (1 - pad_top) * W) - pad_left;
+        const float* row2 = (H + pad_top <= 2) ? Zeros : (row1 + W);
+
+        for (size_t h = 0, out_row = Parameters->OutputShape[0]; out_row > 0; --out_row) {
+            auto out_col = Parameters->OutputShape[1];
+
+            if (pad_left == 1) {
+                float dotsum = w01 * row0[1] + w02 * row0[2] +
+                            w11 * row1[1] + w12 * row1[2] +
+                            w21 * row2[1] + w22 * row2[2];
+                *Output++ = dotsum;
+                out_col--;
+                row0 += stride_w;
+                row1 += stride_w;
+                row2 += stride_w;
+            }
+
+            //
+            // Compute four adjacent outputs per iteration when the window
+            // slides by one element, reusing the overlapping row loads.
+            //
+
+            if (stride_w == 1) {
+
+                while (out_col > pad_right + 3) {
+
+                    MLAS_FLOAT32X4 acc = MlasMultiplyFloat32x4(MlasBroadcastFloat32x4(w00), MlasLoadFloat32x4(&row0[0]));
+                    acc = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(w01), MlasLoadFloat32x4(&row0[1]), acc);
+                    acc = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(w02), MlasLoadFloat32x4(&row0[2]), acc);
+                    acc = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(w10), MlasLoadFloat32x4(&row1[0]), acc);
+                    acc = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(w11), MlasLoadFloat32x4(&row1[1]), acc);
+                    acc = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(w12), MlasLoadFloat32x4(&row1[2]), acc);
+                    acc = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(w20), MlasLoadFloat32x4(&row2[0]), acc);
+                    acc = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(w21), MlasLoadFloat32x4(&row2[1]), acc);
+                    acc = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(w22), MlasLoadFloat32x4(&row2[2]), acc);
+
+                    MlasStoreFloat32x4(Output, acc);
+
+                    Output += 4;
+                    out_col -= 4;
+                    row0 += 4;
+                    row1 += 4;
+                    row2 += 4;
+                }
+            }
+
+            for (; out_col > pad_right; out_col--) {
+                float dotsum =
+                    w00 * row0[0] + w01 * row0[1] + w02 * row0[2] +
+                    w10 * row1[0] + w11 * row1[1] + w12 * row1[2] +
+                    w20 * row2[0] + w21 * row2[1] + w22 * row2[2];
+                *Output++ = dotsum;
+                row0 += stride_w;
+                row1 += stride_w;
+                row2 += stride_w;
+            }
+
+            if (out_col == 1) { // pad_right == 1
+                float dotsum =
+                    w00 * row0[0] + w01 * row0[1] +
+                    w10 * row1[0] + w11 * row1[1] +
+                    w20 * row2[0] + w21 * row2[1];
+                *Output++ = dotsum;
+            }
+
+            h += stride_h;
+            row0 = (Input + (h - pad_top) * W) - pad_left;
+            row1 = row0 + W;
+            row2 = (h + 2 >= H + pad_top) ? Zeros : (row1 + W);
+        }
+
+    } else { // W == 1
+
+        const size_t H = Parameters->InputShape[0];
+        const size_t pad_left = Parameters->Padding[1];
+        const size_t pad_top = Parameters->Padding[0];
+        const size_t stride_h = Parameters->StrideShape[0];
+        size_t out_row = Parameters->OutputShape[0];
+
+        // Make sure pad_bottom is consistent with other parameters.
+        size_t pad_bottom = ((out_row - 1) * stride_h + 3) > (pad_top + H) ?
+                                ((out_row - 1) * stride_h + 3) - (pad_top + H) : 0;
+
+        const float w0 = Filter[pad_left ? 1 : 0];
+        const float w1 = Filter[pad_left ? 4 : 3];
+        const float w2 = Filter[pad_left ? 7 : 6];
+
+        if (pad_top == 1) {
+            *Output++ = w1 * Input[0] + w2 * ((H + pad_top <= 2) ? 0.0f : Input[1]);
+            out_row--;
+        }
+
+        for (const float* row = Input + pad_top * stride_h - pad_top; out_row > pad_bottom; --out_row) {
+            // All pixels are in the input col
+            *Output++ = w0 * row[0] + w1 * row[1] + w2 * row[2];
+            row += stride_h;
+        }
+
+        if (out_row > 0) {
+            // last 1 or 2 rows are from the padding zero row.
+            // out_row == 1 when arrive here
+            if (pad_bottom == 1) {
+                const float* row = Input + H - 2;
+                *Output++ = w0 * row[0] + w1 * row[1];
+            } else { // pad_bottom == 2 and H == 1 and padding_top == 0
+                *Output++ = w0 * Input[0];
+            }
+        }
+    }
+
+}
+
+static
+void
+MlasConv2dSingleChannel_CHW_KernelGeneric_Dilation1(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    float* Output
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute convolution on one channel
+    input with one filter channel of arbitrary kernel shape (dilations of
+    one). Output pixels whose receptive field lies fully inside the input
+    image take a fast path without bounds checks, vectorized over adjacent
+    outputs when the window slides by one element; the padded borders are
+    handled with a checked scalar loop.
+
+Arguments:
+
+    Parameters - conv parameters calculated based on conv parameters like padding, strides, dilations, etc.
+
+    Input - input channel data start. Input is NCHW, so this pointer point to single H x W image data.
+
+    Filter - Whole filters are of F x CpG x FH x FW, this filter point to single FH x FW filter data.
+
+    Output - whole output are of N x F x OH x OW. This pointer point to single OH x OW output image data.
+
+--*/
+{
+    const size_t H = Parameters->InputShape[0];
+    const size_t W = Parameters->InputShape[1];
+    const size_t KH = Parameters->KernelShape[0];
+    const size_t KW = Parameters->KernelShape[1];
+    const size_t pad_top = Parameters->Padding[0];
+    const size_t pad_left = Parameters->Padding[1];
+    const size_t stride_h = Parameters->StrideShape[0];
+    const size_t stride_w = Parameters->StrideShape[1];
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+
+    //
+    // Compute the range of output columns whose receptive field is fully
+    // inside the input row: pad_left <= ow * stride_w and
+    // ow * stride_w + KW <= pad_left + W.
+    //
+
+    const size_t interior_start_w = (pad_left + stride_w - 1) / stride_w;
+
+    size_t interior_count_w = 0;
+
+    if (pad_left + W >= KW) {
+        const size_t last_window_w = pad_left + W - KW;
+        if (last_window_w / stride_w + 1 > interior_start_w) {
+            interior_count_w = std::min(last_window_w / stride_w + 1, OutputWidth) - interior_start_w;
+        }
+    }
+
+    for (size_t oh = 0; oh < OutputHeight; oh++) {
+
+        const size_t ih_base = oh * stride_h;
+        const bool interior_h = (ih_base >= pad_top) && (ih_base + KH <= pad_top + H);
+
+        size_t ow = 0;
+
+        if (interior_h && interior_count_w != 0) {
+
+            //
+            // Handle the left border columns with the checked loop below,
+            // then the interior columns without bounds checks, and fall
+            // through for the right border.
+            //
+
+            const float* row_base = Input + (ih_base - pad_top) * W - pad_left;
+
+            for (; ow < interior_start_w; ow++) {
+
+                const size_t iw_base = ow * stride_w;
+                float acc = 0.0f;
+
+                for (size_t kh = 0; kh < KH; kh++) {
+                    for (size_t kw = 0; kw < KW; kw++) {
+                        const size_t iw = iw_base + kw;
+                        if (iw >= pad_left && iw < pad_left + W) {
+                            acc += Filter[kh * KW + kw] * Input[(ih_base - pad_top + kh) * W + iw - pad_left];
+                        }
+                    }
+                }
+
+                Output[ow] = acc;
+            }
+
+            size_t remaining = interior_count_w;
+
+            if (stride_w == 1) {
+
+                while (remaining >= 4) {
+
+                    const float* row = row_base + ow;
+                    MLAS_FLOAT32X4 acc = MlasZeroFloat32x4();
+
+                    for (size_t kh = 0; kh < KH; kh++) {
+                        for (size_t kw = 0; kw < KW; kw++) {
+                            acc = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(Filter[kh * KW + kw]),
+                                MlasLoadFloat32x4(&row[kw]), acc);
+                        }
+                        row += W;
+                    }
+
+                    MlasStoreFloat32x4(&Output[ow], acc);
+
+                    ow += 4;
+                    remaining -= 4;
+                }
+            }
+
+            while (remaining > 0) {
+
+                const float* row = row_base + ow * stride_w;
+                float acc = 0.0f;
+
+                for (size_t kh = 0; kh < KH; kh++) {
+                    for (size_t kw = 0; kw < KW; kw++) {
+                        acc += Filter[kh * KW + kw] * row[kw];
+                    }
+                    row += W;
+                }
+
+                Output[ow] = acc;
+
+                ow += 1;
+                remaining -= 1;
+            }
+        }
+
+        //
+        // Handle the remaining (border) columns of the row with bounds checks
+        // on both dimensions.
+        //
+
+        for (; ow < OutputWidth; ow++) {
+
+            const size_t iw_base = ow * stride_w;
+            float acc = 0.0f;
+
+            for (size_t kh = 0; kh < KH; kh++) {
+                const size_t ih = ih_base + kh;
+                if (ih < pad_top || ih >= pad_top + H) {
+                    continue;
+                }
+                for (size_t kw = 0; kw < KW; kw++) {
+                    const size_t iw = iw_base + kw;
+                    if (iw >= pad_left && iw < pad_left + W) {
+                        acc += Filter[kh * KW + kw] * Input[(ih - pad_top) * W + iw - pad_left];
+                    }
+                }
+            }
+
+            Output[ow] = acc;
+        }
+
+        Output += OutputWidth;
+    }
+}
+
+void
+MLASCALL
+MlasConvDepthwiseFloat_CHW(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    float* Output,
+    const float* Zeros
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute depthwise convolution for one filter channel on one input channel.
+
+Arguments:
+
+    Parameters - conv parameters calculated based on conv parameters like padding, strides, dilations, etc.
+
+    Input - input channel data start. Input is NCHW, so this pointer point to single H x W image data.
+
+    Filter - Whole filters are of F x CpG x FH x FW, this filter point to single FH x FW filter data.
+
+    Output - whole output are of N x F x OH x OW. This pointer point to single OH x OW output image data.
+
+    Zeroes - Point to working buffer where all 0.0f are filled.
+
+Note:
+    No checking here as it is inner loop. Logic in generating Parameters controls the check.
+
+--*/
+{
+    if (Parameters->KernelShape[0] == 3 && Parameters->KernelShape[1] == 3 &&
+        Parameters->Padding[0] <= 1 && Parameters->Padding[1] <= 1 &&
+        Parameters->Padding[2] <= 1 && Parameters->Padding[3] <= 1) {
+        MlasConv2dSingleChannel_CHW_Kernel3x3_Pad01_Dilation1(Parameters, Input, Filter, Output, Zeros);
+    } else {
+        MLAS_UNREFERENCED_PARAMETER(Zeros);
+        MlasConv2dSingleChannel_CHW_KernelGeneric_Dilation1(Parameters, Input, Filter, Output);
+    }
+}
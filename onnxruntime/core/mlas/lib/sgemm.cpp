@@ -91,6 +91,221 @@ Return Value:
     }
 }
 
+//
+// Define the flag to build the portable M=1 kernel on targets that do not
+// supply an assembly implementation behind MlasGemvFloatKernel.
+//
+
+#if !((defined(MLAS_TARGET_ARM64) && !defined(_WIN32)) || defined(MLAS_TARGET_WASM))
+#define MLAS_SGEMM_PORTABLE_KERNEL_M1
+#endif
+
+#if defined(MLAS_SGEMM_PORTABLE_KERNEL_M1)
+
+void
+MlasSgemmKernelM1(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountN,
+    size_t ldb,
+    bool ZeroMode
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the matrix/vector multiply operation for the
+    special case of M=1 using the portable vector intrinsics. Matrix B is
+    consumed in row major order, so no local packed buffer is required.
+
+    The elements in matrix B are not transposed.
+
+Arguments:
+
+    A - Supplies the address of matrix A.
+
+    B - Supplies the address of matrix B.
+
+    C - Supplies the address of matrix C.
+
+    CountK - Supplies the number of columns from matrix A and the number
+        of rows from matrix B to iterate over.
+
+    CountN - Supplies the number of columns from matrix B and matrix C to
+        iterate over.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    ZeroMode - Supplies true if the output matrix must be zero initialized,
+        else false if the output matrix is accumulated into.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    //
+    // Seed the output vector from the first row of matrix B instead of
+    // making a separate pass to zero the output buffer.
+    //
+
+    if (ZeroMode && CountK > 0) {
+
+        const float* b = B;
+        float* c = C;
+
+        const MLAS_FLOAT32X4 A0 = MlasBroadcastFloat32x4(A);
+
+        size_t n = CountN;
+
+        while (n >= 4) {
+            MlasStoreFloat32x4(c, MlasMultiplyFloat32x4(A0, MlasLoadFloat32x4(b)));
+            b += 4;
+            c += 4;
+            n -= 4;
+        }
+
+        while (n > 0) {
+            c[0] = A[0] * b[0];
+            b += 1;
+            c += 1;
+            n -= 1;
+        }
+
+        A += 1;
+        B += ldb;
+        CountK -= 1;
+    }
+
+    //
+    // Accumulate four rows of matrix B per pass using multiple independent
+    // accumulators over the width of the output to hide the latency of the
+    // multiply/add sequence.
+    //
+
+    while (CountK >= 4) {
+
+        const float* b0 = B;
+        const float* b1 = b0 + ldb;
+        const float* b2 = b1 + ldb;
+        const float* b3 = b2 + ldb;
+        float* c = C;
+
+        const MLAS_FLOAT32X4 A0 = MlasBroadcastFloat32x4(A);
+        const MLAS_FLOAT32X4 A1 = MlasBroadcastFloat32x4(A + 1);
+        const MLAS_FLOAT32X4 A2 = MlasBroadcastFloat32x4(A + 2);
+        const MLAS_FLOAT32X4 A3 = MlasBroadcastFloat32x4(A + 3);
+
+        size_t n = CountN;
+
+        while (n >= 16) {
+
+            MLAS_FLOAT32X4 Accumulator0 = MlasLoadFloat32x4(c);
+            MLAS_FLOAT32X4 Accumulator1 = MlasLoadFloat32x4(c + 4);
+            MLAS_FLOAT32X4 Accumulator2 = MlasLoadFloat32x4(c + 8);
+            MLAS_FLOAT32X4 Accumulator3 = MlasLoadFloat32x4(c + 12);
+
+            Accumulator0 = MlasMultiplyAddFloat32x4(A0, MlasLoadFloat32x4(b0), Accumulator0);
+            Accumulator1 = MlasMultiplyAddFloat32x4(A0, MlasLoadFloat32x4(b0 + 4), Accumulator1);
+            Accumulator2 = MlasMultiplyAddFloat32x4(A0, MlasLoadFloat32x4(b0 + 8), Accumulator2);
+            Accumulator3 = MlasMultiplyAddFloat32x4(A0, MlasLoadFloat32x4(b0 + 12), Accumulator3);
+
+            Accumulator0 = MlasMultiplyAddFloat32x4(A1, MlasLoadFloat32x4(b1), Accumulator0);
+            Accumulator1 = MlasMultiplyAddFloat32x4(A1, MlasLoadFloat32x4(b1 + 4), Accumulator1);
+            Accumulator2 = MlasMultiplyAddFloat32x4(A1, MlasLoadFloat32x4(b1 + 8), Accumulator2);
+            Accumulator3 = MlasMultiplyAddFloat32x4(A1, MlasLoadFloat32x4(b1 + 12), Accumulator3);
+
+            Accumulator0 = MlasMultiplyAddFloat32x4(A2, MlasLoadFloat32x4(b2), Accumulator0);
+            Accumulator1 = MlasMultiplyAddFloat32x4(A2, MlasLoadFloat32x4(b2 + 4), Accumulator1);
+            Accumulator2 = MlasMultiplyAddFloat32x4(A2, MlasLoadFloat32x4(b2 + 8), Accumulator2);
+            Accumulator3 = MlasMultiplyAddFloat32x4(A2, MlasLoadFloat32x4(b2 + 12), Accumulator3);
+
+            Accumulator0 = MlasMultiplyAddFloat32x4(A3, MlasLoadFloat32x4(b3), Accumulator0);
+            Accumulator1 = MlasMultiplyAddFloat32x4(A3, MlasLoadFloat32x4(b3 + 4), Accumulator1);
+            Accumulator2 = MlasMultiplyAddFloat32x4(A3, MlasLoadFloat32x4(b3 + 8), Accumulator2);
+            Accumulator3 = MlasMultiplyAddFloat32x4(A3, MlasLoadFloat32x4(b3 + 12), Accumulator3);
+
+            MlasStoreFloat32x4(c, Accumulator0);
+            MlasStoreFloat32x4(c + 4, Accumulator1);
+            MlasStoreFloat32x4(c + 8, Accumulator2);
+            MlasStoreFloat32x4(c + 12, Accumulator3);
+
+            b0 += 16;
+            b1 += 16;
+            b2 += 16;
+            b3 += 16;
+            c += 16;
+            n -= 16;
+        }
+
+        while (n >= 4) {
+
+            MLAS_FLOAT32X4 Accumulator = MlasLoadFloat32x4(c);
+
+            Accumulator = MlasMultiplyAddFloat32x4(A0, MlasLoadFloat32x4(b0), Accumulator);
+            Accumulator = MlasMultiplyAddFloat32x4(A1, MlasLoadFloat32x4(b1), Accumulator);
+            Accumulator = MlasMultiplyAddFloat32x4(A2, MlasLoadFloat32x4(b2), Accumulator);
+            Accumulator = MlasMultiplyAddFloat32x4(A3, MlasLoadFloat32x4(b3), Accumulator);
+
+            MlasStoreFloat32x4(c, Accumulator);
+
+            b0 += 4;
+            b1 += 4;
+            b2 += 4;
+            b3 += 4;
+            c += 4;
+            n -= 4;
+        }
+
+        while (n > 0) {
+            c[0] += A[0] * b0[0] + A[1] * b1[0] + A[2] * b2[0] + A[3] * b3[0];
+            b0 += 1;
+            b1 += 1;
+            b2 += 1;
+            b3 += 1;
+            c += 1;
+            n -= 1;
+        }
+
+        A += 4;
+        B += 4 * ldb;
+        CountK -= 4;
+    }
+
+    while (CountK > 0) {
+
+        const float* b = B;
+        float* c = C;
+
+        const MLAS_FLOAT32X4 A0 = MlasBroadcastFloat32x4(A);
+
+        size_t n = CountN;
+
+        while (n >= 4) {
+            MlasStoreFloat32x4(c, MlasMultiplyAddFloat32x4(A0, MlasLoadFloat32x4(b), MlasLoadFloat32x4(c)));
+            b += 4;
+            c += 4;
+            n -= 4;
+        }
+
+        while (n > 0) {
+            c[0] += A[0] * b[0];
+            b += 1;
+            c += 1;
+            n -= 1;
+        }
+
+        A += 1;
+        B += ldb;
+        CountK -= 1;
+    }
+}
+
+#endif
+
 void
 MlasSgemmTransposeA(
     float* D,
@@ -1180,6 +1395,20 @@ Return Value:
             return;
         }
 
+#endif
+
+#if defined(MLAS_SGEMM_PORTABLE_KERNEL_M1)
+
+        //
+        // Fall back to the portable kernel on targets where no specialized
+        // routine is available for this processor.
+        //
+
+        if (TransB == CblasNoTrans) {
+            MlasSgemmKernelM1(A, B, C, K, N, ldb, (beta == 0.0f));
+            return;
+        }
+
 #endif
 
     }
@@ -1551,6 +1780,16 @@ Return Value:
         MlasSgemmOperation(TransA, TransB, RangeCountM, RangeCountN, K,
             DataParams->alpha, A, lda, B, ldb, DataParams->beta, C, ldc);
     }
+
+    //
+    // Apply the optional epilogue while the completed range is still cache
+    // resident.
+    //
+
+    if (DataParams->OutputProcessor != nullptr) {
+        DataParams->OutputProcessor->Process(DataParams->C, RangeStartM,
+            RangeStartN, RangeCountM, RangeCountN, ldc);
+    }
 }
 
 void
@@ -1576,8 +1815,8 @@ MlasGemmBatch(
 
     ptrdiff_t TargetThreadCount;
 
-    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MlasPlatform.MaximumThreadCount)) {
-        TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    if (Complexity < double(MlasPlatform.GemmThreadComplexity) * double(MlasPlatform.MaximumThreadCount)) {
+        TargetThreadCount = ptrdiff_t(Complexity / double(MlasPlatform.GemmThreadComplexity)) + 1;
     } else {
         TargetThreadCount = MlasPlatform.MaximumThreadCount;
     }
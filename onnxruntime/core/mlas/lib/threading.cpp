@@ -16,6 +16,10 @@ Abstract:
 
 #include "mlasi.h"
 
+#include <atomic>
+#include <chrono>
+#include <vector>
+
 void
 MlasExecuteThreaded(
     MLAS_THREADED_ROUTINE* ThreadedRoutine,
@@ -100,3 +104,119 @@ MlasTrySimpleParallel(
     MLAS_THREADPOOL::TrySimpleParallelFor(ThreadPool, Iterations, Work);
 #endif
 }
+
+void
+MLASCALL
+MlasThreadingCalibrate(
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine calibrates the threading thresholds for this machine. The
+    static per-thread work quantum the library ships with assumes a mid-range
+    core count and dispatch cost: on machines with many cores or slow thread
+    wakeup it shards small operations into mostly scheduling overhead, and on
+    small fast cores it leaves threading on the table. Measuring the actual
+    dispatch overhead and single threaded GEMM rate replaces the assumption
+    with the observed crossover.
+
+Arguments:
+
+    ThreadPool - Supplies the thread pool used to run MLAS operations, and
+        whose dispatch overhead is measured.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    //
+    // Run the calibration once per process; later calls keep the first result.
+    //
+
+    static std::atomic<bool> AlreadyCalibrated{false};
+
+    if (AlreadyCalibrated.exchange(true)) {
+        return;
+    }
+
+    const ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (MaximumThreadCount <= 1) {
+        return;
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    //
+    // Measure the cost of fanning work out to every thread and gathering the
+    // results back. The minimum over several repetitions discards warmup and
+    // scheduling noise.
+    //
+
+    double DispatchSeconds = std::numeric_limits<double>::max();
+
+    for (int iteration = 0; iteration < 8; iteration++) {
+
+        std::atomic<ptrdiff_t> VisitedCount{0};
+
+        auto StartTime = Clock::now();
+
+        MlasTrySimpleParallel(ThreadPool, MaximumThreadCount, [&](ptrdiff_t) {
+            VisitedCount.fetch_add(1, std::memory_order_relaxed);
+        });
+
+        double Elapsed = std::chrono::duration<double>(Clock::now() - StartTime).count();
+        DispatchSeconds = (std::min)(DispatchSeconds, Elapsed);
+    }
+
+    //
+    // Measure the single threaded GEMM rate in M*N*K elements per second,
+    // which is the complexity metric the threaded paths partition with.
+    //
+
+    constexpr size_t Dimension = 128;
+
+    std::vector<float> A(Dimension * Dimension, 1.0f);
+    std::vector<float> B(Dimension * Dimension, 1.0f);
+    std::vector<float> C(Dimension * Dimension);
+
+    double GemmSeconds = std::numeric_limits<double>::max();
+
+    for (int iteration = 0; iteration < 4; iteration++) {
+
+        auto StartTime = Clock::now();
+
+        MlasGemm(CblasNoTrans, CblasNoTrans, Dimension, Dimension, Dimension, 1.0f,
+                 A.data(), Dimension, B.data(), Dimension, 0.0f, C.data(), Dimension, nullptr);
+
+        double Elapsed = std::chrono::duration<double>(Clock::now() - StartTime).count();
+        GemmSeconds = (std::min)(GemmSeconds, Elapsed);
+    }
+
+    if (DispatchSeconds <= 0.0 || GemmSeconds <= 0.0) {
+        return;
+    }
+
+    const double ElementsPerSecond =
+        double(Dimension) * double(Dimension) * double(Dimension) / GemmSeconds;
+
+    //
+    // Target a per-thread work quantum that costs several times the dispatch
+    // overhead, so sharding never turns a small operation into mostly
+    // scheduling. Clamp the result so a noisy measurement can neither disable
+    // threading for large operations nor shard tiny ones.
+    //
+
+    constexpr double DispatchAmortizationFactor = 8.0;
+
+    double Quantum = DispatchSeconds * ElementsPerSecond * DispatchAmortizationFactor;
+
+    Quantum = (std::max)(Quantum, double(MLAS_SGEMM_THREAD_COMPLEXITY / 4));
+    Quantum = (std::min)(Quantum, double(MLAS_SGEMM_THREAD_COMPLEXITY) * 32.0);
+
+    MlasPlatform.GemmThreadComplexity = int32_t(Quantum);
+}
@@ -16,6 +16,13 @@ Abstract:
 
 #include "mlasi.h"
 
+//
+// Define the target number of per-thread elements to move before using
+// another thread to perform additional work.
+//
+
+#define MLAS_TRANSPOSE_THREAD_COMPLEXITY            (size_t(256) * size_t(1024))
+
 #if defined(MLAS_SSE2_INTRINSICS)
 
 MLAS_FORCEINLINE
@@ -48,6 +55,32 @@ MlasTranspose4x4Block(
     _mm_storeu_si128((__m128i*)&Output[OutputStride * 3], c3);
 }
 
+MLAS_FORCEINLINE
+void
+MlasTranspose4x4Block(
+    const uint16_t* Input,
+    size_t InputStride,
+    uint16_t* Output,
+    size_t OutputStride
+    )
+{
+    __m128i a0 = _mm_loadl_epi64((const __m128i*)&Input[InputStride * 0]);
+    __m128i a1 = _mm_loadl_epi64((const __m128i*)&Input[InputStride * 1]);
+    __m128i a2 = _mm_loadl_epi64((const __m128i*)&Input[InputStride * 2]);
+    __m128i a3 = _mm_loadl_epi64((const __m128i*)&Input[InputStride * 3]);
+
+    __m128i b0 = _mm_unpacklo_epi16(a0, a2);
+    __m128i b1 = _mm_unpacklo_epi16(a1, a3);
+
+    __m128 c0 = _mm_castsi128_ps(_mm_unpacklo_epi16(b0, b1));
+    __m128 c1 = _mm_castsi128_ps(_mm_unpackhi_epi16(b0, b1));
+
+    _mm_storel_pi((__m64*)&Output[OutputStride * 0], c0);
+    _mm_storeh_pi((__m64*)&Output[OutputStride * 1], c0);
+    _mm_storel_pi((__m64*)&Output[OutputStride * 2], c1);
+    _mm_storeh_pi((__m64*)&Output[OutputStride * 3], c1);
+}
+
 MLAS_FORCEINLINE
 void
 MlasTranspose8x8Block(
@@ -123,6 +156,32 @@ MlasTranspose4x4Block(
     vst1q_u32(&Output[OutputStride * 3], c1.val[1]);
 }
 
+MLAS_FORCEINLINE
+void
+MlasTranspose4x4Block(
+    const uint16_t* Input,
+    size_t InputStride,
+    uint16_t* Output,
+    size_t OutputStride
+    )
+{
+    uint16x4_t a0 = vld1_u16(&Input[InputStride * 0]);
+    uint16x4_t a1 = vld1_u16(&Input[InputStride * 1]);
+    uint16x4_t a2 = vld1_u16(&Input[InputStride * 2]);
+    uint16x4_t a3 = vld1_u16(&Input[InputStride * 3]);
+
+    uint16x4x2_t b0 = vzip_u16(a0, a2);
+    uint16x4x2_t b1 = vzip_u16(a1, a3);
+
+    uint16x4x2_t c0 = vzip_u16(b0.val[0], b1.val[0]);
+    uint16x4x2_t c1 = vzip_u16(b0.val[1], b1.val[1]);
+
+    vst1_u16(&Output[OutputStride * 0], c0.val[0]);
+    vst1_u16(&Output[OutputStride * 1], c0.val[1]);
+    vst1_u16(&Output[OutputStride * 2], c1.val[0]);
+    vst1_u16(&Output[OutputStride * 3], c1.val[1]);
+}
+
 MLAS_FORCEINLINE
 void
 MlasTranspose8x8Block(
@@ -206,10 +265,11 @@ MlasTranspose8xNVector(
 }
 
 void
-MLASCALL
-MlasTranspose(
+MlasTransposeStrided(
     const uint32_t* Input,
+    size_t InputStride,
     uint32_t* Output,
+    size_t OutputStride,
     size_t M,
     size_t N
     )
@@ -217,20 +277,26 @@ MlasTranspose(
 
 Routine Description:
 
-    This routine transposes the input matrix (M rows by N columns) to the
-    output matrix (N rows by M columns).
+    This routine transposes a block of the input matrix (M rows by N columns)
+    to a block of the output matrix (N rows by M columns) using the supplied
+    leading dimensions, so callers can tile a larger transpose over ranges of
+    columns.
 
 Arguments:
 
     Input - Supplies the input buffer.
 
+    InputStride - Supplies the first dimension of the input matrix.
+
     Output - Supplies the output buffer.
 
-    M - Supplies the number of rows for the input matrix and the number of
-        columns for the output matrix.
+    OutputStride - Supplies the first dimension of the output matrix.
 
-    N - Supplies the number of columns for the input matrix and the number of
-        rows for the output matrix.
+    M - Supplies the number of rows for the input block and the number of
+        columns for the output block.
+
+    N - Supplies the number of columns for the input block and the number of
+        rows for the output block.
 
 Return Value:
 
@@ -255,9 +321,9 @@ Return Value:
 
         while (m >= 4) {
 
-            MlasTranspose4x4Block(s, N, d, M);
+            MlasTranspose4x4Block(s, InputStride, d, OutputStride);
 
-            s += N * 4;
+            s += InputStride * 4;
             d += 4;
             m -= 4;
         }
@@ -266,15 +332,15 @@ Return Value:
 
         while (m > 0) {
 
-            MlasTranspose4xNVector(s, 1, d, M);
+            MlasTranspose4xNVector(s, 1, d, OutputStride);
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 4;
-        Output += M * 4;
+        Output += OutputStride * 4;
         n -= 4;
     }
 
@@ -291,9 +357,9 @@ Return Value:
 
         while (m >= 4) {
 
-            MlasTranspose4xNVector(s, N, d, 1);
+            MlasTranspose4xNVector(s, InputStride, d, 1);
 
-            s += N * 4;
+            s += InputStride * 4;
             d += 4;
             m -= 4;
         }
@@ -302,65 +368,183 @@ Return Value:
 
             d[0] = s[0];
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 1;
-        Output += M;
+        Output += OutputStride;
         n -= 1;
     }
 }
 
 void
-MLASCALL
-MlasTranspose(
-    const float* Input,
-    float* Output,
+MlasTransposeStrided(
+    const uint16_t* Input,
+    size_t InputStride,
+    uint16_t* Output,
+    size_t OutputStride,
     size_t M,
     size_t N
     )
 {
-    MlasTranspose(
-        reinterpret_cast<const uint32_t*>(Input),
-        reinterpret_cast<uint32_t*>(Output),
-        M,
-        N);
+    size_t n = N;
+
+    //
+    // Transpose elements from the input matrix to the output matrix 4 columns
+    // at a time.
+    //
+
+    while (n >= 4) {
+
+        const uint16_t* s = Input;
+        uint16_t* d = Output;
+        size_t m = M;
+
+#if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON_INTRINSICS)
+
+        while (m >= 4) {
+
+            MlasTranspose4x4Block(s, InputStride, d, OutputStride);
+
+            s += InputStride * 4;
+            d += 4;
+            m -= 4;
+        }
+
+#endif
+
+        while (m > 0) {
+
+            MlasTranspose4xNVector(s, 1, d, OutputStride);
+
+            s += InputStride;
+            d += 1;
+            m -= 1;
+        }
+
+        Input += 4;
+        Output += OutputStride * 4;
+        n -= 4;
+    }
+
+    //
+    // Transpose elements from the input matrix to the output matrix for the
+    // remaining columns.
+    //
+
+    while (n > 0) {
+
+        const uint16_t* s = Input;
+        uint16_t* d = Output;
+        size_t m = M;
+
+        while (m >= 4) {
+
+            MlasTranspose4xNVector(s, InputStride, d, 1);
+
+            s += InputStride * 4;
+            d += 4;
+            m -= 4;
+        }
+
+        while (m > 0) {
+
+            d[0] = s[0];
+
+            s += InputStride;
+            d += 1;
+            m -= 1;
+        }
+
+        Input += 1;
+        Output += OutputStride;
+        n -= 1;
+    }
 }
 
 void
-MLASCALL
-MlasTranspose(
-    const uint8_t* Input,
-    uint8_t* Output,
+MlasTransposeStrided(
+    const uint64_t* Input,
+    size_t InputStride,
+    uint64_t* Output,
+    size_t OutputStride,
     size_t M,
     size_t N
     )
-/*++
+{
+    size_t n = N;
 
-Routine Description:
+    //
+    // Transpose elements from the input matrix to the output matrix 4 columns
+    // at a time.
+    //
 
-    This routine transposes the input matrix (M rows by N columns) to the
-    output matrix (N rows by M columns).
+    while (n >= 4) {
 
-Arguments:
+        const uint64_t* s = Input;
+        uint64_t* d = Output;
+        size_t m = M;
 
-    Input - Supplies the input buffer.
+        while (m > 0) {
 
-    Output - Supplies the output buffer.
+            MlasTranspose4xNVector(s, 1, d, OutputStride);
 
-    M - Supplies the number of rows for the input matrix and the number of
-        columns for the output matrix.
+            s += InputStride;
+            d += 1;
+            m -= 1;
+        }
 
-    N - Supplies the number of columns for the input matrix and the number of
-        rows for the output matrix.
+        Input += 4;
+        Output += OutputStride * 4;
+        n -= 4;
+    }
 
-Return Value:
+    //
+    // Transpose elements from the input matrix to the output matrix for the
+    // remaining columns.
+    //
 
-    None.
+    while (n > 0) {
 
---*/
+        const uint64_t* s = Input;
+        uint64_t* d = Output;
+        size_t m = M;
+
+        while (m >= 4) {
+
+            MlasTranspose4xNVector(s, InputStride, d, 1);
+
+            s += InputStride * 4;
+            d += 4;
+            m -= 4;
+        }
+
+        while (m > 0) {
+
+            d[0] = s[0];
+
+            s += InputStride;
+            d += 1;
+            m -= 1;
+        }
+
+        Input += 1;
+        Output += OutputStride;
+        n -= 1;
+    }
+}
+
+void
+MlasTransposeStrided(
+    const uint8_t* Input,
+    size_t InputStride,
+    uint8_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    )
 {
     size_t n = N;
 
@@ -379,9 +563,9 @@ Return Value:
 
         while (m >= 8) {
 
-            MlasTranspose8x8Block(s, N, d, M);
+            MlasTranspose8x8Block(s, InputStride, d, OutputStride);
 
-            s += N * 8;
+            s += InputStride * 8;
             d += 8;
             m -= 8;
         }
@@ -390,15 +574,15 @@ Return Value:
 
         while (m > 0) {
 
-            MlasTranspose8xNVector(s, 1, d, M);
+            MlasTranspose8xNVector(s, 1, d, OutputStride);
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 8;
-        Output += M * 8;
+        Output += OutputStride * 8;
         n -= 8;
     }
 
@@ -415,9 +599,9 @@ Return Value:
 
         while (m >= 8) {
 
-            MlasTranspose8xNVector(s, N, d, 1);
+            MlasTranspose8xNVector(s, InputStride, d, 1);
 
-            s += N * 8;
+            s += InputStride * 8;
             d += 8;
             m -= 8;
         }
@@ -426,13 +610,256 @@ Return Value:
 
             d[0] = s[0];
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 1;
-        Output += M;
+        Output += OutputStride;
         n -= 1;
     }
 }
+
+template<typename ElementType>
+void
+MlasTransposeThreaded(
+    const ElementType* Input,
+    ElementType* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes the input matrix (M rows by N columns) to the
+    output matrix (N rows by M columns), tiling the operation over column
+    bands of the input so each thread produces a contiguous range of output
+    rows.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
+
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    //
+    // Compute the number of target threads given the size of the matrix.
+    // Small requests should run using the single threaded path.
+    //
+
+    const size_t ElementCount = M * N;
+
+    ptrdiff_t TargetThreadCount;
+
+    if (ElementCount < MLAS_TRANSPOSE_THREAD_COMPLEXITY * size_t(MlasPlatform.MaximumThreadCount)) {
+        TargetThreadCount = ptrdiff_t(ElementCount / MLAS_TRANSPOSE_THREAD_COMPLEXITY) + 1;
+    } else {
+        TargetThreadCount = MlasPlatform.MaximumThreadCount;
+    }
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    if (size_t(TargetThreadCount) > N) {
+        TargetThreadCount = ptrdiff_t(N);
+    }
+
+    if (TargetThreadCount <= 1) {
+        MlasTransposeStrided(Input, N, Output, M, M, N);
+        return;
+    }
+
+    //
+    // Segment the operation across multiple threads as bands of columns of
+    // the input matrix.
+    //
+
+    MlasTrySimpleParallel(ThreadPool, TargetThreadCount, [=](ptrdiff_t tid) {
+
+        size_t RangeStartN;
+        size_t RangeCountN;
+
+        MlasPartitionWork(tid, TargetThreadCount, N, &RangeStartN, &RangeCountN);
+
+        MlasTransposeStrided(Input + RangeStartN, N, Output + RangeStartN * M, M, M, RangeCountN);
+    });
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    uint32_t* Output,
+    size_t M,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes the input matrix (M rows by N columns) to the
+    output matrix (N rows by M columns).
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
+
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasTransposeStrided(Input, N, Output, M, M, N);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    uint32_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTransposeThreaded(Input, Output, M, N, ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTransposeStrided(Input, N, Output, M, M, N);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTransposeThreaded(Input, Output, M, N, ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint64_t* Input,
+    uint64_t* Output,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTransposeStrided(Input, N, Output, M, M, N);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint64_t* Input,
+    uint64_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTransposeThreaded(Input, Output, M, N, ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const float* Input,
+    float* Output,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTranspose(
+        reinterpret_cast<const uint32_t*>(Input),
+        reinterpret_cast<uint32_t*>(Output),
+        M,
+        N);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const float* Input,
+    float* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTranspose(
+        reinterpret_cast<const uint32_t*>(Input),
+        reinterpret_cast<uint32_t*>(Output),
+        M,
+        N,
+        ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTransposeStrided(Input, N, Output, M, M, N);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTransposeThreaded(Input, Output, M, N, ThreadPool);
+}
@@ -268,6 +268,7 @@ static bool FuseSubGraphQKImpl(Node& layer_norm,
                                int64_t hidden_size,
                                int64_t num_heads,
                                int64_t head_size,
+                               NodeArg* extra_add_input,
                                const logging::Logger& logger) {
   std::vector<std::reference_wrapper<const Node>> pivot_nodes;
   if (edges.size() == 2) {
@@ -363,10 +364,13 @@ static bool FuseSubGraphQKImpl(Node& layer_norm,
   }
 
   // Now everything is ready, we will start fusing subgraph.
-  NodeArg* mask_int32 = ConvertMaskToInt32(graph, mask_input, mask_int32_map, layer_norm.GetExecutionProviderType(), logger);
-  if (nullptr == mask_int32) {
-    DEBUG_LOG("Failed to convert mask to int32");
-    return false;
+  NodeArg* mask_int32 = nullptr;
+  if (mask_input != nullptr) {
+    mask_int32 = ConvertMaskToInt32(graph, mask_input, mask_int32_map, layer_norm.GetExecutionProviderType(), logger);
+    if (nullptr == mask_int32) {
+      DEBUG_LOG("Failed to convert mask to int32");
+      return false;
+    }
   }
 
   // Merge Q, K and V weights
@@ -374,7 +378,14 @@ static bool FuseSubGraphQKImpl(Node& layer_norm,
   NodeArg& qkv_bias = MergeQkvWeights(graph, hidden_size, q_bias_tensor, k_bias_tensor, v_bias_tensor, false);
   // Create Attention Node.
   const Node& reshape = parent_path_nodes[0];
-  const std::vector<NodeArg*> input_defs{layer_norm.MutableOutputDefs()[0], &qkv_weights, &qkv_bias, mask_int32};
+  std::string empty_name;
+  std::vector<NodeArg*> input_defs{layer_norm.MutableOutputDefs()[0], &qkv_weights, &qkv_bias};
+  input_defs.push_back(mask_int32 != nullptr ? mask_int32 : &graph.GetOrCreateNodeArg(empty_name, nullptr));
+  if (extra_add_input != nullptr) {
+    // missing optional past input, then the additive bias for QxK' scores
+    input_defs.push_back(&graph.GetOrCreateNodeArg(empty_name, nullptr));
+    input_defs.push_back(extra_add_input);
+  }
   const std::vector<NodeArg*> output_defs{graph.GetNode(reshape.Index())->MutableOutputDefs()[0]};
   Node& attention_node = graph.AddNode(
       graph.GenerateNodeName("Attention"),
@@ -436,7 +447,7 @@ static bool FuseSubGraphQK(Node& layer_norm,
 
   std::vector<NodeIndex> nodes_to_remove;
   if (!FuseSubGraphQKImpl(layer_norm, graph, parent_path_nodes, mask_input, mask_int32_map, edges, nodes_to_remove, hidden_size,
-                          num_heads, head_size, logger)) {
+                          num_heads, head_size, nullptr, logger)) {
     return false;
   }
 
@@ -453,6 +464,55 @@ static bool FuseSubGraphQK(Node& layer_norm,
   return true;
 }
 
+/** Fuse attention with an additive bias on the QxK' scores, e.g. an ALiBi bias or a precomputed
+additive attention mask. The bias producer is left untouched and feeds the fused node through the
+optional extra_add input of the Attention operator:
+
+    [qk_Div] --> Add --> Softmax --> [qkv_MatMul]        [qk_Div]   [Bias](BxNxSxS)
+                 /                                 =>        ...fused into Attention(..., extra_add=Bias)
+    [Bias](BxNxSxS)
+*/
+static bool FuseSubGraphQKAdditiveMask(Node& layer_norm,
+                                       Graph& graph,
+                                       AttentionFusionHelper::AttentionAdditiveMaskNodes& mask_nodes,
+                                       std::vector<std::reference_wrapper<const Node>>& parent_path_nodes,
+                                       int64_t hidden_size,
+                                       int64_t num_heads,
+                                       int64_t head_size,
+                                       std::map<std::string, NodeArg*>& mask_int32_map,
+                                       const logging::Logger& logger) {
+  // path to q starts at the Add input that carries the scaled QxK' scores
+  const int score_input_index = mask_nodes.bias_input_index == 0 ? 1 : 0;
+  std::vector<graph_utils::EdgeEndToMatch> q_varience_path{
+      {0, score_input_index, "Div", {7, 13}, kOnnxDomain},
+      {0, 0, "MatMul", {1, 9}, kOnnxDomain}};
+  std::vector<const Node::EdgeEnd*> edges;
+  if (!graph_utils::FindPath(*(mask_nodes.add), true, q_varience_path, edges, logger)) {
+    DEBUG_LOG("Failed to find path for q");
+    return false;
+  }
+
+  NodeArg* extra_add_input = graph.GetNode(mask_nodes.add->Index())->MutableInputDefs()[mask_nodes.bias_input_index];
+
+  std::vector<NodeIndex> nodes_to_remove;
+  if (!FuseSubGraphQKImpl(layer_norm, graph, parent_path_nodes, nullptr, mask_int32_map, edges, nodes_to_remove, hidden_size,
+                          num_heads, head_size, extra_add_input, logger)) {
+    return false;
+  }
+
+  AttentionFusionHelper::SetMaskNodesToRemove(graph, mask_nodes, nodes_to_remove);
+
+  for (const auto& node_index : nodes_to_remove) {
+    Node* node = graph.GetNode(node_index);
+    graph_utils::RemoveNodeOutputEdges(graph, *node);
+    graph.RemoveNode(node->Index());
+  }
+
+  DEBUG_LOG("Fused an attention node with additive mask.");
+
+  return true;
+}
+
 /** DistilBert's attention is a bit different here
 @remark add_after_layer_norm is the Add node in the bottom of sub-graph.
  Abbreviatios: B is batch_size, S is sequence_length, W is hidden_size
@@ -527,7 +587,7 @@ static bool FuseSubGraphQKDistilBert(Node& layer_norm,
 
   std::vector<NodeIndex> nodes_to_remove;
   if (!FuseSubGraphQKImpl(layer_norm, graph, parent_path_nodes, mask_input, mask_int32_map, edges, nodes_to_remove, hidden_size,
-                          num_heads, head_size, logger)) {
+                          num_heads, head_size, nullptr, logger)) {
     return false;
   }
 
@@ -671,10 +731,14 @@ bool AttentionFusion::FuseSubGraph(Node& layer_norm, const Node& add_after_layer
   //store parent path
   std::vector<std::reference_wrapper<const Node>> parent_path_nodes{reshape, transpose, qkv_matmul, v_transpose, v_reshape, v_add, v_matmul};
 
-  // Find mask nodes: Unsqueeze -> Unsqueeze -> (Cast) -> Sub -> Mul -> Add -> Softmax --> [MatMul]
-  // The "Cast" node in parentheses is optional.
+  // Try the supported mask variants in turn:
+  // - BERT: Unsqueeze -> Unsqueeze -> (Cast) -> Sub -> Mul -> Add -> Softmax --> [MatMul]
+  //   The "Cast" node in parentheses is optional.
+  // - DistilBert: Equal -> Reshape -> Expand -> Where -> Softmax --> [MatMul]
+  // - Additive bias (e.g. ALiBi): any (B, N, S, S) value added to the scaled QxK' scores.
   AttentionFusionHelper::AttentionMaskNodes mask_nodes;
   AttentionFusionHelper::AttentionMaskNodesDistilBert mask_nodes_distilbert;
+  AttentionFusionHelper::AttentionAdditiveMaskNodes additive_mask_nodes;
 
   if (AttentionFusionHelper::MatchInputMaskSubgraph(graph, qkv_matmul, mask_nodes, logger, false)) {
     NodeArg* mask_input = graph.GetNode(mask_nodes.unsqueeze_1->Index())->MutableInputDefs()[0];
@@ -682,6 +746,8 @@ bool AttentionFusion::FuseSubGraph(Node& layer_norm, const Node& add_after_layer
   } else if (AttentionFusionHelper::MatchInputMaskSubgraph(graph, layer_norm, qkv_matmul, mask_nodes_distilbert, record_node_idx, logger)) {
     NodeArg* mask_input = graph.GetNode(mask_nodes_distilbert.equal->Index())->MutableInputDefs()[0];
     return FuseSubGraphQKDistilBert(layer_norm, graph, mask_nodes_distilbert, mask_input, parent_path_nodes, hidden_size, num_heads, head_size, mask_int32_map, logger);
+  } else if (AttentionFusionHelper::MatchAdditiveMaskSubgraph(graph, qkv_matmul, num_heads, additive_mask_nodes, logger)) {
+    return FuseSubGraphQKAdditiveMask(layer_norm, graph, additive_mask_nodes, parent_path_nodes, hidden_size, num_heads, head_size, mask_int32_map, logger);
   } else {
     DEBUG_LOG("Failed in match input mask subgraph");
     return false;
@@ -581,6 +581,83 @@ void SetMaskNodesToRemove(const Graph&, AttentionMaskNodesDistilBert& mask_nodes
   nodes_to_remove.push_back(mask_nodes.shape->Index());
 }
 
+struct AttentionAdditiveMaskNodes {
+  const Node* softmax;
+  const Node* add;
+  int bias_input_index;  // input of the Add node that carries the additive bias
+};
+
+void SetMaskNodesToRemove(const Graph&, AttentionAdditiveMaskNodes& mask_nodes, std::vector<NodeIndex>& nodes_to_remove) {
+  nodes_to_remove.push_back(mask_nodes.softmax->Index());
+  nodes_to_remove.push_back(mask_nodes.add->Index());
+}
+
+/**  Match an additive attention bias subgraph:
+                             [Bias] (B, N, S, S)
+                                 \
+    [qk_Div] ------------------> Add --> Softmax --> [MatMul]
+
+The bias can be any graph value of rank 4 with num_heads on the second dimension, e.g. ALiBi slopes
+multiplied with relative positions, or a precomputed additive attention mask. Unlike the mask
+subgraphs above, the producer of the bias is not matched structurally; the value is fed to the
+fused node through the optional extra_add input of the Attention operator, which adds it to the
+scaled QxK' scores.
+*/
+bool MatchAdditiveMaskSubgraph(const Graph& graph, const Node& qkv_matmul, int64_t num_heads,
+                               AttentionAdditiveMaskNodes& result, const logging::Logger& logger) {
+  DEBUG_LOG("Start MatchAdditiveMaskSubgraph");
+
+  std::vector<graph_utils::EdgeEndToMatch> softmax_path{
+      {0, 0, "Softmax", {1, 11, 13}, kOnnxDomain},
+      {0, 0, "Add", {7, 13}, kOnnxDomain}};
+
+  std::vector<const Node::EdgeEnd*> edges;
+  if (!graph_utils::FindPath(qkv_matmul, true, softmax_path, edges, logger)) {
+    DEBUG_LOG("Failed to find Softmax and Add of additive mask");
+    return false;
+  }
+
+  const Node& softmax = edges[0]->GetNode();
+  const Node& mask_add = edges[1]->GetNode();
+  if (!optimizer_utils::CheckOutputEdges(graph, softmax, 1) ||
+      !optimizer_utils::CheckOutputEdges(graph, mask_add, 1)) {
+    DEBUG_LOG("Output edge count not expected for Softmax or Add of additive mask");
+    return false;
+  }
+
+  if (!optimizer_utils::IsAttributeWithExpectedValue(softmax, "axis", static_cast<int64_t>(3))) {
+    DEBUG_LOG("Softmax attribute axis is expected to be 3");
+    return false;
+  }
+
+  // one input of the Add carries the scaled QxK' scores through a Div; the other one is the bias
+  int bias_input_index = 1;
+  const Node* qk_div = graph_utils::GetInputNode(mask_add, 0);
+  if (qk_div == nullptr || qk_div->OpType() != "Div") {
+    qk_div = graph_utils::GetInputNode(mask_add, 1);
+    if (qk_div == nullptr || qk_div->OpType() != "Div") {
+      DEBUG_LOG("Neither input of the Add node is produced by a Div of QxK' scores");
+      return false;
+    }
+    bias_input_index = 0;
+  }
+
+  // the extra_add input of Attention requires shape (batch_size, num_heads, sequence_length, sequence_length)
+  const NodeArg& bias = *(mask_add.InputDefs()[bias_input_index]);
+  const TensorShapeProto* bias_shape = bias.Shape();
+  if (bias_shape == nullptr || bias_shape->dim_size() != 4 ||
+      !utils::HasDimValue(bias_shape->dim(1)) || bias_shape->dim(1).dim_value() != num_heads) {
+    DEBUG_LOG("Additive mask shape is unknown or not (B, num_heads, S, S)");
+    return false;
+  }
+
+  result.softmax = &softmax;
+  result.add = &mask_add;
+  result.bias_input_index = bias_input_index;
+  DEBUG_LOG("Pass MatchAdditiveMaskSubgraph");
+  return true;
+}
+
 /**  Match Input Mask subgraph:
                                                                                                        {UnidirMask Subgraph}
                                                                                                                    |
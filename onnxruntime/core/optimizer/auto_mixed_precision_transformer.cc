@@ -0,0 +1,162 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/auto_mixed_precision_transformer.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/initializer.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// fp16-safe, compute bound ops whose CUDA kernels use tensor cores or are purely
+// elementwise. Accumulation sensitive ops (the reductions, Softmax, the normalization
+// ops) are deliberately absent and keep running in float.
+const char* const kDefaultAllowOps[] = {
+    "MatMul", "Gemm", "FusedMatMul", "TransposeMatMul",
+    "Conv", "ConvTranspose", "FusedConv",
+    "Attention",
+    "Gelu", "FastGelu", "BiasGelu",
+    "Relu", "LeakyRelu", "Sigmoid", "Tanh",
+};
+
+bool IsFloatTensor(const NodeArg* def) {
+  return def != nullptr && def->Type() != nullptr && *def->Type() == "tensor(float)";
+}
+
+}  // namespace
+
+AutoMixedPrecisionTransformer::AutoMixedPrecisionTransformer(
+    const std::unordered_set<std::string>& extra_allow_ops,
+    const std::unordered_set<std::string>& deny_ops,
+    const std::unordered_set<std::string>& compatible_execution_providers) noexcept
+    : GraphTransformer("AutoMixedPrecisionTransformer", compatible_execution_providers) {
+  for (const char* op : kDefaultAllowOps) {
+    allow_ops_.insert(op);
+  }
+  allow_ops_.insert(extra_allow_ops.begin(), extra_allow_ops.end());
+  for (const auto& op : deny_ops) {
+    allow_ops_.erase(op);
+  }
+}
+
+Status AutoMixedPrecisionTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                                const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+
+  // float tensor -> its float16 version, so several converted consumers share one cast or
+  // converted initializer, and adjacent converted nodes connect in float16 directly
+  std::unordered_map<NodeArg*, NodeArg*> fp16_versions;
+  // boundary casts back to float, paired with the original output they produce; the ones
+  // every consumer ends up bypassing are removed at the end
+  std::vector<std::pair<NodeIndex, NodeArg*>> casts_to_float;
+
+  for (auto index : order) {
+    auto* node_ptr = graph.GetNode(index);
+    if (!node_ptr)
+      continue;
+
+    auto& node = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (allow_ops_.find(node.OpType()) == allow_ops_.end() ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders()) ||
+        node.ContainsSubgraph()) {
+      continue;
+    }
+
+    // only convert nodes that actually produce float data; non-float inputs (masks,
+    // shapes, ...) are left untouched below
+    if (!IsFloatTensor(node.OutputDefs()[0])) {
+      continue;
+    }
+
+    auto& input_defs = node.MutableInputDefs();
+    for (size_t i = 0; i < input_defs.size(); ++i) {
+      NodeArg* input = input_defs[i];
+      if (!IsFloatTensor(input)) {
+        continue;
+      }
+
+      auto it = fp16_versions.find(input);
+      if (it == fp16_versions.end()) {
+        NodeArg* fp16_arg = nullptr;
+        const TensorProto* initializer = graph_utils::GetConstantInitializer(graph, input->Name());
+        if (initializer != nullptr) {
+          // convert the weight once at initialization instead of casting it every run
+          Initializer data(*initializer, graph.ModelPath());
+          TensorProto fp16_proto = data.ToFP16(graph.GenerateNodeArgName(input->Name() + "_fp16"));
+          fp16_arg = &graph_utils::AddInitializer(graph, fp16_proto);
+        } else {
+          TypeProto fp16_type(*input->TypeAsProto());
+          fp16_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT16);
+          fp16_arg = &graph.GetOrCreateNodeArg(graph.GenerateNodeArgName(input->Name() + "_fp16"), &fp16_type);
+
+          Node& cast = graph.AddNode(graph.GenerateNodeName("InsertedCast_" + input->Name()), "Cast",
+                                     "cast to float16 at a mixed precision region boundary",
+                                     {input}, {fp16_arg});
+          cast.AddAttribute("to", static_cast<int64_t>(TensorProto_DataType_FLOAT16));
+          cast.SetExecutionProviderType(node.GetExecutionProviderType());
+        }
+        it = fp16_versions.emplace(input, fp16_arg).first;
+      }
+
+      input_defs[i] = it->second;
+    }
+
+    auto& output_defs = node.MutableOutputDefs();
+    for (size_t i = 0; i < output_defs.size(); ++i) {
+      NodeArg* output = output_defs[i];
+      if (!IsFloatTensor(output)) {
+        continue;
+      }
+
+      TypeProto fp16_type(*output->TypeAsProto());
+      fp16_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT16);
+      NodeArg& fp16_out = graph.GetOrCreateNodeArg(graph.GenerateNodeArgName(output->Name() + "_fp16"), &fp16_type);
+
+      // cast back so unconverted consumers and graph outputs still see the float tensor;
+      // converted consumers pick up fp16_out through fp16_versions instead
+      Node& cast = graph.AddNode(graph.GenerateNodeName("InsertedCast_" + output->Name()), "Cast",
+                                 "cast back to float at a mixed precision region boundary",
+                                 {&fp16_out}, {output});
+      cast.AddAttribute("to", static_cast<int64_t>(TensorProto_DataType_FLOAT));
+      cast.SetExecutionProviderType(node.GetExecutionProviderType());
+
+      output_defs[i] = &fp16_out;
+      fp16_versions.emplace(output, &fp16_out);
+      casts_to_float.emplace_back(cast.Index(), output);
+    }
+
+    modified = true;
+  }
+
+  if (!casts_to_float.empty()) {
+    // drop the casts back to float whose output every consumer ended up bypassing
+    std::unordered_set<const NodeArg*> used_defs;
+    for (const auto& node : graph.Nodes()) {
+      for (const auto* def : node.InputDefs()) {
+        used_defs.insert(def);
+      }
+      for (const auto* def : node.ImplicitInputDefs()) {
+        used_defs.insert(def);
+      }
+    }
+    const auto& graph_outputs = graph.GetOutputs();
+    used_defs.insert(graph_outputs.begin(), graph_outputs.end());
+
+    for (const auto& cast_and_output : casts_to_float) {
+      if (used_defs.find(cast_and_output.second) == used_defs.end()) {
+        graph.RemoveNode(cast_and_output.first);
+      }
+    }
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class AutoMixedPrecisionTransformer
+
+Converts fp16-safe regions of a float model to float16 at session initialization so the
+CUDA EP runs tensor core kernels, without converting the whole model offline. Nodes whose
+op type is on the allow list get float16 inputs and outputs, with Cast nodes inserted at
+the region boundaries and float initializers feeding them converted in place. Ops with
+accumulation sensitive numerics (reductions, Softmax, the normalization ops) are not on
+the default allow list and keep computing in float, as does anything on the user deny
+list. Boundary casts between adjacent converted nodes cancel inside a region, so only the
+region entry and exit pay a conversion.
+
+This changes inference results and must be manually enabled
+(see kOrtSessionOptionsEnableAutoMixedPrecision).
+*/
+class AutoMixedPrecisionTransformer : public GraphTransformer {
+ public:
+  AutoMixedPrecisionTransformer(const std::unordered_set<std::string>& extra_allow_ops,
+                                const std::unordered_set<std::string>& deny_ops,
+                                const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept;
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+ private:
+  // the default allow list plus the user additions, minus the user denials
+  std::unordered_set<std::string> allow_ops_;
+};
+
+}  // namespace onnxruntime
@@ -5,7 +5,9 @@
 #include "core/optimizer/utils.h"
 #include "core/graph/graph_utils.h"
 
+#include <algorithm>
 #include <memory>
+#include <sstream>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -320,6 +322,216 @@ struct NodeArgPtrEquality {
 bool IsNodeSupported(const Node& node) {
   return !node.ContainsSubgraph() && optimizer_utils::IsOperationDeterministic(node.Domain(), node.OpType());
 }
+
+// ----- Elimination across If branches -----
+//
+// The value numbering above works within a single graph. Models that branch on feature flags
+// tend to compute the same expression in both the then and else branch of an If from values of
+// the enclosing scope. When both branches contain an identical expression whose inputs all come
+// from outer scope, it is hoisted in front of the If node so it is planned and executed once,
+// and both branches read the result from outer scope instead. Because the expression was present
+// in every branch, hoisting never executes work that would otherwise have been skipped.
+
+// Names defined by the subgraph itself (inputs, initializers and node outputs). Anything else a
+// node in the subgraph reads resolves to outer scope.
+std::unordered_set<std::string> CollectLocallyDefinedNames(const Graph& subgraph) {
+  std::unordered_set<std::string> local_names;
+  for (const auto* input_def : subgraph.GetInputsIncludingInitializers()) {
+    local_names.insert(input_def->Name());
+  }
+  for (const auto& initializer : subgraph.GetAllInitializedTensors()) {
+    local_names.insert(initializer.first);
+  }
+  for (const auto& node : subgraph.Nodes()) {
+    for (const auto* output_def : node.OutputDefs()) {
+      if (output_def->Exists()) {
+        local_names.insert(output_def->Name());
+      }
+    }
+  }
+  return local_names;
+}
+
+// Builds a key identifying the computation of a node whose inputs all come from outer scope.
+// Nodes in sibling branches with the same key always produce the same values, as identical input
+// names resolve to the same outer scope values from either branch.
+std::string MakeHoistingKey(const Node& node) {
+  std::ostringstream key_stream;
+  key_stream << node.OpType() << '|' << node.Domain() << '|' << node.SinceVersion()
+             << '|' << node.OutputDefs().size();
+  for (const NodeArg* input_def : node.InputDefs()) {
+    key_stream << '|' << (Normalize(input_def) != nullptr ? input_def->Name() : "");
+  }
+
+  // NodeAttributes is unordered; serialize in name order to make the key deterministic. Unlike the
+  // in-graph value numbering this compares attributes by serialized value, which also matches
+  // tensor attributes so that e.g. duplicated Constant nodes can be hoisted.
+  const auto& attributes = node.GetAttributes();
+  std::vector<std::string> attribute_names;
+  attribute_names.reserve(attributes.size());
+  for (const auto& attribute : attributes) {
+    attribute_names.push_back(attribute.first);
+  }
+  std::sort(attribute_names.begin(), attribute_names.end());
+  for (const auto& attribute_name : attribute_names) {
+    key_stream << '|' << attribute_name << ':' << attributes.at(attribute_name).SerializeAsString();
+  }
+
+  return key_stream.str();
+}
+
+bool IsHoistableFromBranch(const Graph& branch, const Node& node,
+                           const std::unordered_set<std::string>& local_names,
+                           const std::unordered_set<const NodeArg*>& branch_outputs) {
+  if (!IsNodeSupported(node)) {
+    return false;
+  }
+
+  // all inputs must resolve to outer scope so the expression can run before the If node
+  for (const NodeArg* input_def : node.InputDefs()) {
+    if (Normalize(input_def) != nullptr && local_names.count(input_def->Name()) > 0) {
+      return false;
+    }
+  }
+
+  for (const NodeArg* output_def : node.OutputDefs()) {
+    // the branch's outputs must keep their names, so don't hoist their producers
+    if (Normalize(output_def) == nullptr || branch_outputs.count(output_def) > 0) {
+      return false;
+    }
+  }
+
+  // a value consumed implicitly by a nested subgraph is referenced by name from that scope;
+  // renaming inside the nested subgraph is not handled, so leave such producers in place
+  for (const auto& consumer : branch.Nodes()) {
+    for (const NodeArg* implicit_input : consumer.ImplicitInputDefs()) {
+      for (const NodeArg* output_def : node.OutputDefs()) {
+        if (implicit_input->Name() == output_def->Name()) {
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+// Replaces all uses of the node's outputs within the branch with the corresponding hoisted outer
+// scope values and removes the node from the branch.
+void ReplaceWithHoistedValues(Graph& branch, Node& node, const std::vector<NodeArg*>& hoisted_outputs,
+                              std::unordered_set<std::string>& local_names) {
+  for (std::size_t output_idx = 0; output_idx < node.OutputDefs().size(); ++output_idx) {
+    const NodeArg* old_def = node.OutputDefs()[output_idx];
+    NodeArg& outer_scope_def = branch.GetOrCreateNodeArg(hoisted_outputs[output_idx]->Name(),
+                                                         hoisted_outputs[output_idx]->TypeAsProto());
+    branch.AddOuterScopeNodeArg(outer_scope_def.Name());
+
+    for (auto& consumer : branch.Nodes()) {
+      const auto& input_defs = consumer.InputDefs();
+      for (int input_idx = 0, end = static_cast<int>(input_defs.size()); input_idx < end; ++input_idx) {
+        if (input_defs[input_idx] == old_def) {
+          // there is no edge between an outer scope value and a node, so updating the def suffices
+          graph_utils::ReplaceNodeInput(consumer, input_idx, outer_scope_def);
+        }
+      }
+    }
+
+    local_names.erase(old_def->Name());
+  }
+
+  graph_utils::RemoveNodeOutputEdges(branch, node);
+  branch.RemoveNode(node.Index());
+}
+
+bool HoistCommonExpressionsAboveIf(Graph& graph, Node& if_node, const logging::Logger& logger) {
+  Graph* then_branch = if_node.GetMutableGraphAttribute("then_branch");
+  Graph* else_branch = if_node.GetMutableGraphAttribute("else_branch");
+  if (then_branch == nullptr || else_branch == nullptr) {
+    return false;
+  }
+
+  auto then_local_names = CollectLocallyDefinedNames(*then_branch);
+  auto else_local_names = CollectLocallyDefinedNames(*else_branch);
+
+  std::unordered_set<const NodeArg*> then_outputs(then_branch->GetOutputs().begin(),
+                                                  then_branch->GetOutputs().end());
+  std::unordered_set<const NodeArg*> else_outputs(else_branch->GetOutputs().begin(),
+                                                  else_branch->GetOutputs().end());
+
+  bool hoisted_any = false;
+
+  // Hoisting a producer turns its consumers' inputs into outer scope values, which can make the
+  // consumers hoistable in turn, but also renames the values they consume. Process in rounds and
+  // rebuild the candidate index after each round so chains of common expressions hoist fully.
+  bool hoisted_this_round = true;
+  while (hoisted_this_round) {
+    hoisted_this_round = false;
+
+    // index the hoistable expressions of the else branch by their computation
+    std::unordered_map<std::string, NodeIndex> else_candidates;
+    for (const auto& node : else_branch->Nodes()) {
+      if (IsHoistableFromBranch(*else_branch, node, else_local_names, else_outputs)) {
+        else_candidates.emplace(MakeHoistingKey(node), node.Index());
+      }
+    }
+
+    if (else_candidates.empty()) {
+      break;
+    }
+
+    GraphViewer then_viewer(*then_branch);
+    for (NodeIndex then_node_index : then_viewer.GetNodesInTopologicalOrder()) {
+      Node* then_node = then_branch->GetNode(then_node_index);
+      if (then_node == nullptr ||
+          !IsHoistableFromBranch(*then_branch, *then_node, then_local_names, then_outputs)) {
+        continue;
+      }
+
+      auto match = else_candidates.find(MakeHoistingKey(*then_node));
+      if (match == else_candidates.end()) {
+        continue;
+      }
+
+      Node* else_node = else_branch->GetNode(match->second);
+      else_candidates.erase(match);
+      if (else_node == nullptr) {
+        continue;
+      }
+
+      std::vector<NodeArg*> hoisted_inputs;
+      hoisted_inputs.reserve(then_node->InputDefs().size());
+      for (const NodeArg* input_def : then_node->InputDefs()) {
+        hoisted_inputs.push_back(&graph.GetOrCreateNodeArg(input_def->Name(), input_def->TypeAsProto()));
+      }
+
+      std::vector<NodeArg*> hoisted_outputs;
+      hoisted_outputs.reserve(then_node->OutputDefs().size());
+      for (const NodeArg* output_def : then_node->OutputDefs()) {
+        // the name must be free in the enclosing graph and must not be shadowed in either branch
+        std::string hoisted_name = graph.GenerateNodeArgName(output_def->Name());
+        while (then_local_names.count(hoisted_name) > 0 || else_local_names.count(hoisted_name) > 0) {
+          hoisted_name = graph.GenerateNodeArgName(hoisted_name);
+        }
+        hoisted_outputs.push_back(&graph.GetOrCreateNodeArg(hoisted_name, output_def->TypeAsProto()));
+      }
+
+      graph.AddNode(graph.GenerateNodeName(then_node->Name()), then_node->OpType(),
+                    "Hoisted from the branches of If node '" + if_node.Name() + "'.",
+                    hoisted_inputs, hoisted_outputs, &then_node->GetAttributes(), then_node->Domain());
+
+      LOGS(logger, VERBOSE) << "Hoisting " << then_node->OpType() << " node '" << then_node->Name()
+                            << "' computed in both branches of If node '" << if_node.Name()
+                            << "' into the enclosing graph.";
+
+      ReplaceWithHoistedValues(*then_branch, *then_node, hoisted_outputs, then_local_names);
+      ReplaceWithHoistedValues(*else_branch, *else_node, hoisted_outputs, else_local_names);
+      hoisted_any = true;
+      hoisted_this_round = true;
+    }
+  }
+
+  return hoisted_any;
+}
 }  // namespace
 
 }  // namespace onnxruntime
@@ -446,6 +658,21 @@ Status CommonSubexpressionElimination::ApplyImpl(Graph& graph, bool& modified, i
     }
   }
 
+  // After in-graph elimination, hoist expressions computed identically in both branches of an
+  // If node into this graph so they are planned and executed once regardless of the branch taken.
+  // The next pass of this transformer can then merge a hoisted expression with an equivalent
+  // expression that already existed in this graph.
+  for (NodeIndex node_index : node_topology_list) {
+    Node* node = graph.GetNode(node_index);
+    if (node == nullptr || node->OpType() != "If" || node->Domain() != kOnnxDomain) {
+      continue;
+    }
+
+    if (HoistCommonExpressionsAboveIf(graph, *node, logger)) {
+      modified = true;
+    }
+  }
+
   return Status::OK();
 }
 
@@ -1,7 +1,9 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
 #include <limits>
+#include <sstream>
 
 #include "core/optimizer/constant_folding.h"
 #include "core/optimizer/utils.h"
@@ -17,23 +19,70 @@ namespace onnxruntime {
 ConstantFolding::ConstantFolding(const IExecutionProvider& execution_provider,
                                  bool skip_dequantize_linear,
                                  const std::unordered_set<std::string>& compatible_execution_providers,
-                                 const std::unordered_set<std::string>& excluded_initializers) noexcept
+                                 const std::unordered_set<std::string>& excluded_initializers,
+                                 concurrency::ThreadPool* intra_op_thread_pool) noexcept
     : GraphTransformer("ConstantFolding", compatible_execution_providers),
       skip_dequantize_linear_(skip_dequantize_linear),
       excluded_initializers_(excluded_initializers),
-      execution_provider_(execution_provider) {
+      execution_provider_(execution_provider),
+      intra_op_thread_pool_(intra_op_thread_pool) {
 }
 
-// We need to handle a Shape node separately as the input doesn't need to be a constant initializer for
-// Shape to be able to be constant folded.
-static bool ConstantFoldShapeNode(Graph& graph, Node& node) {
-  // Opset-15 Shape supports slicing using a 'start' and 'end' attribute
-  const auto& shape_attributes = node.GetAttributes();
+// Builds a key identifying the computation a node performs, independently of the names of the node and
+// its initializers, so that identical constant subexpressions are only executed once per pass.
+// Returns false if a stable key cannot be built for the node.
+static bool BuildFoldedValueCacheKey(const Node& node, const InitializedTensorSet& constant_inputs,
+                                     std::string& key) {
+  std::ostringstream key_stream;
+  key_stream << node.Domain() << '|' << node.OpType() << '|' << node.SinceVersion();
+
+  // NodeAttributes is unordered, so sort the attribute names to keep the key deterministic.
+  const auto& attributes = node.GetAttributes();
+  std::vector<std::string> attribute_names;
+  attribute_names.reserve(attributes.size());
+  for (const auto& attribute : attributes) {
+    attribute_names.push_back(attribute.first);
+  }
+  std::sort(attribute_names.begin(), attribute_names.end());
+  for (const auto& attribute_name : attribute_names) {
+    key_stream << '|' << attribute_name << ':' << attributes.at(attribute_name).SerializeAsString();
+  }
 
+  for (const auto* input_def : node.InputDefs()) {
+    if (!input_def->Exists()) {
+      key_stream << "|-";
+      continue;
+    }
+
+    auto entry = constant_inputs.find(input_def->Name());
+    if (entry == constant_inputs.end()) {
+      return false;
+    }
+
+    // an initializer with external data is identified by its location rather than its value,
+    // so don't attempt to share results between such initializers
+    if (utils::HasExternalData(*entry->second)) {
+      return false;
+    }
+
+    ONNX_NAMESPACE::TensorProto value_only = *entry->second;
+    value_only.clear_name();
+    key_stream << '|' << value_only.SerializeAsString();
+  }
+
+  key = key_stream.str();
+  return true;
+}
+
+// Returns the slice of the input shape a Shape node produces, honoring the opset-15
+// 'start'/'end' attributes (negatives resolved against the rank and clamped). Entries of
+// symbolic dimensions are left as -1 with has_value false.
+static bool GetShapeNodeOutputDims(const Node& shape_node, std::vector<int64_t>& dim_values,
+                                   std::vector<bool>& dim_known) {
   int64_t start = 0;
   int64_t end = std::numeric_limits<int64_t>::max();
 
-  for (const auto& attr : shape_attributes) {
+  for (const auto& attr : shape_node.GetAttributes()) {
     if (attr.first == "start") {
       start = attr.second.i();
     } else if (attr.first == "end") {
@@ -41,47 +90,50 @@ static bool ConstantFoldShapeNode(Graph& graph, Node& node) {
     }
   }
 
-  auto shape = node.MutableInputDefs()[0]->Shape();
-  bool is_concrete_shape = true;
-  std::vector<int64_t> dim_values;
-  if (shape != nullptr) {
-    for (int dim_index = 0; dim_index < shape->dim_size(); dim_index++) {
-      auto dim = shape->dim(dim_index);
-      if (!utils::HasDimValue(dim)) {
-        is_concrete_shape = false;
-        break;
-      }
-      dim_values.push_back(dim.dim_value());
-    }
-  } else {
-    is_concrete_shape = false;
+  auto shape = shape_node.InputDefs()[0]->Shape();
+  if (shape == nullptr) {
+    return false;
   }
 
-  if (is_concrete_shape) {
-    int64_t rank = static_cast<int64_t>(dim_values.size());
+  const int64_t rank = shape->dim_size();
 
-    // We ascertain the "true" starts/ends (if they were provided)
-    // Opset-15 Shape op supports slicing shape values
+  // Deal with negatives and clamp
+  start = start < 0 ? start + rank : start;
+  start = start < 0 ? 0 : ((start > rank) ? rank : start);
 
-    // Deal with negatives and clamp
-    start = start < 0 ? start + rank : start;
-    start = start < 0 ? 0 : ((start > rank) ? rank : start);
+  end = end < 0 ? end + rank : end;
+  end = end < 0 ? 0 : ((end > rank) ? rank : end);
 
-    end = end < 0 ? end + rank : end;
-    end = end < 0 ? 0 : ((end > rank) ? rank : end);
+  dim_values.clear();
+  dim_known.clear();
+  for (int64_t dim_index = start; dim_index < end; dim_index++) {
+    auto dim = shape->dim(static_cast<int>(dim_index));
+    const bool known = utils::HasDimValue(dim);
+    dim_values.push_back(known ? dim.dim_value() : -1);
+    dim_known.push_back(known);
+  }
 
-    int64_t slice_length = end - start;
-    size_t clamped_slice_length = slice_length < 0 ? 0 : static_cast<size_t>(slice_length);
+  return true;
+}
+
+// We need to handle a Shape node separately as the input doesn't need to be a constant initializer for
+// Shape to be able to be constant folded.
+static bool ConstantFoldShapeNode(Graph& graph, Node& node) {
+  std::vector<int64_t> dim_values;
+  std::vector<bool> dim_known;
+  // only the dimensions the (possibly sliced) Shape output covers need to be static
+  bool is_concrete_shape = GetShapeNodeOutputDims(node, dim_values, dim_known) &&
+                           std::all_of(dim_known.cbegin(), dim_known.cend(), [](bool known) { return known; });
 
+  if (is_concrete_shape) {
     ONNX_NAMESPACE::TensorProto shape_constant;
     auto* constant_arg_out = node.MutableOutputDefs()[0];
     shape_constant.set_name(constant_arg_out->Name());
     shape_constant.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_INT64);
-    shape_constant.add_dims(clamped_slice_length);
-    shape_constant.set_raw_data(dim_values.data() + start,
-                                clamped_slice_length * sizeof(int64_t));
+    shape_constant.add_dims(dim_values.size());
+    shape_constant.set_raw_data(dim_values.data(), dim_values.size() * sizeof(int64_t));
     ONNX_NAMESPACE::TensorShapeProto result_shape;
-    result_shape.add_dim()->set_dim_value(clamped_slice_length);
+    result_shape.add_dim()->set_dim_value(dim_values.size());
     constant_arg_out->SetShape(result_shape);
     graph.AddInitializedTensor(shape_constant);
   }
@@ -89,11 +141,78 @@ static bool ConstantFoldShapeNode(Graph& graph, Node& node) {
   return is_concrete_shape;  // convert to constant if this is true
 }
 
+// A Gather selecting dimensions out of a Shape output can be folded when the selected dimensions
+// are statically known, even if others (typically the batch) are symbolic and keep the Shape node
+// itself from folding. Models commonly compute reshape targets with Shape->Gather->Concat/...
+// chains; folding the Gather here turns the rest of the chain into ordinary constant-foldable
+// nodes, so it collapses during the same pass instead of executing per Run.
+static bool ConstantFoldGatherOfShapeNode(Graph& graph, Node& node) {
+  const Node* shape_node = graph_utils::GetInputNode(node, 0);
+  if (shape_node == nullptr || shape_node->OpType() != "Shape" || shape_node->Domain() != kOnnxDomain) {
+    return false;
+  }
+
+  // the Shape output is 1-D so only axis 0 (possibly given as -1) is valid
+  const auto& attributes = node.GetAttributes();
+  auto axis_attr = attributes.find("axis");
+  if (axis_attr != attributes.cend() && axis_attr->second.i() != 0 && axis_attr->second.i() != -1) {
+    return false;
+  }
+
+  const auto* indices_proto = graph_utils::GetConstantInitializer(graph, node.InputDefs()[1]->Name());
+  if (indices_proto == nullptr || indices_proto->dims_size() > 1) {
+    return false;
+  }
+
+  std::vector<int64_t> indices;
+  if (!optimizer_utils::AppendTensorFromInitializer(graph, *node.InputDefs()[1], indices)) {
+    return false;
+  }
+
+  std::vector<int64_t> dim_values;
+  std::vector<bool> dim_known;
+  if (!GetShapeNodeOutputDims(*shape_node, dim_values, dim_known)) {
+    return false;
+  }
+
+  const int64_t num_dims = static_cast<int64_t>(dim_values.size());
+  std::vector<int64_t> gathered_dims;
+  gathered_dims.reserve(indices.size());
+  for (int64_t index : indices) {
+    index = index < 0 ? index + num_dims : index;
+    if (index < 0 || index >= num_dims || !dim_known[index]) {
+      return false;
+    }
+    gathered_dims.push_back(dim_values[index]);
+  }
+
+  ONNX_NAMESPACE::TensorProto gathered_constant;
+  auto* constant_arg_out = node.MutableOutputDefs()[0];
+  gathered_constant.set_name(constant_arg_out->Name());
+  gathered_constant.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_INT64);
+  ONNX_NAMESPACE::TensorShapeProto result_shape;
+  // scalar indices produce a scalar output, 1-D indices a 1-D output
+  if (indices_proto->dims_size() == 1) {
+    gathered_constant.add_dims(gathered_dims.size());
+    result_shape.add_dim()->set_dim_value(gathered_dims.size());
+  }
+  gathered_constant.set_raw_data(gathered_dims.data(), gathered_dims.size() * sizeof(int64_t));
+  constant_arg_out->SetShape(result_shape);
+  graph.AddInitializedTensor(gathered_constant);
+
+  return true;
+}
+
 Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
   bool have_updated_nodes = false;
   GraphViewer graph_viewer(graph);
   auto& order = graph_viewer.GetNodesInTopologicalOrder();
 
+  // Folded outputs keyed by the computation that produced them. Repeated constant subexpressions
+  // (e.g. identical pre-processing chains stamped out once per model input) hit the cache and skip
+  // kernel execution entirely. The cache lives for a single pass over this graph.
+  std::unordered_map<std::string, std::vector<ONNX_NAMESPACE::TensorProto>> folded_value_cache;
+
 #if !defined(DISABLE_SPARSE_TENSORS)
   std::function<bool(const std::string&)> is_sparse_initializer_check = [&graph](const std::string& name) -> bool {
     return graph.IsSparseInitializer(name);
@@ -124,6 +243,9 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
     bool converted_to_constant = false;
     if (node->OpType().compare("Shape") == 0) {
       converted_to_constant = ConstantFoldShapeNode(graph, *node);
+    } else if (node->OpType().compare("Gather") == 0 && node->Domain() == kOnnxDomain &&
+               ConstantFoldGatherOfShapeNode(graph, *node)) {
+      converted_to_constant = true;
     } else {
       InitializedTensorSet constant_inputs;
 
@@ -148,79 +270,118 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         continue;
       }
 
+      // Check whether an identical constant subexpression was already folded during this pass.
+      std::string cache_key;
+      const bool has_cache_key = BuildFoldedValueCacheKey(*node, constant_inputs, cache_key);
+      const auto cached_entry = has_cache_key ? folded_value_cache.find(cache_key) : folded_value_cache.end();
+      if (cached_entry != folded_value_cache.end()) {
+        const auto& cached_outputs = cached_entry->second;
+        ORT_ENFORCE(cached_outputs.size() == node->OutputDefs().size());
+        for (size_t fetch_idx = 0; fetch_idx < cached_outputs.size(); ++fetch_idx) {
+          ONNX_NAMESPACE::TensorProto out_tensorproto = cached_outputs[fetch_idx];
+          auto* constant_arg_out = node->MutableOutputDefs()[fetch_idx];
+          out_tensorproto.set_name(constant_arg_out->Name());
+
+          ONNX_NAMESPACE::TensorShapeProto result_shape;
+          for (int dim_index = 0; dim_index < out_tensorproto.dims_size(); ++dim_index) {
+            result_shape.add_dim()->set_dim_value(out_tensorproto.dims(dim_index));
+          }
+
+          constant_arg_out->SetShape(result_shape);
+          graph.AddInitializedTensor(out_tensorproto);
+        }
+
+        converted_to_constant = true;
+      } else {
 #if !defined(DISABLE_SPARSE_TENSORS)
-      // Create execution frame for executing constant nodes.
-      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_,
-                                         is_sparse_initializer_check);
+        // Create execution frame for executing constant nodes.
+        OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_,
+                                           is_sparse_initializer_check);
 #else
-      // Create execution frame for executing constant nodes.
-      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_,
-                                         [](std::string const&) { return false; });
+        // Create execution frame for executing constant nodes.
+        OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_,
+                                           [](std::string const&) { return false; });
 #endif
 
-      std::vector<int> fetch_mlvalue_idxs;
-      for (const auto* node_out : node->OutputDefs()) {
-        fetch_mlvalue_idxs.push_back(info.GetMLValueIndex(node_out->Name()));
-      }
+        std::vector<int> fetch_mlvalue_idxs;
+        for (const auto* node_out : node->OutputDefs()) {
+          fetch_mlvalue_idxs.push_back(info.GetMLValueIndex(node_out->Name()));
+        }
 
-      // override the EP assigned to the node so that it will use the CPU kernel for Compute.
-      if (!cpu_ep) {
-        node->SetExecutionProviderType(kCpuExecutionProvider);
-      }
+        // override the EP assigned to the node so that it will use the CPU kernel for Compute.
+        if (!cpu_ep) {
+          node->SetExecutionProviderType(kCpuExecutionProvider);
+        }
 
-      auto kernel = info.CreateKernel(node);
+        auto kernel = info.CreateKernel(node);
 
-      // undo the EP change to the value that was assigned at graph partitioning time
-      if (!cpu_ep) {
-        node->SetExecutionProviderType(ep_type);
-      }
+        // undo the EP change to the value that was assigned at graph partitioning time
+        if (!cpu_ep) {
+          node->SetExecutionProviderType(ep_type);
+        }
 
-      if (kernel == nullptr) {
-        LOGS(logger, WARNING) << "Could not find a CPU kernel and hence "
-                              << "can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
+        if (kernel == nullptr) {
+          LOGS(logger, WARNING) << "Could not find a CPU kernel and hence "
+                                << "can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
 
-        // Move on to the next candidate node
-        continue;
-      }
-
-      OptimizerExecutionFrame frame(info, fetch_mlvalue_idxs);
+          // Move on to the next candidate node
+          continue;
+        }
 
-      OpKernelContext op_kernel_context(&frame, kernel.get(), nullptr, logger);
-      ORT_RETURN_IF_ERROR(kernel->Compute(&op_kernel_context));
+        OptimizerExecutionFrame frame(info, fetch_mlvalue_idxs);
 
-      std::vector<OrtValue> fetches;
-      ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
+        OpKernelContext op_kernel_context(&frame, kernel.get(), intra_op_thread_pool_, logger);
+        ORT_RETURN_IF_ERROR(kernel->Compute(&op_kernel_context));
 
-      // Go over all output node args and substitute them with the newly computed tensors, which will be
-      // added to the graph as initializers.
-      ORT_ENFORCE(fetches.size() == node->OutputDefs().size());
-      converted_to_constant = true;
-      for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
-        OrtValue& ort_value = fetches[fetch_idx];
-        // XXX: Add support for SparseTensors outputs when we have sparse outputs
-        if (!ort_value.IsTensor()) {
-          LOGS(logger, WARNING) << "Unsupported output type of " << ort_value.Type()
-                                << ". Can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
-          converted_to_constant = false;
-          break;
-        }
-      }
+        std::vector<OrtValue> fetches;
+        ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
 
-      if (converted_to_constant) {
+        // Go over all output node args and substitute them with the newly computed tensors, which will be
+        // added to the graph as initializers.
+        ORT_ENFORCE(fetches.size() == node->OutputDefs().size());
+        converted_to_constant = true;
         for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
           OrtValue& ort_value = fetches[fetch_idx];
-          // Build the TensorProto that corresponds to the computed OrtValue and add it as initializer to the graph.
-          auto* constant_arg_out = node->MutableOutputDefs()[fetch_idx];
-          const Tensor& out_tensor = ort_value.Get<Tensor>();
-          ONNX_NAMESPACE::TensorProto out_tensorproto = utils::TensorToTensorProto(out_tensor, constant_arg_out->Name());
+          // XXX: Add support for SparseTensors outputs when we have sparse outputs
+          if (!ort_value.IsTensor()) {
+            LOGS(logger, WARNING) << "Unsupported output type of " << ort_value.Type()
+                                  << ". Can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
+            converted_to_constant = false;
+            break;
+          }
+        }
 
-          ONNX_NAMESPACE::TensorShapeProto result_shape;
-          for (auto& dim : out_tensor.Shape().GetDims()) {
-            result_shape.add_dim()->set_dim_value(dim);
+        if (converted_to_constant) {
+          std::vector<ONNX_NAMESPACE::TensorProto> outputs_to_cache;
+          outputs_to_cache.reserve(has_cache_key ? fetches.size() : 0);
+
+          for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
+            OrtValue& ort_value = fetches[fetch_idx];
+            // Build the TensorProto that corresponds to the computed OrtValue and add it as initializer to the graph.
+            auto* constant_arg_out = node->MutableOutputDefs()[fetch_idx];
+            const Tensor& out_tensor = ort_value.Get<Tensor>();
+            ONNX_NAMESPACE::TensorProto out_tensorproto = utils::TensorToTensorProto(out_tensor, constant_arg_out->Name());
+
+            ONNX_NAMESPACE::TensorShapeProto result_shape;
+            for (auto& dim : out_tensor.Shape().GetDims()) {
+              result_shape.add_dim()->set_dim_value(dim);
+            }
+
+            constant_arg_out->SetShape(result_shape);
+
+            if (has_cache_key) {
+              // cached copies are name-free so they can be reused for any node producing the same values
+              ONNX_NAMESPACE::TensorProto value_only = out_tensorproto;
+              value_only.clear_name();
+              outputs_to_cache.push_back(std::move(value_only));
+            }
+
+            graph.AddInitializedTensor(out_tensorproto);
           }
 
-          constant_arg_out->SetShape(result_shape);
-          graph.AddInitializedTensor(out_tensorproto);
+          if (has_cache_key) {
+            folded_value_cache.emplace(std::move(cache_key), std::move(outputs_to_cache));
+          }
         }
       }
     }
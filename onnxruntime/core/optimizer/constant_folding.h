@@ -9,6 +9,9 @@
 #include "core/framework/execution_provider.h"
 
 namespace onnxruntime {
+namespace concurrency {
+class ThreadPool;
+}
 
 /**
 @class ConstantFolding
@@ -21,11 +24,14 @@ class ConstantFolding : public GraphTransformer {
   /*! Constant folding will not be applied to nodes that have one of initializers from excluded_initializers as input.
       For pre-training, the trainable weights are those initializers to be excluded.
       \param execution_provider Execution provider instance to execute constant folding.
+      \param intra_op_thread_pool Optional thread pool the folding kernels run on. When not provided the kernels
+             execute single-threaded.
   */
   ConstantFolding(const IExecutionProvider& execution_provider,
                   bool skip_dequantize_linear,
                   const std::unordered_set<std::string>& compatible_execution_providers = {},
-                  const std::unordered_set<std::string>& excluded_initializers = {}) noexcept;
+                  const std::unordered_set<std::string>& excluded_initializers = {},
+                  concurrency::ThreadPool* intra_op_thread_pool = nullptr) noexcept;
 
  private:
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
@@ -33,6 +39,7 @@ class ConstantFolding : public GraphTransformer {
   bool skip_dequantize_linear_;
   const std::unordered_set<std::string> excluded_initializers_;
   const IExecutionProvider& execution_provider_;
+  concurrency::ThreadPool* intra_op_thread_pool_;
 };
 
 }  // namespace onnxruntime
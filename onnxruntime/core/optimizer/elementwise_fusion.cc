@@ -0,0 +1,204 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/elementwise_fusion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+bool IsFusableElementwiseOp(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Add", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sub", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Div", {7, 13, 14});
+}
+
+// Exact shape equality, including symbolic dims. Unknown dims never compare equal as the
+// fusion relies on the shapes actually matching at runtime.
+bool SameShape(const TensorShapeProto* a, const TensorShapeProto* b) {
+  if (a == nullptr || b == nullptr || a->dim_size() != b->dim_size()) {
+    return false;
+  }
+
+  for (int i = 0; i < a->dim_size(); ++i) {
+    const auto& dim_a = a->dim(i);
+    const auto& dim_b = b->dim(i);
+    if (dim_a.has_dim_value() && dim_b.has_dim_value()) {
+      if (dim_a.dim_value() != dim_b.dim_value()) {
+        return false;
+      }
+    } else if (dim_a.has_dim_param() && dim_b.has_dim_param()) {
+      if (dim_a.dim_param() != dim_b.dim_param()) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// True if 'operand' broadcasts unidirectionally to 'output' without expanding it.
+bool BroadcastsToShape(const TensorShapeProto* operand, const TensorShapeProto* output) {
+  if (operand == nullptr || output == nullptr || operand->dim_size() > output->dim_size()) {
+    return false;
+  }
+
+  const int offset = output->dim_size() - operand->dim_size();
+  for (int i = 0; i < operand->dim_size(); ++i) {
+    const auto& operand_dim = operand->dim(i);
+    const auto& output_dim = output->dim(i + offset);
+    if (operand_dim.has_dim_value() && operand_dim.dim_value() == 1) {
+      continue;
+    }
+    if (operand_dim.has_dim_value() && output_dim.has_dim_value() &&
+        operand_dim.dim_value() == output_dim.dim_value()) {
+      continue;
+    }
+    if (operand_dim.has_dim_param() && output_dim.has_dim_param() &&
+        operand_dim.dim_param() == output_dim.dim_param()) {
+      continue;
+    }
+    return false;
+  }
+
+  return true;
+}
+
+// Finds the input of 'node' that carries the accumulated value of a chain producing 'shape'.
+// Returns -1 if neither input has that shape or the other operand does not broadcast to it.
+int GetAccumulatorInputIndex(const Node& node, const TensorShapeProto* shape) {
+  const auto& input_defs = node.InputDefs();
+  if (input_defs.size() != 2) {
+    return -1;
+  }
+
+  for (int i = 0; i < 2; ++i) {
+    if (SameShape(input_defs[i]->Shape(), shape) &&
+        BroadcastsToShape(input_defs[1 - i]->Shape(), shape)) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+// The op name recorded in the fused node's 'ops' attribute. Sub and Div are order
+// sensitive, so when the accumulated value is the second input the reversed variant is used.
+std::string FusedOpName(const Node& node, int accumulator_index) {
+  if (accumulator_index == 0 || node.OpType() == "Add" || node.OpType() == "Mul") {
+    return node.OpType();
+  }
+  return node.OpType() + "Rev";
+}
+
+// True if 'node' could be a member of a chain producing 'shape', ignoring edge/output
+// constraints that depend on its position in the chain.
+bool IsChainLink(const Node& node, const TensorShapeProto* shape) {
+  return IsFusableElementwiseOp(node) &&
+         optimizer_utils::IsSupportedDataType(node, std::vector<std::string>{"tensor(float)"}) &&
+         SameShape(node.OutputDefs()[0]->Shape(), shape) &&
+         GetAccumulatorInputIndex(node, shape) != -1;
+}
+
+}  // namespace
+
+Status ElementwiseFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                    const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto index : order) {
+    auto* node_ptr = graph.GetNode(index);
+    if (!node_ptr)
+      continue;  // node was removed as part of an earlier fusion
+
+    auto& node = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!IsFusableElementwiseOp(node) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    const TensorShapeProto* output_shape = node.OutputDefs()[0]->Shape();
+    if (!IsChainLink(node, output_shape)) {
+      continue;
+    }
+
+    const int accumulator_index = GetAccumulatorInputIndex(node, output_shape);
+
+    // skip nodes in the middle of a chain - the head picks up the whole chain when visited
+    const Node* accumulator_producer = graph_utils::GetInputNode(node, accumulator_index);
+    if (accumulator_producer != nullptr &&
+        accumulator_producer->GetOutputEdgesCount() == 1 &&
+        !graph.NodeProducesGraphOutput(*accumulator_producer) &&
+        accumulator_producer->GetExecutionProviderType() == node.GetExecutionProviderType() &&
+        IsChainLink(*accumulator_producer, output_shape)) {
+      continue;
+    }
+
+    // walk forward collecting the chain
+    std::vector<std::reference_wrapper<Node>> chain{node};
+    std::vector<std::string> op_names{FusedOpName(node, accumulator_index)};
+    std::vector<NodeArg*> fused_inputs{node.MutableInputDefs()[accumulator_index],
+                                       node.MutableInputDefs()[1 - accumulator_index]};
+
+    Node* tail = &node;
+    while (tail->GetOutputEdgesCount() == 1 && !graph.NodeProducesGraphOutput(*tail)) {
+      Node& next = *graph.GetNode(tail->OutputNodesBegin()->Index());
+      if (next.GetExecutionProviderType() != node.GetExecutionProviderType() ||
+          !IsChainLink(next, output_shape)) {
+        break;
+      }
+
+      // the accumulated value must feed the next node's accumulator side
+      const std::string& tail_output_name = tail->OutputDefs()[0]->Name();
+      int next_accumulator_index = -1;
+      for (int i = 0; i < 2; ++i) {
+        if (next.InputDefs()[i]->Name() == tail_output_name &&
+            SameShape(next.InputDefs()[i]->Shape(), output_shape) &&
+            BroadcastsToShape(next.InputDefs()[1 - i]->Shape(), output_shape)) {
+          next_accumulator_index = i;
+          break;
+        }
+      }
+      if (next_accumulator_index == -1) {
+        break;
+      }
+
+      chain.push_back(next);
+      op_names.push_back(FusedOpName(next, next_accumulator_index));
+      fused_inputs.push_back(next.MutableInputDefs()[1 - next_accumulator_index]);
+      tail = &next;
+    }
+
+    if (chain.size() < 2) {
+      continue;
+    }
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("FusedElementwise"),
+                                     "FusedElementwise",
+                                     "fused elementwise chain starting at " + node.Name(),
+                                     fused_inputs, {}, nullptr, kMSDomain);
+    fused_node.AddAttribute("ops", op_names);
+    fused_node.SetExecutionProviderType(node.GetExecutionProviderType());
+
+    // moves the output definition and edges of the chain's last node to the fused node and
+    // removes the chain nodes
+    graph_utils::FinalizeNodeFusion(graph, chain, fused_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,224 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/gather_nd_fusion.h"
+
+#include <algorithm>
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// Computes the static dimensions of one gathered slice: the data dims from
+// 'batch_dims + indices_shape[-1]' onwards. Returns false if any of them is not known.
+bool GetSliceDims(const Node& gather_nd, std::vector<int64_t>& slice_dims) {
+  const TensorShapeProto* data_shape = gather_nd.InputDefs()[0]->Shape();
+  const TensorShapeProto* indices_shape = gather_nd.InputDefs()[1]->Shape();
+  if (data_shape == nullptr || indices_shape == nullptr || indices_shape->dim_size() < 1) {
+    return false;
+  }
+
+  const auto& last_indices_dim = indices_shape->dim(indices_shape->dim_size() - 1);
+  if (!last_indices_dim.has_dim_value()) {
+    return false;
+  }
+
+  int64_t batch_dims = 0;
+  const auto& attrs = gather_nd.GetAttributes();
+  const auto batch_dims_attr = attrs.find("batch_dims");
+  if (batch_dims_attr != attrs.end()) {
+    batch_dims = batch_dims_attr->second.i();
+  }
+
+  const int64_t first_slice_dim = batch_dims + last_indices_dim.dim_value();
+  if (first_slice_dim > data_shape->dim_size()) {
+    return false;
+  }
+
+  slice_dims.clear();
+  for (int i = static_cast<int>(first_slice_dim); i < data_shape->dim_size(); ++i) {
+    const auto& dim = data_shape->dim(i);
+    if (!dim.has_dim_value()) {
+      return false;
+    }
+    slice_dims.push_back(dim.dim_value());
+  }
+
+  return true;
+}
+
+// The epilogue applies its operand elementwise to every gathered slice, so the original
+// broadcast semantics are only preserved when the operand is a scalar or covers exactly the
+// slice dims (higher dims, which broadcast over the index dims, must all be 1).
+bool OperandAppliesPerSlice(const TensorShapeProto* shape, const std::vector<int64_t>& slice_dims) {
+  if (shape == nullptr) {
+    return false;
+  }
+
+  std::vector<int64_t> dims;
+  for (int i = 0; i < shape->dim_size(); ++i) {
+    if (!shape->dim(i).has_dim_value()) {
+      return false;
+    }
+    dims.push_back(shape->dim(i).dim_value());
+  }
+
+  if (std::all_of(dims.begin(), dims.end(), [](int64_t d) { return d == 1; })) {
+    return true;  // scalar, possibly with redundant unit dims
+  }
+
+  const size_t slice_rank = slice_dims.size();
+  if (dims.size() < slice_rank) {
+    return false;
+  }
+
+  const size_t offset = dims.size() - slice_rank;
+  for (size_t i = 0; i < offset; ++i) {
+    if (dims[i] != 1) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < slice_rank; ++i) {
+    if (dims[offset + i] != slice_dims[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Returns the constant operand of 'node' when its other input is the accumulated value named
+// 'accumulator_name' and the operand can be applied per gathered slice, nullptr otherwise.
+NodeArg* GetEligibleOperand(const Graph& graph, Node& node, const std::string& accumulator_name,
+                            const std::vector<int64_t>& slice_dims) {
+  const auto& input_defs = node.InputDefs();
+  if (input_defs.size() != 2) {
+    return nullptr;
+  }
+
+  int accumulator_index;
+  if (input_defs[0]->Name() == accumulator_name) {
+    accumulator_index = 0;
+  } else if (input_defs[1]->Name() == accumulator_name) {
+    accumulator_index = 1;
+  } else {
+    return nullptr;
+  }
+
+  NodeArg* operand = node.MutableInputDefs()[1 - accumulator_index];
+  if (!graph_utils::IsConstantInitializer(graph, operand->Name(), true) ||
+      operand->Type() == nullptr || *operand->Type() != "tensor(float)" ||
+      !OperandAppliesPerSlice(operand->Shape(), slice_dims)) {
+    return nullptr;
+  }
+
+  return operand;
+}
+
+bool IsSingleConsumerEpilogueCandidate(const Graph& graph, const Node& producer, const Node& consumer,
+                                       const std::string& op_type) {
+  return producer.GetOutputEdgesCount() == 1 &&
+         !graph.NodeProducesGraphOutput(producer) &&
+         graph_utils::IsSupportedOptypeVersionAndDomain(consumer, op_type, {7, 13, 14}) &&
+         consumer.GetExecutionProviderType() == producer.GetExecutionProviderType();
+}
+
+}  // namespace
+
+Status GatherNDFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                 const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto index : order) {
+    auto* node_ptr = graph.GetNode(index);
+    if (!node_ptr)
+      continue;  // node was removed as part of an earlier fusion
+
+    auto& node = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "GatherND", {11, 12, 13}) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    // the fused kernel only handles float data
+    const auto* data_type = node.InputDefs()[0]->Type();
+    if (data_type == nullptr || *data_type != "tensor(float)") {
+      continue;
+    }
+
+    std::vector<int64_t> slice_dims;
+    if (!GetSliceDims(node, slice_dims)) {
+      continue;
+    }
+
+    if (node.GetOutputEdgesCount() != 1 || graph.NodeProducesGraphOutput(node)) {
+      continue;
+    }
+
+    NodeArg* scale_arg = nullptr;
+    NodeArg* bias_arg = nullptr;
+    std::vector<std::reference_wrapper<Node>> fused_nodes{node};
+
+    // the first epilogue node is a Mul (scale) or Add (bias)
+    Node& first = *graph.GetNode(node.OutputNodesBegin()->Index());
+    if (IsSingleConsumerEpilogueCandidate(graph, node, first, "Mul")) {
+      scale_arg = GetEligibleOperand(graph, first, node.OutputDefs()[0]->Name(), slice_dims);
+    } else if (IsSingleConsumerEpilogueCandidate(graph, node, first, "Add")) {
+      bias_arg = GetEligibleOperand(graph, first, node.OutputDefs()[0]->Name(), slice_dims);
+    }
+    if (scale_arg == nullptr && bias_arg == nullptr) {
+      continue;
+    }
+    fused_nodes.push_back(first);
+    Node* tail = &first;
+
+    // a Mul may additionally be followed by an Add, matching the 'x * scale + bias' form
+    if (scale_arg != nullptr && tail->GetOutputEdgesCount() == 1 && !graph.NodeProducesGraphOutput(*tail)) {
+      Node& second = *graph.GetNode(tail->OutputNodesBegin()->Index());
+      if (IsSingleConsumerEpilogueCandidate(graph, *tail, second, "Add")) {
+        bias_arg = GetEligibleOperand(graph, second, tail->OutputDefs()[0]->Name(), slice_dims);
+        if (bias_arg != nullptr) {
+          fused_nodes.push_back(second);
+          tail = &second;
+        }
+      }
+    }
+
+    std::vector<NodeArg*> fused_inputs{node.MutableInputDefs()[0], node.MutableInputDefs()[1]};
+    if (bias_arg != nullptr) {
+      fused_inputs.push_back(scale_arg != nullptr ? scale_arg : &graph.GetOrCreateNodeArg("", nullptr));
+      fused_inputs.push_back(bias_arg);
+    } else {
+      fused_inputs.push_back(scale_arg);
+    }
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("FusedGatherND"),
+                                     "FusedGatherND",
+                                     "fused GatherND with arithmetic epilogue from " + node.Name(),
+                                     fused_inputs, {}, nullptr, kMSDomain);
+    const auto& attrs = node.GetAttributes();
+    const auto batch_dims_attr = attrs.find("batch_dims");
+    if (batch_dims_attr != attrs.end()) {
+      fused_node.AddAttribute("batch_dims", batch_dims_attr->second.i());
+    }
+    fused_node.SetExecutionProviderType(node.GetExecutionProviderType());
+
+    // moves the output definition and edges of the last epilogue node to the fused node and
+    // removes the original nodes
+    graph_utils::FinalizeNodeFusion(graph, fused_nodes, fused_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
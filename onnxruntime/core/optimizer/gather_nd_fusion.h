@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class GatherNDFusion
+
+Folds a Mul and/or Add that directly consumes a GatherND output into a single FusedGatherND
+node that applies the arithmetic during the gather copy itself, saving an extra pass over the
+gathered data. The Mul/Add operand must be a constant initializer that is either a scalar or
+shaped exactly like one gathered slice, so it applies uniformly to every slice.
+*/
+class GatherNDFusion : public GraphTransformer {
+ public:
+  GatherNDFusion(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("GatherNDFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
@@ -18,7 +18,12 @@ Status GraphTransformer::Apply(Graph& graph, bool& modified, const logging::Logg
   // At least currently, some transformers (InsertCastTransformer and MemcpyTransformer) need this to be called
   // after they complete to put the graph back into a valid state for the next transformer.
   if (modified) {
-    status = graph.Resolve();
+    // transformers typically touch a handful of nodes, so limit the type/shape inference pass to
+    // the modified nodes and their downstream cone. Resolve falls back to a full pass when the
+    // changes could not be localized.
+    Graph::ResolveOptions resolve_options;
+    resolve_options.incremental = true;
+    status = graph.Resolve(resolve_options);
   }
 #endif
 
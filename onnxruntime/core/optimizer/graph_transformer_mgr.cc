@@ -25,15 +25,57 @@ common::Status GraphTransformerManager::ApplyTransformers(Graph& graph, Transfor
     return Status::OK();
   }
 
+  const auto& transformer_list = transformers->second;
+
+  // Version of the graph each transformer saw when it last ran. A transformer only needs to run
+  // again if the graph was modified after that point, whether by itself or by another transformer.
+  // This avoids repeated full-graph passes by converged transformers while later steps iterate the
+  // remaining ones to a fixed point, which matters for large graphs.
+  std::vector<uint64_t> last_applied_version(transformer_list.size(), 0);
+  uint64_t graph_version = 1;
+
   for (unsigned step = 0; step < steps_; ++step) {
     bool graph_changed = false;
-    for (const auto& transformer : transformers->second) {
+    for (size_t i = 0; i < transformer_list.size(); ++i) {
+      const auto& transformer = transformer_list[i];
       if (step > 0 && transformer->ShouldOnlyApplyOnce())
         continue;
 
+      if (last_applied_version[i] == graph_version) {
+        continue;
+      }
+
+      // Record the version before applying so that a transformer whose own changes may enable
+      // further matches of itself is run again in the next step.
+      last_applied_version[i] = graph_version;
+
+      const bool is_profiler_enabled = (profiler_ != nullptr) && profiler_->IsEnabled();
+      TimePoint start_time;
+      int nodes_before = 0;
+      if (is_profiler_enabled) {
+        start_time = profiler_->StartTime();
+        nodes_before = graph.NumberOfNodes();
+      }
+
       bool modified = false;
       ORT_RETURN_IF_ERROR(transformer->Apply(graph, modified, logger));
-      graph_changed = graph_changed || modified;
+      if (modified) {
+        ++graph_version;
+        graph_changed = true;
+      }
+
+      if (is_profiler_enabled) {
+        // Record the wall time of this transformer pass together with a node count
+        // diff, so slow startup optimization and fusions that silently stop
+        // matching can be attributed from the trace.
+        profiler_->EndTimeAndRecordEvent(profiling::SESSION_EVENT,
+                                         transformer->Name() + "_pass",
+                                         start_time,
+                                         {{"graph_transformer_step", std::to_string(step)},
+                                          {"modified", modified ? "1" : "0"},
+                                          {"nodes_before", std::to_string(nodes_before)},
+                                          {"nodes_after", std::to_string(graph.NumberOfNodes())}});
+      }
     }
     if (!graph_changed) {
       break;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/common/logging/logging.h"
+#include "core/common/profiler.h"
 #include "core/optimizer/graph_transformer.h"
 #include "core/optimizer/constant_folding.h"
 #include "core/optimizer/rewrite_rule.h"
@@ -29,6 +30,13 @@ class GraphTransformerManager {
   // Apply all transformers registered for the given level on the given graph
   common::Status ApplyTransformers(Graph& graph, TransformerLevel level, const logging::Logger& logger) const;
 
+  // Set the profiler used to record per transformer timing events. The profiler
+  // must outlive this instance. Events are only recorded while the profiler is
+  // enabled.
+  void SetProfiler(profiling::Profiler& profiler) {
+    profiler_ = &profiler;
+  }
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(GraphTransformerManager);
 
@@ -47,5 +55,9 @@ class GraphTransformerManager {
 
   std::unordered_map<TransformerLevel, std::vector<std::unique_ptr<GraphTransformer>>, EnumHashKey> level_to_transformer_map_;
   std::unordered_map<std::string, GraphTransformer*> transformers_info_;
+
+  // Optional profiler to record the wall time and graph impact of each
+  // transformer pass.
+  profiling::Profiler* profiler_{nullptr};
 };
 }  // namespace onnxruntime
@@ -5,6 +5,7 @@
 
 #include "core/mlas/inc/mlas.h"
 #include "core/optimizer/attention_fusion.h"
+#include "core/optimizer/auto_mixed_precision_transformer.h"
 #include "core/optimizer/bias_gelu_fusion.h"
 #include "core/optimizer/bias_softmax_fusion.h"
 #include "core/optimizer/cast_elimination.h"
@@ -17,6 +18,8 @@
 #include "core/optimizer/div_mul_fusion.h"
 #include "core/optimizer/dropout_elimination.h"
 #include "core/optimizer/dynamic_quantize_matmul_fusion.h"
+#include "core/optimizer/elementwise_fusion.h"
+#include "core/optimizer/gather_nd_fusion.h"
 #include "core/optimizer/embed_layer_norm_fusion.h"
 #include "core/optimizer/expand_elimination.h"
 #include "core/optimizer/fast_gelu_fusion.h"
@@ -29,16 +32,19 @@
 #include "core/optimizer/layer_norm_fusion.h"
 #include "core/optimizer/matmul_add_fusion.h"
 #include "core/optimizer/matmul_integer_to_float.h"
+#include "core/optimizer/matmul_intn_weight_quantization.h"
 #include "core/optimizer/matmul_scale_fusion.h"
 #include "core/optimizer/nchwc_transformer.h"
 #include "core/optimizer/nhwc_transformer.h"
 #include "core/optimizer/noop_elimination.h"
 #include "core/optimizer/not_where_fusion.h"
+#include "core/optimizer/pad_fusion.h"
 #include "core/optimizer/relu_clip_fusion.h"
 #include "core/optimizer/reshape_fusion.h"
 #include "core/optimizer/rule_based_graph_transformer.h"
 #include "core/optimizer/skip_layer_norm_fusion.h"
 #include "core/optimizer/slice_elimination.h"
+#include "core/optimizer/spatial_tiling_transformer.h"
 #include "core/optimizer/unsqueeze_elimination.h"
 #include "core/optimizer/qdq_transformer/qdq_propagation.h"
 #include "core/optimizer/qdq_transformer/qdq_s8_to_u8.h"
@@ -74,6 +80,7 @@ std::vector<std::unique_ptr<RewriteRule>> GenerateRewriteRules(
       rules.push_back(std::make_unique<FuseReluClip>());
       rules.push_back(std::make_unique<GemmTransposeFusion>());
       rules.push_back(std::make_unique<NotWhereFusion>());
+      rules.push_back(std::make_unique<PadFusion>());
       rules.push_back(std::make_unique<ConvAddFusion>());
       rules.push_back(std::make_unique<ConvMulFusion>());
       rules.push_back(std::make_unique<ConvBNFusion>());
@@ -130,19 +137,58 @@ std::vector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
     TransformerLevel level,
     const SessionOptions& session_options,
     const IExecutionProvider& execution_provider, /*required by constant folding*/
-    const std::unordered_set<std::string>& rules_and_transformers_to_disable) {
+    const std::unordered_set<std::string>& rules_and_transformers_to_disable,
+    concurrency::ThreadPool* intra_op_thread_pool) {
   std::vector<std::unique_ptr<GraphTransformer>> transformers;
   std::unique_ptr<RuleBasedGraphTransformer> rule_transformer = nullptr;
   bool disable_quant_qdq = session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsDisableQuantQDQ, "0") == "1";
+  int64_t spatial_tiling_tile_count = 0;
+  {
+    const std::string tile_count_str =
+        session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsSpatialTilingTileCount, "0");
+    if (!tile_count_str.empty() && tile_count_str.size() <= 4 &&
+        tile_count_str.find_first_not_of("0123456789") == std::string::npos) {
+      spatial_tiling_tile_count = std::stoll(tile_count_str);
+    }
+  }
 #ifndef DISABLE_CONTRIB_OPS
   bool enable_gelu_approximation = session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableGeluApproximation, "0") == "1";
+  bool enable_auto_mixed_precision =
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableAutoMixedPrecision, "0") == "1";
+  std::unordered_set<std::string> amp_allow_ops;  // additions to the default allow list
+  std::unordered_set<std::string> amp_deny_ops;   // removals from it
+  if (enable_auto_mixed_precision) {
+    auto parse_op_list = [&session_options](const char* config_key, std::unordered_set<std::string>& ops) {
+      const std::string value = session_options.config_options.GetConfigOrDefault(config_key, "");
+      size_t start = 0;
+      while (start <= value.size()) {
+        size_t end = value.find(',', start);
+        if (end == std::string::npos) end = value.size();
+        if (end > start) ops.insert(value.substr(start, end - start));
+        start = end + 1;
+      }
+    };
+    parse_op_list(kOrtSessionOptionsAutoMixedPrecisionAllowOps, amp_allow_ops);
+    parse_op_list(kOrtSessionOptionsAutoMixedPrecisionDenyOps, amp_deny_ops);
+  }
+  int64_t weight_only_quant_bits = 0;
+  {
+    const std::string weight_only_quant_bits_str =
+        session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsWeightOnlyQuantBits, "0");
+    if (weight_only_quant_bits_str == "4" || weight_only_quant_bits_str == "8") {
+      weight_only_quant_bits = weight_only_quant_bits_str == "4" ? 4 : 8;
+    }
+  }
 #endif
 
   switch (level) {
     case TransformerLevel::Level1: {
       // no filtering on execution provider for L1 optimizations as they only use official ONNX operators
       transformers.emplace_back(std::make_unique<CommonSubexpressionElimination>());
-      transformers.emplace_back(std::make_unique<ConstantFolding>(execution_provider, !disable_quant_qdq));
+      transformers.emplace_back(std::make_unique<ConstantFolding>(execution_provider, !disable_quant_qdq,
+                                                                  std::unordered_set<std::string>{},
+                                                                  std::unordered_set<std::string>{},
+                                                                  intra_op_thread_pool));
       transformers.emplace_back(std::make_unique<MatMulAddFusion>());
       transformers.emplace_back(std::make_unique<ReshapeFusion>());
       transformers.emplace_back(std::make_unique<FreeDimensionOverrideTransformer>(
@@ -163,6 +209,8 @@ std::vector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
       const std::unordered_set<std::string> cpu_cuda_rocm_eps = {onnxruntime::kCpuExecutionProvider,
                                                                  onnxruntime::kCudaExecutionProvider,
                                                                  onnxruntime::kRocmExecutionProvider};
+      const std::unordered_set<std::string> cpu_cuda_eps = {onnxruntime::kCpuExecutionProvider,
+                                                            onnxruntime::kCudaExecutionProvider};
       const std::unordered_set<std::string> cpu_cuda_rocm_acl_armnn_eps = {onnxruntime::kCpuExecutionProvider,
                                                                            onnxruntime::kCudaExecutionProvider,
                                                                            onnxruntime::kRocmExecutionProvider,
@@ -197,6 +245,13 @@ std::vector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
 
       transformers.emplace_back(std::make_unique<MatMulScaleFusion>(cpu_cuda_rocm_eps));
 
+      // runs before ElementwiseFusion so the gather picks up its own Mul/Add epilogue
+      transformers.emplace_back(std::make_unique<GatherNDFusion>(cpu_ep));
+
+      // run after the pattern-specific fusions above so they get first pick of the
+      // elementwise nodes they recognize
+      transformers.emplace_back(std::make_unique<ElementwiseFusion>(cpu_cuda_eps));
+
       // GeluApproximation has side effects which may change results. It needs to be manually enabled,
       // or alternatively the model can be updated offline using a model conversion script
       //   e.g. fusion_gelu_approximation function used by onnxruntime/python/tools/transformers/onnx_model_bert.py
@@ -204,7 +259,25 @@ std::vector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
         transformers.emplace_back(std::make_unique<GeluApproximation>(cpu_cuda_rocm_eps));
       }
 
+      // Like GeluApproximation, mixed precision conversion changes results and must be manually
+      // enabled. Runs after the fusions above so the allow list sees the fused contrib ops.
+      if (enable_auto_mixed_precision) {
+        const std::unordered_set<std::string> cuda_ep = {onnxruntime::kCudaExecutionProvider};
+        transformers.emplace_back(std::make_unique<AutoMixedPrecisionTransformer>(amp_allow_ops, amp_deny_ops, cuda_ep));
+      }
+
+      // Like GeluApproximation, weight only quantization changes results and must be manually enabled.
+      if (weight_only_quant_bits != 0) {
+        transformers.emplace_back(std::make_unique<MatMulIntNWeightQuantization>(weight_only_quant_bits, cpu_ep));
+      }
+
 #endif
+      // Spatial tiling keeps results unchanged but the right band count depends on the
+      // model and the target's caches, so it also must be manually enabled. Runs at the
+      // end of Level2 so the NCHWc layout transformer sees the per-band convolutions.
+      if (spatial_tiling_tile_count > 1) {
+        transformers.emplace_back(std::make_unique<SpatialTilingTransformer>(spatial_tiling_tile_count, cpu_ep));
+      }
     } break;
 
     case TransformerLevel::Level3: {
@@ -0,0 +1,148 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/matmul_intn_weight_quantization.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/optimizer/initializer.h"
+#include "core/optimizer/utils.h"
+#include "core/graph/graph_utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace onnxruntime::common;
+namespace onnxruntime {
+
+// Weights smaller than this are left in float; the bandwidth win would not cover the
+// dequantization overhead and small layers are the most sensitive to rounding.
+constexpr int64_t kMinWeightElements = 16 * 1024;
+
+// Rows of K covered by one scale. Matches the group sizes commonly used by weight only
+// quantization tooling and keeps the per-group dequantized block cache sized in the kernel.
+constexpr int64_t kGroupSize = 64;
+
+static bool IsCandidateNode(const Node& node, const Graph& graph,
+                            const std::unordered_set<std::string>& compatible_providers,
+                            const TensorProto*& weight_proto) {
+  if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "MatMul", {1, 9, 13}) ||
+      !graph_utils::IsSupportedProvider(node, compatible_providers)) {
+    return false;
+  }
+
+  const NodeArg* input_a = node.InputDefs()[0];
+  if (input_a->Type() == nullptr || *input_a->Type() != "tensor(float)") {
+    return false;
+  }
+
+  weight_proto = graph_utils::GetConstantInitializer(graph, node.InputDefs()[1]->Name());
+  if (weight_proto == nullptr ||
+      weight_proto->data_type() != TensorProto_DataType_FLOAT ||
+      weight_proto->dims_size() != 2) {
+    return false;
+  }
+
+  return weight_proto->dims(0) * weight_proto->dims(1) >= kMinWeightElements;
+}
+
+Status MatMulIntNWeightQuantization::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                               const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  int count = 0;
+  for (auto node_index : node_topology_list) {
+    auto* p_node = graph.GetNode(node_index);
+    if (p_node == nullptr) continue;  // node was removed by an earlier fusion
+
+    Node& node = *p_node;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    const TensorProto* weight_proto = nullptr;
+    if (!IsCandidateNode(node, graph, GetCompatibleExecutionProviders(), weight_proto)) {
+      continue;
+    }
+
+    const int64_t K = weight_proto->dims(0);
+    const int64_t N = weight_proto->dims(1);
+    const int64_t group_count = (K + kGroupSize - 1) / kGroupSize;
+    const int64_t packed_k = bits_ == 4 ? (K + 1) / 2 : K;
+    const int64_t q_max = bits_ == 4 ? 7 : 127;
+    const uint8_t midpoint = bits_ == 4 ? 8 : 128;
+
+    Initializer weight{*weight_proto, graph.ModelPath()};
+    const float* weight_data = weight.data<float>();
+
+    // Symmetric per-group per-column quantization. The zero point is the range midpoint so the
+    // kernel's default is used and no zero_points initializer needs to be stored.
+    std::vector<float> scales(group_count * N);
+    for (int64_t g = 0; g < group_count; ++g) {
+      const int64_t k_begin = g * kGroupSize;
+      const int64_t k_end = std::min(k_begin + kGroupSize, K);
+      for (int64_t n = 0; n < N; ++n) {
+        float amax = 0.f;
+        for (int64_t k = k_begin; k < k_end; ++k) {
+          amax = std::max(amax, std::abs(weight_data[k * N + n]));
+        }
+        scales[g * N + n] = amax > 0.f ? amax / static_cast<float>(q_max) : 1.f;
+      }
+    }
+
+    std::vector<uint8_t> packed(packed_k * N, 0);
+    for (int64_t k = 0; k < K; ++k) {
+      const float* scale_row = scales.data() + (k / kGroupSize) * N;
+      for (int64_t n = 0; n < N; ++n) {
+        const float q_float = std::round(weight_data[k * N + n] / scale_row[n]);
+        const int32_t q = std::min(static_cast<int32_t>(q_max),
+                                   std::max(-static_cast<int32_t>(q_max), static_cast<int32_t>(q_float))) +
+                          midpoint;
+        if (bits_ == 4) {
+          packed[(k >> 1) * N + n] |= static_cast<uint8_t>(q << ((k & 1) ? 4 : 0));
+        } else {
+          packed[k * N + n] = static_cast<uint8_t>(q);
+        }
+      }
+    }
+
+    const NodeArg* weight_arg = node.InputDefs()[1];
+
+    TensorProto packed_proto;
+    packed_proto.set_name(graph.GenerateNodeArgName(weight_arg->Name() + "_quant"));
+    packed_proto.set_data_type(TensorProto_DataType_UINT8);
+    packed_proto.add_dims(packed_k);
+    packed_proto.add_dims(N);
+    packed_proto.set_raw_data(packed.data(), packed.size());
+    NodeArg& packed_arg = graph_utils::AddInitializer(graph, packed_proto);
+
+    TensorProto scales_proto;
+    scales_proto.set_name(graph.GenerateNodeArgName(weight_arg->Name() + "_scales"));
+    scales_proto.set_data_type(TensorProto_DataType_FLOAT);
+    scales_proto.add_dims(group_count);
+    scales_proto.add_dims(N);
+    scales_proto.set_raw_data(scales.data(), scales.size() * sizeof(float));
+    NodeArg& scales_arg = graph_utils::AddInitializer(graph, scales_proto);
+
+    Node& qmatmul = graph.AddNode(graph.GenerateNodeName(node.Name() + "_intn"), "MatMulIntNWeight",
+                                  "weight only quantized MatMul",
+                                  {node.MutableInputDefs()[0], &packed_arg, &scales_arg},
+                                  node.MutableOutputDefs(), nullptr, kMSDomain);
+    qmatmul.AddAttribute("K", K);
+    qmatmul.AddAttribute("bits", bits_);
+    qmatmul.AddAttribute("group_size", kGroupSize);
+    qmatmul.SetExecutionProviderType(node.GetExecutionProviderType());
+
+    graph_utils::RemoveNodeOutputEdges(graph, node);
+    graph.RemoveNode(node.Index());
+
+    count++;
+  }
+
+  if (count > 0) {
+    modified = true;
+    LOGS(logger, INFO) << "Total weight only quantized MatMul node count: " << count;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
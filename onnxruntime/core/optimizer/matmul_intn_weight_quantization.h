@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class MatMulIntNWeightQuantization
+
+Rewrite graph to replace a float MatMul whose second input is a large constant initializer by a
+MatMulIntNWeight node with the weight quantized to 4 or 8 bit unsigned integers using symmetric
+per-group scales. This shrinks the weight bytes read per token which helps memory bound
+decoder workloads, at the cost of a small accuracy change, so the transformer is opt-in.
+*/
+class MatMulIntNWeightQuantization : public GraphTransformer {
+ public:
+  MatMulIntNWeightQuantization(int64_t bits,
+                               const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("MatMulIntNWeightQuantization", compatible_execution_providers), bits_(bits) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+ private:
+  int64_t bits_;
+};
+
+}  // namespace onnxruntime
@@ -169,6 +169,155 @@ static Node* ReorderCastAndTranspose(Graph& graph, Node* cast,
   return &new_transpose;
 }
 
+/* ReorderReshapeAndTranspose:
+*  Interchange Reshape and Transpose nodes in the graph and return the new Transpose node if possible else nullptr.
+*
+*  This only applies when the Reshape regroups the batch dimensions and keeps the last two
+*  dimensions of the Transpose output unchanged. In that case transposing the last two
+*  dimensions commutes with the Reshape, so the pattern
+*                              |
+*                         _____|______
+*                         |Transpose |
+*                         |__________|
+*                              |
+*                              |
+*                         _____V______
+*                         | Reshape  |
+*                         |__________|
+*                              |
+*                              V
+*
+*  is rewritten (with the last two entries of the Reshape target shape swapped) to
+*                              |
+*                         _____|______
+*                         | Reshape  |
+*                         |__________|
+*                              |
+*                              |
+*                         _____V______
+*                         | Transpose|
+*                         |__________|
+*                              |
+*                              V
+*/
+static Node* ReorderReshapeAndTranspose(Graph& graph, Node* reshape,
+                                        std::unordered_map<NodeArg*, size_t>& consumer_count,
+                                        std::deque<onnxruntime::NodeIndex>& removed_nodes) {
+  ORT_ENFORCE(reshape != nullptr);
+  if (graph.NodeProducesGraphOutput(*reshape)) {
+    return nullptr;
+  }
+
+  auto transpose = GetTransposeNodeFromOutput(graph, *reshape->MutableInputDefs()[0]);
+  if (transpose == nullptr) {
+    return nullptr;
+  }
+
+  NodeArg* transpose_input = transpose->MutableInputDefs()[0];
+  const TensorShapeProto* transpose_input_shape = transpose_input->Shape();
+  if (transpose_input_shape == nullptr) {
+    return nullptr;
+  }
+
+  const int rank = transpose_input_shape->dim_size();
+  if (rank < 2 ||
+      !transpose_input_shape->dim(rank - 2).has_dim_value() ||
+      !transpose_input_shape->dim(rank - 1).has_dim_value()) {
+    return nullptr;
+  }
+
+  const int64_t m = transpose_input_shape->dim(rank - 2).dim_value();
+  const int64_t k = transpose_input_shape->dim(rank - 1).dim_value();
+  if (m <= 0 || k <= 0) {
+    return nullptr;
+  }
+
+  // The target shape must be a constant so the swapped shape can be computed here.
+  const ONNX_NAMESPACE::TensorProto* shape_tensor =
+      graph_utils::GetConstantInitializer(graph, reshape->InputDefs()[1]->Name());
+  if (shape_tensor == nullptr ||
+      shape_tensor->data_type() != ONNX_NAMESPACE::TensorProto_DataType_INT64 ||
+      shape_tensor->dims_size() != 1 || shape_tensor->dims(0) < 2) {
+    return nullptr;
+  }
+
+  Initializer shape_data(*shape_tensor, graph.ModelPath());
+  const int64_t* target_shape = shape_data.data<int64_t>();
+  const int64_t target_rank = shape_data.size();
+
+  // After the Transpose the last two dimensions are (k, m). The Reshape must keep them, so only
+  // the batch dimensions are regrouped and the Transpose can be moved in front of the Reshape.
+  if (target_shape[target_rank - 2] != k || target_shape[target_rank - 1] != m) {
+    return nullptr;
+  }
+
+  // A zero entry copies the corresponding input dimension, which is only safe for batch
+  // dimensions the Transpose leaves in place.
+  for (int64_t i = 0; i < target_rank - 2; i++) {
+    if (target_shape[i] == 0 && i >= rank - 2) {
+      return nullptr;
+    }
+  }
+
+  ONNX_NAMESPACE::TensorProto new_shape_tensor;
+  new_shape_tensor.set_name(graph.GenerateNodeArgName(reshape->InputDefs()[1]->Name() + "_transformed"));
+  new_shape_tensor.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_INT64);
+  new_shape_tensor.add_dims(target_rank);
+  for (int64_t i = 0; i < target_rank; i++) {
+    new_shape_tensor.add_int64_data(target_shape[i]);
+  }
+  new_shape_tensor.set_int64_data(static_cast<int>(target_rank - 2), m);
+  new_shape_tensor.set_int64_data(static_cast<int>(target_rank - 1), k);
+  NodeArg& new_shape_arg = graph_utils::AddInitializer(graph, new_shape_tensor);
+
+  // The output of the new Reshape is the original Reshape output with the last two dimensions
+  // swapped back, since the Transpose now runs after the Reshape.
+  NodeArg* reshape_output = reshape->MutableOutputDefs()[0];
+  auto new_reshape_output_type_proto = *reshape_output->TypeAsProto();
+  if (new_reshape_output_type_proto.tensor_type().has_shape() &&
+      new_reshape_output_type_proto.tensor_type().shape().dim_size() == target_rank) {
+    new_reshape_output_type_proto.mutable_tensor_type()->mutable_shape()->mutable_dim()->SwapElements(
+        static_cast<int>(target_rank - 2), static_cast<int>(target_rank - 1));
+  }
+  auto& new_reshape_output = graph.GetOrCreateNodeArg(reshape_output->Name() + "_transformed", &new_reshape_output_type_proto);
+
+  const std::vector<NodeArg*> new_reshape_input_defs{transpose_input, &new_shape_arg};
+  const std::vector<NodeArg*> new_reshape_output_defs{&new_reshape_output};
+  const std::vector<NodeArg*> new_transpose_input_defs = {&new_reshape_output};
+  const std::vector<NodeArg*> new_transpose_output_defs = {reshape_output};
+
+  Node& new_reshape = graph.AddNode(graph.GenerateNodeName(reshape->Name() + "_transformed"),
+                                    reshape->OpType(),
+                                    "Created a new Reshape node to interchange Reshape and Transpose nodes",
+                                    new_reshape_input_defs,
+                                    new_reshape_output_defs,
+                                    &reshape->GetAttributes(),
+                                    reshape->Domain());
+  new_reshape.SetExecutionProviderType(reshape->GetExecutionProviderType());
+
+  std::vector<int64_t> perms(static_cast<size_t>(target_rank));
+  std::iota(perms.begin(), perms.end(), 0);
+  std::swap(perms[static_cast<size_t>(target_rank - 2)], perms[static_cast<size_t>(target_rank - 1)]);
+
+  Node& new_transpose = graph.AddNode(graph.GenerateNodeName(transpose->Name() + "_transformed"),
+                                      transpose->OpType(),
+                                      "Created a new Transpose node to interchange Reshape and Transpose nodes",
+                                      new_transpose_input_defs,
+                                      new_transpose_output_defs,
+                                      nullptr,
+                                      transpose->Domain());
+  new_transpose.AddAttribute("perm", perms);
+  new_transpose.SetExecutionProviderType(transpose->GetExecutionProviderType());
+
+  size_t consumers = UpdateConsumerCount(graph, transpose->MutableOutputDefs()[0], consumer_count);
+  graph_utils::RemoveNodeOutputEdges(graph, *reshape);
+  graph.RemoveNode(reshape->Index());
+  if (consumers == 0) {
+    removed_nodes.push_front(transpose->Index());
+  }
+  return &new_transpose;
+}
+
 // Check whether the element_type is an allowed FusedMatMul data type or not.
 static bool IsAllowedFusedMatMulDataType(ONNX_NAMESPACE::TensorProto_DataType element_type) {
   return element_type == ONNX_NAMESPACE::TensorProto_DataType_FLOAT ||
@@ -266,6 +415,12 @@ Case II: The output of Tanspose feeds Cast and the output from the Cast feeds Ma
                                                   |
                                                   V
 
+Case III: The output of Transpose feeds a Reshape that only regroups the batch dimensions and the
+   Reshape output feeds MatMul. The Reshape is moved in front of the Transpose (with the last two
+   entries of its target shape swapped) and the Transpose is then fused as in Case I, e.g.
+
+      input0 -> Transpose -> Reshape -> MatMul       becomes       input0 -> Reshape -> FusedMatMul
+
 ********************************************************************************************************************/
 
 Status MatmulTransposeFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
@@ -303,6 +458,8 @@ Status MatmulTransposeFusion::ApplyImpl(Graph& graph, bool& modified, int graph_
       Node* left_node = graph.GetMutableProducerNode(left_input->Name());
       if (left_node && left_node->OpType() == "Cast") {
         left = ReorderCastAndTranspose(graph, left_node, consumer_count, removed_nodes);
+      } else if (left_node && graph_utils::IsSupportedOptypeVersionAndDomain(*left_node, "Reshape", {5, 13, 14})) {
+        left = ReorderReshapeAndTranspose(graph, left_node, consumer_count, removed_nodes);
       }
     }
 
@@ -310,6 +467,8 @@ Status MatmulTransposeFusion::ApplyImpl(Graph& graph, bool& modified, int graph_
       Node* right_node = graph.GetMutableProducerNode(right_input->Name());
       if (right_node && right_node->OpType() == "Cast") {
         right = ReorderCastAndTranspose(graph, right_node, consumer_count, removed_nodes);
+      } else if (right_node && graph_utils::IsSupportedOptypeVersionAndDomain(*right_node, "Reshape", {5, 13, 14})) {
+        right = ReorderReshapeAndTranspose(graph, right_node, consumer_count, removed_nodes);
       }
     }
 
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include <deque>
+#include <unordered_set>
 #include "core/graph/graph_utils.h"
 #include "core/optimizer/initializer.h"
 #include "core/optimizer/nchwc_transformer.h"
@@ -15,6 +16,7 @@ class NchwcTransformerImpl {
  public:
   NchwcTransformerImpl(Graph& graph) noexcept : graph_(graph) {}
 
+  void ComputeLayoutDemand(const GraphViewer& graph_viewer);
   void Transform(Node& node);
   void Finalize(bool& modified);
 
@@ -111,7 +113,10 @@ class NchwcTransformerImpl {
   size_t RemoveOutputEdges(Node& node);
   void CreateNchwcArgument(Node& node, Node& nchwc_node, int64_t channels, const NchwcArgument::Shape& shape);
   void FuseNchwcArgument(Node& node, const NchwcArgument& nchwc_arg);
-  void InsertReorderInput(Node& node);
+  void InsertReorderInput(Node& node, size_t input_index);
+
+  bool ConvDemandsNchwcInput(const Node& node) const;
+  bool PoolDemandsNchwcInput(const Node& node) const;
 
   void ConvPoolShapeInference(const Node& node,
                               const NchwcArgument::Shape& input_shape,
@@ -142,6 +147,12 @@ class NchwcTransformerImpl {
   // multiple nodes can share the NCHWc input.
   std::unordered_map<NodeArg*, NodeArg*> reorder_inputs_;
 
+  // Stores the set of NodeArgs that some downstream node wants to consume in
+  // NCHWc format. Computed before any nodes are transformed, so that layout
+  // decisions for nodes with a mix of NCHW and NCHWc inputs can consider the
+  // rest of the graph instead of only the producing edges.
+  std::unordered_set<const NodeArg*> nchwc_demanded_args_;
+
   // Stores a mapping of NodeArg filters that have already been reordered, so
   // multiple nodes can share the NCHWc filter.
   std::unordered_map<NodeArg*, NodeArg*> filters_OIHWBo_;
@@ -202,9 +213,9 @@ void NchwcTransformerImpl::FuseNchwcArgument(Node& node, const NchwcArgument& nc
       std::make_unique<NchwcArgument>(nchwc_node, output_nchwc_arg, original_uses, nchwc_arg.channels_, nchwc_arg.shape_);
 }
 
-void NchwcTransformerImpl::InsertReorderInput(Node& node) {
+void NchwcTransformerImpl::InsertReorderInput(Node& node, size_t input_index) {
   auto& input_defs = node.MutableInputDefs();
-  auto* input_original_arg = input_defs[0];
+  auto* input_original_arg = input_defs[input_index];
 
   auto it = reorder_inputs_.find(input_original_arg);
   if (it == reorder_inputs_.end()) {
@@ -219,7 +230,7 @@ void NchwcTransformerImpl::InsertReorderInput(Node& node) {
                                               nullptr,
                                               kMSNchwcDomain);
     reorder_input_node.SetExecutionProviderType(kCpuExecutionProvider);
-    input_defs[0] = input_nchwc_arg;
+    input_defs[input_index] = input_nchwc_arg;
 
     // Attempt to fuse the ReorderInput with a previous Transpose of NHWC->NCHW.
     // If the last known node to transpose from NHWC is the same as this input
@@ -235,7 +246,127 @@ void NchwcTransformerImpl::InsertReorderInput(Node& node) {
     }
 
   } else {
-    input_defs[0] = it->second;
+    input_defs[input_index] = it->second;
+  }
+}
+
+bool NchwcTransformerImpl::ConvDemandsNchwcInput(const Node& node) const {
+  // Approximate the eligibility checks done by TransformConv to predict
+  // whether the convolution is likely to be converted to NCHWc format with a
+  // reordered input. Convolutions with fewer input channels than the NCHWc
+  // block size consume the NCHW input buffer directly.
+  const auto& input_defs = node.InputDefs();
+  const ONNX_NAMESPACE::TensorProto* conv_W_tensor_proto = nullptr;
+  if (input_defs.size() < 2 ||
+      !graph_utils::NodeArgIsConstant(graph_, *input_defs[1]) ||
+      !graph_.GetInitializedTensor(input_defs[1]->Name(), conv_W_tensor_proto) ||
+      (conv_W_tensor_proto->data_type() != ONNX_NAMESPACE::TensorProto_DataType_FLOAT) ||
+      (conv_W_tensor_proto->dims_size() != 4)) {
+    return false;
+  }
+
+  const int64_t output_channels = conv_W_tensor_proto->dims(0);
+  const int64_t input_channels = conv_W_tensor_proto->dims(1);
+
+  int64_t group_count;
+  const auto* group_attr = graph_utils::GetNodeAttribute(node, "group");
+  if (group_attr != nullptr && utils::HasInt(*group_attr)) {
+    group_count = group_attr->i();
+  } else {
+    group_count = 1;
+  }
+
+  const size_t nchwc_block_size = MlasNchwcGetBlockSize();
+  constexpr int64_t channel_alignment = 4;
+
+  if (group_count > 1) {
+    if ((output_channels % channel_alignment) != 0) {
+      return false;
+    }
+    if (input_channels == 1 && output_channels == group_count) {
+      // Depthwise convolution.
+      return true;
+    }
+    return ((input_channels % nchwc_block_size) == 0) &&
+           ((output_channels % group_count) == 0) &&
+           (((output_channels / group_count) % nchwc_block_size) == 0);
+  }
+
+  return (static_cast<size_t>(input_channels) >= nchwc_block_size) &&
+         ((input_channels % channel_alignment) == 0);
+}
+
+bool NchwcTransformerImpl::PoolDemandsNchwcInput(const Node& node) const {
+  // Mirror the channel alignment test done by TransformPool.
+  const auto& input_defs = node.InputDefs();
+  const auto* input_type = input_defs[0]->TypeAsProto();
+  if ((input_type == nullptr) || (input_type->tensor_type().elem_type() != TensorProto_DataType_FLOAT)) {
+    return false;
+  }
+  const auto* input_shape = input_defs[0]->Shape();
+  if ((input_shape == nullptr) || (input_shape->dim_size() != 4)) {
+    return false;
+  }
+  auto& channels_dim = input_shape->dim(1);
+  if (!utils::HasDimValue(channels_dim)) {
+    return false;
+  }
+  const int64_t channels = channels_dim.dim_value();
+  return (channels % MlasNchwcGetBlockSize()) == 0;
+}
+
+void NchwcTransformerImpl::ComputeLayoutDemand(const GraphViewer& graph_viewer) {
+  // Walk the graph in reverse topological order and record which tensors are
+  // wanted in NCHWc format. Convolution and pooling nodes that are likely to
+  // be converted to NCHWc form demand their input directly, while elementwise
+  // and shape preserving nodes that this transformer understands propagate
+  // the demand from their outputs to their inputs.
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+  for (auto index_it = node_topology_list.rbegin(); index_it != node_topology_list.rend(); ++index_it) {
+    const Node& node = *graph_viewer.GetNode(*index_it);
+    if (node.GetExecutionProviderType() != kCpuExecutionProvider) {
+      continue;
+    }
+
+    if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Conv", {1, 11}) ||
+        graph_utils::IsSupportedOptypeVersionAndDomain(node, "FusedConv", {1}, kMSDomain)) {
+      if (ConvDemandsNchwcInput(node)) {
+        nchwc_demanded_args_.insert(node.InputDefs()[0]);
+      }
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "MaxPool", {1, 8, 10, 11, 12}) ||
+               graph_utils::IsSupportedOptypeVersionAndDomain(node, "AveragePool", {1, 7, 10, 11}) ||
+               graph_utils::IsSupportedOptypeVersionAndDomain(node, "GlobalMaxPool", {1}) ||
+               graph_utils::IsSupportedOptypeVersionAndDomain(node, "GlobalAveragePool", {1})) {
+      if (PoolDemandsNchwcInput(node)) {
+        nchwc_demanded_args_.insert(node.InputDefs()[0]);
+      }
+    } else {
+      bool any_output_demanded = false;
+      for (const auto* output_def : node.OutputDefs()) {
+        if (nchwc_demanded_args_.count(output_def) != 0) {
+          any_output_demanded = true;
+          break;
+        }
+      }
+      if (!any_output_demanded) {
+        continue;
+      }
+      if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Add", {7, 13, 14}) ||
+          graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sum", {6, 8, 13}) ||
+          graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7, 13, 14}) ||
+          graph_utils::IsSupportedOptypeVersionAndDomain(node, "Concat", {4, 11, 13})) {
+        for (const auto* input_def : node.InputDefs()) {
+          nchwc_demanded_args_.insert(input_def);
+        }
+      } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Relu", {6, 13, 14}) ||
+                 graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sigmoid", {6, 13}) ||
+                 graph_utils::IsSupportedOptypeVersionAndDomain(node, "Tanh", {6, 13}) ||
+                 graph_utils::IsSupportedOptypeVersionAndDomain(node, "BatchNormalization", {7, 9, 14}) ||
+                 graph_utils::IsSupportedOptypeVersionAndDomain(node, "Upsample", {9, 13}) ||
+                 graph_utils::IsSupportedOptypeVersionAndDomain(node, "Resize", {10, 11, 13})) {
+        nchwc_demanded_args_.insert(node.InputDefs()[0]);
+      }
+    }
   }
 }
 
@@ -491,7 +622,7 @@ void NchwcTransformerImpl::TransformConv(Node& node) {
   if (do_reorder_input) {
     auto* nchwc_input = LookupNchwcArgument(input_defs[0]);
     if (nchwc_input == nullptr) {
-      InsertReorderInput(nchwc_node);
+      InsertReorderInput(nchwc_node, 0);
     } else {
       nchwc_node.MutableInputDefs()[0] = nchwc_input->nchwc_arg_;
       nchwc_input->remaining_original_uses_--;
@@ -546,7 +677,7 @@ void NchwcTransformerImpl::TransformPool(Node& node) {
 
   auto* nchwc_input = LookupNchwcArgument(input_defs[0]);
   if (nchwc_input == nullptr) {
-    InsertReorderInput(nchwc_node);
+    InsertReorderInput(nchwc_node, 0);
   } else {
     nchwc_node.MutableInputDefs()[0] = nchwc_input->nchwc_arg_;
     nchwc_input->remaining_original_uses_--;
@@ -594,17 +725,76 @@ void NchwcTransformerImpl::TransformBinary(Node& node, bool add_node) {
   auto& input_defs = node.MutableInputDefs();
   auto& output_defs = node.MutableOutputDefs();
 
-  // Verify that all of the inputs to this operator are from NCHWc outputs.
+  // Find the inputs to this operator that are from NCHWc outputs.
   std::vector<NchwcArgument*> nchwc_inputs;
   size_t input_defs_count = input_defs.size();
+  size_t nchwc_inputs_count = 0;
   nchwc_inputs.reserve(input_defs_count);
   for (size_t i = 0; i < input_defs_count; i++) {
     auto* nchwc_input = LookupNchwcArgument(input_defs[i]);
-    if (nchwc_input == nullptr) {
-      return;
+    if (nchwc_input != nullptr) {
+      nchwc_inputs_count++;
     }
     nchwc_inputs.push_back(nchwc_input);
   }
+  if (nchwc_inputs_count == 0) {
+    return;
+  }
+
+  if (nchwc_inputs_count != input_defs_count) {
+    // Only some of the inputs are NCHWc outputs. Reordering the remaining
+    // NCHW inputs here is profitable only if a downstream node wants the
+    // output of this node in NCHWc format; otherwise reordering the NCHWc
+    // inputs back to NCHW is at least as cheap. Restrict to the two input
+    // case with identical shapes (no broadcasting) and block aligned channels
+    // so that the operation computes the same values on the reordered data.
+    if ((input_defs_count != 2) || (nchwc_inputs_count != 1) ||
+        (nchwc_demanded_args_.count(output_defs[0]) == 0)) {
+      return;
+    }
+
+    const size_t nchwc_n = (nchwc_inputs[0] != nullptr) ? 0 : 1;
+    auto* nchwc_input = nchwc_inputs[nchwc_n];
+    const size_t nchwc_block_size = MlasNchwcGetBlockSize();
+    if ((nchwc_input->channels_ % nchwc_block_size) != 0) {
+      return;
+    }
+
+    const auto* other_type = input_defs[nchwc_n ^ 1]->TypeAsProto();
+    if ((other_type == nullptr) || (other_type->tensor_type().elem_type() != TensorProto_DataType_FLOAT)) {
+      return;
+    }
+
+    auto* input_0_shape = input_defs[0]->Shape();
+    auto* input_1_shape = input_defs[1]->Shape();
+    if ((input_0_shape == nullptr) || (input_0_shape->dim_size() != kNchwcDims) ||
+        (input_1_shape == nullptr) || (input_1_shape->dim_size() != kNchwcDims)) {
+      return;
+    }
+    for (int i = 0; i < kNchwcDims; i++) {
+      auto& input_0_dim = input_0_shape->dim(i);
+      auto& input_1_dim = input_1_shape->dim(i);
+      if (!utils::HasDimValue(input_0_dim) ||
+          !utils::HasDimValue(input_1_dim) ||
+          (input_0_dim.dim_value() <= 0) ||
+          (input_0_dim.dim_value() != input_1_dim.dim_value())) {
+        if (!utils::HasDimParam(input_0_dim) ||
+            !utils::HasDimParam(input_1_dim) ||
+            (input_0_dim.dim_param() != input_1_dim.dim_param())) {
+          return;
+        }
+      }
+    }
+
+    // Use the NCHWc argument directly and reorder the NCHW input, which keeps
+    // the downstream consumers of this node in NCHWc format.
+    input_defs[nchwc_n] = nchwc_input->nchwc_arg_;
+    nchwc_input->remaining_original_uses_--;
+    InsertReorderInput(node, nchwc_n ^ 1);
+
+    CreateNchwcArgument(node, node, nchwc_input->channels_, nchwc_input->shape_);
+    return;
+  }
 
   auto* nchwc_input_0 = nchwc_inputs[0];
   const int64_t channels = nchwc_inputs[0]->channels_;
@@ -1179,6 +1369,26 @@ void NchwcTransformerImpl::Transform(Node& node) {
       // Convert these pooling types only if the input is already in NCHWc format.
       TransformPool(node);
     }
+  } else {
+    // Nodes with a mix of NCHWc and NCHW inputs still have input edges from
+    // the NCHW producers, so the zero input edge count hint above does not
+    // catch them. Test whether any input is a NCHWc output before doing the
+    // op type checks.
+    bool any_nchwc_input = false;
+    for (auto* input_def : node.MutableInputDefs()) {
+      if (nchwc_args_.find(input_def) != nchwc_args_.end()) {
+        any_nchwc_input = true;
+        break;
+      }
+    }
+    if (any_nchwc_input) {
+      if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Add", {7, 13, 14}) ||
+          graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sum", {6, 8, 13})) {
+        TransformBinary(node, true);
+      } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7, 13, 14})) {
+        TransformBinary(node, false);
+      }
+    }
   }
 
   // The node may not match any of the checks above or may not have been
@@ -1221,6 +1431,8 @@ Status NchwcTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level
   NchwcTransformerImpl impl(graph);
   GraphViewer graph_viewer(graph);
 
+  impl.ComputeLayoutDemand(graph_viewer);
+
   for (auto index : graph_viewer.GetNodesInTopologicalOrder()) {
     auto& node = *graph.GetNode(index);
     ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
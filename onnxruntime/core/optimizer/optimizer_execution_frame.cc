@@ -125,6 +125,16 @@ OptimizerExecutionFrame::OptimizerExecutionFrame(const Info& info,
   Init(std::vector<int>(), std::vector<OrtValue>(), info.GetInitializers(), info.GetSparseInitializerLookupFunc(), fetches);
 }
 
+OptimizerExecutionFrame::OptimizerExecutionFrame(const Info& info,
+                                                 const std::vector<int>& feed_mlvalue_idxs,
+                                                 const std::vector<OrtValue>& feeds,
+                                                 const std::vector<int>& fetch_mlvalue_idxs,
+                                                 const std::vector<OrtValue>& fetches)
+    : IExecutionFrame(info.GetMLValueNameIdxMap(), info.GetNodeIndexInfo(), fetch_mlvalue_idxs),
+      info_(info) {
+  Init(feed_mlvalue_idxs, feeds, info.GetInitializers(), info.GetSparseInitializerLookupFunc(), fetches);
+}
+
 AllocatorPtr OptimizerExecutionFrame::GetAllocatorImpl(const OrtMemoryInfo& info) const {
   return info_.GetAllocator(info);
 }
@@ -91,6 +91,15 @@ class OptimizerExecutionFrame final : public IExecutionFrame {
                           const std::vector<int>& fetch_mlvalue_idxs,
                           const std::vector<OrtValue>& fetches = {});
 
+  // Variant that takes per-execution feeds so the same Info can be reused
+  // across calls with different input values (e.g. by the eager-mode
+  // dispatch cache) instead of baking inputs into Info as initializers.
+  OptimizerExecutionFrame(const Info& info,
+                          const std::vector<int>& feed_mlvalue_idxs,
+                          const std::vector<OrtValue>& feeds,
+                          const std::vector<int>& fetch_mlvalue_idxs,
+                          const std::vector<OrtValue>& fetches = {});
+
   ~OptimizerExecutionFrame() override = default;
 
  private:
@@ -0,0 +1,141 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/pad_fusion.h"
+
+#include <algorithm>
+
+#include "core/graph/graph.h"
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/initializer.h"
+
+namespace onnxruntime {
+
+namespace {
+
+// Reads the padding amounts of a Pad node if they are statically known and the padding inserts
+// zeros. Handles both the attribute-based opset 2 form and the input-based opset 11+ form.
+bool GetZeroConstantPads(const Graph& graph, const Node& node, std::vector<int64_t>& pads) {
+  const auto* mode = graph_utils::GetNodeAttribute(node, "mode");
+  if (mode != nullptr && mode->s() != "constant") {
+    return false;
+  }
+
+  if (graph_utils::MatchesOpSinceVersion(node, {2})) {
+    // For opset 2 the pads and the fill value are provided as node attributes.
+    if (!graph_utils::GetRepeatedNodeAttributeValues(node, "pads", pads)) {
+      return false;
+    }
+
+    const auto* value = graph_utils::GetNodeAttribute(node, "value");
+    if (value != nullptr && value->f() != 0.f) {
+      return false;
+    }
+  } else {
+    // For opset >= 11 the pads and the fill value are provided as node inputs, which have to be
+    // constant initializers for the padding to be known here.
+    const auto& input_defs = node.InputDefs();
+    const ONNX_NAMESPACE::TensorProto* pads_init =
+        (input_defs.size() > 1) ? graph_utils::GetConstantInitializer(graph, input_defs[1]->Name()) : nullptr;
+    if (pads_init == nullptr || pads_init->data_type() != ONNX_NAMESPACE::TensorProto::INT64) {
+      return false;
+    }
+
+    Initializer pads_data(*pads_init, graph.ModelPath());
+    pads.assign(pads_data.data<int64_t>(), pads_data.data<int64_t>() + pads_data.size());
+
+    if (input_defs.size() > 2 && input_defs[2]->Exists()) {
+      const ONNX_NAMESPACE::TensorProto* value_init =
+          graph_utils::GetConstantInitializer(graph, input_defs[2]->Name());
+      if (value_init == nullptr || value_init->data_type() != ONNX_NAMESPACE::TensorProto::FLOAT) {
+        return false;
+      }
+
+      Initializer value_data(*value_init, graph.ModelPath());
+      if (value_data.size() != 1 || *value_data.data<float>() != 0.f) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+bool PadFusion::SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const {
+  if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "Pad", {2, 11, 13})) {
+    return false;
+  }
+
+  // The Pad node is removed by the fusion, so the usual node removal constraints apply. It must
+  // also feed a single downstream node given its padding becomes that node's attribute.
+  if (node.GetOutputEdgesCount() != 1 || !graph_utils::CanRemoveNode(graph, node, logger)) {
+    return false;
+  }
+
+  std::vector<int64_t> pads;
+  if (!GetZeroConstantPads(graph, node, pads)) {
+    return false;
+  }
+
+  // Padding on the batch or channel dimension cannot be expressed by the Conv 'pads' attribute,
+  // and negative pads slice rather than pad.
+  const size_t rank = pads.size() / 2;
+  if (pads.size() % 2 != 0 || rank < 3 ||
+      pads[0] != 0 || pads[1] != 0 || pads[rank] != 0 || pads[rank + 1] != 0 ||
+      std::any_of(pads.begin(), pads.end(), [](int64_t pad) { return pad < 0; })) {
+    return false;
+  }
+
+  const auto& output_edge = *node.OutputEdgesBegin();
+  const Node& conv_node = output_edge.GetNode();
+  if (!graph_utils::IsSupportedOptypeVersionAndDomain(conv_node, "Conv", {1, 11}) ||
+      conv_node.GetExecutionProviderType() != node.GetExecutionProviderType() ||
+      output_edge.GetDstArgIndex() != 0) {
+    return false;
+  }
+
+  const auto* auto_pad = graph_utils::GetNodeAttribute(conv_node, "auto_pad");
+  if (auto_pad != nullptr && auto_pad->s() != "NOTSET") {
+    return false;
+  }
+
+  // If the Conv already carries explicit pads they have to match the rank of the Pad.
+  std::vector<int64_t> conv_pads;
+  if (graph_utils::GetRepeatedNodeAttributeValues(conv_node, "pads", conv_pads) &&
+      conv_pads.size() != 2 * (rank - 2)) {
+    return false;
+  }
+
+  return true;
+}
+
+Status PadFusion::Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger&) const {
+  std::vector<int64_t> pads;
+  ORT_ENFORCE(GetZeroConstantPads(graph, node, pads), "Pads were validated in SatisfyCondition.");
+
+  Node& conv_node = *graph.GetNode(node.OutputNodesBegin()->Index());
+
+  const size_t rank = pads.size() / 2;
+  const size_t num_spatial_dims = rank - 2;
+  std::vector<int64_t> conv_pads(2 * num_spatial_dims, 0);
+  graph_utils::GetRepeatedNodeAttributeValues(conv_node, "pads", conv_pads);
+
+  // Pad lays pads out as [x1_begin, x2_begin, ..., x1_end, x2_end, ...] over all dimensions,
+  // while the Conv attribute covers the spatial dimensions only.
+  for (size_t i = 0; i < num_spatial_dims; ++i) {
+    conv_pads[i] += pads[2 + i];
+    conv_pads[num_spatial_dims + i] += pads[rank + 2 + i];
+  }
+
+  conv_node.AddAttribute("pads", conv_pads);
+
+  if (graph_utils::RemoveNode(graph, node)) {
+    rule_effect = RewriteRuleEffect::kRemovedCurrentNode;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
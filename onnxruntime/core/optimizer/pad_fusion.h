@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/rewrite_rule.h"
+
+namespace onnxruntime {
+
+/**
+@Class PadFusion
+
+Rewrite rule that folds a zero-valued constant-mode Pad into the 'pads' attribute of the Conv node
+that consumes it, removing the Pad and the full tensor copy it would otherwise perform.
+
+The fusion only triggers when the padding is restricted to the spatial dimensions, since that is all
+the Conv 'pads' attribute can express, and when the Conv does not use auto_pad.
+
+It is attempted to be triggered only on nodes with op type "Pad".
+*/
+class PadFusion : public RewriteRule {
+ public:
+  PadFusion() noexcept : RewriteRule("PadFusion") {}
+
+  std::vector<std::string> TargetOpTypes() const noexcept override {
+    return {"Pad"};
+  }
+
+ private:
+  bool SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const override;
+
+  Status Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
@@ -15,7 +15,9 @@ namespace onnxruntime {
 static bool CanNodePropagate(const Node& node) {
   return graph_utils::IsSupportedOptypeVersionAndDomain(node, "MaxPool", {12}) ||
          graph_utils::IsSupportedOptypeVersionAndDomain(node, "Reshape", {5, 13, 14}) ||
-         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Transpose", {1, 13});
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Transpose", {1, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Squeeze", {1, 11, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Unsqueeze", {1, 11, 13});
 }
 
 static bool TryCancelOutDQQPair(Graph& graph, Node& dq_node, Node& q_node) {
@@ -112,6 +114,113 @@ static void SwapAdjacentNodes(Graph& graph, Node& up_node, Node& down_node) {
   }
 }
 
+// Retrieve the constant, scalar scale and zero point initializers of a Q or DQ node.
+static bool GetQuantParams(const Graph& graph, const Node& node,
+                           const ONNX_NAMESPACE::TensorProto*& scale_tensor_proto,
+                           const ONNX_NAMESPACE::TensorProto*& zp_tensor_proto) {
+  ConstPointerContainer<std::vector<NodeArg*>> input_defs = node.InputDefs();
+  if (input_defs.size() != QDQ::InputIndex::TOTAL_COUNT ||
+      !optimizer_utils::IsScalar(*input_defs[QDQ::InputIndex::SCALE_ID]) ||
+      !optimizer_utils::IsScalar(*input_defs[QDQ::InputIndex::ZERO_POINT_ID])) {
+    return false;
+  }
+
+  scale_tensor_proto = graph_utils::GetConstantInitializer(graph, input_defs[QDQ::InputIndex::SCALE_ID]->Name());
+  zp_tensor_proto = graph_utils::GetConstantInitializer(graph, input_defs[QDQ::InputIndex::ZERO_POINT_ID]->Name());
+  return nullptr != scale_tensor_proto && nullptr != zp_tensor_proto;
+}
+
+// Move a group of DequantizeLinear nodes with identical quantization parameters from the inputs of
+// a Concat to a single DequantizeLinear on its output, so the concatenation itself runs on the
+// quantized type:
+//   DQ(x0), DQ(x1), ... -> Concat   becomes   Concat(x0, x1, ...) -> DQ
+// dq_node must produce one of the Concat inputs; it is reused as the DequantizeLinear on the
+// output and the DequantizeLinear nodes on the remaining inputs are removed.
+static bool TryPropagateDQThroughConcat(Graph& graph, Node& dq_node, Node& concat_node) {
+  std::vector<Node*> dq_nodes;
+  dq_nodes.reserve(concat_node.InputDefs().size());
+  for (const NodeArg* concat_input_def : concat_node.InputDefs()) {
+    Node* producer = graph.GetMutableProducerNode(concat_input_def->Name());
+    if (producer == nullptr ||
+        !graph_utils::IsSupportedOptypeVersionAndDomain(*producer, "DequantizeLinear", {10, 13}) ||
+        !optimizer_utils::CheckOutputEdges(graph, *producer, 1)) {
+      return false;
+    }
+    dq_nodes.push_back(producer);
+  }
+
+  // all inputs must be dequantized with the same constant, scalar scale and zero point, otherwise
+  // concatenating the quantized values changes the result
+  const ONNX_NAMESPACE::TensorProto* scale_tensor_proto_0 = nullptr;
+  const ONNX_NAMESPACE::TensorProto* zp_tensor_proto_0 = nullptr;
+  if (!GetQuantParams(graph, *dq_nodes[0], scale_tensor_proto_0, zp_tensor_proto_0)) {
+    return false;
+  }
+
+  Initializer scale_0(*scale_tensor_proto_0, graph.ModelPath());
+  Initializer zp_0(*zp_tensor_proto_0, graph.ModelPath());
+  for (size_t i = 1; i < dq_nodes.size(); ++i) {
+    const ONNX_NAMESPACE::TensorProto* scale_tensor_proto = nullptr;
+    const ONNX_NAMESPACE::TensorProto* zp_tensor_proto = nullptr;
+    if (!GetQuantParams(graph, *dq_nodes[i], scale_tensor_proto, zp_tensor_proto)) {
+      return false;
+    }
+
+    Initializer scale(*scale_tensor_proto, graph.ModelPath());
+    Initializer zp(*zp_tensor_proto, graph.ModelPath());
+    if (zp.data_type() != zp_0.data_type() ||
+        *zp.data<int8_t>() != *zp_0.data<int8_t>() ||
+        *scale.data<float>() != *scale_0.data<float>()) {
+      return false;
+    }
+  }
+
+  // rewire each Concat input to the quantized input of its DequantizeLinear
+  for (size_t i = 0; i < dq_nodes.size(); ++i) {
+    Node& dq = *dq_nodes[i];
+
+    std::pair<NodeIndex, int> input_edge_info{0, -1};
+    auto* dq_input_edge_0 = graph_utils::GetInputEdge(dq, 0);
+    if (dq_input_edge_0) {
+      input_edge_info.first = dq_input_edge_0->GetNode().Index();
+      input_edge_info.second = dq_input_edge_0->GetSrcArgIndex();
+      graph.RemoveEdge(dq_input_edge_0->GetNode().Index(), dq.Index(),
+                       dq_input_edge_0->GetSrcArgIndex(), dq_input_edge_0->GetDstArgIndex());
+    }
+
+    graph_utils::RemoveNodeOutputEdges(graph, dq);
+
+    concat_node.MutableInputDefs()[i] = dq.MutableInputDefs()[0];
+    if (input_edge_info.second != -1) {
+      graph.AddEdge(input_edge_info.first, concat_node.Index(), input_edge_info.second, static_cast<int>(i));
+    }
+  }
+
+  // reuse dq_node as the DequantizeLinear on the Concat output
+  auto concat_output_edges = graph_utils::GraphEdge::GetNodeOutputEdges(concat_node);
+  graph_utils::RemoveNodeOutputEdges(graph, concat_node);
+
+  NodeArg* quantized_concat_output =
+      &graph.GetOrCreateNodeArg(graph.GenerateNodeArgName("QDQPropagation_Concat"), nullptr);
+  dq_node.MutableOutputDefs()[0] = concat_node.MutableOutputDefs()[0];
+  concat_node.MutableOutputDefs()[0] = quantized_concat_output;
+  dq_node.MutableInputDefs()[0] = quantized_concat_output;
+
+  graph.AddEdge(concat_node.Index(), dq_node.Index(), 0, 0);
+  for (auto& output_edge : concat_output_edges) {
+    graph.AddEdge(dq_node.Index(), output_edge.dst_node, 0, output_edge.dst_arg_index);
+  }
+
+  // the DequantizeLinear nodes on the remaining inputs are now disconnected
+  for (Node* dq : dq_nodes) {
+    if (dq != &dq_node) {
+      graph.RemoveNode(dq->Index());
+    }
+  }
+
+  return true;
+}
+
 bool QDQPropagationTransformer::PropagateDQForward(Graph& graph) const {
   bool is_modified = false;
 
@@ -152,6 +261,15 @@ bool QDQPropagationTransformer::PropagateDQForward(Graph& graph) const {
 
     do {
       Node& next_node = *graph.GetNode(dq_node.OutputNodesBegin()->Index());
+      if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Concat", {4, 11, 13})) {
+        if (!TryPropagateDQThroughConcat(graph, dq_node, next_node)) {
+          break;
+        }
+
+        // dq_node now dequantizes the Concat output; keep propagating from there
+        is_modified = true;
+        continue;
+      }
       if (!CanNodePropagate(next_node)) {
         // Try canceling out DQ/Q pair
         if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "QuantizeLinear", {10, 13}) &&
@@ -0,0 +1,315 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/spatial_tiling_transformer.h"
+
+#include <algorithm>
+
+#include "core/framework/tensorprotoutils.h"
+#include "core/graph/graph_utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace onnxruntime::common;
+
+namespace onnxruntime {
+
+namespace {
+
+// Ops that map each input row to the same output row, so a band of the input
+// yields the corresponding band of the output without any halo.
+bool IsSupportedElementwise(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Relu", {6, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "LeakyRelu", {6}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sigmoid", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Tanh", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Elu", {6});
+}
+
+bool GetDimValue(const NodeArg* arg, int index, int64_t& value) {
+  const TensorShapeProto* shape = arg != nullptr ? arg->Shape() : nullptr;
+  if (shape == nullptr || shape->dim_size() != 4 || !utils::HasDimValue(shape->dim(index))) {
+    return false;
+  }
+  value = shape->dim(index).dim_value();
+  return value > 0;
+}
+
+// A convolution is tileable along H when it is 2-D with unit strides and
+// dilations and explicit padding, so each contiguous range of output rows is
+// produced from a contiguous range of input rows.
+bool GetConvGeometry(const Node& node, int64_t& kernel_h,
+                     int64_t& pad_top, int64_t& pad_left, int64_t& pad_bottom, int64_t& pad_right) {
+  const auto* auto_pad = graph_utils::GetNodeAttribute(node, "auto_pad");
+  if (auto_pad != nullptr && auto_pad->s() != "NOTSET") {
+    return false;
+  }
+
+  auto all_ones = [&node](const char* attr_name) {
+    const auto* attr = graph_utils::GetNodeAttribute(node, attr_name);
+    if (attr == nullptr) {
+      return true;
+    }
+    for (const auto value : attr->ints()) {
+      if (value != 1) {
+        return false;
+      }
+    }
+    return true;
+  };
+  if (!all_ones("strides") || !all_ones("dilations")) {
+    return false;
+  }
+
+  const auto* kernel_shape = graph_utils::GetNodeAttribute(node, "kernel_shape");
+  if (kernel_shape != nullptr) {
+    if (kernel_shape->ints_size() != 2) {
+      return false;
+    }
+    kernel_h = kernel_shape->ints(0);
+  } else if (!GetDimValue(node.InputDefs()[1], 2, kernel_h)) {
+    return false;
+  }
+
+  pad_top = pad_left = pad_bottom = pad_right = 0;
+  const auto* pads = graph_utils::GetNodeAttribute(node, "pads");
+  if (pads != nullptr) {
+    if (pads->ints_size() != 4) {
+      return false;
+    }
+    pad_top = pads->ints(0);
+    pad_left = pads->ints(1);
+    pad_bottom = pads->ints(2);
+    pad_right = pads->ints(3);
+  }
+
+  return kernel_h > 0;
+}
+
+// Per-layer geometry of the chain along the H axis. Elementwise layers pass
+// rows through unchanged; convolutions consume kernel_h rows per output row.
+struct ChainLayer {
+  Node* node{nullptr};
+  bool is_conv{false};
+  int64_t input_height{0};
+  int64_t kernel_h{0};
+  int64_t pad_top{0};
+  int64_t pad_left{0};
+  int64_t pad_bottom{0};
+  int64_t pad_right{0};
+};
+
+}  // namespace
+
+Status SpatialTilingTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                           const logging::Logger& logger) const {
+  // The banding below emits Slice nodes with starts/ends/axes as inputs, which
+  // requires opset 10 or later.
+  const auto opset_it = graph.DomainToVersionMap().find(kOnnxDomain);
+  if (opset_it == graph.DomainToVersionMap().end() || opset_it->second < 10) {
+    return Status::OK();
+  }
+
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node = graph.GetNode(node_index);
+    if (node == nullptr) {
+      continue;  // node was removed as part of an earlier chain
+    }
+
+    ORT_RETURN_IF_ERROR(Recurse(*node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(*node, "Conv", {1, 11}) ||
+        !graph_utils::IsSupportedProvider(*node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    // The chain input needs a static height to size the bands. Iterating in
+    // topological order guarantees the first eligible convolution we see is
+    // the true head of its chain.
+    int64_t input_height;
+    if (!GetDimValue(node->InputDefs()[0], 2, input_height)) {
+      continue;
+    }
+
+    // Extend the chain downstream as far as every link is an eligible
+    // convolution or elementwise op consuming the previous output as its only
+    // data input, with no other consumers of the intermediate value.
+    std::vector<ChainLayer> chain;
+    int conv_count = 0;
+    int64_t height = input_height;
+    Node* current = node;
+    for (;;) {
+      ChainLayer layer;
+      layer.node = current;
+      layer.input_height = height;
+      if (current->OpType() == "Conv") {
+        if (!GetConvGeometry(*current, layer.kernel_h,
+                             layer.pad_top, layer.pad_left, layer.pad_bottom, layer.pad_right)) {
+          break;
+        }
+        const int64_t output_height = height + layer.pad_top + layer.pad_bottom - (layer.kernel_h - 1);
+        if (output_height <= 0) {
+          break;
+        }
+        layer.is_conv = true;
+        height = output_height;
+        ++conv_count;
+      }
+      chain.push_back(layer);
+
+      if (current->GetOutputEdgesCount() != 1 || graph.NodeProducesGraphOutput(*current)) {
+        break;
+      }
+      Node& next = *graph.GetNode(current->OutputNodesBegin()->Index());
+      const bool next_is_conv = graph_utils::IsSupportedOptypeVersionAndDomain(next, "Conv", {1, 11});
+      if ((!next_is_conv && !IsSupportedElementwise(next)) ||
+          !graph_utils::IsSupportedProvider(next, GetCompatibleExecutionProviders()) ||
+          next.InputDefs()[0] != current->OutputDefs()[0]) {
+        break;
+      }
+      current = &next;
+    }
+
+    // Tiling pays off only when at least two convolutions share each band, and
+    // each band should cover a couple of output rows to amortize the halo.
+    const int64_t output_height = height;
+    if (conv_count < 2 || output_height < tile_count_ * 2) {
+      continue;
+    }
+
+    // For each band, walk the chain backwards from the final output rows it
+    // produces to the input rows it needs. Rows that fall outside the input of
+    // a layer come from that convolution's padding, so they turn back into
+    // explicit padding on the band's copy of the node.
+    struct BandLayerPads {
+      int64_t pad_top{0};
+      int64_t pad_bottom{0};
+    };
+    std::vector<int64_t> band_input_begin(tile_count_);
+    std::vector<int64_t> band_input_end(tile_count_);
+    std::vector<std::vector<BandLayerPads>> band_pads(tile_count_);
+    for (int64_t band = 0; band < tile_count_; ++band) {
+      int64_t begin = output_height * band / tile_count_;
+      int64_t end = output_height * (band + 1) / tile_count_;
+      auto& pads = band_pads[band];
+      pads.resize(chain.size());
+      for (size_t layer_index = chain.size(); layer_index-- > 0;) {
+        const ChainLayer& layer = chain[layer_index];
+        if (!layer.is_conv) {
+          continue;
+        }
+        const int64_t needed_begin = begin - layer.pad_top;
+        const int64_t needed_end = end + layer.kernel_h - 1 - layer.pad_top;
+        pads[layer_index].pad_top = std::max<int64_t>(0, -needed_begin);
+        pads[layer_index].pad_bottom = std::max<int64_t>(0, needed_end - layer.input_height);
+        begin = std::max<int64_t>(0, needed_begin);
+        end = std::min<int64_t>(layer.input_height, needed_end);
+      }
+      band_input_begin[band] = begin;
+      band_input_end[band] = end;
+    }
+    bool empty_band = false;
+    for (int64_t band = 0; band < tile_count_; ++band) {
+      empty_band = empty_band || band_input_begin[band] >= band_input_end[band];
+    }
+    if (empty_band) {
+      continue;  // degenerate padding leaves a band with no input rows
+    }
+
+    // Capture everything needed to rebuild the chain before removing it. The
+    // extra inputs (convolution weights and bias) are shared by reference
+    // across the bands rather than duplicated.
+    struct LayerSpec {
+      std::string op_type;
+      std::string domain;
+      NodeAttributes attributes;
+      std::vector<NodeArg*> extra_inputs;
+      bool is_conv{false};
+      int64_t pad_left{0};
+      int64_t pad_right{0};
+    };
+    std::vector<LayerSpec> specs;
+    specs.reserve(chain.size());
+    for (const ChainLayer& layer : chain) {
+      LayerSpec spec;
+      spec.op_type = layer.node->OpType();
+      spec.domain = layer.node->Domain();
+      spec.attributes = layer.node->GetAttributes();
+      const auto& input_defs = layer.node->MutableInputDefs();
+      spec.extra_inputs.assign(input_defs.begin() + 1, input_defs.end());
+      spec.is_conv = layer.is_conv;
+      spec.pad_left = layer.pad_left;
+      spec.pad_right = layer.pad_right;
+      if (spec.is_conv) {
+        spec.attributes.erase("pads");
+        spec.attributes.erase("auto_pad");
+      }
+      specs.push_back(std::move(spec));
+    }
+
+    NodeArg* chain_input = chain.front().node->MutableInputDefs()[0];
+    NodeArg* chain_output = chain.back().node->MutableOutputDefs()[0];
+    const std::string execution_provider_type = chain.front().node->GetExecutionProviderType();
+
+    for (const ChainLayer& layer : chain) {
+      graph_utils::RemoveNodeOutputEdges(graph, *layer.node);
+      graph.RemoveNode(layer.node->Index());
+    }
+
+    auto add_int64_initializer = [&graph](const char* base_name, int64_t value) -> NodeArg& {
+      TensorProto tensor;
+      tensor.set_name(graph.GenerateNodeArgName(base_name));
+      tensor.set_data_type(TensorProto_DataType_INT64);
+      tensor.add_dims(1);
+      tensor.add_int64_data(value);
+      return graph_utils::AddInitializer(graph, tensor);
+    };
+
+    std::vector<NodeArg*> concat_inputs;
+    concat_inputs.reserve(tile_count_);
+    for (int64_t band = 0; band < tile_count_; ++band) {
+      NodeArg& starts = add_int64_initializer("spatial_tile_starts", band_input_begin[band]);
+      NodeArg& ends = add_int64_initializer("spatial_tile_ends", band_input_end[band]);
+      NodeArg& axes = add_int64_initializer("spatial_tile_axes", 2);
+
+      NodeArg* band_value = &graph.GetOrCreateNodeArg(graph.GenerateNodeArgName("spatial_tile_input"), nullptr);
+      Node& slice_node = graph.AddNode(graph.GenerateNodeName("spatial_tile_slice"), "Slice",
+                                       "input band for spatial tiling",
+                                       {chain_input, &starts, &ends, &axes}, {band_value});
+      slice_node.SetExecutionProviderType(execution_provider_type);
+
+      for (size_t layer_index = 0; layer_index < specs.size(); ++layer_index) {
+        const LayerSpec& spec = specs[layer_index];
+        NodeArg* band_output = &graph.GetOrCreateNodeArg(graph.GenerateNodeArgName("spatial_tile_value"), nullptr);
+        std::vector<NodeArg*> inputs{band_value};
+        inputs.insert(inputs.end(), spec.extra_inputs.begin(), spec.extra_inputs.end());
+        Node& band_node = graph.AddNode(graph.GenerateNodeName("spatial_tile_" + spec.op_type), spec.op_type,
+                                        "per-band copy of a spatially tiled chain node",
+                                        inputs, {band_output}, &spec.attributes, spec.domain);
+        if (spec.is_conv) {
+          band_node.AddAttribute("pads", std::vector<int64_t>{band_pads[band][layer_index].pad_top,
+                                                              spec.pad_left,
+                                                              band_pads[band][layer_index].pad_bottom,
+                                                              spec.pad_right});
+        }
+        band_node.SetExecutionProviderType(execution_provider_type);
+        band_value = band_output;
+      }
+      concat_inputs.push_back(band_value);
+    }
+
+    Node& concat_node = graph.AddNode(graph.GenerateNodeName("spatial_tile_concat"), "Concat",
+                                      "reassembles the spatially tiled bands",
+                                      concat_inputs, {chain_output});
+    concat_node.AddAttribute("axis", static_cast<int64_t>(2));
+    concat_node.SetExecutionProviderType(execution_provider_type);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class SpatialTilingTransformer
+
+Splits chains of stride-1 convolutions and unary elementwise activations into
+horizontal bands that are executed independently and concatenated back
+together. Executing a bandwidth-bound chain layer by layer streams every
+intermediate activation map through memory; after tiling, each band's
+intermediates are small enough to stay in cache while the whole chain runs
+over them. Band boundaries are widened layer by layer with the convolution
+halos (rows clipped at the tensor edge become explicit padding), so every
+output element sees exactly the same input window as in the untiled chain.
+*/
+class SpatialTilingTransformer : public GraphTransformer {
+ public:
+  explicit SpatialTilingTransformer(int64_t tile_count,
+                                    const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("SpatialTilingTransformer", compatible_execution_providers),
+        tile_count_(tile_count) {}
+
+ private:
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  int64_t tile_count_;
+};
+
+}  // namespace onnxruntime
@@ -65,8 +65,37 @@ struct ThreadOptions {
   // processor group [0,1,2,3] may only contain half of the physical cores.
   std::vector<size_t> affinity;
 
+  // Per-thread affinity masks. When non-empty this takes precedence over 'affinity': the thread
+  // with a given index may run on any of the logical processors listed in affinity_masks[index]
+  // instead of being pinned to a single one. Used for NUMA-node binding, where the threads should
+  // float across the processors of one node rather than be pinned to individual processors.
+  std::vector<std::vector<size_t>> affinity_masks;
+
+  // Number of iterations a worker spins waiting for work before parking. 0 selects the built-in
+  // default. Larger values lower the wakeup latency at the start of a parallel region at the cost
+  // of CPU time; has no effect when spinning is disabled for the pool.
+  unsigned int worker_spin_count = 0;
+
+  // The first num_hot_standby_threads workers of the pool never park between requests: they keep
+  // busy-polling their queues, so the next parallel region does not pay the futex wakeup cost.
+  // Trades continuous CPU usage on those threads for dispatch latency.
+  int num_hot_standby_threads = 0;
+
   // Set or unset denormal as zero.
   bool set_denormal_as_zero = false;
+
+  // Nice value each worker thread applies to itself before it starts to process work. Positive
+  // values lower the workers' scheduling priority relative to the application's own threads,
+  // useful for background sessions that should yield to latency critical work. Ignored on
+  // platforms without per-thread scheduling priority.
+  int worker_nice_value = 0;
+
+  // Invoked once on every worker thread of the pool, on the worker itself, before it processes
+  // its first work item and after the built-in per-worker initialization (denormal control,
+  // scheduling priority), so thread-local state set up here is visible to all work the thread
+  // later runs. The argument is the worker's thread index within the pool. Exceptions thrown by
+  // the callback are swallowed; it must not block.
+  std::function<void(int)> worker_init_fn;
 };
 /// \brief An interface used by the onnxruntime implementation to
 /// access operating system functionality like the filesystem etc.
@@ -110,6 +139,28 @@ class Env {
   // This function doesn't support systems with more than 64 logical processors
   virtual std::vector<size_t> GetThreadAffinityMasks() const = 0;
 
+  // Returns the number of NUMA nodes on the machine.
+  // Returns 1 when the platform has no NUMA support or the topology cannot be queried.
+  virtual int GetNumNumaNodes() const { return 1; }
+
+  // Returns the NUMA node the calling thread is currently running on.
+  // Returns 0 when the information is unavailable.
+  virtual int GetCurrentNumaNode() const { return 0; }
+
+  // Returns the logical processors that belong to the given NUMA node.
+  // Returns an empty vector when the platform has no NUMA support or the topology cannot be queried.
+  virtual std::vector<size_t> GetNumaNodeProcessors(int /*numa_node*/) const { return {}; }
+
+  // Returns one logical processor per physical core (the first SMT sibling of each core), so that
+  // callers can avoid placing two pool threads on hyper-thread siblings of the same core.
+  // Returns an empty vector when the topology cannot be queried.
+  virtual std::vector<size_t> GetPhysicalCoreProcessors() const { return {}; }
+
+  // Advise the OS to back the given range with huge pages to reduce TLB pressure.
+  // Best effort: platforms without support, or kernels with transparent huge pages disabled,
+  // leave the range untouched and the regular page size keeps being used.
+  virtual void AdviseHugePages(void* /*p*/, size_t /*size*/) const {}
+
   /// \brief Returns the number of micro-seconds since the Unix epoch.
   virtual uint64_t NowMicros() const {
     return env_time_->NowMicros();
@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+
+/**
+ * Hardware performance counters for the calling thread, counting CPU cycles, retired
+ * instructions and last-level cache misses between Start and Stop. Backed by perf_event_open on
+ * Linux; on other platforms (or when the kernel denies access, see
+ * /proc/sys/kernel/perf_event_paranoid) IsValid returns false and Stop returns zeros.
+ *
+ * The counters follow the thread that opened them, so they attribute work executed on that
+ * thread only; work a kernel fans out over the intra-op thread pool is not captured.
+ */
+class ThreadPerfCounters {
+ public:
+  struct Values {
+    uint64_t cycles{0};
+    uint64_t instructions{0};
+    uint64_t llc_misses{0};
+  };
+
+#if defined(__linux__)
+  ThreadPerfCounters() {
+    cycles_fd_ = OpenCounter(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (cycles_fd_ != -1) {
+      // the remaining counters join the cycle counter's group so that all three are enabled,
+      // disabled and scheduled onto the PMU together
+      instructions_fd_ = OpenCounter(PERF_COUNT_HW_INSTRUCTIONS, cycles_fd_);
+      llc_misses_fd_ = OpenCounter(PERF_COUNT_HW_CACHE_MISSES, cycles_fd_);
+    }
+  }
+
+  ~ThreadPerfCounters() {
+    if (llc_misses_fd_ != -1) close(llc_misses_fd_);
+    if (instructions_fd_ != -1) close(instructions_fd_);
+    if (cycles_fd_ != -1) close(cycles_fd_);
+  }
+
+  bool IsValid() const { return cycles_fd_ != -1; }
+
+  void Start() {
+    ioctl(cycles_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(cycles_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+  Values Stop() {
+    ioctl(cycles_fd_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    Values values;
+    values.cycles = ReadCounter(cycles_fd_);
+    values.instructions = ReadCounter(instructions_fd_);
+    values.llc_misses = ReadCounter(llc_misses_fd_);
+    return values;
+  }
+
+ private:
+  static int OpenCounter(uint64_t config, int group_fd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = group_fd == -1 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+  }
+
+  static uint64_t ReadCounter(int fd) {
+    uint64_t value = 0;
+    if (fd == -1 || read(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) {
+      return 0;
+    }
+    return value;
+  }
+
+  int cycles_fd_ = -1;
+  int instructions_fd_ = -1;
+  int llc_misses_fd_ = -1;
+#else
+  ThreadPerfCounters() = default;
+  bool IsValid() const { return false; }
+  void Start() {}
+  Values Stop() { return {}; }
+
+ private:
+#endif
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ThreadPerfCounters);
+};
+
+}  // namespace onnxruntime
@@ -32,8 +32,16 @@ limitations under the License.
 #include <vector>
 #include <assert.h>
 
+#if defined(__linux__)
+#include <fstream>
+#include <sstream>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
+
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
+#include "core/common/parse_string.h"
 #include "core/platform/scoped_resource.h"
 #include "core/platform/EigenNonBlockingThreadPool.h"
 
@@ -163,7 +171,23 @@ class PosixThread : public EnvThread {
       ORT_THROW("pthread_create failed, error code: ", err_no, " error msg: ", err_msg);
     }
 #if !defined(__APPLE__) && !defined(__ANDROID__) && !defined(__wasm__)
-    if (!thread_options.affinity.empty()) {
+    if (!thread_options.affinity_masks.empty()) {
+      // per-thread masks take precedence over the single processor affinity below; the thread may
+      // run on any processor in its mask
+      if (static_cast<size_t>(index) < thread_options.affinity_masks.size() &&
+          !thread_options.affinity_masks[index].empty()) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        for (size_t cpu : thread_options.affinity_masks[index]) {
+          CPU_SET(cpu, &cpuset);
+        }
+        s = pthread_setaffinity_np(hThread, sizeof(cpu_set_t), &cpuset);
+        if (s != 0) {
+          auto[err_no, err_msg] = GetSystemError();
+          ORT_THROW("pthread_setaffinity_np failed, error code: ", err_no, " error msg: ", err_msg);
+        }
+      }
+    } else if (!thread_options.affinity.empty()) {
       cpu_set_t cpuset;
       CPU_ZERO(&cpuset);
       CPU_SET(thread_options.affinity[index], &cpuset);
@@ -189,6 +213,18 @@ class PosixThread : public EnvThread {
  private:
   static void* ThreadMain(void* param) {
     std::unique_ptr<Param> p((Param*)param);
+#if defined(__linux__)
+    if (p->thread_options.worker_nice_value != 0) {
+      // nice values are per-thread on Linux. failure is non-fatal; the worker just keeps the
+      // priority it inherited.
+      if (setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)),
+                      p->thread_options.worker_nice_value) != 0) {
+        auto[err_no, err_msg] = GetSystemError();
+        LOGS_DEFAULT(WARNING) << "setpriority failed for thread pool worker, error code: " << err_no
+                              << " error msg: " << err_msg;
+      }
+    }
+#endif
     ORT_TRY {
       // Ignore the returned value for now
       p->start_address(p->index, p->param);
@@ -201,6 +237,36 @@ class PosixThread : public EnvThread {
   pthread_t hThread;
 };
 
+#if defined(__linux__)
+// Parses a sysfs cpulist string such as "0-3,8,10-11" into the individual processor ids.
+// Malformed fragments are skipped.
+static std::vector<size_t> ParseSysfsCpuList(const std::string& cpulist) {
+  std::vector<size_t> cpus;
+  std::istringstream list_stream(cpulist);
+  std::string token;
+  while (std::getline(list_stream, token, ',')) {
+    size_t first = 0;
+    size_t last = 0;
+    const auto dash = token.find('-');
+    if (dash == std::string::npos) {
+      if (!TryParseStringWithClassicLocale(token, first)) {
+        continue;
+      }
+      last = first;
+    } else {
+      if (!TryParseStringWithClassicLocale(token.substr(0, dash), first) ||
+          !TryParseStringWithClassicLocale(token.substr(dash + 1), last) || last < first) {
+        continue;
+      }
+    }
+    for (size_t cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+#endif
+
 class PosixEnv : public Env {
  public:
   static PosixEnv& Instance() {
@@ -227,6 +293,102 @@ class PosixEnv : public Env {
     return ret;
   }
 
+  int GetNumNumaNodes() const override {
+#if defined(__linux__)
+    // the node ids that can exist on this machine are exposed via sysfs as a list like "0" or "0-3".
+    // kernels built without NUMA support don't provide the hierarchy; treat that as a single node.
+    std::ifstream possible_nodes("/sys/devices/system/node/possible");
+    std::string content;
+    if (possible_nodes && std::getline(possible_nodes, content) && !content.empty()) {
+      auto last_number_start = content.find_last_of("-,");
+      last_number_start = (last_number_start == std::string::npos) ? 0 : last_number_start + 1;
+      int highest_node = 0;
+      if (TryParseStringWithClassicLocale(content.substr(last_number_start), highest_node) && highest_node >= 0) {
+        return highest_node + 1;
+      }
+    }
+#endif
+    return 1;
+  }
+
+  int GetCurrentNumaNode() const override {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+      return static_cast<int>(node);
+    }
+#endif
+    return 0;
+  }
+
+  std::vector<size_t> GetNumaNodeProcessors(int numa_node) const override {
+#if defined(__linux__)
+    std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(numa_node) + "/cpulist");
+    std::string content;
+    if (cpulist && std::getline(cpulist, content) && !content.empty()) {
+      return ParseSysfsCpuList(content);
+    }
+#else
+    ORT_UNUSED_PARAMETER(numa_node);
+#endif
+    return {};
+  }
+
+  std::vector<size_t> GetPhysicalCoreProcessors() const override {
+#if defined(__linux__)
+    std::vector<size_t> cpus;
+    const size_t num_cpus = std::thread::hardware_concurrency();
+    for (size_t i = 0; i < num_cpus; ++i) {
+      std::ifstream siblings("/sys/devices/system/cpu/cpu" + std::to_string(i) +
+                             "/topology/thread_siblings_list");
+      std::string content;
+      if (!siblings || !std::getline(siblings, content) || content.empty()) {
+        // topology is incomplete; don't return a partial view of the machine
+        return {};
+      }
+      // keep a processor only if it is the lowest numbered sibling of its core, so no two of the
+      // returned processors share a physical core
+      bool is_first_sibling = true;
+      for (size_t sibling : ParseSysfsCpuList(content)) {
+        if (sibling < i) {
+          is_first_sibling = false;
+          break;
+        }
+      }
+      if (is_first_sibling) {
+        cpus.push_back(i);
+      }
+    }
+    return cpus;
+#else
+    return {};
+#endif
+  }
+
+  void AdviseHugePages(void* p, size_t size) const override {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // madvise requires a page aligned address, so shrink the range to page boundaries.
+    // the kernel then backs each fully covered huge page sized region with a huge page
+    // once transparent huge pages are enabled (at least in madvise mode).
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t start = reinterpret_cast<uintptr_t>(p);
+    const uintptr_t aligned_start = (start + page_size - 1) & ~(page_size - 1);
+    if (size < aligned_start - start) {
+      return;
+    }
+    const size_t aligned_size = ((size - (aligned_start - start)) / page_size) * page_size;
+    if (aligned_size == 0) {
+      return;
+    }
+    // best effort; a failure just means the range keeps regular pages.
+    static_cast<void>(madvise(reinterpret_cast<void*>(aligned_start), aligned_size, MADV_HUGEPAGE));
+#else
+    ORT_UNUSED_PARAMETER(p);
+    ORT_UNUSED_PARAMETER(size);
+#endif
+  }
+
   void SleepForMicroseconds(int64_t micros) const override {
     while (micros > 0) {
       timespec sleep_time;
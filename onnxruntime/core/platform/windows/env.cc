@@ -81,6 +81,15 @@ class WindowsThread : public EnvThread {
     // TODO: should I try to use SetThreadSelectedCpuSets?
     if (!p->thread_options.affinity.empty())
       SetThreadAffinityMask(GetCurrentThread(), p->thread_options.affinity[p->index]);
+    if (p->thread_options.worker_nice_value != 0) {
+      // map the POSIX-style nice value onto the closest Windows thread priority. Ignore the error
+      const int nice_value = p->thread_options.worker_nice_value;
+      const int priority = nice_value >= 10   ? THREAD_PRIORITY_LOWEST
+                           : nice_value > 0   ? THREAD_PRIORITY_BELOW_NORMAL
+                           : nice_value <= -10 ? THREAD_PRIORITY_HIGHEST
+                                               : THREAD_PRIORITY_ABOVE_NORMAL;
+      (void)SetThreadPriority(GetCurrentThread(), priority);
+    }
 #if WINVER >= _WIN32_WINNT_WIN10
     constexpr SetThreadDescriptionFunc pSetThrDesc = SetThreadDescription;
 #elif WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP)
@@ -178,6 +187,25 @@ class WindowsEnv : public Env {
     return ret;
   }
 
+  int GetNumNumaNodes() const override {
+    ULONG highest_node_number = 0;
+    if (!GetNumaHighestNodeNumber(&highest_node_number)) {
+      return 1;
+    }
+    return static_cast<int>(highest_node_number) + 1;
+  }
+
+  int GetCurrentNumaNode() const override {
+    PROCESSOR_NUMBER processor_number;
+    GetCurrentProcessorNumberEx(&processor_number);
+    USHORT node_number = 0;
+    // a node number of 0xffff means the processor does not belong to any NUMA node
+    if (!GetNumaProcessorNodeEx(&processor_number, &node_number) || node_number == 0xffff) {
+      return 0;
+    }
+    return static_cast<int>(node_number);
+  }
+
   static WindowsEnv& Instance() {
     static WindowsEnv default_env;
     return default_env;
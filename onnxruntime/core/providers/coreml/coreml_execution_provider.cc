@@ -176,11 +176,9 @@ common::Status CoreMLExecutionProvider::Compile(const std::vector<FusedNodeAndGr
         ort.ReleaseTensorTypeAndShapeInfo(tensor_info);
       }
 
-      // From this point we will need to take the exclusive lock on the model until the Predict is
-      // performed, to block other threads to perform Predict on the same model
-      // TODO, investigate concurrent runs for different executions from the same model
+      // Concurrent Predict calls on the same model are handled by the pool of MLModel
+      // instances inside coreml::Model, no exclusive lock is needed here
       {
-        std::unique_lock<OrtMutex> lock(model->GetMutex());
         std::unordered_map<std::string, coreml::OnnxTensorData> outputs;
         outputs.reserve(model_outputs.size());
         for (size_t i = 0; i < model_outputs.size(); i++) {
@@ -4,7 +4,6 @@
 #pragma once
 
 #include "core/common/status.h"
-#include "core/platform/ort_mutex.h"
 
 namespace onnxruntime {
 namespace coreml {
@@ -35,9 +34,6 @@ class Model {
 
   bool IsInt64Output(const std::string& output_name) const;
 
-  // Mutex for exclusive lock to this model object
-  OrtMutex& GetMutex() { return mutex_; }
-
   // Input and output names in the onnx model's order
   const std::vector<std::string>& GetInputs() const { return inputs_; }
   void SetInputs(std::vector<std::string>&& inputs) { inputs_ = std::move(inputs); }
@@ -57,8 +53,6 @@ class Model {
 
   std::unordered_map<std::string, OnnxTensorInfo> input_output_info_;
 
-  OrtMutex mutex_;
-
   Model(const std::string& path, const logging::Logger& logger, uint32_t coreml_flags);
   onnxruntime::common::Status LoadModel();
 
@@ -1,7 +1,9 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -17,6 +19,38 @@
 #import <CoreML/CoreML.h>
 #import <Foundation/Foundation.h>
 
+// Number of MLModel instances loaded from one compiled model
+// A single instance serializes its predictions, a small pool lets independent Runs
+// predict concurrently while bounding the memory for the extra instances
+static constexpr uint32_t kCoreMLModelPoolSize = 4;
+
+// Create an MLMultiArray wrapping the given onnx tensor buffer without copying it
+// The buffer is owned by the caller and must outlive the returned array
+static MLMultiArray* CreateMLMultiArrayOverBuffer(const onnxruntime::coreml::OnnxTensorData& tensor,
+                                                  MLMultiArrayDataType data_type,
+                                                  NSError** error) API_AVAILABLE_OS_VERSIONS {
+  NSMutableArray* shape = [[NSMutableArray alloc] init];
+  for (const auto dim : tensor.tensor_info.shape) {
+    [shape addObject:[NSNumber numberWithLongLong:dim]];
+  }
+
+  NSMutableArray* strides = [[NSMutableArray alloc] init];
+  int64_t stride = 1;
+  for (int i = static_cast<int>(tensor.tensor_info.shape.size()) - 1; i >= 0; i--) {
+    [strides insertObject:[NSNumber numberWithLongLong:stride]
+                  atIndex:0];
+
+    stride *= tensor.tensor_info.shape[i];
+  }
+
+  return [[MLMultiArray alloc] initWithDataPointer:tensor.buffer
+                                             shape:shape
+                                          dataType:data_type
+                                           strides:strides
+                                       deallocator:(^(void* /* bytes */){
+                                                   })error:error];
+}
+
 // Model input for a CoreML model
 // All the input onnx tensors values will be converted to MLMultiArray(s)
 @interface OnnxTensorFeatureProvider : NSObject <MLFeatureProvider> {
@@ -41,6 +75,11 @@
   NSString* compiled_model_path_;
   const onnxruntime::logging::Logger* logger_;
   uint32_t coreml_flags_;
+
+  // Idle MLModel instances loaded from the same compiled model, protected by pool_mutex_
+  NSMutableArray* model_pool_;
+  std::mutex pool_mutex_;
+  std::condition_variable pool_cv_;
 }
 
 - (instancetype)initWithPath:(const std::string&)path
@@ -48,6 +87,10 @@
                 coreml_flags:(uint32_t)coreml_flags;
 - (void)cleanup;
 - (void)dealloc;
+// Take an idle MLModel instance out of the pool, blocks until one is available
+- (MLModel*)acquireModel API_AVAILABLE_OS_VERSIONS;
+// Put an instance returned by acquireModel back into the pool
+- (void)releaseModel:(MLModel*)model API_AVAILABLE_OS_VERSIONS;
 - (onnxruntime::common::Status)loadModel API_AVAILABLE_OS_VERSIONS;
 - (onnxruntime::common::Status)
     predict:(const std::unordered_map<std::string, onnxruntime::coreml::OnnxTensorData>&)inputs
@@ -89,20 +132,6 @@
   auto it = inputs_->find([featureName cStringUsingEncoding:NSUTF8StringEncoding]);
   if (it != inputs_->end()) {
     auto& input = it->second;
-    NSMutableArray* shape = [[NSMutableArray alloc] init];
-    for (const auto dim : input.tensor_info.shape) {
-      [shape addObject:[NSNumber numberWithLongLong:dim]];
-    }
-
-    NSMutableArray* strides = [[NSMutableArray alloc] init];
-    int64_t stride = 1;
-    for (int i = static_cast<int>(input.tensor_info.shape.size()) - 1; i >= 0; i--) {
-      [strides insertObject:[NSNumber numberWithLongLong:stride]
-                    atIndex:0];
-
-      stride *= input.tensor_info.shape[i];
-    }
-
     MLMultiArrayDataType data_type = MLMultiArrayDataTypeFloat32;
     if (input.tensor_info.data_type != ONNX_NAMESPACE::TensorProto_DataType_FLOAT) {
       LOGS(*logger_, ERROR) << "Input data type is not float, actual type: "
@@ -111,12 +140,7 @@
     }
 
     NSError* error = nil;
-    MLMultiArray* mlArray = [[MLMultiArray alloc] initWithDataPointer:input.buffer
-                                                                shape:shape
-                                                             dataType:data_type
-                                                              strides:strides
-                                                          deallocator:(^(void* /* bytes */){
-                                                                      })error:&error];
+    MLMultiArray* mlArray = CreateMLMultiArrayOverBuffer(input, data_type, &error);
     if (error != nil) {
       LOGS(*logger_, ERROR) << "Failed to create MLMultiArray for feature: " << [featureName UTF8String]
                             << ", error: " << [[error localizedDescription] UTF8String];
@@ -187,16 +211,41 @@
 
   MLModelConfiguration* config = [MLModelConfiguration alloc];
   config.computeUnits = MLComputeUnitsAll;
-  _model = [MLModel modelWithContentsOfURL:compileUrl configuration:config error:&error];
 
-  if (error != NULL) {
-    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Error Creating MLModel ",
-                           [[error localizedDescription] cStringUsingEncoding:NSUTF8StringEncoding]);
+  // One MLModel instance serializes its predictions, so load a small pool of instances
+  // from the one compiled model and let independent Runs predict concurrently
+  model_pool_ = [[NSMutableArray alloc] init];
+  for (uint32_t i = 0; i < kCoreMLModelPoolSize; i++) {
+    MLModel* model = [MLModel modelWithContentsOfURL:compileUrl configuration:config error:&error];
+
+    if (error != NULL) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Error Creating MLModel ",
+                             [[error localizedDescription] cStringUsingEncoding:NSUTF8StringEncoding]);
+    }
+
+    [model_pool_ addObject:model];
   }
 
+  _model = [model_pool_ lastObject];
   return onnxruntime::common::Status::OK();
 }
 
+- (MLModel*)acquireModel {
+  std::unique_lock<std::mutex> lock(pool_mutex_);
+  pool_cv_.wait(lock, [self] { return [self->model_pool_ count] > 0; });
+  MLModel* model = [model_pool_ lastObject];
+  [model_pool_ removeLastObject];
+  return model;
+}
+
+- (void)releaseModel:(MLModel*)model {
+  {
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    [model_pool_ addObject:model];
+  }
+  pool_cv_.notify_one();
+}
+
 - (onnxruntime::common::Status)
     predict:(const std::unordered_map<std::string, onnxruntime::coreml::OnnxTensorData>&)inputs
     outputs:(const std::unordered_map<std::string, onnxruntime::coreml::OnnxTensorData>&)outputs {
@@ -213,10 +262,40 @@
 
   MLPredictionOptions* options = [[MLPredictionOptions alloc] init];
   options.usesCPUOnly = coreml_flags_ & COREML_FLAG_USE_CPU_ONLY;
+
+  // Back the float outputs directly with the ORT output buffers so the prediction result
+  // is written in place and the copy loop below is skipped for them
+  // int64 outputs are produced as int32 by CoreML and still need the widening copy
+  if (@available(macOS 11.0, iOS 14.0, *)) {
+    NSMutableDictionary* output_backings = [[NSMutableDictionary alloc] init];
+    for (const auto& output : outputs) {
+      if (output.second.tensor_info.data_type != ONNX_NAMESPACE::TensorProto_DataType_FLOAT)
+        continue;
+
+      NSError* backing_error = nil;
+      MLMultiArray* backing = CreateMLMultiArrayOverBuffer(output.second, MLMultiArrayDataTypeFloat32, &backing_error);
+      if (backing == nil || backing_error != nil) {
+        // not fatal, the output falls back to the copy path
+        continue;
+      }
+
+      NSString* output_name = [NSString stringWithCString:output.first.c_str()
+                                                 encoding:[NSString defaultCStringEncoding]];
+      NSAssert(output_name != nil, @"output_name must not be nil");
+      [output_backings setObject:backing forKey:output_name];
+    }
+
+    options.outputBackings = output_backings;
+  }
+
+  MLModel* model = [self acquireModel];
   NSError* error = nil;
-  id<MLFeatureProvider> output_feature = [_model predictionFromFeatures:input_feature
-                                                                options:options
-                                                                  error:&error];
+  id<MLFeatureProvider> output_feature = [model predictionFromFeatures:input_feature
+                                                               options:options
+                                                                 error:&error];
+  // The output feature values own their data, the instance can serve another
+  // prediction while the outputs are consumed below
+  [self releaseModel:model];
 
   if (error != nil) {
     return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Error executing model: ",
@@ -245,6 +324,11 @@
     auto model_output_type = data.dataType;
 
     auto& output_tensor = output.second;
+    if (model_output_data == output_tensor.buffer) {
+      // The output was backed by the ORT buffer and has already been written in place
+      continue;
+    }
+
     size_t num_elements =
         accumulate(output_tensor.tensor_info.shape.begin(),
                    output_tensor.tensor_info.shape.end(),
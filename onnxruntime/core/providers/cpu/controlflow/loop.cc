@@ -21,6 +21,7 @@
 #include "core/providers/cpu/tensor/utils.h"
 #include "core/framework/session_options.h"
 #include "core/framework/TensorSeq.h"
+#include "core/platform/threadpool.h"
 
 #include "gsl/gsl"
 
@@ -157,6 +158,15 @@ Loop::Info::Info(const onnxruntime::Node& node, const GraphViewer& subgraph_in)
     auto& output = subgraph_outputs[i];
     subgraph_output_names.push_back(output->Name());
   }
+
+  // an iteration depends on the previous one only through the condition and the loop carried
+  // values. if the body produces each of those by passing the matching subgraph input straight
+  // through (output and input are the same NodeArg, so the same name), every iteration sees
+  // identical feeds apart from the iteration number and they may run concurrently.
+  iterations_independent = subgraph_output_names[0] == subgraph_input_names[1];
+  for (int i = 0; iterations_independent && i < num_loop_carried_vars; ++i) {
+    iterations_independent = subgraph_output_names[i + 1] == subgraph_input_names[i + 2];
+  }
 }
 
 class LoopImpl {
@@ -178,6 +188,14 @@ class LoopImpl {
   void CreateInitialFeeds(std::vector<OrtValue>& feeds);
   void SaveOutputsAndUpdateFeeds(const std::vector<OrtValue>& last_outputs, std::vector<OrtValue>& next_inputs);
 
+  // whether the iterations can be run concurrently on the inter-op thread pool
+  bool CanRunIterationsInParallel() const;
+
+  // run all max_trip_count_ iterations concurrently, saving the scan outputs of all but the last
+  // iteration and handing the last iteration's fetches back for the shared epilogue
+  Status RunIterationsInParallel(const FeedsFetchesManager& ffm, const std::vector<OrtValue>& feeds,
+                                 std::vector<OrtValue>& fetches, int64_t& iter_num_value);
+
   // create the single Loop output from a collection of per-iteration outputs
   Status ConcatenateLoopOutput(std::vector<OrtValue>& per_iteration_output, int output_index);
 
@@ -187,6 +205,7 @@ class LoopImpl {
 
   int64_t max_trip_count_;
   bool condition_;
+  int iter_num_rank_ = 0;
 
   const std::vector<const OrtValue*>& implicit_inputs_;
 
@@ -395,14 +414,14 @@ Status LoopImpl::Initialize() {
   ORT_RETURN_IF(subgraph_inputs[1]->Shape() == nullptr, "Loop subgraph input 1 has unknown shape: ",
                 subgraph_inputs[1]->Name());
 
-  auto iter_num_rank = subgraph_inputs[0]->Shape()->dim_size();
+  iter_num_rank_ = subgraph_inputs[0]->Shape()->dim_size();
   auto condition_rank = subgraph_inputs[1]->Shape()->dim_size();
 
   // these need to be on CPU
   auto cpu_allocator = session_state_.GetExecutionProviders()
                            .Get(onnxruntime::kCpuExecutionProvider)
                            ->GetAllocator(0, OrtMemTypeDefault);
-  iter_num_mlvalue_ = MakeScalarMLValue<int64_t>(cpu_allocator, 0, iter_num_rank);
+  iter_num_mlvalue_ = MakeScalarMLValue<int64_t>(cpu_allocator, 0, iter_num_rank_);
   condition_mlvalue_ = MakeScalarMLValue<bool>(cpu_allocator, condition_, condition_rank);
 
   loop_output_tensors_.resize(info_.num_outputs - info_.num_loop_carried_vars);
@@ -464,6 +483,75 @@ Status LoopImpl::ConcatenateLoopOutput(std::vector<OrtValue>& per_iteration_outp
   return Status::OK();
 }
 
+bool LoopImpl::CanRunIterationsInParallel() const {
+  // requires: a body with no loop-carried dependence, a finite runtime trip count with an
+  // initially true pass-through condition (so the trip count is exactly max_trip_count_), CPU
+  // execution (no device stream whose ordering the iterations would have to share), and an
+  // inter-op pool to run the iterations on.
+  return info_.iterations_independent &&
+         stream_ == nullptr &&
+         condition_ &&
+         max_trip_count_ > 1 &&
+         max_trip_count_ != INT64_MAX &&
+         session_state_.GetInterOpThreadPool() != nullptr;
+}
+
+Status LoopImpl::RunIterationsInParallel(const FeedsFetchesManager& ffm, const std::vector<OrtValue>& feeds,
+                                         std::vector<OrtValue>& fetches, int64_t& iter_num_value) {
+  const auto num_iterations = static_cast<std::ptrdiff_t>(max_trip_count_);
+
+  auto cpu_allocator = session_state_.GetExecutionProviders()
+                           .Get(onnxruntime::kCpuExecutionProvider)
+                           ->GetAllocator(0, OrtMemTypeDefault);
+
+  std::vector<std::vector<OrtValue>> per_iteration_fetches(num_iterations);
+  std::vector<Status> statuses(num_iterations);
+
+  // each task runs one iteration in its own ExecutionFrame. look-ahead is bounded by the pool's
+  // degree of parallelism, as TrySimpleParallelFor never has more than that many tasks in flight.
+  // exceptions must not escape into the pool, so they are converted to a Status here.
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      session_state_.GetInterOpThreadPool(), num_iterations,
+      [&](std::ptrdiff_t iteration) {
+        ORT_TRY {
+          // feeds are identical apart from the iteration number. the pass-through loop carried
+          // values are only read by the body, so sharing them across iterations is safe.
+          std::vector<OrtValue> iteration_feeds = feeds;
+          iteration_feeds[0] = MakeScalarMLValue<int64_t>(cpu_allocator, static_cast<int64_t>(iteration),
+                                                          iter_num_rank_);
+          statuses[iteration] = utils::ExecuteSubgraph(session_state_, ffm, iteration_feeds,
+                                                       per_iteration_fetches[iteration], {},
+                                                       ExecutionMode::ORT_SEQUENTIAL, context_.GetTerminateFlag(),
+                                                       context_.Logger());
+        }
+        ORT_CATCH(const std::exception& ex) {
+          ORT_HANDLE_EXCEPTION([&]() {
+            statuses[iteration] = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+          });
+        }
+      });
+
+  for (std::ptrdiff_t iteration = 0; iteration < num_iterations; ++iteration) {
+    ORT_RETURN_IF_ERROR(statuses[iteration]);
+  }
+
+  // mirror the serial path: save the scan outputs of all but the last iteration here, and hand
+  // the last iteration's fetches back so the shared epilogue appends them and creates the Loop
+  // outputs.
+  for (std::ptrdiff_t iteration = 0; iteration < num_iterations - 1; ++iteration) {
+    for (int j = info_.num_loop_carried_vars; j < info_.num_outputs; ++j) {
+      ORT_RETURN_IF(!per_iteration_fetches[iteration][j + 1].IsTensor(), "All scan outputs MUST be tensors");
+      loop_output_tensors_[j - info_.num_loop_carried_vars].push_back(per_iteration_fetches[iteration][j + 1]);
+    }
+  }
+
+  fetches = std::move(per_iteration_fetches.back());
+  condition_mlvalue_ = fetches[0];
+  iter_num_value = max_trip_count_;
+
+  return Status::OK();
+}
+
 Status LoopImpl::Execute(const FeedsFetchesManager& ffm) {
   auto status = Status::OK();
 
@@ -474,25 +562,34 @@ Status LoopImpl::Execute(const FeedsFetchesManager& ffm) {
 
   auto& iter_num_value = *iter_num_mlvalue_.GetMutable<Tensor>()->MutableData<int64_t>();
 
-  while (iter_num_value < max_trip_count_ && *condition_mlvalue_.GetMutable<Tensor>()->MutableData<bool>()) {
-    if (iter_num_value != 0) {
-      SaveOutputsAndUpdateFeeds(fetches, feeds);
-      fetches.clear();
-    }
+  if (CanRunIterationsInParallel()) {
+    // no loop-carried dependence between iterations, so pipeline them across the inter-op pool
+    // instead of ping-ponging through the subgraph one iteration at a time
+    ORT_RETURN_IF_ERROR(RunIterationsInParallel(ffm, feeds, fetches, iter_num_value));
+  } else {
+    while (iter_num_value < max_trip_count_ && *condition_mlvalue_.GetMutable<Tensor>()->MutableData<bool>()) {
+      if (iter_num_value != 0) {
+        SaveOutputsAndUpdateFeeds(fetches, feeds);
+        fetches.clear();
+      }
 
-    status = utils::ExecuteSubgraph(session_state_, ffm, feeds, fetches, {},
-                                    ExecutionMode::ORT_SEQUENTIAL, context_.GetTerminateFlag(), context_.Logger());
+      status = utils::ExecuteSubgraph(session_state_, ffm, feeds, fetches, {},
+                                      ExecutionMode::ORT_SEQUENTIAL, context_.GetTerminateFlag(), context_.Logger());
 
-    ORT_RETURN_IF_ERROR(status);
+      ORT_RETURN_IF_ERROR(status);
 
-    condition_mlvalue_ = fetches[0];
+      condition_mlvalue_ = fetches[0];
 
-    ++iter_num_value;
+      ++iter_num_value;
+    }
   }
 
   // As the loop carried variables may change shape across iterations there's no way to avoid a copy
   // as we need the final shape.
-  auto copy_mlvalue_to_output = [this](OrtValue& input, int output_idx, int64_t iter_num_value) {
+  // The copies are gathered and issued as one batch per sequence and one batch for the loop
+  // carried variables so the data transfer can overlap them and synchronize once.
+  std::vector<IDataTransfer::SrcDstPair> batched_output_copies;
+  auto copy_mlvalue_to_output = [this, &batched_output_copies](OrtValue& input, int output_idx, int64_t iter_num_value) {
     if (input.IsTensor()) {
       const auto& data = input.Get<Tensor>();
       Tensor* output = context_.Output(output_idx, data.Shape());
@@ -500,7 +597,7 @@ Status LoopImpl::Execute(const FeedsFetchesManager& ffm) {
       // Loop on CUDA if the copy stream is the same as the compute stream.
       // So there is no explicit sync required between the compute and copy streams
       // to avoid data races.
-      session_state_.GetDataTransferMgr().CopyTensor(input.Get<Tensor>(), *output);
+      batched_output_copies.push_back({input.Get<Tensor>(), *output, 0});
     } else if (input.IsTensorSequence()) {
       if (iter_num_value != 0) {
         // We can move the subgraph outputs directly into the Loop's outputs.
@@ -522,14 +619,20 @@ Status LoopImpl::Execute(const FeedsFetchesManager& ffm) {
         }
         for (auto it = data.begin(), end = data.end(); it != end; ++it) {
           Tensor tmp(it->DataType(), onnxruntime::TensorShape(it->Shape()), alloc);
-          // Safely use the IDataTransfer abstraction as we only allow using
-          // Loop on CUDA if the copy stream is the same as the compute stream.
-          // So there is no explicit sync required between the compute and copy streams
-          // to avoid data races.
-          session_state_.GetDataTransferMgr().CopyTensor(*it, tmp);
           tensors.push_back(std::move(tmp));
         }
 
+        // Safely use the IDataTransfer abstraction as we only allow using
+        // Loop on CUDA if the copy stream is the same as the compute stream.
+        // So there is no explicit sync required between the compute and copy streams
+        // to avoid data races.
+        std::vector<IDataTransfer::SrcDstPair> seq_copies;
+        seq_copies.reserve(tensors.size());
+        for (size_t idx = 0; idx < tensors.size(); ++idx) {
+          seq_copies.push_back({data.Get(idx), tensors[idx], 0});
+        }
+        ORT_IGNORE_RETURN_VALUE(session_state_.GetDataTransferMgr().CopyTensors(seq_copies));
+
         output->SetElements(std::move(tensors));
       }
     }
@@ -586,6 +689,11 @@ Status LoopImpl::Execute(const FeedsFetchesManager& ffm) {
       ORT_IGNORE_RETURN_VALUE(context_.Output(i, TensorShape(output_dims)));
     }
   }
+
+  if (!batched_output_copies.empty()) {
+    ORT_RETURN_IF_ERROR(session_state_.GetDataTransferMgr().CopyTensors(batched_output_copies));
+  }
+
   return status;
 }
 }  // namespace onnxruntime
@@ -37,6 +37,11 @@ class Loop : public controlflow::IControlFlowKernel {
 
     std::vector<std::string> subgraph_input_names;
     std::vector<std::string> subgraph_output_names;
+
+    // true if the body passes the condition and all loop carried values straight through to the
+    // matching subgraph outputs, so no iteration depends on the previous one and iterations may
+    // run concurrently.
+    bool iterations_independent{false};
   };
 
   // function to concatenate the OrtValue instances from each Loop iteration into a single output buffer.
@@ -18,6 +18,8 @@
 #include "core/framework/sequential_executor.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
+#include "core/graph/constants.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/cpu/controlflow/utils.h"
 #include "core/framework/session_options.h"
 
@@ -207,6 +209,22 @@ Status IterateSequence(OpKernelContextInternal& context, const SessionState& ses
     feeds[num_variadic_inputs + i] = *implicit_inputs[i];
   }
 
+  // a scan with no loop state variables is stateless: no slice depends on any other, so once the
+  // first iteration has discovered and allocated any symbolically shaped final output, the
+  // remaining slices can execute as a parallel-for over the intra-op pool. building the
+  // per-iteration feeds and fetches only manipulates slicing metadata, so that still happens
+  // serially below; only the subgraph executions are deferred and run concurrently.
+  // restricted to CPU-only execution as device providers assume a single in-order submission
+  // stream.
+  concurrency::ThreadPool* tp = session_state.GetThreadPool();
+  const auto& provider_ids = session_state.GetExecutionProviders().GetIds();
+  bool parallelize_slices = num_loop_state_variables == 0 && seq_length > 2 && tp != nullptr &&
+                            std::all_of(provider_ids.cbegin(), provider_ids.cend(),
+                                        [](const std::string& id) { return id == kCpuExecutionProvider; });
+
+  std::vector<std::vector<OrtValue>> deferred_feeds;
+  std::vector<std::vector<OrtValue>> deferred_fetches;
+
   int64_t seq_no = 0;
   for (; seq_no < seq_length; ++seq_no) {
     for (int input = 0; input < num_variadic_inputs; ++input) {
@@ -268,11 +286,18 @@ Status IterateSequence(OpKernelContextInternal& context, const SessionState& ses
       }
     }
 
-    // Create Executor and run graph.
-    status = utils::ExecuteSubgraph(session_state, ffm, feeds, fetches, fetch_allocators,
-                                    ExecutionMode::ORT_SEQUENTIAL, context.GetTerminateFlag(), context.Logger());
+    if (parallelize_slices && seq_no > 0) {
+      // stateless scan: past the first iteration every fetch is a pre-sliced view of the final
+      // output, so execution can be deferred and run concurrently once all slices are gathered
+      deferred_feeds.push_back(feeds);
+      deferred_fetches.push_back(fetches);
+    } else {
+      // Create Executor and run graph.
+      status = utils::ExecuteSubgraph(session_state, ffm, feeds, fetches, fetch_allocators,
+                                      ExecutionMode::ORT_SEQUENTIAL, context.GetTerminateFlag(), context.Logger());
 
-    ORT_RETURN_IF_ERROR(status);
+      ORT_RETURN_IF_ERROR(status);
+    }
 
     // cycle the LoopStateVariable input/output in preparation for the next iteration
     std::for_each(loop_state_variables.begin(), loop_state_variables.end(), [](LoopStateVariable& v) { v.Next(); });
@@ -288,6 +313,32 @@ Status IterateSequence(OpKernelContextInternal& context, const SessionState& ses
     }
   }
 
+  if (!deferred_feeds.empty()) {
+    std::vector<Status> statuses(deferred_feeds.size());
+
+    // one task per slice, each running the subgraph in its own ExecutionFrame and writing
+    // straight into its slice of the final output. exceptions must not escape into the pool,
+    // so they are converted to a Status here.
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        tp, static_cast<std::ptrdiff_t>(deferred_feeds.size()),
+        [&](std::ptrdiff_t idx) {
+          ORT_TRY {
+            statuses[idx] = utils::ExecuteSubgraph(session_state, ffm, deferred_feeds[idx], deferred_fetches[idx],
+                                                   {}, ExecutionMode::ORT_SEQUENTIAL, context.GetTerminateFlag(),
+                                                   context.Logger());
+          }
+          ORT_CATCH(const std::exception& ex) {
+            ORT_HANDLE_EXCEPTION([&]() {
+              statuses[idx] = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+            });
+          }
+        });
+
+    for (const auto& iteration_status : statuses) {
+      ORT_RETURN_IF_ERROR(iteration_status);
+    }
+  }
+
   return status;
 }
 
@@ -104,15 +104,34 @@ struct Clip::ComputeImpl {
   }
 };
 
+// writes the direct-dispatch function pointer for T; captureless lambda so it converts to a
+// plain function pointer
+template <typename T>
+struct Clip::GetComputeFn {
+  void operator()(void (*&out)(const Tensor*, const Tensor*, const Tensor*, Tensor*)) const {
+    out = [](const Tensor* X, const Tensor* min, const Tensor* max, Tensor* Y) {
+      ComputeImpl<T>{}(X, min, max, Y);
+    };
+  }
+};
+
+Clip::Clip(const OpKernelInfo& info) : OpKernel(info) {
+  // the element type is statically known, so run the type dispatch once here instead of on every
+  // Compute call
+  const auto* input_type = info.GetInputType(0);
+  ORT_ENFORCE(input_type != nullptr && input_type->has_tensor_type(), "Clip input must be a tensor");
+
+  utils::MLTypeCallDispatcherFromTypeList<AllEnabledClipTypes> t_disp(input_type->tensor_type().elem_type());
+  t_disp.Invoke<GetComputeFn>(compute_fn_);
+}
+
 Status Clip::Compute(OpKernelContext* ctx) const {
   const auto* X = ctx->Input<Tensor>(0);
   const auto* min = ctx->Input<Tensor>(1);
   const auto* max = ctx->Input<Tensor>(2);
   Tensor* Y = ctx->Output(0, X->Shape());
 
-  utils::MLTypeCallDispatcherFromTypeList<AllEnabledClipTypes> t_disp(X->GetElementType());
-
-  t_disp.Invoke<ComputeImpl>(X, min, max, Y);
+  compute_fn_(X, min, max, Y);
 
   return Status::OK();
 }
@@ -42,14 +42,20 @@ class Clip_6 final : public clip_internal::Clip_6Base<T>, public OpKernel {
 // version 12 adds type support
 class Clip final : public OpKernel {
  public:
-  explicit Clip(const OpKernelInfo& info) : OpKernel(info) {
-  }
+  explicit Clip(const OpKernelInfo& info);
 
   Status Compute(OpKernelContext* ctx) const override;
 
  private:
   template <typename T>
   struct ComputeImpl;
+
+  template <typename T>
+  struct GetComputeFn;
+
+  // compute body for the statically known element type, resolved once at kernel creation so
+  // Compute dispatches directly
+  void (*compute_fn_)(const Tensor* X, const Tensor* min, const Tensor* max, Tensor* Y) = nullptr;
 };
 
 }  // namespace onnxruntime
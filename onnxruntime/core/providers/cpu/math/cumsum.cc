@@ -3,49 +3,97 @@
 
 #include "cumsum.h"
 #include "core/providers/common.h"
-#include "core/providers/cpu/tensor/utils.h"
+#include "core/platform/threadpool.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/tensorprotoutils.h"
+#include "core/util/math_cpuonly.h"
 
 using namespace onnxruntime;
 
 namespace {
 // static section
-std::vector<int64_t> GetStarts(int64_t rank, int64_t axis, int64_t index) {
-  std::vector<int64_t> starts(rank, 0);
-  starts[axis] = index;
-  return starts;
-}
+
+// A parallel scan block should amortize the extra pass over the data it costs.
+constexpr int64_t kMinimumElementsPerBlock = 16384;
+
+// Scans 'count' values spaced 'step' elements apart. A negative step with the pointers at the
+// last value of the axis yields the 'reverse' variant.
 template <typename T>
-void ZeroOutSliceAtIndex(Tensor& output, int64_t rank, int64_t axis, int64_t index,
-                         const std::vector<int64_t>& slice_dims, const std::vector<int64_t>& steps, const int64_t slice_size) {
-  T zero{};
-  auto output_starts(GetStarts(rank, axis, index));
-  WritableSliceIterator<T> output_iterator(output, output_starts, slice_dims, steps);
-  for (int64_t k = 0; k < slice_size; ++k, ++output_iterator) {
-    *output_iterator = zero;
+void ScanColumn(const T* input, T* output, int64_t count, int64_t step, bool exclusive) {
+  T running{};
+  if (exclusive) {
+    for (int64_t i = 0; i < count; ++i) {
+      const T value = input[i * step];
+      output[i * step] = running;
+      running += value;
+    }
+  } else {
+    for (int64_t i = 0; i < count; ++i) {
+      running += input[i * step];
+      output[i * step] = running;
+    }
   }
 }
+
+// Scans 'count' contiguous rows of 'row_len' values spaced 'step' elements apart, keeping the
+// adds vectorized across the row.
 template <typename T>
-void CopySlices(const Tensor& input, Tensor& output,
-                const std::vector<int64_t>& input_starts, const std::vector<int64_t>& output_starts,
-                const std::vector<int64_t>& slice_dims, const std::vector<int64_t>& steps, const int64_t slice_size) {
-  SliceIterator<T> input_iterator(input, input_starts, slice_dims, steps);
-  WritableSliceIterator<T> output_iterator(output, output_starts, slice_dims, steps);
-  for (int64_t k = 0; k < slice_size; ++k, ++output_iterator, ++input_iterator) {
-    *output_iterator = *input_iterator;
+void ScanRows(const T* input, T* output, int64_t count, int64_t step, int64_t row_len, bool exclusive) {
+  if (exclusive) {
+    EigenVectorArrayMap<T>(output, row_len).setZero();
+    for (int64_t i = 1; i < count; ++i) {
+      EigenVectorArrayMap<T>(output + i * step, row_len) =
+          ConstEigenVectorArrayMap<T>(output + (i - 1) * step, row_len) +
+          ConstEigenVectorArrayMap<T>(input + (i - 1) * step, row_len);
+    }
+  } else {
+    EigenVectorArrayMap<T>(output, row_len) = ConstEigenVectorArrayMap<T>(input, row_len);
+    for (int64_t i = 1; i < count; ++i) {
+      EigenVectorArrayMap<T>(output + i * step, row_len) =
+          ConstEigenVectorArrayMap<T>(output + (i - 1) * step, row_len) +
+          ConstEigenVectorArrayMap<T>(input + i * step, row_len);
+    }
   }
 }
+
+// Two-pass blocked parallel scan: each block scans locally, the block totals are scanned
+// serially to produce each block's carry, and a second parallel pass adds the carries in.
 template <typename T>
-void SumSlices(const Tensor& input, Tensor& output,
-               const std::vector<int64_t>& input_starts, const std::vector<int64_t>& output_starts, const std::vector<int64_t>& previous_output_starts,
-               const std::vector<int64_t>& slice_dims, const std::vector<int64_t>& steps, const int64_t slice_size) {
-  SliceIterator<T> input_iterator(input, input_starts, slice_dims, steps);
-  WritableSliceIterator<T> output_iterator(output, output_starts, slice_dims, steps);
-  SliceIterator<T> previous_output_iterator(output, previous_output_starts, slice_dims, steps);
-  for (int64_t k = 0; k < slice_size; ++k, ++output_iterator, ++input_iterator, ++previous_output_iterator) {
-    *output_iterator = *input_iterator + *previous_output_iterator;
+void ParallelScanColumn(const T* input, T* output, int64_t count, int64_t step, bool exclusive,
+                        int64_t n_blocks, concurrency::ThreadPool* tp) {
+  std::vector<T> block_totals(n_blocks);
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(n_blocks),
+      [&](std::ptrdiff_t block) {
+        const int64_t begin = block * count / n_blocks;
+        const int64_t end = (block + 1) * count / n_blocks;
+        ScanColumn(input + begin * step, output + begin * step, end - begin, step, exclusive);
+        // the carry a later block needs is the plain sum of this block's inputs
+        T total = output[(end - 1) * step];
+        if (exclusive) {
+          total += input[(end - 1) * step];
+        }
+        block_totals[block] = total;
+      });
+
+  std::vector<T> carries(n_blocks);
+  carries[0] = T{};
+  for (int64_t block = 1; block < n_blocks; ++block) {
+    carries[block] = carries[block - 1] + block_totals[block - 1];
   }
+
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(n_blocks),
+      [&](std::ptrdiff_t block) {
+        if (block == 0)
+          return;  // the first block already holds its final values
+        const int64_t begin = block * count / n_blocks;
+        const int64_t end = (block + 1) * count / n_blocks;
+        const T carry = carries[block];
+        for (int64_t i = begin; i < end; ++i) {
+          output[i * step] += carry;
+        }
+      });
 }
 }  // namespace
 
@@ -184,60 +232,61 @@ Status CumSum<T>::Compute(OpKernelContext* ctx) const {
   int64_t axis = 0;
   ORT_THROW_IF_ERROR(cumsum_op::GetAxis(axis_tensor, rank, axis));
 
-  auto dim(output_tensor.Shape()[axis]);    // dimension size for the axis
-  TensorShape slice_shape(input->Shape());  // the shape of one slice of input/output for the given value of the axis
-  slice_shape[axis] = 1;
-  auto slice_size(slice_shape.Size());     // total number of elements in each slice
-  auto slice_dims(slice_shape.GetDims());  // dim array for the slice
+  // View the tensor as [batches, dim, inner]: 'dim' values spaced 'inner' elements apart are
+  // scanned for each of the 'batches * inner' independent columns.
+  const auto& input_shape = input->Shape();
+  const int64_t batches = input_shape.SizeToDimension(axis);
+  const int64_t dim = input_shape[axis];  // dimension size for the axis
+  const int64_t inner = input_shape.SizeFromDimension(axis + 1);
+  const int64_t batch_stride = dim * inner;
 
-  std::vector<int64_t> steps(rank, 1);  // steps for the slice -- always set to 1
+  // Walk the axis backwards for the 'reverse' variant by starting each column at its last
+  // value with a negated step.
+  const int64_t step = reverse_ ? -inner : inner;
+  const int64_t start_offset = reverse_ ? (dim - 1) * inner : 0;
+  const bool exclusive = exclusive_ != 0;
 
-  if (!reverse_) {
-    int64_t index(0);  // the index we use as we walkthrough the given axis
-    // If (exclusive == true) the first slice is always 0
-    if (exclusive_) {
-      ::ZeroOutSliceAtIndex<T>(output_tensor, rank, axis, index, slice_dims, steps, slice_size);
-      ++index;
-    }
-    {
-      // The next slice is a copy of the input (if exclusive == false then this is the first slice)
-      auto input_starts(::GetStarts(rank, axis, 0));
-      auto output_starts(::GetStarts(rank, axis, index));
-      ::CopySlices<T>(*input, output_tensor, input_starts, output_starts, slice_dims, steps, slice_size);
-      ++index;
-    }
+  const T* input_data = input->Data<T>();
+  T* output_data = output_tensor.MutableData<T>();
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
 
-    for (; index < dim; ++index) {
-      // Each output slice is the sum of corresponding input slice and the previous output slice
-      auto input_starts(::GetStarts(rank, axis, exclusive_ ? index - 1 : index));
-      auto output_starts(::GetStarts(rank, axis, index));
-      auto previous_starts(::GetStarts(rank, axis, index - 1));
-      ::SumSlices<T>(*input, output_tensor, input_starts, output_starts, previous_starts,
-                     slice_dims, steps, slice_size);
-    }
+  if (inner > 1) {
+    // The scan step is a vector add across the inner dimension. Parallelize over the
+    // independent columns, handing each worker a contiguous sub-row.
+    concurrency::ThreadPool::TryParallelFor(
+        tp, batches * inner,
+        TensorOpCost{static_cast<double>(dim * sizeof(T)), static_cast<double>(dim * sizeof(T)),
+                     static_cast<double>(dim)},
+        [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+          while (first < last) {
+            const int64_t batch = first / inner;
+            const int64_t col_begin = first % inner;
+            const int64_t col_end = std::min<int64_t>(inner, col_begin + (last - first));
+            const int64_t offset = batch * batch_stride + start_offset + col_begin;
+            ScanRows(input_data + offset, output_data + offset, dim, step, col_end - col_begin, exclusive);
+            first += col_end - col_begin;
+          }
+        });
   } else {
-    //_reverse == true
-    int64_t index(dim - 1);  // the index we use as we walkthrough the given axis
-    // If (exclusive == true) the first slice is always 0
-    if (exclusive_) {
-      ::ZeroOutSliceAtIndex<T>(output_tensor, rank, axis, index, slice_dims, steps, slice_size);
-      --index;
-    }
-    {
-      // The next slice is a copy of the input (if exclusive == false then this is the first slice)
-      auto input_starts(::GetStarts(rank, axis, dim - 1));
-      auto output_starts(::GetStarts(rank, axis, index));
-      ::CopySlices<T>(*input, output_tensor, input_starts, output_starts, slice_dims, steps, slice_size);
-      --index;
-    }
-
-    for (; index >= 0; --index) {
-      // Each output slice is the sum of corresponding input slice and the previous output slice
-      auto input_starts(::GetStarts(rank, axis, exclusive_ ? index + 1 : index));
-      auto output_starts(::GetStarts(rank, axis, index));
-      auto previous_starts(::GetStarts(rank, axis, index + 1));
-      ::SumSlices<T>(*input, output_tensor, input_starts, output_starts, previous_starts,
-                     slice_dims, steps, slice_size);
+    const int64_t degree = concurrency::ThreadPool::DegreeOfParallelism(tp);
+    const int64_t n_blocks = std::min<int64_t>(degree, dim / kMinimumElementsPerBlock);
+    if (batches < degree && n_blocks >= 2) {
+      // Too few batches to keep the pool busy, so split the axis itself with a blocked scan.
+      for (int64_t batch = 0; batch < batches; ++batch) {
+        const int64_t offset = batch * batch_stride + start_offset;
+        ParallelScanColumn(input_data + offset, output_data + offset, dim, step, exclusive, n_blocks, tp);
+      }
+    } else {
+      concurrency::ThreadPool::TryParallelFor(
+          tp, batches,
+          TensorOpCost{static_cast<double>(dim * sizeof(T)), static_cast<double>(dim * sizeof(T)),
+                       static_cast<double>(dim)},
+          [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+            for (std::ptrdiff_t batch = first; batch < last; ++batch) {
+              const int64_t offset = batch * batch_stride + start_offset;
+              ScanColumn(input_data + offset, output_data + offset, dim, step, exclusive);
+            }
+          });
     }
   }
 
@@ -18,6 +18,7 @@ class Einsum : public OpKernel {
     ORT_ENFORCE(info.GetAttr<std::string>("equation", &equation_).IsOK(),
                 "Missing 'equation' attribute");
     einsum_equation_preprocessor_ = std::make_unique<EinsumEquationPreprocessor>(equation_);
+    DetectMatMulPlan();
   }
 
   virtual Status Compute(OpKernelContext* context) const override;
@@ -29,6 +30,95 @@ class Einsum : public OpKernel {
 
   std::string equation_;
   std::unique_ptr<EinsumEquationPreprocessor> einsum_equation_preprocessor_;
+
+  // Plan for two-operand contractions that are batched MatMuls in disguise
+  // (e.g. 'bij,bjk->bik' or 'bij,bkj->bik'). Derived once from the equation at kernel
+  // construction so Compute() only has to validate dims before lowering to GEMM directly.
+  struct MatMulPlan {
+    bool valid = false;
+    bool trans_a = false;
+    bool trans_b = false;
+    size_t num_batch_dims = 0;
+  };
+
+  MatMulPlan matmul_plan_;
+
+  // Used by the CPU kernel's DeviceCompute. Returns true if the fast path handled the node
+  // (in which case 'status' holds its result), false to use the general implementation.
+  bool TryMatMulFastPath(OpKernelContext* context, const std::vector<const Tensor*>& inputs,
+                         concurrency::ThreadPool* tp, Status& status) const;
+
+ private:
+  // Matches equations of the form '<batch>XY,<batch>YZ-><batch>XZ' where the batch labels
+  // (possibly none) appear as an identical prefix in both terms and the output, and the
+  // trailing two labels of each term form a single contraction in either orientation.
+  void DetectMatMulPlan() {
+    const auto& parsed = *einsum_equation_preprocessor_;
+    if (!parsed.is_explicit_ || parsed.left_equation_split_.size() != 2) {
+      return;
+    }
+
+    const std::string& term_a = parsed.left_equation_split_[0];
+    const std::string& term_b = parsed.left_equation_split_[1];
+    const std::string& output = parsed.right_equation_;
+
+    if (output.size() < 2 || term_a.size() != output.size() || term_b.size() != output.size()) {
+      return;
+    }
+
+    // each subscript must be a plain letter appearing at most once per term (no ellipsis/diagonals)
+    auto all_unique_letters = [](const std::string& term) {
+      bool seen[EinsumOp::num_of_letters] = {};
+      for (char ch : term) {
+        int64_t index = EinsumOp::LetterToIndex(ch);
+        if (index == -1 || seen[index]) {
+          return false;
+        }
+        seen[index] = true;
+      }
+      return true;
+    };
+
+    if (!all_unique_letters(term_a) || !all_unique_letters(term_b) || !all_unique_letters(output)) {
+      return;
+    }
+
+    size_t num_batch_dims = output.size() - 2;
+    if (term_a.compare(0, num_batch_dims, output, 0, num_batch_dims) != 0 ||
+        term_b.compare(0, num_batch_dims, output, 0, num_batch_dims) != 0) {
+      return;
+    }
+
+    const char m_label = output[num_batch_dims];
+    const char n_label = output[num_batch_dims + 1];
+
+    char k_label;
+    if (term_a[num_batch_dims] == m_label) {
+      k_label = term_a[num_batch_dims + 1];
+      matmul_plan_.trans_a = false;
+    } else if (term_a[num_batch_dims + 1] == m_label) {
+      k_label = term_a[num_batch_dims];
+      matmul_plan_.trans_a = true;
+    } else {
+      return;
+    }
+
+    if (term_b[num_batch_dims] == k_label && term_b[num_batch_dims + 1] == n_label) {
+      matmul_plan_.trans_b = false;
+    } else if (term_b[num_batch_dims] == n_label && term_b[num_batch_dims + 1] == k_label) {
+      matmul_plan_.trans_b = true;
+    } else {
+      return;
+    }
+
+    // the contraction label must not appear in the output (including the batch prefix)
+    if (output.find(k_label) != std::string::npos) {
+      return;
+    }
+
+    matmul_plan_.num_batch_dims = num_batch_dims;
+    matmul_plan_.valid = true;
+  }
 };
 
 }  // namespace onnxruntime
@@ -81,12 +81,18 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
 }
 }  // namespace functors
 
+// all the kernels registered via these macros compute their output one element at a time from the
+// same index of input 0, so the output may share input 0's buffer when the shapes match (i.e. no
+// broadcast along input 0). the allocation planner only applies MayInplace when the sizes match
+// statically and the node is the last consumer of the input, so declaring it is always safe.
 #define REG_ELEMENTWISE_TYPED_KERNEL(OP_TYPE, VERSION, TYPE, KERNEL_CLASS)         \
   ONNX_CPU_OPERATOR_TYPED_KERNEL(                                                  \
       OP_TYPE,                                                                     \
       VERSION,                                                                     \
       TYPE,                                                                        \
-      KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>()), \
+      KernelDefBuilder()                                                           \
+          .MayInplace(0, 0)                                                        \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>()),               \
       KERNEL_CLASS<TYPE>);
 
 #define REG_ELEMENTWISE_LOGICALOP_TYPED_KERNEL(OP_TYPE, VERSION, TYPE, KERNEL_CLASS) \
@@ -104,7 +110,9 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
       OP_TYPE,                                                                                        \
       VERSION_FROM, VERSION_TO,                                                                       \
       TYPE,                                                                                           \
-      KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>()),                    \
+      KernelDefBuilder()                                                                              \
+          .MayInplace(0, 0)                                                                           \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>()),                                  \
       KERNEL_CLASS<TYPE>);
 
 #define REG_ELEMENTWISE_LOGICALOP_VERSIONED_TYPED_KERNEL(OP_TYPE, VERSION_FROM, VERSION_TO, TYPE, KERNEL_CLASS) \
@@ -122,6 +130,7 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
       OP_TYPE,                                                                                              \
       VERSION,                                                                                              \
       KernelDefBuilder()                                                                                    \
+          .MayInplace(0, 0)                                                                                 \
           .TypeConstraint("T", CONSTRAINTS, ENABLED_TYPES_CONSTRAINTS),                                     \
       KERNEL_CLASS);
 
@@ -132,6 +141,7 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
       VERSION_FROM,                                                                            \
       VERSION_TO,                                                                              \
       KernelDefBuilder()                                                                       \
+          .MayInplace(0, 0)                                                                    \
           .TypeConstraint("T", CONSTRAINTS, ENABLED_TYPES_CONSTRAINTS),                        \
       KERNEL_CLASS);
 
@@ -142,6 +152,7 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
       OP_TYPE,                                                                      \
       VERSION,                                                                      \
       KernelDefBuilder()                                                            \
+          .MayInplace(0, 0)                                                         \
           .TypeConstraint("T", T1_CONSTRAINTS, T1_ENABLED_TYPES_CONSTRAINTS)        \
           .TypeConstraint("T1", T2_CONSTRAINTS, T2_ENABLED_TYPES_CONSTRAINTS),      \
       KERNEL_CLASS);
@@ -154,6 +165,7 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
       VERSION_FROM,                                                                              \
       VERSION_TO,                                                                                \
       KernelDefBuilder()                                                                         \
+          .MayInplace(0, 0)                                                                      \
           .TypeConstraint("T", T1_CONSTRAINTS, T1_ENABLED_TYPES_CONSTRAINTS)                     \
           .TypeConstraint("T1", T2_CONSTRAINTS, T2_ENABLED_TYPES_CONSTRAINTS),                   \
       KERNEL_CLASS);
@@ -432,7 +444,7 @@ Status Add<T>::Compute(OpKernelContext* context) const {
         per_iter_bh.OutputEigen<T>() = per_iter_bh.EigenInput0<T>() + per_iter_bh.EigenInput1<T>();
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0f);
+  UntypedBroadcastTwo(*context, funcs, 1.0f, nullptr, &broadcast_program_cache_);
   return Status::OK();
 }
 
@@ -449,7 +461,7 @@ Status Sub<T>::Compute(OpKernelContext* context) const {
         per_iter_bh.OutputEigen<T>() = per_iter_bh.EigenInput0<T>() - per_iter_bh.EigenInput1<T>();
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0);
+  UntypedBroadcastTwo(*context, funcs, 1.0, nullptr, &broadcast_program_cache_);
   return Status::OK();
 }
 
@@ -466,7 +478,7 @@ Status Mul<T>::Compute(OpKernelContext* context) const {
         per_iter_bh.OutputEigen<T>() = per_iter_bh.EigenInput0<T>().cwiseProduct(per_iter_bh.EigenInput1<T>());
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0);
+  UntypedBroadcastTwo(*context, funcs, 1.0, nullptr, &broadcast_program_cache_);
   return Status::OK();
 }
 
@@ -483,7 +495,7 @@ Status Div<T>::Compute(OpKernelContext* context) const {
         per_iter_bh.OutputEigen<T>() = per_iter_bh.EigenInput0<T>().cwiseQuotient(per_iter_bh.EigenInput1<T>());
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0);
+  UntypedBroadcastTwo(*context, funcs, 1.0, nullptr, &broadcast_program_cache_);
   return Status::OK();
 }
 
@@ -540,60 +552,64 @@ void PowImpl(OpKernelContext& context) {
   UntypedBroadcastTwo(context, funcs, 1.0);
 }
 
+using PowComputeFn = void (*)(OpKernelContext&);
+
 template <typename B>
-Status DispatchOnBase(OpKernelContext& context, const Tensor& Y) {
+PowComputeFn ResolveOnExponent(int32_t exponent_type) {
   namespace on = ONNX_NAMESPACE;
-  Status s;
-  switch (Y.GetElementType()) {
+  switch (exponent_type) {
     case on::TensorProto_DataType_INT32:
-      PowImpl<B, int32_t>(context);
-      break;
+      return &PowImpl<B, int32_t>;
     case on::TensorProto_DataType_INT64:
-      PowImpl<B, int64_t>(context);
-      break;
+      return &PowImpl<B, int64_t>;
     case on::TensorProto_DataType_FLOAT:
-      PowImpl<B, float>(context);
-      break;
+      return &PowImpl<B, float>;
     case on::TensorProto_DataType_DOUBLE:
-      PowImpl<B, double>(context);
-      break;
+      return &PowImpl<B, double>;
     default:
-      s = ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Unsupported Y type: ",
-                          DataTypeImpl::ToString(Y.DataType()));
+      return nullptr;
   }
-  return s;
 }
 
-}  // namespace pow_internal
-
-Status
-Pow::Compute(OpKernelContext* context) const {
-  const Tensor& X = *context->Input<Tensor>(0);
-  const Tensor& Y = *context->Input<Tensor>(1);
-
+PowComputeFn ResolvePow(int32_t base_type, int32_t exponent_type) {
   namespace on = ONNX_NAMESPACE;
-  using namespace pow_internal;
-
-  Status s;
-  // Switch on base type first
-  switch (X.GetElementType()) {
+  switch (base_type) {
     case on::TensorProto_DataType_INT32:
-      s = DispatchOnBase<int32_t>(*context, Y);
-      break;
+      return ResolveOnExponent<int32_t>(exponent_type);
     case on::TensorProto_DataType_INT64:
-      s = DispatchOnBase<int64_t>(*context, Y);
-      break;
+      return ResolveOnExponent<int64_t>(exponent_type);
     case on::TensorProto_DataType_FLOAT:
-      s = DispatchOnBase<float>(*context, Y);
-      break;
+      return ResolveOnExponent<float>(exponent_type);
     case on::TensorProto_DataType_DOUBLE:
-      s = DispatchOnBase<double>(*context, Y);
-      break;
+      return ResolveOnExponent<double>(exponent_type);
     default:
-      s = ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Unsupported X type: ",
-                          DataTypeImpl::ToString(X.DataType()));
+      return nullptr;
+  }
+}
+
+}  // namespace pow_internal
+
+Pow::Pow(const OpKernelInfo& info) : OpKernel(info) {
+  // the base and exponent element types are statically known, so the nested type switches run
+  // once here rather than on every Compute call
+  const auto* x_type = info.GetInputType(0);
+  const auto* y_type = info.GetInputType(1);
+  if (x_type != nullptr && x_type->has_tensor_type() && y_type != nullptr && y_type->has_tensor_type()) {
+    compute_fn_ = pow_internal::ResolvePow(x_type->tensor_type().elem_type(),
+                                           y_type->tensor_type().elem_type());
+  }
+}
+
+Status
+Pow::Compute(OpKernelContext* context) const {
+  if (compute_fn_ == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Unsupported X or Y type. X: ",
+                           DataTypeImpl::ToString(context->Input<Tensor>(0)->DataType()),
+                           " Y: ", DataTypeImpl::ToString(context->Input<Tensor>(1)->DataType()));
   }
-  return s;
+
+  compute_fn_(*context);
+  return Status::OK();
 }
 
 template <typename T>
@@ -937,7 +953,7 @@ Status Equal<T>::Compute(OpKernelContext* context) const {
             per_iter_bh.EigenInput0<T>().array() == per_iter_bh.EigenInput1<T>().array();
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0);
+  UntypedBroadcastTwo(*context, funcs, 1.0, nullptr, &broadcast_program_cache_);
   return Status::OK();
 }
 
@@ -954,7 +970,7 @@ Status Less<T>::Compute(OpKernelContext* context) const {
         per_iter_bh.OutputEigen<bool>() = per_iter_bh.EigenInput0<T>().array() < per_iter_bh.EigenInput1<T>().array();
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0);
+  UntypedBroadcastTwo(*context, funcs, 1.0, nullptr, &broadcast_program_cache_);
   return Status::OK();
 }
 
@@ -972,7 +988,7 @@ Status Greater<T>::Compute(OpKernelContext* context) const {
             per_iter_bh.EigenInput0<T>().array() > per_iter_bh.EigenInput1<T>().array();
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0);
+  UntypedBroadcastTwo(*context, funcs, 1.0, nullptr, &broadcast_program_cache_);
   return Status::OK();
 }
 
@@ -989,7 +1005,7 @@ Status LessOrEqual<T>::Compute(OpKernelContext* context) const {
         per_iter_bh.OutputEigen<bool>() = per_iter_bh.EigenInput0<T>().array() <= per_iter_bh.EigenInput1<T>().array();
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0);
+  UntypedBroadcastTwo(*context, funcs, 1.0, nullptr, &broadcast_program_cache_);
   return Status::OK();
 }
 
@@ -1007,7 +1023,7 @@ Status GreaterOrEqual<T>::Compute(OpKernelContext* context) const {
             per_iter_bh.EigenInput0<T>().array() >= per_iter_bh.EigenInput1<T>().array();
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0);
+  UntypedBroadcastTwo(*context, funcs, 1.0, nullptr, &broadcast_program_cache_);
   return Status::OK();
 }
 
@@ -1540,21 +1556,21 @@ Status Erf<float>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+namespace mod_internal {
+using ModComputeFn = void (*)(bool fmod, OpKernelContext* ctx);
+}
+
 class Mod final : public OpKernel {
  public:
-  Mod(const OpKernelInfo& info) : OpKernel(info) {
-    int64_t fmod = 0;
-    Status s = info.GetAttr<int64_t>("fmod", &fmod);
-    if (s.IsOK()) {
-      ORT_ENFORCE((fmod == 0) || (fmod == 1), "fmod must have value either 0 or 1");
-      fmod_ = (fmod == 1);
-    }
-  }
+  Mod(const OpKernelInfo& info);
 
   Status Compute(OpKernelContext* context) const override;
 
  private:
   bool fmod_{false};
+
+  // compute body for the statically known element type, resolved once at kernel creation
+  mod_internal::ModComputeFn compute_fn_ = nullptr;
 };
 
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
@@ -1734,15 +1750,36 @@ struct CallModImpl<MLFloat16> {
   }
 };
 
+// writes the direct-dispatch function pointer for T; captureless lambda so it converts to a
+// plain function pointer
+template <class T>
+struct GetModComputeFn {
+  void operator()(ModComputeFn& out) const {
+    out = [](bool fmod, OpKernelContext* ctx) { CallModImpl<T>{}(fmod, ctx); };
+  }
+};
+
 }  // namespace mod_internal
 
-Status Mod::Compute(OpKernelContext* context) const {
-  const auto& X = *context->Input<Tensor>(0);
-  const auto dt_type = X.GetElementType();
+Mod::Mod(const OpKernelInfo& info) : OpKernel(info) {
+  int64_t fmod = 0;
+  Status s = info.GetAttr<int64_t>("fmod", &fmod);
+  if (s.IsOK()) {
+    ORT_ENFORCE((fmod == 0) || (fmod == 1), "fmod must have value either 0 or 1");
+    fmod_ = (fmod == 1);
+  }
 
-  utils::MLTypeCallDispatcherFromTypeList<EnabledModTypes> t_disp(dt_type);
-  t_disp.Invoke<mod_internal::CallModImpl>(fmod_, context);
+  // the element type is statically known, so run the type dispatch once here instead of on every
+  // Compute call
+  const auto* x_type = info.GetInputType(0);
+  ORT_ENFORCE(x_type != nullptr && x_type->has_tensor_type(), "Mod input must be a tensor");
 
+  utils::MLTypeCallDispatcherFromTypeList<EnabledModTypes> t_disp(x_type->tensor_type().elem_type());
+  t_disp.Invoke<mod_internal::GetModComputeFn>(compute_fn_);
+}
+
+Status Mod::Compute(OpKernelContext* context) const {
+  compute_fn_(fmod_, context);
   return Status::OK();
 }
 
@@ -1752,8 +1789,22 @@ Status Mod::Compute(OpKernelContext* context) const {
 // Type specific logic is plugged in via the functions in ProcessBroadcastSpanFuncs.
 // Optional user_data can be provided, and will be available to the ProcessSpanFunc implementations
 // via BroadcastHelper.GetUserData().
-void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, void* user_data) {
-  InputBroadcaster input_broadcaster(*context.Input<Tensor>(0), *context.Input<Tensor>(1));
+BroadcastProgramCache::BroadcastProgramCache() = default;
+BroadcastProgramCache::~BroadcastProgramCache() = default;
+
+Broadcaster BroadcastProgramCache::Get(const std::vector<int64_t>& shape0, const std::vector<int64_t>& shape1) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  if (!program_ || shape0 != shape0_ || shape1 != shape1_) {
+    program_ = std::make_unique<Broadcaster>(shape0, shape1);
+    shape0_ = shape0;
+    shape1_ = shape1;
+  }
+  return *program_;
+}
+
+void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, void* user_data,
+                         BroadcastProgramCache* program_cache) {
+  InputBroadcaster input_broadcaster(*context.Input<Tensor>(0), *context.Input<Tensor>(1), program_cache);
   OutputBroadcaster output_broadcaster(input_broadcaster.GetSpanSize(),
                                        *context.Output(0, input_broadcaster.GetOutputShape()));
   BroadcastHelper broadcast_helper(input_broadcaster, output_broadcaster, user_data);
@@ -1765,10 +1816,10 @@ void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFun
 // Operator usage is the same as the parallelization is opaque to the operator.
 // unit_cost must be a valid cost value.
 void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, double unit_cost,
-                         void* user_data) {
+                         void* user_data, BroadcastProgramCache* program_cache) {
   const Tensor& input0_tensor = *context.Input<Tensor>(0);
   const Tensor& input1_tensor = *context.Input<Tensor>(1);
-  InputBroadcaster input_broadcaster(input0_tensor, input1_tensor);
+  InputBroadcaster input_broadcaster(input0_tensor, input1_tensor, program_cache);
 
   Tensor& output_tensor = *context.Output(0, input_broadcaster.GetOutputShape());
 
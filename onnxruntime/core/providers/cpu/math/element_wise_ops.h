@@ -5,6 +5,7 @@
 
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #include "core/util/math_cpuonly.h"
 #include "core/providers/cpu/element_wise_ranged_transform.h"
 
@@ -205,6 +206,32 @@ DEFINE_ELE_KERNEL(Reciprocal)
 DEFINE_ELE_KERNEL(Sqrt)
 DEFINE_ELE_KERNEL(Exp)
 
+struct Broadcaster;
+
+// Caches the broadcast program (output shape plus per-input iterator setup) computed by Broadcaster
+// for a pair of input shapes. Binary elementwise kernels typically see the same input shapes on
+// every Run of a fixed graph, so a kernel instance can hold one of these to skip re-deriving the
+// program on each Compute call. Thread safe so that concurrent Run calls against the same session
+// can share a kernel instance.
+class BroadcastProgramCache {
+ public:
+  BroadcastProgramCache();
+  ~BroadcastProgramCache();
+
+  // Returns a copy of the broadcast program for the given input shapes, computing and caching it
+  // first if the shapes differ from the previous call. A copy is returned as the iterator state
+  // is mutated while walking the inputs.
+  Broadcaster Get(const std::vector<int64_t>& shape0, const std::vector<int64_t>& shape1);
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(BroadcastProgramCache);
+
+  OrtMutex mutex_;
+  std::vector<int64_t> shape0_;
+  std::vector<int64_t> shape1_;
+  std::unique_ptr<Broadcaster> program_;
+};
+
 template <typename T>
 class Add final : public OpKernel {
  public:
@@ -212,6 +239,9 @@ class Add final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  mutable BroadcastProgramCache broadcast_program_cache_;
 };
 
 template <typename T>
@@ -221,6 +251,9 @@ class Sub final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  mutable BroadcastProgramCache broadcast_program_cache_;
 };
 
 template <typename T>
@@ -230,6 +263,9 @@ class Mul final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  mutable BroadcastProgramCache broadcast_program_cache_;
 };
 
 template <typename T>
@@ -239,14 +275,22 @@ class Div final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  mutable BroadcastProgramCache broadcast_program_cache_;
 };
 
 class Pow final : public OpKernel {
  public:
-  Pow(const OpKernelInfo& info) : OpKernel(info) {
-  }
+  Pow(const OpKernelInfo& info);
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  // Compute body for the statically known base/exponent element type pair, resolved once at
+  // kernel creation so each call dispatches directly instead of re-running the nested type
+  // switches.
+  void (*compute_fn_)(OpKernelContext&) = nullptr;
 };
 
 template <typename T>
@@ -354,6 +398,9 @@ class Equal final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  mutable BroadcastProgramCache broadcast_program_cache_;
 };
 
 template <typename T>
@@ -363,6 +410,9 @@ class Less final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  mutable BroadcastProgramCache broadcast_program_cache_;
 };
 
 template <typename T>
@@ -372,6 +422,9 @@ class Greater final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  mutable BroadcastProgramCache broadcast_program_cache_;
 };
 
 template <typename T>
@@ -381,6 +434,9 @@ class LessOrEqual final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  mutable BroadcastProgramCache broadcast_program_cache_;
 };
 
 template <typename T>
@@ -390,6 +446,9 @@ class GreaterOrEqual final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  mutable BroadcastProgramCache broadcast_program_cache_;
 };
 
 template <typename T>
@@ -646,16 +705,19 @@ struct Broadcaster {
 };
 
 struct InputBroadcaster {
-  InputBroadcaster(const Tensor& input0, const Tensor& input1)
+  InputBroadcaster(const Tensor& input0, const Tensor& input1, BroadcastProgramCache* program_cache = nullptr)
       : input_tensor0_(input0),
         input_tensor1_(&input1),
-        input_tensor1_shape_(input1.Shape()) {
+        input_tensor1_shape_(input1.Shape()),
+        program_cache_(program_cache) {
   }
 
-  InputBroadcaster(const Tensor& input0, const TensorShape& input1_shape)
+  InputBroadcaster(const Tensor& input0, const TensorShape& input1_shape,
+                   BroadcastProgramCache* program_cache = nullptr)
       : input_tensor0_(input0),
         input_tensor1_(nullptr),
-        input_tensor1_shape_(input1_shape) {
+        input_tensor1_shape_(input1_shape),
+        program_cache_(program_cache) {
   }
 
   void AdvanceBy(size_t offset) {
@@ -723,7 +785,15 @@ struct InputBroadcaster {
   const void* input0_bytes_{input_tensor0_.DataRaw()};
   const void* input1_bytes_{input_tensor1_ ? input_tensor1_->DataRaw() : nullptr};
 
-  Broadcaster broadcaster_{input_tensor0_.Shape().GetDims(), input_tensor1_shape_.GetDims()};
+  static Broadcaster MakeBroadcaster(const std::vector<int64_t>& shape0, const std::vector<int64_t>& shape1,
+                                     BroadcastProgramCache* program_cache) {
+    return program_cache != nullptr ? program_cache->Get(shape0, shape1) : Broadcaster(shape0, shape1);
+  }
+
+  // must be initialized before broadcaster_
+  BroadcastProgramCache* program_cache_{nullptr};
+  Broadcaster broadcaster_{
+      MakeBroadcaster(input_tensor0_.Shape().GetDims(), input_tensor1_shape_.GetDims(), program_cache_)};
   size_t span_size_{broadcaster_.GetSpanSize()};
 };
 
@@ -928,14 +998,17 @@ static void ParallelizeSingleSpan(TBroadcastHelper& helper, const ProcessBroadca
 // Type specific logic is plugged in via the functions in ProcessBroadcastSpanFuncs.
 // Optional user_data can be provided, and will be available to the ProcessSpanFunc implementations
 // via BroadcastHelper.GetUserData().
-void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, void* user_data = nullptr);
+void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, void* user_data = nullptr,
+                         BroadcastProgramCache* program_cache = nullptr);
 
 // Broadcast two inputs with parallelization.
 //
 // Operator usage is the same as the parallelization is opaque to the operator.
 // unit_cost must be a valid cost value.
+// An optional per-kernel-instance program_cache skips the broadcast shape analysis when the input
+// shapes match the previous call.
 void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, double unit_cost,
-                         void* user_data = nullptr);
+                         void* user_data = nullptr, BroadcastProgramCache* program_cache = nullptr);
 
 // Helper to provide the looping logic with optimization for parallelizing within a single span if the
 // TBroadcastHelper instance was setup to enable that.
@@ -276,6 +276,37 @@ Status Gemm<float>::Compute(OpKernelContext* context) const {
   const float* c_data = C != nullptr ? C->Data<float>() : nullptr;
   const TensorShape* c_shape = C != nullptr ? &C->Shape() : nullptr;
 
+  // When FusedGemm mapped the activation to a MLAS activation, apply it as a GEMM epilogue on
+  // the cache resident output blocks instead of re-streaming the output in a separate pass.
+  const bool use_mlas_epilogue = mlas_activation_.ActivationKind != MlasIdentityActivation;
+  MLAS_SGEMM_ACTIVATION_PROCESSOR activation_processor(mlas_activation_);
+
+  if (use_mlas_epilogue) {
+    GemmBroadcastBias(M, N, beta_, c_data, c_shape, y_data);
+
+    MLAS_SGEMM_DATA_PARAMS data;
+    data.alpha = alpha_;
+    data.A = A->Data<float>();
+    data.lda = static_cast<size_t>(trans_A_ != CblasNoTrans ? M : K);
+    data.beta = c_data != nullptr ? beta_ : 0.0f;
+    data.C = y_data;
+    data.ldc = static_cast<size_t>(N);
+    data.OutputProcessor = &activation_processor;
+
+    if (B) {
+      data.B = B->Data<float>();
+      data.ldb = static_cast<size_t>(trans_B_ != CblasNoTrans ? K : N);
+    } else {
+      data.B = static_cast<const float*>(packed_b_.get());
+      data.BIsPacked = true;
+    }
+
+    MlasGemm(trans_A_, trans_B_, static_cast<size_t>(M), static_cast<size_t>(N), static_cast<size_t>(K),
+             data, thread_pool);
+
+    return Status::OK();
+  }
+
   if (B) {
     ComputeGemm(trans_A_, trans_B_, M, N, K, alpha_, A->Data<float>(), B->Data<float>(), beta_,
                 c_data, c_shape, y_data, thread_pool);
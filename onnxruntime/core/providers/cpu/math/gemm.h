@@ -8,6 +8,7 @@
 #include "core/framework/op_kernel.h"
 #include "core/common/common.h"
 #include "core/util/math.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/providers/cpu/activation/activations.h"
 
 namespace onnxruntime {
@@ -44,6 +45,10 @@ class Gemm : protected GemmBase, public OpKernel {
   // For fused gemm + activation
   std::unique_ptr<functors::ElementWiseRangedTransform<T>> activation_;
 
+  // Set by FusedGemm when the activation can be expressed as a MLAS activation, so it is applied
+  // as a GEMM epilogue on cache resident output blocks instead of a separate pass over the output.
+  MLAS_ACTIVATION mlas_activation_{};  // value-initialized to MlasIdentityActivation
+
   void ComputeActivation(T* y_data, size_t y_size, concurrency::ThreadPool* thread_pool) const;
 };
 
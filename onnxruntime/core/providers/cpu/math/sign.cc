@@ -29,9 +29,14 @@ using EnabledSignDataTypes = ORT_OP_KERNEL_ARG_ENABLED_TYPE_LIST_ALL_OPSETS(
 
 class Sign final : public OpKernel {
  public:
-  explicit Sign(const OpKernelInfo& info) : OpKernel(info) {}
+  explicit Sign(const OpKernelInfo& info);
 
   Status Compute(OpKernelContext* ctx) const override;
+
+ private:
+  // compute body for the statically known element type, resolved once at kernel creation so
+  // Compute dispatches directly
+  void (*compute_fn_)(const Tensor* input, Tensor* output) = nullptr;
 };
 
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
@@ -97,18 +102,32 @@ struct CallSignImpl<BFloat16> {
     });
   }
 };
+// writes the direct-dispatch function pointer for T; captureless lambda so it converts to a
+// plain function pointer
+template <class T>
+struct GetSignComputeFn {
+  void operator()(void (*&out)(const Tensor*, Tensor*)) const {
+    out = [](const Tensor* input, Tensor* output) { CallSignImpl<T>{}(input, output); };
+  }
+};
+
 }  // namespace sign_internal
 
-Status Sign::Compute(OpKernelContext* ctx) const {
-  using namespace sign_internal;
+Sign::Sign(const OpKernelInfo& info) : OpKernel(info) {
+  // the element type is statically known, so run the type dispatch once here instead of on every
+  // Compute call
+  const auto* input_type = info.GetInputType(0);
+  ORT_ENFORCE(input_type != nullptr && input_type->has_tensor_type(), "Sign input must be a tensor");
+
+  utils::MLTypeCallDispatcherFromTypeList<EnabledSignDataTypes> t_disp(input_type->tensor_type().elem_type());
+  t_disp.Invoke<sign_internal::GetSignComputeFn>(compute_fn_);
+}
 
+Status Sign::Compute(OpKernelContext* ctx) const {
   auto input = ctx->Input<Tensor>(0);
   auto output = ctx->Output(0, input->Shape());
 
-  const auto dtype = input->GetElementType();
-  utils::MLTypeCallDispatcherFromTypeList<EnabledSignDataTypes> t_disp(dtype);
-  t_disp.Invoke<CallSignImpl>(input, output);
-
+  compute_fn_(input, output);
   return Status::OK();
 }
 
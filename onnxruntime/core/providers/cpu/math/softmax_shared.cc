@@ -1,31 +1,17 @@
-/**
-* Derived from caffe2, need copy right announcement here.
-*/
-
-/**
-* Copyright (c) 2016-present, Facebook, Inc.
-*
-* Licensed under the Apache License, Version 2.0 (the "License");
-* you may not use this file except in compliance with the License.
-* You may obtain a copy of the License at
-*
-*     http://www.apache.org/licenses/LICENSE-2.0
-*
-* Unless required by applicable law or agreed to in writing, software
-* distributed under the License is distributed on an "AS IS" BASIS,
-* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-* See the License for the specific language governing permissions and
-* limitations under the License.
-*/
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
 
 #include <algorithm>
 #include <cmath>
 #include "core/providers/cpu/math/softmax_shared.h"
-#include "core/util/math.h"
-#include "core/util/math_cpuonly.h"
+#include "core/platform/threadpool.h"
 #include "core/mlas/inc/mlas.h"
 
 namespace onnxruntime {
+
+// Generic implementation used for the non-float types. Each row is streamed through cache once:
+// find the row maximum, exponentiate the shifted values while accumulating their sum, and
+// normalize. The rows are partitioned across the threads of the pool.
 template <typename T>
 common::Status SoftmaxCPU(size_t N,
                           size_t D,
@@ -33,51 +19,40 @@ common::Status SoftmaxCPU(size_t N,
                           T* Ydata,
                           bool logarithmic,
                           onnxruntime::concurrency::ThreadPool* thread_pool) {
-  // the Math functions SoftmaxCPU uses only support int32_t as input, so enforce that
-  if (N * D > INT32_MAX || N > INT32_MAX || D > INT32_MAX) {
-    std::ostringstream ss;
-    ss << "SoftmaxCPU inputs N, D and N * D must be < " << INT32_MAX << ". N=" << N << ", D=" << D;
-    std::string msg = ss.str();
-
-    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, msg);
-  }
-
-  std::vector<T> scale(N);
-  std::vector<T> rowmax(N);
-  std::vector<T> sum_multiplier(D, 1.f);  // initialize all multiplier values to 1.0
-
-  const int n = gsl::narrow_cast<int>(N);
-  const int d = gsl::narrow_cast<int>(D);
-  const int nd = gsl::narrow_cast<int>(N * D);
-
-  math::RowwiseMax<T, CPUMathUtil>(n, d, Xdata, rowmax.data(), nullptr);
-
-  // Put the intermediate result X - max(X) into Y by first copying X to Y, and then subtracting max from each entry
-  gsl::copy(gsl::make_span(Xdata, nd), gsl::make_span(Ydata, nd));
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(N),
+      // rough cost per row: stream the row in and out with an exp per element
+      {static_cast<float>(D * sizeof(T)), static_cast<float>(D * sizeof(T)), static_cast<double>(D) * 10.0},
+      [Xdata, Ydata, D, logarithmic](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          const T* x = Xdata + static_cast<size_t>(i) * D;
+          T* y = Ydata + static_cast<size_t>(i) * D;
 
-  math::Gemm<T>(CblasNoTrans, CblasNoTrans, n, d, 1, -1, rowmax.data(), sum_multiplier.data(), 1, Ydata, thread_pool);
+          T rowmax = x[0];
+          for (size_t j = 1; j < D; ++j) {
+            rowmax = std::max(rowmax, x[j]);
+          }
 
-  // Exponentiation
-  math::Exp<T, CPUMathUtil>(nd, Ydata, Ydata, nullptr);
-  math::Gemv<T, CPUMathUtil>(CblasNoTrans, n, d, 1, Ydata, sum_multiplier.data(), 0, scale.data(), nullptr);
+          T sum = 0;
+          for (size_t j = 0; j < D; ++j) {
+            T e = std::exp(x[j] - rowmax);
+            y[j] = e;
+            sum += e;
+          }
 
-  // Do division
-  if (!logarithmic) {
-    for (size_t i = 0; i < N; ++i) {
-      auto scale_value = scale[i];
-      for (size_t j = 0; j < D; ++j) {
-        Ydata[i * D + j] /= scale_value;
-      }
-    }
-  } else {
-    for (size_t i = 0; i < N; ++i) {
-      auto log_fmaxf_scale_i = std::log(std::fmax(scale[i], 1e-20f));
-      auto rowmax_value = rowmax[i];
-      for (size_t j = 0; j < D; ++j) {
-        Ydata[i * D + j] = Xdata[i * D + j] - rowmax_value - log_fmaxf_scale_i;
-      }
-    }
-  }
+          if (!logarithmic) {
+            T scale = T(1) / sum;
+            for (size_t j = 0; j < D; ++j) {
+              y[j] *= scale;
+            }
+          } else {
+            T logsum = std::log(std::max(sum, T(1e-20)));
+            for (size_t j = 0; j < D; ++j) {
+              y[j] = x[j] - rowmax - logsum;
+            }
+          }
+        }
+      });
 
   return Status::OK();
 }
@@ -179,6 +179,13 @@ static void FindTopKElements(const Tensor* input, const TensorShape& input_shape
   //            k = [ 1, 2, 4, 6, 8, 16, 24, 32, 48, 64, 128 ]
   bool use_priority_queue = k != 1 && (k < 4 || (std::log2(k) / std::log2(num_blocks)) < 0.725);
 
+  // for contiguous rows that are much longer than k, most entries can be discarded with a
+  // cheap value-only comparison against an estimate of the k'th best value taken from a
+  // sample of the row. the filtered scan is branch-light and far cheaper per element than
+  // maintaining a heap.
+  bool use_threshold_filter = k != 1 && block_slice == 1 &&
+                              num_blocks >= 1024 && static_cast<int64_t>(k) * 8 <= num_blocks;
+
   std::function<void(std::ptrdiff_t batch)> find_top_k;
 
   if (k == 1) {
@@ -214,6 +221,67 @@ static void FindTopKElements(const Tensor* input, const TensorShape& input_shape
             }
           }
         };
+  } else if (use_threshold_filter) {
+    find_top_k =
+        [num_threads, rows, num_blocks, k, sorted,
+         input_data, cols, &values_map, &indices_map](std::ptrdiff_t batch) {
+          auto work = concurrency::ThreadPool::PartitionWork(batch, num_threads, rows);
+          Comparator comparer(input_data);
+
+          const int64_t sample_count = std::min(num_blocks, static_cast<int64_t>(std::max(4 * k, 256u)));
+          const int64_t sample_stride = num_blocks / sample_count;
+
+          // storage is re-used across rows to minimize allocations
+          std::vector<typename Comparator::DataType> sample(sample_count);
+          std::vector<int64_t> candidates;
+          candidates.reserve(4 * static_cast<size_t>(k));
+          std::vector<int64_t> data_holder;
+
+          for (auto i = work.start; i < work.end; ++i) {
+            const auto row_offset = i * cols;
+            const auto* row_data = input_data + row_offset;
+
+            // estimate the k'th best value from a strided sample of the row. as the sample is a
+            // subset of the row, at least k entries of the row compare better than or equal to the
+            // estimate, so filtering with it cannot drop any of the true top k.
+            for (int64_t l = 0; l < sample_count; ++l) {
+              sample[l] = row_data[l * sample_stride];
+            }
+
+            std::nth_element(sample.begin(), sample.begin() + (k - 1), sample.end(),
+                             [&comparer](const typename Comparator::DataType& lhs,
+                                         const typename Comparator::DataType& rhs) {
+                               return comparer.CompareValueOnly(lhs, rhs);
+                             });
+            const auto threshold = sample[k - 1];
+
+            candidates.clear();
+            for (int64_t l = 0; l < num_blocks; ++l) {
+              const auto value = row_data[l];
+              if (comparer.CompareValueOnly(value, threshold) || value == threshold) {
+                candidates.push_back(row_offset + l);
+              }
+            }
+
+            if (candidates.size() < k) {
+              // the sample was not representative (e.g. NaN entries). select over the full row.
+              data_holder.resize(num_blocks);
+              SelectTopK<Comparator>(comparer, row_offset, num_blocks, 1, 0, k, sorted, data_holder);
+              candidates.assign(data_holder.begin(), data_holder.begin() + k);
+            } else {
+              std::nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end(), comparer);
+              if (sorted) {
+                std::sort(candidates.begin(), candidates.begin() + k, comparer);
+              }
+            }
+
+            for (int64_t l = 0; l < k; ++l) {
+              int64_t idx = candidates[l];
+              values_map(i, l) = input_data[idx];
+              indices_map(i, l) = idx - row_offset;  // block_slice is 1 on this path
+            }
+          }
+        };
   } else if (use_priority_queue) {
     find_top_k =
         [num_threads, rows, block_slice, num_blocks, k, sorted,
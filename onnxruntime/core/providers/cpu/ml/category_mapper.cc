@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/ml/category_mapper.h"
+#include "core/platform/threadpool.h"
 #include <algorithm>
 #include <gsl/gsl>
 using namespace ::onnxruntime::common;
@@ -33,17 +34,14 @@ Status CategoryMapper::Compute(OpKernelContext* context) const {
 
     auto input = gsl::make_span(X.template Data<std::string>(), shape.Size());
     auto output = gsl::make_span(Y.template MutableData<int64_t>(), shape.Size());
-    auto out = output.begin();
-
-    // map isn't going to change so get end() once instead of calling inside the for_each loop
-    const auto map_end = string_to_int_map_.end();
 
-    std::for_each(input.cbegin(), input.cend(),
-                  [&out, &map_end, this](const std::string& value) {
-                    auto map_to = string_to_int_map_.find(value);
-                    *out = map_to == map_end ? default_int_ : map_to->second;
-                    ++out;
-                  });
+    // the lookups are independent, so large batches can be split across threads
+    concurrency::ThreadPool::TryBatchParallelFor(
+        context->GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(shape.Size()),
+        [&input, &output, this](ptrdiff_t i) {
+          output[i] = string_to_int_table_.Lookup(input[i], default_int_);
+        },
+        0);
   } else {
     if (!Y.IsDataTypeString())
       return Status(ONNXRUNTIME, FAIL, "Input of int64 must have output of string ");
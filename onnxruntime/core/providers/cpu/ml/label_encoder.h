@@ -6,6 +6,7 @@
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
 #include "core/providers/cpu/ml/ml_common.h"
+#include "core/providers/cpu/ml/string_lookup_table.h"
 
 namespace onnxruntime {
 namespace ml {
@@ -22,21 +23,22 @@ class LabelEncoder final : public OpKernel {
 
     auto num_entries = string_classes.size();
 
-    string_to_int_map_.reserve(num_entries);
+    std::vector<int64_t> class_indices(num_entries);
+
     int_to_string_map_.reserve(num_entries);
 
     for (size_t i = 0; i < num_entries; ++i) {
-      const std::string& str = string_classes[i];
-
-      string_to_int_map_[str] = i;
-      int_to_string_map_[i] = str;
+      class_indices[i] = static_cast<int64_t>(i);
+      int_to_string_map_[i] = string_classes[i];
     }
+
+    string_to_int_table_.Build(string_classes, class_indices);
   }
 
   Status Compute(OpKernelContext* context) const override;
 
  private:
-  std::unordered_map<std::string, int64_t> string_to_int_map_;
+  StringToInt64Table string_to_int_table_;
   std::unordered_map<int64_t, std::string> int_to_string_map_;
 
   std::string default_string_;
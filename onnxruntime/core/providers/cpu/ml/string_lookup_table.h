@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+namespace ml {
+
+// Flat open-addressing table mapping strings to int64 values, built once at
+// kernel construction from the op's attributes. Compared to unordered_map
+// with std::string keys, the table keeps all slot metadata in one contiguous
+// array, hashes eight bytes per step instead of one, and resolves keys of up
+// to eight bytes entirely from an inline zero-padded prefix word, so the
+// common short-category lookup never touches the key character pool.
+class StringToInt64Table {
+ public:
+  StringToInt64Table() = default;
+
+  void Build(const std::vector<std::string>& keys, const std::vector<int64_t>& values) {
+    ORT_ENFORCE(keys.size() == values.size());
+
+    // Size to a power of two at no more than half occupancy so linear probe
+    // chains stay short and the lookup loop always finds an empty slot.
+    size_t bucket_count = 8;
+    while (bucket_count < keys.size() * 2) {
+      bucket_count <<= 1;
+    }
+
+    slots_.clear();
+    slots_.resize(bucket_count);
+    chars_.clear();
+    bucket_mask_ = bucket_count - 1;
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+      Insert(keys[i], values[i]);
+    }
+  }
+
+  int64_t Lookup(const std::string& key, int64_t default_value) const {
+    const uint64_t hash = HashKey(key.data(), key.size());
+    const uint64_t prefix = LoadPrefix(key.data(), key.size());
+
+    size_t index = hash & bucket_mask_;
+    for (;;) {
+      const Slot& slot = slots_[index];
+      if (slot.hash == 0) {
+        return default_value;
+      }
+      if (slot.hash == hash && slot.length == key.size() && slot.prefix == prefix &&
+          (key.size() <= sizeof(uint64_t) ||
+           memcmp(chars_.data() + slot.offset, key.data(), key.size()) == 0)) {
+        return slot.value;
+      }
+      index = (index + 1) & bucket_mask_;
+    }
+  }
+
+ private:
+  struct Slot {
+    uint64_t hash{0};  // 0 marks an empty slot
+    uint64_t prefix{0};
+    int64_t value{0};
+    uint32_t offset{0};
+    uint32_t length{0};
+  };
+
+  static uint64_t HashKey(const char* data, size_t length) {
+    // FNV-1a folded over zero-padded eight byte words, with the length mixed
+    // in so a key is distinguished from its own zero-padded extension.
+    uint64_t hash = 14695981039346656037ULL;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+      uint64_t word;
+      memcpy(&word, data + i, sizeof(word));
+      hash = (hash ^ word) * 1099511628211ULL;
+    }
+    if (i < length) {
+      uint64_t word = 0;
+      memcpy(&word, data + i, length - i);
+      hash = (hash ^ word) * 1099511628211ULL;
+    }
+    hash = (hash ^ length) * 1099511628211ULL;
+    return hash != 0 ? hash : 1;
+  }
+
+  static uint64_t LoadPrefix(const char* data, size_t length) {
+    uint64_t prefix = 0;
+    memcpy(&prefix, data, length < sizeof(prefix) ? length : sizeof(prefix));
+    return prefix;
+  }
+
+  void Insert(const std::string& key, int64_t value) {
+    const uint64_t hash = HashKey(key.data(), key.size());
+    const uint64_t prefix = LoadPrefix(key.data(), key.size());
+
+    size_t index = hash & bucket_mask_;
+    for (;;) {
+      Slot& slot = slots_[index];
+      if (slot.hash == 0) {
+        slot.hash = hash;
+        slot.prefix = prefix;
+        slot.value = value;
+        slot.offset = static_cast<uint32_t>(chars_.size());
+        slot.length = static_cast<uint32_t>(key.size());
+        chars_.insert(chars_.end(), key.begin(), key.end());
+        return;
+      }
+      if (slot.hash == hash && slot.length == key.size() && slot.prefix == prefix &&
+          (key.size() <= sizeof(uint64_t) ||
+           memcmp(chars_.data() + slot.offset, key.data(), key.size()) == 0)) {
+        // Duplicate key: keep unordered_map semantics where the last value wins.
+        slot.value = value;
+        return;
+      }
+      index = (index + 1) & bucket_mask_;
+    }
+  }
+
+  std::vector<Slot> slots_;
+  std::vector<char> chars_;
+  size_t bucket_mask_{0};
+};
+
+}  // namespace ml
+}  // namespace onnxruntime
@@ -7,6 +7,8 @@
 #include "core/platform/ort_mutex.h"
 #include "core/platform/threadpool.h"
 
+#include <deque>
+
 namespace onnxruntime {
 namespace ml {
 namespace detail {
@@ -31,6 +33,27 @@ class TreeEnsembleCommon {
   int parallel_tree_;  // starts parallelizing the computing if n_tree >= parallel_tree_ and n_rows == 1
   int parallel_N_;     // starts parallelizing the computing if n_rows >= parallel_N_
 
+  // Compact node layout built when all branch nodes share the same mode.
+  // A node packs the threshold, the feature id and the index of its true
+  // child into one small struct; both children of a node occupy adjacent
+  // slots so the traversal selects the next node with an arithmetic offset
+  // instead of a second pointer load. A negative feature id marks a leaf
+  // and encodes an index into compact_leaves_ as the bitwise complement.
+  struct CompactNode {
+    OTYPE value;
+    int32_t feature_id;
+    int32_t truenode;
+  };
+  std::vector<CompactNode> compact_nodes_;
+  std::vector<uint8_t> compact_missing_true_;  // filled when has_missing_tracks_
+  std::vector<int32_t> compact_roots_;
+  std::vector<const TreeNodeElement<OTYPE>*> compact_leaves_;
+  NODE_MODE compact_mode_;
+
+  // Number of rows scored together against each tree so the upper levels of
+  // the tree stay cache resident across the rows of a block.
+  static constexpr int64_t kRowBlockSize = 16;
+
  public:
   TreeEnsembleCommon(int parallel_tree,
                      int parallel_N,
@@ -58,6 +81,13 @@ class TreeEnsembleCommon {
   TreeNodeElement<OTYPE>* ProcessTreeNodeLeave(
       TreeNodeElement<OTYPE>* root, const ITYPE* x_data) const;
 
+  void BuildCompactNodes();
+
+  const TreeNodeElement<OTYPE>& ProcessTreeLeaf(size_t tree_index, const ITYPE* x_data) const;
+
+  template <NODE_MODE MODE, bool HasMissing>
+  const TreeNodeElement<OTYPE>& ProcessCompactTreeLeaf(int32_t index, const ITYPE* x_data) const;
+
   template <typename AGG>
   void ComputeAgg(concurrency::ThreadPool* ttp, const Tensor* X, Tensor* Z, Tensor* label, const AGG& agg) const;
 };
@@ -213,6 +243,77 @@ TreeEnsembleCommon<ITYPE, OTYPE>::TreeEnsembleCommon(int parallel_tree, int para
       break;
     }
   }
+
+  BuildCompactNodes();
+}
+
+template <typename ITYPE, typename OTYPE>
+void TreeEnsembleCommon<ITYPE, OTYPE>::BuildCompactNodes() {
+  compact_mode_ = NODE_MODE::LEAF;
+  if (!same_mode_) {
+    return;
+  }
+
+  compact_nodes_.reserve(n_nodes_);
+  compact_missing_true_.reserve(n_nodes_);
+  compact_roots_.reserve(roots_.size());
+
+  auto append_node = [this](const TreeNodeElement<OTYPE>* node) -> int32_t {
+    int32_t slot = static_cast<int32_t>(compact_nodes_.size());
+    CompactNode cn;
+    if (node->is_not_leaf) {
+      cn.value = node->value;
+      cn.feature_id = node->feature_id;
+      compact_mode_ = node->mode;
+    } else {
+      cn.value = 0;
+      cn.feature_id = ~static_cast<int32_t>(compact_leaves_.size());
+      compact_leaves_.push_back(node);
+    }
+    cn.truenode = 0;
+    compact_nodes_.push_back(cn);
+    compact_missing_true_.push_back(node->is_missing_track_true ? 1 : 0);
+    return slot;
+  };
+
+  // Lay out each tree in breadth first order, appending the two children of
+  // a branch node together so they land in adjacent slots.
+  std::deque<std::pair<const TreeNodeElement<OTYPE>*, int32_t>> work;
+  for (size_t t = 0; t < roots_.size(); ++t) {
+    const TreeNodeElement<OTYPE>* root = roots_[t];
+    int32_t root_slot = append_node(root);
+    compact_roots_.push_back(root_slot);
+    if (root->is_not_leaf) {
+      work.emplace_back(root, root_slot);
+    }
+
+    while (!work.empty()) {
+      const TreeNodeElement<OTYPE>* node = work.front().first;
+      int32_t slot = work.front().second;
+      work.pop_front();
+
+      if (node->truenode == nullptr || node->falsenode == nullptr) {
+        // Dangling child: keep the pointer based traversal for this model.
+        compact_nodes_.clear();
+        compact_missing_true_.clear();
+        compact_roots_.clear();
+        compact_leaves_.clear();
+        compact_mode_ = NODE_MODE::LEAF;
+        return;
+      }
+
+      int32_t true_slot = append_node(node->truenode);
+      append_node(node->falsenode);
+      compact_nodes_[slot].truenode = true_slot;
+
+      if (node->truenode->is_not_leaf) {
+        work.emplace_back(node->truenode, true_slot);
+      }
+      if (node->falsenode->is_not_leaf) {
+        work.emplace_back(node->falsenode, true_slot + 1);
+      }
+    }
+  }
 }
 
 template <typename ITYPE, typename OTYPE>
@@ -269,7 +370,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
       ScoreValue<OTYPE> score = {0, 0};
       if (n_trees_ <= parallel_tree_) { /* section A: 1 output, 1 row and not enough trees to parallelize */
         for (int64_t j = 0; j < n_trees_; ++j) {
-          agg.ProcessTreeNodePrediction1(score, *ProcessTreeNodeLeave(roots_[j], x_data));
+          agg.ProcessTreeNodePrediction1(score, ProcessTreeLeaf(j, x_data));
         }
       } else { /* section B: 1 output, 1 row and enough trees to parallelize */
         std::vector<ScoreValue<OTYPE>> scores(n_trees_, {0, 0});
@@ -277,7 +378,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
             ttp,
             SafeInt<int32_t>(n_trees_),
             [this, &scores, &agg, x_data](ptrdiff_t j) {
-              agg.ProcessTreeNodePrediction1(scores[j], *ProcessTreeNodeLeave(roots_[j], x_data));
+              agg.ProcessTreeNodePrediction1(scores[j], ProcessTreeLeaf(j, x_data));
             },
             0);
 
@@ -287,17 +388,22 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
       }
       agg.FinalizeScores1(z_data, score, label_data);
     } else if (N <= parallel_N_) { /* section C: 1 output, 2+ rows but not enough rows to parallelize */
-      ScoreValue<OTYPE> score;
-      size_t j;
-
-      for (int64_t i = 0; i < N; ++i) {
-        score = {0, 0};
-        for (j = 0; j < static_cast<size_t>(n_trees_); ++j) {
-          agg.ProcessTreeNodePrediction1(score, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+      // Score a block of rows against each tree before moving to the next
+      // tree so the nodes visited stay cache resident across the block.
+      std::vector<ScoreValue<OTYPE>> scores(kRowBlockSize);
+
+      for (int64_t i = 0; i < N; i += kRowBlockSize) {
+        const int64_t count = std::min(kRowBlockSize, N - i);
+        std::fill_n(scores.begin(), count, ScoreValue<OTYPE>({0, 0}));
+        for (size_t j = 0; j < static_cast<size_t>(n_trees_); ++j) {
+          for (int64_t r = 0; r < count; ++r) {
+            agg.ProcessTreeNodePrediction1(scores[r], ProcessTreeLeaf(j, x_data + (i + r) * stride));
+          }
+        }
+        for (int64_t r = 0; r < count; ++r) {
+          agg.FinalizeScores1(z_data + i + r, scores[r],
+                              label_data == nullptr ? nullptr : (label_data + i + r));
         }
-
-        agg.FinalizeScores1(z_data + i, score,
-                            label_data == nullptr ? nullptr : (label_data + i));
       }
     } else if (n_trees_ > max_num_threads) { /* section D: 1 output, 2+ rows and enough trees to parallelize */
       auto num_threads = std::min<int32_t>(max_num_threads, SafeInt<int32_t>(n_trees_));
@@ -312,7 +418,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
             }
             for (auto j = work.start; j < work.end; ++j) {
               for (int64_t i = 0; i < N; ++i) {
-                agg.ProcessTreeNodePrediction1(scores[batch_num * N + i], *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+                agg.ProcessTreeNodePrediction1(scores[batch_num * N + i], ProcessTreeLeaf(j, x_data + i * stride));
               }
             }
           });
@@ -330,18 +436,25 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
                                   label_data == nullptr ? nullptr : (label_data + i));
             }
           });
-    } else { /* section E: 1 output, 2+ rows, parallelization by rows */
+    } else { /* section E: 1 output, 2+ rows, parallelization by row blocks */
+      const int64_t block_count = (N + kRowBlockSize - 1) / kRowBlockSize;
       concurrency::ThreadPool::TryBatchParallelFor(
           ttp,
-          SafeInt<int32_t>(N),
-          [this, &agg, x_data, z_data, stride, label_data](ptrdiff_t i) {
-            ScoreValue<OTYPE> score = {0, 0};
+          SafeInt<int32_t>(block_count),
+          [this, &agg, x_data, z_data, stride, label_data, N](ptrdiff_t block) {
+            const int64_t i = block * kRowBlockSize;
+            const int64_t count = std::min(kRowBlockSize, N - i);
+            std::vector<ScoreValue<OTYPE>> scores(count, {0, 0});
             for (size_t j = 0; j < static_cast<size_t>(n_trees_); ++j) {
-              agg.ProcessTreeNodePrediction1(score, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+              for (int64_t r = 0; r < count; ++r) {
+                agg.ProcessTreeNodePrediction1(scores[r], ProcessTreeLeaf(j, x_data + (i + r) * stride));
+              }
             }
 
-            agg.FinalizeScores1(z_data + i, score,
-                                label_data == nullptr ? nullptr : (label_data + i));
+            for (int64_t r = 0; r < count; ++r) {
+              agg.FinalizeScores1(z_data + i + r, scores[r],
+                                  label_data == nullptr ? nullptr : (label_data + i + r));
+            }
           },
           0);
     }
@@ -350,7 +463,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
       if (n_trees_ <= parallel_tree_) { /* section A2 */
         std::vector<ScoreValue<OTYPE>> scores(n_targets_or_classes_, {0, 0});
         for (int64_t j = 0; j < n_trees_; ++j) {
-          agg.ProcessTreeNodePrediction(scores, *ProcessTreeNodeLeave(roots_[j], x_data));
+          agg.ProcessTreeNodePrediction(scores, ProcessTreeLeaf(j, x_data));
         }
         agg.FinalizeScores(scores, z_data, -1, label_data);
       } else { /* section B2: 2+ outputs, 1 row, enough trees to parallelize */
@@ -363,7 +476,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
               scores[batch_num].resize(n_targets_or_classes_, {0, 0});
               auto work = concurrency::ThreadPool::PartitionWork(batch_num, num_threads, n_trees_);
               for (auto j = work.start; j < work.end; ++j) {
-                agg.ProcessTreeNodePrediction(scores[batch_num], *ProcessTreeNodeLeave(roots_[j], x_data));
+                agg.ProcessTreeNodePrediction(scores[batch_num], ProcessTreeLeaf(j, x_data));
               }
             });
         for (size_t i = 1; i < scores.size(); ++i) {
@@ -372,17 +485,24 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
         agg.FinalizeScores(scores[0], z_data, -1, label_data);
       }
     } else if (N <= parallel_N_) { /* section C2: 2+ outputs, 2+ rows, not enough rows to parallelize */
-      std::vector<ScoreValue<OTYPE>> scores(n_targets_or_classes_);
-      size_t j;
-
-      for (int64_t i = 0; i < N; ++i) {
-        std::fill(scores.begin(), scores.end(), ScoreValue<OTYPE>({0, 0}));
-        for (j = 0; j < roots_.size(); ++j) {
-          agg.ProcessTreeNodePrediction(scores, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+      // Score a block of rows against each tree before moving to the next
+      // tree so the nodes visited stay cache resident across the block.
+      std::vector<std::vector<ScoreValue<OTYPE>>> scores(kRowBlockSize);
+
+      for (int64_t i = 0; i < N; i += kRowBlockSize) {
+        const int64_t count = std::min(kRowBlockSize, N - i);
+        for (int64_t r = 0; r < count; ++r) {
+          scores[r].assign(n_targets_or_classes_, {0, 0});
+        }
+        for (size_t j = 0; j < roots_.size(); ++j) {
+          for (int64_t r = 0; r < count; ++r) {
+            agg.ProcessTreeNodePrediction(scores[r], ProcessTreeLeaf(j, x_data + (i + r) * stride));
+          }
+        }
+        for (int64_t r = 0; r < count; ++r) {
+          agg.FinalizeScores(scores[r], z_data + (i + r) * n_targets_or_classes_, -1,
+                             label_data == nullptr ? nullptr : (label_data + i + r));
         }
-
-        agg.FinalizeScores(scores, z_data + i * n_targets_or_classes_, -1,
-                           label_data == nullptr ? nullptr : (label_data + i));
       }
     } else if (n_trees_ >= max_num_threads) { /* section: D2: 2+ outputs, 2+ rows, enough trees to parallelize*/
       auto num_threads = std::min<int32_t>(max_num_threads, SafeInt<int32_t>(n_trees_));
@@ -397,7 +517,7 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
             }
             for (auto j = work.start; j < work.end; ++j) {
               for (int64_t i = 0; i < N; ++i) {
-                agg.ProcessTreeNodePrediction(scores[batch_num * N + i], *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+                agg.ProcessTreeNodePrediction(scores[batch_num * N + i], ProcessTreeLeaf(j, x_data + i * stride));
               }
             }
           });
@@ -421,19 +541,25 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
           ttp,
           num_threads,
           [this, &agg, num_threads, x_data, z_data, label_data, N, stride](ptrdiff_t batch_num) {
-            size_t j;
-            std::vector<ScoreValue<OTYPE>> scores(n_targets_or_classes_);
+            std::vector<std::vector<ScoreValue<OTYPE>>> scores(kRowBlockSize);
             auto work = concurrency::ThreadPool::PartitionWork(batch_num, num_threads, N);
 
-            for (auto i = work.start; i < work.end; ++i) {
-              std::fill(scores.begin(), scores.end(), ScoreValue<OTYPE>({0, 0}));
-              for (j = 0; j < roots_.size(); ++j) {
-                agg.ProcessTreeNodePrediction(scores, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+            for (auto i = work.start; i < work.end; i += kRowBlockSize) {
+              const int64_t count = std::min(kRowBlockSize, static_cast<int64_t>(work.end - i));
+              for (int64_t r = 0; r < count; ++r) {
+                scores[r].assign(n_targets_or_classes_, {0, 0});
+              }
+              for (size_t j = 0; j < roots_.size(); ++j) {
+                for (int64_t r = 0; r < count; ++r) {
+                  agg.ProcessTreeNodePrediction(scores[r], ProcessTreeLeaf(j, x_data + (i + r) * stride));
+                }
               }
 
-              agg.FinalizeScores(scores,
-                                 z_data + i * n_targets_or_classes_, -1,
-                                 label_data == nullptr ? nullptr : (label_data + i));
+              for (int64_t r = 0; r < count; ++r) {
+                agg.FinalizeScores(scores[r],
+                                   z_data + (i + r) * n_targets_or_classes_, -1,
+                                   label_data == nullptr ? nullptr : (label_data + i + r));
+              }
             }
           });
     }
@@ -546,6 +672,96 @@ TreeEnsembleCommon<ITYPE, OTYPE>::ProcessTreeNodeLeave(
   return root;
 }
 
+template <typename ITYPE, typename OTYPE>
+template <NODE_MODE MODE, bool HasMissing>
+const TreeNodeElement<OTYPE>&
+TreeEnsembleCommon<ITYPE, OTYPE>::ProcessCompactTreeLeaf(int32_t index, const ITYPE* x_data) const {
+  const CompactNode* nodes = compact_nodes_.data();
+  int32_t feature_id = nodes[index].feature_id;
+
+  while (feature_id >= 0) {
+    const ITYPE val = x_data[feature_id];
+    bool cond;
+    switch (MODE) {
+      case NODE_MODE::BRANCH_LEQ:
+        cond = val <= nodes[index].value;
+        break;
+      case NODE_MODE::BRANCH_LT:
+        cond = val < nodes[index].value;
+        break;
+      case NODE_MODE::BRANCH_GTE:
+        cond = val >= nodes[index].value;
+        break;
+      case NODE_MODE::BRANCH_GT:
+        cond = val > nodes[index].value;
+        break;
+      case NODE_MODE::BRANCH_EQ:
+        cond = val == nodes[index].value;
+        break;
+      case NODE_MODE::BRANCH_NEQ:
+        cond = val != nodes[index].value;
+        break;
+      default:
+        cond = false;
+        break;
+    }
+    if (HasMissing) {
+      cond = cond || (compact_missing_true_[index] && _isnan_(val));
+    }
+
+    // Both children occupy adjacent slots, so the next node is selected
+    // without a branch on the comparison outcome.
+    index = nodes[index].truenode + static_cast<int32_t>(!cond);
+    feature_id = nodes[index].feature_id;
+  }
+
+  return *compact_leaves_[~feature_id];
+}
+
+template <typename ITYPE, typename OTYPE>
+const TreeNodeElement<OTYPE>&
+TreeEnsembleCommon<ITYPE, OTYPE>::ProcessTreeLeaf(size_t tree_index, const ITYPE* x_data) const {
+  if (compact_nodes_.empty()) {
+    return *ProcessTreeNodeLeave(roots_[tree_index], x_data);
+  }
+
+  const int32_t root = compact_roots_[tree_index];
+  if (has_missing_tracks_) {
+    switch (compact_mode_) {
+      case NODE_MODE::BRANCH_LEQ:
+        return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_LEQ, true>(root, x_data);
+      case NODE_MODE::BRANCH_LT:
+        return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_LT, true>(root, x_data);
+      case NODE_MODE::BRANCH_GTE:
+        return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_GTE, true>(root, x_data);
+      case NODE_MODE::BRANCH_GT:
+        return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_GT, true>(root, x_data);
+      case NODE_MODE::BRANCH_EQ:
+        return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_EQ, true>(root, x_data);
+      case NODE_MODE::BRANCH_NEQ:
+        return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_NEQ, true>(root, x_data);
+      default:
+        return ProcessCompactTreeLeaf<NODE_MODE::LEAF, true>(root, x_data);
+    }
+  }
+  switch (compact_mode_) {
+    case NODE_MODE::BRANCH_LEQ:
+      return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_LEQ, false>(root, x_data);
+    case NODE_MODE::BRANCH_LT:
+      return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_LT, false>(root, x_data);
+    case NODE_MODE::BRANCH_GTE:
+      return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_GTE, false>(root, x_data);
+    case NODE_MODE::BRANCH_GT:
+      return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_GT, false>(root, x_data);
+    case NODE_MODE::BRANCH_EQ:
+      return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_EQ, false>(root, x_data);
+    case NODE_MODE::BRANCH_NEQ:
+      return ProcessCompactTreeLeaf<NODE_MODE::BRANCH_NEQ, false>(root, x_data);
+    default:
+      return ProcessCompactTreeLeaf<NODE_MODE::LEAF, false>(root, x_data);
+  }
+}
+
 template <typename ITYPE, typename OTYPE>
 class TreeEnsembleCommonClassifier : TreeEnsembleCommon<ITYPE, OTYPE> {
  private:
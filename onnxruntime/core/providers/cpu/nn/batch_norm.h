@@ -20,6 +20,7 @@
 #include "core/common/common.h"
 #include "core/common/exceptions.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 #include "core/framework/tensor.h"
 #include "core/util/math_cpuonly.h"
@@ -59,12 +60,59 @@ class BatchNorm : public OpKernel {
     }
   }
 
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 /*out*/ bool& is_packed,
+                 /*out*/ PrePackedWeights* prepacked_weights) override {
+    is_packed = false;
+
+    // Training mode updates the running mean/var so the parameters cannot be frozen. The fold
+    // below also combines several initializers rather than re-laying out a single one, so it does
+    // not participate in cross-session sharing of pre-packed buffers.
+    if (is_train_ || prepacked_weights != nullptr || input_idx < 1 || input_idx > 4) {
+      return Status::OK();
+    }
+
+    // stash a copy of the parameter (scale, B, mean or var) so the original initializer can be
+    // released
+    auto& stash = prepacked_params_[static_cast<size_t>(input_idx) - 1];
+    stash = std::make_unique<Tensor>(tensor.DataType(), tensor.Shape(), alloc);
+    memcpy(stash->MutableDataRaw(), tensor.DataRaw(), tensor.SizeInBytes());
+    is_packed = true;
+
+    // Once scale, B, mean and var are all constant, fold them into a single per-channel scale and
+    // bias:
+    //   (x - mean) * inv_std * scale + B  ==  x * (inv_std * scale) + (B - mean * inv_std * scale)
+    // so Compute no longer recomputes the inverse standard deviation on every run.
+    if (prepacked_params_[0] && prepacked_params_[1] && prepacked_params_[2] && prepacked_params_[3]) {
+      const int64_t size = prepacked_params_[0]->Shape().Size();
+      if (size == prepacked_params_[1]->Shape().Size() &&
+          size == prepacked_params_[2]->Shape().Size() &&
+          size == prepacked_params_[3]->Shape().Size()) {
+        folded_scale_ = IAllocator::MakeUniquePtr<T>(alloc, static_cast<size_t>(size));
+        folded_bias_ = IAllocator::MakeUniquePtr<T>(alloc, static_cast<size_t>(size));
+
+        ConstEigenVectorArrayMap<T> scale_arr(prepacked_params_[0]->template Data<T>(), size);
+        ConstEigenVectorArrayMap<T> bias_arr(prepacked_params_[1]->template Data<T>(), size);
+        ConstEigenVectorArrayMap<T> mean_arr(prepacked_params_[2]->template Data<T>(), size);
+        ConstEigenVectorArrayMap<T> var_arr(prepacked_params_[3]->template Data<T>(), size);
+        EigenVectorArrayMap<T> folded_scale_arr(folded_scale_.get(), size);
+        EigenVectorArrayMap<T> folded_bias_arr(folded_bias_.get(), size);
+        folded_scale_arr = (var_arr + epsilon_).sqrt().inverse() * scale_arr;
+        folded_bias_arr = bias_arr - mean_arr * folded_scale_arr;
+        folded_size_ = size;
+      }
+    }
+
+    return Status::OK();
+  }
+
   Status Compute(OpKernelContext* p_op_kernel_context) const override {
     const auto* X = p_op_kernel_context->Input<Tensor>(0);
-    const auto* scale = p_op_kernel_context->Input<Tensor>(1);
-    const auto* B = p_op_kernel_context->Input<Tensor>(2);
-    const auto* mean = p_op_kernel_context->Input<Tensor>(3);
-    const auto* var = p_op_kernel_context->Input<Tensor>(4);
+    // parameters stashed by PrePack replace the corresponding (dropped) initializers
+    const Tensor* scale = prepacked_params_[0] ? prepacked_params_[0].get() : p_op_kernel_context->Input<Tensor>(1);
+    const Tensor* B = prepacked_params_[1] ? prepacked_params_[1].get() : p_op_kernel_context->Input<Tensor>(2);
+    const Tensor* mean = prepacked_params_[2] ? prepacked_params_[2].get() : p_op_kernel_context->Input<Tensor>(3);
+    const Tensor* var = prepacked_params_[3] ? prepacked_params_[3].get() : p_op_kernel_context->Input<Tensor>(4);
 
     ORT_RETURN_IF_ERROR(BatchNormHelper::ValidateInputs(X, scale, B, mean, var, is_spatial_));
 
@@ -156,46 +204,73 @@ class BatchNorm : public OpKernel {
     // and standard deviation to the input. For testing, they are
     // specified directly by the input, and for training, they are computed
     // by the op.
-    Eigen::Array<T, Eigen::Dynamic, 1> inv_std(is_spatial_ ? C : sample_size_incl_all_channels);
+    //
+    // We can fuse the output computation as follows:
+    //   ((x - est_mean) * (inv_var) * scale + bias
+    // to
+    //   (x * inv_var * scale) + (bias - est_mean * inv_var * scale)
+    // When all four parameters were constant initializers this fold already happened in PrePack.
+    Eigen::Array<T, Eigen::Dynamic, 1> new_scale;
+    Eigen::Array<T, Eigen::Dynamic, 1> new_bias;
+    const T* new_scale_data;
+    const T* new_bias_data;
 
-    if (!is_train_) {
-      ConstEigenVectorArrayMap<T> var_arr(var->template Data<T>(), is_spatial_ ? C : sample_size_incl_all_channels);
-      inv_std = (var_arr + epsilon_).sqrt().inverse();
+    if (!is_train_ && folded_size_ == static_cast<int64_t>(is_spatial_ ? C : sample_size_incl_all_channels)) {
+      new_scale_data = folded_scale_.get();
+      new_bias_data = folded_bias_.get();
     } else {
+      Eigen::Array<T, Eigen::Dynamic, 1> inv_std(is_spatial_ ? C : sample_size_incl_all_channels);
+
+      if (!is_train_) {
+        ConstEigenVectorArrayMap<T> var_arr(var->template Data<T>(), is_spatial_ ? C : sample_size_incl_all_channels);
+        inv_std = (var_arr + epsilon_).sqrt().inverse();
+      } else {
 #if defined(BATCHNORM_INCLUDE_TRAINING_SUPPORT)
-      EigenVectorArrayMap<T> saved_inv_std_arr(saved_inv_std->template MutableData<T>(), C);
-      saved_inv_std_arr = (saved_inv_std_arr + epsilon_).inverse().sqrt();
-      inv_std = saved_inv_std_arr;
+        EigenVectorArrayMap<T> saved_inv_std_arr(saved_inv_std->template MutableData<T>(), C);
+        saved_inv_std_arr = (saved_inv_std_arr + epsilon_).inverse().sqrt();
+        inv_std = saved_inv_std_arr;
 #endif
-    }
+      }
 
-    // If we're training, do batch normalization based on computation from this batch
-    ConstEigenVectorArrayMap<T> mean_arr(
+      // If we're training, do batch normalization based on computation from this batch
+      ConstEigenVectorArrayMap<T> mean_arr(
 #if defined(BATCHNORM_INCLUDE_TRAINING_SUPPORT)
-        !is_train_ ? mean->template Data<T>() : saved_mean->template Data<T>(),
+          !is_train_ ? mean->template Data<T>() : saved_mean->template Data<T>(),
 #else
-        mean->template Data<T>(),
+          mean->template Data<T>(),
 #endif
-        is_spatial_ ? C : sample_size_incl_all_channels);
+          is_spatial_ ? C : sample_size_incl_all_channels);
+
+      new_scale = inv_std * scale_arr;
+      new_bias = bias_arr - mean_arr * new_scale;
+      new_scale_data = new_scale.data();
+      new_bias_data = new_bias.data();
+    }
 
-    // We can fuse the output computation as follows:
-    //   ((x - est_mean) * (inv_var) * scale + bias
-    // to
-    //   (x * inv_var * scale) + (bias - est_mean * inv_var * scale)
-    Eigen::Array<T, Eigen::Dynamic, 1> new_scale = inv_std * scale_arr;
-    Eigen::Array<T, Eigen::Dynamic, 1> new_bias = bias_arr - mean_arr * new_scale;
     EigenArrayMap<T> Y_arr(Y->template MutableData<T>(),
                            is_spatial_ ? sample_size : sample_size_incl_all_channels,
                            is_spatial_ ? N * C : N);
 
+    // the columns are independent, so the scale and shift pass is split across the thread pool;
+    // for large activations this pass is memory bound and benefits from multiple cores
+    concurrency::ThreadPool* tp = p_op_kernel_context->GetOperatorThreadPool();
     if (is_spatial_) {  // spatial == 1
-      for (size_t nc = 0; nc < N * C; ++nc) {
-        Y_arr.col(nc) = X_arr.col(nc) * new_scale(nc % C) + new_bias(nc % C);
-      }
+      concurrency::ThreadPool::TryBatchParallelFor(
+          tp, static_cast<std::ptrdiff_t>(N * C),
+          [&X_arr, &Y_arr, new_scale_data, new_bias_data, C](ptrdiff_t nc) {
+            const size_t c = static_cast<size_t>(nc) % C;
+            Y_arr.col(nc) = X_arr.col(nc) * new_scale_data[c] + new_bias_data[c];
+          },
+          0);
     } else {  // spatial == 0
-      for (size_t n = 0; n < N; ++n) {
-        Y_arr.col(n) = X_arr.col(n) * new_scale.col(0) + new_bias.col(0);
-      }
+      ConstEigenVectorArrayMap<T> new_scale_arr(new_scale_data, sample_size_incl_all_channels);
+      ConstEigenVectorArrayMap<T> new_bias_arr(new_bias_data, sample_size_incl_all_channels);
+      concurrency::ThreadPool::TryBatchParallelFor(
+          tp, static_cast<std::ptrdiff_t>(N),
+          [&X_arr, &Y_arr, &new_scale_arr, &new_bias_arr](ptrdiff_t n) {
+            Y_arr.col(n) = X_arr.col(n) * new_scale_arr + new_bias_arr;
+          },
+          0);
     }
     return Status::OK();
   }
@@ -205,5 +280,13 @@ class BatchNorm : public OpKernel {
   float momentum_{0};
   const bool is_spatial_;
   int64_t is_train_;
+
+ private:
+  // copies of the constant scale/B/mean/var inputs (input indices 1 to 4) captured by PrePack,
+  // plus the per-channel scale and bias folded from them once all four are constant
+  std::unique_ptr<Tensor> prepacked_params_[4];
+  IAllocatorUniquePtr<T> folded_scale_;
+  IAllocatorUniquePtr<T> folded_bias_;
+  int64_t folded_size_{0};
 };
 }  // namespace onnxruntime
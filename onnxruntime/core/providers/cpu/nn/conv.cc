@@ -159,28 +159,85 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
   const int64_t N = X->Shape()[0];
   const int64_t C = X->Shape()[1];
   const int64_t M = W->Shape()[0];
-  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
 
-  std::vector<int64_t> kernel_shape;
-  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W->Shape(), kernel_shape));
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
 
-  std::vector<int64_t> pads(conv_attrs_.pads);
-  if (pads.empty()) {
-    pads.resize(kernel_shape.size() * 2, 0);
-  }
-  std::vector<int64_t> dilations(conv_attrs_.dilations);
-  if (dilations.empty()) {
-    dilations.resize(kernel_shape.size(), 1);
+  // Reuse the shape-specialized state if the input and weight shapes repeat.
+  std::shared_ptr<const PreparedConvState> state;
+  {
+    std::lock_guard<OrtMutex> lock(prepared_mutex_);
+    if (prepared_ && prepared_->x_shape == X->Shape() && prepared_->w_shape == W->Shape()) {
+      state = prepared_;
+    }
   }
-  std::vector<int64_t> strides(conv_attrs_.strides);
-  if (strides.empty()) {
-    strides.resize(kernel_shape.size(), 1);
+
+  if (!state) {
+    ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
+
+    auto new_state = std::make_shared<PreparedConvState>();
+    new_state->x_shape = X->Shape();
+    new_state->w_shape = W->Shape();
+
+    std::vector<int64_t>& kernel_shape = new_state->kernel_shape;
+    ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W->Shape(), kernel_shape));
+
+    std::vector<int64_t>& pads = new_state->pads;
+    pads = conv_attrs_.pads;
+    if (pads.empty()) {
+      pads.resize(kernel_shape.size() * 2, 0);
+    }
+    std::vector<int64_t>& dilations = new_state->dilations;
+    dilations = conv_attrs_.dilations;
+    if (dilations.empty()) {
+      dilations.resize(kernel_shape.size(), 1);
+    }
+    std::vector<int64_t>& strides = new_state->strides;
+    strides = conv_attrs_.strides;
+    if (strides.empty()) {
+      strides.resize(kernel_shape.size(), 1);
+    }
+
+    new_state->y_dims = {N, M};
+    TensorShape input_shape = X->Shape().Slice(2);
+    ORT_RETURN_IF_ERROR(conv_attrs_.InferOutputShape(input_shape, kernel_shape, strides, dilations, pads,
+                                                     new_state->y_dims));
+
+    // Bail out early if one of the dimensions is zero. Don't cache such
+    // degenerate shapes; they never reach the prepared parameters anyway.
+    if (TensorShape(new_state->y_dims).Size() == 0) {
+      ORT_IGNORE_RETURN_VALUE(context->Output(0, TensorShape(new_state->y_dims)));
+      return Status::OK();
+    }
+
+    const size_t kernel_rank = kernel_shape.size();
+    new_state->use_mlas = kernel_rank >= 1 && kernel_rank <= 3;
+    if (new_state->use_mlas) {
+      MlasConvPrepare(&new_state->mlas_parameters,
+                      kernel_rank,
+                      static_cast<size_t>(N),
+                      static_cast<size_t>(conv_attrs_.group),
+                      static_cast<size_t>(C / conv_attrs_.group),
+                      input_shape.GetDims().data(),
+                      kernel_shape.data(),
+                      dilations.data(),
+                      pads.data(),
+                      strides.data(),
+                      new_state->y_dims.data() + 2,
+                      static_cast<size_t>(M / conv_attrs_.group),
+                      &activation_,
+                      &new_state->working_buffer_size,
+                      thread_pool);
+    }
+
+    {
+      std::lock_guard<OrtMutex> lock(prepared_mutex_);
+      prepared_ = new_state;
+    }
+    state = std::move(new_state);
   }
 
-  std::vector<int64_t> Y_dims({N, M});
+  Tensor* Y = context->Output(0, TensorShape(state->y_dims));
   TensorShape input_shape = X->Shape().Slice(2);
-  ORT_RETURN_IF_ERROR(conv_attrs_.InferOutputShape(input_shape, kernel_shape, strides, dilations, pads, Y_dims));
-  Tensor* Y = context->Output(0, TensorShape(Y_dims));
   TensorShape output_shape = Y->Shape().Slice(2);
 
   // Bail out early if one of the dimensions is zero.
@@ -195,33 +252,18 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
   const auto* Bdata = B != nullptr ? B->template Data<float>() : nullptr;
   auto* Ydata = Y->template MutableData<float>();
 
-  const size_t kernel_rank = kernel_shape.size();
-  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+  const std::vector<int64_t>& kernel_shape = state->kernel_shape;
+  const std::vector<int64_t>& pads = state->pads;
+  const std::vector<int64_t>& dilations = state->dilations;
+  const std::vector<int64_t>& strides = state->strides;
 
-  if (kernel_rank >= 1 && kernel_rank <= 3) {
-    MLAS_CONV_PARAMETERS Parameters;
-    size_t WorkingBufferSize;
-    MlasConvPrepare(&Parameters,
-                    kernel_rank,
-                    static_cast<size_t>(N),
-                    static_cast<size_t>(conv_attrs_.group),
-                    static_cast<size_t>(C / conv_attrs_.group),
-                    input_shape.GetDims().data(),
-                    kernel_shape.data(),
-                    dilations.data(),
-                    pads.data(),
-                    strides.data(),
-                    output_shape.GetDims().data(),
-                    static_cast<size_t>(M / conv_attrs_.group),
-                    &activation_,
-                    &WorkingBufferSize,
-                    thread_pool);
-
-    auto* working_data = WorkingBufferSize > 0 ? alloc->Alloc(SafeInt<size_t>(sizeof(float)) * WorkingBufferSize)
-                                               : nullptr;
+  if (state->use_mlas) {
+    auto* working_data = state->working_buffer_size > 0
+                             ? alloc->Alloc(SafeInt<size_t>(sizeof(float)) * state->working_buffer_size)
+                             : nullptr;
     BufferUniquePtr working_buffer(working_data, BufferDeleter(alloc));
 
-    MlasConv(&Parameters,
+    MlasConv(&state->mlas_parameters,
              Xdata,
              W->template Data<float>(),
              Bdata,
@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #include "core/providers/cpu/nn/conv_attributes.h"
 #include "core/mlas/inc/mlas.h"
 
@@ -34,6 +38,31 @@ class Conv<float> : public OpKernel {
   MLAS_ACTIVATION activation_;
 
   ConvAttributes conv_attrs_;
+
+ private:
+  // Shape-specialized state computed on the first Compute for a given pair of
+  // input/weight shapes: expanded attributes, the inferred output shape and
+  // the MlasConvPrepare result (algorithm selection and working buffer size).
+  // Inference workloads overwhelmingly repeat one shape, so a single cached
+  // entry removes this per-Compute cost; a shape change simply re-prepares.
+  struct PreparedConvState {
+    TensorShape x_shape;
+    TensorShape w_shape;
+    std::vector<int64_t> kernel_shape;
+    std::vector<int64_t> pads;
+    std::vector<int64_t> dilations;
+    std::vector<int64_t> strides;
+    std::vector<int64_t> y_dims;
+    bool use_mlas{false};
+    MLAS_CONV_PARAMETERS mlas_parameters;
+    size_t working_buffer_size{0};
+  };
+
+  // Compute is const and kernel instances are shared across concurrent Run
+  // calls, so the cache slot is guarded by a mutex and handed out as a
+  // shared_ptr snapshot.
+  mutable std::shared_ptr<const PreparedConvState> prepared_;
+  mutable OrtMutex prepared_mutex_;
 };
 
 }  // namespace onnxruntime
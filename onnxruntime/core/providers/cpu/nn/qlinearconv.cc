@@ -399,15 +399,42 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
   BufferUniquePtr col_buffer;
   std::vector<uint8_t> padding_data;
 
+  // Detect convolutions whose im2col rows are already contiguous slices of the
+  // (channels last) input, so the GEMM can read the input in place with a row
+  // stride instead of materializing a col buffer. This holds for pointwise
+  // kernels with unit strides and no padding (row stride C), and for single
+  // group convolutions with no padding, unit dilations, and a kernel that fully
+  // covers every spatial dimension except the outermost (overlapping rows with
+  // stride = outer stride * inner image size * C).
+  int64_t direct_gemm_row_stride = 0;
+  if (!is_depthwise_conv) {
+    if (kernel_size == 1 && conv_attrs_.HasStridesOneAndNoPadding()) {
+      direct_gemm_row_stride = C;
+    } else if (group_count == 1) {
+      bool patches_are_contiguous = true;
+      for (size_t i = 0; i < kernel_rank; ++i) {
+        if (dilations[i] != 1 || pads[i] != 0 || pads[i + kernel_rank] != 0) {
+          patches_are_contiguous = false;
+          break;
+        }
+      }
+      for (size_t i = 1; patches_are_contiguous && i < kernel_rank; ++i) {
+        patches_are_contiguous = kernel_shape[i] == input_shape[i];
+      }
+      if (patches_are_contiguous) {
+        direct_gemm_row_stride = strides[0] * (input_image_size / input_shape[0]) * C;
+      }
+    }
+  }
+
   if (is_depthwise_conv) {
     // Allocate indirection buffer pointers and prepare a padding vector for
     // the im2col transform.
     auto* col_data = alloc->Alloc(SafeInt<size_t>(sizeof(const uint8_t*)) * kernel_size * output_image_size);
     col_buffer = BufferUniquePtr(col_data, BufferDeleter(alloc));
     padding_data.resize(static_cast<size_t>(C), X_zero_point_value);
-  } else if (kernel_size != 1 || !conv_attrs_.HasStridesOneAndNoPadding()) {
-    // Pointwise convolutions can use the original input tensor in place,
-    // otherwise a temporary buffer is required for the im2col transform.
+  } else if (direct_gemm_row_stride == 0) {
+    // A temporary buffer is required for the im2col transform.
     int64_t group_col_buffer_size = (kernel_rank > 2) ? group_count * col_buffer_size : col_buffer_size;
     auto* col_data = alloc->Alloc(SafeInt<size_t>(sizeof(uint8_t)) * group_col_buffer_size);
     col_buffer = BufferUniquePtr(col_data, BufferDeleter(alloc));
@@ -523,8 +550,11 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
           gemm_params.C = worker_gemm_output + group_id * group_output_channels;
           gemm_params.ldc = static_cast<size_t>(M);
 
-          // Prepare the im2col transformation or use the input buffer directly for
-          // pointwise convolutions.
+          // Prepare the im2col transformation or use the input buffer directly
+          // when the im2col rows are contiguous slices of the input. The row
+          // views handed to the GEMM may overlap when the kernel advances by
+          // less than its own extent, which is safe as the A matrix is only
+          // read.
           const auto* group_input_data = input_data + group_id * group_input_channels;
           if (col_buffer) {
             auto* worker_col_buffer = static_cast<uint8_t*>(col_buffer.get()) + output_start * kernel_dim;
@@ -575,8 +605,8 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
             gemm_params.A = worker_col_buffer;
             gemm_params.lda = static_cast<size_t>(kernel_dim);
           } else {
-            gemm_params.A = group_input_data + output_start * C;
-            gemm_params.lda = static_cast<size_t>(C);
+            gemm_params.A = group_input_data + output_start * direct_gemm_row_stride;
+            gemm_params.lda = static_cast<size_t>(direct_gemm_row_stride);
           }
 
           MLAS_GEMM_U8X8_SHAPE_PARAMS gemm_shape;
@@ -6,6 +6,8 @@
 #include "core/framework/tensor.h"
 #include "core/platform/threadpool.h"
 
+#include <algorithm>
+#include <deque>
 #include <functional>
 #include <unordered_map>
 
@@ -89,10 +91,6 @@ using namespace onnxruntime::ngram_details;
 
 namespace onnxruntime {
 
-inline const void* AdvanceElementPtr(const void* p, size_t elements, size_t element_size) {
-  return reinterpret_cast<const uint8_t*>(p) + elements * element_size;
-}
-
 // The weighting criteria.
 // "TF"(term frequency),
 //    the counts are propagated to output
@@ -128,11 +126,31 @@ struct TfIdfVectorizer::Impl {
   gsl::span<const float>   weights_;
 
   // This map contains references to pool_string_ entries
-  // of pool_strings attribute
+  // of pool_strings attribute. Only used while the compact trie below is
+  // built, and cleared afterwards.
   StrMap str_map_;
-  // This map contains pool_int64s entries
+  // This map contains pool_int64s entries. Only used while the compact trie
+  // below is built, and cleared afterwards.
   IntMap int64_map_;
 
+  // Compact build-once form of the ngram trie. A node holds the ngram id and
+  // a span into flat_children_, where the children of a node are stored
+  // contiguously and sorted by token, so each lookup step is a binary search
+  // over a flat array instead of a hash probe with a pointer chase. Node 0
+  // is the root. For string pools the tokens are indexes into str_tokens_,
+  // and input strings are translated once per row before the traversal.
+  struct FlatNode {
+    size_t id_;  // 0 - means no entry, search for a bigger N
+    int32_t child_begin_;
+    int32_t child_count_;
+  };
+  std::vector<FlatNode> flat_nodes_;
+  std::vector<std::pair<int64_t, int32_t>> flat_children_;  // {token, node index}
+  // Sorted unique strings referenced by the pool_strings attribute. The
+  // token of a string is its position in this table.
+  std::vector<std::reference_wrapper<const std::string>> str_tokens_;
+  bool pool_is_string_ = false;
+
   size_t output_size_ = 0;
 
   Impl() = default;
@@ -149,6 +167,66 @@ struct TfIdfVectorizer::Impl {
     assert(static_cast<size_t>(output_idx) < frequencies.size());
     ++frequencies[output_idx];
   }
+
+  // Returns the index of the child of node reached with token, or -1.
+  int32_t FindChild(int32_t node, int64_t token) const {
+    const auto* base = flat_children_.data() + flat_nodes_[node].child_begin_;
+    const auto* end = base + flat_nodes_[node].child_count_;
+    auto hit = std::lower_bound(base, end, token,
+                                [](const std::pair<int64_t, int32_t>& child, int64_t t) { return child.first < t; });
+    return (hit != end && hit->first == token) ? hit->second : -1;
+  }
+
+  // Returns the token of a string, or -1 if it does not occur in the pool.
+  int64_t LookupStringToken(const std::string& s) const {
+    auto hit = std::lower_bound(str_tokens_.cbegin(), str_tokens_.cend(), s,
+                                [](const std::reference_wrapper<const std::string>& a, const std::string& b) {
+                                  return a.get() < b;
+                                });
+    return (hit != str_tokens_.cend() && hit->get() == s)
+               ? static_cast<int64_t>(hit - str_tokens_.cbegin())
+               : -1;
+  }
+
+  void CollectStrings(const StrMap& m) {
+    for (const auto& kv : m) {
+      str_tokens_.push_back(kv.first);
+      CollectStrings(kv.second->leafs_);
+    }
+  }
+
+  // Converts the trie of maps into the flat node/children arrays, laying out
+  // each node's children contiguously in token order.
+  template <typename Map, typename TokenOf>
+  void FlattenTrie(const Map& root, TokenOf token_of) {
+    flat_nodes_.push_back({0, 0, 0});
+    std::deque<std::pair<const Map*, int32_t>> work;
+    work.emplace_back(&root, 0);
+
+    while (!work.empty()) {
+      const Map* m = work.front().first;
+      const int32_t node = work.front().second;
+      work.pop_front();
+
+      const int32_t child_begin = static_cast<int32_t>(flat_children_.size());
+      flat_nodes_[node].child_begin_ = child_begin;
+      flat_nodes_[node].child_count_ = static_cast<int32_t>(m->size());
+
+      for (const auto& kv : *m) {
+        const int32_t child = static_cast<int32_t>(flat_nodes_.size());
+        flat_nodes_.push_back({kv.second->id_, 0, 0});
+        flat_children_.emplace_back(token_of(kv.first), child);
+        if (!kv.second->leafs_.empty()) {
+          work.emplace_back(&kv.second->leafs_, child);
+        }
+      }
+
+      std::sort(flat_children_.begin() + child_begin, flat_children_.end(),
+                [](const std::pair<int64_t, int32_t>& a, const std::pair<int64_t, int32_t>& b) {
+                  return a.first < b.first;
+                });
+    }
+  }
 };
 
 TfIdfVectorizer::TfIdfVectorizer(const OpKernelInfo& info) : OpKernel(info), impl_(new Impl) {
@@ -247,6 +325,30 @@ TfIdfVectorizer::TfIdfVectorizer(const OpKernelInfo& info) : OpKernel(info), imp
     }
     ++ngram_size;
   }
+
+  // Convert the trie of maps into the compact array form used by Compute and
+  // release the maps; they are only needed during construction.
+  if (pool_strings.empty()) {
+    impl_->FlattenTrie(impl_->int64_map_, [](int64_t key) { return key; });
+    impl_->int64_map_.clear();
+  } else {
+    impl_->pool_is_string_ = true;
+    impl_->CollectStrings(impl_->str_map_);
+    auto& tokens = impl_->str_tokens_;
+    std::sort(tokens.begin(), tokens.end(),
+              [](const std::reference_wrapper<const std::string>& a,
+                 const std::reference_wrapper<const std::string>& b) { return a.get() < b.get(); });
+    tokens.erase(std::unique(tokens.begin(), tokens.end(),
+                             [](const std::reference_wrapper<const std::string>& a,
+                                const std::reference_wrapper<const std::string>& b) { return a.get() == b.get(); }),
+                 tokens.end());
+    const Impl& impl = *impl_;
+    impl_->FlattenTrie(impl_->str_map_,
+                       [&impl](const std::reference_wrapper<const std::string>& key) {
+                         return impl.LookupStringToken(key.get());
+                       });
+    impl_->str_map_.clear();
+  }
 }
 
 TfIdfVectorizer::~TfIdfVectorizer() = default;
@@ -310,68 +412,35 @@ void TfIdfVectorizer::OutputResult(OpKernelContext* ctx, size_t B, const std::ve
   }
 }
 
-void TfIdfVectorizer::ComputeImpl(OpKernelContext* ctx, ptrdiff_t row_num, size_t row_size,
+void TfIdfVectorizer::ComputeImpl(const int64_t* row, ptrdiff_t row_num, size_t row_size,
                                   std::vector<uint32_t>& frequencies) const {
-  auto X = ctx->Input<Tensor>(0);
-  const auto elem_size = X->DataType()->Size();
-
-  const void* const row_begin = AdvanceElementPtr(X->DataRaw(), row_num * row_size, elem_size);
-  const void* const row_end = AdvanceElementPtr(row_begin, row_size, elem_size);
-
   const auto& impl = *impl_;
   const auto max_gram_length = impl.max_gram_length_;
   const auto max_skip_distance = impl.max_skip_count_ + 1;  // Convert to distance
   auto start_ngram_size = impl.min_gram_length_;
 
   for (auto skip_distance = 1; skip_distance <= max_skip_distance; ++skip_distance) {
-    auto ngram_start = row_begin;
-    auto const ngram_row_end = row_end;
-
-    while (ngram_start < ngram_row_end) {
+    for (size_t ngram_start = 0; ngram_start < row_size; ++ngram_start) {
       // We went far enough so no n-grams of any size can be gathered
-      auto at_least_this = AdvanceElementPtr(ngram_start, skip_distance * (start_ngram_size - 1), elem_size);
-      if (at_least_this >= ngram_row_end) {
+      if (ngram_start + skip_distance * (start_ngram_size - 1) >= row_size) {
         break;
       }
 
-      auto ngram_item = ngram_start;
-      if (X->IsDataTypeString()) {
-        const std::string* str_item = reinterpret_cast<const std::string*>(ngram_item);
-        const StrMap* str_map = &impl.str_map_;
-        for (auto ngram_size = 1;
-             !str_map->empty() &&
-             ngram_size <= max_gram_length &&
-             str_item < ngram_row_end;
-             ++ngram_size, str_item += skip_distance) {
-          auto hit = str_map->find(*str_item);
-          if (hit == str_map->end()) {
-            break;
-          }
-          if (ngram_size >= start_ngram_size && hit->second->id_ != 0) {
-            impl.IncrementCount(hit->second->id_, row_num, frequencies);
-          }
-          str_map = &hit->second->leafs_;
+      int32_t node = 0;
+      size_t ngram_item = ngram_start;
+      for (auto ngram_size = 1;
+           ngram_size <= max_gram_length &&
+           ngram_item < row_size;
+           ++ngram_size, ngram_item += skip_distance) {
+        node = impl.FindChild(node, row[ngram_item]);
+        if (node < 0) {
+          break;
         }
-      } else {
-        const IntMap* int_map = &impl.int64_map_;
-        for (auto ngram_size = 1;
-             !int_map->empty() &&
-             ngram_size <= max_gram_length &&
-             ngram_item < ngram_row_end;
-             ++ngram_size, ngram_item = AdvanceElementPtr(ngram_item, skip_distance, elem_size)) {
-          int64_t val = (X->IsDataType<int32_t>()) ? int64_t{*reinterpret_cast<const int32_t*>(ngram_item)} : *reinterpret_cast<const int64_t*>(ngram_item);
-          auto hit = int_map->find(val);
-          if (hit == int_map->end()) {
-            break;
-          }
-          if (ngram_size >= start_ngram_size && hit->second->id_ != 0) {
-            impl.IncrementCount(hit->second->id_, row_num, frequencies);
-          }
-          int_map = &hit->second->leafs_;
+        const auto id = impl.flat_nodes_[node].id_;
+        if (ngram_size >= start_ngram_size && id != 0) {
+          impl.IncrementCount(id, row_num, frequencies);
         }
       }
-      // Sliding window shift
-      ngram_start = AdvanceElementPtr(ngram_start, 1, elem_size);
     }
     // We count UniGrams only once since they are not affected
     // by skip distance
@@ -416,9 +485,10 @@ Status TfIdfVectorizer::Compute(OpKernelContext* ctx) const {
   std::vector<uint32_t> frequencies;
   frequencies.resize(num_rows * impl_->output_size_, 0);
 
+  const bool is_string_input = X->IsDataTypeString();
   if (total_items == 0 ||
-      (X->IsDataTypeString() && impl_->str_map_.empty()) ||
-      ((X->IsDataType<int32_t>() || X->IsDataType<int64_t>()) && impl_->int64_map_.empty())) {
+      impl_->flat_children_.empty() ||
+      is_string_input != impl_->pool_is_string_) {
     // TfidfVectorizer may receive an empty input when it follows a Tokenizer
     // (for example for a string containing only stopwords).
     // TfidfVectorizer returns a zero tensor of shape
@@ -428,11 +498,42 @@ Status TfIdfVectorizer::Compute(OpKernelContext* ctx) const {
     return Status::OK();
   }
 
-  std::function<void(ptrdiff_t)> fn = [this, ctx, C, &frequencies](ptrdiff_t row_num) {
-    ComputeImpl(ctx, row_num, C, frequencies);
-  };
+  // Rough sliding window work per row, used to decide the partitioning.
+  const double cost = static_cast<double>(C) *
+                      (impl_->max_skip_count_ + 1) * impl_->max_gram_length_;
+
+  concurrency::ThreadPool::TryParallelFor(
+      ctx->GetOperatorThreadPool(), num_rows, cost,
+      [this, X, C, is_string_input, &frequencies](ptrdiff_t first, ptrdiff_t last) {
+        // Token scratch reused across the rows of this partition. String and
+        // int32 rows are translated once per row so the trie traversal below
+        // only touches integer tokens.
+        std::vector<int64_t> tokens;
+        if (is_string_input || X->IsDataType<int32_t>()) {
+          tokens.resize(C);
+        }
+
+        for (ptrdiff_t row_num = first; row_num < last; ++row_num) {
+          const int64_t* row;
+          if (is_string_input) {
+            const auto* items = X->Data<std::string>() + row_num * C;
+            for (size_t i = 0; i < C; ++i) {
+              tokens[i] = impl_->LookupStringToken(items[i]);
+            }
+            row = tokens.data();
+          } else if (X->IsDataType<int32_t>()) {
+            const auto* items = X->Data<int32_t>() + row_num * C;
+            for (size_t i = 0; i < C; ++i) {
+              tokens[i] = items[i];
+            }
+            row = tokens.data();
+          } else {
+            row = X->Data<int64_t>() + row_num * C;
+          }
 
-  concurrency::ThreadPool::TryBatchParallelFor(ctx->GetOperatorThreadPool(), num_rows, std::move(fn), 0);
+          ComputeImpl(row, row_num, C, frequencies);
+        }
+      });
 
   OutputResult(ctx, B, frequencies);
 
@@ -13,6 +13,8 @@ limitations under the License.
 
 #include "non_max_suppression.h"
 #include "non_max_suppression_helper.h"
+#include "core/platform/threadpool.h"
+#include <algorithm>
 #include <queue>
 #include <utility>
 //TODO:fix the warnings
@@ -114,6 +116,109 @@ Status NonMaxSuppressionBase::GetThresholdsFromInputs(const PrepareContext& pc,
   return Status::OK();
 }
 
+namespace {
+
+// Axis aligned extent of a box, precomputed once per candidate so the repeated
+// IOU checks do not re-derive it from the raw box encoding.
+struct BoxExtent {
+  float x_min_;
+  float x_max_;
+  float y_min_;
+  float y_max_;
+
+  BoxExtent(const float* boxes_data, int64_t box_index, int64_t center_point_box) {
+    const float* box = boxes_data + 4 * box_index;
+    if (0 == center_point_box) {
+      // boxes data format [y1, x1, y2, x2]
+      MaxMin(box[1], box[3], x_min_, x_max_);
+      MaxMin(box[0], box[2], y_min_, y_max_);
+    } else {
+      // 1 == center_point_box => boxes data format [x_center, y_center, width, height]
+      float width_half = box[2] / 2;
+      float height_half = box[3] / 2;
+      x_min_ = box[0] - width_half;
+      x_max_ = box[0] + width_half;
+      y_min_ = box[1] - height_half;
+      y_max_ = box[1] + height_half;
+    }
+  }
+};
+
+// Same arithmetic as nms_helpers::SuppressByIOU, operating on precomputed extents.
+bool SuppressByIOU(const BoxExtent& box1, const BoxExtent& box2, float iou_threshold) {
+  const float intersection_x_min = HelperMax(box1.x_min_, box2.x_min_);
+  const float intersection_x_max = HelperMin(box1.x_max_, box2.x_max_);
+  if (intersection_x_max <= intersection_x_min)
+    return false;
+
+  const float intersection_y_min = HelperMax(box1.y_min_, box2.y_min_);
+  const float intersection_y_max = HelperMin(box1.y_max_, box2.y_max_);
+  if (intersection_y_max <= intersection_y_min)
+    return false;
+
+  const float intersection_area = (intersection_x_max - intersection_x_min) *
+                                  (intersection_y_max - intersection_y_min);
+  if (intersection_area <= .0f) {
+    return false;
+  }
+
+  const float area1 = (box1.x_max_ - box1.x_min_) * (box1.y_max_ - box1.y_min_);
+  const float area2 = (box2.x_max_ - box2.x_min_) * (box2.y_max_ - box2.y_min_);
+  const float union_area = area1 + area2 - intersection_area;
+
+  if (area1 <= .0f || area2 <= .0f || union_area <= .0f) {
+    return false;
+  }
+
+  return intersection_area / union_area > iou_threshold;
+}
+
+// Interval index over the boxes selected so far. The extents are kept sorted by
+// x_min_ together with a running maximum of x_max_, so a candidate only gets IOU
+// checked against selected boxes whose x interval can actually overlap it:
+// a binary search bounds the entries with x_min_ < candidate.x_max_ and the
+// backward walk stops as soon as the running maximum falls below candidate.x_min_.
+class SelectedBoxIndex {
+ public:
+  void Reserve(size_t n) {
+    extents_.reserve(n);
+    prefix_max_x_max_.reserve(n);
+  }
+
+  bool SuppressedBy(const BoxExtent& candidate, float iou_threshold) const {
+    auto it = std::lower_bound(extents_.begin(), extents_.end(), candidate.x_max_,
+                               [](const BoxExtent& extent, float x) { return extent.x_min_ < x; });
+    for (auto i = static_cast<ptrdiff_t>(it - extents_.begin()) - 1; i >= 0; --i) {
+      if (prefix_max_x_max_[i] <= candidate.x_min_) {
+        // no earlier entry reaches the candidate either
+        break;
+      }
+      if (SuppressByIOU(extents_[i], candidate, iou_threshold)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void Insert(const BoxExtent& extent) {
+    auto it = std::lower_bound(extents_.begin(), extents_.end(), extent,
+                               [](const BoxExtent& lhs, const BoxExtent& rhs) { return lhs.x_min_ < rhs.x_min_; });
+    size_t pos = it - extents_.begin();
+    extents_.insert(it, extent);
+    prefix_max_x_max_.insert(prefix_max_x_max_.begin() + pos, 0.f);
+    for (size_t i = pos; i < extents_.size(); ++i) {
+      prefix_max_x_max_[i] = i == 0 ? extents_[i].x_max_
+                                    : HelperMax(prefix_max_x_max_[i - 1], extents_[i].x_max_);
+    }
+  }
+
+ private:
+  std::vector<BoxExtent> extents_;
+  std::vector<float> prefix_max_x_max_;
+};
+
+}  // namespace
+
 Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
   PrepareContext pc;
   ORT_RETURN_IF_ERROR(PrepareCompute(ctx, pc));
@@ -145,61 +250,70 @@ Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
 
   const auto center_point_box = GetCenterPointBox();
 
-  std::vector<SelectedIndex> selected_indices;
-  std::vector<BoxInfoPtr> selected_boxes_inside_class;
-  selected_boxes_inside_class.reserve(std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_));
-
-  for (int64_t batch_index = 0; batch_index < pc.num_batches_; ++batch_index) {
-    for (int64_t class_index = 0; class_index < pc.num_classes_; ++class_index) {
-      int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
-      const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
-      std::vector<BoxInfoPtr> candidate_boxes;
-      candidate_boxes.reserve(pc.num_boxes_);
-
-      // Filter by score_threshold_
-      const auto* class_scores = scores_data + box_score_offset;
-      if (pc.score_threshold_ != nullptr) {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          if (*class_scores > score_threshold) {
+  // Each (batch, class) pair is independent; selections are gathered per pair and
+  // concatenated afterwards so the output order matches the sequential version.
+  const int64_t num_pairs = pc.num_batches_ * pc.num_classes_;
+  std::vector<std::vector<SelectedIndex>> selections(num_pairs);
+
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      ctx->GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(num_pairs),
+      [&](std::ptrdiff_t pair_index) {
+        const int64_t batch_index = pair_index / pc.num_classes_;
+        const int64_t class_index = pair_index % pc.num_classes_;
+        int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
+        const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
+        std::vector<BoxInfoPtr> candidate_boxes;
+        candidate_boxes.reserve(pc.num_boxes_);
+
+        // Filter by score_threshold_
+        const auto* class_scores = scores_data + box_score_offset;
+        if (pc.score_threshold_ != nullptr) {
+          for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
+            if (*class_scores > score_threshold) {
+              candidate_boxes.emplace_back(*class_scores, box_index);
+            }
+          }
+        } else {
+          for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
             candidate_boxes.emplace_back(*class_scores, box_index);
           }
         }
-      } else {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          candidate_boxes.emplace_back(*class_scores, box_index);
-        }
-      }
-      std::priority_queue<BoxInfoPtr, std::vector<BoxInfoPtr>> sorted_boxes(std::less<BoxInfoPtr>(), std::move(candidate_boxes));
-
-      selected_boxes_inside_class.clear();
-      // Get the next box with top score, filter by iou_threshold
-      while (!sorted_boxes.empty() && static_cast<int64_t>(selected_boxes_inside_class.size()) < max_output_boxes_per_class) {
-        const BoxInfoPtr& next_top_score = sorted_boxes.top();
-
-        bool selected = true;
-        // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold
-        for (const auto& selected_index : selected_boxes_inside_class) {
-          if (SuppressByIOU(batch_boxes, next_top_score.index_, selected_index.index_, center_point_box, iou_threshold)) {
-            selected = false;
-            break;
+        // The heap only pays for the boxes actually popped, so the loop below stops
+        // early once max_output_boxes_per_class boxes have been selected.
+        std::priority_queue<BoxInfoPtr, std::vector<BoxInfoPtr>> sorted_boxes(std::less<BoxInfoPtr>(), std::move(candidate_boxes));
+
+        SelectedBoxIndex selected_inside_class;
+        selected_inside_class.Reserve(std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_));
+        std::vector<SelectedIndex>& selected_indices = selections[pair_index];
+
+        // Get the next box with top score, filter by iou_threshold
+        while (!sorted_boxes.empty() && static_cast<int64_t>(selected_indices.size()) < max_output_boxes_per_class) {
+          const BoxInfoPtr& next_top_score = sorted_boxes.top();
+
+          // Check with existing selected boxes for this class, suppress if exceed the
+          // IOU (Intersection Over Union) threshold
+          BoxExtent candidate(batch_boxes, next_top_score.index_, center_point_box);
+          if (!selected_inside_class.SuppressedBy(candidate, iou_threshold)) {
+            selected_inside_class.Insert(candidate);
+            selected_indices.emplace_back(batch_index, class_index, next_top_score.index_);
           }
-        }
-
-        if (selected) {
-          selected_boxes_inside_class.push_back(next_top_score);
-          selected_indices.emplace_back(batch_index, class_index, next_top_score.index_);
-        }
-        sorted_boxes.pop();
-      }  //while
-    }    //for class_index
-  }      //for batch_index
+          sorted_boxes.pop();
+        }  //while
+      });
 
   const auto last_dim = 3;
-  const auto num_selected = selected_indices.size();
+  size_t num_selected = 0;
+  for (const auto& selection : selections) {
+    num_selected += selection.size();
+  }
   Tensor* output = ctx->Output(0, {static_cast<int64_t>(num_selected), last_dim});
   ORT_ENFORCE(output != nullptr);
   static_assert(last_dim * sizeof(int64_t) == sizeof(SelectedIndex), "Possible modification of SelectedIndex");
-  memcpy(output->MutableData<int64_t>(), selected_indices.data(), num_selected * sizeof(SelectedIndex));
+  auto* output_data = output->MutableData<int64_t>();
+  for (const auto& selection : selections) {
+    memcpy(output_data, selection.data(), selection.size() * sizeof(SelectedIndex));
+    output_data += selection.size() * last_dim;
+  }
 
   return Status::OK();
 }
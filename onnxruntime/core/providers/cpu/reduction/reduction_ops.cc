@@ -267,6 +267,11 @@ static void ValidateFastReduceKRK(const std::vector<int64_t>& fast_shape, const
   ORT_ENFORCE(fast_shape[0] * fast_shape[2] == output.Shape().Size(), "Output size mismatch.");
 }
 
+static void ValidateFastReduceR(const std::vector<int64_t>& fast_shape, const Tensor& output) {
+  ORT_ENFORCE(fast_shape.size() == 1, "Only works on a single flattened dimension.");
+  ORT_ENFORCE(output.Shape().Size() == 1, "Output size mismatch.");
+}
+
 void ReduceAggregatorBase::FastReduceKR(const Tensor&, const std::vector<int64_t>&, Tensor&, concurrency::ThreadPool*) {
   ValidateMustBeOverloaded();
 }
@@ -276,6 +281,9 @@ void ReduceAggregatorBase::FastReduceRK(const Tensor&, const std::vector<int64_t
 void ReduceAggregatorBase::FastReduceKRK(const Tensor&, const std::vector<int64_t>&, Tensor&, concurrency::ThreadPool*) {
   ValidateMustBeOverloaded();
 }
+void ReduceAggregatorBase::FastReduceR(const Tensor&, const std::vector<int64_t>&, Tensor&, concurrency::ThreadPool*) {
+  ValidateMustBeOverloaded();
+}
 
 TensorOpCost ParallelReduceFastCost(int64_t n_row, int64_t n_col, int64_t element_size, int n_ops) {
   return TensorOpCost{static_cast<double>(n_row * n_col * element_size),
@@ -680,7 +688,8 @@ bool CommonFastReduceSwitch(OpKernelContext* ctx,
                             FastReduceKind which_fast_reduce,
                             fast_reduce_fct* case_kr,
                             fast_reduce_fct* case_rk,
-                            fast_reduce_fct* case_krk) {
+                            fast_reduce_fct* case_krk,
+                            fast_reduce_fct* case_r) {
   std::vector<int64_t> axes;
   const Tensor* input = ctx->Input<Tensor>(0);
   auto reduced_dims = input->Shape().GetDims();
@@ -724,7 +733,11 @@ bool CommonFastReduceSwitch(OpKernelContext* ctx,
           } else {
             break;
           }
-        case FastReduceKind::kR:
+        case FastReduceKind::kR: {
+          ValidateFastReduceR(fast_shape, *output);
+          case_r(*input, fast_shape, *output, ctx->GetOperatorThreadPool());
+          return true;
+        }
         case FastReduceKind::kK:
         case FastReduceKind::kNone:
         default:
@@ -747,7 +760,8 @@ bool CommonFastReduce(OpKernelContext* ctx,
                       std::vector<int64_t>& fast_axes) {
   return CommonFastReduceSwitch(ctx, axes_, keepdims_, noop_with_empty_axes,
                                 fast_kind, fast_shape, output_shape, fast_axes,
-                                AGG::WhichFastReduce(), &AGG::FastReduceKR, &AGG::FastReduceRK, &AGG::FastReduceKRK);
+                                AGG::WhichFastReduce(), &AGG::FastReduceKR, &AGG::FastReduceRK, &AGG::FastReduceKRK,
+                                &AGG::FastReduceR);
 }
 
 static void ValidateKeepDims(const TensorShape& shape, int64_t keepdims) {
@@ -934,7 +948,11 @@ std::unique_ptr<Tensor> ReduceSum<T>::Impl(const Tensor& input, const std::vecto
         } else {
           break;
         }
-      case FastReduceKind::kR:
+      case FastReduceKind::kR: {
+        ValidateFastReduceR(fast_shape, *output);
+        ReduceAggregatorSum<T>::FastReduceR(input, fast_shape, *output, tp);
+        return output;
+      }
       case FastReduceKind::kK:
       case FastReduceKind::kNone:
       default:
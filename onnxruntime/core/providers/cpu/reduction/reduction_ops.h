@@ -149,6 +149,7 @@ class ReduceAggregatorBase {
   static void FastReduceKR(const Tensor&, const std::vector<int64_t>&, Tensor&, concurrency::ThreadPool*);
   static void FastReduceRK(const Tensor&, const std::vector<int64_t>&, Tensor&, concurrency::ThreadPool*);
   static void FastReduceKRK(const Tensor&, const std::vector<int64_t>&, Tensor&, concurrency::ThreadPool*);
+  static void FastReduceR(const Tensor&, const std::vector<int64_t>&, Tensor&, concurrency::ThreadPool*);
 };
 
 template <typename T, typename TVAL = T>
@@ -183,7 +184,21 @@ class ReduceAggregatorSum : public ReduceAggregator<T, TVAL> {
 
   // Fast reduction
   static inline FastReduceKind WhichFastReduce() {
-    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK;
+    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kR;
+  }
+
+  // Sums a contiguous range with four independent accumulation chains to hide the
+  // floating point add latency, combining them pairwise at the end.
+  static T SumRange(const T* from, int64_t n) {
+    int64_t quarter = n / 4;
+    if (quarter < 16) {
+      return ConstEigenVectorArrayMap<T>(from, n).sum();
+    }
+    T s0 = ConstEigenVectorArrayMap<T>(from, quarter).sum();
+    T s1 = ConstEigenVectorArrayMap<T>(from + quarter, quarter).sum();
+    T s2 = ConstEigenVectorArrayMap<T>(from + 2 * quarter, quarter).sum();
+    T s3 = ConstEigenVectorArrayMap<T>(from + 3 * quarter, n - 3 * quarter).sum();
+    return (s0 + s1) + (s2 + s3);
   }
 
   static void FastReduceKR(const Tensor& input, const std::vector<int64_t>& fast_shape,
@@ -195,11 +210,41 @@ class ReduceAggregatorSum : public ReduceAggregator<T, TVAL> {
         tp, fast_shape[0], ParallelReduceFastCost(1, stridei, sizeof(T), 6),
         [data, stridei, out](ptrdiff_t first, ptrdiff_t last) {
           for (ptrdiff_t d = first; d < last; ++d) {
-            out[d] = ConstEigenVectorArrayMap<T>(data + d * stridei, stridei).sum();
+            out[d] = SumRange(data + d * stridei, stridei);
           }
         });
   }
 
+  // Reduction on all axes: every chunk is summed independently and the per-chunk
+  // partial sums are combined pairwise (tree combine).
+  static void FastReduceR(const Tensor& input, const std::vector<int64_t>& fast_shape,
+                          Tensor& output, concurrency::ThreadPool* tp) {
+    const T* data = input.Data<T>();
+    T* out = output.MutableData<T>();
+    int64_t count = fast_shape[0];
+    constexpr int64_t kMinChunkSize = 16384;
+    int64_t n_chunks = std::min<int64_t>(concurrency::ThreadPool::DegreeOfParallelism(tp),
+                                         count / kMinChunkSize);
+    if (n_chunks < 2) {
+      out[0] = SumRange(data, count);
+      return;
+    }
+    std::vector<T> partials(n_chunks);
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        tp, static_cast<std::ptrdiff_t>(n_chunks),
+        [data, count, n_chunks, &partials](std::ptrdiff_t chunk) {
+          int64_t begin = chunk * count / n_chunks;
+          int64_t end = (chunk + 1) * count / n_chunks;
+          partials[chunk] = SumRange(data + begin, end - begin);
+        });
+    for (int64_t stride = 1; stride < n_chunks; stride *= 2) {
+      for (int64_t i = 0; i + stride < n_chunks; i += 2 * stride) {
+        partials[i] += partials[i + stride];
+      }
+    }
+    out[0] = partials[0];
+  }
+
   static void FastReduceRK(const Tensor& input, const std::vector<int64_t>& fast_shape,
                            Tensor& output, concurrency::ThreadPool* tp) {
     int64_t N = fast_shape[1];
@@ -257,44 +302,67 @@ class ReduceAggregatorMean : public ReduceAggregatorSum<T, TVAL> {
 
   // Fast reduction
   // WhichFastReduce() already defined in ReduceAggregatorSum
+  // The division is folded into the parallel loops instead of running as a
+  // separate pass over the output.
 
   static void FastReduceKR(const Tensor& input, const std::vector<int64_t>& fast_shape,
                            Tensor& output, concurrency::ThreadPool* tp) {
-    ReduceAggregatorSum<T, TVAL>::FastReduceKR(input, fast_shape, output, tp);
-    // TODO: use MLAS or BLAS
+    const T* data = input.Data<T>();
     T* out = output.MutableData<T>();
-    T* end = out + fast_shape[0];
-    for (; out != end; ++out) {
-      *out /= static_cast<T>(fast_shape[1]);
-    }
+    int64_t stridei = fast_shape[1];
+    T div = static_cast<T>(stridei);
+    concurrency::ThreadPool::TryParallelFor(
+        tp, fast_shape[0], ParallelReduceFastCost(1, stridei, sizeof(T), 6),
+        [data, stridei, out, div](ptrdiff_t first, ptrdiff_t last) {
+          for (ptrdiff_t d = first; d < last; ++d) {
+            out[d] = ReduceAggregatorSum<T, TVAL>::SumRange(data + d * stridei, stridei) / div;
+          }
+        });
   }
 
   static void FastReduceRK(const Tensor& input, const std::vector<int64_t>& fast_shape,
                            Tensor& output, concurrency::ThreadPool* tp) {
-    ReduceAggregatorSum<T, TVAL>::FastReduceRK(input, fast_shape, output, tp);
-    // TODO: use MLAS or BLAS
+    int64_t n_rows = fast_shape[0];
+    int64_t N = fast_shape[1];
+    const T* data = input.Data<T>();
     T* out = output.MutableData<T>();
-    T* end = out + fast_shape[1];
-    for (; out != end; ++out) {
-      *out /= static_cast<T>(fast_shape[0]);
-    }
+    memcpy(out, data, N * sizeof(T));
+    concurrency::ThreadPool::TryParallelFor(
+        tp, N, ParallelReduceFastCost(1, n_rows, sizeof(T), 6),
+        [data, out, N, n_rows](ptrdiff_t begin, ptrdiff_t end) {
+          for (int64_t row = 1; row < n_rows; ++row) {
+            EigenVectorArrayMap<T>(out + begin, end - begin) += ConstEigenVectorArrayMap<T>(
+                data + row * N + begin, end - begin);
+          }
+          // divide while the output slice is still in cache
+          EigenVectorArrayMap<T>(out + begin, end - begin) /= static_cast<T>(n_rows);
+        });
   }
 
   static void FastReduceKRK(const Tensor& input, const std::vector<int64_t>& fast_shape,
                             Tensor& output, concurrency::ThreadPool* tp) {
-    ReduceAggregatorSum<T, TVAL>::FastReduceKRK(input, fast_shape, output, tp);
+    int64_t N = fast_shape[2];
+    const T* data = input.Data<T>();
+    int64_t stridei = fast_shape[1] * fast_shape[2];
     int64_t strideo = fast_shape[2];
     T* out = output.MutableData<T>();
-    T* begin;
-    T* end;
+    std::vector<T> one(fast_shape[1], 1);
     T div = static_cast<T>(fast_shape[1]);
-    for (int64_t d = 0; d < fast_shape[0]; ++d) {
-      begin = out + strideo * d;
-      end = begin + strideo;
-      for (; begin != end; ++begin) {
-        *begin /= div;
-      }
-    }
+    concurrency::ThreadPool::TryParallelFor(
+        tp, fast_shape[0], ParallelReduceFastCost(fast_shape[1], fast_shape[2], sizeof(T), 6),
+        [one, data, fast_shape, stridei, strideo, out, N, div](ptrdiff_t begin, ptrdiff_t last) {
+          for (ptrdiff_t d = begin; d < last; ++d) {
+            math::MatMul<T>(1, N, fast_shape[1], one.data(), data + stridei * d, out + strideo * d, nullptr);
+            EigenVectorArrayMap<T>(out + strideo * d, strideo) /= div;
+          }
+        });
+  }
+
+  static void FastReduceR(const Tensor& input, const std::vector<int64_t>& fast_shape,
+                          Tensor& output, concurrency::ThreadPool* tp) {
+    ReduceAggregatorSum<T, TVAL>::FastReduceR(input, fast_shape, output, tp);
+    // the mean only costs one extra division on the scalar result
+    *output.MutableData<T>() /= static_cast<T>(fast_shape[0]);
   }
 };
 
@@ -170,7 +170,8 @@ class UniDirectionalGru {
                     onnxruntime::concurrency::ThreadPool* ttp);
 
   void Compute(const gsl::span<const T>& inputs, const gsl::span<const int>& sequence_lengths, int num_directions,
-               const gsl::span<const T>& input_weights, const gsl::span<const T>& recurrent_weights,
+               const GemmWeights<T>& input_weights, const GemmWeights<T>& recurrent_weights_ZR,
+               const GemmWeights<T>& recurrent_weights_H,
                gsl::span<T>& outputs, gsl::span<T>& final_hidden_state);
 
   ~UniDirectionalGru() = default;
@@ -245,6 +246,154 @@ class UniDirectionalGru {
 #define DumpMatrix(...) ((void)0)
 #endif
 
+Status DeepCpuGruOp::TryPackInputWeights(const Tensor& weights, AllocatorPtr& alloc,
+                                         /*out*/ bool& is_packed,
+                                         /*out*/ PrePackedWeights* prepacked_weights) {
+  const auto& shape = weights.Shape();
+  if (shape.NumDimensions() != 3) {
+    return Status::OK();
+  }
+
+  // weights: [num_directions, 3*hidden_size, input_size]
+  const size_t N = static_cast<size_t>(shape[1]);
+  const size_t K = static_cast<size_t>(shape[2]);
+
+  if ((shape[0] != num_directions_) || (N != static_cast<size_t>(hidden_size_ * 3))) {
+    return Status::OK();
+  }
+
+  const size_t packed_weights_size = MlasGemmPackBSize(N, K);
+  if (packed_weights_size == 0) {
+    return Status::OK();
+  }
+
+  size_t packed_weights_data_size = SafeInt<size_t>(packed_weights_size) * num_directions_;
+  auto* packed_weights_data = alloc->Alloc(packed_weights_data_size);
+
+  // Initialize memory to 0 as there could be some padding associated with pre-packed
+  // buffer memory and we don not want it uninitialized and generate different hashes
+  // if and when we try to cache this pre-packed buffer for sharing between sessions.
+  memset(packed_weights_data, 0, packed_weights_data_size);
+
+  packed_W_.buffer_ = BufferUniquePtr(packed_weights_data, BufferDeleter(alloc));
+  packed_W_.buffer_size_ = packed_weights_data_size;
+  packed_W_.weights_size_ = packed_weights_size;
+  packed_W_.shape_ = shape;
+
+  const auto* weights_data = weights.Data<float>();
+  for (int i = 0; i < num_directions_; i++) {
+    MlasGemmPackB(CblasTrans, N, K, weights_data, K, packed_weights_data);
+    packed_weights_data = static_cast<uint8_t*>(packed_weights_data) + packed_weights_size;
+    weights_data += N * K;
+  }
+
+  if (prepacked_weights != nullptr) {
+    prepacked_weights->buffers_.push_back(std::move(packed_W_.buffer_));
+    prepacked_weights->buffer_sizes_.push_back(packed_W_.buffer_size_);
+  }
+
+  is_packed = true;
+  return Status::OK();
+}
+
+Status DeepCpuGruOp::TryPackRecurrentWeights(const Tensor& weights, AllocatorPtr& alloc,
+                                             /*out*/ bool& is_packed,
+                                             /*out*/ PrePackedWeights* prepacked_weights) {
+  const auto& shape = weights.Shape();
+  if (shape.NumDimensions() != 3) {
+    return Status::OK();
+  }
+
+  // recurrence weights: [num_directions, 3*hidden_size, hidden_size]
+  const size_t K = static_cast<size_t>(shape[2]);
+
+  if ((shape[0] != num_directions_) ||
+      (shape[1] != static_cast<int64_t>(hidden_size_) * 3) ||
+      (K != static_cast<size_t>(hidden_size_))) {
+    return Status::OK();
+  }
+
+  // the recurrence weights are consumed as two GEMM inputs (the combined Z and R gate rows,
+  // and the H gate rows) so the two row blocks are packed separately per direction
+  const size_t N_ZR = static_cast<size_t>(hidden_size_) * 2;
+  const size_t N_H = static_cast<size_t>(hidden_size_);
+
+  const size_t packed_ZR_size = MlasGemmPackBSize(N_ZR, K);
+  const size_t packed_H_size = MlasGemmPackBSize(N_H, K);
+  if (packed_ZR_size == 0 || packed_H_size == 0) {
+    return Status::OK();
+  }
+
+  auto pack_block = [&](PackedWeights& packed_weights, size_t packed_size, size_t N, const float* src) {
+    size_t buffer_size = SafeInt<size_t>(packed_size) * num_directions_;
+    auto* data = alloc->Alloc(buffer_size);
+
+    // Initialize memory to 0 as there could be some padding associated with pre-packed
+    // buffer memory and we don not want it uninitialized and generate different hashes
+    // if and when we try to cache this pre-packed buffer for sharing between sessions.
+    memset(data, 0, buffer_size);
+
+    packed_weights.buffer_ = BufferUniquePtr(data, BufferDeleter(alloc));
+    packed_weights.buffer_size_ = buffer_size;
+    packed_weights.weights_size_ = packed_size;
+    packed_weights.shape_ = shape;
+
+    for (int i = 0; i < num_directions_; i++) {
+      MlasGemmPackB(CblasTrans, N, K, src, K, data);
+      data = static_cast<uint8_t*>(data) + packed_size;
+      src += 3 * hidden_size_ * K;  // per direction stride in the original tensor
+    }
+  };
+
+  const auto* weights_data = weights.Data<float>();
+  pack_block(packed_R_ZR_, packed_ZR_size, N_ZR, weights_data);
+  pack_block(packed_R_H_, packed_H_size, N_H, weights_data + N_ZR * K);
+
+  if (prepacked_weights != nullptr) {
+    prepacked_weights->buffers_.push_back(std::move(packed_R_ZR_.buffer_));
+    prepacked_weights->buffer_sizes_.push_back(packed_R_ZR_.buffer_size_);
+    prepacked_weights->buffers_.push_back(std::move(packed_R_H_.buffer_));
+    prepacked_weights->buffer_sizes_.push_back(packed_R_H_.buffer_size_);
+  }
+
+  is_packed = true;
+  return Status::OK();
+}
+
+Status DeepCpuGruOp::PrePack(const Tensor& tensor, int input_idx,
+                             AllocatorPtr alloc, /*out*/ bool& is_packed,
+                             /*out*/ PrePackedWeights* prepacked_weights) {
+  is_packed = false;
+
+  if (tensor.IsDataType<float>()) {
+    if (input_idx == 1) {
+      ORT_RETURN_IF_ERROR(TryPackInputWeights(tensor, alloc, is_packed, prepacked_weights));
+    } else if (input_idx == 2) {
+      ORT_RETURN_IF_ERROR(TryPackRecurrentWeights(tensor, alloc, is_packed, prepacked_weights));
+    }
+  }
+
+  return Status::OK();
+}
+
+Status DeepCpuGruOp::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                               int input_idx,
+                                               /*out*/ bool& used_shared_buffers) {
+  used_shared_buffers = false;
+
+  if (input_idx == 1) {
+    used_shared_buffers = true;
+    packed_W_.buffer_ = std::move(prepacked_buffers[0]);
+  } else if (input_idx == 2) {
+    // the recurrence weights were packed as two blocks (see TryPackRecurrentWeights)
+    used_shared_buffers = true;
+    packed_R_ZR_.buffer_ = std::move(prepacked_buffers[0]);
+    packed_R_H_.buffer_ = std::move(prepacked_buffers[1]);
+  }
+
+  return Status::OK();
+}
+
 Status DeepCpuGruOp::Compute(OpKernelContext* context) const {
   const Tensor& X = *context->Input<Tensor>(0);  // inputs. [seq_length, batch_size, input_size]
 
@@ -267,8 +416,12 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   concurrency::ThreadPool* thread_pool = context.GetOperatorThreadPool();
 
   const Tensor& X = *context.Input<Tensor>(0);  // inputs. [seq_length, batch_size, input_size]
-  const Tensor& W = *context.Input<Tensor>(1);  // weights. [num_directions, 3*hidden_size, input_size]
-  const Tensor& R = *context.Input<Tensor>(2);  // recurrence weights. [num_directions, 3*hidden_size, hidden_size]
+
+  // the weight inputs are nullptr if they were pre-packed at session initialization
+  const Tensor* W = packed_W_.buffer_ ? nullptr : context.Input<Tensor>(1);
+  // weights. [num_directions, 3*hidden_size, input_size]
+  const Tensor* R = packed_R_ZR_.buffer_ ? nullptr : context.Input<Tensor>(2);
+  // recurrence weights. [num_directions, 3*hidden_size, hidden_size]
 
   // optional
   const auto* B = context.Input<Tensor>(3);              // bias. [num_directions, 6*hidden_size]
@@ -281,7 +434,10 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   int batch_size = gsl::narrow<int>(X_shape[1]);
   int input_size = gsl::narrow<int>(X_shape[2]);
 
-  auto status = ValidateCommonRnnInputs(X, W.Shape(), R.Shape(), B, 3, sequence_lens, initial_h, num_directions_, hidden_size_);
+  const auto& W_shape = (W != nullptr) ? W->Shape() : packed_W_.shape_;
+  const auto& R_shape = (R != nullptr) ? R->Shape() : packed_R_ZR_.shape_;
+
+  auto status = ValidateCommonRnnInputs(X, W_shape, R_shape, B, 3, sequence_lens, initial_h, num_directions_, hidden_size_);
   ORT_RETURN_IF_ERROR(status);
 
   // GRU outputs are optional but must be in the same order
@@ -304,17 +460,24 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   AllocatorPtr alloc;
   status = context.GetTempSpaceAllocator(&alloc);
   ORT_RETURN_IF_ERROR(status);
-  gsl::span<const T> input_weights = W.DataAsSpan<T>();
-  gsl::span<const T> recurrent_weights = R.DataAsSpan<T>();
+  const auto* input_weights_data = (W != nullptr) ? W->Data<T>() : nullptr;
+  const auto* recurrent_weights_data = (R != nullptr) ? R->Data<T>() : nullptr;
   gsl::span<const T> bias = B != nullptr ? B->DataAsSpan<T>() : gsl::span<const T>();
 
-  // spans for first direction
+  // per direction strides into the original weight tensors. the recurrence weights are consumed
+  // as the combined ZR block and the H block (see TryPackRecurrentWeights), so GemmWeights for
+  // the H block starts 2*hidden_size_*hidden_size_ elements in.
   const size_t input_weights_size_per_direction = 3 * hidden_size_ * input_size;
   const size_t recurrent_weights_size_per_direction = 3 * hidden_size_ * hidden_size_;
   const size_t bias_size_per_direction = 6 * hidden_size_;
 
-  gsl::span<const T> input_weights_1 = input_weights.subspan(0, input_weights_size_per_direction);
-  gsl::span<const T> recurrent_weights_1 = recurrent_weights.subspan(0, recurrent_weights_size_per_direction);
+  const auto* recurrent_weights_H_data =
+      (recurrent_weights_data != nullptr) ? recurrent_weights_data + 2 * hidden_size_ * hidden_size_ : nullptr;
+
+  GemmWeights<T> W_1(0, input_weights_data, input_weights_size_per_direction, packed_W_);
+  GemmWeights<T> R_ZR_1(0, recurrent_weights_data, recurrent_weights_size_per_direction, packed_R_ZR_);
+  GemmWeights<T> R_H_1(0, recurrent_weights_H_data, recurrent_weights_size_per_direction, packed_R_H_);
+
   gsl::span<const T> bias_1 = bias.empty() ? bias : bias.subspan(0, bias_size_per_direction);
 
   gsl::span<const T> input = X.DataAsSpan<T>();
@@ -348,11 +511,11 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   gsl::span<T> hidden_output_1 = hidden_output.subspan(0, hidden_output_size_per_direction);
 
   if (direction_ == Direction::kBidirectional) {
-    // spans for second direction
-    gsl::span<const T> input_weights_2 = input_weights.subspan(input_weights_size_per_direction,
-                                                               input_weights_size_per_direction);
-    gsl::span<const T> recurrent_weights_2 = recurrent_weights.subspan(recurrent_weights_size_per_direction,
-                                                                       recurrent_weights_size_per_direction);
+    // weights and spans for second direction
+    GemmWeights<T> W_2(1, input_weights_data, input_weights_size_per_direction, packed_W_);
+    GemmWeights<T> R_ZR_2(1, recurrent_weights_data, recurrent_weights_size_per_direction, packed_R_ZR_);
+    GemmWeights<T> R_H_2(1, recurrent_weights_H_data, recurrent_weights_size_per_direction, packed_R_H_);
+
     gsl::span<const T> bias_2 = bias.empty() ? bias : bias.subspan(bias_size_per_direction, bias_size_per_direction);
 
     gsl::span<const T> initial_hidden_2 = initial_hidden.empty()
@@ -371,7 +534,7 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
                                     activation_funcs_.Entries()[0],
                                     activation_funcs_.Entries()[1],
                                     clip_, thread_pool);
-    fw.Compute(input, sequence_lens_span, num_directions_, input_weights_1, recurrent_weights_1,
+    fw.Compute(input, sequence_lens_span, num_directions_, W_1, R_ZR_1, R_H_1,
                output_1, hidden_output_1);
 
     detail::UniDirectionalGru<T> bw(alloc, seq_length, batch_size, input_size, hidden_size_,
@@ -379,7 +542,7 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
                                     activation_funcs_.Entries()[2],
                                     activation_funcs_.Entries()[3],
                                     clip_, thread_pool);
-    bw.Compute(input, sequence_lens_span, num_directions_, input_weights_2, recurrent_weights_2,
+    bw.Compute(input, sequence_lens_span, num_directions_, W_2, R_ZR_2, R_H_2,
                output_2, hidden_output_2);
   } else {
     detail::UniDirectionalGru<T> gru_p(alloc, seq_length, batch_size, input_size, hidden_size_,
@@ -387,7 +550,7 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
                                        activation_funcs_.Entries()[0],
                                        activation_funcs_.Entries()[1],
                                        clip_, thread_pool);
-    gru_p.Compute(input, sequence_lens_span, num_directions_, input_weights_1, recurrent_weights_1,
+    gru_p.Compute(input, sequence_lens_span, num_directions_, W_1, R_ZR_1, R_H_1,
                   output_1, hidden_output_1);
   }
 
@@ -487,8 +650,9 @@ template <typename T>
 void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
                                    const gsl::span<const int>& sequence_lengths_arg,
                                    const int num_directions,
-                                   const gsl::span<const T>& input_weights,
-                                   const gsl::span<const T>& recurrent_weights,
+                                   const GemmWeights<T>& input_weights,
+                                   const GemmWeights<T>& recurrent_weights_ZR,
+                                   const GemmWeights<T>& recurrent_weights_H,
                                    gsl::span<T>& outputs,
                                    gsl::span<T>& final_hidden_state) {
   using span_T_const_iter = typename gsl::span<T>::const_iterator;
@@ -505,11 +669,6 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
   }
 
   DumpMatrix("Inputs", inputs.data(), seq_length_ * batch_size_, input_size_);
-  DumpMatrix("input_weights", input_weights.data(), 3 * hidden_size_, input_size_);
-  DumpMatrix("recurrent_weights", recurrent_weights.data(), 3 * hidden_size_, hidden_size_);
-
-  gsl::span<const T> recurrent_weightsZR = recurrent_weights.subspan(0, 2 * hidden_size_ * hidden_size_);
-  gsl::span<const T> recurrent_weightsH = recurrent_weights.subspan(2 * hidden_size_ * hidden_size_, hidden_size_ * hidden_size_);
 
   gsl::span<T> original_outputs = outputs;
   const bool output_sequence = !outputs.empty();
@@ -538,12 +697,10 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
 
   // apply weights to all the inputs
   ComputeGemm(total_rows, hidden_size_x3, input_size_, alpha,
-              inputs.cbegin(), inputs.cend(),
-              input_size_,
-              input_weights.cbegin(), input_weights.cend(),
-              input_size_, 0.f,
-              outputZRH_.begin(), outputZRH_.end(),
-              hidden_size_x3, ttp_);
+              inputs.data(), inputs.data() + inputs.size(),
+              input_weights, 0.f,
+              outputZRH_.data(), outputZRH_.data() + outputZRH_.size(),
+              hidden_size_x3, nullptr, nullptr, ttp_);
 
   DumpMatrix("inputs with weights applied", outputZRH_.data(), seq_length_ * batch_size_ * 3, hidden_size_);
 
@@ -605,15 +762,16 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
 
       out_added_offset = (step * batch_size_) * hidden_size_x3;
 
+      const T* prev_Ht_data = SafeRawConstPointer<T>(prev_Ht, prev_Ht_end, batch_size_ * hidden_size_);
+
       // calculate Ht-1*R[zr], and add to the weighted inputs that are in outputZRH_
       // Ht-1 * R[zr] + Xt*(W[zr]^T)
       ComputeGemm(batch_size_, hidden_size_x2, hidden_size_, alpha,
-                  prev_Ht, prev_Ht_end,
-                  hidden_size_,
-                  recurrent_weightsZR.cbegin(), recurrent_weightsZR.cend(),
-                  hidden_size_, 1.f,  // beta == 1 so we add existing values in outputZRH_
-                  outputZRH_.begin() + out_added_offset, outputZRH_.end(),
-                  hidden_size_x3, ttp_);
+                  prev_Ht_data, prev_Ht_data + batch_size_ * hidden_size_,
+                  recurrent_weights_ZR,
+                  1.f,  // beta == 1 so we add existing values in outputZRH_
+                  outputZRH_.data() + out_added_offset, outputZRH_.data() + outputZRH_.size(),
+                  hidden_size_x3, nullptr, nullptr, ttp_);
 
       DumpMatrix("Ht-1 * R[zr] + Xt*(W[zr]^T)" + seqno_str,
                  outputZRH_.data() + out_added_offset, batch_size_, hidden_size_x2, 0, hidden_size_x3);
@@ -628,14 +786,12 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
 
         // compute Ht-1 * (Rh^T) + Rbh
         ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
-                    prev_Ht, prev_Ht_end,  // Ht-1
-                    hidden_size_,
-                    recurrent_weightsH.cbegin(), recurrent_weightsH.cend(),  // Rh^T
-                    hidden_size_,
+                    prev_Ht_data, prev_Ht_data + batch_size_ * hidden_size_,  // Ht-1
+                    recurrent_weights_H,                                      // Rh^T
                     use_bias_ ? 1.f : 0.f,  // don't add values in linear_output_ if no bias input
-                    linear_output_.begin(),
-                    linear_output_.end(),  // pre: Rbh if use_bias_, post:output
-                    hidden_size_, ttp_);
+                    linear_output_.data(),
+                    linear_output_.data() + linear_output_.size(),  // pre: Rbh if use_bias_, post:output
+                    hidden_size_, nullptr, nullptr, ttp_);
 
         DumpMatrix("Ht-1 * (Rh^T) + Rbh " + seqno_str, linear_output_.data(), batch_size_, hidden_size_);
       }
@@ -696,17 +852,17 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
         label += " * Rh^T";
 #endif
 
-        // out_H currently contains Xt*(Wh^T).
-        auto out_H = outputZRH_.begin() + out_added_offset + hidden_size_x2;
+        const T* cur_h_data = SafeRawPointer<T>(cur_h_local, cur_h_local_end, batch_size_ * hidden_size_);
 
+        // outputZRH_ + out_added_offset + hidden_size_x2 currently contains Xt*(Wh^T).
         // Calculate Xt*(Wh^T) + rt (.) Ht-1 * Rh
         ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
-                    cur_h_local, cur_h_local_end,  // rt (.) Ht-1
-                    hidden_size_,
-                    recurrent_weightsH.cbegin(), recurrent_weightsH.cend(),  // Rh^T
-                    hidden_size_, 1.f,                                       // beta == 1 to add Xt*(Wh^T) from out_H
-                    out_H, outputZRH_.end(),
-                    hidden_size_x3, ttp_);
+                    cur_h_data, cur_h_data + batch_size_ * hidden_size_,  // rt (.) Ht-1
+                    recurrent_weights_H,                                  // Rh^T
+                    1.f,                                                  // beta == 1 to add Xt*(Wh^T)
+                    outputZRH_.data() + out_added_offset + hidden_size_x2,
+                    outputZRH_.data() + outputZRH_.size(),
+                    hidden_size_x3, nullptr, nullptr, ttp_);
       }
 
       DumpMatrix("Xt*(Wh^T) + (" + label + ")" + seqno_str, outputZRH_.data() + out_added_offset,
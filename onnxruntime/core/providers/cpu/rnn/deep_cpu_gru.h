@@ -55,11 +55,27 @@ class DeepCpuGruOp final : public OpKernel {
         "Batchwise recurrent operations (layout == 1) are not supported. If you need support create a github issue with justification.");
   }
 
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 /*out*/ bool& is_packed,
+                 /*out*/ PrePackedWeights* prepacked_weights) override;
+
+  Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                   int input_idx,
+                                   /*out*/ bool& used_shared_buffers) override;
+
   Status Compute(OpKernelContext* context) const override;
 
   ~DeepCpuGruOp() override = default;
 
  private:
+  Status TryPackInputWeights(const Tensor& weights, AllocatorPtr& alloc,
+                             /*out*/ bool& is_packed,
+                             /*out*/ PrePackedWeights* prepacked_weights);
+
+  Status TryPackRecurrentWeights(const Tensor& weights, AllocatorPtr& alloc,
+                                 /*out*/ bool& is_packed,
+                                 /*out*/ PrePackedWeights* prepacked_weights);
+
   rnn::detail::Direction direction_;
   int num_directions_;
 
@@ -72,6 +88,13 @@ class DeepCpuGruOp final : public OpKernel {
 
   template <typename T>
   Status ComputeImpl(OpKernelContext& context) const;
+
+  rnn::detail::PackedWeights packed_W_;
+
+  // the recurrence weights are used as two separate GEMM inputs (the combined Z and R gates,
+  // and the H gate) so they are packed as two blocks per direction
+  rnn::detail::PackedWeights packed_R_ZR_;
+  rnn::detail::PackedWeights packed_R_H_;
 };
 
 }  // namespace onnxruntime
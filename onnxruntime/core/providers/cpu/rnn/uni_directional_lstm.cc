@@ -3,6 +3,7 @@
 
 #include "uni_directional_lstm.h"
 
+#include "core/mlas/inc/mlas.h"
 #include "core/platform/threadpool.h"
 
 namespace onnxruntime {
@@ -69,6 +70,12 @@ UniDirectionalLstm<T>::UniDirectionalLstm(
 
   clip_with_bias_ptr_ = use_bias_ ? deepcpu::clip_add_bias : deepcpu::clip_ignore_bias;
 
+  // with the default sigmoid/tanh activations and no cross-gate coupling from peepholes or
+  // input_forget, the bias/clip pass and activations can be applied over whole gate spans
+  fused_gate_activations_ = activation_f_.func == deepcpu::sigmoid &&
+                            activation_g_.func == deepcpu::tanh &&
+                            !use_peepholes_ && !input_forget_;
+
   SetNumThreads();
   AllocateBuffers();
   InitializeBuffers(initial_hidden_state, initial_cell_state);
@@ -95,10 +102,13 @@ void UniDirectionalLstm<T>::AllocateBuffers() {
   output_iofc_ = Allocate(allocator_, hidden_size_ * 4 * batch_size_ * seq_length_, output_iofc_ptr_);
 
   if (use_bias_) {
-    bias_WRi_ = Allocate(allocator_, hidden_size_, bias_WRi_ptr_);
-    bias_WRf_ = Allocate(allocator_, hidden_size_, bias_WRf_ptr_);
-    bias_WRo_ = Allocate(allocator_, hidden_size_, bias_WRo_ptr_);
-    bias_WRc_ = Allocate(allocator_, hidden_size_, bias_WRc_ptr_);
+    // one contiguous allocation in the IOFC gate order so a fused pass can add all four
+    // gate biases to a row of gate outputs in a single call
+    bias_WRiofc_ = Allocate(allocator_, hidden_size_ * 4, bias_WRiofc_ptr_);
+    bias_WRi_ = bias_WRiofc_.subspan(0, hidden_size_);
+    bias_WRo_ = bias_WRiofc_.subspan(hidden_size_, hidden_size_);
+    bias_WRf_ = bias_WRiofc_.subspan(2 * hidden_size_, hidden_size_);
+    bias_WRc_ = bias_WRiofc_.subspan(3 * hidden_size_, hidden_size_);
   }
 
   if (direction_ == kReverse) {
@@ -461,6 +471,28 @@ void UniDirectionalLstm<T>::GateComputations(
 
     // DumpMatrix("C_prev" + row_str, pCprev_hidden_size, 1, hidden_size_);
 
+    if (fused_gate_activations_) {
+      // the i/o/f gates are adjacent in the IOFC row layout and all use the sigmoid
+      // activation, so add the biases, clip, and run the activations over whole gate
+      // spans instead of gate by gate. this produces the same values as the generic
+      // path below but amortizes the per-call overhead and keeps the MLAS kernels
+      // running over longer vectors.
+      const float* pB = use_bias_ ? SafeRawConstPointer<T>(bias_WRiofc_, 0, hidden_size_x4) : nullptr;
+      clip_with_bias_ptr_(clip_, pB, pi, hidden_size_x4);
+      MlasComputeLogistic(pi, pi, 3 * hidden_size_);
+      MlasComputeTanh(pc, pc, hidden_size_);
+
+      float* pC_cur = pCprev_hidden_size;
+      deepcpu::merge_lstm_gates_to_memory(pCprev_hidden_size, pi, pf, pc, pC_cur, hidden_size_);
+
+      float* pH =
+          SafeRawPointer<T>(batched_output + row * hidden_size_ + b * hidden_size_, batched_output_end, hidden_size_);
+      float* pC_prev_clipped = SafeRawPointer<T>(C_prev_clipped + b * hidden_size_, C_prev_clipped_end, hidden_size_);
+      activation_h_.func(pC_cur, pC_prev_clipped, po, pH, hidden_size_, activation_h_.alpha, activation_h_.beta);
+
+      continue;
+    }
+
     // Input Gate
     if (use_peepholes_) {
       deepcpu::elementwise_product(pCprev_hidden_size, SafeRawConstPointer<const T>(peephole_i_, 0, hidden_size_), pi,
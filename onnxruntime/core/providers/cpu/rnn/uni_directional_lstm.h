@@ -75,6 +75,10 @@ class UniDirectionalLstm {
   bool use_bias_;
   bool use_peepholes_;
 
+  // true when the default sigmoid/tanh gate activations are used without peepholes or
+  // input_forget coupling, allowing the activations to be applied across whole gate spans
+  bool fused_gate_activations_;
+
   int num_threads_ = -1;
 
   IAllocatorUniquePtr<T> output_iofc_ptr_;
@@ -87,9 +91,11 @@ class UniDirectionalLstm {
   gsl::span<T> internal_memory_prev_, batched_internal_memory_prev_;
   gsl::span<T> batched_internal_memory_clipped_;
 
-  IAllocatorUniquePtr<T> bias_WRi_ptr_, bias_WRf_ptr_, bias_WRo_ptr_, bias_WRc_ptr_;
+  IAllocatorUniquePtr<T> bias_WRiofc_ptr_;
   IAllocatorUniquePtr<T> peephole_i_ptr_, peephole_f_ptr_, peephole_o_ptr_;
   IAllocatorUniquePtr<T> inputs_reverse_ptr_, outputs_reverse_ptr_;
+  // single allocation covering all four gate biases in IOFC order, with per-gate views into it
+  gsl::span<T> bias_WRiofc_;
   gsl::span<T> bias_WRi_, bias_WRf_, bias_WRo_, bias_WRc_;
   gsl::span<T> inputs_reverse_, outputs_reverse_;
 
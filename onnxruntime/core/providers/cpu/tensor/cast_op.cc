@@ -15,6 +15,7 @@
 #include "core/framework/data_types.h"
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/cpu/tensor/utils.h"
 #include "core/providers/op_kernel_type_control.h"
 #include "core/util/math_cpuonly.h"
@@ -112,7 +113,22 @@ CastToString(const SrcType& input, std::string& output) {
 template <typename SrcType>
 typename std::enable_if<std::is_integral<SrcType>::value, void>::type
 CastToString(const SrcType& input, std::string& output) {
-  output = std::to_string(input);
+  // format into a stack buffer and assign rather than going through std::to_string -
+  // assignment re-uses the output string's existing capacity, while std::to_string
+  // materializes a temporary (heap-allocated for values beyond the small-string
+  // optimization) for every element
+  char buffer[32];  // large enough for any 64-bit integer, sign and terminator
+
+  int snprintf_result;
+  if (std::is_signed<SrcType>::value) {
+    snprintf_result = std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(input));
+  } else {
+    snprintf_result = std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(input));
+  }
+
+  ORT_ENFORCE(snprintf_result > 0, "snprintf() failed with return value: ", snprintf_result);
+
+  output.assign(buffer, static_cast<size_t>(snprintf_result));
 }
 
 template <typename SrcType>
@@ -190,13 +206,22 @@ struct TensorCaster {
 // tensor X -> string
 template <typename SrcType>
 struct TensorCaster<SrcType, std::string> {
-  void Cast(const OpKernelContext&, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
     const std::ptrdiff_t shape_size = gsl::narrow<std::ptrdiff_t>(shape.Size());
     const auto* in_data = in.Data<SrcType>();
     auto* out_data = out.MutableData<std::string>();
-    for (std::ptrdiff_t i = 0; i < shape_size; ++i) {
-      CastToString(in_data[i], out_data[i]);
-    }
+    // each element formats independently and feature pipelines push tensors with millions of
+    // elements through this path, so split the conversion across the operator's thread pool.
+    // the string -> X direction is deliberately not parallelized: it parses via the std::sto*
+    // family whose exceptions on malformed input must reach the caller
+    concurrency::ThreadPool::TryParallelFor(
+        context.GetOperatorThreadPool(), shape_size,
+        50.0,  // rough cost of formatting one element, in "cycles per element"
+        [in_data, out_data](std::ptrdiff_t first, std::ptrdiff_t last) {
+          for (std::ptrdiff_t i = first; i < last; ++i) {
+            CastToString(in_data[i], out_data[i]);
+          }
+        });
   }
 };
 
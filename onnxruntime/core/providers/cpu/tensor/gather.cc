@@ -4,6 +4,7 @@
 //https://github.com/onnx/onnx/blob/master/docs/Operators.md#Gather
 #include "core/providers/cpu/tensor/gather.h"
 #include "core/common/common.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/platform/threadpool.h"
 #include "core/providers/op_kernel_type_control.h"
 #include "core/providers/op_kernel_type_control_utils.h"
@@ -93,6 +94,19 @@ Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uin
     }
   }
 
+  if (!is_string_type) {
+    // Copy the rows with the MLAS gather primitive, which batches the
+    // indices, prefetches the source rows and partitions the work across
+    // the thread pool.
+    for (int64_t batch = 0; batch < M; ++batch) {
+      MlasGather(src_base + batch * data_batch_bytes, indices_data,
+                 dst_base + batch * gathered_batch_bytes,
+                 static_cast<size_t>(N), static_cast<size_t>(axis_dim_limit),
+                 static_cast<size_t>(block_size), tp);
+    }
+    return Status::OK();
+  }
+
   auto lambda = [&](int64_t index) {
     int64_t batch = index / N;
     int64_t i = index % N;
@@ -65,6 +65,31 @@ REGISTER_DEQUANTIZELINEAR_VERSIONED(int8_t)
 REGISTER_DEQUANTIZELINEAR_VERSIONED(uint8_t)
 REGISTER_DEQUANTIZELINEAR_VERSIONED(int32_t)
 
+// Dequantize a per-channel block with the vectorized MLAS kernel, partitioned over the thread pool.
+static void DequantizeLinearBlock(const int8_t* input, float* output, size_t block_size, float scale,
+                                  int8_t zero_point, concurrency::ThreadPool* thread_pool) {
+  ParDequantizeLinear(input, output, block_size, scale, zero_point, thread_pool);
+}
+
+static void DequantizeLinearBlock(const uint8_t* input, float* output, size_t block_size, float scale,
+                                  uint8_t zero_point, concurrency::ThreadPool* thread_pool) {
+  ParDequantizeLinear(input, output, block_size, scale, zero_point, thread_pool);
+}
+
+// int32 inputs are raw accumulators with a zero point validated to be zero, so the conversion is a
+// plain scale multiply.
+static void DequantizeLinearBlock(const int32_t* input, float* output, size_t block_size, float scale,
+                                  int32_t /*zero_point*/, concurrency::ThreadPool* thread_pool) {
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(block_size),
+      {sizeof(int32_t), sizeof(float), 1.0},
+      [input, output, scale](std::ptrdiff_t begin, std::ptrdiff_t end) {
+        for (std::ptrdiff_t i = begin; i < end; ++i) {
+          output[i] = static_cast<float>(input[i]) * scale;
+        }
+      });
+}
+
 // formula is Y = (X - ZeroPoint) * Scale
 template <typename T>
 Status DequantizeLinear<T>::Compute(OpKernelContext* ctx) const {
@@ -96,12 +121,11 @@ Status DequantizeLinear<T>::Compute(OpKernelContext* ctx) const {
 
   for (size_t n = 0; n < static_cast<size_t>(N); n++) {
     for (size_t bd = 0; bd < static_cast<size_t>(broadcast_dim); bd++) {
-      auto zp = zero_point ? static_cast<int32_t>(zero_point[bd]) : 0;
-      auto sc = scale[bd];
-
-      for (size_t bs = 0; bs < static_cast<size_t>(block_size); bs++) {
-        *output++ = static_cast<float>(static_cast<int32_t>(*input++) - zp) * sc;
-      }
+      T zp = zero_point ? zero_point[bd] : T(0);
+      DequantizeLinearBlock(input, output, static_cast<size_t>(block_size), scale[bd], zp,
+                            ctx->GetOperatorThreadPool());
+      input += block_size;
+      output += block_size;
     }
   }
 
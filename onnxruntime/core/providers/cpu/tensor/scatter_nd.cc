@@ -113,14 +113,29 @@ Status ScatterNDBase::PrepareForCompute(OpKernelContext* context, Prepare& p) co
   auto last_indice_dimension = indice_shape[indice_shape.NumDimensions() - 1];
 
   // Re-use input for output. If input/output Tensor* are the same, do not copy.
+  // The copy dominates when only a few elements are scattered, so it is split across the
+  // thread pool in element blocks.
   if (src_base != dst_base) {
+    concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+    const auto input_size = static_cast<std::ptrdiff_t>(input_shape.Size());
+
     if (is_string_type) {
       const auto* str_begin = input_tensor->template Data<std::string>();
-      const std::string* str_end = str_begin + input_shape.Size();
       auto* dst = output_tensor->template MutableData<std::string>();
-      std::copy(str_begin, str_end, dst);
+      concurrency::ThreadPool::TryParallelFor(
+          tp, input_size, 2.0 /* cost of copying a string */,
+          [str_begin, dst](ptrdiff_t first, ptrdiff_t last) {
+            std::copy(str_begin + first, str_begin + last, dst + first);
+          });
     } else {
-      memcpy(dst_base, src_base, input_tensor->SizeInBytes());
+      const size_t element_bytes = input_tensor->DataType()->Size();
+      concurrency::ThreadPool::TryParallelFor(
+          tp, input_size, static_cast<double>(element_bytes),
+          [src_base, dst_base, element_bytes](ptrdiff_t first, ptrdiff_t last) {
+            memcpy(static_cast<uint8_t*>(dst_base) + first * element_bytes,
+                   static_cast<const uint8_t*>(src_base) + first * element_bytes,
+                   (last - first) * element_bytes);
+          });
     }
   }
 
@@ -5,12 +5,15 @@
 
 #include "gsl/gsl"
 
+#include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 #include "core/providers/op_kernel_type_control.h"
 #include "core/providers/op_kernel_type_control_utils.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
 
+#include <algorithm>
+
 namespace onnxruntime {
 
 namespace op_kernel_type_control {
@@ -179,6 +182,46 @@ Status Split::ComputeImpl(OpKernelContext& context, const Tensor& input) const {
   int64_t input_offset = 0;
   const T* input_data = input.template Data<T>();
 
+  // When splitting along the outermost effective axis (everything before the
+  // split axis has size 1), each output is a single contiguous span of the
+  // input. Dispatch the copies for all outputs as one parallel loop instead
+  // of a serial copy per output.
+  if constexpr (!std::is_same_v<T, std::string>) {
+    if (before_dims == 1) {
+      std::vector<T*> output_ptrs(num_outputs);
+      std::vector<int64_t> output_end_offsets(num_outputs);
+      int64_t total_elements = 0;
+
+      for (int i = 0; i < num_outputs; ++i) {
+        output_dimensions[axis] = gsl::narrow<int>(split_sizes[i]);
+        Tensor* output = context.Output(i, TensorShape{output_dimensions});
+        output_ptrs[i] = output->template MutableData<T>();
+        total_elements += split_sizes[i] * after_dims_excluding_split;
+        output_end_offsets[i] = total_elements;
+      }
+
+      concurrency::ThreadPool::TryParallelFor(
+          context.GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(total_elements),
+          {static_cast<float>(sizeof(T)), static_cast<float>(sizeof(T)), 1.0F},
+          [&output_ptrs, &output_end_offsets, input_data](std::ptrdiff_t first, std::ptrdiff_t last) {
+            size_t output_index = static_cast<size_t>(
+                std::upper_bound(output_end_offsets.begin(), output_end_offsets.end(), first) -
+                output_end_offsets.begin());
+
+            while (first < last) {
+              const int64_t output_begin = (output_index > 0) ? output_end_offsets[output_index - 1] : 0;
+              const int64_t copy_end = std::min<int64_t>(last, output_end_offsets[output_index]);
+              copy_data<T>(input_data + first, output_ptrs[output_index] + (first - output_begin),
+                           static_cast<size_t>(copy_end - first));
+              first = copy_end;
+              ++output_index;
+            }
+          });
+
+      return Status::OK();
+    }
+  }
+
   for (int i = 0; i < num_outputs; ++i) {
     // update size of dimension for axis we're splitting on
     auto split_size = gsl::narrow<int>(split_sizes[i]);
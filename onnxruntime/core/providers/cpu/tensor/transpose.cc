@@ -346,9 +346,15 @@ struct has_mlas_transpose : std::false_type {};
 template <>
 struct has_mlas_transpose<uint8_t> : std::true_type {};
 
+template <>
+struct has_mlas_transpose<uint16_t> : std::true_type {};
+
 template <>
 struct has_mlas_transpose<uint32_t> : std::true_type {};
 
+template <>
+struct has_mlas_transpose<uint64_t> : std::true_type {};
+
 // moving a single axis outwards where the read/write size is a power of 2 and between 8 and 64 bits.
 template <typename T>
 typename std::enable_if<!has_mlas_transpose<T>::value, void>::type
@@ -541,38 +541,69 @@ void UpsampleBilinear(int64_t batch_size,
                                            height_scale, width_scale, roi,
                                            alloc, get_original_coordinate);
 
-  for (int64_t n = 0; n < batch_size; ++n) {
-    concurrency::ThreadPool::TrySimpleParallelFor(
-        tp, num_channels,
-        [&](std::ptrdiff_t c) {
-          const T* Xdata = XdataBase + (n * num_channels + c) * (input_height * input_width);
-          T* Ydata = YdataBase + (n * num_channels + c) * (output_height * output_width);
-          for (int64_t y = 0; y < output_height; ++y) {
-            for (int64_t x = 0; x < output_width; ++x) {
-              // when use_extrapolation is set and original index of x or y is out of the dim range
-              // then use extrapolation_value as the output value.
-              if (use_extrapolation &&
-                  ((p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1)) ||
-                   (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)))) {
-                Ydata[output_width * y + x] = static_cast<T>(extrapolation_value);
-                continue;
-              }
+  // Partition the work with one output row as the unit, flattened across all
+  // batches and channels, so that images with few channels still spread
+  // across the thread pool. All row-invariant values are hoisted out of the
+  // inner loop.
+  const int64_t total_rows = batch_size * num_channels * output_height;
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(total_rows),
+      {static_cast<float>(sizeof(T) * output_width * 2),
+       static_cast<float>(sizeof(T) * output_width),
+       static_cast<double>(output_width) * 7.0},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          const int64_t y = row % output_height;
+          const int64_t nc = row / output_height;
+
+          const T* Xdata = XdataBase + nc * (input_height * input_width);
+          T* Ydata = YdataBase + nc * (output_height * output_width) + output_width * y;
+
+          // when use_extrapolation is set and original index of x or y is out of the dim range
+          // then use extrapolation_value as the output value.
+          if (use_extrapolation &&
+              (p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1))) {
+            std::fill_n(Ydata, output_width, static_cast<T>(extrapolation_value));
+            continue;
+          }
 
-              T X11 = Xdata[p.input_width_mul_y1[y] + p.in_x1[x]];
-              T X21 = Xdata[p.input_width_mul_y1[y] + p.in_x2[x]];
-              T X12 = Xdata[p.input_width_mul_y2[y] + p.in_x1[x]];
-              T X22 = Xdata[p.input_width_mul_y2[y] + p.in_x2[x]];
+          const float dy1_value = p.dy1[y];
+          const float dy2_value = p.dy2[y];
+          const T* Xrow1 = Xdata + p.input_width_mul_y1[y];
+          const T* Xrow2 = Xdata + p.input_width_mul_y2[y];
 
-              Ydata[output_width * y + x] = static_cast<T>(p.dx2[x] * p.dy2[y] * X11 +
-                                                           p.dx1[x] * p.dy2[y] * X21 +
-                                                           p.dx2[x] * p.dy1[y] * X12 +
-                                                           p.dx1[x] * p.dy1[y] * X22);
+          int64_t x = 0;
+
+          if (width_scale == 1 && !use_extrapolation) {
+            // Width is unchanged, so the row is a weighted blend of the two
+            // contiguous input rows that the compiler can vectorize. The last
+            // column duplicates its right neighbor and is left to the general
+            // loop below to keep the results bitwise identical.
+            for (; x < output_width - 1; ++x) {
+              Ydata[x] = static_cast<T>(dy2_value * Xrow1[x] + dy1_value * Xrow2[x]);
             }
           }
-          Xdata += input_height * input_width;
-          Ydata += output_width * output_height;
-        });
-  }
+
+          for (; x < output_width; ++x) {
+            if (use_extrapolation &&
+                (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1))) {
+              Ydata[x] = static_cast<T>(extrapolation_value);
+              continue;
+            }
+
+            T X11 = Xrow1[p.in_x1[x]];
+            T X21 = Xrow1[p.in_x2[x]];
+            T X12 = Xrow2[p.in_x1[x]];
+            T X22 = Xrow2[p.in_x2[x]];
+
+            Ydata[x] = static_cast<T>(p.dx2[x] * dy2_value * X11 +
+                                      p.dx1[x] * dy2_value * X21 +
+                                      p.dx2[x] * dy1_value * X12 +
+                                      p.dx1[x] * dy1_value * X22);
+          }
+        }
+      });
 }
 
 struct TrilinearParams {
@@ -765,54 +796,52 @@ void UpsampleTrilinear(int64_t batch_size,
                                              depth_scale, height_scale, width_scale, roi,
                                              alloc, get_original_coordinate);
 
-  for (int64_t n = 0; n < batch_size; ++n) {
-    concurrency::ThreadPool::TrySimpleParallelFor(
-        tp, num_channels,
-        [&](std::ptrdiff_t c) {
-          const T* Xdata = XdataBase + (n * num_channels + c) * (input_depth * input_height * input_width);
-          T* Ydata = YdataBase + (n * num_channels + c) * (output_depth * output_height * output_width);
-          for (int64_t z = 0; z < output_depth; ++z) {
-            for (int64_t y = 0; y < output_height; ++y) {
-              for (int64_t x = 0; x < output_width; ++x) {
-                // when use_extrapolation is set and original index of x or y is out of the dim range
-                // then use extrapolation_value as the output value.
-                if (use_extrapolation &&
-                    ((p.z_original[z] < 0 || p.z_original[z] > static_cast<float>(input_depth - 1)) ||
-                     (p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1)) ||
-                     (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)))) {
-                  Ydata[output_width * output_height * z + output_width * y + x] =
-                      static_cast<T>(extrapolation_value);
-                  continue;
-                }
-
-                // subscript ordering in the variable - (xyz)
-                T X111 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y1[y] + p.in_x1[x]];
-                T X211 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y1[y] + p.in_x2[x]];
-                T X121 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y2[y] + p.in_x1[x]];
-                T X221 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y2[y] + p.in_x2[x]];
-
-                T X112 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y1[y] + p.in_x1[x]];
-                T X212 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y1[y] + p.in_x2[x]];
-                T X122 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y2[y] + p.in_x1[x]];
-                T X222 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y2[y] + p.in_x2[x]];
-
+  // Flatten the batch and channel dimensions into a single parallel loop so
+  // that inputs with few channels still spread across the thread pool.
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, batch_size * num_channels,
+      [&](std::ptrdiff_t nc) {
+        const T* Xdata = XdataBase + nc * (input_depth * input_height * input_width);
+        T* Ydata = YdataBase + nc * (output_depth * output_height * output_width);
+        for (int64_t z = 0; z < output_depth; ++z) {
+          for (int64_t y = 0; y < output_height; ++y) {
+            for (int64_t x = 0; x < output_width; ++x) {
+              // when use_extrapolation is set and original index of x or y is out of the dim range
+              // then use extrapolation_value as the output value.
+              if (use_extrapolation &&
+                  ((p.z_original[z] < 0 || p.z_original[z] > static_cast<float>(input_depth - 1)) ||
+                   (p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1)) ||
+                   (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)))) {
                 Ydata[output_width * output_height * z + output_width * y + x] =
-                    static_cast<T>(p.dx2[x] * p.dy2[y] * p.dz2[z] * X111 +
-                                   p.dx1[x] * p.dy2[y] * p.dz2[z] * X211 +
-                                   p.dx2[x] * p.dy1[y] * p.dz2[z] * X121 +
-                                   p.dx1[x] * p.dy1[y] * p.dz2[z] * X221 +
-
-                                   p.dx2[x] * p.dy2[y] * p.dz1[z] * X112 +
-                                   p.dx1[x] * p.dy2[y] * p.dz1[z] * X212 +
-                                   p.dx2[x] * p.dy1[y] * p.dz1[z] * X122 +
-                                   p.dx1[x] * p.dy1[y] * p.dz1[z] * X222);
+                    static_cast<T>(extrapolation_value);
+                continue;
               }
+
+              // subscript ordering in the variable - (xyz)
+              T X111 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y1[y] + p.in_x1[x]];
+              T X211 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y1[y] + p.in_x2[x]];
+              T X121 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y2[y] + p.in_x1[x]];
+              T X221 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y2[y] + p.in_x2[x]];
+
+              T X112 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y1[y] + p.in_x1[x]];
+              T X212 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y1[y] + p.in_x2[x]];
+              T X122 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y2[y] + p.in_x1[x]];
+              T X222 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y2[y] + p.in_x2[x]];
+
+              Ydata[output_width * output_height * z + output_width * y + x] =
+                  static_cast<T>(p.dx2[x] * p.dy2[y] * p.dz2[z] * X111 +
+                                 p.dx1[x] * p.dy2[y] * p.dz2[z] * X211 +
+                                 p.dx2[x] * p.dy1[y] * p.dz2[z] * X121 +
+                                 p.dx1[x] * p.dy1[y] * p.dz2[z] * X221 +
+
+                                 p.dx2[x] * p.dy2[y] * p.dz1[z] * X112 +
+                                 p.dx1[x] * p.dy2[y] * p.dz1[z] * X212 +
+                                 p.dx2[x] * p.dy1[y] * p.dz1[z] * X122 +
+                                 p.dx1[x] * p.dy1[y] * p.dz1[z] * X222);
             }
           }
-          Xdata += input_depth * input_height * input_width;
-          Ydata += output_depth * output_width * output_height;
-        });
-  }
+        }
+      });
 }
 
 // Calculates cubic coeff based on Robert Keys approach
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <limits>
+
 #include "cuda_allocator.h"
 #include "cuda_common.h"
 #include "core/framework/allocatormgr.h"
@@ -63,6 +65,56 @@ void CUDAAllocator::Free(void* p) {
   cudaFree(p);         // do not throw error since it's OK for cudaFree to fail during shutdown
 }
 
+CUDAAsyncAllocator::CUDAAsyncAllocator(OrtDevice::DeviceId device_id, const char* name)
+    : CUDAAllocator(device_id, name) {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 11020
+  CUDA_CALL_THROW(cudaSetDevice(device_id));
+
+  int pools_supported = 0;
+  CUDA_CALL_THROW(cudaDeviceGetAttribute(&pools_supported, cudaDevAttrMemoryPoolsSupported, device_id));
+  ORT_ENFORCE(pools_supported != 0,
+              "enable_cuda_malloc_async requires a device and driver with stream ordered memory "
+              "allocator support (driver >= 11.2). Device ", device_id, " does not support it.");
+
+  // The default pool is per device, so every CUDAAsyncAllocator and session in the process
+  // draws from the same pool. By default the driver trims the pool back to zero at stream
+  // synchronization points; raising the release threshold keeps freed memory cached in the
+  // pool, which is the role the BFC arena plays for cudaMalloc.
+  cudaMemPool_t pool = nullptr;
+  CUDA_CALL_THROW(cudaDeviceGetDefaultMemPool(&pool, device_id));
+  uint64_t release_threshold = std::numeric_limits<uint64_t>::max();
+  CUDA_CALL_THROW(cudaMemPoolSetAttribute(pool, cudaMemPoolAttrReleaseThreshold, &release_threshold));
+#else
+  ORT_THROW("enable_cuda_malloc_async requires building with CUDA 11.2 or newer.");
+#endif
+}
+
+void* CUDAAsyncAllocator::Alloc(size_t size) {
+  void* p = nullptr;
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 11020
+  SetDevice(true);
+  CheckDevice(true);
+  if (size > 0) {
+    // ordered on the legacy default stream, which the compute and copy streams synchronize
+    // with, so the memory is usable on any of them once the allocation is enqueued
+    CUDA_CALL_THROW(cudaMallocAsync(&p, size, nullptr));
+  }
+#else
+  ORT_UNUSED_PARAMETER(size);
+#endif
+  return p;
+}
+
+void CUDAAsyncAllocator::Free(void* p) {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 11020
+  SetDevice(false);
+  CheckDevice(false);     // ignore CUDA failure when free
+  cudaFreeAsync(p, nullptr);  // do not throw error since it's OK for the free to fail during shutdown
+#else
+  ORT_UNUSED_PARAMETER(p);
+#endif
+}
+
 void* CUDAExternalAllocator::Alloc(size_t size) {
   void* p = nullptr;
   if (size > 0) {
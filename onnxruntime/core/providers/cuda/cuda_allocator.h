@@ -20,7 +20,7 @@ class CUDAAllocator : public IAllocator {
   void Free(void* p) override;
   FencePtr CreateFence(const SessionState* session_state) override;
 
- private:
+ protected:
   void CheckDevice(bool throw_when_fail) const;
   void SetDevice(bool throw_when_fail) const;
 };
@@ -50,6 +50,18 @@ class CUDAExternalAllocator : public CUDAAllocator {
   std::unordered_set<void*> reserved_;
 };
 
+// Stream ordered device allocator backed by cudaMallocAsync and the device's default memory
+// pool (requires CUDA >= 11.2). Unlike the BFC arena over cudaMalloc, pool growth does not
+// synchronize the device, and the pool is per device so it is shared by every session in the
+// process.
+class CUDAAsyncAllocator : public CUDAAllocator {
+ public:
+  CUDAAsyncAllocator(OrtDevice::DeviceId device_id, const char* name);
+
+  void* Alloc(size_t size) override;
+  void Free(void* p) override;
+};
+
 //TODO: add a default constructor
 class CUDAPinnedAllocator : public IAllocator {
  public:
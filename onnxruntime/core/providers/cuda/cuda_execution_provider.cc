@@ -8,6 +8,7 @@
 #include "core/providers/cuda/cuda_fence.h"
 #include "core/providers/cuda/cuda_fwd.h"
 #include "core/providers/cuda/gpu_data_transfer.h"
+#include "core/providers/cuda/tuning_results_cache.h"
 
 #ifndef DISABLE_CONTRIB_OPS
 #include "contrib_ops/cuda/cuda_contrib_kernels.h"
@@ -94,8 +95,20 @@ ONNX_OPERATOR_KERNEL_EX(
 }  // namespace cuda
 
 AllocatorPtr CUDAExecutionProvider::CreateCudaAllocator(OrtDevice::DeviceId device_id, size_t gpu_mem_limit, ArenaExtendStrategy arena_extend_strategy,
-                                                        CUDAExecutionProviderExternalAllocatorInfo external_allocator_info, OrtArenaCfg* default_memory_arena_cfg) {
-  if (external_allocator_info.UseExternalAllocator()) {
+                                                        CUDAExecutionProviderExternalAllocatorInfo external_allocator_info, OrtArenaCfg* default_memory_arena_cfg,
+                                                        bool use_cuda_malloc_async) {
+  if (use_cuda_malloc_async) {
+    AllocatorCreationInfo default_memory_info(
+        [](OrtDevice::DeviceId id) {
+          return std::make_unique<CUDAAsyncAllocator>(id, CUDA);
+        },
+        device_id,
+        false);
+
+    // the driver's stream ordered memory pool already caches freed blocks, so no arena on top
+    return CreateAllocator(default_memory_info);
+
+  } else if (external_allocator_info.UseExternalAllocator()) {
     AllocatorCreationInfo default_memory_info(
         [external_allocator_info](OrtDevice::DeviceId id) {
           return std::make_unique<CUDAExternalAllocator>(id, CUDA, external_allocator_info.alloc, external_allocator_info.free, external_allocator_info.empty_cache);
@@ -120,11 +133,16 @@ AllocatorPtr CUDAExecutionProvider::CreateCudaAllocator(OrtDevice::DeviceId devi
   }
 }
 
-CUDAExecutionProvider::PerThreadContext::PerThreadContext(OrtDevice::DeviceId device_id, cudaStream_t stream, size_t gpu_mem_limit,
-                                                          ArenaExtendStrategy arena_extend_strategy, CUDAExecutionProviderExternalAllocatorInfo external_allocator_info,
-                                                          OrtArenaCfg* default_memory_arena_cfg) {
+CUDAExecutionProvider::PerThreadContext::PerThreadContext(OrtDevice::DeviceId device_id, cudaStream_t stream, bool create_side_stream,
+                                                          size_t gpu_mem_limit, ArenaExtendStrategy arena_extend_strategy,
+                                                          CUDAExecutionProviderExternalAllocatorInfo external_allocator_info,
+                                                          OrtArenaCfg* default_memory_arena_cfg, bool use_cuda_malloc_async) {
   CUDA_CALL_THROW(cudaSetDevice(device_id));
   stream_ = stream;
+  if (create_side_stream) {
+    CUDA_CALL_THROW(cudaStreamCreateWithFlags(&side_stream_, cudaStreamNonBlocking));
+  }
+  active_stream_ = stream_;
 
   CUBLAS_CALL_THROW(cublasCreate(&cublas_handle_));
   CUBLAS_CALL_THROW(cublasSetStream(cublas_handle_, stream));
@@ -133,7 +151,8 @@ CUDAExecutionProvider::PerThreadContext::PerThreadContext(OrtDevice::DeviceId de
   CUDNN_CALL_THROW(cudnnSetStream(cudnn_handle_, stream));
 
   // CUDA malloc/free is expensive so always use an arena
-  allocator_ = CreateCudaAllocator(device_id, gpu_mem_limit, arena_extend_strategy, external_allocator_info, default_memory_arena_cfg);
+  allocator_ = CreateCudaAllocator(device_id, gpu_mem_limit, arena_extend_strategy, external_allocator_info, default_memory_arena_cfg,
+                                   use_cuda_malloc_async);
 }
 
 CUDAExecutionProvider::PerThreadContext::~PerThreadContext() {
@@ -151,6 +170,45 @@ CUDAExecutionProvider::PerThreadContext::~PerThreadContext() {
   } catch (const std::exception& ex) {
     LOGS_DEFAULT(ERROR) << "cudnnDestroy threw:" << ex.what();
   }
+
+  if (side_stream_) {
+    CUDA_CALL(cudaStreamDestroy(side_stream_));
+  }
+}
+
+Status CUDAExecutionProvider::PerThreadContext::EnterConcurrentDispatch() {
+  ORT_ENFORCE(side_stream_ != nullptr, "The context has no side stream; was enable_multi_stream_execution set?");
+  active_stream_ = side_stream_;
+  CUBLAS_RETURN_IF_ERROR(cublasSetStream(cublas_handle_, active_stream_));
+  CUDNN_RETURN_IF_ERROR(cudnnSetStream(cudnn_handle_, active_stream_));
+  return Status::OK();
+}
+
+Status CUDAExecutionProvider::PerThreadContext::ExitConcurrentDispatch() {
+  active_stream_ = stream_;
+  CUBLAS_RETURN_IF_ERROR(cublasSetStream(cublas_handle_, active_stream_));
+  CUDNN_RETURN_IF_ERROR(cudnnSetStream(cudnn_handle_, active_stream_));
+  return Status::OK();
+}
+
+// Device properties never change for the lifetime of the process, but querying them requires the
+// device to be idle (hence the synchronize below), which makes them expensive to fetch in every
+// session's provider constructor. Cache them per device so only the first session per device pays.
+static const cudaDeviceProp& GetCachedDeviceProp(OrtDevice::DeviceId device_id) {
+  static OrtMutex mutex;
+  static std::unordered_map<OrtDevice::DeviceId, cudaDeviceProp> cached_device_props;
+
+  std::lock_guard<OrtMutex> lock(mutex);
+  auto it = cached_device_props.find(device_id);
+  if (it == cached_device_props.end()) {
+    // must wait GPU idle, otherwise cudaGetDeviceProperties might fail
+    CUDA_CALL_THROW(cudaDeviceSynchronize());
+    cudaDeviceProp prop;
+    CUDA_CALL_THROW(cudaGetDeviceProperties(&prop, device_id));
+    it = cached_device_props.emplace(device_id, prop).first;
+  }
+
+  return it->second;
 }
 
 CUDAExecutionProvider::CUDAExecutionProvider(const CUDAExecutionProviderInfo& info)
@@ -158,9 +216,7 @@ CUDAExecutionProvider::CUDAExecutionProvider(const CUDAExecutionProviderInfo& in
       info_{info} {
   CUDA_CALL_THROW(cudaSetDevice(info_.device_id));
 
-  // must wait GPU idle, otherwise cudaGetDeviceProperties might fail
-  CUDA_CALL_THROW(cudaDeviceSynchronize());
-  CUDA_CALL_THROW(cudaGetDeviceProperties(&device_prop_, info_.device_id));
+  device_prop_ = GetCachedDeviceProp(info_.device_id);
 
   // This scenario is not supported.
   ORT_ENFORCE(!(info.has_user_compute_stream && info.external_allocator_info.UseExternalAllocator()));
@@ -179,6 +235,21 @@ CUDAExecutionProvider::CUDAExecutionProvider(const CUDAExecutionProviderInfo& in
   size_t free = 0;
   size_t total = 0;
   CUDA_CALL_THROW(cudaMemGetInfo(&free, &total));
+
+  if (info.enable_cuda_graph) {
+    ORT_ENFORCE(stream_ != nullptr, "CUDA graph capture requires a compute stream.");
+    cuda_graph_.SetStream(stream_);
+  }
+
+  if (info.enable_multi_stream_execution) {
+    // side streams launch work behind the capturing stream's back, which breaks capture
+    ORT_ENFORCE(!info.enable_cuda_graph,
+                "enable_multi_stream_execution cannot be combined with enable_cuda_graph.");
+  }
+
+  if (!info.tuning_results_path.empty()) {
+    cuda::TuningResultsCache::Instance().SetPersistentPath(info.tuning_results_path);
+  }
 }
 
 CUDAExecutionProvider::~CUDAExecutionProvider() {
@@ -232,8 +303,10 @@ CUDAExecutionProvider::PerThreadContext& CUDAExecutionProvider::GetPerThreadCont
 
     // get or create a context
     if (context_state_.retired_context_pool.empty()) {
-      context = std::make_shared<PerThreadContext>(info_.device_id, static_cast<cudaStream_t>(GetComputeStream()), info_.gpu_mem_limit,
-                                                   info_.arena_extend_strategy, info_.external_allocator_info, info_.default_memory_arena_cfg);
+      context = std::make_shared<PerThreadContext>(info_.device_id, static_cast<cudaStream_t>(GetComputeStream()),
+                                                   info_.enable_multi_stream_execution, info_.gpu_mem_limit,
+                                                   info_.arena_extend_strategy, info_.external_allocator_info, info_.default_memory_arena_cfg,
+                                                   info_.enable_cuda_malloc_async);
     } else {
       context = context_state_.retired_context_pool.back();
       context_state_.retired_context_pool.pop_back();
@@ -325,10 +398,29 @@ Status CUDAExecutionProvider::OnRunStart() {
   auto& current_deferred_release_event = GetPerThreadContext().GetCurrentDeferredReleaseEvent();
   CUDA_RETURN_IF_ERROR(cudaEventCreate(&current_deferred_release_event, cudaEventDisableTiming));
   deferred_release_cpu_ptr_.emplace(current_deferred_release_event, DeferredReleaseCPUPtrs());
+
+  if (IsGraphCaptureEnabled() && !is_graph_captured_ && IsGraphCaptureAllowed()) {
+    LOGS_DEFAULT(INFO) << "Capturing the model into a CUDA graph on this run.";
+    cuda_graph_.CaptureBegin();
+    graph_capture_in_progress_ = true;
+  }
+
   return Status::OK();
 }
 
 Status CUDAExecutionProvider::OnRunEnd() {
+  if (graph_capture_in_progress_) {
+    // capture must end before any synchronization below, which is illegal on a capturing stream
+    cuda_graph_.CaptureEnd();
+    graph_capture_in_progress_ = false;
+    is_graph_captured_ = true;
+    // work submitted to a capturing stream is recorded rather than executed, so replay the graph
+    // once here to produce this run's results.
+    ORT_RETURN_IF_ERROR(ReplayGraph());
+  } else if (IsGraphCaptureEnabled() && !is_graph_captured_) {
+    ++regular_run_count_before_graph_capture_;
+  }
+
   // record deferred release event on default stream, and release per_thread_context
   auto current_deferred_release_event = GetPerThreadContext().GetCurrentDeferredReleaseEvent();
   CUDA_RETURN_IF_ERROR(cudaEventRecord(current_deferred_release_event, static_cast<cudaStream_t>(GetComputeStream())));
@@ -340,6 +432,137 @@ Status CUDAExecutionProvider::OnRunEnd() {
   return Status::OK();
 }
 
+bool CUDAExecutionProvider::IsGraphCaptureAllowed() const {
+  return regular_run_count_before_graph_capture_ >= min_num_runs_before_cuda_graph_capture_;
+}
+
+bool CUDAExecutionProvider::IsGraphCaptureEnabled() const {
+  return info_.enable_cuda_graph;
+}
+
+bool CUDAExecutionProvider::IsGraphCaptured() const {
+  return is_graph_captured_;
+}
+
+Status CUDAExecutionProvider::ReplayGraph() {
+  ORT_ENFORCE(is_graph_captured_, "ReplayGraph() is called before the graph has been captured.");
+  return cuda_graph_.Replay();
+}
+
+Status CUDAExecutionProvider::OnConcurrentDispatchBegin() const {
+  // serialize dispatch groups across concurrent Run() calls; the fork/join state below is
+  // per-dispatch. Released in OnConcurrentDispatchEnd, which runs on this same thread.
+  concurrent_dispatch_mutex_.lock();
+
+  const cudaError_t create_result = cudaEventCreate(&concurrent_fork_event_, cudaEventDisableTiming);
+  const cudaError_t record_result = create_result == cudaSuccess
+                                        ? cudaEventRecord(concurrent_fork_event_, ComputeStreamForCurrentThread())
+                                        : create_result;
+  if (record_result != cudaSuccess) {
+    if (create_result == cudaSuccess) {
+      CUDA_CALL(cudaEventDestroy(concurrent_fork_event_));
+    }
+    concurrent_fork_event_ = nullptr;
+    concurrent_dispatch_mutex_.unlock();
+    CUDA_RETURN_IF_ERROR(record_result);
+  }
+
+  return Status::OK();
+}
+
+Status CUDAExecutionProvider::OnConcurrentNodeBegin() const {
+  // like OnRunStart, the node may execute on a worker thread that has not touched the device yet
+  CUDA_RETURN_IF_ERROR(cudaSetDevice(GetDeviceId()));
+  auto& context = GetPerThreadContext();
+
+  // Kernels attach deferred-release CPU buffers to the context's current event, which for a
+  // worker thread may be unset or already handed off. Give the context a live event and remember
+  // it so OnConcurrentDispatchEnd can record it on this thread's side stream once the group joins.
+  cudaEvent_t created_event = nullptr;
+  {
+    std::lock_guard<OrtMutex> lock(deferred_release_cpu_ptr_mutex_);
+    auto& deferred_release_event = context.GetCurrentDeferredReleaseEvent();
+    const auto it = deferred_release_event != nullptr ? deferred_release_cpu_ptr_.find(deferred_release_event)
+                                                      : deferred_release_cpu_ptr_.end();
+    if (it == deferred_release_cpu_ptr_.end() || it->second.recorded) {
+      CUDA_RETURN_IF_ERROR(cudaEventCreate(&deferred_release_event, cudaEventDisableTiming));
+      deferred_release_cpu_ptr_.emplace(deferred_release_event, DeferredReleaseCPUPtrs());
+      created_event = deferred_release_event;
+    }
+  }
+
+  ORT_RETURN_IF_ERROR(context.EnterConcurrentDispatch());
+
+  if (created_event != nullptr) {
+    std::lock_guard<OrtMutex> lock(concurrent_events_mutex_);
+    concurrent_deferred_events_.emplace_back(created_event, context.Stream());
+  }
+
+  // order this thread's side stream behind the work already queued by the dispatching thread
+  CUDA_RETURN_IF_ERROR(cudaStreamWaitEvent(context.Stream(), concurrent_fork_event_, 0));
+  return Status::OK();
+}
+
+Status CUDAExecutionProvider::OnConcurrentNodeEnd() const {
+  auto& context = GetPerThreadContext();
+  const cudaStream_t side_stream = context.Stream();
+
+  cudaEvent_t join_event = nullptr;
+  CUDA_RETURN_IF_ERROR(cudaEventCreate(&join_event, cudaEventDisableTiming));
+  {
+    // push before recording so OnConcurrentDispatchEnd destroys the event even on failure below
+    std::lock_guard<OrtMutex> lock(concurrent_events_mutex_);
+    concurrent_join_events_.push_back(join_event);
+  }
+  CUDA_RETURN_IF_ERROR(cudaEventRecord(join_event, side_stream));
+
+  return context.ExitConcurrentDispatch();
+}
+
+Status CUDAExecutionProvider::OnConcurrentDispatchEnd() const {
+  const cudaStream_t dispatch_stream = ComputeStreamForCurrentThread();
+  cudaError_t first_failure = cudaSuccess;
+
+  std::vector<cudaEvent_t> join_events;
+  std::vector<std::pair<cudaEvent_t, cudaStream_t>> deferred_events;
+  {
+    std::lock_guard<OrtMutex> lock(concurrent_events_mutex_);
+    join_events.swap(concurrent_join_events_);
+    deferred_events.swap(concurrent_deferred_events_);
+  }
+
+  // make the dispatching thread's stream wait for everything the group launched on side streams
+  for (auto join_event : join_events) {
+    const cudaError_t wait_result = cudaStreamWaitEvent(dispatch_stream, join_event, 0);
+    if (first_failure == cudaSuccess) {
+      first_failure = wait_result;
+    }
+    CUDA_CALL(cudaEventDestroy(join_event));
+  }
+
+  // deferred-release events created for worker threads become reclaimable once their side
+  // stream drains; everything attached to them was launched before the join events above
+  {
+    std::lock_guard<OrtMutex> lock(deferred_release_cpu_ptr_mutex_);
+    for (const auto& deferred_event : deferred_events) {
+      const cudaError_t record_result = cudaEventRecord(deferred_event.first, deferred_event.second);
+      if (first_failure == cudaSuccess) {
+        first_failure = record_result;
+      }
+      deferred_release_cpu_ptr_[deferred_event.first].recorded = true;
+    }
+  }
+
+  if (concurrent_fork_event_ != nullptr) {
+    CUDA_CALL(cudaEventDestroy(concurrent_fork_event_));
+    concurrent_fork_event_ = nullptr;
+  }
+
+  concurrent_dispatch_mutex_.unlock();
+  CUDA_RETURN_IF_ERROR(first_failure);
+  return Status::OK();
+}
+
 Status CUDAExecutionProvider::SetComputeStream(void* stream) {
   if (stream != stream_) {
     if (stream_) {
@@ -348,6 +571,11 @@ Status CUDAExecutionProvider::SetComputeStream(void* stream) {
 
     external_stream_ = true;
     stream_ = static_cast<cudaStream_t>(stream);
+
+    if (IsGraphCaptureEnabled()) {
+      ORT_ENFORCE(!is_graph_captured_, "The compute stream cannot change after a CUDA graph has been captured.");
+      cuda_graph_.SetStream(stream_);
+    }
   }
   return Status::OK();
 }
@@ -2287,7 +2515,8 @@ void CUDAExecutionProvider::RegisterAllocator(std::shared_ptr<AllocatorManager>
   auto cuda_alloc = allocator_manager->GetAllocator(info_.device_id, OrtMemTypeDefault);
   if (nullptr == cuda_alloc) {
     cuda_alloc = CreateCudaAllocator(info_.device_id, info_.gpu_mem_limit, info_.arena_extend_strategy,
-                                     info_.external_allocator_info, info_.default_memory_arena_cfg);
+                                     info_.external_allocator_info, info_.default_memory_arena_cfg,
+                                     info_.enable_cuda_malloc_async);
     allocator_manager->InsertAllocator(cuda_alloc);
   }
   TryInsertAllocator(cuda_alloc);
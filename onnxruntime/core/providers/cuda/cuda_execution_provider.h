@@ -4,6 +4,7 @@
 #pragma once
 
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "core/framework/allocatormgr.h"
@@ -11,6 +12,7 @@
 #include "core/framework/execution_provider.h"
 #include "core/platform/ort_mutex.h"
 #include "core/providers/cuda/cuda_execution_provider_info.h"
+#include "core/providers/cuda/cuda_graph.h"
 #include "core/providers/cuda/cuda_pch.h"
 #include "core/providers/cuda/shared_inc/cuda_utils.h"
 #include "core/providers/cuda/shared_inc/cuda_call.h"
@@ -40,6 +42,16 @@ class CUDAExecutionProvider : public IExecutionProvider {
 
   void* GetComputeStream() const override { return static_cast<void*>(stream_); }
 
+  // The stream kernels invoked on the calling thread should launch work on. This is the
+  // provider-wide stream except while the thread is executing a concurrently dispatched node
+  // (see enable_multi_stream_execution), where it is the thread's own side stream.
+  cudaStream_t ComputeStreamForCurrentThread() const {
+    if (!info_.enable_multi_stream_execution) {
+      return stream_;
+    }
+    return GetPerThreadContext().Stream();
+  }
+
   cublasHandle_t PerThreadCublasHandle() {
     return GetPerThreadContext().CublasHandle();
   }
@@ -90,7 +102,18 @@ class CUDAExecutionProvider : public IExecutionProvider {
 
   void RegisterAllocator(std::shared_ptr<AllocatorManager> allocator_manager) override;
   static AllocatorPtr CreateCudaAllocator(OrtDevice::DeviceId device_id, size_t cuda_mem_limit, ArenaExtendStrategy arena_extend_strategy,
-                                          CUDAExecutionProviderExternalAllocatorInfo external_alloc_info, OrtArenaCfg* arena_cfg);
+                                          CUDAExecutionProviderExternalAllocatorInfo external_alloc_info, OrtArenaCfg* arena_cfg,
+                                          bool use_cuda_malloc_async = false);
+
+  bool IsGraphCaptureEnabled() const override;
+  bool IsGraphCaptured() const override;
+  Status ReplayGraph() override;
+
+  bool SupportsConcurrentNodeDispatch() const override { return info_.enable_multi_stream_execution; }
+  Status OnConcurrentDispatchBegin() const override;
+  Status OnConcurrentNodeBegin() const override;
+  Status OnConcurrentNodeEnd() const override;
+  Status OnConcurrentDispatchEnd() const override;
 
  private:
   CUDAExecutionProviderInfo info_;
@@ -98,6 +121,17 @@ class CUDAExecutionProvider : public IExecutionProvider {
   bool external_stream_ = false;
   cudaStream_t stream_ = nullptr;
 
+  // CUDA graph capture/replay state (see enable_cuda_graph). The graph is captured on the run
+  // after the warm-up run so that one-time work (arena growth, cudnn algo search, constant
+  // uploads) is not baked into the graph, then replayed on every later run.
+  bool IsGraphCaptureAllowed() const;
+
+  CUDAGraph cuda_graph_;
+  bool is_graph_captured_ = false;
+  bool graph_capture_in_progress_ = false;
+  int regular_run_count_before_graph_capture_ = 0;
+  const int min_num_runs_before_cuda_graph_capture_ = 1;  // required warm-up runs before capture
+
   struct DeferredReleaseCPUPtrs {
     bool recorded = false;
     std::vector<void*> cpu_ptrs;
@@ -106,12 +140,34 @@ class CUDAExecutionProvider : public IExecutionProvider {
   std::unordered_map<cudaEvent_t, DeferredReleaseCPUPtrs> deferred_release_cpu_ptr_;
   OrtMutex deferred_release_cpu_ptr_mutex_;
 
+  // Event fencing for concurrent node dispatch (see enable_multi_stream_execution). The fork
+  // event makes the side streams of the worker threads wait on work already queued on the
+  // dispatching thread's stream; the join events make the dispatching thread's stream wait on
+  // the work the workers launched. Deferred-release events created for worker threads are
+  // recorded on the matching side stream once the group joins. The hooks are const because the
+  // executor only holds const provider references, hence the mutable state.
+  mutable OrtMutex concurrent_dispatch_mutex_;  // serializes dispatch groups across concurrent Run() calls
+  mutable OrtMutex concurrent_events_mutex_;    // guards the event collections below during a dispatch
+  mutable cudaEvent_t concurrent_fork_event_ = nullptr;
+  mutable std::vector<cudaEvent_t> concurrent_join_events_;
+  mutable std::vector<std::pair<cudaEvent_t, cudaStream_t>> concurrent_deferred_events_;
+
   class PerThreadContext final {
    public:
-    PerThreadContext(OrtDevice::DeviceId device_id, cudaStream_t stream, size_t cuda_mem_limit, ArenaExtendStrategy arena_extend_strategy,
-                     CUDAExecutionProviderExternalAllocatorInfo external_alloc_info, OrtArenaCfg* arena_cfg);
+    PerThreadContext(OrtDevice::DeviceId device_id, cudaStream_t stream, bool create_side_stream, size_t cuda_mem_limit,
+                     ArenaExtendStrategy arena_extend_strategy, CUDAExecutionProviderExternalAllocatorInfo external_alloc_info,
+                     OrtArenaCfg* arena_cfg, bool use_cuda_malloc_async);
     ~PerThreadContext();
 
+    cudaStream_t Stream() const {
+      return active_stream_;
+    }
+
+    // Switch the context (including the cublas/cudnn handle bindings) to its own side stream
+    // while the thread executes a concurrently dispatched node, and back afterwards.
+    Status EnterConcurrentDispatch();
+    Status ExitConcurrentDispatch();
+
     cublasHandle_t CublasHandle() const {
       return cublas_handle_;
     }
@@ -130,23 +186,23 @@ class CUDAExecutionProvider : public IExecutionProvider {
         if (!constant_ones_float_) {
           constant_ones_float_ = cuda::CreateConstantOnes<float>();
         }
-        return reinterpret_cast<const T*>(constant_ones_float_->GetBuffer(stream_, count));
+        return reinterpret_cast<const T*>(constant_ones_float_->GetBuffer(active_stream_, count));
       } else if (std::is_same<T, double>::value) {
         if (!constant_ones_double_) {
           constant_ones_double_ = cuda::CreateConstantOnes<double>();
         }
-        return reinterpret_cast<const T*>(constant_ones_double_->GetBuffer(stream_, count));
+        return reinterpret_cast<const T*>(constant_ones_double_->GetBuffer(active_stream_, count));
       } else if (std::is_same<T, half>::value) {
         if (!constant_ones_half_) {
           constant_ones_half_ = cuda::CreateConstantOnes<half>();
         }
-        return reinterpret_cast<const T*>(constant_ones_half_->GetBuffer(stream_, count));
+        return reinterpret_cast<const T*>(constant_ones_half_->GetBuffer(active_stream_, count));
 #if defined(CUDA_VERSION) && CUDA_VERSION >= 11000
       } else if (std::is_same<T, nv_bfloat16>::value) {
         if (!constant_ones_bfloat16_) {
           constant_ones_bfloat16_ = cuda::CreateConstantOnes<nv_bfloat16>();
         }
-        return reinterpret_cast<const T*>(constant_ones_bfloat16_->GetBuffer(stream_, count));
+        return reinterpret_cast<const T*>(constant_ones_bfloat16_->GetBuffer(active_stream_, count));
 #endif
       } else {
         return nullptr;
@@ -159,6 +215,10 @@ class CUDAExecutionProvider : public IExecutionProvider {
 
    private:
     cudaStream_t stream_ = nullptr;
+    // owned non-blocking stream for concurrently dispatched nodes (enable_multi_stream_execution)
+    cudaStream_t side_stream_ = nullptr;
+    // stream_, or side_stream_ between Enter/ExitConcurrentDispatch
+    cudaStream_t active_stream_ = nullptr;
     cublasHandle_t cublas_handle_ = nullptr;
     cudnnHandle_t cudnn_handle_ = nullptr;
 
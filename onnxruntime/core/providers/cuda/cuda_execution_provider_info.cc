@@ -21,6 +21,10 @@ constexpr const char* kGpuExternalAlloc = "gpu_external_alloc";
 constexpr const char* kGpuExternalFree = "gpu_external_free";
 constexpr const char* kGpuExternalEmptyCache = "gpu_external_empty_cache";
 constexpr const char* kCudnnConvUseMaxWorkspace = "cudnn_conv_use_max_workspace";
+constexpr const char* kEnableCudaGraph = "enable_cuda_graph";
+constexpr const char* kEnableMultiStreamExecution = "enable_multi_stream_execution";
+constexpr const char* kTuningResultsPath = "tuning_results_path";
+constexpr const char* kEnableCudaMallocAsync = "enable_cuda_malloc_async";
 }  // namespace provider_option_names
 }  // namespace cuda
 
@@ -91,6 +95,10 @@ CUDAExecutionProviderInfo CUDAExecutionProviderInfo::FromProviderOptions(const P
               *ort_cudnn_conv_algo_search_mapping, info.cudnn_conv_algo_search)
           .AddAssignmentToReference(cuda::provider_option_names::kDoCopyInDefaultStream, info.do_copy_in_default_stream)
           .AddAssignmentToReference(cuda::provider_option_names::kCudnnConvUseMaxWorkspace, info.cudnn_conv_use_max_workspace)
+          .AddAssignmentToReference(cuda::provider_option_names::kEnableCudaGraph, info.enable_cuda_graph)
+          .AddAssignmentToReference(cuda::provider_option_names::kEnableMultiStreamExecution, info.enable_multi_stream_execution)
+          .AddAssignmentToReference(cuda::provider_option_names::kTuningResultsPath, info.tuning_results_path)
+          .AddAssignmentToReference(cuda::provider_option_names::kEnableCudaMallocAsync, info.enable_cuda_malloc_async)
           .Parse(options));
 
   CUDAExecutionProviderExternalAllocatorInfo alloc_info{alloc, free, empty_cache};
@@ -111,6 +119,10 @@ ProviderOptions CUDAExecutionProviderInfo::ToProviderOptions(const CUDAExecution
        EnumToName(*ort_cudnn_conv_algo_search_mapping, info.cudnn_conv_algo_search)},
       {cuda::provider_option_names::kDoCopyInDefaultStream, MakeStringWithClassicLocale(info.do_copy_in_default_stream)},
       {cuda::provider_option_names::kCudnnConvUseMaxWorkspace, MakeStringWithClassicLocale(info.cudnn_conv_use_max_workspace)},
+      {cuda::provider_option_names::kEnableCudaGraph, MakeStringWithClassicLocale(info.enable_cuda_graph)},
+      {cuda::provider_option_names::kEnableMultiStreamExecution, MakeStringWithClassicLocale(info.enable_multi_stream_execution)},
+      {cuda::provider_option_names::kTuningResultsPath, info.tuning_results_path},
+      {cuda::provider_option_names::kEnableCudaMallocAsync, MakeStringWithClassicLocale(info.enable_cuda_malloc_async)},
   };
 
   return options;
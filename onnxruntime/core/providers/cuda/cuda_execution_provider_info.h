@@ -4,6 +4,7 @@
 #pragma once
 
 #include <limits>
+#include <string>
 
 #include "core/framework/arena_extend_strategy.h"
 #include "core/framework/ortdevice.h"
@@ -51,6 +52,25 @@ struct CUDAExecutionProviderInfo {
   // By default use fix workspace size (32M) for Conv algo search, the final algo might not be the best.
   // If set to true, try to use as much as possible memory for algo search.
   bool cudnn_conv_use_max_workspace{false};
+  // Capture the model into a CUDA graph after a warm-up run and replay it on later runs. Requires
+  // static shapes, every node assigned to the CUDA EP and feeds/fetches bound to fixed device
+  // buffers across runs.
+  bool enable_cuda_graph{false};
+  // Give every calling thread its own non-blocking compute stream so that independent nodes
+  // dispatched concurrently by the executor run on different streams. Dispatch boundaries are
+  // fenced with CUDA events. The number of extra streams is bounded by the intra-op thread count.
+  // Not compatible with enable_cuda_graph or a user-provided compute stream.
+  bool enable_multi_stream_execution{false};
+  // File priming the process-wide kernel tuning cache (see cuda::TuningResultsCache). Tuning
+  // decisions such as exhaustively searched conv algorithms are reloaded from it on startup and
+  // new results are appended, so only the first process ever pays the benchmarking cost.
+  std::string tuning_results_path{};
+  // Allocate device memory with cudaMallocAsync from the device's stream ordered memory pool
+  // instead of the BFC arena over cudaMalloc (requires CUDA >= 11.2). Pool growth is
+  // asynchronous, avoiding the implicit device synchronization an arena extension incurs, and
+  // the pool is shared by every session in the process. gpu_mem_limit, arena_extend_strategy
+  // and default_memory_arena_cfg do not apply to this backend.
+  bool enable_cuda_malloc_async{false};
 
   static CUDAExecutionProviderInfo FromProviderOptions(const ProviderOptions& options);
   static ProviderOptions ToProviderOptions(const CUDAExecutionProviderInfo& info);
@@ -43,6 +43,38 @@ void CUDAFence::BeforeUsingAsOutput(onnxruntime::ProviderType provider_type, int
   }
 }
 
+// Trampoline for cudaLaunchHostFunc; owns and runs the heap-allocated std::function.
+static void CUDART_CB RunFenceReadyCallback(void* user_data) {
+  std::unique_ptr<std::function<void()>> ready_callback(static_cast<std::function<void()>*>(user_data));
+  (*ready_callback)();
+}
+
+bool CUDAFence::RegisterInputReadyCallback(onnxruntime::ProviderType provider_type, int /*queue_id*/,
+                                           std::function<void()> ready_callback) {
+  if (provider_type == onnxruntime::kCudaExecutionProvider) {
+    // GPU consumers wait on the stream via BeforeUsingAsInput; nothing blocks on CPU
+    return false;
+  }
+  if (cudaEventQuery(write_event_) == cudaSuccess) {
+    // already signaled, the caller can proceed without blocking
+    return false;
+  }
+  // Enqueue the host callback behind the pending write on the copy-out stream - the queue
+  // already used for device-to-host hand-offs - so the host-function serialization that
+  // cudaLaunchHostFunc imposes stays off the compute stream. On any failure fall back to the
+  // blocking wait in BeforeUsingAsInput.
+  cudaStream_t stream = data_transfer_->GetStream(kCudaStreamCopyOut);
+  if (cudaStreamWaitEvent(stream, write_event_, 0) != cudaSuccess) {
+    return false;
+  }
+  auto* callback = new std::function<void()>(std::move(ready_callback));
+  if (cudaLaunchHostFunc(stream, RunFenceReadyCallback, callback) != cudaSuccess) {
+    delete callback;
+    return false;
+  }
+  return true;
+}
+
 bool CUDAFence::CanRelease() {
   return cudaEventQuery(read_event_) == cudaSuccess &&
          cudaEventQuery(write_event_) == cudaSuccess;
@@ -17,6 +17,8 @@ class CUDAFence : public IFence {
   virtual void AfterUsedAsInput(int queue_id) override;
   virtual void AfterUsedAsOutput(int queue_id) override;
   virtual bool CanRelease() override;
+  virtual bool RegisterInputReadyCallback(onnxruntime::ProviderType provider_type, int queue_id,
+                                          std::function<void()> ready_callback) override;
 
  private:
   cudaEvent_t read_event_;
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cuda/cuda_graph.h"
+
+#include "core/providers/cuda/cuda_common.h"
+#include "core/providers/cuda/shared_inc/cuda_call.h"
+
+namespace onnxruntime {
+
+void CUDAGraph::SetStream(cudaStream_t stream) {
+  stream_ = stream;
+}
+
+void CUDAGraph::CaptureBegin() {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10000
+  ORT_ENFORCE(!has_graph_exec_,
+              "This cuda graph has already captured a graph. "
+              "Create a new instance to capture a new graph.");
+
+  // TODO: Currently, the first parameter of cudaStreamBeginCapture must be the default stream or
+  // the capture fails with cudaErrorStreamCaptureUnsupported when any kernel launches on another
+  // stream. All kernels of the session launch on stream_, so global capture mode is sufficient.
+  CUDA_CALL_THROW(cudaStreamBeginCapture(stream_, cudaStreamCaptureModeGlobal));
+#else
+  ORT_THROW("CUDA graphs require CUDA 10.0 or later.");
+#endif
+}
+
+void CUDAGraph::CaptureEnd() {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10000
+  CUDA_CALL_THROW(cudaStreamEndCapture(stream_, &graph_));
+  if (graph_ == NULL) {
+    ORT_THROW("CUDAGraph::CaptureEnd: graph_ is NULL");
+  }
+
+  has_graph_ = true;
+  CUDA_CALL_THROW(cudaGraphInstantiate(&graph_exec_, graph_, NULL, NULL, 0));
+  has_graph_exec_ = true;
+
+  // the uninstantiated graph is no longer needed once the executable graph exists
+  CUDA_CALL_THROW(cudaGraphDestroy(graph_));
+  has_graph_ = false;
+#else
+  ORT_THROW("CUDA graphs require CUDA 10.0 or later.");
+#endif
+}
+
+Status CUDAGraph::Replay() {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10000
+  // although this function is not thread safe, a lock is not needed as it is always called by the
+  // same thread that captured the graph between OnRunStart and OnRunEnd.
+  LOGS_DEFAULT(INFO) << "Replaying CUDA graph on stream " << stream_;
+  CUDA_RETURN_IF_ERROR(cudaGraphLaunch(graph_exec_, stream_));
+  CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(stream_));
+  return Status::OK();
+#else
+  return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "CUDA graphs require CUDA 10.0 or later.");
+#endif
+}
+
+void CUDAGraph::Reset() {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10000
+  if (has_graph_) {
+    CUDA_CALL_THROW(cudaGraphDestroy(graph_));
+    has_graph_ = false;
+  }
+  if (has_graph_exec_) {
+    CUDA_CALL_THROW(cudaGraphExecDestroy(graph_exec_));
+    has_graph_exec_ = false;
+  }
+#endif
+}
+
+CUDAGraph::~CUDAGraph() {
+  Reset();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/providers/cuda/cuda_pch.h"
+
+namespace onnxruntime {
+
+using CaptureId_t = unsigned long long;
+
+// Wraps capture of a CUDA stream into a cudaGraph and its replay. One instance owns at most one
+// captured graph at a time; Reset releases it so a new capture can begin. CUDA graph support
+// requires CUDA 10.0 or later; the methods throw on older toolkits.
+struct CUDAGraph {
+  CUDAGraph() = default;
+  ~CUDAGraph();
+
+  void SetStream(cudaStream_t stream);
+  void CaptureBegin();
+  void CaptureEnd();
+  Status Replay();
+  void Reset();
+
+ private:
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10000
+  cudaGraph_t graph_ = NULL;
+  cudaGraphExec_t graph_exec_ = NULL;
+#endif
+
+  bool has_graph_ = false;
+  bool has_graph_exec_ = false;
+
+  cudaStream_t stream_ = nullptr;  // the stream the graph is captured from and replayed on
+};
+
+}  // namespace onnxruntime
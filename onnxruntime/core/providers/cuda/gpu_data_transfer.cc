@@ -30,6 +30,17 @@ GPUDataTransfer::~GPUDataTransfer() {
   if (!do_copy_in_default_stream_ && streams_[kCudaStreamCopyOut] != nullptr) {
     CUDA_CALL(cudaStreamDestroy(streams_[kCudaStreamCopyOut]));
   }
+
+  // drain and free the pinned staging pool
+  for (auto& buffer : staging_buffers_) {
+    if (buffer->done != nullptr) {
+      CUDA_CALL(cudaEventSynchronize(buffer->done));
+      CUDA_CALL(cudaEventDestroy(buffer->done));
+    }
+    if (buffer->ptr != nullptr) {
+      CUDA_CALL(cudaFreeHost(buffer->ptr));
+    }
+  }
 }
 
 bool GPUDataTransfer::CanCopy(const OrtDevice& src_device, const OrtDevice& dst_device) const {
@@ -37,7 +48,82 @@ bool GPUDataTransfer::CanCopy(const OrtDevice& src_device, const OrtDevice& dst_
          dst_device.Type() == OrtDevice::GPU || dst_device.MemType() == OrtDevice::MemType::CUDA_PINNED;
 }
 
-common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst, int exec_queue_id) const {
+GPUDataTransfer::StagingBuffer* GPUDataTransfer::AcquireStagingBuffer(size_t bytes) const {
+  if (bytes > kMaxStagingBufferBytes) {
+    return nullptr;
+  }
+
+  size_t class_size = kMinStagingBufferBytes;
+  while (class_size < bytes) {
+    class_size <<= 1;
+  }
+
+  std::lock_guard<OrtMutex> lock(staging_mutex_);
+
+  // reclaim in-flight buffers whose transfers have drained
+  for (size_t i = 0; i < in_flight_staging_buffers_.size();) {
+    StagingBuffer* in_flight = in_flight_staging_buffers_[i];
+    if (cudaEventQuery(in_flight->done) == cudaSuccess) {
+      free_staging_buffers_.push_back(in_flight);
+      in_flight_staging_buffers_[i] = in_flight_staging_buffers_.back();
+      in_flight_staging_buffers_.pop_back();
+    } else {
+      ++i;
+    }
+  }
+
+  // prefer the smallest free buffer that fits, keeping larger classes available for larger copies
+  size_t best_idx = free_staging_buffers_.size();
+  for (size_t i = 0; i < free_staging_buffers_.size(); ++i) {
+    StagingBuffer* candidate = free_staging_buffers_[i];
+    if (candidate->size >= class_size &&
+        (best_idx == free_staging_buffers_.size() || candidate->size < free_staging_buffers_[best_idx]->size)) {
+      best_idx = i;
+    }
+  }
+  if (best_idx < free_staging_buffers_.size()) {
+    StagingBuffer* result = free_staging_buffers_[best_idx];
+    free_staging_buffers_[best_idx] = free_staging_buffers_.back();
+    free_staging_buffers_.pop_back();
+    return result;
+  }
+
+  if (staging_pool_bytes_ + class_size > kMaxStagingPoolBytes) {
+    return nullptr;
+  }
+
+  void* ptr = nullptr;
+  if (cudaHostAlloc(&ptr, class_size, cudaHostAllocDefault) != cudaSuccess) {
+    return nullptr;
+  }
+  cudaEvent_t done = nullptr;
+  if (cudaEventCreateWithFlags(&done, cudaEventDisableTiming) != cudaSuccess) {
+    CUDA_CALL(cudaFreeHost(ptr));
+    return nullptr;
+  }
+
+  auto buffer = std::make_unique<StagingBuffer>();
+  buffer->ptr = ptr;
+  buffer->size = class_size;
+  buffer->done = done;
+  StagingBuffer* result = buffer.get();
+  staging_buffers_.push_back(std::move(buffer));
+  staging_pool_bytes_ += class_size;
+  return result;
+}
+
+void GPUDataTransfer::ReleaseStagingBufferOnEvent(StagingBuffer* buffer) const {
+  std::lock_guard<OrtMutex> lock(staging_mutex_);
+  in_flight_staging_buffers_.push_back(buffer);
+}
+
+void GPUDataTransfer::ReleaseStagingBuffer(StagingBuffer* buffer) const {
+  std::lock_guard<OrtMutex> lock(staging_mutex_);
+  free_staging_buffers_.push_back(buffer);
+}
+
+common::Status GPUDataTransfer::CopyTensorAsync(const Tensor& src, Tensor& dst, int exec_queue_id,
+                                                PendingSync& pending) const {
   size_t bytes = src.SizeInBytes();
   const void* src_data = src.DataRaw();
   void* dst_data = dst.MutableDataRaw();
@@ -45,6 +131,9 @@ common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst, int e
   auto& src_device = src.Location().device;
   auto& dst_device = dst.Location().device;
 
+  // Note on the error paths below: a staging buffer whose copy or event record failed is neither
+  // freed nor returned to the pool, since the device may still touch it; it stays owned by
+  // staging_buffers_ and is simply retired. The run is failing at that point anyway.
   if (dst_device.Type() == OrtDevice::GPU) {
     if (src_device.Type() == OrtDevice::CPU && src_device.MemType() == OrtDevice::MemType::CUDA_PINNED) {
       // copy from pinned memory to GPU, this is non-blocking
@@ -56,18 +145,42 @@ common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst, int e
         CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyDeviceToDevice, GetStream(kCudaStreamDefault)));
       }
     } else {
-      // copy from other CPU memory to GPU, this is blocking
-      CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyHostToDevice, GetStream(kCudaStreamDefault)));
-      CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(GetStream(kCudaStreamDefault)));
+      // Copy from pageable CPU memory to GPU. Stage through pinned memory where possible so the
+      // device transfer runs asynchronously: the source is fully captured by the host-side
+      // memcpy, and later work on the default stream is ordered behind the transfer without an
+      // explicit synchronization.
+      StagingBuffer* staging = AcquireStagingBuffer(bytes);
+      if (staging != nullptr) {
+        memcpy(staging->ptr, src_data, bytes);
+        CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, staging->ptr, bytes, cudaMemcpyHostToDevice, GetStream(kCudaStreamDefault)));
+        CUDA_RETURN_IF_ERROR(cudaEventRecord(staging->done, GetStream(kCudaStreamDefault)));
+        ReleaseStagingBufferOnEvent(staging);
+      } else {
+        // no staging buffer available: issue the copy and settle it in Finalize
+        CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyHostToDevice, GetStream(kCudaStreamDefault)));
+        pending.sync_default_stream = true;
+      }
     }
   } else if (src_device.Type() == OrtDevice::GPU) {
     if (dst_device.Type() == OrtDevice::CPU && dst_device.MemType() == OrtDevice::MemType::CUDA_PINNED) {
       // copying from GPU to pinned memory, this is non-blocking
       CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyDeviceToHost, GetStream(exec_queue_id)));
     } else {
-      // copying from GPU to CPU memory, this is blocking
-      CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyDeviceToHost, GetStream(kCudaStreamDefault)));
-      CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(GetStream(kCudaStreamDefault)));
+      // Copy from GPU to pageable CPU memory. Stage through pinned memory where possible so a
+      // batch of fetches waits once in Finalize instead of synchronizing per tensor.
+      StagingBuffer* staging = AcquireStagingBuffer(bytes);
+      if (staging != nullptr) {
+        CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(staging->ptr, src_data, bytes, cudaMemcpyDeviceToHost, GetStream(kCudaStreamDefault)));
+        CUDA_RETURN_IF_ERROR(cudaEventRecord(staging->done, GetStream(kCudaStreamDefault)));
+        PendingHostCopy host_copy;
+        host_copy.buffer = staging;
+        host_copy.dst = dst_data;
+        host_copy.bytes = bytes;
+        pending.host_copies.push_back(host_copy);
+      } else {
+        CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyDeviceToHost, GetStream(kCudaStreamDefault)));
+        pending.sync_default_stream = true;
+      }
     }
   } else {
     // copying between cpu memory
@@ -76,4 +189,54 @@ common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst, int e
 
   return Status::OK();
 }
+
+common::Status GPUDataTransfer::Finalize(PendingSync& pending) const {
+  cudaError_t first_failure = cudaSuccess;
+
+  if (pending.sync_default_stream) {
+    first_failure = cudaStreamSynchronize(GetStream(kCudaStreamDefault));
+    pending.sync_default_stream = false;
+  }
+
+  for (auto& host_copy : pending.host_copies) {
+    const cudaError_t wait_result = cudaEventSynchronize(host_copy.buffer->done);
+    if (wait_result == cudaSuccess) {
+      memcpy(host_copy.dst, host_copy.buffer->ptr, host_copy.bytes);
+      ReleaseStagingBuffer(host_copy.buffer);
+    } else {
+      if (first_failure == cudaSuccess) {
+        first_failure = wait_result;
+      }
+      ReleaseStagingBufferOnEvent(host_copy.buffer);
+    }
+  }
+  pending.host_copies.clear();
+
+  CUDA_RETURN_IF_ERROR(first_failure);
+  return Status::OK();
+}
+
+common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst, int exec_queue_id) const {
+  PendingSync pending;
+  Status copy_status = CopyTensorAsync(src, dst, exec_queue_id, pending);
+  Status finalize_status = Finalize(pending);
+  ORT_RETURN_IF_ERROR(copy_status);
+  return finalize_status;
+}
+
+common::Status GPUDataTransfer::CopyTensors(const std::vector<SrcDstPair>& src_dst_pairs) const {
+  PendingSync pending;
+  Status copy_status = Status::OK();
+  for (const auto& pair : src_dst_pairs) {
+    copy_status = CopyTensorAsync(pair.src, pair.dst, pair.exec_queue_id, pending);
+    if (!copy_status.IsOK()) {
+      break;
+    }
+  }
+
+  // the synchronization debt must be settled even when a member copy failed
+  Status finalize_status = Finalize(pending);
+  ORT_RETURN_IF_ERROR(copy_status);
+  return finalize_status;
+}
 }  // namespace onnxruntime
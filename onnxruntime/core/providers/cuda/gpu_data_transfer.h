@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "cuda_pch.h"
 #include "core/framework/data_transfer.h"
+#include "core/platform/ort_mutex.h"
 
 namespace onnxruntime {
 
@@ -26,14 +30,62 @@ class GPUDataTransfer : public IDataTransfer {
   using IDataTransfer::CopyTensor;
   common::Status CopyTensor(const Tensor& src, Tensor& dst, int exec_queue_id) const override;
 
+  // batched copy: issues every member copy asynchronously and synchronizes once at the end, so
+  // e.g. a multi-tensor feed upload overlaps instead of paying one synchronization per tensor
+  common::Status CopyTensors(const std::vector<SrcDstPair>& src_dst_pairs) const override;
+
   cudaStream_t GetStream(int queue_id) const {
     ORT_ENFORCE(queue_id >= 0 && queue_id < kTotalCudaStreams);
     return streams_[queue_id];
   }
 
  private:
+  // Pooled pinned staging buffer. Copies to/from pageable host memory are staged through these
+  // so the device transfer itself can run asynchronously; buffers are bucketed into
+  // power-of-two size classes and reused once the recorded event shows the transfer drained.
+  struct StagingBuffer {
+    void* ptr = nullptr;
+    size_t size = 0;             // size-class (power of two) capacity, not the bytes in use
+    cudaEvent_t done = nullptr;  // recorded after the last async copy using the buffer
+  };
+
+  // a device-to-pageable copy that still has to wait for its staged transfer before the
+  // staging buffer's contents can be copied out to the caller's destination
+  struct PendingHostCopy {
+    StagingBuffer* buffer = nullptr;
+    void* dst = nullptr;
+    size_t bytes = 0;
+  };
+
+  // synchronization owed by copies issued so far; drained by Finalize
+  struct PendingSync {
+    bool sync_default_stream = false;
+    std::vector<PendingHostCopy> host_copies;
+  };
+
+  common::Status CopyTensorAsync(const Tensor& src, Tensor& dst, int exec_queue_id, PendingSync& pending) const;
+  common::Status Finalize(PendingSync& pending) const;
+
+  // Returns nullptr when bytes exceeds the per-buffer limit or the pool is at capacity with
+  // nothing reusable; callers then fall back to the synchronous pageable path.
+  StagingBuffer* AcquireStagingBuffer(size_t bytes) const;
+  // hand the buffer back for reuse once its event shows the recorded copies drained
+  void ReleaseStagingBufferOnEvent(StagingBuffer* buffer) const;
+  // hand the buffer straight back to the free list (its transfers are known to be complete)
+  void ReleaseStagingBuffer(StagingBuffer* buffer) const;
+
+  static constexpr size_t kMinStagingBufferBytes = 4 * 1024;
+  static constexpr size_t kMaxStagingBufferBytes = 8 * 1024 * 1024;  // larger copies stay on the unstaged path
+  static constexpr size_t kMaxStagingPoolBytes = 64 * 1024 * 1024;
+
   bool do_copy_in_default_stream_;
   cudaStream_t streams_[kTotalCudaStreams];
+
+  mutable OrtMutex staging_mutex_;
+  mutable std::vector<std::unique_ptr<StagingBuffer>> staging_buffers_;  // owns every pooled buffer
+  mutable std::vector<StagingBuffer*> free_staging_buffers_;
+  mutable std::vector<StagingBuffer*> in_flight_staging_buffers_;
+  mutable size_t staging_pool_bytes_ = 0;
 };
 
 }  // namespace onnxruntime
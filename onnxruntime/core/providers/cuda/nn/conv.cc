@@ -1,10 +1,13 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <sstream>
+
 #include "core/providers/cuda/cuda_common.h"
 #include "core/providers/cuda/nn/conv.h"
 #include "core/providers/cuda/shared_inc/fpgeneric.h"
 #include "core/providers/cuda/tensor/slice.h"
+#include "core/providers/cuda/tuning_results_cache.h"
 
 namespace onnxruntime {
 namespace cuda {
@@ -68,6 +71,27 @@ size_t GetMaxWorkspaceSize(const CudnnConvState<cudnnConvolutionFwdAlgoPerf_t>&
   return max_ws_size;
 }
 
+std::string MakeConvTuningParamsKey(const cudaDeviceProp& device_prop, cudnnDataType_t data_type,
+                                    const std::vector<int64_t>& x_dims, const std::vector<int64_t>& w_dims,
+                                    const std::vector<int64_t>& pads, const std::vector<int64_t>& strides,
+                                    const std::vector<int64_t>& dilations, int64_t group) {
+  std::ostringstream key;
+  key << "sm" << device_prop.major << device_prop.minor << "_cudnn" << CUDNN_VERSION
+      << "_t" << data_type << "_g" << group;
+  auto append_dims = [&key](const char* tag, const std::vector<int64_t>& dims) {
+    key << '_' << tag;
+    for (auto dim : dims) {
+      key << 'x' << dim;
+    }
+  };
+  append_dims("x", x_dims);
+  append_dims("w", w_dims);
+  append_dims("p", pads);
+  append_dims("s", strides);
+  append_dims("d", dilations);
+  return key.str();
+}
+
 Status SliceOutUnwantedOutputSection(cudaStream_t stream,
                                      const void* input_data, const std::vector<int64_t>& input_dims,
                                      void* output_data,
@@ -246,50 +270,75 @@ Status Conv<T>::UpdateState(OpKernelContext* context, bool bias_expected) const
       const CUDAExecutionProvider* cuda_ep = static_cast<const CUDAExecutionProvider*>(this->Info().GetExecutionProvider());
       int cudnn_conv_algo = cuda_ep->GetCudnnConvAlgo();
       ORT_ENFORCE(cudnn_conv_algo > -1 && cudnn_conv_algo < 3, "cudnn_conv_algo should be 0, 1 or 2, but got ", cudnn_conv_algo);
-      switch (cudnn_conv_algo) {
-        case 0: {
-          static constexpr int num_algos = CUDNN_CONVOLUTION_FWD_ALGO_COUNT;
-          size_t max_ws_size = cuda_ep->GetCudnnConvUseMaxWorkspace() ? GetMaxWorkspaceSize(s_, kAllAlgos, num_algos)
-                                                                      : AlgoSearchWorkspaceSize;
-          // Use GetTransientScratchBuffer() so the workspace can be freed instead of cached.
-          // Because the benchmarking uses a huge amount of memory, e.g. a few GBs.
-          IAllocatorUniquePtr<void> algo_search_workspace = GetTransientScratchBuffer<void>(max_ws_size);
-          CUDNN_RETURN_IF_ERROR(cudnnFindConvolutionForwardAlgorithmEx(
-              s_.handle,
-              s_.x_tensor,
-              s_.x_data,
-              s_.w_desc,
-              s_.w_data,
-              s_.conv_desc,
-              s_.y_tensor,
-              s_.y_data,
-              1,            // requestedAlgoCount
-              &algo_count,  // returnedAlgoCount
-              &perf,
-              algo_search_workspace.get(),
-              max_ws_size));
-          break;
-        }
-        case 1:
-          CUDNN_RETURN_IF_ERROR(cudnnGetConvolutionForwardAlgorithm_v7(
-              s_.handle,
-              s_.x_tensor,
-              s_.w_desc,
-              s_.conv_desc,
-              s_.y_tensor,
-              1,            // requestedAlgoCount
-              &algo_count,  // returnedAlgoCount
-              &perf));
-          break;
-
-        default:
-          perf.algo = kDefaultConvAlgo;
-          CUDNN_RETURN_IF_ERROR(GetWorkspaceSize(s_, perf.algo, &perf.memory));
-          if (std::is_same<T, MLFloat16>::value) {
-            perf.mathType = CUDNN_TENSOR_OP_MATH;
-          } else {
-            perf.mathType = CUDNN_DEFAULT_MATH;
+
+      // a previously tuned result, possibly persisted by an earlier process, skips the search
+      const std::string tuning_params_key =
+          MakeConvTuningParamsKey(cuda_ep->GetDeviceProp(), CudnnTensor::GetDataType<CudaT>(),
+                                  x_dims_cudnn, w_dims, pads, strides, dilations, conv_attrs_.group);
+      bool tuned = false;
+      std::vector<int64_t> tuning_values;
+      if (TuningResultsCache::Instance().Lookup("ConvFwd", tuning_params_key, tuning_values) &&
+          tuning_values.size() == 2 &&
+          tuning_values[0] >= 0 && tuning_values[0] < CUDNN_CONVOLUTION_FWD_ALGO_COUNT) {
+        perf.algo = static_cast<decltype(perf.algo)>(tuning_values[0]);
+        perf.mathType = static_cast<cudnnMathType_t>(tuning_values[1]);
+        // the workspace size is cheap to recompute and validates the entry against this build
+        tuned = CUDNN_STATUS_SUCCESS == GetWorkspaceSize(s_, perf.algo, &perf.memory);
+      }
+
+      if (!tuned) {
+        switch (cudnn_conv_algo) {
+          case 0: {
+            static constexpr int num_algos = CUDNN_CONVOLUTION_FWD_ALGO_COUNT;
+            size_t max_ws_size = cuda_ep->GetCudnnConvUseMaxWorkspace() ? GetMaxWorkspaceSize(s_, kAllAlgos, num_algos)
+                                                                        : AlgoSearchWorkspaceSize;
+            // Use GetTransientScratchBuffer() so the workspace can be freed instead of cached.
+            // Because the benchmarking uses a huge amount of memory, e.g. a few GBs.
+            IAllocatorUniquePtr<void> algo_search_workspace = GetTransientScratchBuffer<void>(max_ws_size);
+            CUDNN_RETURN_IF_ERROR(cudnnFindConvolutionForwardAlgorithmEx(
+                s_.handle,
+                s_.x_tensor,
+                s_.x_data,
+                s_.w_desc,
+                s_.w_data,
+                s_.conv_desc,
+                s_.y_tensor,
+                s_.y_data,
+                1,            // requestedAlgoCount
+                &algo_count,  // returnedAlgoCount
+                &perf,
+                algo_search_workspace.get(),
+                max_ws_size));
+            break;
           }
+          case 1:
+            CUDNN_RETURN_IF_ERROR(cudnnGetConvolutionForwardAlgorithm_v7(
+                s_.handle,
+                s_.x_tensor,
+                s_.w_desc,
+                s_.conv_desc,
+                s_.y_tensor,
+                1,            // requestedAlgoCount
+                &algo_count,  // returnedAlgoCount
+                &perf));
+            break;
+
+          default:
+            perf.algo = kDefaultConvAlgo;
+            CUDNN_RETURN_IF_ERROR(GetWorkspaceSize(s_, perf.algo, &perf.memory));
+            if (std::is_same<T, MLFloat16>::value) {
+              perf.mathType = CUDNN_TENSOR_OP_MATH;
+            } else {
+              perf.mathType = CUDNN_DEFAULT_MATH;
+            }
+        }
+
+        if (cudnn_conv_algo == 0) {
+          // persist only exhaustively benchmarked results; heuristic and default picks are
+          // cheap to redo and may be deliberately workspace-constrained
+          TuningResultsCache::Instance().Insert("ConvFwd", tuning_params_key,
+                                                {static_cast<int64_t>(perf.algo), static_cast<int64_t>(perf.mathType)});
+        }
       }
       s_.cached_benchmark_results.insert(x_dims_cudnn, {perf.algo, perf.memory, perf.mathType});
     }
@@ -12,6 +12,14 @@
 namespace onnxruntime {
 namespace cuda {
 
+// Key for the persistent TuningResultsCache covering everything a cudnn conv algorithm choice
+// depends on: device arch, cudnn version, data type and the full conv geometry. Shared by the
+// forward and transposed conv kernels; defined in conv.cc.
+std::string MakeConvTuningParamsKey(const cudaDeviceProp& device_prop, cudnnDataType_t data_type,
+                                    const std::vector<int64_t>& x_dims, const std::vector<int64_t>& w_dims,
+                                    const std::vector<int64_t>& pads, const std::vector<int64_t>& strides,
+                                    const std::vector<int64_t>& dilations, int64_t group);
+
 class CudnnConvolutionDescriptor final {
  public:
   CudnnConvolutionDescriptor();
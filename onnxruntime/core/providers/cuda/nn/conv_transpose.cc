@@ -3,6 +3,8 @@
 
 #include "conv_transpose.h"
 
+#include "core/providers/cuda/tuning_results_cache.h"
+
 namespace onnxruntime {
 namespace cuda {
 
@@ -126,28 +128,50 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
       y_data = reinterpret_cast<CudaT*>(p.Y->template MutableData<T>());
 
       if (!s_.cached_benchmark_results.contains(x_dims)) {
-        IAllocatorUniquePtr<void> algo_search_workspace = GetScratchBuffer<void>(AlgoSearchWorkspaceSize);
-
         // set math type to tensor core before algorithm search
         if (std::is_same<T, MLFloat16>::value)
           CUDNN_RETURN_IF_ERROR(cudnnSetConvolutionMathType(s_.conv_desc, CUDNN_TENSOR_OP_MATH));
 
         cudnnConvolutionBwdDataAlgoPerf_t perf;
         int algo_count = 1;
-        CUDNN_RETURN_IF_ERROR(cudnnFindConvolutionBackwardDataAlgorithmEx(
-            CudnnHandle(),
-            s_.w_desc,
-            w_data,
-            s_.x_tensor,
-            x_data,
-            s_.conv_desc,
-            s_.y_tensor,
-            y_data,
-            1,
-            &algo_count,
-            &perf,
-            algo_search_workspace.get(),
-            AlgoSearchWorkspaceSize));
+
+        // a previously tuned result, possibly persisted by an earlier process, skips the search
+        const std::string tuning_params_key =
+            MakeConvTuningParamsKey(GetDeviceProp(), CudnnTensor::GetDataType<CudaT>(),
+                                    x_dims, w_dims, p.pads, p.strides, p.dilations,
+                                    conv_transpose_attrs_.group);
+        bool tuned = false;
+        std::vector<int64_t> tuning_values;
+        if (TuningResultsCache::Instance().Lookup("ConvTransposeBwdData", tuning_params_key, tuning_values) &&
+            tuning_values.size() == 2 &&
+            tuning_values[0] >= 0 && tuning_values[0] < CUDNN_CONVOLUTION_BWD_DATA_ALGO_COUNT) {
+          perf.algo = static_cast<decltype(perf.algo)>(tuning_values[0]);
+          perf.mathType = static_cast<cudnnMathType_t>(tuning_values[1]);
+          // the workspace size is cheap to recompute and validates the entry against this build
+          tuned = CUDNN_STATUS_SUCCESS == cudnnGetConvolutionBackwardDataWorkspaceSize(
+                                              CudnnHandle(), s_.w_desc, s_.x_tensor, s_.conv_desc,
+                                              s_.y_tensor, perf.algo, &perf.memory);
+        }
+
+        if (!tuned) {
+          IAllocatorUniquePtr<void> algo_search_workspace = GetScratchBuffer<void>(AlgoSearchWorkspaceSize);
+          CUDNN_RETURN_IF_ERROR(cudnnFindConvolutionBackwardDataAlgorithmEx(
+              CudnnHandle(),
+              s_.w_desc,
+              w_data,
+              s_.x_tensor,
+              x_data,
+              s_.conv_desc,
+              s_.y_tensor,
+              y_data,
+              1,
+              &algo_count,
+              &perf,
+              algo_search_workspace.get(),
+              AlgoSearchWorkspaceSize));
+          TuningResultsCache::Instance().Insert("ConvTransposeBwdData", tuning_params_key,
+                                                {static_cast<int64_t>(perf.algo), static_cast<int64_t>(perf.mathType)});
+        }
         s_.cached_benchmark_results.insert(x_dims, {perf.algo, perf.memory, perf.mathType});
       }
 
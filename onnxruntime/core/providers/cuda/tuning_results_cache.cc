@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/shared_library/provider_api.h"
+#include "core/providers/cuda/tuning_results_cache.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace onnxruntime {
+namespace cuda {
+
+namespace {
+// bump the version whenever the file layout or the meaning of any operator's values changes
+constexpr const char* kFileHeader = "ORT_CUDA_TUNING_RESULTS_V1";
+}  // namespace
+
+TuningResultsCache& TuningResultsCache::Instance() {
+  static TuningResultsCache instance;
+  return instance;
+}
+
+std::string TuningResultsCache::MakeKey(const std::string& op_signature, const std::string& params_key) {
+  return op_signature + "|" + params_key;
+}
+
+bool TuningResultsCache::Lookup(const std::string& op_signature, const std::string& params_key,
+                                std::vector<int64_t>& values) const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  const auto it = entries_.find(MakeKey(op_signature, params_key));
+  if (it == entries_.end()) {
+    return false;
+  }
+  values = it->second;
+  return true;
+}
+
+void TuningResultsCache::Insert(const std::string& op_signature, const std::string& params_key,
+                                std::vector<int64_t> values) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  entries_[MakeKey(op_signature, params_key)] = std::move(values);
+  if (!path_.empty()) {
+    SaveToFile();
+  }
+}
+
+void TuningResultsCache::SetPersistentPath(const std::string& path) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  path_ = path;
+  LoadFromFile();
+}
+
+void TuningResultsCache::LoadFromFile() {
+  std::ifstream file(path_);
+  if (!file) {
+    // nothing persisted yet; the file is created on the first insert
+    return;
+  }
+
+  std::string line;
+  if (!std::getline(file, line) || line != kFileHeader) {
+    LOGS_DEFAULT(WARNING) << "Ignoring tuning results file with unrecognized header: " << path_;
+    return;
+  }
+
+  size_t num_loaded = 0;
+  while (std::getline(file, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    // each entry is "<key>\t<value>,<value>,..."; keys never contain tabs
+    const size_t separator = line.find('\t');
+    if (separator == std::string::npos) {
+      LOGS_DEFAULT(WARNING) << "Ignoring malformed tuning results entry in " << path_;
+      continue;
+    }
+    std::vector<int64_t> values;
+    std::istringstream values_stream(line.substr(separator + 1));
+    std::string value_str;
+    bool malformed = false;
+    while (std::getline(values_stream, value_str, ',')) {
+      char* end = nullptr;
+      const long long value = strtoll(value_str.c_str(), &end, 10);
+      if (end == value_str.c_str() || *end != '\0') {
+        malformed = true;
+        break;
+      }
+      values.push_back(static_cast<int64_t>(value));
+    }
+    if (malformed || values.empty()) {
+      LOGS_DEFAULT(WARNING) << "Ignoring malformed tuning results entry in " << path_;
+      continue;
+    }
+    entries_[line.substr(0, separator)] = std::move(values);
+    ++num_loaded;
+  }
+
+  LOGS_DEFAULT(INFO) << "Loaded " << num_loaded << " kernel tuning result(s) from " << path_;
+}
+
+void TuningResultsCache::SaveToFile() const {
+  std::ofstream file(path_, std::ios::trunc);
+  if (!file) {
+    LOGS_DEFAULT(WARNING) << "Failed to open tuning results file for writing: " << path_;
+    return;
+  }
+
+  file << kFileHeader << '\n';
+  for (const auto& entry : entries_) {
+    file << entry.first << '\t';
+    for (size_t i = 0; i < entry.second.size(); ++i) {
+      if (i > 0) {
+        file << ',';
+      }
+      file << entry.second[i];
+    }
+    file << '\n';
+  }
+}
+
+}  // namespace cuda
+}  // namespace onnxruntime
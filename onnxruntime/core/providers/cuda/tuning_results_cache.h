@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+namespace cuda {
+
+// Process-wide cache of kernel tuning decisions, e.g. the cudnn conv algorithm picked by an
+// exhaustive search. Entries are keyed by an operator signature plus a parameter key that must
+// encode everything the decision depends on (shapes, data type, device arch, library version);
+// values are small integer tuples whose meaning is private to the operator that wrote them, so
+// readers must validate them before use. When a persistent path is configured the cache is
+// primed from disk once and rewritten as entries are added, so later processes skip the
+// one-time tuning cost entirely.
+class TuningResultsCache {
+ public:
+  static TuningResultsCache& Instance();
+
+  // returns false when no entry exists
+  bool Lookup(const std::string& op_signature, const std::string& params_key,
+              std::vector<int64_t>& values) const;
+  void Insert(const std::string& op_signature, const std::string& params_key,
+              std::vector<int64_t> values);
+
+  // Loads any existing results from path and rewrites the file as entries are added.
+  // Load/save failures are logged and otherwise ignored; the cache then degrades to
+  // in-memory behavior.
+  void SetPersistentPath(const std::string& path);
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(TuningResultsCache);
+
+ private:
+  TuningResultsCache() = default;
+
+  // both require mutex_ to be held
+  void LoadFromFile();
+  void SaveToFile() const;
+
+  static std::string MakeKey(const std::string& op_signature, const std::string& params_key);
+
+  mutable OrtMutex mutex_;
+  std::unordered_map<std::string, std::vector<int64_t>> entries_;
+  std::string path_;
+};
+
+}  // namespace cuda
+}  // namespace onnxruntime
@@ -169,16 +169,31 @@ namespace Dml
 
             if (graphDesc.reuseCommandList)
             {
-                BuildReusableCommandList();
+                BuildReusableCommandLists();
             }
         }
 
         onnxruntime::Status Compute(onnxruntime::OpKernelContext* kernelContext) const override
         {
-            // Only re-use the cached command list if its prior execution is complete on the GPU.
-            // This requirement can be avoided by mantaining ring buffers.
-            if (!m_graphicsCommandList || 
-                (m_fence != nullptr && m_fence->GetCompletedValue() < m_completionValue))
+            // Re-use the first cached command list whose prior execution is complete on the GPU.
+            // The ring of command lists allows a new execution to be submitted while the previous
+            // one is still in flight, rather than falling back to re-recording below.
+            for (size_t i = 0; i < m_reusableCommandLists.size(); ++i)
+            {
+                const size_t index = (m_currentCommandList + i) % m_reusableCommandLists.size();
+                CommandListState& commandListState = m_reusableCommandLists[index];
+
+                if (commandListState.fence == nullptr ||
+                    commandListState.fence->GetCompletedValue() >= commandListState.completionValue)
+                {
+                    ExecuteReusableCommandList(commandListState, kernelContext);
+                    m_currentCommandList = (index + 1) % m_reusableCommandLists.size();
+                    return onnxruntime::Status::OK();
+                }
+            }
+
+            // Command list re-use is disabled for this graph, or every cached command list is
+            // still executing on the GPU.
             {
                 // Wrap tensors as required by Dml::IExecutionProvider::ExecuteOperator
                 OpKernelContextWrapper contextWrapper(
@@ -189,7 +204,7 @@ namespace Dml
 
                 THROW_IF_FAILED(m_provider->AddUAVBarrier());
 
-                // Get input resources for execution, excluding those which were specified as owned by DML and provided 
+                // Get input resources for execution, excluding those which were specified as owned by DML and provided
                 // at initialization instead.
                 std::vector<ComPtr<IMLOperatorTensor>> inputTensors(kernelContext->InputCount());
                 std::vector<ID3D12Resource*> inputPtrs(kernelContext->InputCount());
@@ -219,15 +234,11 @@ namespace Dml
                     contextWrapper.GetOutputTensors(m_outputShapes));
 
                 THROW_IF_FAILED(m_provider->AddUAVBarrier());
-                
+
                 // Queue references to objects which must be kept alive until resulting GPU work completes
                 m_winmlProvider->QueueReference(m_compiledExecutionPlanOperator.Get());
                 m_winmlProvider->QueueReference(m_persistentResourceAllocatorUnk.Get());
             }
-            else
-            {
-                ExecuteReusableCommandList(kernelContext);
-            }
 
             return onnxruntime::Status::OK();
         }
@@ -296,7 +307,26 @@ namespace Dml
             }
 
     private:
-        void BuildReusableCommandList()
+        // A pre-recorded command list for the graph's execution, alongside the descriptor heap
+        // and DML binding table it dispatches with, and the bindings used when it last executed.
+        struct CommandListState
+        {
+            ComPtr<ID3D12GraphicsCommandList> graphicsCommandList;
+            ComPtr<ID3D12DescriptorHeap> heap;
+            ComPtr<IDMLBindingTable> bindingTable;
+
+            // Bindings from previous executions of the command list
+            std::vector<uint64_t> inputBindingAllocIds;
+            std::vector<uint64_t> outputBindingAllocIds;
+            uint64_t tempBindingAllocId = 0;
+
+            // Fence tracking the status of the command list's last execution, and whether its
+            // descriptor heap can safely be updated.
+            ComPtr<ID3D12Fence> fence;
+            uint64_t completionValue = 0;
+        };
+
+        void BuildReusableCommandLists()
         {
             ComPtr<IDMLDevice> device;
             THROW_IF_FAILED(m_provider->GetDmlDevice(device.GetAddressOf()));
@@ -307,55 +337,60 @@ namespace Dml
             desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
             desc.NumDescriptors = execBindingProps.RequiredDescriptorCount;
             desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-            
+
             ComPtr<ID3D12Device> d3dDevice;
             THROW_IF_FAILED(m_provider->GetD3DDevice(d3dDevice.GetAddressOf()));
 
-            THROW_IF_FAILED(d3dDevice->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&m_heap)));
+            ComPtr<IDMLCommandRecorder> recorder;
+            THROW_IF_FAILED(device->CreateCommandRecorder(IID_PPV_ARGS(recorder.GetAddressOf())));
 
-            // Create a binding table for execution.
-            DML_BINDING_TABLE_DESC bindingTableDesc = {};
-            bindingTableDesc.Dispatchable = m_compiledExecutionPlanOperator.Get();
-            bindingTableDesc.CPUDescriptorHandle = m_heap->GetCPUDescriptorHandleForHeapStart();
-            bindingTableDesc.GPUDescriptorHandle = m_heap->GetGPUDescriptorHandleForHeapStart();
-            bindingTableDesc.SizeInDescriptors = execBindingProps.RequiredDescriptorCount;
+            m_reusableCommandLists.resize(ReusableCommandListCount);
 
-            THROW_IF_FAILED(device->CreateBindingTable(&bindingTableDesc, IID_PPV_ARGS(&m_bindingTable)));
+            for (CommandListState& commandListState : m_reusableCommandLists)
+            {
+                THROW_IF_FAILED(d3dDevice->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&commandListState.heap)));
 
-            ComPtr<ID3D12CommandAllocator> allocator;
-            THROW_IF_FAILED(d3dDevice->CreateCommandAllocator(
-                m_provider->GetCommandListTypeForQueue(),
-                IID_PPV_ARGS(&allocator)));
+                // Create a binding table for execution.
+                DML_BINDING_TABLE_DESC bindingTableDesc = {};
+                bindingTableDesc.Dispatchable = m_compiledExecutionPlanOperator.Get();
+                bindingTableDesc.CPUDescriptorHandle = commandListState.heap->GetCPUDescriptorHandleForHeapStart();
+                bindingTableDesc.GPUDescriptorHandle = commandListState.heap->GetGPUDescriptorHandleForHeapStart();
+                bindingTableDesc.SizeInDescriptors = execBindingProps.RequiredDescriptorCount;
 
-            ComPtr<ID3D12CommandList> commandList;
-            THROW_IF_FAILED(d3dDevice->CreateCommandList(
-                0,
-                m_provider->GetCommandListTypeForQueue(),
-                allocator.Get(),
-                nullptr,
-                IID_PPV_ARGS(&commandList)));
-            
-            THROW_IF_FAILED(commandList.As(&m_graphicsCommandList));
+                THROW_IF_FAILED(device->CreateBindingTable(&bindingTableDesc, IID_PPV_ARGS(&commandListState.bindingTable)));
 
-            if (m_persistentResource)
-            {
-                DML_BINDING_DESC persistentResourceBindingDesc =
-                    { DML_BINDING_TYPE_BUFFER, m_persistentResourceBinding ? &*m_persistentResourceBinding : nullptr };
-                m_bindingTable->BindPersistentResource(&persistentResourceBindingDesc);
-            }
+                ComPtr<ID3D12CommandAllocator> allocator;
+                THROW_IF_FAILED(d3dDevice->CreateCommandAllocator(
+                    m_provider->GetCommandListTypeForQueue(),
+                    IID_PPV_ARGS(&allocator)));
 
-            ID3D12DescriptorHeap* descriptorHeaps[] = { m_heap.Get() };
-            m_graphicsCommandList->SetDescriptorHeaps(ARRAYSIZE(descriptorHeaps), descriptorHeaps);
+                ComPtr<ID3D12CommandList> commandList;
+                THROW_IF_FAILED(d3dDevice->CreateCommandList(
+                    0,
+                    m_provider->GetCommandListTypeForQueue(),
+                    allocator.Get(),
+                    nullptr,
+                    IID_PPV_ARGS(&commandList)));
 
-            ComPtr<IDMLCommandRecorder> recorder;
-            THROW_IF_FAILED(device->CreateCommandRecorder(IID_PPV_ARGS(recorder.GetAddressOf())));
+                THROW_IF_FAILED(commandList.As(&commandListState.graphicsCommandList));
 
-            recorder->RecordDispatch(commandList.Get(), m_compiledExecutionPlanOperator.Get(), m_bindingTable.Get());
+                if (m_persistentResource)
+                {
+                    DML_BINDING_DESC persistentResourceBindingDesc =
+                        { DML_BINDING_TYPE_BUFFER, m_persistentResourceBinding ? &*m_persistentResourceBinding : nullptr };
+                    commandListState.bindingTable->BindPersistentResource(&persistentResourceBindingDesc);
+                }
+
+                ID3D12DescriptorHeap* descriptorHeaps[] = { commandListState.heap.Get() };
+                commandListState.graphicsCommandList->SetDescriptorHeaps(ARRAYSIZE(descriptorHeaps), descriptorHeaps);
+
+                recorder->RecordDispatch(commandList.Get(), m_compiledExecutionPlanOperator.Get(), commandListState.bindingTable.Get());
 
-            THROW_IF_FAILED(m_graphicsCommandList->Close());
+                THROW_IF_FAILED(commandListState.graphicsCommandList->Close());
+            }
         }
 
-        void ExecuteReusableCommandList(onnxruntime::OpKernelContext* kernelContext) const
+        void ExecuteReusableCommandList(CommandListState& commandListState, onnxruntime::OpKernelContext* kernelContext) const
         {
             DML_BINDING_PROPERTIES execBindingProps = m_compiledExecutionPlanOperator->GetBindingProperties();
                 
@@ -368,9 +403,9 @@ namespace Dml
                 true,
                 nullptr);
 
-            // Populate input bindings, excluding those which were specified as owned by DML and provided 
+            // Populate input bindings, excluding those which were specified as owned by DML and provided
             // at initialization instead.
-            m_inputBindingAllocIds.resize(inputBindings.size());
+            commandListState.inputBindingAllocIds.resize(inputBindings.size());
             bool inputBindingsChanged = false;
 
             for (uint32_t i = 0; i < inputBindings.size(); ++i)
@@ -389,25 +424,25 @@ namespace Dml
 
                         uint64_t allocId;
                         GraphKernelHelper::UnwrapTensor(m_winmlProvider.Get(), tensor, &inputBindings[i].Buffer, &allocId);
-                        inputBindingsChanged = inputBindingsChanged || (!allocId || m_inputBindingAllocIds[i] != allocId);
+                        inputBindingsChanged = inputBindingsChanged || (!allocId || commandListState.inputBindingAllocIds[i] != allocId);
                         inputBindings[i].Buffer->Release(); // Avoid holding an additional reference
                         inputBindings[i].SizeInBytes = GraphKernelHelper::AlignToPow2<size_t>(tensor->SizeInBytes(), 4);
                         inputBindingDescs[i] = {DML_BINDING_TYPE_BUFFER, &inputBindings[i]};
-                        m_inputBindingAllocIds[i] = allocId;
+                        commandListState.inputBindingAllocIds[i] = allocId;
                     }
                 }
             }
                 
             if (inputBindingsChanged)
             {
-                m_bindingTable->BindInputs(gsl::narrow_cast<uint32_t>(inputBindingDescs.size()), inputBindingDescs.data());
+                commandListState.bindingTable->BindInputs(gsl::narrow_cast<uint32_t>(inputBindingDescs.size()), inputBindingDescs.data());
             }
 
             // Populate Output bindings
             std::vector<DML_BUFFER_BINDING> outputBindings(kernelContext->OutputCount());
             std::vector<DML_BINDING_DESC> outputBindingDescs(kernelContext->OutputCount());
 
-            m_outputBindingAllocIds.resize(outputBindings.size());
+            commandListState.outputBindingAllocIds.resize(outputBindings.size());
             bool outputBindingsChanged = false;
             
             for (uint32_t i = 0; i < outputBindings.size(); ++i)
@@ -426,16 +461,16 @@ namespace Dml
 
                 uint64_t allocId;
                 GraphKernelHelper::UnwrapTensor(m_winmlProvider.Get(), tensor, &outputBindings[i].Buffer, &allocId);
-                outputBindingsChanged = outputBindingsChanged || (!allocId || m_outputBindingAllocIds[i] != allocId);
+                outputBindingsChanged = outputBindingsChanged || (!allocId || commandListState.outputBindingAllocIds[i] != allocId);
                 outputBindings[i].Buffer->Release(); // Avoid holding an additional reference
                 outputBindings[i].SizeInBytes = GraphKernelHelper::AlignToPow2<size_t>(tensor->SizeInBytes(), 4);
                 outputBindingDescs[i] = {DML_BINDING_TYPE_BUFFER, &outputBindings[i]};
-                m_outputBindingAllocIds[i] = allocId;
+                commandListState.outputBindingAllocIds[i] = allocId;
             }
 
             if (outputBindingsChanged)
             {
-                m_bindingTable->BindOutputs(gsl::narrow_cast<uint32_t>(outputBindingDescs.size()), outputBindingDescs.data());
+                commandListState.bindingTable->BindOutputs(gsl::narrow_cast<uint32_t>(outputBindingDescs.size()), outputBindingDescs.data());
             }
 
             if (execBindingProps.TemporaryResourceSize > 0)
@@ -455,26 +490,26 @@ namespace Dml
                 DML_BUFFER_BINDING tempBufferBinding = {tempResource.Get(), 0, execBindingProps.TemporaryResourceSize};
                 DML_BINDING_DESC tempBindingDesc = { DML_BINDING_TYPE_BUFFER, &tempBufferBinding };
 
-                if (!tempAllocId || m_tempBindingAllocId != tempAllocId)
+                if (!tempAllocId || commandListState.tempBindingAllocId != tempAllocId)
                 {
-                    m_bindingTable->BindTemporaryResource(&tempBindingDesc);
+                    commandListState.bindingTable->BindTemporaryResource(&tempBindingDesc);
                 }
-            
-                m_tempBindingAllocId = tempAllocId;
+
+                commandListState.tempBindingAllocId = tempAllocId;
             }
 
             // Execute the command list and if it succeeds, update the fence value at which this command may be
             // re-used.
             ComPtr<ID3D12Fence> fence;
             uint64_t completionValue;
-            THROW_IF_FAILED(m_provider->ExecuteCommandList(m_graphicsCommandList.Get(), fence.GetAddressOf(), &completionValue));
-            m_fence = fence;
-            m_completionValue = completionValue;
+            THROW_IF_FAILED(m_provider->ExecuteCommandList(commandListState.graphicsCommandList.Get(), fence.GetAddressOf(), &completionValue));
+            commandListState.fence = fence;
+            commandListState.completionValue = completionValue;
 
             // Queue references to objects which must be kept alive until resulting GPU work completes
-            m_winmlProvider->QueueReference(m_graphicsCommandList.Get());
-            m_winmlProvider->QueueReference(m_heap.Get());
-            m_winmlProvider->QueueReference(m_bindingTable.Get());
+            m_winmlProvider->QueueReference(commandListState.graphicsCommandList.Get());
+            m_winmlProvider->QueueReference(commandListState.heap.Get());
+            m_winmlProvider->QueueReference(commandListState.bindingTable.Get());
             m_winmlProvider->QueueReference(m_persistentResourceAllocatorUnk.Get());
         }
 
@@ -485,23 +520,16 @@ namespace Dml
         ComPtr<Dml::IExecutionProvider> m_provider;
         EdgeShapes m_outputShapes;
 
-        // Re-usable command list, supporting descriptor heap, and DML binding table to update that heap.
-        ComPtr<ID3D12GraphicsCommandList> m_graphicsCommandList;
-        ComPtr<ID3D12DescriptorHeap> m_heap;
-        ComPtr<IDMLBindingTable> m_bindingTable;
+        // Ring of re-usable command lists, empty when command list re-use is disabled for the
+        // graph.  The ring depth matches that of the command allocator ring, allowing as many
+        // executions to be in flight on the GPU at once.
+        static constexpr size_t ReusableCommandListCount = 2;
+        mutable std::vector<CommandListState> m_reusableCommandLists;
+        mutable size_t m_currentCommandList = 0;
+
         std::optional<DML_BUFFER_BINDING> m_persistentResourceBinding;
         ComPtr<ID3D12Resource> m_persistentResource;
         ComPtr<IUnknown> m_persistentResourceAllocatorUnk; // Controls when the persistent resource is returned to the allocator
-        
-        // Bindings from previous executions of a re-used command list
-        mutable std::vector<uint64_t> m_inputBindingAllocIds;
-        mutable std::vector<uint64_t> m_outputBindingAllocIds;
-        mutable uint64_t m_tempBindingAllocId = 0;
-
-        // Fence tracking the status of the command list's last execution, and whether its descriptor heap 
-        // can safely be updated.
-        mutable ComPtr<ID3D12Fence> m_fence;
-        mutable uint64_t m_completionValue = 0;
 
         std::vector<uint8_t> m_inputsConstant;
         std::vector<ComPtr<ID3D12Resource>> m_nonOwnedGraphInputsFromInitializers;
@@ -11,7 +11,7 @@ namespace ort_dnnl {
 
 DnnlConv::DnnlConv() {}
 
-void DnnlConv::CreatePrimitive(DnnlSubgraphPrimitive& sp, DnnlNode& node) {
+void DnnlConv::CreatePrimitive(DnnlSubgraphPrimitive& sp, DnnlNode& node, DnnlNode* fused_relu) {
   auto dnnl_engine = sp.GetEngine();
 
   auto conv_src_mem = sp.GetMemory(node.Input(IN_X).Name());
@@ -88,19 +88,27 @@ void DnnlConv::CreatePrimitive(DnnlSubgraphPrimitive& sp, DnnlNode& node) {
   auto prop_kind = dnnl::prop_kind::forward_inference;
 #endif  // ENABLE_TRAINING
 
+  // Run a fused activation as part of the convolution kernel instead of as its own primitive
+  dnnl::primitive_attr conv_attr;
+  if (fused_relu != nullptr) {
+    dnnl::post_ops ops;
+    ops.append_eltwise(1.0f, dnnl::algorithm::eltwise_relu, 0.0f, 0.0f);
+    conv_attr.set_post_ops(ops);
+  }
+
   dnnl::convolution_forward::primitive_desc conv_pd;
   if (bias_exists) {
     auto conv_desc = dnnl::convolution_forward::desc(
             prop_kind, dnnl::algorithm::convolution_direct,
             src_md, weight_md, bias_md, dst_md,
             strides, dilations, padding_left, padding_right);
-    conv_pd = dnnl::convolution_forward::primitive_desc(conv_desc, dnnl_engine);
+    conv_pd = dnnl::convolution_forward::primitive_desc(conv_desc, conv_attr, dnnl_engine);
   } else {
     auto conv_desc = dnnl::convolution_forward::desc(
             prop_kind, dnnl::algorithm::convolution_direct,
             src_md, weight_md, dst_md,
             strides, dilations, padding_left, padding_right);
-    conv_pd = dnnl::convolution_forward::primitive_desc(conv_desc, dnnl_engine);
+    conv_pd = dnnl::convolution_forward::primitive_desc(conv_desc, conv_attr, dnnl_engine);
   }
 
   // If using GPU this will move the memory from the CPU to the GPU.
@@ -124,7 +132,11 @@ void DnnlConv::CreatePrimitive(DnnlSubgraphPrimitive& sp, DnnlNode& node) {
                               {DNNL_ARG_DST, conv_dst_mem}});
   }
 
-  sp.SetMemory(node.Output(OUT_Y), conv_dst_mem);
+  if (fused_relu != nullptr) {
+    sp.SetMemory(fused_relu->Output(0), conv_dst_mem);
+  } else {
+    sp.SetMemory(node.Output(OUT_Y), conv_dst_mem);
+  }
 }
 
 std::vector<int64_t> DnnlConv::GetInferedPads(DnnlNode& node,
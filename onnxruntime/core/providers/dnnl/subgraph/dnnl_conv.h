@@ -28,7 +28,12 @@ class DnnlConv {
   };
 
   DnnlConv();
-  void CreatePrimitive(DnnlSubgraphPrimitive& sp, DnnlNode& node);
+  /*
+  * Create the convolution primitive. If fused_relu is non null the Relu node consuming the
+  * convolution output is run as an eltwise post op of the convolution and its output is
+  * produced by this primitive directly; no separate Relu primitive is created.
+  */
+  void CreatePrimitive(DnnlSubgraphPrimitive& sp, DnnlNode& node, DnnlNode* fused_relu = nullptr);
 
  private:
   /*
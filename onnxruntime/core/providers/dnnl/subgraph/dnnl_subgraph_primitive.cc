@@ -41,13 +41,51 @@ void DnnlSubgraphPrimitive::AddKernels() {
   std::unordered_set<std::string> binary_ops = {"Add", "Div", "Mul", "Sub"};
   std::unordered_set<std::string> elementwise_ops = {"Abs", "Elu", "Exp","Log", "Relu", "Round", "Sigmoid", "Softplus", "Sqrt", "Tanh"};
   std::unordered_set<std::string> pool_ops = {"AveragePool", "GlobalAveragePool", "GlobalMaxPool", "MaxPool"};
-  for (auto& node : subgraph_->GetDnnlNodes()) {
+
+  auto dnnl_nodes = subgraph_->GetDnnlNodes();
+
+#if !defined(ENABLE_TRAINING)
+  //map each tensor to its consumer nodes and collect the subgraph outputs, to find
+  //activations that can run as a post op of their producer instead of as own primitive
+  std::unordered_map<std::string, std::vector<size_t>> consumers;
+  for (size_t i = 0; i < dnnl_nodes.size(); ++i) {
+    for (size_t j = 0; j < dnnl_nodes[i].InputCount(); ++j) {
+      if (dnnl_nodes[i].Input(static_cast<int>(j)).Exists()) {
+        consumers[dnnl_nodes[i].Input(static_cast<int>(j)).Name()].push_back(i);
+      }
+    }
+  }
+  std::unordered_set<std::string> graph_outputs;
+  for (auto& tensor : subgraph_->GetDnnlOutputs()) {
+    graph_outputs.insert(tensor.Name());
+  }
+#endif  // !defined(ENABLE_TRAINING)
+
+  std::unordered_set<size_t> fused_nodes;
+  for (size_t node_index = 0; node_index < dnnl_nodes.size(); ++node_index) {
+    if (fused_nodes.count(node_index)) {
+      continue;
+    }
+    auto& node = dnnl_nodes[node_index];
     if (node.OpType() == "BatchNormalization") {
       DnnlBatchNorm().CreatePrimitive(*this, node);
     } else if (binary_ops.count(node.OpType())) {
       DnnlBinary().CreatePrimitive(*this, node);
     } else if (node.OpType() == "Conv") {
-      DnnlConv().CreatePrimitive(*this, node);
+      //fuse a Relu that is the only consumer of the conv output into the conv primitive
+      //as an eltwise post op, so the activation runs while the tile is still in registers
+      DnnlNode* fused_relu = nullptr;
+#if !defined(ENABLE_TRAINING)
+      auto conv_output_name = node.Output(0).Name();
+      auto consumer_it = consumers.find(conv_output_name);
+      if (!graph_outputs.count(conv_output_name) &&
+          consumer_it != consumers.end() && consumer_it->second.size() == 1 &&
+          dnnl_nodes[consumer_it->second[0]].OpType() == "Relu") {
+        fused_relu = &dnnl_nodes[consumer_it->second[0]];
+        fused_nodes.insert(consumer_it->second[0]);
+      }
+#endif  // !defined(ENABLE_TRAINING)
+      DnnlConv().CreatePrimitive(*this, node, fused_relu);
     } else if (elementwise_ops.count(node.OpType())) {
       DnnlElementwise().CreatePrimitive(*this, node);
     } else if (node.OpType() == "Gemm") {
@@ -89,6 +127,11 @@ DnnlSubgraphPrimitive::DnnlSubgraphPrimitive(ort_dnnl::DnnlSubgraph& dnnl_subgra
   if (dnnl_engine_get_count(dnnl_engine_kind_t::dnnl_gpu)) {
     gpu_engine_ = dnnl::engine(dnnl::engine::kind::gpu, 0);
   }
+
+  const std::string primitive_cache_capacity_env = onnxruntime::GetEnvironmentVar("ORT_DNNL_PRIMITIVE_CACHE_CAPACITY");
+  if (!primitive_cache_capacity_env.empty()) {
+    compiled_state_capacity_ = std::stoul(primitive_cache_capacity_env);
+  }
 }
 
 bool DnnlSubgraphPrimitive::IsDynamic() {
@@ -113,7 +156,16 @@ void DnnlSubgraphPrimitive::Compile(const std::unordered_map<std::string, OnnxTe
   }
   // if key different from shape key, update and recompile
   if (key != shape_key_) {
+    // keep the current compiled state around and reuse a cached one if this shape was
+    // already compiled, so alternating shapes don't recreate their primitives every run
+    if (!shape_key_.empty()) {
+      SaveCompiledState(shape_key_);
+    }
     shape_key_ = key;
+    if (RestoreCompiledState(key)) {
+      LOGS_DEFAULT(INFO) << "Cached Compile";
+      return;
+    }
   } else {
     return;
   }
@@ -154,6 +206,46 @@ void DnnlSubgraphPrimitive::Compile(const std::unordered_map<std::string, OnnxTe
   AddOutputs();
 }
 
+void DnnlSubgraphPrimitive::SaveCompiledState(const std::string& key) {
+  if (compiled_state_capacity_ == 0) {
+    return;
+  }
+
+  CompiledState state;
+  state.intermediates = std::move(intermediates_);
+  state.inputs = std::move(inputs_);
+  state.inputs_md = std::move(inputs_md_);
+  state.outputs = std::move(outputs_);
+  state.outputs_md = std::move(outputs_md_);
+  state.net = std::move(net_);
+  state.net_args = std::move(net_args_);
+  state.reshapes = std::move(reshapes_);
+  compiled_states_.emplace_front(key, std::move(state));
+
+  if (compiled_states_.size() > compiled_state_capacity_) {
+    compiled_states_.pop_back();
+  }
+}
+
+bool DnnlSubgraphPrimitive::RestoreCompiledState(const std::string& key) {
+  for (auto it = compiled_states_.begin(); it != compiled_states_.end(); ++it) {
+    if (it->first == key) {
+      auto& state = it->second;
+      intermediates_ = std::move(state.intermediates);
+      inputs_ = std::move(state.inputs);
+      inputs_md_ = std::move(state.inputs_md);
+      outputs_ = std::move(state.outputs);
+      outputs_md_ = std::move(state.outputs_md);
+      net_ = std::move(state.net);
+      net_args_ = std::move(state.net_args);
+      reshapes_ = std::move(state.reshapes);
+      compiled_states_.erase(it);
+      return true;
+    }
+  }
+  return false;
+}
+
 dnnl::memory::format_tag DnnlSubgraphPrimitive::GetDnnlFormat(size_t dim_size) {
   dnnl::memory::format_tag source_format = dnnl::memory::format_tag::any;
   switch (dim_size) {
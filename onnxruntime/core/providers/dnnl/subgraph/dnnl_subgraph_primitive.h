@@ -2,6 +2,8 @@
 // Licensed under the MIT License
 
 #pragma once
+#include <list>
+
 #include "dnnl_subgraph.h"
 #include "dnnl.hpp"
 #include "core/platform/ort_mutex.h"
@@ -30,6 +32,9 @@ class DnnlSubgraphPrimitive {
   void AddInitializers();
   void AddOutputs();
   void AddKernels();
+  //save the current compiled state to the shape keyed LRU cache / restore one from it
+  void SaveCompiledState(const std::string& key);
+  bool RestoreCompiledState(const std::string& key);
 
   //run inference
   onnxruntime::common::Status Predict(const std::unordered_map<std::string, OnnxTensorData>& inputs, const std::unordered_map<std::string, OnnxTensorData>& outputs);
@@ -65,6 +70,25 @@ class DnnlSubgraphPrimitive {
  private:
   std::string shape_key_;
 
+  //compiled state for one input shape combination. Predict sets the data handles of the
+  //input/output/reshape memories on every run, so the state is independent of the buffers
+  //it was compiled with and alternating dynamic shapes can reuse it instead of recreating
+  //all primitives.
+  struct CompiledState {
+    std::unordered_map<std::string, std::vector<dnnl::memory>> intermediates;
+    std::unordered_map<std::string, dnnl::memory> inputs;
+    std::unordered_map<std::string, dnnl::memory::desc> inputs_md;
+    std::unordered_map<std::string, dnnl::memory> outputs;
+    std::unordered_map<std::string, dnnl::memory::desc> outputs_md;
+    std::vector<dnnl::primitive> net;
+    std::vector<std::unordered_map<int, dnnl::memory>> net_args;
+    std::vector<std::pair<dnnl::memory, dnnl::memory>> reshapes;
+  };
+
+  //LRU cache of compiled states of shapes other than the current one, most recent in front
+  std::list<std::pair<std::string, CompiledState>> compiled_states_;
+  size_t compiled_state_capacity_ = 16;
+
   std::unordered_map<std::string, std::vector<dnnl::memory>> intermediates_;
 
   std::unordered_map<std::string, dnnl::memory> inputs_;
@@ -21,6 +21,10 @@ namespace nnapi {
 Model::Model() : nnapi_(NnApiImplementation()) {}
 
 Model::~Model() {
+  // The burst must not outlive the compilation it was created from
+  if (burst_) {
+    nnapi_->ANeuralNetworksBurst_free(burst_);
+  }
   nnapi_->ANeuralNetworksCompilation_free(compilation_);
   nnapi_->ANeuralNetworksModel_free(model_);
 }
@@ -95,11 +99,25 @@ Status Model::PrepareForExecution(std::unique_ptr<Execution>& execution) {
   ORT_RETURN_IF_NOT(nullptr != compilation_,
                     "Error in PrepareForExecution, compilation_ is null");
 
+  // Reuse one burst object for all executions of this model so the driver can keep its
+  // execution resources alive between inferences instead of re-acquiring them every Run
+  // Burst compute is only allowed from one execution at a time, which is guaranteed here
+  // since the caller holds the model mutex for the whole Predict
+  // The burst functions are loaded optionally and are null below Android API level 29
+  if (nullptr == burst_ &&
+      GetNNAPIFeatureLevel() >= ANEURALNETWORKS_FEATURE_LEVEL_3 &&
+      nullptr != nnapi_->ANeuralNetworksBurst_create) {
+    if (nnapi_->ANeuralNetworksBurst_create(compilation_, &burst_) != ANEURALNETWORKS_NO_ERROR) {
+      LOGS_DEFAULT(WARNING) << "Error creating NNAPI burst object, falling back to plain executions";
+      burst_ = nullptr;
+    }
+  }
+
   ANeuralNetworksExecution* nnapi_execution;
   RETURN_STATUS_ON_ERROR(
       nnapi_->ANeuralNetworksExecution_create(compilation_, &nnapi_execution));
 
-  execution.reset(new Execution(*nnapi_execution, shaper_));
+  execution.reset(new Execution(*nnapi_execution, shaper_, burst_));
   return Status::OK();
 }
 
@@ -146,9 +164,10 @@ Model::NNMemory::NNMemory(const NnApi* /*nnapi*/, const char* name, size_t size)
 
 #pragma region Execution
 
-Execution::Execution(ANeuralNetworksExecution& execution, const Shaper& shaper)
+Execution::Execution(ANeuralNetworksExecution& execution, const Shaper& shaper, ANeuralNetworksBurst* burst)
     : nnapi_(NnApiImplementation()),
       execution_(&execution),
+      burst_(burst),
       shaper_(shaper) {
 }
 
@@ -193,10 +212,16 @@ Status Execution::SetOutputBuffer(const int32_t index, const OutputBuffer& outpu
 }
 
 Status Execution::Predict(const std::vector<int32_t>& dynamic_outputs, std::vector<Shaper::Shape>& dynamic_output_shapes) {
-  ANeuralNetworksEvent* event = nullptr;
-  RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksExecution_startCompute(execution_, &event));
-  RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksEvent_wait(event));
-  nnapi_->ANeuralNetworksEvent_free(event);
+  if (burst_ != nullptr) {
+    // Synchronous compute on the burst, the driver reuses the resources it cached on the
+    // burst during previous inferences of this compilation
+    RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksExecution_burstCompute(execution_, burst_));
+  } else {
+    ANeuralNetworksEvent* event = nullptr;
+    RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksExecution_startCompute(execution_, &event));
+    RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksEvent_wait(event));
+    nnapi_->ANeuralNetworksEvent_free(event);
+  }
 
   dynamic_output_shapes.clear();
   dynamic_output_shapes.reserve(dynamic_outputs.size());
@@ -111,6 +111,11 @@ class Model {
   ANeuralNetworksModel* model_{nullptr};
   ANeuralNetworksCompilation* compilation_{nullptr};
 
+  // Burst object shared by all executions of this model (API level 29+)
+  // Lets the NNAPI driver keep its execution resources alive across inferences
+  // Created lazily on the first PrepareForExecution, nullptr if burst is unsupported
+  ANeuralNetworksBurst* burst_{nullptr};
+
   size_t dynamic_output_buffer_size_{1024};
 
   std::unique_ptr<NNMemory> mem_initializers_;
@@ -163,7 +168,9 @@ class Execution {
   };
 
  public:
-  explicit Execution(ANeuralNetworksExecution& execution, const Shaper& shaper);
+  // If burst is not null the execution will be computed on it, the burst is owned by the
+  // Model and must stay valid for the lifetime of this object
+  explicit Execution(ANeuralNetworksExecution& execution, const Shaper& shaper, ANeuralNetworksBurst* burst);
   ~Execution();
   Execution(const Execution&) = delete;
   Execution& operator=(const Execution&) = delete;
@@ -186,6 +193,7 @@ class Execution {
 
   const NnApi* nnapi_{nullptr};
   ANeuralNetworksExecution* execution_;
+  ANeuralNetworksBurst* burst_{nullptr};
   Shaper shaper_;
 };
 
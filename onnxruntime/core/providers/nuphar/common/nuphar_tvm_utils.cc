@@ -163,7 +163,31 @@ static bool VerifyTVMModuleChecksum(const std::string& so_path) {
   }
 }
 
-CacheStatus LoadTVMPackedFuncFromCache(const std::string& func_name, tvm::runtime::PackedFunc& func) {
+static bool VerifyCodeGenTarget(const std::string& so_path, const std::string& target_name) {
+  if (target_name.empty())
+    return true;
+
+  void* f = GetFuncFromLibrary(so_path, "_ORTInternal_GetCodeGenTarget", /*throw_if_not_found*/ false);
+  if (f == nullptr) {
+    // caches created before the target was recorded are accepted as-is
+    return true;
+  }
+
+  typedef const char* (*GetCodeGenTargetFunc)();
+  GetCodeGenTargetFunc func = reinterpret_cast<GetCodeGenTargetFunc>(f);
+  const char* cache_target = func();
+  ORT_ENFORCE(cache_target, "Null codegen target string!");
+  if (target_name != cache_target) {
+    LOGS_DEFAULT(CODEGEN_SETTINGS_LOG_LEVEL) << "Cached dll was built for codegen target (" << cache_target
+                                             << ") which doesn't match current target (" << target_name
+                                             << "), using JIT...";
+    return false;
+  }
+  return true;
+}
+
+CacheStatus LoadTVMPackedFuncFromCache(const std::string& func_name, tvm::runtime::PackedFunc& func,
+                                       const std::string& target_name) {
   std::string so_path;
   if (!GetCacheSoFilePath(so_path)) {
     if (codegen::CodeGenSettings::Instance().HasOption(kNupharCachePath)) {
@@ -180,6 +204,9 @@ CacheStatus LoadTVMPackedFuncFromCache(const std::string& func_name, tvm::runtim
   if (!VerifyTVMModuleChecksum(so_path))
     return CacheStatus::Mismatch;
 
+  if (!VerifyCodeGenTarget(so_path, target_name))
+    return CacheStatus::Mismatch;
+
   tvm::runtime::Module module = tvm::runtime::Module::LoadFromFile(so_path);
   func = module.GetFunction(func_name);
   if (func == nullptr) {
@@ -189,12 +216,23 @@ CacheStatus LoadTVMPackedFuncFromCache(const std::string& func_name, tvm::runtim
   return CacheStatus::Found;
 }
 
-void SaveTVMModuleToCache(const std::string& filename, tvm::runtime::Module& module) {
+void SaveTVMModuleToCache(const std::string& filename, tvm::runtime::Module& module,
+                          const std::string& target_name) {
   fs::path path;
 
   static std::mutex save_cache_mutex;
   std::lock_guard<std::mutex> lock(save_cache_mutex);
   if (GetOrCreateTVMModuleCacheDirectory(path, /*create*/ true)) {
+    // record the codegen target so create_shared.py can embed it in the dll for load-time validation
+    if (!target_name.empty()) {
+      fs::path target_path = path;
+      target_path.append("NUPHAR_CODEGEN_TARGET");
+      if (!fs::exists(target_path)) {
+        std::ofstream target_file(target_path.string());
+        target_file << target_name;
+      }
+    }
+
     path.append(filename + ".o");
     if (fs::exists(path)) {
       //LOGS_DEFAULT(CODEGEN_SETTINGS_LOG_LEVEL) << "Object file " << path << " already exists, skip saving...";
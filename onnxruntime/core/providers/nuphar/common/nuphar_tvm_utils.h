@@ -27,8 +27,12 @@ enum class CacheStatus {
   Found,
 };
 
-CacheStatus LoadTVMPackedFuncFromCache(const std::string& func_name, tvm::runtime::PackedFunc& func);
-void SaveTVMModuleToCache(const std::string& filename, tvm::runtime::Module& module);
+// target_name, when non-empty, is validated against the codegen target recorded in the cached dll
+// so that a cache built for another ISA is rejected instead of silently missing every function.
+CacheStatus LoadTVMPackedFuncFromCache(const std::string& func_name, tvm::runtime::PackedFunc& func,
+                                       const std::string& target_name = "");
+void SaveTVMModuleToCache(const std::string& filename, tvm::runtime::Module& module,
+                          const std::string& target_name = "");
 
 std::string GetPackedFuncName(const nuphar::NupharSubgraphUnit& subgraph, const CodeGenTarget& codegen_target, int64_t parallel_min_workloads);
 
@@ -50,6 +50,26 @@ def gen_cache_version(input_dir):
         print('    return __NUPHAR_CACHE_VERSION__;', file=cache_version_cc)
         print('}', file=cache_version_cc)
 
+def gen_codegen_target(input_dir):
+    # the runtime records its codegen target when saving obj files;
+    # embed it into the shared lib so the loader can reject a cache built for another ISA
+    target_file = os.path.join(input_dir, 'NUPHAR_CODEGEN_TARGET')
+    if not os.path.exists(target_file):
+        return
+
+    with open(target_file, 'r') as f:
+        target_name = f.read().strip()
+
+    name = 'ORTInternal_codegen_target'
+    with open(os.path.join(input_dir, name + '.cc'), 'w') as codegen_target_cc:
+        print('static const char codegen_target[] = "' + target_name + '";', file=codegen_target_cc)
+        print('extern "C"', file=codegen_target_cc)
+        if is_windows():
+            print('__declspec(dllexport)', file=codegen_target_cc)
+        print('const char* _ORTInternal_GetCodeGenTarget() {', file=codegen_target_cc)
+        print('    return codegen_target;', file=codegen_target_cc)
+        print('}', file=codegen_target_cc)
+
 def compile_all_cc(path):
     for f in os.listdir(path):
         name, ext = os.path.splitext(f)
@@ -78,6 +98,7 @@ if __name__ == '__main__':
         gen_checksum(input_checksum, args.input_dir)
 
     gen_cache_version(args.input_dir)
+    gen_codegen_target(args.input_dir)
 
     if is_windows():
         # create dllmain
@@ -100,6 +100,20 @@ void CreateDirectory(const std::string& ov_compiled_blobs_dir) {
 #endif
 }
 
+std::string GetModelHash(const ONNX_NAMESPACE::ModelProto& model_proto) {
+  // FNV-1a over the serialized proto. The hash is part of the compiled blob file name,
+  // so a model edited in place no longer picks up the stale blob of its previous contents.
+  const std::string serialized = model_proto.SerializeAsString();
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char c : serialized) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 0x100000001b3ULL;
+  }
+  std::ostringstream model_hash;
+  model_hash << std::hex << std::setfill('0') << std::setw(16) << hash;
+  return model_hash.str();
+}
+
 struct static_cast_int64 {
   template <typename T1>  // T1 models type statically convertible to T
   int64_t operator()(const T1& x) const { return static_cast<int64_t>(x); }
@@ -40,6 +40,10 @@ bool IsDirExists(const std::string& pathname);
 
 void CreateDirectory(const std::string& ov_compiled_blobs_dir);
 
+//Hash of the serialized model contents, used to key compiled blob files so a
+//blob is only imported for the exact model it was exported from.
+std::string GetModelHash(const ONNX_NAMESPACE::ModelProto& model_proto);
+
 void SetIODefs(const ONNX_NAMESPACE::ModelProto& model_proto,
                std::shared_ptr<InferenceEngine::CNNNetwork> network,
                std::unordered_map<std::string, int> output_names,
@@ -128,14 +128,32 @@ ROCMExecutionProvider::PerThreadContext::~PerThreadContext() {
   }
 }
 
+// Device properties never change for the lifetime of the process, but querying them requires the
+// device to be idle (hence the synchronize below), which makes them expensive to fetch in every
+// session's provider constructor. Cache them per device so only the first session per device pays.
+static const hipDeviceProp_t& GetCachedDeviceProp(OrtDevice::DeviceId device_id) {
+  static OrtMutex mutex;
+  static std::unordered_map<OrtDevice::DeviceId, hipDeviceProp_t> cached_device_props;
+
+  std::lock_guard<OrtMutex> lock(mutex);
+  auto it = cached_device_props.find(device_id);
+  if (it == cached_device_props.end()) {
+    // must wait GPU idle, otherwise hipGetDeviceProperties might fail
+    HIP_CALL_THROW(hipDeviceSynchronize());
+    hipDeviceProp_t prop;
+    HIP_CALL_THROW(hipGetDeviceProperties(&prop, device_id));
+    it = cached_device_props.emplace(device_id, prop).first;
+  }
+
+  return it->second;
+}
+
 ROCMExecutionProvider::ROCMExecutionProvider(const ROCMExecutionProviderInfo& info)
     : IExecutionProvider{onnxruntime::kRocmExecutionProvider},
       info_{info} {
   HIP_CALL_THROW(hipSetDevice(info_.device_id));
 
-  // must wait GPU idle, otherwise hipGetDeviceProperties might fail
-  HIP_CALL_THROW(hipDeviceSynchronize());
-  HIP_CALL_THROW(hipGetDeviceProperties(&device_prop_, info_.device_id));
+  device_prop_ = GetCachedDeviceProp(info_.device_id);
 
   if (info.has_user_compute_stream) {
     external_stream_ = true;
@@ -150,6 +168,11 @@ ROCMExecutionProvider::ROCMExecutionProvider(const ROCMExecutionProviderInfo& in
   size_t free = 0;
   size_t total = 0;
   HIP_CALL_THROW(hipMemGetInfo(&free, &total));
+
+  if (info.enable_hip_graph) {
+    ORT_ENFORCE(stream_ != nullptr, "HIP graph capture requires a compute stream.");
+    hip_graph_.SetStream(stream_);
+  }
 }
 
 ROCMExecutionProvider::~ROCMExecutionProvider() {
@@ -303,10 +326,29 @@ Status ROCMExecutionProvider::OnRunStart() {
   auto& current_deferred_release_event = GetPerThreadContext().GetCurrentDeferredReleaseEvent();
   HIP_RETURN_IF_ERROR(hipEventCreate(&current_deferred_release_event));
   deferred_release_cpu_ptr_.emplace(current_deferred_release_event, DeferredReleaseCPUPtrs());
+
+  if (IsGraphCaptureEnabled() && !is_graph_captured_ && IsGraphCaptureAllowed()) {
+    LOGS_DEFAULT(INFO) << "Capturing the model into a HIP graph on this run.";
+    hip_graph_.CaptureBegin();
+    graph_capture_in_progress_ = true;
+  }
+
   return Status::OK();
 }
 
 Status ROCMExecutionProvider::OnRunEnd() {
+  if (graph_capture_in_progress_) {
+    // capture must end before any synchronization below, which is illegal on a capturing stream
+    hip_graph_.CaptureEnd();
+    graph_capture_in_progress_ = false;
+    is_graph_captured_ = true;
+    // work submitted to a capturing stream is recorded rather than executed, so replay the graph
+    // once here to produce this run's results.
+    ORT_RETURN_IF_ERROR(ReplayGraph());
+  } else if (IsGraphCaptureEnabled() && !is_graph_captured_) {
+    ++regular_run_count_before_graph_capture_;
+  }
+
   // record deferred release event on default stream, and release per_thread_context
   auto current_deferred_release_event = GetPerThreadContext().GetCurrentDeferredReleaseEvent();
   HIP_RETURN_IF_ERROR(hipEventRecord(current_deferred_release_event, static_cast<hipStream_t>(GetComputeStream())));
@@ -317,6 +359,23 @@ Status ROCMExecutionProvider::OnRunEnd() {
   return Status::OK();
 }
 
+bool ROCMExecutionProvider::IsGraphCaptureAllowed() const {
+  return regular_run_count_before_graph_capture_ >= min_num_runs_before_hip_graph_capture_;
+}
+
+bool ROCMExecutionProvider::IsGraphCaptureEnabled() const {
+  return info_.enable_hip_graph;
+}
+
+bool ROCMExecutionProvider::IsGraphCaptured() const {
+  return is_graph_captured_;
+}
+
+Status ROCMExecutionProvider::ReplayGraph() {
+  ORT_ENFORCE(is_graph_captured_, "ReplayGraph() is called before the graph has been captured.");
+  return hip_graph_.Replay();
+}
+
 namespace rocm {
 // opset 1 to 9
 class ONNX_OPERATOR_KERNEL_CLASS_NAME(kRocmExecutionProvider, kOnnxDomain, 1, MemcpyFromHost);
@@ -13,6 +13,7 @@
 #include "core/platform/ort_mutex.h"
 #include "core/providers/rocm/gpu_data_transfer.h"
 #include "core/providers/rocm/rocm_execution_provider_info.h"
+#include "core/providers/rocm/rocm_graph.h"
 #include "core/providers/rocm/rocm_pch.h"
 #include "core/providers/rocm/shared_inc/rocm_utils.h"
 #include "core/providers/rocm/shared_inc/rocm_call.h"
@@ -46,6 +47,11 @@ class ROCMExecutionProvider : public IExecutionProvider {
 
       external_stream_ = true;
       stream_ = static_cast<hipStream_t>(stream);
+
+      if (IsGraphCaptureEnabled()) {
+        ORT_ENFORCE(!is_graph_captured_, "The compute stream cannot change after a HIP graph has been captured.");
+        hip_graph_.SetStream(stream_);
+      }
     }
     return Status::OK();
   }
@@ -93,12 +99,27 @@ class ROCMExecutionProvider : public IExecutionProvider {
   static AllocatorPtr CreateRocmAllocator(OrtDevice::DeviceId device_id, size_t rocm_mem_limit, ArenaExtendStrategy arena_extend_strategy,
                                           ROCMExecutionProviderExternalAllocatorInfo external_alloc_info);
 
+  bool IsGraphCaptureEnabled() const override;
+  bool IsGraphCaptured() const override;
+  Status ReplayGraph() override;
+
  private:
   ROCMExecutionProviderInfo info_;
   hipDeviceProp_t device_prop_;
   bool external_stream_ = false;
   hipStream_t stream_ = nullptr;
 
+  // HIP graph capture/replay state (see enable_hip_graph). The graph is captured on the run
+  // after the warm-up run so that one-time work (arena growth, MIOpen find, constant uploads)
+  // is not baked into the graph, then replayed on every later run.
+  bool IsGraphCaptureAllowed() const;
+
+  ROCMGraph hip_graph_;
+  bool is_graph_captured_ = false;
+  bool graph_capture_in_progress_ = false;
+  int regular_run_count_before_graph_capture_ = 0;
+  const int min_num_runs_before_hip_graph_capture_ = 1;  // required warm-up runs before capture
+
   struct DeferredReleaseCPUPtrs {
     bool recorded = false;
     std::vector<void*> cpu_ptrs;
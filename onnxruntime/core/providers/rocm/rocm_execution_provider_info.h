@@ -39,6 +39,10 @@ struct ROCMExecutionProviderInfo {
   ArenaExtendStrategy arena_extend_strategy{ArenaExtendStrategy::kNextPowerOfTwo};
   bool miopen_conv_exhaustive_search{false};
   bool do_copy_in_default_stream{true};
+  // Capture the model into a HIP graph after a warm-up run and replay it on later runs. Requires
+  // static shapes, every node assigned to the ROCM EP and feeds/fetches bound to fixed device
+  // buffers across runs.
+  bool enable_hip_graph{false};
   bool has_user_compute_stream{false};
   void* user_compute_stream{nullptr};
   ROCMExecutionProviderExternalAllocatorInfo external_allocator_info{};
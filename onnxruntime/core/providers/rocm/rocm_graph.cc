@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/rocm/rocm_graph.h"
+
+#include "core/providers/rocm/rocm_common.h"
+#include "core/providers/rocm/shared_inc/rocm_call.h"
+
+namespace onnxruntime {
+
+void ROCMGraph::SetStream(hipStream_t stream) {
+  stream_ = stream;
+}
+
+void ROCMGraph::CaptureBegin() {
+#if defined(HIP_VERSION) && HIP_VERSION >= 403
+  ORT_ENFORCE(!has_graph_exec_,
+              "This hip graph has already captured a graph. "
+              "Create a new instance to capture a new graph.");
+
+  // All kernels of the session launch on stream_, so global capture mode is sufficient.
+  HIP_CALL_THROW(hipStreamBeginCapture(stream_, hipStreamCaptureModeGlobal));
+#else
+  ORT_THROW("HIP graphs require ROCm 4.3 or later.");
+#endif
+}
+
+void ROCMGraph::CaptureEnd() {
+#if defined(HIP_VERSION) && HIP_VERSION >= 403
+  HIP_CALL_THROW(hipStreamEndCapture(stream_, &graph_));
+  if (graph_ == NULL) {
+    ORT_THROW("ROCMGraph::CaptureEnd: graph_ is NULL");
+  }
+
+  has_graph_ = true;
+  HIP_CALL_THROW(hipGraphInstantiate(&graph_exec_, graph_, NULL, NULL, 0));
+  has_graph_exec_ = true;
+
+  // the uninstantiated graph is no longer needed once the executable graph exists
+  HIP_CALL_THROW(hipGraphDestroy(graph_));
+  has_graph_ = false;
+#else
+  ORT_THROW("HIP graphs require ROCm 4.3 or later.");
+#endif
+}
+
+Status ROCMGraph::Replay() {
+#if defined(HIP_VERSION) && HIP_VERSION >= 403
+  // although this function is not thread safe, a lock is not needed as it is always called by the
+  // same thread that captured the graph between OnRunStart and OnRunEnd.
+  LOGS_DEFAULT(INFO) << "Replaying HIP graph on stream " << stream_;
+  HIP_RETURN_IF_ERROR(hipGraphLaunch(graph_exec_, stream_));
+  HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream_));
+  return Status::OK();
+#else
+  return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "HIP graphs require ROCm 4.3 or later.");
+#endif
+}
+
+void ROCMGraph::Reset() {
+#if defined(HIP_VERSION) && HIP_VERSION >= 403
+  if (has_graph_) {
+    HIP_CALL_THROW(hipGraphDestroy(graph_));
+    has_graph_ = false;
+  }
+  if (has_graph_exec_) {
+    HIP_CALL_THROW(hipGraphExecDestroy(graph_exec_));
+    has_graph_exec_ = false;
+  }
+#endif
+}
+
+ROCMGraph::~ROCMGraph() {
+  Reset();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/providers/rocm/rocm_pch.h"
+
+namespace onnxruntime {
+
+using CaptureId_t = unsigned long long;
+
+// Wraps capture of a HIP stream into a hipGraph and its replay. One instance owns at most one
+// captured graph at a time; Reset releases it so a new capture can begin. HIP graph support
+// requires ROCm 4.3 or later; the methods throw on older toolkits.
+struct ROCMGraph {
+  ROCMGraph() = default;
+  ~ROCMGraph();
+
+  void SetStream(hipStream_t stream);
+  void CaptureBegin();
+  void CaptureEnd();
+  Status Replay();
+  void Reset();
+
+ private:
+#if defined(HIP_VERSION) && HIP_VERSION >= 403
+  hipGraph_t graph_ = NULL;
+  hipGraphExec_t graph_exec_ = NULL;
+#endif
+
+  bool has_graph_ = false;
+  bool has_graph_exec_ = false;
+
+  hipStream_t stream_ = nullptr;  // the stream the graph is captured from and replayed on
+};
+
+}  // namespace onnxruntime
@@ -63,6 +63,32 @@ namespace onnxruntime {
 ProviderHost* g_host = Provider_GetHost();
 ProviderHostCPU& g_host_cpu = g_host->GetProviderHostCPU();
 
+// Resolve the flat accessor table once at load. If the host doesn't implement the layout
+// version we were built against, fill a local table that routes through the virtual
+// interface, so callers never need a null check on the hot path.
+static const ProviderHostFastPath* ResolveHostFastPath() {
+  if (const ProviderHostFastPath* table = g_host->GetFastPath(kProviderHostFastPathVersion))
+    return table;
+
+  static ProviderHostFastPath fallback;
+  fallback.version = kProviderHostFastPathVersion;
+
+  fallback.Tensor_DataRaw = [](const Tensor* p) -> const void* { return g_host->Tensor__DataRaw(p); };
+  fallback.Tensor_MutableDataRaw = [](Tensor* p) -> void* { return g_host->Tensor__MutableDataRaw(p); };
+  fallback.Tensor_Shape = [](const Tensor* p) -> const TensorShape& { return g_host->Tensor__Shape(p); };
+  fallback.Tensor_SizeInBytes = [](const Tensor* p) { return g_host->Tensor__SizeInBytes(p); };
+  fallback.Tensor_Location = [](const Tensor* p) -> const OrtMemoryInfo& { return g_host->Tensor__Location(p); };
+  fallback.Tensor_GetElementType = [](const Tensor* p) { return g_host->Tensor__GetElementType(p); };
+
+  fallback.TensorShape_SizeHelper = [](const TensorShape* p, size_t start, size_t end) { return g_host->TensorShape__SizeHelper(p, start, end); };
+
+  fallback.CPUAllocator_Alloc = [](CPUAllocator* p, size_t size) { return g_host->CPUAllocator__Alloc(p, size); };
+  fallback.CPUAllocator_Free = [](CPUAllocator* p, void* allocation) { g_host->CPUAllocator__Free(p, allocation); };
+  return &fallback;
+}
+
+const ProviderHostFastPath* const g_host_fast_path = ResolveHostFastPath();
+
 static std::unique_ptr<std::vector<std::function<void()>>> s_run_on_unload_;
 
 void RunOnUnload(std::function<void()> function) {
@@ -87,8 +113,8 @@ struct OnUnload {
 
 } g_on_unload;
 
-void* CPUAllocator::Alloc(size_t size) { return g_host->CPUAllocator__Alloc(this, size); }
-void CPUAllocator::Free(void* p) { g_host->CPUAllocator__Free(this, p); }
+void* CPUAllocator::Alloc(size_t size) { return g_host_fast_path->CPUAllocator_Alloc(this, size); }
+void CPUAllocator::Free(void* p) { g_host_fast_path->CPUAllocator_Free(this, p); }
 
 AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
   return g_host->CreateAllocator(info);
@@ -231,7 +257,7 @@ int64_t TensorShape::Size() const {
 }
 
 int64_t TensorShape::SizeHelper(size_t start, size_t end) const {
-  return g_host->TensorShape__SizeHelper(this, start, end);
+  return g_host_fast_path->TensorShape_SizeHelper(this, start, end);
 }
 
 TensorShape TensorShape::Slice(size_t dimstart, size_t dimend) const {
@@ -112,12 +112,46 @@ struct Node__EdgeIterator {
 // a specific implementation of a virtual class member. Trying to get a pointer to member of a virtual function will return a thunk that
 // calls the virtual function (which will lead to infinite recursion in the bridge). There is no known way to get the non virtual member
 // function pointer implementation in this case.
+
+// Layout version of ProviderHostFastPath. Only append fields to the struct, and bump this
+// when doing so; a host that doesn't implement the version a provider was built against
+// returns nullptr from GetFastPath and the provider uses the virtual methods instead.
+constexpr uint32_t kProviderHostFastPathVersion = 1;
+
+// A flat table of plain function pointers for the accessors shared providers call most often
+// (tensor data/shape queries and CPU allocation). These run per tensor per node on the hot
+// path, where the virtual dispatch through ProviderHost costs a vtable load on every call.
+// The table is resolved once at provider library load and the entries call the target
+// functions directly.
+struct ProviderHostFastPath {
+  uint32_t version{0};
+
+  // Tensor
+  const void* (*Tensor_DataRaw)(const Tensor* p){nullptr};
+  void* (*Tensor_MutableDataRaw)(Tensor* p){nullptr};
+  const TensorShape& (*Tensor_Shape)(const Tensor* p){nullptr};
+  size_t (*Tensor_SizeInBytes)(const Tensor* p){nullptr};
+  const OrtMemoryInfo& (*Tensor_Location)(const Tensor* p){nullptr};
+  int32_t (*Tensor_GetElementType)(const Tensor* p){nullptr};
+
+  // TensorShape
+  int64_t (*TensorShape_SizeHelper)(const TensorShape* p, size_t start, size_t end){nullptr};
+
+  // CPUAllocator
+  void* (*CPUAllocator_Alloc)(CPUAllocator* p, size_t size){nullptr};
+  void (*CPUAllocator_Free)(CPUAllocator* p, void* allocation){nullptr};
+};
+
 struct ProviderHost {
   virtual const OrtApiBase* OrtGetApiBase() = 0;
 
   virtual void* HeapAllocate(size_t size) = 0;
   virtual void HeapFree(void*) = 0;
 
+  // Returns the flat accessor table if the host implements the requested layout version,
+  // otherwise nullptr and the caller must route through the virtual methods.
+  virtual const ProviderHostFastPath* GetFastPath(uint32_t version) noexcept = 0;
+
   virtual logging::Logger* LoggingManager_GetDefaultLogger() = 0;
 
   virtual std::string GetEnvironmentVar(const std::string& var_name) = 0;
@@ -4,6 +4,7 @@
 namespace onnxruntime {
 
 extern ProviderHost* g_host;
+extern const ProviderHostFastPath* const g_host_fast_path;
 
 struct CPUIDInfo final {
   static const CPUIDInfo& GetCPUIDInfo() { return g_host->CPUIDInfo__GetCPUIDInfo(); }
@@ -835,17 +836,17 @@ struct Tensor final {
   void* MutableDataRaw(MLDataType type) { return g_host->Tensor__MutableDataRaw(this, type); }
   const void* DataRaw(MLDataType type) const { return g_host->Tensor__DataRaw(this, type); }
 
-  void* MutableDataRaw() noexcept { return g_host->Tensor__MutableDataRaw(this); }
-  const void* DataRaw() const noexcept { return g_host->Tensor__DataRaw(this); }
+  void* MutableDataRaw() noexcept { return g_host_fast_path->Tensor_MutableDataRaw(this); }
+  const void* DataRaw() const noexcept { return g_host_fast_path->Tensor_DataRaw(this); }
 
-  const TensorShape& Shape() const { return g_host->Tensor__Shape(this); }
+  const TensorShape& Shape() const { return g_host_fast_path->Tensor_Shape(this); }
   void Reshape(const TensorShape& new_shape) { g_host->Tensor__Reshape(this, new_shape); }
   void SetByteOffset(ptrdiff_t byte_offset) { return g_host->Tensor__SetByteOffset(this, byte_offset); }
   ptrdiff_t ByteOffset() const { return g_host->Tensor__ByteOffset(this); }
-  size_t SizeInBytes() const { return g_host->Tensor__SizeInBytes(this); }
-  const OrtMemoryInfo& Location() const { return g_host->Tensor__Location(this); }
+  size_t SizeInBytes() const { return g_host_fast_path->Tensor_SizeInBytes(this); }
+  const OrtMemoryInfo& Location() const { return g_host_fast_path->Tensor_Location(this); }
 
-  int32_t GetElementType() const { return g_host->Tensor__GetElementType(this); }
+  int32_t GetElementType() const { return g_host_fast_path->Tensor_GetElementType(this); }
   MLDataType DataType() const { return g_host->Tensor__DataType(this); }
   bool IsDataTypeString() const { return g_host->Tensor__IsDataTypeString(this); }
 
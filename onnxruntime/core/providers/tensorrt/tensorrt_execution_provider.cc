@@ -19,6 +19,8 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <iomanip>
+#include <sstream>
 #include "flatbuffers/idl.h"
 #include "ort_trt_int8_cal_table.fbs.h"
 
@@ -53,6 +55,28 @@ std::string GetCachePath(const std::string& root, const std::string& name) {
   }
 }
 
+// Round an observed dynamic dimension down/up to a bucket boundary, so a rebuilt
+// optimization profile covers a whole bucket of shapes instead of exactly the shapes seen
+// so far and the number of rebuilds stays bounded. The lower boundary is floored at 1 so
+// the first bucket covers all small shapes; a zero sized dimension passes through.
+int64_t RoundDownToBucket(int64_t value, int bucket_size) {
+  const int64_t rounded = value - value % bucket_size;
+  return rounded > 0 ? rounded : (value > 0 ? 1 : value);
+}
+
+int64_t RoundUpToBucket(int64_t value, int bucket_size) {
+  return value > 0 ? ((value + bucket_size - 1) / bucket_size) * bucket_size : value;
+}
+
+// 64 bit FNV-1a over the serialized subgraph, used to content-address engine cache files
+uint64_t HashSerializedSubgraph(const std::string& data) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char c : data) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
 float ConvertSinglePrecisionIEEE754ToFloat(unsigned long input) {
   int s = (input >> 31) & 0x01;
   int e = ((input & 0x7f800000) >> 23) - 127;
@@ -434,6 +458,11 @@ TensorrtExecutionProvider::TensorrtExecutionProvider(const TensorrtExecutionProv
       engine_decryption_lib_path_ = info.engine_decryption_lib_path;
     }
     force_sequential_engine_build_ = info.force_sequential_engine_build;
+    async_engine_build_ = info.async_engine_build;
+    if (engine_cache_enable_) {
+      engine_cache_content_addressed_ = info.engine_cache_content_addressed;
+    }
+    shape_range_bucket_size_ = info.shape_range_bucket_size;
   } else {
     const std::string max_partition_iterations_env = onnxruntime::GetEnvironmentVar(tensorrt_env_vars::kMaxPartitionIterations);
     if (!max_partition_iterations_env.empty()) {
@@ -518,6 +547,23 @@ TensorrtExecutionProvider::TensorrtExecutionProvider(const TensorrtExecutionProv
     if (!force_sequential_engine_build_env.empty()) {
       force_sequential_engine_build_ = (std::stoi(force_sequential_engine_build_env) == 0 ? false : true);
     }
+
+    const std::string async_engine_build_env = onnxruntime::GetEnvironmentVar(tensorrt_env_vars::kAsyncEngineBuild);
+    if (!async_engine_build_env.empty()) {
+      async_engine_build_ = (std::stoi(async_engine_build_env) == 0 ? false : true);
+    }
+
+    if (engine_cache_enable_) {
+      const std::string engine_cache_content_addressed_env = onnxruntime::GetEnvironmentVar(tensorrt_env_vars::kEngineCacheContentAddressed);
+      if (!engine_cache_content_addressed_env.empty()) {
+        engine_cache_content_addressed_ = (std::stoi(engine_cache_content_addressed_env) == 0 ? false : true);
+      }
+    }
+
+    const std::string shape_range_bucket_size_env = onnxruntime::GetEnvironmentVar(tensorrt_env_vars::kShapeRangeBucketSize);
+    if (!shape_range_bucket_size_env.empty()) {
+      shape_range_bucket_size_ = std::stoi(shape_range_bucket_size_env);
+    }
   }
 
   // Validate setting
@@ -537,6 +583,10 @@ TensorrtExecutionProvider::TensorrtExecutionProvider(const TensorrtExecutionProv
     LOGS_DEFAULT(WARNING) << "[TensorRT EP] TensorRT option trt_dla_core must be a non-negative integer value. Set it to 0";
     dla_core_ = 0;
   }
+  if (shape_range_bucket_size_ < 0) {
+    LOGS_DEFAULT(WARNING) << "[TensorRT EP] TensorRT option trt_shape_range_bucket_size must be a non-negative integer value. Set it to 0";
+    shape_range_bucket_size_ = 0;
+  }
 
   if (engine_cache_enable_ || int8_enable_) {
     if (!cache_path_.empty() && !fs::is_directory(cache_path_)) {
@@ -578,10 +628,20 @@ TensorrtExecutionProvider::TensorrtExecutionProvider(const TensorrtExecutionProv
                         << ", trt_cache_path: " << cache_path_
                         << ", trt_engine_decryption_enable: " << engine_decryption_enable_
                         << ", trt_engine_decryption_lib_path: " << engine_decryption_lib_path_
-                        << ", trt_force_sequential_engine_build: " << force_sequential_engine_build_;
+                        << ", trt_force_sequential_engine_build: " << force_sequential_engine_build_
+                        << ", trt_async_engine_build: " << async_engine_build_
+                        << ", trt_engine_cache_content_addressed: " << engine_cache_content_addressed_
+                        << ", trt_shape_range_bucket_size: " << shape_range_bucket_size_;
 }
 
 TensorrtExecutionProvider::~TensorrtExecutionProvider() {
+  // Let deferred engine builds finish before the builders and networks they use go away
+  for (auto& future : engine_build_futures_) {
+    if (future.second.valid()) {
+      future.second.wait();
+    }
+  }
+
   if (!external_stream_ && stream_) {
     CUDA_CALL(cudaStreamDestroy(stream_));
   }
@@ -1279,12 +1339,30 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
       }
     }
 
+    // The engine cache is normally keyed by the fused node name, which depends on how this
+    // particular model was named and partitioned. Content addressing keys it by the subgraph
+    // itself plus everything else that determines the built engine, so caches can be shared
+    // across hosts with the same GPU and TensorRT version and prebuilt engines deploy warm.
+    std::string engine_cache_name = trt_node_name_with_precision;
+    if (engine_cache_content_addressed_) {
+      cudaDeviceProp prop;
+      CUDA_RETURN_IF_ERROR(cudaGetDeviceProperties(&prop, device_id_));
+      const std::string precision_suffix = trt_node_name_with_precision.substr(fused_node->Name().size());
+      std::ostringstream cache_name;
+      cache_name << "ort_trt_" << std::hex << std::setw(16) << std::setfill('0')
+                 << HashSerializedSubgraph(string_buf) << std::dec << precision_suffix
+                 << "_sm" << prop.major << prop.minor
+                 << "_trt" << NV_TENSORRT_MAJOR << "." << NV_TENSORRT_MINOR << "." << NV_TENSORRT_PATCH;
+      engine_cache_name = cache_name.str();
+    }
+
     // Build TRT engine here if the graph doesn't have dynamic shape input. Otherwise engine will
     // be built at runtime
     tensorrt_ptr::unique_pointer<nvinfer1::ICudaEngine> trt_engine;
     tensorrt_ptr::unique_pointer<nvinfer1::IExecutionContext> trt_context;
+    bool deferred_engine_build = false;
     if (!has_dynamic_shape) {
-      const std::string cache_path = GetCachePath(cache_path_, trt_node_name_with_precision);
+      const std::string cache_path = GetCachePath(cache_path_, engine_cache_name);
       const std::string engine_cache_path = cache_path + ".engine";
       std::ifstream engine_file(engine_cache_path, std::ios::binary | std::ios::in);
       if (engine_cache_enable_ && engine_file) {
@@ -1318,6 +1396,11 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
           return ORT_MAKE_STATUS(ONNXRUNTIME, EP_FAIL,
                                  "TensorRT EP could not deserialize engine from encrypted cache: " + engine_cache_path);
         }
+      } else if (async_engine_build_) {
+        // The build is the expensive part of session create; leave it to the builder thread
+        // launched below so the builds of all static shape subgraphs overlap with the rest
+        // of session initialization, and the first Run waits for the result.
+        deferred_engine_build = true;
       } else {
         // Set INT8 per tensor dynamic range
         if (int8_enable_ && trt_builder->platformHasFastInt8() && int8_calibration_cache_available_) {
@@ -1356,10 +1439,12 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
       }
 
       // Build context
-      trt_context = tensorrt_ptr::unique_pointer<nvinfer1::IExecutionContext>(trt_engine->createExecutionContext());
-      if (trt_context == nullptr) {
-        return ORT_MAKE_STATUS(ONNXRUNTIME, EP_FAIL,
-                               "TensorRT EP could not build execution context for fused node: " + fused_node->Name());
+      if (!deferred_engine_build) {
+        trt_context = tensorrt_ptr::unique_pointer<nvinfer1::IExecutionContext>(trt_engine->createExecutionContext());
+        if (trt_context == nullptr) {
+          return ORT_MAKE_STATUS(ONNXRUNTIME, EP_FAIL,
+                                 "TensorRT EP could not build execution context for fused node: " + fused_node->Name());
+        }
       }
     }
 
@@ -1396,17 +1481,88 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
     output_info_[fused_node->Name()].push_back(output_types);
     input_shape_ranges_[fused_node->Name()] = input_shape_ranges;
 
+    // Kick off the deferred engine build on a builder thread. The builder, network and the
+    // engine/context slots it fills all live in the maps above, so they stay valid for the
+    // lifetime of the provider; the config is owned by the task.
+    if (deferred_engine_build) {
+      auto* trt_engine_slot = &engines_[fused_node->Name()];
+      auto* trt_context_slot = &contexts_[fused_node->Name()];
+      auto* trt_builder_raw = builders_[fused_node->Name()].get();
+      auto* trt_network_raw = networks_[fused_node->Name()].get();
+      const std::string engine_cache_path = GetCachePath(cache_path_, engine_cache_name) + ".engine";
+      engine_build_futures_[fused_node->Name()] = std::async(
+          std::launch::async,
+          [this, trt_engine_slot, trt_context_slot, trt_builder_raw, trt_network_raw,
+           config = std::move(trt_config), dynamic_range_map, engine_cache_path,
+           node_name = fused_node->Name()]() -> common::Status {
+            if (!CUDA_CALL(cudaSetDevice(device_id_))) {
+              return ORT_MAKE_STATUS(ONNXRUNTIME, EP_FAIL,
+                                     "TensorRT EP could not set CUDA device in the engine build thread");
+            }
+
+            // Set INT8 per tensor dynamic range
+            if (int8_enable_ && trt_builder_raw->platformHasFastInt8() && int8_calibration_cache_available_) {
+              config->setInt8Calibrator(nullptr);
+              if (!SetDynamicRange(*trt_network_raw, dynamic_range_map)) {
+                return ORT_MAKE_STATUS(ONNXRUNTIME, EP_FAIL,
+                                       "TensorRT EP could not set INT8 dynamic range for fused node: " + node_name);
+              }
+            }
+
+            // Build engine
+            tensorrt_ptr::unique_pointer<nvinfer1::ICudaEngine> trt_engine;
+            {
+              auto lock = GetEngineBuildLock();
+              trt_engine = tensorrt_ptr::unique_pointer<nvinfer1::ICudaEngine>(trt_builder_raw->buildEngineWithConfig(*trt_network_raw, *config));
+            }
+            if (trt_engine == nullptr) {
+              return ORT_MAKE_STATUS(ONNXRUNTIME, EP_FAIL,
+                                     "TensorRT EP could not build engine for fused node: " + node_name);
+            }
+            if (engine_cache_enable_) {
+              nvinfer1::IHostMemory* serializedModel = trt_engine->serialize();
+              size_t engine_size = serializedModel->size();
+              if (engine_decryption_enable_) {
+                // Encrypt engine
+                if (!engine_encryption_(engine_cache_path.c_str(), reinterpret_cast<char*>(serializedModel->data()), engine_size)) {
+                  return ORT_MAKE_STATUS(ONNXRUNTIME, EP_FAIL,
+                                         "TensorRT EP could not call engine encryption function encrypt");
+                }
+              } else {
+                std::ofstream file(engine_cache_path, std::ios::binary | std::ios::out);
+                file.write(reinterpret_cast<char*>(serializedModel->data()), engine_size);
+              }
+              serializedModel->destroy();
+              LOGS_DEFAULT(VERBOSE) << "[TensorRT EP] Serialized " + engine_cache_path;
+            }
+
+            // Build context
+            auto trt_context = tensorrt_ptr::unique_pointer<nvinfer1::IExecutionContext>(trt_engine->createExecutionContext());
+            if (trt_context == nullptr) {
+              return ORT_MAKE_STATUS(ONNXRUNTIME, EP_FAIL,
+                                     "TensorRT EP could not build execution context for fused node: " + node_name);
+            }
+
+            *trt_engine_slot = std::move(trt_engine);
+            *trt_context_slot = std::move(trt_context);
+            return common::Status::OK();
+          });
+    }
+
     // Create function state
     // TODO: remove default capture
     NodeComputeInfo compute_info;
     compute_info.create_state_func = [=](ComputeContext* context, FunctionState* state) {
       std::unique_ptr<TensorrtFuncState> p = std::make_unique<TensorrtFuncState>();
+      auto engine_build_future_it = engine_build_futures_.find(context->node_name);
       *p = {context->allocate_func, context->release_func, context->allocator_handle, &parsers_[context->node_name],
             &engines_[context->node_name], &contexts_[context->node_name], &builders_[context->node_name],
             &networks_[context->node_name], input_info_[context->node_name], output_info_[context->node_name],
             input_shape_ranges_[context->node_name], &tensorrt_mu_, fp16_enable_, int8_enable_, int8_calibration_cache_available_,
-            dla_enable_, dla_core_, &max_workspace_size_, trt_node_name_with_precision, engine_cache_enable_, cache_path_,
-            runtime_.get(), nullptr, allocator_, dynamic_range_map, engine_decryption_enable_, engine_decryption_, engine_encryption_};
+            dla_enable_, dla_core_, &max_workspace_size_, trt_node_name_with_precision, engine_cache_name, engine_cache_enable_, cache_path_,
+            runtime_.get(), nullptr, allocator_, dynamic_range_map, engine_decryption_enable_, engine_decryption_, engine_encryption_,
+            shape_range_bucket_size_,
+            engine_build_future_it != engine_build_futures_.end() ? &engine_build_future_it->second : nullptr};
       *state = p.release();
       return 0;
     };
@@ -1421,6 +1577,16 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
       Ort::CustomOpApi ort{*api};
       TensorrtFuncState* trt_state = reinterpret_cast<TensorrtFuncState*>(state);
       std::lock_guard<OrtMutex> lock(*(trt_state->tensorrt_mu_ptr));
+
+      // Engine build was deferred to a builder thread at session create; wait for it here on
+      // the first Run before the engine and context are read below.
+      if (trt_state->engine_build_future != nullptr && trt_state->engine_build_future->valid()) {
+        Status build_status = trt_state->engine_build_future->get();
+        if (!build_status.IsOK()) {
+          return build_status;
+        }
+      }
+
       const std::unordered_map<std::string, int>& input_indexes = (trt_state->input_info)[0];
       const std::unordered_map<std::string, int>& output_indexes = (trt_state->output_info)[0];
       const std::unordered_map<std::string, int>& output_types = (trt_state->output_info)[1];
@@ -1439,7 +1605,7 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
       cudaStream_t stream = static_cast<cudaStream_t>(this->GetComputeStream());
 
       // Load serialized engine
-      const std::string cache_path = GetCachePath(trt_state->engine_cache_path, trt_state->trt_node_name_with_precision);
+      const std::string cache_path = GetCachePath(trt_state->engine_cache_path, trt_state->engine_cache_name);
       const std::string engine_cache_path = cache_path + ".engine";
       const std::string profile_cache_path = cache_path + ".profile";
       if (trt_state->engine_cache_enable && trt_engine == nullptr) {
@@ -1521,6 +1687,7 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
           auto tensor_info = ort.GetTensorTypeAndShape(input_tensor);
           const auto& tensor_shapes = ort.GetTensorShape(tensor_info);
           auto& shape_range = shape_ranges[input_name];
+          const int bucket_size = trt_state->shape_range_bucket_size;
 
           // Create shape profile
           if (input->isShapeTensor()) {
@@ -1568,15 +1735,15 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
                 const auto& tensor_shape_value = tensor_shape_values[input_name][j];
                 // Update shape range lower bound
                 if (tensor_shape_value < shape_range[j].first) {
-                  shape_range[j].first = tensor_shape_value;
-                  shapes_min[j] = tensor_shape_value;
+                  shape_range[j].first = bucket_size > 0 ? RoundDownToBucket(tensor_shape_value, bucket_size) : tensor_shape_value;
+                  shapes_min[j] = static_cast<int32_t>(shape_range[j].first);
                   engine_update = true;
                 }
                 // Update shape range upper bound
                 if (tensor_shape_value > shape_range[j].second) {
-                  shape_range[j].second = tensor_shape_value;
-                  shapes_max[j] = tensor_shape_value;
-                  shapes_opt[j] = tensor_shape_value;
+                  shape_range[j].second = bucket_size > 0 ? RoundUpToBucket(tensor_shape_value, bucket_size) : tensor_shape_value;
+                  shapes_max[j] = static_cast<int32_t>(shape_range[j].second);
+                  shapes_opt[j] = shapes_max[j];
                   engine_update = true;
                 }
               }
@@ -1585,10 +1752,15 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
               shape_range.clear();
               for (int j = 0; j < shape_size; ++j) {
                 const auto& tensor_shape_value = tensor_shape_values[input_name][j];
-                shape_range[j] = std::make_pair(tensor_shape_value, tensor_shape_value);
-                shapes_min[j] = tensor_shape_value;
-                shapes_opt[j] = tensor_shape_value;
-                shapes_max[j] = tensor_shape_value;
+                if (bucket_size > 0) {
+                  shape_range[j] = std::make_pair(RoundDownToBucket(tensor_shape_value, bucket_size),
+                                                  RoundUpToBucket(tensor_shape_value, bucket_size));
+                } else {
+                  shape_range[j] = std::make_pair(tensor_shape_value, tensor_shape_value);
+                }
+                shapes_min[j] = static_cast<int32_t>(shape_range[j].first);
+                shapes_opt[j] = static_cast<int32_t>(shape_range[j].second);
+                shapes_max[j] = static_cast<int32_t>(shape_range[j].second);
               }
               engine_update = true;
             }
@@ -1610,15 +1782,15 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
 
                 // Update minimum dimension
                 if (tensor_shape < shape_range[j].first) {
-                  shape_range[j].first = tensor_shape;
-                  dims_min.d[j] = tensor_shape;
+                  shape_range[j].first = bucket_size > 0 ? RoundDownToBucket(tensor_shape, bucket_size) : tensor_shape;
+                  dims_min.d[j] = static_cast<int32_t>(shape_range[j].first);
                   engine_update = true;
                 }
                 // Update maximum dimension
                 if (tensor_shape > shape_range[j].second) {
-                  shape_range[j].second = tensor_shape;
-                  dims_max.d[j] = tensor_shape;
-                  dims_opt.d[j] = tensor_shape;
+                  shape_range[j].second = bucket_size > 0 ? RoundUpToBucket(tensor_shape, bucket_size) : tensor_shape;
+                  dims_max.d[j] = static_cast<int32_t>(shape_range[j].second);
+                  dims_opt.d[j] = dims_max.d[j];
                   engine_update = true;
                 }
               }
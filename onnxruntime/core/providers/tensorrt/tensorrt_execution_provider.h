@@ -3,6 +3,7 @@
 
 #pragma once
 #include <ctime>
+#include <future>
 #include "NvInfer.h"
 #include "NvOnnxParser.h"
 #include "core/platform/ort_mutex.h"
@@ -26,6 +27,9 @@ static const std::string kCachePath = "ORT_TENSORRT_CACHE_PATH";
 static const std::string kDecryptionEnable = "ORT_TENSORRT_ENGINE_DECRYPTION_ENABLE";
 static const std::string kDecryptionLibPath = "ORT_TENSORRT_ENGINE_DECRYPTION_LIB_PATH";
 static const std::string kForceSequentialEngineBuild= "ORT_TENSORRT_FORCE_SEQUENTIAL_ENGINE_BUILD";
+static const std::string kAsyncEngineBuild = "ORT_TENSORRT_ASYNC_ENGINE_BUILD";
+static const std::string kEngineCacheContentAddressed = "ORT_TENSORRT_ENGINE_CACHE_CONTENT_ADDRESSED";
+static const std::string kShapeRangeBucketSize = "ORT_TENSORRT_SHAPE_RANGE_BUCKET_SIZE";
 // Old env variable for backward compatibility
 static const std::string kEngineCachePath = "ORT_TENSORRT_ENGINE_CACHE_PATH";
 }  // namespace tensorrt_env_vars
@@ -92,6 +96,7 @@ struct TensorrtFuncState {
   int dla_core;
   size_t* max_workspace_size_ptr = nullptr;
   std::string trt_node_name_with_precision;
+  std::string engine_cache_name;
   bool engine_cache_enable;
   std::string engine_cache_path;
   nvinfer1::IRuntime* runtime = nullptr;
@@ -101,6 +106,11 @@ struct TensorrtFuncState {
   bool engine_decryption_enable;
   int (*engine_decryption)(const char*, char*, size_t*);
   int (*engine_encryption)(const char*, char*, size_t);
+  // Bucket size for dynamic shape range growth, 0 disables bucketing
+  int shape_range_bucket_size = 0;
+  // Pending deferred engine build for this node, nullptr when the engine was built or
+  // deserialized at session create time. The first Run waits on it under tensorrt_mu_ptr.
+  std::future<common::Status>* engine_build_future = nullptr;
 };
 
 // Logical device representation.
@@ -147,6 +157,9 @@ class TensorrtExecutionProvider : public IExecutionProvider {
   bool dla_enable_ = false;
   int dla_core_ = 0;
   bool force_sequential_engine_build_ = false;
+  bool async_engine_build_ = false;
+  bool engine_cache_content_addressed_ = false;
+  int shape_range_bucket_size_ = 0;
   std::string int8_calibration_cache_name_;
   bool int8_calibration_cache_available_ = false;
   bool int8_use_native_tensorrt_calibration_table_ = false;
@@ -170,6 +183,9 @@ class TensorrtExecutionProvider : public IExecutionProvider {
   std::unordered_map<std::string, std::vector<std::unordered_map<std::string, int>>> input_info_;
   std::unordered_map<std::string, std::vector<std::unordered_map<std::string, int>>> output_info_;
   std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<int, std::pair<int64_t, int64_t>>>> input_shape_ranges_;
+  // Deferred static shape engine builds, keyed by fused node name. Populated by Compile when
+  // trt_async_engine_build is set; the first Run of a node waits on its entry.
+  std::unordered_map<std::string, std::future<common::Status>> engine_build_futures_;
 
   /**Get IndexedSubGraph based on node list of the subgraph*/
   std::unique_ptr<IndexedSubGraph> GetSubGraph(SubGraph_t graph_nodes_index,
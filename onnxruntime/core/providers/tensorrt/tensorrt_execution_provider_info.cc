@@ -27,6 +27,9 @@ constexpr const char* kCachePath = "trt_engine_cache_path";
 constexpr const char* kDecryptionEnable = "trt_engine_decryption_enable";
 constexpr const char* kDecryptionLibPath = "trt_engine_decryption_lib_path";
 constexpr const char* kForceSequentialEngineBuild = "trt_force_sequential_engine_build";
+constexpr const char* kAsyncEngineBuild = "trt_async_engine_build";
+constexpr const char* kEngineCacheContentAddressed = "trt_engine_cache_content_addressed";
+constexpr const char* kShapeRangeBucketSize = "trt_shape_range_bucket_size";
 }  // namespace provider_option_names
 }  // namespace tensorrt 
 
@@ -63,6 +66,9 @@ TensorrtExecutionProviderInfo TensorrtExecutionProviderInfo::FromProviderOptions
           .AddAssignmentToReference(tensorrt::provider_option_names::kDecryptionEnable, info.engine_decryption_enable)
           .AddAssignmentToReference(tensorrt::provider_option_names::kDecryptionLibPath, info.engine_decryption_lib_path) 
           .AddAssignmentToReference(tensorrt::provider_option_names::kForceSequentialEngineBuild, info.force_sequential_engine_build)
+          .AddAssignmentToReference(tensorrt::provider_option_names::kAsyncEngineBuild, info.async_engine_build)
+          .AddAssignmentToReference(tensorrt::provider_option_names::kEngineCacheContentAddressed, info.engine_cache_content_addressed)
+          .AddAssignmentToReference(tensorrt::provider_option_names::kShapeRangeBucketSize, info.shape_range_bucket_size)
           .Parse(options));
 
   return info;
@@ -87,6 +93,9 @@ ProviderOptions TensorrtExecutionProviderInfo::ToProviderOptions(const TensorrtE
       {tensorrt::provider_option_names::kDecryptionEnable, MakeStringWithClassicLocale(info.engine_decryption_enable)},
       {tensorrt::provider_option_names::kDecryptionLibPath, MakeStringWithClassicLocale(info.engine_decryption_lib_path)},
       {tensorrt::provider_option_names::kForceSequentialEngineBuild, MakeStringWithClassicLocale(info.force_sequential_engine_build)},
+      {tensorrt::provider_option_names::kAsyncEngineBuild, MakeStringWithClassicLocale(info.async_engine_build)},
+      {tensorrt::provider_option_names::kEngineCacheContentAddressed, MakeStringWithClassicLocale(info.engine_cache_content_addressed)},
+      {tensorrt::provider_option_names::kShapeRangeBucketSize, MakeStringWithClassicLocale(info.shape_range_bucket_size)},
   };
   return options;
 }
@@ -27,11 +27,13 @@ namespace onnxruntime {
 namespace webnn {
 
 ModelBuilder::ModelBuilder(const GraphViewer& graph_viewer, const logging::Logger& logger,
-                           uint32_t device_flags, uint32_t power_flags)
+                           uint32_t device_flags, uint32_t power_flags,
+                           std::shared_ptr<InitializerDataCache> initializer_data_cache)
     : graph_viewer_(graph_viewer),
       logger_(logger),
       device_flags_(device_flags),
-      power_flags_(power_flags) {
+      power_flags_(power_flags),
+      initializer_data_cache_(std::move(initializer_data_cache)) {
 }
 
 Status ModelBuilder::Initialize() {
@@ -159,9 +161,19 @@ Status ModelBuilder::RegisterInitializers() {
 
     auto data_type = tensor.data_type();
     if (data_type == ONNX_NAMESPACE::TensorProto_DataType_FLOAT) {
-      unpacked_tensors_.push_back({});
-      std::vector<uint8_t>& unpacked_tensor = unpacked_tensors_.back();
-      ORT_RETURN_IF_ERROR(onnxruntime::utils::UnpackInitializerData(tensor, unpacked_tensor));
+      // With a cache the unpacked data is shared with the builders of the other graph
+      // variants of this fused node, each weight is only unpacked on the first build
+      std::vector<uint8_t>* unpacked_tensor_ptr;
+      if (initializer_data_cache_) {
+        unpacked_tensor_ptr = &(*initializer_data_cache_)[name];
+      } else {
+        unpacked_tensors_.push_back({});
+        unpacked_tensor_ptr = &unpacked_tensors_.back();
+      }
+      std::vector<uint8_t>& unpacked_tensor = *unpacked_tensor_ptr;
+      if (unpacked_tensor.empty()) {
+        ORT_RETURN_IF_ERROR(onnxruntime::utils::UnpackInitializerData(tensor, unpacked_tensor));
+      }
       auto num_elements = SafeInt<size_t>(Product(tensor.dims()));
       desc.type = ::wnn::OperandType::Float32;
       wnn::ArrayBufferView bufferView;
@@ -16,7 +16,12 @@ class IOpBuilder;
 
 class ModelBuilder {
  public:
-  ModelBuilder(const GraphViewer& graph_viewer, const logging::Logger& logger, uint32_t device_flags, uint32_t power_flags);
+  // Unpacked initializer data keyed by initializer name. Shared between the builders of
+  // the graph variants of one fused node so the weights are only unpacked once
+  using InitializerDataCache = std::unordered_map<std::string, std::vector<uint8_t>>;
+
+  ModelBuilder(const GraphViewer& graph_viewer, const logging::Logger& logger, uint32_t device_flags, uint32_t power_flags,
+               std::shared_ptr<InitializerDataCache> initializer_data_cache = nullptr);
   ~ModelBuilder() = default;
 
   Status Compile(std::unique_ptr<Model>& model) ORT_MUST_USE_RESULT;
@@ -53,6 +58,7 @@ class ModelBuilder {
 
   ::wnn::GraphBuilder builder_;
   ::wnn::Context context_;
+  std::shared_ptr<InitializerDataCache> initializer_data_cache_;
   std::vector<std::vector<uint8_t>> unpacked_tensors_;
   std::unordered_map<std::string, ::wnn::Operand> operands_;
   std::vector<std::string> input_names_;
@@ -3,11 +3,14 @@
 
 #include "webnn_execution_provider.h"
 
+#include <sstream>
+
 #include "core/framework/allocatormgr.h"
 #include "core/framework/compute_capability.h"
 #include "core/framework/memcpy.h"
 #include "core/framework/kernel_registry.h"
 #include "core/graph/graph_viewer.h"
+#include "core/graph/model.h"
 #include "core/session/onnxruntime_cxx_api.h"
 
 #include "builders/model.h"
@@ -176,13 +179,96 @@ WebNNExecutionProvider::GetCapability(const onnxruntime::GraphViewer& graph_view
   return result;
 }
 
+// Convert the filtered GraphViewer of a fused node to a GraphProto
+// Graph::ToGraphProto cannot be used directly since the viewer filters the graph
+static void ToGraphProtoInternal(const GraphViewer& graph_viewer, ONNX_NAMESPACE::GraphProto& graph_proto) {
+  for (const auto* input_arg : graph_viewer.GetInputs()) {
+    *(graph_proto.mutable_input()->Add()) = input_arg->ToProto();
+  }
+
+  const auto& init_tensors = graph_viewer.GetAllInitializedTensors();
+  for (const auto& tensor : init_tensors) {
+    *(graph_proto.mutable_initializer()->Add()) = *(tensor.second);
+  }
+
+  for (const auto* output_arg : graph_viewer.GetOutputs()) {
+    *(graph_proto.mutable_output()->Add()) = output_arg->ToProto();
+  }
+
+  for (const auto* value_info : graph_viewer.GetValueInfo()) {
+    *(graph_proto.mutable_value_info()->Add()) = value_info->ToProto();
+  }
+
+  // Nodes must be sorted in Topological Order in the GraphProto per ONNX spec
+  for (const auto& node_idx : graph_viewer.GetNodesInTopologicalOrder()) {
+    graph_viewer.GetNode(node_idx)->ToProto(*graph_proto.add_node());
+  }
+}
+
+// Key identifying the input shapes a graph variant was compiled for
+static std::string MakeShapeSignature(const std::vector<std::string>& input_names,
+                                      const std::unordered_map<std::string, webnn::OnnxTensorData>& inputs) {
+  std::ostringstream signature;
+  for (const auto& input_name : input_names) {
+    signature << input_name << ":";
+    for (const auto dim : inputs.at(input_name).tensor_info.shape) {
+      signature << dim << ",";
+    }
+    signature << ";";
+  }
+  return signature.str();
+}
+
+common::Status WebNNExecutionProvider::CompileDynamicVariant(
+    ModelState& model_state,
+    const std::unordered_map<std::string, webnn::OnnxTensorData>& inputs,
+    std::unique_ptr<webnn::Model>& model) {
+  // Give the stored subgraph proto the concrete input shapes of this Run, shapes of the
+  // intermediate values and outputs are re-inferred when the proto is resolved below
+  ONNX_NAMESPACE::ModelProto model_proto = model_state.model_proto;
+  auto* graph_proto = model_proto.mutable_graph();
+  for (int i = 0; i < graph_proto->input_size(); i++) {
+    auto* graph_input = graph_proto->mutable_input(i);
+    const auto input = inputs.find(graph_input->name());
+    if (input == inputs.end())
+      continue;
+
+    auto* shape = graph_input->mutable_type()->mutable_tensor_type()->mutable_shape();
+    shape->clear_dim();
+    for (const auto dim : input->second.tensor_info.shape) {
+      shape->add_dim()->set_dim_value(dim);
+    }
+  }
+
+  std::shared_ptr<onnxruntime::Model> ort_model;
+  ORT_RETURN_IF_ERROR(onnxruntime::Model::Load(std::move(model_proto), ort_model, nullptr, *model_state.logger));
+
+  const GraphViewer graph_viewer(ort_model->MainGraph());
+  webnn::ModelBuilder builder(graph_viewer, *model_state.logger, model_state.device_flags,
+                              model_state.power_flags, model_state.initializer_data_cache);
+  ORT_RETURN_IF_ERROR(builder.Compile(model));
+
+  auto input_map = model_state.input_map;
+  model->SetInputMap(std::move(input_map));
+  auto output_map = model_state.output_map;
+  model->SetOutputMap(std::move(output_map));
+  return Status::OK();
+}
+
 common::Status WebNNExecutionProvider::Compile(const std::vector<FusedNodeAndGraph>& fused_nodes_and_graphs,
                                                 std::vector<NodeComputeInfo>& node_compute_funcs) {
   for (const auto& fused_node_and_graph : fused_nodes_and_graphs) {
     Node& fused_node = fused_node_and_graph.fused_node;
     const onnxruntime::GraphViewer& graph_viewer(fused_node_and_graph.filtered_graph);
 
-    webnn::ModelBuilder builder(graph_viewer, *GetLogger(), webnn_device_flags_, webnn_power_flags_);
+    ModelState& model_state = models_[fused_node.Name()];
+    model_state.logger = GetLogger();
+    model_state.device_flags = webnn_device_flags_;
+    model_state.power_flags = webnn_power_flags_;
+    model_state.initializer_data_cache = std::make_shared<webnn::ModelBuilder::InitializerDataCache>();
+
+    webnn::ModelBuilder builder(graph_viewer, *GetLogger(), webnn_device_flags_, webnn_power_flags_,
+                                model_state.initializer_data_cache);
     std::unique_ptr<webnn::Model> model;
     ORT_RETURN_IF_ERROR(builder.Compile(model));
     // Build map from input name to its index in input definitions
@@ -193,6 +279,7 @@ common::Status WebNNExecutionProvider::Compile(const std::vector<FusedNodeAndGra
       for (size_t i = 0, end = input_defs.size(); i < end; ++i) {
         input_map[input_defs[i]->Name()] = i;
       }
+      model_state.input_map = input_map;
       model->SetInputMap(std::move(input_map));
     }
     // Build map from output name to its index in output definitions
@@ -203,24 +290,64 @@ common::Status WebNNExecutionProvider::Compile(const std::vector<FusedNodeAndGra
       for (size_t i = 0, end = output_defs.size(); i < end; ++i) {
         output_map[output_defs[i]->Name()] = i;
       }
+      model_state.output_map = output_map;
       model->SetOutputMap(std::move(output_map));
     }
-    models_.emplace(fused_node.Name(), std::move(model));
+
+    // The model just compiled assumed 1 for any symbolic input dimension. When the
+    // subgraph has such dimensions, keep its proto so Run can compile a variant for
+    // the actual input shapes of each new shape signature
+    for (const auto* input_def : graph_viewer.GetInputs()) {
+      const auto* shape_proto = input_def->Shape();
+      if (shape_proto == nullptr)
+        continue;
+      for (const auto& dim : shape_proto->dim()) {
+        if (!dim.has_dim_value()) {
+          model_state.has_dynamic_inputs = true;
+          break;
+        }
+      }
+      if (model_state.has_dynamic_inputs)
+        break;
+    }
+
+    if (model_state.has_dynamic_inputs) {
+      onnxruntime::Model ort_model{graph_viewer.Name(), true, ModelMetaData{}, PathString{},
+                                   IOnnxRuntimeOpSchemaRegistryList{}, graph_viewer.DomainToVersionMap(),
+                                   std::vector<ONNX_NAMESPACE::FunctionProto>(), *GetLogger()};
+      model_state.model_proto = ort_model.ToProto();
+      model_state.model_proto.set_ir_version(ONNX_NAMESPACE::Version::IR_VERSION);
+      ToGraphProtoInternal(graph_viewer, *model_state.model_proto.mutable_graph());
+    }
+
+    // Key the compiled model under the input shape signature it was compiled for
+    {
+      std::unordered_map<std::string, webnn::OnnxTensorData> compiled_inputs;
+      for (const auto& input_name : model->GetInputs()) {
+        const auto& info = model->GetInputOutputInfo(input_name);
+        compiled_inputs.emplace(input_name,
+                                webnn::OnnxTensorData{webnn::OnnxTensorInfo{info.data_type, info.shape}, nullptr});
+      }
+      const std::string signature = MakeShapeSignature(model->GetInputs(), compiled_inputs);
+      model_state.primary_model = model.get();
+      model_state.models.emplace(signature, std::move(model));
+    }
 
     NodeComputeInfo compute_info;
     compute_info.create_state_func = [&](ComputeContext* context, FunctionState* state) {
-      *state = models_[context->node_name].get();
+      *state = &models_[context->node_name];
       return 0;
     };
 
     compute_info.release_state_func = [](FunctionState state) {
-      // the `state` is a webnn::model managed by unique_ptr
+      // the `state` is a ModelState owned by the models_ map
       ORT_UNUSED_PARAMETER(state);
     };
 
     compute_info.compute_func = [](FunctionState state, const OrtCustomOpApi* api, OrtKernelContext* context) {
       Ort::CustomOpApi ort{*api};
-      webnn::Model* model = reinterpret_cast<webnn::Model*>(state);
+      ModelState* model_state = reinterpret_cast<ModelState*>(state);
+      webnn::Model* model = model_state->primary_model;
       const size_t num_inputs = ort.KernelContext_GetInputCount(context);
       const size_t num_outputs = ort.KernelContext_GetOutputCount(context);
       const auto& model_inputs = model->GetInputs();
@@ -254,6 +381,20 @@ common::Status WebNNExecutionProvider::Compile(const std::vector<FusedNodeAndGra
         ort.ReleaseTensorTypeAndShapeInfo(tensor_info);
       }
 
+      // A WebNN graph is compiled for fixed shapes, pick the variant matching the input
+      // shapes of this Run, compiling and caching it the first time the signature is seen
+      if (model_state->has_dynamic_inputs) {
+        const std::string signature = MakeShapeSignature(model_inputs, inputs);
+        std::unique_lock<OrtMutex> state_lock(model_state->mutex);
+        auto it = model_state->models.find(signature);
+        if (it == model_state->models.end()) {
+          std::unique_ptr<webnn::Model> variant;
+          ORT_RETURN_IF_ERROR(CompileDynamicVariant(*model_state, inputs, variant));
+          it = model_state->models.emplace(signature, std::move(variant)).first;
+        }
+        model = it->second.get();
+      }
+
       // From this point we will need to take the exclusive lock on the model until the Predict is
       // performed, to block other threads to perform Predict on the same model
       // TODO, investigate concurrent runs for different executions from the same model
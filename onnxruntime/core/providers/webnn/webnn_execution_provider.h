@@ -4,11 +4,14 @@
 #pragma once
 
 #include "core/framework/execution_provider.h"
+#include "core/graph/onnx_protobuf.h"
+#include "core/platform/ort_mutex.h"
 #include "core/providers/webnn/webnn_provider_factory.h"
 
 namespace onnxruntime {
 namespace webnn {
 class Model;
+struct OnnxTensorData;
 }
 
 class WebNNExecutionProvider : public IExecutionProvider {
@@ -37,6 +40,34 @@ class WebNNExecutionProvider : public IExecutionProvider {
   const uint32_t webnn_device_flags_;
   const uint32_t webnn_power_flags_;
 
-  std::unordered_map<std::string, std::unique_ptr<onnxruntime::webnn::Model>> models_;
+  // The compiled graphs of one fused node. A WebNN graph is compiled for fixed input
+  // shapes, so when the subgraph has symbolic input dimensions additional variants are
+  // compiled lazily from model_proto for each new input shape signature seen at Run time
+  // and cached in models
+  struct ModelState {
+    bool has_dynamic_inputs{false};
+    // Subgraph proto used to compile the variants, only populated for dynamic input shapes
+    ONNX_NAMESPACE::ModelProto model_proto;
+    const logging::Logger* logger{nullptr};
+    uint32_t device_flags;
+    uint32_t power_flags;
+    // Unpacked initializer data shared by the builders of all the variants
+    std::shared_ptr<std::unordered_map<std::string, std::vector<uint8_t>>> initializer_data_cache;
+    std::unordered_map<std::string, size_t> input_map;
+    std::unordered_map<std::string, size_t> output_map;
+    // Compiled models keyed by the input shape signature they were compiled for,
+    // protected by mutex when accessed at Run time
+    std::unordered_map<std::string, std::unique_ptr<onnxruntime::webnn::Model>> models;
+    // The model compiled at session initialization, used directly for static shapes
+    onnxruntime::webnn::Model* primary_model{nullptr};
+    OrtMutex mutex;
+  };
+
+  // Compile a graph variant for the concrete input shapes of the current Run
+  static common::Status CompileDynamicVariant(ModelState& model_state,
+                                              const std::unordered_map<std::string, webnn::OnnxTensorData>& inputs,
+                                              std::unique_ptr<webnn::Model>& model);
+
+  std::unordered_map<std::string, ModelState> models_;
 };
 }  // namespace onnxruntime
@@ -28,6 +28,8 @@ common::Status IOBinding::BindInput(const std::string& name, const OrtValue& ml_
     } else {
       feed_names_.push_back(name);
       feeds_.push_back(value);
+      // the set of feed names changed so any cached name resolution is stale
+      InvalidateCachedFeedsFetchesManager();
     }
   };
 
@@ -45,6 +47,7 @@ common::Status IOBinding::BindInput(const std::string& name, const OrtValue& ml_
 void IOBinding::ClearInputs() {
   feed_names_.clear();
   feeds_.clear();
+  InvalidateCachedFeedsFetchesManager();
 }
 
 static common::Status SyncProviders(const SessionState::NameNodeInfoMapType& node_info_map,
@@ -98,6 +101,9 @@ common::Status IOBinding::BindOutputImpl(const std::string& name, const OrtValue
     outputs_device_info_.push_back(device);
   }
 
+  // output device copy info is captured in the cached state, so re-binding an output invalidates it
+  InvalidateCachedFeedsFetchesManager();
+
   return Status::OK();
 }
 
@@ -105,6 +111,7 @@ void IOBinding::ClearOutputs() {
   output_names_.clear();
   outputs_.clear();
   outputs_device_info_.clear();
+  InvalidateCachedFeedsFetchesManager();
 }
 
 const std::vector<std::string>& IOBinding::GetOutputNames() const { return output_names_; }
@@ -7,6 +7,7 @@
 #include <unordered_map>
 
 #include "core/framework/execution_provider.h"
+#include "core/framework/feeds_fetches_manager.h"
 #include "core/common/status.h"
 #include "core/graph/basic_types.h"
 #include "core/framework/ort_value.h"
@@ -105,6 +106,19 @@ class IOBinding {
   std::vector<OrtValue> outputs_;
   std::vector<OrtDevice> outputs_device_info_;
 
+  // Cached feed/fetch name resolution for this binding so repeated InferenceSession::Run calls with the same
+  // binding skip per-Run name-to-index lookup and input/output validation.
+  // Created by InferenceSession::Run after the current bindings pass validation, and reset whenever the set of
+  // bound names or an output device changes. Re-binding a value to an existing input name keeps the cache, so
+  // the caller must keep the type and device of such values unchanged.
+  std::unique_ptr<FeedsFetchesManager> feeds_fetches_manager_;
+
+  FeedsFetchesManager* GetCachedFeedsFetchesManager() { return feeds_fetches_manager_.get(); }
+  void SetCachedFeedsFetchesManager(std::unique_ptr<FeedsFetchesManager> feeds_fetches_manager) {
+    feeds_fetches_manager_ = std::move(feeds_fetches_manager);
+  }
+  void InvalidateCachedFeedsFetchesManager() { feeds_fetches_manager_.reset(); }
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(IOBinding);
 
   // device info for all outputs. only used by InferenceSession if the output is not pre-allocated.
@@ -11,6 +11,8 @@
 #include "core/framework/error_code_helper.h"
 #include "core/framework/tensor_type_and_shape.h"
 #include "core/graph/onnx_protobuf.h"
+#include "core/platform/threadpool.h"
+#include "core/session/allocator_adapters.h"
 #include "core/session/inference_session.h"
 #include "core/session/ort_apis.h"
 #include <type_traits>
@@ -50,6 +52,36 @@ ORT_API_STATUS_IMPL(OrtApis::KernelContext_GetOutput, _Inout_ OrtKernelContext*
   return nullptr;
 };
 
+ORT_API_STATUS_IMPL(OrtApis::KernelContext_GetTempSpaceAllocator, _In_ const OrtKernelContext* context, _Outptr_ OrtAllocator** out) {
+  onnxruntime::AllocatorPtr allocator;
+  auto status = reinterpret_cast<const onnxruntime::OpKernelContextInternal*>(context)->GetTempSpaceAllocator(&allocator);
+  if (!status.IsOK())
+    return onnxruntime::ToOrtStatus(status);
+  *out = new onnxruntime::OrtAllocatorImplWrappingIAllocator(std::move(allocator));
+  return nullptr;
+};
+
+ORT_API_STATUS_IMPL(OrtApis::KernelContext_ParallelFor, _In_ const OrtKernelContext* context,
+                    _In_ void (ORT_API_CALL* fn)(void*, size_t), _In_ size_t total, _In_ size_t num_batch,
+                    _In_opt_ void* usr_data) {
+  if (fn == nullptr)
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "`fn` cannot be NULL");
+  if (total == 0)
+    return nullptr;
+  auto* tp = reinterpret_cast<const onnxruntime::OpKernelContextInternal*>(context)->GetOperatorThreadPool();
+  if (num_batch > 0) {
+    onnxruntime::concurrency::ThreadPool::TryBatchParallelFor(
+        tp, static_cast<ptrdiff_t>(total),
+        [fn, usr_data](ptrdiff_t ith) { fn(usr_data, static_cast<size_t>(ith)); },
+        static_cast<ptrdiff_t>(num_batch));
+  } else {
+    onnxruntime::concurrency::ThreadPool::TrySimpleParallelFor(
+        tp, static_cast<ptrdiff_t>(total),
+        [fn, usr_data](ptrdiff_t ith) { fn(usr_data, static_cast<size_t>(ith)); });
+  }
+  return nullptr;
+};
+
 ORT_API_STATUS_IMPL(OrtApis::KernelInfoGetAttribute_string, _In_ const OrtKernelInfo* info, _In_ const char* name, _Out_ char* out, _Inout_ size_t* size) {
   std::string value;
   auto status = reinterpret_cast<const onnxruntime::OpKernelInfo*>(info)->GetAttr<std::string>(name, &value);
@@ -122,6 +154,30 @@ struct CustomOpKernel : OpKernel {
 
   ~CustomOpKernel() override { op_.KernelDestroy(op_kernel_); }
 
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 /*out*/ bool& is_packed, /*out*/ PrePackedWeights* /*prepacked_weights*/) override {
+    is_packed = false;
+
+    // KernelPrePack was appended to OrtCustomOp in API version 10; structs built against older
+    // headers must not be read past their original size. Shared pre-packed weight containers are
+    // not exposed to custom ops, so the kernel always owns its packed buffers.
+    if (op_.version < 10 || op_.KernelPrePack == nullptr) {
+      return Status::OK();
+    }
+
+    OrtValue value;
+    value.Init(const_cast<Tensor*>(&tensor), DataTypeImpl::GetType<Tensor>(), [](void*) {});
+    OrtAllocatorImplWrappingIAllocator ort_allocator(std::move(alloc));
+    int is_packed_value = 0;
+    if (OrtStatusPtr status = op_.KernelPrePack(op_kernel_, &value, input_idx, &ort_allocator, &is_packed_value)) {
+      Status ret = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, OrtApis::GetErrorMessage(status));
+      OrtApis::ReleaseStatus(status);
+      return ret;
+    }
+    is_packed = is_packed_value != 0;
+    return Status::OK();
+  }
+
   Status Compute(OpKernelContext* ctx) const override {
     op_.KernelCompute(op_kernel_, reinterpret_cast<OrtKernelContext*>(ctx));
     return Status::OK();
@@ -0,0 +1,234 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/session/dynamic_batcher.h"
+
+#include <chrono>
+#include <cstring>
+
+#include "core/framework/data_types.h"
+#include "core/framework/tensor.h"
+#include "core/session/inference_session.h"
+
+namespace onnxruntime {
+
+DynamicBatcher::DynamicBatcher(InferenceSession& session, AllocatorPtr cpu_allocator,
+                               int64_t max_batch_size, int64_t timeout_microseconds)
+    : session_(session),
+      cpu_allocator_(std::move(cpu_allocator)),
+      max_batch_size_(max_batch_size),
+      timeout_microseconds_(timeout_microseconds) {
+  ORT_ENFORCE(max_batch_size_ > 1, "Dynamic batching requires a max batch size greater than 1");
+  ORT_ENFORCE(cpu_allocator_ != nullptr);
+}
+
+bool DynamicBatcher::IsBatchable(const std::vector<OrtValue>& feeds, const std::vector<OrtValue>& fetches) {
+  // pre-allocated fetches would need to be carved out of the merged output, which we don't support
+  for (const auto& fetch : fetches) {
+    if (fetch.IsAllocated()) {
+      return false;
+    }
+  }
+
+  if (feeds.empty()) {
+    return false;
+  }
+
+  int64_t batch_size = -1;
+  for (const auto& feed : feeds) {
+    if (!feed.IsTensor()) {
+      return false;
+    }
+
+    const Tensor& tensor = feed.Get<Tensor>();
+    if (tensor.IsDataTypeString() ||
+        tensor.Location().device.Type() != OrtDevice::CPU ||
+        tensor.Shape().NumDimensions() < 1) {
+      return false;
+    }
+
+    // all feeds must agree on the batch dimension for the request to have a well defined batch size
+    const int64_t dim0 = tensor.Shape()[0];
+    if (dim0 < 1 || (batch_size != -1 && dim0 != batch_size)) {
+      return false;
+    }
+
+    batch_size = dim0;
+  }
+
+  return true;
+}
+
+common::Status DynamicBatcher::MergeFeeds(const std::vector<Request*>& batch, int64_t total_batch_size,
+                                          std::vector<OrtValue>& merged_feeds) const {
+  const size_t num_feeds = batch.front()->feeds->size();
+  merged_feeds.resize(num_feeds);
+
+  for (size_t i = 0; i < num_feeds; ++i) {
+    const Tensor& first = (*batch.front()->feeds)[i].Get<Tensor>();
+    std::vector<int64_t> dims = first.Shape().GetDims();
+
+    for (size_t r = 1; r < batch.size(); ++r) {
+      const Tensor& tensor = (*batch[r]->feeds)[i].Get<Tensor>();
+      const auto& peer_dims = tensor.Shape().GetDims();
+
+      bool compatible = tensor.DataType() == first.DataType() && peer_dims.size() == dims.size();
+      for (size_t d = 1; compatible && d < dims.size(); ++d) {
+        compatible = peer_dims[d] == dims[d];
+      }
+
+      ORT_RETURN_IF_NOT(compatible, "Dynamic batching: feed ", (*batch.front()->feed_names)[i],
+                        " has incompatible type or non-batch dimensions across requests.");
+    }
+
+    dims[0] = total_batch_size;
+    Tensor::InitOrtValue(first.DataType(), TensorShape(dims), cpu_allocator_, merged_feeds[i]);
+
+    char* dst = static_cast<char*>(merged_feeds[i].GetMutable<Tensor>()->MutableDataRaw());
+    for (const Request* request : batch) {
+      const Tensor& tensor = (*request->feeds)[i].Get<Tensor>();
+      const size_t bytes = tensor.SizeInBytes();
+      if (bytes > 0) {
+        memcpy(dst, tensor.DataRaw(), bytes);
+        dst += bytes;
+      }
+    }
+  }
+
+  return common::Status::OK();
+}
+
+common::Status DynamicBatcher::ScatterFetches(const std::vector<Request*>& batch, int64_t total_batch_size,
+                                              const std::vector<OrtValue>& merged_fetches) const {
+  const size_t num_fetches = merged_fetches.size();
+
+  for (Request* request : batch) {
+    request->fetches->resize(num_fetches);
+  }
+
+  for (size_t i = 0; i < num_fetches; ++i) {
+    ORT_RETURN_IF_NOT(merged_fetches[i].IsTensor(), "Dynamic batching: output ",
+                      (*batch.front()->output_names)[i], " is not a tensor and cannot be scattered.");
+
+    const Tensor& merged = merged_fetches[i].Get<Tensor>();
+    std::vector<int64_t> dims = merged.Shape().GetDims();
+
+    ORT_RETURN_IF_NOT(!merged.IsDataTypeString() && !dims.empty() && dims[0] == total_batch_size,
+                      "Dynamic batching: output ", (*batch.front()->output_names)[i],
+                      " does not carry the batch on dimension 0 and cannot be scattered.");
+
+    const int64_t row_bytes = merged.Shape().SizeFromDimension(1) * static_cast<int64_t>(merged.DataType()->Size());
+    const char* src = static_cast<const char*>(merged.DataRaw());
+
+    for (Request* request : batch) {
+      dims[0] = request->batch_size;
+      OrtValue& fetch = (*request->fetches)[i];
+      Tensor::InitOrtValue(merged.DataType(), TensorShape(dims), cpu_allocator_, fetch);
+
+      const size_t bytes = static_cast<size_t>(request->batch_size * row_bytes);
+      if (bytes > 0) {
+        memcpy(fetch.GetMutable<Tensor>()->MutableDataRaw(), src, bytes);
+        src += bytes;
+      }
+    }
+  }
+
+  return common::Status::OK();
+}
+
+void DynamicBatcher::ExecuteBatch(const RunOptions& run_options, std::vector<Request*>& batch) {
+  if (batch.size() == 1) {
+    Request& request = *batch.front();
+    request.status = session_.RunDirect(run_options, *request.feed_names, *request.feeds,
+                                        *request.output_names, request.fetches, nullptr, nullptr);
+  } else {
+    int64_t total_batch_size = 0;
+    for (const Request* request : batch) {
+      total_batch_size += request->batch_size;
+    }
+
+    std::vector<OrtValue> merged_feeds;
+    std::vector<OrtValue> merged_fetches(batch.front()->output_names->size());
+
+    common::Status status = MergeFeeds(batch, total_batch_size, merged_feeds);
+    if (status.IsOK()) {
+      status = session_.RunDirect(run_options, *batch.front()->feed_names, merged_feeds,
+                                  *batch.front()->output_names, &merged_fetches, nullptr, nullptr);
+    }
+    if (status.IsOK()) {
+      status = ScatterFetches(batch, total_batch_size, merged_fetches);
+    }
+
+    if (!status.IsOK()) {
+      for (Request* request : batch) {
+        request->status = status;
+      }
+    }
+  }
+
+  {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    for (Request* request : batch) {
+      request->done = true;
+    }
+  }
+
+  cv_.notify_all();
+}
+
+common::Status DynamicBatcher::Run(const RunOptions& run_options, const std::vector<std::string>& feed_names,
+                                   const std::vector<OrtValue>& feeds, const std::vector<std::string>& output_names,
+                                   std::vector<OrtValue>* p_fetches) {
+  if (!IsBatchable(feeds, *p_fetches)) {
+    return session_.RunDirect(run_options, feed_names, feeds, output_names, p_fetches, nullptr, nullptr);
+  }
+
+  Request request;
+  request.feed_names = &feed_names;
+  request.feeds = &feeds;
+  request.output_names = &output_names;
+  request.fetches = p_fetches;
+  request.batch_size = feeds.front().Get<Tensor>().Shape()[0];
+
+  std::unique_lock<OrtMutex> lock(mutex_);
+
+  // only requests with identical feed/fetch names can share an execution. don't hold up the
+  // forming batch for anything else; just run it on its own.
+  if (!pending_.empty() &&
+      (*pending_.front()->feed_names != feed_names || *pending_.front()->output_names != output_names)) {
+    lock.unlock();
+    return session_.RunDirect(run_options, feed_names, feeds, output_names, p_fetches, nullptr, nullptr);
+  }
+
+  pending_.push_back(&request);
+  pending_batch_size_ += request.batch_size;
+  const bool is_leader = pending_.size() == 1;
+
+  if (!is_leader) {
+    // wake the leader in case this request filled the batch, then wait for our result.
+    // the leader uses the run options of its own request for the merged execution.
+    cv_.notify_all();
+    cv_.wait(lock, [&request]() { return request.done; });
+    return request.status;
+  }
+
+  // leader: wait for peers until the batch is full or the timeout expires
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout_microseconds_);
+  while (pending_batch_size_ < max_batch_size_) {
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= deadline ||
+        cv_.wait_for(lock, deadline - now) == std::cv_status::timeout) {
+      break;
+    }
+  }
+
+  std::vector<Request*> batch = std::move(pending_);
+  pending_.clear();
+  pending_batch_size_ = 0;
+  lock.unlock();
+
+  ExecuteBatch(run_options, batch);
+  return request.status;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/status.h"
+#include "core/framework/allocator.h"
+#include "core/framework/ort_value.h"
+#include "core/framework/run_options.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+class InferenceSession;
+
+/**
+ * Coalesces concurrent InferenceSession::Run() requests into a single execution by concatenating
+ * their feeds along the leading (batch) dimension, running the merged batch once, and scattering
+ * the outputs back to the individual callers.
+ *
+ * The first request to arrive becomes the batch leader and waits up to a configured timeout for
+ * other requests to join before executing. Requests are only merged when they use the same feed
+ * and fetch names, all feeds are CPU tensors of non-string types, and the non-batch dimensions
+ * match; anything else falls back to individual execution.
+ *
+ * Enabled via kOrtSessionOptionsConfigDynamicBatchingMaxBatchSize. Only meaningful for models
+ * where every input and output carries the batch on dimension 0.
+ */
+class DynamicBatcher {
+ public:
+  DynamicBatcher(InferenceSession& session, AllocatorPtr cpu_allocator,
+                 int64_t max_batch_size, int64_t timeout_microseconds);
+
+  /**
+   * Submit a request. Blocks until the (possibly merged) execution that covers this request
+   * completes and p_fetches is populated.
+   */
+  common::Status Run(const RunOptions& run_options, const std::vector<std::string>& feed_names,
+                     const std::vector<OrtValue>& feeds, const std::vector<std::string>& output_names,
+                     std::vector<OrtValue>* p_fetches);
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(DynamicBatcher);
+
+  struct Request {
+    const std::vector<std::string>* feed_names;
+    const std::vector<OrtValue>* feeds;
+    const std::vector<std::string>* output_names;
+    std::vector<OrtValue>* fetches;
+    int64_t batch_size;
+    common::Status status{common::Status::OK()};
+    bool done{false};
+  };
+
+  // true if the request can participate in a merged batch at all
+  static bool IsBatchable(const std::vector<OrtValue>& feeds, const std::vector<OrtValue>& fetches);
+
+  // execute a group of requests as one merged run. on any failure every request in the group
+  // receives the failure status.
+  void ExecuteBatch(const RunOptions& run_options, std::vector<Request*>& batch);
+
+  common::Status MergeFeeds(const std::vector<Request*>& batch, int64_t total_batch_size,
+                            std::vector<OrtValue>& merged_feeds) const;
+  common::Status ScatterFetches(const std::vector<Request*>& batch, int64_t total_batch_size,
+                                const std::vector<OrtValue>& merged_fetches) const;
+
+  InferenceSession& session_;
+  AllocatorPtr cpu_allocator_;
+  const int64_t max_batch_size_;
+  const int64_t timeout_microseconds_;
+
+  OrtMutex mutex_;
+  OrtCondVar cv_;
+  std::vector<Request*> pending_;      // requests waiting to be picked up by the current leader
+  int64_t pending_batch_size_ = 0;     // sum of batch_size over pending_
+};
+
+}  // namespace onnxruntime
@@ -190,6 +190,39 @@ Status Environment::UnregisterAllocator(const OrtMemoryInfo& mem_info) {
   return Status::OK();
 }
 
+void Environment::RegisterSessionConcurrencyWeight(int weight) const {
+  if (weight <= 0) {
+    return;
+  }
+  std::lock_guard<OrtMutex> lock(concurrency_weights_mutex_);
+  total_session_concurrency_weight_ += weight;
+}
+
+void Environment::UnregisterSessionConcurrencyWeight(int weight) const {
+  if (weight <= 0) {
+    return;
+  }
+  std::lock_guard<OrtMutex> lock(concurrency_weights_mutex_);
+  total_session_concurrency_weight_ -= weight;
+}
+
+int Environment::GetSessionRunParallelism(int weight) const {
+  if (weight <= 0 || !intra_op_thread_pool_) {
+    return 0;
+  }
+  int total;
+  {
+    std::lock_guard<OrtMutex> lock(concurrency_weights_mutex_);
+    total = total_session_concurrency_weight_;
+  }
+  // If this session is the only registered one it may use the whole pool.
+  if (total <= weight) {
+    return 0;
+  }
+  int dop = concurrency::ThreadPool::DegreeOfParallelism(intra_op_thread_pool_.get());
+  return std::max(1, dop * weight / total);
+}
+
 Status Environment::Initialize(std::unique_ptr<logging::LoggingManager> logging_manager,
                                const OrtThreadingOptions* tp_options,
                                bool create_global_thread_pools) {
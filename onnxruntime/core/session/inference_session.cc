@@ -4,6 +4,8 @@
 #include "core/graph/onnx_protobuf.h"
 #include "core/session/inference_session.h"
 
+#include <fstream>
+#include <iomanip>
 #include <memory>
 #include <sstream>
 #include <unordered_set>
@@ -13,6 +15,7 @@
 
 #include "core/common/denormal.h"
 #include "core/common/logging/logging.h"
+#include "core/common/optional.h"
 #include "core/common/parse_string.h"
 #include "core/framework/bfc_arena.h"
 #include "core/framework/allocatormgr.h"
@@ -23,15 +26,20 @@
 #include "core/framework/kernel_def_builder.h"
 #include "core/framework/kernel_registry.h"
 #include "core/framework/mldata_type_utils.h"
+#include "core/framework/murmurhash3.h"
 #include "core/framework/session_state_flatbuffers_utils.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/tensor_type_and_shape.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/ort_value_pattern_planner.h"
+#include "core/framework/replay_capture.h"
+#include "core/framework/run_cost_summary.h"
+#include "core/framework/run_priority.h"
 #include "core/framework/utils.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/model.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/optimizer/graph_transformer_utils.h"
 #include "core/optimizer/graph_transformer.h"
 #include "core/optimizer/insert_cast_transformer.h"
@@ -40,6 +48,7 @@
 #include "core/platform/Barrier.h"
 #include "core/platform/ort_mutex.h"
 #include "core/platform/threadpool.h"
+#include "core/platform/tracepoints.h"
 #include "core/providers/cpu/controlflow/utils.h"
 #include "core/providers/cpu/cpu_execution_provider.h"
 #include "core/flatbuffers/flatbuffers_utils.h"
@@ -48,6 +57,7 @@
 #endif
 #include "core/session/environment.h"
 #include "core/session/IOBinding.h"
+#include "core/session/dynamic_batcher.h"
 #include "core/session/inference_session_utils.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
 #include "core/session/onnxruntime_run_options_config_keys.h"
@@ -298,6 +308,14 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
     });
   }
 
+  int worker_nice_value = 0;
+  {
+    std::string nice_value_str =
+        session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigWorkerNiceValue, "0");
+    ORT_ENFORCE(TryParseStringWithClassicLocale(nice_value_str, worker_nice_value),
+                "Invalid value for ", kOrtSessionOptionsConfigWorkerNiceValue, ": ", nice_value_str);
+  }
+
   use_per_session_threads_ = session_options.use_per_session_threads;
 
   if (use_per_session_threads_) {
@@ -320,6 +338,50 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
                              session_options_.execution_mode == ExecutionMode::ORT_SEQUENTIAL &&
                              to.affinity_vec_len == 0;
       to.allow_spinning = allow_intra_op_spinning;
+
+      // explicit per-thread affinity masks, NUMA node binding and SMT sibling avoidance.
+      // these are also reachable from the C API via AddSessionConfigEntry, like the spinning
+      // control above.
+      std::string affinity_str =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigIntraOpThreadAffinities, "");
+      if (!affinity_str.empty()) {
+        std::istringstream thread_entries(affinity_str);
+        std::string thread_entry;
+        while (std::getline(thread_entries, thread_entry, ';')) {
+          std::vector<size_t> mask;
+          std::istringstream cpu_entries(thread_entry);
+          std::string cpu_entry;
+          while (std::getline(cpu_entries, cpu_entry, ',')) {
+            size_t cpu_id = 0;
+            ORT_ENFORCE(TryParseStringWithClassicLocale(cpu_entry, cpu_id),
+                        "Invalid processor id '", cpu_entry, "' in ",
+                        kOrtSessionOptionsConfigIntraOpThreadAffinities, ": ", affinity_str);
+            mask.push_back(cpu_id);
+          }
+          ORT_ENFORCE(!mask.empty(),
+                      "Empty thread entry in ", kOrtSessionOptionsConfigIntraOpThreadAffinities,
+                      ": ", affinity_str);
+          to.affinity_masks.push_back(std::move(mask));
+        }
+        to.auto_set_affinity = false;
+      }
+      std::string numa_node_str =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigIntraOpNumaNode, "-1");
+      ORT_ENFORCE(TryParseStringWithClassicLocale(numa_node_str, to.numa_node),
+                  "Invalid value for ", kOrtSessionOptionsConfigIntraOpNumaNode, ": ", numa_node_str);
+      to.avoid_smt_siblings =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigIntraOpAvoidSmtSiblings, "0") == "1";
+
+      std::string spin_count_str =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigIntraOpSpinCount, "0");
+      ORT_ENFORCE(TryParseStringWithClassicLocale(spin_count_str, to.worker_spin_count),
+                  "Invalid value for ", kOrtSessionOptionsConfigIntraOpSpinCount, ": ", spin_count_str);
+      std::string hot_standby_str =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigIntraOpHotStandbyThreads, "0");
+      ORT_ENFORCE(TryParseStringWithClassicLocale(hot_standby_str, to.num_hot_standby_threads) &&
+                      to.num_hot_standby_threads >= 0,
+                  "Invalid value for ", kOrtSessionOptionsConfigIntraOpHotStandbyThreads, ": ", hot_standby_str);
+      to.worker_nice_value = worker_nice_value;
       thread_pool_ =
           concurrency::CreateThreadPool(&Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
     }
@@ -340,6 +402,7 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
       to.name = inter_thread_pool_name_.c_str();
       to.set_denormal_as_zero = set_denormal_as_zero;
       to.allow_spinning = allow_inter_op_spinning;
+      to.worker_nice_value = worker_nice_value;
       inter_op_thread_pool_ =
           concurrency::CreateThreadPool(&Env::Default(), to, concurrency::ThreadPoolType::INTER_OP);
       if (inter_op_thread_pool_ == nullptr) {
@@ -354,9 +417,19 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
     ORT_ENFORCE(session_env.EnvCreatedWithGlobalThreadPools(),
                 "When the session is not configured to use per session"
                 " threadpools, the env must be created with the the CreateEnvWithGlobalThreadPools API.");
+    {
+      std::string weight_str = session_options_.config_options.GetConfigOrDefault(
+          kOrtSessionOptionsConfigGlobalPoolConcurrencyWeight, "0");
+      int weight = 0;
+      ORT_ENFORCE(TryParseStringWithClassicLocale(weight_str, weight) && weight >= 0,
+                  "Invalid value for ", kOrtSessionOptionsConfigGlobalPoolConcurrencyWeight, ": ", weight_str);
+      global_pool_concurrency_weight_ = weight;
+      environment_.RegisterSessionConcurrencyWeight(global_pool_concurrency_weight_);
+    }
   }
 
   session_profiler_.Initialize(session_logger_);
+  graph_transformation_mgr_.SetProfiler(session_profiler_);
   if (session_options_.enable_profiling) {
     StartProfiling(session_options_.profile_file_prefix);
   }
@@ -466,6 +539,8 @@ InferenceSession::~InferenceSession() {
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   MemoryInfo::GenerateMemoryProfile();
 #endif
+
+  environment_.UnregisterSessionConcurrencyWeight(global_pool_concurrency_weight_);
 }
 
 common::Status InferenceSession::RegisterExecutionProvider(const std::shared_ptr<IExecutionProvider>& p_exec_provider) {
@@ -1049,6 +1124,10 @@ Status InferenceSession::LoadOrtModel(std::function<Status()> load_ort_format_mo
 
   ORT_RETURN_IF_ERROR(load_ort_format_model_bytes());
 
+  return LoadOrtModelFromBytes();
+}
+
+common::Status InferenceSession::LoadOrtModelFromBytes() {
   // Verify the ort_format_model_bytes_ is a valid InferenceSessionBuffer before we access the data
   flatbuffers::Verifier verifier(ort_format_model_bytes_.data(), ort_format_model_bytes_.size());
   ORT_RETURN_IF_NOT(fbs::VerifyInferenceSessionBuffer(verifier), "ORT model verification failed.");
@@ -1077,18 +1156,130 @@ Status InferenceSession::LoadOrtModel(std::function<Status()> load_ort_format_mo
   ORT_RETURN_IF_ERROR(Model::LoadFromOrtFormat(*fbs_model, *session_logger_, tmp_model));
 #endif
 
-  ORT_RETURN_IF_ERROR(SaveModelMetadata(*tmp_model));
-  model_ = std::move(tmp_model);
-
   // Initialize takes the session_mutex_ as well so we need to have released it prior to calling this
   const auto* fbs_sess_state = fbs_session->session_state();
   ORT_RETURN_IF(nullptr == fbs_sess_state, "SessionState is null. Invalid ORT format model.");
 
+  ORT_RETURN_IF_ERROR(SaveModelMetadata(*tmp_model));
+  model_ = std::move(tmp_model);
+
   is_model_loaded_ = true;
 
   return Status::OK();
 }
 
+#if !defined(ORT_MINIMAL_BUILD)
+
+namespace {
+
+// Produces a stable hash of a file's contents without holding more than one chunk in memory.
+Status HashFileContents(const std::basic_string<ORTCHAR_T>& path, uint64_t& hash) {
+  size_t num_bytes = 0;
+  ORT_RETURN_IF_ERROR(Env::Default().GetFileLength(path.c_str(), num_bytes));
+
+  std::ifstream stream(path.c_str(), std::ifstream::in | std::ifstream::binary);
+  std::vector<char> chunk(1 << 20);
+  hash = num_bytes;
+
+  while (num_bytes > 0) {
+    const size_t chunk_bytes = std::min(num_bytes, chunk.size());
+    stream.read(chunk.data(), chunk_bytes);
+    ORT_RETURN_IF_NOT(stream, "Failed to read ", ToMBString(path), " while hashing it.");
+
+    uint64_t chunk_hash[2];
+    MurmurHash3::x86_128(chunk.data(), static_cast<int>(chunk_bytes), static_cast<uint32_t>(hash), chunk_hash);
+    hash = chunk_hash[0] ^ chunk_hash[1];
+    num_bytes -= chunk_bytes;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace
+
+std::basic_string<ORTCHAR_T> InferenceSession::GetOptimizedModelCachePath() const {
+  const std::string cache_dir =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigOptimizedModelCacheDir, "");
+  if (cache_dir.empty()) {
+    return {};
+  }
+
+  if (model_location_.empty()) {
+    LOGS(*session_logger_, WARNING)
+        << "The optimized model cache only supports models loaded from a file. Caching is disabled.";
+    return {};
+  }
+
+  uint64_t model_hash = 0;
+  const Status hash_status = HashFileContents(model_location_, model_hash);
+  if (!hash_status.IsOK()) {
+    LOGS(*session_logger_, WARNING) << "Unable to hash the model for the optimized model cache: "
+                                    << hash_status.ErrorMessage();
+    return {};
+  }
+
+  // A cached artifact is only valid for the exact ORT version, set of execution providers and
+  // optimization level it was produced with, so all of them take part in the key.
+  std::ostringstream key_material;
+  key_material << ORT_VERSION << '|' << static_cast<int>(session_options_.graph_optimization_level);
+  for (const auto& provider : execution_providers_) {
+    key_material << '|' << provider->Type();
+  }
+
+  if (execution_providers_.Get(onnxruntime::kCpuExecutionProvider) == nullptr) {
+    // the default CPU execution provider is always part of the session by the time it initializes
+    key_material << '|' << onnxruntime::kCpuExecutionProvider;
+  }
+
+  const std::string key_material_str = key_material.str();
+  uint64_t config_hash[2];
+  MurmurHash3::x86_128(key_material_str.data(), static_cast<int>(key_material_str.size()), 0, config_hash);
+
+  std::ostringstream filename;
+  filename << "model_" << std::hex << std::setfill('0')
+           << std::setw(16) << model_hash << '_'
+           << std::setw(16) << (config_hash[0] ^ config_hash[1]) << ".ort";
+
+  return ToWideString(cache_dir + "/" + filename.str());
+}
+
+common::Status InferenceSession::TryLoadFromOptimizedModelCache(const std::basic_string<ORTCHAR_T>& cache_path,
+                                                                bool& loaded_from_cache) {
+  loaded_from_cache = false;
+
+  size_t artifact_size = 0;
+  if (!Env::Default().GetFileLength(cache_path.c_str(), artifact_size).IsOK()) {
+    // no artifact for this key yet. one is written once this initialization completes.
+    return Status::OK();
+  }
+
+  std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+
+  const auto original_model_location = model_location_;
+  const auto status = [&]() -> Status {
+    ORT_RETURN_IF_ERROR(LoadOrtModelBytes(cache_path, model_location_,
+                                          ort_format_model_bytes_, ort_format_model_bytes_data_holder_));
+    return LoadOrtModelFromBytes();
+  }();
+
+  if (!status.IsOK()) {
+    // a stale or corrupt artifact must not fail the session; fall back to the full pipeline.
+    LOGS(*session_logger_, WARNING) << "Ignoring unusable optimized model cache artifact "
+                                    << ToMBString(cache_path) << ": " << status.ErrorMessage();
+    ort_format_model_bytes_ = gsl::span<const uint8_t>();
+    ort_format_model_bytes_data_holder_.clear();
+    model_location_ = original_model_location;
+    return Status::OK();
+  }
+
+  LOGS(*session_logger_, INFO) << "Initializing from the optimized model cache.";
+  loaded_from_cache = true;
+
+  return Status::OK();
+}
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
 #endif  // defined(ENABLE_ORT_FORMAT_LOAD)
 
 bool InferenceSession::IsInitialized() const {
@@ -1152,6 +1343,49 @@ common::Status InferenceSession::AddPrePackedWeightsContainer(PrepackedWeightsCo
   return Status::OK();
 }
 
+#if !defined(ORT_MINIMAL_BUILD)
+common::Status InferenceSession::Clone(std::unique_ptr<InferenceSession>& cloned_session) {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+
+    if (!is_inited_) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Session must be initialized before it can be cloned.");
+    }
+  }
+
+  if (session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigEnableSessionCloning, "0") != "1") {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                           "Session cloning must be enabled via ", kOrtSessionOptionsConfigEnableSessionCloning,
+                           " before the session is initialized.");
+  }
+
+  // clones build their own session state against the graph as transformed and partitioned for this
+  // session, so the provider set must match what the clone will register (the default CPU EP).
+  for (const auto& provider : execution_providers_) {
+    if (provider->Type() != onnxruntime::kCpuExecutionProvider) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                             "Session cloning is only supported for sessions using the default CPU "
+                             "execution provider. Found: ",
+                             provider->Type());
+    }
+  }
+
+  auto clone = std::make_unique<InferenceSession>(session_options_, environment_);
+
+  // share the immutable, already optimized model. neither session mutates the graph after
+  // initialization, so the clone can skip the whole load/transform pipeline.
+  clone->model_ = model_;
+  clone->model_location_ = model_location_;
+  clone->is_clone_ = true;
+  clone->is_model_loaded_ = true;
+
+  ORT_RETURN_IF_ERROR_SESSIONID_(clone->Initialize());
+
+  cloned_session = std::move(clone);
+  return Status::OK();
+}
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
 #if defined(ENABLE_ORT_FORMAT_LOAD)
 namespace {
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
@@ -1243,6 +1477,13 @@ common::Status InferenceSession::Initialize() {
     const Env& env = Env::Default();
     env.GetTelemetryProvider().LogSessionCreationStart();
 
+    // Calibrate the MLAS threading thresholds against this machine's measured thread pool
+    // dispatch overhead if the user asked for it. The measurement runs once per process.
+    if (session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigMlasThreadingCalibration, "0") ==
+        "1") {
+      MlasThreadingCalibrate(GetIntraOpThreadPoolToUse());
+    }
+
     bool have_cpu_ep = false;
 
     {
@@ -1261,6 +1502,39 @@ common::Status InferenceSession::Initialize() {
       have_cpu_ep = execution_providers_.Get(onnxruntime::kCpuExecutionProvider) != nullptr;
     }
 
+    // If an optimized-model cache directory is configured, look for an artifact matching this
+    // model, ORT version, execution provider set and optimization level, and swap it in so that
+    // the graph transformation and partitioning work below is skipped. When there is no artifact
+    // for the key yet, one is written at the end of this initialization.
+    std::basic_string<ORTCHAR_T> optimized_model_cache_path;
+    bool loaded_from_optimized_model_cache = false;
+#if !defined(ORT_MINIMAL_BUILD) && defined(ENABLE_ORT_FORMAT_LOAD)
+    if (!is_clone_ && ort_format_model_bytes_.empty()) {
+      optimized_model_cache_path = GetOptimizedModelCachePath();
+      if (!optimized_model_cache_path.empty()) {
+        ORT_RETURN_IF_ERROR_SESSIONID_(
+            TryLoadFromOptimizedModelCache(optimized_model_cache_path, loaded_from_optimized_model_cache));
+      }
+    }
+#endif
+
+    // device graph capture (see enable_cuda_graph) replays the captured kernels of a whole run,
+    // so it is limited to the sequential, single-threaded dispatch path.
+    for (auto& xp : execution_providers_) {
+      if (xp->IsGraphCaptureEnabled()) {
+        if (session_options_.execution_mode != ExecutionMode::ORT_SEQUENTIAL) {
+          return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                                "Device graph capture requires the sequential execution mode.");
+        }
+
+        LOGS(*session_logger_, INFO)
+            << "Device graph capture is enabled for " << xp->Type()
+            << ". This requires static tensor shapes, every node assigned to that provider and "
+               "feeds/fetches bound to the same device buffers across runs.";
+        break;
+      }
+    }
+
     // Verify that there are no external initializers in the graph if external data is disabled.
     onnxruntime::Graph& graph = model_->MainGraph();
 #ifdef DISABLE_EXTERNAL_INITIALIZERS
@@ -1335,6 +1609,8 @@ common::Status InferenceSession::Initialize() {
 
     const bool loading_ort_format = !ort_format_model_bytes_.empty();
     const bool saving_model = !session_options_.optimized_model_filepath.empty();
+    const bool cloning_enabled =
+        session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigEnableSessionCloning, "0") == "1";
     const bool saving_ort_format = [&]() {
       if (saving_model) {
         const std::string model_type = session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigSaveModelFormat, "");
@@ -1345,6 +1621,8 @@ common::Status InferenceSession::Initialize() {
       }
       return false;
     }();
+    const bool saving_to_optimized_model_cache =
+        !optimized_model_cache_path.empty() && !loaded_from_optimized_model_cache;
 
     const experimental::fbs::SessionState* serialized_session_state =
         loading_ort_format
@@ -1353,18 +1631,67 @@ common::Status InferenceSession::Initialize() {
 
 #if !defined(ORT_MINIMAL_BUILD)
     if (!loading_ort_format) {
-      // add predefined transformers
-      AddPredefinedTransformers(graph_transformation_mgr_, session_options_.graph_optimization_level);
+      // a cloned session shares an already transformed and resolved graph, so only the metadata
+      // needs to be captured here
+      if (!is_clone_) {
+        // if only a subset of the declared outputs is consumed by this deployment, prune the graph
+        // to that subset before any optimization or partitioning so nodes that only feed dropped
+        // outputs are neither optimized, planned nor executed.
+        const std::string active_outputs_str =
+            session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigActiveGraphOutputs, "");
+        if (!active_outputs_str.empty()) {
+          const auto& graph_outputs = graph.GetOutputs();
+          std::vector<const NodeArg*> active_outputs;
+          std::istringstream output_entries(active_outputs_str);
+          std::string output_name;
+          while (std::getline(output_entries, output_name, ';')) {
+            if (output_name.empty()) {
+              continue;
+            }
+
+            auto it = std::find_if(graph_outputs.cbegin(), graph_outputs.cend(),
+                                   [&output_name](const NodeArg* node_arg) {
+                                     return node_arg->Name() == output_name;
+                                   });
+            if (it == graph_outputs.cend()) {
+              return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                                    "'" + output_name + "' specified in " +
+                                        kOrtSessionOptionsConfigActiveGraphOutputs +
+                                        " is not an output of the model.");
+            }
+
+            if (std::find(active_outputs.cbegin(), active_outputs.cend(), *it) == active_outputs.cend()) {
+              active_outputs.push_back(*it);
+            }
+          }
+
+          if (active_outputs.empty()) {
+            return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                                  std::string(kOrtSessionOptionsConfigActiveGraphOutputs) +
+                                      " does not name any output of the model.");
+          }
+
+          if (active_outputs.size() < graph_outputs.size()) {
+            LOGS(*session_logger_, INFO) << "Pruning the graph to " << active_outputs.size() << " of "
+                                         << graph_outputs.size() << " declared outputs.";
+            ORT_RETURN_IF_ERROR_SESSIONID_(graph.PruneToOutputs(active_outputs));
+            ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve());
+          }
+        }
+
+        // add predefined transformers
+        AddPredefinedTransformers(graph_transformation_mgr_, session_options_.graph_optimization_level);
 
-      // apply any transformations to the main graph and any subgraphs
-      ORT_RETURN_IF_ERROR_SESSIONID_(TransformGraph(graph, graph_transformation_mgr_,
-                                                    execution_providers_, kernel_registry_manager_,
-                                                    insert_cast_transformer_,
-                                                    *session_state_,
-                                                    saving_ort_format));
+        // apply any transformations to the main graph and any subgraphs
+        ORT_RETURN_IF_ERROR_SESSIONID_(TransformGraph(graph, graph_transformation_mgr_,
+                                                      execution_providers_, kernel_registry_manager_,
+                                                      insert_cast_transformer_,
+                                                      *session_state_,
+                                                      saving_ort_format));
 
-      // now that all the transforms are done, call Resolve on the main graph. this will recurse into the subgraphs.
-      ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve());
+        // now that all the transforms are done, call Resolve on the main graph. this will recurse into the subgraphs.
+        ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve());
+      }
 
       // Update temporary copies of metadata, input- and output definitions to the same state as the resolved graph
       ORT_RETURN_IF_ERROR_SESSIONID_(SaveModelMetadata(*model_));
@@ -1396,12 +1723,23 @@ common::Status InferenceSession::Initialize() {
 #endif
     }
 
+#if !defined(ORT_MINIMAL_BUILD) && defined(ENABLE_ORT_FORMAT_LOAD)
+    if (loaded_from_optimized_model_cache) {
+      // the serialized execution plan records value and node indexes of the deserialized cached
+      // graph, so it is only produced and consumed by sessions initializing from the cache
+      // artifact itself. The first cache hit runs the planner once and writes the plan; later
+      // sessions for the same key skip the planner entirely.
+      session_state_->SetExecutionPlanCachePath(optimized_model_cache_path + ORT_TSTR(".plan"));
+    }
+#endif
+
     ORT_RETURN_IF_ERROR_SESSIONID_(
         session_state_->FinalizeSessionState(model_location_, kernel_registry_manager_,
                                              session_options_,
                                              serialized_session_state,
                                              // need to keep the initializers if saving the optimized model
-                                             !saving_model,
+                                             // or if clones may be created from this session
+                                             !saving_model && !cloning_enabled && !saving_to_optimized_model_cache,
                                              saving_ort_format));
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -1428,9 +1766,101 @@ common::Status InferenceSession::Initialize() {
         ORT_RETURN_IF_ERROR_SESSIONID_(Model::Save(*model_, session_options_.optimized_model_filepath));
       }
     }
+
+#if defined(ENABLE_ORT_FORMAT_LOAD)
+    if (saving_to_optimized_model_cache) {
+      if (session_state_->GetFuncMgr().NumFuncs() > 0) {
+        LOGS(*session_logger_, WARNING)
+            << "Unable to cache the optimized model as it contains compiled nodes.";
+      } else {
+        // the cache is best effort, so a failed write only costs the next session its fast start
+        const Status save_status = SaveToOrtFormat(optimized_model_cache_path);
+        if (!save_status.IsOK()) {
+          LOGS(*session_logger_, WARNING) << "Failed to write the optimized model cache artifact "
+                                          << ToMBString(optimized_model_cache_path) << ": "
+                                          << save_status.ErrorMessage();
+        }
+      }
+    }
+#endif  // defined(ENABLE_ORT_FORMAT_LOAD)
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
     session_state_->ResolveMemoryPatternFlag();
+
+    // set after session state finalization so subgraph session states pick up the flag too
+    if (session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigUsePerRunScratchArena, "0") == "1") {
+      session_state_->SetPerRunScratchArenaEnabled(true);
+    }
+
+    const std::string& bucket_granularity_str = session_options_.config_options.GetConfigOrDefault(
+        kOrtSessionOptionsConfigMemoryPatternBucketGranularity, "0");
+    int64_t bucket_granularity = 0;
+    if (!TryParseStringWithClassicLocale<int64_t>(bucket_granularity_str, bucket_granularity) ||
+        bucket_granularity < 0) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid value for ",
+                             kOrtSessionOptionsConfigMemoryPatternBucketGranularity, ": ", bucket_granularity_str);
+    }
+    if (bucket_granularity > 0) {
+      session_state_->SetMemoryPatternBucketGranularity(bucket_granularity);
+    }
+
+    const std::string& compaction_interval_str = session_options_.config_options.GetConfigOrDefault(
+        kOrtSessionOptionsConfigArenaCompactionIntervalRuns, "0");
+    if (!TryParseStringWithClassicLocale<uint64_t>(compaction_interval_str, arena_compaction_interval_runs_)) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid value for ",
+                             kOrtSessionOptionsConfigArenaCompactionIntervalRuns, ": ", compaction_interval_str);
+    }
+
+    // set up replay capture if the user asked for it
+    replay_capture_file_ = session_options_.config_options.GetConfigOrDefault(
+        kOrtSessionOptionsConfigReplayCaptureFile, "");
+    const std::string& capture_interval_str = session_options_.config_options.GetConfigOrDefault(
+        kOrtSessionOptionsConfigReplayCaptureIntervalRuns, "1");
+    if (!TryParseStringWithClassicLocale<uint64_t>(capture_interval_str, replay_capture_interval_runs_) ||
+        replay_capture_interval_runs_ == 0) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid value for ",
+                             kOrtSessionOptionsConfigReplayCaptureIntervalRuns, ": ", capture_interval_str);
+    }
+
+    // set up runtime activation range tracking if the user asked for it
+    const std::string& range_tracking_runs_str = session_options_.config_options.GetConfigOrDefault(
+        kOrtSessionOptionsConfigActivationRangeTrackingRuns, "0");
+    int64_t range_tracking_runs = 0;
+    if (!TryParseStringWithClassicLocale<int64_t>(range_tracking_runs_str, range_tracking_runs) ||
+        range_tracking_runs < 0) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid value for ",
+                             kOrtSessionOptionsConfigActivationRangeTrackingRuns, ": ", range_tracking_runs_str);
+    }
+    if (range_tracking_runs > 0) {
+      std::string range_file = session_options_.config_options.GetConfigOrDefault(
+          kOrtSessionOptionsConfigActivationRangeTrackingFile, "activation_ranges.json");
+      session_state_->SetActivationRangeRecorder(std::make_unique<ActivationRangeRecorder>(
+          static_cast<size_t>(range_tracking_runs), std::move(range_file)));
+      LOGS(*session_logger_, INFO) << "Activation range tracking enabled for the first "
+                                   << range_tracking_runs << " runs.";
+    }
+
+    // set up cross-request dynamic batching if the user asked for it
+    const std::string& max_batch_str =
+        session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigDynamicBatchingMaxBatchSize, "0");
+    int64_t max_batch_size = 0;
+    if (TryParseStringWithClassicLocale<int64_t>(max_batch_str, max_batch_size) && max_batch_size > 1) {
+      const std::string& timeout_str = session_options_.config_options.GetConfigOrDefault(
+          kOrtSessionOptionsConfigDynamicBatchingTimeoutMicroseconds, "1000");
+      int64_t timeout_microseconds = 1000;
+      if (!TryParseStringWithClassicLocale<int64_t>(timeout_str, timeout_microseconds) || timeout_microseconds < 0) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "Invalid value for ", kOrtSessionOptionsConfigDynamicBatchingTimeoutMicroseconds,
+                               ": ", timeout_str);
+      }
+
+      dynamic_batcher_ = std::make_unique<DynamicBatcher>(
+          *this, session_state_->GetAllocator(OrtMemoryInfo(CPU, OrtDeviceAllocator)),
+          max_batch_size, timeout_microseconds);
+      LOGS(*session_logger_, INFO) << "Dynamic batching enabled with max batch size " << max_batch_size
+                                   << " and timeout " << timeout_microseconds << "us.";
+    }
+
     is_inited_ = true;
 
     // we don't directly use the ORT format bytes currently, so free those now
@@ -1739,7 +2169,23 @@ Status InferenceSession::PartialRun(onnxruntime::RunOptions& run_options,
 Status InferenceSession::Run(const RunOptions& run_options,
                              const std::vector<std::string>& feed_names, const std::vector<OrtValue>& feeds,
                              const std::vector<std::string>& output_names, std::vector<OrtValue>* p_fetches,
-                             const std::vector<OrtDevice>* p_fetches_device_info) {
+                             const std::vector<OrtDevice>* p_fetches_device_info,
+                             FeedsFetchesManager* cached_feeds_fetches_manager) {
+  // route through the dynamic batcher when it's enabled. IOBinding based runs (cached manager) and
+  // runs with explicit fetch device info bypass it as their outputs can't be scattered generically.
+  if (dynamic_batcher_ && cached_feeds_fetches_manager == nullptr && p_fetches_device_info == nullptr) {
+    return dynamic_batcher_->Run(run_options, feed_names, feeds, output_names, p_fetches);
+  }
+
+  return RunDirect(run_options, feed_names, feeds, output_names, p_fetches, p_fetches_device_info,
+                   cached_feeds_fetches_manager);
+}
+
+Status InferenceSession::RunDirect(const RunOptions& run_options,
+                                   const std::vector<std::string>& feed_names, const std::vector<OrtValue>& feeds,
+                                   const std::vector<std::string>& output_names, std::vector<OrtValue>* p_fetches,
+                                   const std::vector<OrtDevice>* p_fetches_device_info,
+                                   FeedsFetchesManager* cached_feeds_fetches_manager) {
   TimePoint tp;
   if (session_profiler_.IsEnabled()) {
     tp = session_profiler_.StartTime();
@@ -1750,6 +2196,7 @@ Status InferenceSession::Run(const RunOptions& run_options,
   ortrun_activity.SetRelatedActivity(session_activity);
   TraceLoggingWriteStart(ortrun_activity, "OrtRun");
 #endif
+  ORT_TRACEPOINT_RUN_BEGIN(run_options.run_tag.c_str());
   Status retval = Status::OK();
   const Env& env = Env::Default();
 
@@ -1758,6 +2205,10 @@ Status InferenceSession::Run(const RunOptions& run_options,
 
   std::vector<AllocatorPtr> arenas_to_shrink;
 
+  // non-null when this run collects a cost breakdown (see kOrtRunOptionsConfigCollectCostBreakdown)
+  RunCostSummary* cost_summary = nullptr;
+  TimePoint cost_summary_start;
+
   ORT_TRY {
     if (!is_inited_) {
       LOGS(*session_logger_, ERROR) << "Session was not initialized";
@@ -1767,8 +2218,15 @@ Status InferenceSession::Run(const RunOptions& run_options,
     // log evaluation start to trace logging provider
     env.GetTelemetryProvider().LogEvaluationStart();
 
-    ORT_RETURN_IF_ERROR_SESSIONID_(ValidateInputs(feed_names, feeds));
-    ORT_RETURN_IF_ERROR_SESSIONID_(ValidateOutputs(output_names, p_fetches));
+    // serialize this request for offline replay if it falls on the capture sampling interval.
+    // a failed capture is diagnostic-only and must never fail the run itself.
+    if (!replay_capture_file_.empty() &&
+        replay_capture_run_count_.fetch_add(1, std::memory_order_relaxed) % replay_capture_interval_runs_ == 0) {
+      const Status capture_status = SaveReplayCapture(replay_capture_file_, feed_names, feeds, run_options);
+      if (!capture_status.IsOK()) {
+        LOGS(*session_logger_, WARNING) << "Replay capture failed: " << capture_status.ErrorMessage();
+      }
+    }
 
     // shrink certain default memory arenas if the user has requested for it
     const std::string& shrink_memory_arenas =
@@ -1778,19 +2236,82 @@ Status InferenceSession::Run(const RunOptions& run_options,
       ORT_RETURN_IF_ERROR_SESSIONID_(ValidateAndParseShrinkArenaString(shrink_memory_arenas, arenas_to_shrink));
     }
 
-    FeedsFetchesInfo info(feed_names, output_names, session_state_->GetOrtValueNameIdxMap());
-    FeedsFetchesManager feeds_fetches_manager{std::move(info)};
+    // turn a user provided time budget into an absolute deadline for this run
+    TimePoint deadline = TimePoint::max();
+    const std::string& deadline_str =
+        run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigRunDeadlineMicroseconds, "");
+
+    if (!deadline_str.empty()) {
+      int64_t deadline_microseconds = 0;
+      if (!TryParseStringWithClassicLocale<int64_t>(deadline_str, deadline_microseconds) ||
+          deadline_microseconds <= 0) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "Invalid value for ", kOrtRunOptionsConfigRunDeadlineMicroseconds,
+                               ": ", deadline_str);
+      }
+
+      deadline = std::chrono::high_resolution_clock::now() + std::chrono::microseconds(deadline_microseconds);
+    }
 
-    if (p_fetches_device_info) {
-      // populate the target device info. ignored if pre-allocated fetches are provided
-      const auto& fetch_device_info = *p_fetches_device_info;
-      auto& fetch_info = feeds_fetches_manager.GetMutableFetchesDeviceCopyInfo();
+    // opt-in coarse cost breakdown for this run. The summary lives on the RunOptions so the
+    // caller can read it back through the RunOptionsGetCostSummary API once Run completes.
+    if (run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigCollectCostBreakdown, "0") == "1") {
+      run_options.cost_summary = std::make_shared<RunCostSummary>();
+      cost_summary = run_options.cost_summary.get();
+      cost_summary_start = std::chrono::high_resolution_clock::now();
+    }
 
-      for (size_t i = 0, end = output_names.size(); i < end; ++i) {
-        fetch_info[i].target_device = fetch_device_info[i];
+    // pick this run's priority lane. A high-priority run is marked in the process-wide gate for
+    // its duration so concurrent low-priority runs yield to it at their kernel boundaries.
+    RunPriority priority = RunPriority::kNormal;
+    const std::string& priority_str =
+        run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigRunPriority, "");
+
+    if (priority_str == "high") {
+      priority = RunPriority::kHigh;
+    } else if (priority_str == "low") {
+      priority = RunPriority::kLow;
+    } else if (!priority_str.empty()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Invalid value for ", kOrtRunOptionsConfigRunPriority, ": ", priority_str);
+    }
+
+    optional<HighPriorityRunScope> high_priority_scope;
+    if (priority == RunPriority::kHigh) {
+      high_priority_scope.emplace();
+    }
+
+    // apply any weight updates staged via StageWeightUpdate since the previous run. Runs already
+    // in flight keep their references to the old buffers until they complete.
+    if (session_state_->ApplyStagedWeightUpdates()) {
+      LOGS(*session_logger_, INFO) << "Applied staged weight updates. Weights version is now "
+                                   << session_state_->GetWeightsVersion();
+    }
+
+    // a cached manager was resolved and validated when it was created, so skip that work here
+    std::unique_ptr<FeedsFetchesManager> local_ffm;
+    FeedsFetchesManager* p_feeds_fetches_manager = cached_feeds_fetches_manager;
+    if (!p_feeds_fetches_manager) {
+      ORT_RETURN_IF_ERROR_SESSIONID_(ValidateInputs(feed_names, feeds));
+      ORT_RETURN_IF_ERROR_SESSIONID_(ValidateOutputs(output_names, p_fetches));
+
+      ORT_RETURN_IF_ERROR_SESSIONID_(FeedsFetchesManager::Create(feed_names, output_names,
+                                                                 session_state_->GetOrtValueNameIdxMap(), local_ffm));
+      p_feeds_fetches_manager = local_ffm.get();
+
+      if (p_fetches_device_info) {
+        // populate the target device info. ignored if pre-allocated fetches are provided
+        const auto& fetch_device_info = *p_fetches_device_info;
+        auto& fetch_info = p_feeds_fetches_manager->GetMutableFetchesDeviceCopyInfo();
+
+        for (size_t i = 0, end = output_names.size(); i < end; ++i) {
+          fetch_info[i].target_device = fetch_device_info[i];
+        }
       }
     }
 
+    FeedsFetchesManager& feeds_fetches_manager = *p_feeds_fetches_manager;
+
     if (!run_options.run_tag.empty()) {
       LOGS(*session_logger_, INFO) << "Running with tag: " << run_options.run_tag;
     }
@@ -1827,9 +2348,38 @@ Status InferenceSession::Run(const RunOptions& run_options,
 #ifdef DEBUG_NODE_INPUTS_OUTPUTS
     session_state_->IncrementGraphExecutionCounter();
 #endif
-    ORT_CHECK_AND_SET_RETVAL(utils::ExecuteGraph(*session_state_, feeds_fetches_manager, feeds, *p_fetches,
-                                                 session_options_.execution_mode, run_options.terminate, run_logger,
-                                                 run_options.only_execute_path_to_fetches));
+    // When sharing the global thread pool with other weighted sessions, cap the parallelism of
+    // loops started by this run at the session's proportional share of the pool.
+    concurrency::ThreadPool::ParallelismCapScope parallelism_cap(
+        environment_.GetSessionRunParallelism(global_pool_concurrency_weight_));
+
+    // when an execution provider has captured the whole model into a device graph (see
+    // enable_cuda_graph), replay it instead of dispatching the kernels again. The feeds and
+    // fetches must be bound to the same device buffers as the captured run, so this requires
+    // the caller to use IOBinding.
+    IExecutionProvider* graph_replay_provider = nullptr;
+    for (auto& xp : execution_providers_) {
+      if (xp->IsGraphCaptureEnabled() && xp->IsGraphCaptured()) {
+        graph_replay_provider = xp.get();
+        break;
+      }
+    }
+
+    if (graph_replay_provider != nullptr) {
+      ORT_CHECK_AND_SET_RETVAL(graph_replay_provider->ReplayGraph());
+    } else {
+      ORT_CHECK_AND_SET_RETVAL(utils::ExecuteGraph(*session_state_, feeds_fetches_manager, feeds, *p_fetches,
+                                                   session_options_.execution_mode, run_options.terminate, run_logger,
+                                                   run_options.only_execute_path_to_fetches, deadline,
+                                                   cost_summary, priority));
+    }
+
+    if (cost_summary != nullptr) {
+      cost_summary->SetTotalTime(
+          static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::high_resolution_clock::now() - cost_summary_start)
+                                    .count()));
+    }
   }
   ORT_CATCH(const std::exception& e) {
     ORT_HANDLE_EXCEPTION([&]() {
@@ -1850,21 +2400,40 @@ Status InferenceSession::Run(const RunOptions& run_options,
     ShrinkMemoryArenas(arenas_to_shrink);
   }
 
+  // count this run towards activation range tracking; the run that completes the configured
+  // number writes the range file.
+  {
+    ActivationRangeRecorder* range_recorder = session_state_->GetActivationRangeRecorder();
+    if (range_recorder != nullptr && range_recorder->IsActive()) {
+      ORT_CHECK_AND_SET_RETVAL(range_recorder->OnRunEnd());
+    }
+  }
+
+  // periodic arena compaction, if configured. fetch_add ensures exactly one of any
+  // concurrent Run() calls in each interval pays for the pass.
+  if (arena_compaction_interval_runs_ > 0 &&
+      completed_run_count_.fetch_add(1, std::memory_order_relaxed) % arena_compaction_interval_runs_ ==
+          arena_compaction_interval_runs_ - 1) {
+    CompactMemoryArenas();
+  }
+
   --current_num_runs_;
 
-  // keep track of telemetry
-  ++telemetry_.total_runs_since_last_;
-  telemetry_.total_run_duration_since_last_ += TimeDiffMicroSeconds(tp);
+  // keep track of telemetry. relaxed atomics keep concurrent Run() calls from serializing here.
+  telemetry_.total_runs_since_last_.fetch_add(1, std::memory_order_relaxed);
+  telemetry_.total_run_duration_since_last_.fetch_add(TimeDiffMicroSeconds(tp), std::memory_order_relaxed);
 
   // time to send telemetry?
   if (TimeDiffMicroSeconds(telemetry_.time_sent_last_) > telemetry_.kDurationBetweenSending) {
-    // send the telemetry
-    env.GetTelemetryProvider().LogRuntimePerf(session_id_, telemetry_.total_runs_since_last_,
-                                              telemetry_.total_run_duration_since_last_);
-    // reset counters
-    telemetry_.time_sent_last_ = std::chrono::high_resolution_clock::now();
-    telemetry_.total_runs_since_last_ = 0;
-    telemetry_.total_run_duration_since_last_ = 0;
+    bool expected = false;
+    // only one concurrent Run() thread gets to send the report and reset the counters
+    if (telemetry_.sending_.compare_exchange_strong(expected, true)) {
+      env.GetTelemetryProvider().LogRuntimePerf(session_id_,
+                                                telemetry_.total_runs_since_last_.exchange(0),
+                                                telemetry_.total_run_duration_since_last_.exchange(0));
+      telemetry_.time_sent_last_ = std::chrono::high_resolution_clock::now();
+      telemetry_.sending_.store(false);
+    }
   }
 
   // log evaluation stop to trace logging provider
@@ -1877,6 +2446,7 @@ Status InferenceSession::Run(const RunOptions& run_options,
 #ifdef ONNXRUNTIME_ENABLE_INSTRUMENT
   TraceLoggingWriteStop(ortrun_activity, "OrtRun");
 #endif
+  ORT_TRACEPOINT_RUN_END(run_options.run_tag.c_str());
   return retval;
 }
 
@@ -1966,11 +2536,60 @@ common::Status InferenceSession::NewIOBinding(std::unique_ptr<IOBinding>* io_bin
   return Status::OK();
 }
 
+common::Status InferenceSession::StageWeightUpdate(const std::string& name, const OrtValue& new_value) {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+    if (!is_inited_) {
+      LOGS(*session_logger_, ERROR) << "Session was not initialized";
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+    }
+  }
+
+  return session_state_->StageWeightUpdate(name, new_value);
+}
+
+common::Status InferenceSession::WarmUp() const {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+    if (!is_inited_) {
+      LOGS(*session_logger_, ERROR) << "Session was not initialized";
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+    }
+  }
+
+  session_state_->WarmUpMemory();
+  return Status::OK();
+}
+
 common::Status InferenceSession::Run(const RunOptions& run_options, IOBinding& io_binding) {
   // TODO should Run() call io_binding.SynchronizeInputs() or should it let the callers do it?
   // io_binding.SynchronizeInputs();
+
+  // validate the bindings and resolve names to internal indices once, then replay the cached state on
+  // subsequent Run calls with this binding. the cache is invalidated if the set of bound names changes.
+  FeedsFetchesManager* cached_ffm = io_binding.GetCachedFeedsFetchesManager();
+  if (!cached_ffm) {
+    ORT_RETURN_IF_ERROR_SESSIONID_(ValidateInputs(io_binding.GetInputNames(), io_binding.GetInputs()));
+    ORT_RETURN_IF_ERROR_SESSIONID_(ValidateOutputs(io_binding.GetOutputNames(), &io_binding.GetOutputs()));
+
+    std::unique_ptr<FeedsFetchesManager> ffm;
+    ORT_RETURN_IF_ERROR_SESSIONID_(FeedsFetchesManager::Create(io_binding.GetInputNames(),
+                                                               io_binding.GetOutputNames(),
+                                                               session_state_->GetOrtValueNameIdxMap(), ffm));
+
+    // populate the target device info. ignored if pre-allocated fetches are provided
+    const auto& fetch_device_info = io_binding.GetOutputsDeviceInfo();
+    auto& fetch_info = ffm->GetMutableFetchesDeviceCopyInfo();
+    for (size_t i = 0, end = fetch_device_info.size(); i < end; ++i) {
+      fetch_info[i].target_device = fetch_device_info[i];
+    }
+
+    io_binding.SetCachedFeedsFetchesManager(std::move(ffm));
+    cached_ffm = io_binding.GetCachedFeedsFetchesManager();
+  }
+
   return Run(run_options, io_binding.GetInputNames(), io_binding.GetInputs(), io_binding.GetOutputNames(),
-             &io_binding.GetOutputs(), &io_binding.GetOutputsDeviceInfo());
+             &io_binding.GetOutputs(), nullptr, cached_ffm);
 }
 
 common::Status InferenceSession::Run(IOBinding& io_binding) {
@@ -2016,6 +2635,50 @@ const profiling::Profiler& InferenceSession::GetProfiling() const {
   return session_profiler_;
 }
 
+std::string InferenceSession::GetOpTypeStats() const {
+  const OpStatsCollector* op_stats = is_inited_ ? session_state_->GetOpStatsCollector() : nullptr;
+  if (op_stats == nullptr) {
+    return "{}";
+  }
+
+  std::ostringstream oss;
+  oss << "{";
+  bool first = true;
+  for (const auto& entry : op_stats->Aggregate()) {
+    if (!first) {
+      oss << ",";
+    }
+    first = false;
+    const auto& stats = entry.second;
+    oss << "\"" << entry.first << "\":{\"count\":" << stats.count
+        << ",\"total_ns\":" << stats.total_ns
+        << ",\"total_bytes\":" << stats.total_bytes << "}";
+  }
+  oss << "}";
+  return oss.str();
+}
+
+std::string InferenceSession::GetIntraOpThreadPoolStats() const {
+  const concurrency::ThreadPoolStats stats = concurrency::ThreadPool::GetStats(GetIntraOpThreadPoolToUse());
+  if (stats.num_threads == 0) {
+    return "{}";
+  }
+
+  std::ostringstream oss;
+  oss << "{\"num_threads\":" << stats.num_threads
+      << ",\"tasks_executed\":" << stats.tasks_executed
+      << ",\"steals\":" << stats.steals
+      << ",\"parks\":" << stats.parks
+      << ",\"unparks\":" << stats.unparks
+      << ",\"blocked_threads\":" << stats.blocked_threads
+      << ",\"queue_depth\":" << stats.queue_depth << "}";
+  return oss.str();
+}
+
+void InferenceSession::ResetIntraOpThreadPoolStats() {
+  concurrency::ThreadPool::ResetStats(GetIntraOpThreadPoolToUse());
+}
+
 AllocatorPtr InferenceSession::GetAllocator(const OrtMemoryInfo& mem_info) const {
   return session_state_->GetAllocator(mem_info);
 }
@@ -2080,7 +2743,7 @@ common::Status InferenceSession::ValidateAndParseShrinkArenaString(const std::st
 
 void InferenceSession::ShrinkMemoryArenas(const std::vector<AllocatorPtr>& arenas_to_shrink) {
   for (auto& alloc : arenas_to_shrink) {
-    auto status = static_cast<BFCArena*>(alloc.get())->Shrink();
+    auto status = alloc->Shrink();
 
     if (!status.IsOK()) {
       LOGS(*session_logger_, WARNING) << "Unable to shrink arena: " << alloc->Info().ToString()
@@ -2089,6 +2752,23 @@ void InferenceSession::ShrinkMemoryArenas(const std::vector<AllocatorPtr>& arena
   }
 }
 
+void InferenceSession::CompactMemoryArenas() {
+  for (const auto& provider : execution_providers_) {
+    for (const auto& alloc : provider->GetAllocators()) {
+      if (alloc->Info().alloc_type != OrtAllocatorType::OrtArenaAllocator) {
+        continue;
+      }
+
+      auto status = alloc->Compact();
+
+      if (!status.IsOK()) {
+        LOGS(*session_logger_, WARNING) << "Unable to compact arena: " << alloc->Info().ToString()
+                                        << " error message: " << status.ErrorMessage();
+      }
+    }
+  }
+}
+
 #if !defined(ORT_MINIMAL_BUILD)
 // assumes model has already been loaded before
 common::Status InferenceSession::DoPostLoadProcessing(onnxruntime::Model& model) {
@@ -2230,7 +2910,8 @@ void InferenceSession::AddPredefinedTransformers(GraphTransformerManager& transf
     if (graph_optimization_level >= level) {
       // Generate and register transformers for level
       auto transformers_to_register = optimizer_utils::GenerateTransformers(level, session_options_, cpu_ep,
-                                                                            optimizers_to_disable_);
+                                                                            optimizers_to_disable_,
+                                                                            GetIntraOpThreadPoolToUse());
       for (auto& entry : transformers_to_register) {
         transformer_manager.Register(std::move(entry), level);
       }
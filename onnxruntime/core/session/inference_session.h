@@ -51,6 +51,7 @@ namespace onnxruntime {
 class IExecutionProvider;  // forward decl
 class IOBinding;
 class CustomRegistry;
+class DynamicBatcher;
 struct Notification;
 
 namespace logging {
@@ -269,10 +270,18 @@ class InferenceSession {
     */
   common::Status Initialize() ORT_MUST_USE_RESULT;
 
+  /**
+    * Run a pre-loaded and pre-intialized model.
+    * @param cached_feeds_fetches_manager optional pre-resolved feed/fetch state for the given names.
+    *        When provided, per-Run name-to-index resolution and input/output validation are skipped;
+    *        the caller is responsible for the names and values matching the state the manager was
+    *        created and validated with. Used by the IOBinding based Run overload.
+    */
   common::Status Run(const RunOptions& run_options, const std::vector<std::string>& feed_names,
                      const std::vector<OrtValue>& feeds, const std::vector<std::string>& output_names,
                      std::vector<OrtValue>* p_fetches,
-                     const std::vector<OrtDevice>* p_fetches_device_info = nullptr) ORT_MUST_USE_RESULT;
+                     const std::vector<OrtDevice>* p_fetches_device_info = nullptr,
+                     FeedsFetchesManager* cached_feeds_fetches_manager = nullptr) ORT_MUST_USE_RESULT;
 
   /**
     * Run a pre-loaded and pre-intialized model.
@@ -306,6 +315,30 @@ class InferenceSession {
   virtual common::Status Run(const RunOptions& run_options, IOBinding& io_binding) ORT_MUST_USE_RESULT;
   common::Status Run(IOBinding& io_binding) ORT_MUST_USE_RESULT;
 
+  /**
+    * Stage a replacement value for a model weight so a new model version can be rolled out
+    * without loading a second session. The new value must match the existing initializer's data
+    * type, shape and device. Staged updates are swapped in atomically (all of them at once) at
+    * the start of a subsequent Run; runs already in flight keep the previous weights until they
+    * complete, at which point the old buffers are released. Initializers that a kernel consumes
+    * through a pre-packed form cannot be updated and are rejected.
+    * Can be called while other threads are inside Run.
+    * @param name name of the initializer to update.
+    * @param new_value tensor holding the replacement data. A reference is held until the update
+    *        is superseded or the session is destroyed; the caller may release its own reference.
+    */
+  common::Status StageWeightUpdate(const std::string& name, const OrtValue& new_value) ORT_MUST_USE_RESULT;
+
+  /**
+    * Fault the session's weight memory back in ahead of a Run. Touches every CPU initializer
+    * buffer and the shared pre-packed weight buffers (including cache files that were
+    * memory-mapped at load), so pages the OS reclaimed during an idle period don't have to be
+    * re-faulted - and the weights re-fetched from memory - inside the first request afterwards.
+    * Intended to be called from a health-check or keep-alive path. Safe to call concurrently
+    * with Run.
+    */
+  common::Status WarmUp() const ORT_MUST_USE_RESULT;
+
 #ifdef ENABLE_TRAINING
   /**
   * Partially run a pre-loaded and pre-intialized model.
@@ -410,6 +443,28 @@ class InferenceSession {
     */
   const profiling::Profiler& GetProfiling() const;
 
+  /**
+    * Serialize the aggregated per-op-type execution statistics collected when the session was
+    * created with the session.collect_op_stats config entry set to "1". Safe to call while
+    * other threads are running inference.
+    @return a JSON object keyed by op type, or an empty JSON object if collection is disabled.
+    */
+  std::string GetOpTypeStats() const;
+
+  /**
+    * Serialize the always-on activity counters of the intra-op thread pool this session uses.
+    * Safe to call while other threads are running inference.
+    @return a JSON object with the counters, or an empty JSON object when work runs inline.
+    */
+  std::string GetIntraOpThreadPoolStats() const;
+
+  /**
+    * Reset the intra-op thread pool counters so that subsequent GetIntraOpThreadPoolStats calls
+    * report activity since this point. Note that a pool shared across sessions (when
+    * use_per_session_threads is false) is reset for all of them.
+    */
+  void ResetIntraOpThreadPoolStats();
+
   /**
     * Search registered execution providers for an allocator that has characteristics
     * specified within mem_info
@@ -439,6 +494,21 @@ class InferenceSession {
     */
   Status AddPrePackedWeightsContainer(PrepackedWeightsContainer* prepacked_weights_container);
 
+#if !defined(ORT_MINIMAL_BUILD)
+  /**
+    * Create a new session that shares this session's loaded and already optimized model.
+    * The clone skips the whole load pipeline (protobuf parse, graph resolve, graph transformations)
+    * and only builds its own mutable state (session state, kernels, allocation plan), so it is
+    * orders of magnitude cheaper to create than a session loaded from scratch.
+    * Requires kOrtSessionOptionsConfigEnableSessionCloning to have been set when this session was
+    * created, and this session must be initialized. Only supported for sessions using the default
+    * CPU execution provider, as clones run against the graph as partitioned for this session.
+    * @param cloned_session output parameter that receives the new, initialized session.
+    * @return OK if success.
+    */
+  common::Status Clone(std::unique_ptr<InferenceSession>& cloned_session) ORT_MUST_USE_RESULT;
+#endif
+
  protected:
 #if !defined(ORT_MINIMAL_BUILD)
   /**
@@ -497,6 +567,9 @@ class InferenceSession {
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(InferenceSession);
 
+  // executes merged batches through RunDirect
+  friend class DynamicBatcher;
+
   void ConstructorCommon(const SessionOptions& session_options,
                          const Environment& session_env);
 
@@ -537,6 +610,20 @@ class InferenceSession {
 
   common::Status LoadOrtModel(std::function<Status()> load_ort_format_model_bytes) ORT_MUST_USE_RESULT;
 
+  // Loads the model from the already populated ort_format_model_bytes_.
+  common::Status LoadOrtModelFromBytes() ORT_MUST_USE_RESULT;
+
+#if !defined(ORT_MINIMAL_BUILD)
+  // Returns the optimized-model cache artifact path for the loaded model when the cache is
+  // enabled and the model can be keyed, otherwise an empty string.
+  std::basic_string<ORTCHAR_T> GetOptimizedModelCachePath() const;
+
+  // Replaces the in-memory model with the cached ORT format artifact at cache_path if one exists.
+  // A stale or unreadable artifact is ignored so initialization falls back to the full pipeline.
+  common::Status TryLoadFromOptimizedModelCache(const std::basic_string<ORTCHAR_T>& cache_path,
+                                                bool& loaded_from_cache) ORT_MUST_USE_RESULT;
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
 #endif  // defined(ENABLE_ORT_FORMAT_LOAD)
 
   // Create a Logger for a single execution if possible. Otherwise use the default logger.
@@ -558,6 +645,14 @@ class InferenceSession {
   common::Status ValidateOutputs(const std::vector<std::string>& output_names,
                                  const std::vector<OrtValue>* p_fetches) const ORT_MUST_USE_RESULT;
 
+  // The run implementation behind the public Run overloads. Bypasses the dynamic batcher, which
+  // uses it to execute a merged batch (DynamicBatcher is a friend for that reason).
+  common::Status RunDirect(const RunOptions& run_options, const std::vector<std::string>& feed_names,
+                           const std::vector<OrtValue>& feeds, const std::vector<std::string>& output_names,
+                           std::vector<OrtValue>* p_fetches,
+                           const std::vector<OrtDevice>* p_fetches_device_info,
+                           FeedsFetchesManager* cached_feeds_fetches_manager) ORT_MUST_USE_RESULT;
+
   common::Status WaitForNotification(Notification* p_executor_done, int64_t timeout_in_ms) ORT_MUST_USE_RESULT;
 
   template <typename T>
@@ -582,6 +677,14 @@ class InferenceSession {
    */
   void ShrinkMemoryArenas(const std::vector<AllocatorPtr>& arenas_to_shrink);
 
+  /*
+   * Compacts every arena based allocator registered with the session's execution providers,
+   * returning all allocation regions that hold no live allocation to the system.
+   * Invoked automatically from Run() when kOrtSessionOptionsConfigArenaCompactionIntervalRuns
+   * is configured.
+   */
+  void CompactMemoryArenas();
+
 #if !defined(ORT_MINIMAL_BUILD)
   virtual void AddPredefinedTransformers(GraphTransformerManager& transformer_manager,
                                          TransformerLevel graph_optimization_level);
@@ -629,6 +732,10 @@ class InferenceSession {
   onnxruntime::concurrency::ThreadPool* intra_op_thread_pool_from_env_{};
   onnxruntime::concurrency::ThreadPool* inter_op_thread_pool_from_env_{};
 
+  // This session's weight for the environment's global thread pool concurrency governor, or 0 if
+  // the session is ungoverned. Registered with the environment while the session is alive.
+  int global_pool_concurrency_weight_{0};
+
   // initialized from session options
   // Determines which threadpools will be intialized and used for the duration of this session.
   // If true, use the per session ones, or else the global threadpools.
@@ -665,12 +772,36 @@ class InferenceSession {
   // Data transfer manager.
   DataTransferManager data_transfer_mgr_;
 
+  // Optional cross-request dynamic batching engine. Created during Initialize when
+  // kOrtSessionOptionsConfigDynamicBatchingMaxBatchSize is configured to a value greater than 1.
+  std::unique_ptr<DynamicBatcher> dynamic_batcher_;
+
   // Number of concurrently running executors
   std::atomic<int> current_num_runs_;
 
+  // Compact the session's memory arenas after every this many completed Run() calls.
+  // 0 (the default) disables automatic compaction. Set during Initialize from
+  // kOrtSessionOptionsConfigArenaCompactionIntervalRuns.
+  uint64_t arena_compaction_interval_runs_ = 0;
+  // Number of completed Run() calls, used to pace automatic arena compaction.
+  std::atomic<uint64_t> completed_run_count_{0};
+
+  // Replay capture, set during Initialize from kOrtSessionOptionsConfigReplayCaptureFile and
+  // kOrtSessionOptionsConfigReplayCaptureIntervalRuns. When the file path is non-empty, every
+  // replay_capture_interval_runs_-th Run() serializes its feeds and run options to the file.
+  std::string replay_capture_file_;
+  uint64_t replay_capture_interval_runs_ = 1;
+  // Number of Run() calls seen by the capture sampler.
+  std::atomic<uint64_t> replay_capture_run_count_{0};
+
   mutable onnxruntime::OrtMutex session_mutex_;  // to ensure only one thread can invoke Load/Initialize
-  bool is_model_loaded_ = false;                 // GUARDED_BY(session_mutex_)
-  bool is_inited_ = false;                       // GUARDED_BY(session_mutex_)
+  // written under session_mutex_ but read lock-free from the Run() hot path,
+  // so concurrent Run() calls never touch session_mutex_
+  std::atomic<bool> is_model_loaded_{false};
+  std::atomic<bool> is_inited_{false};
+  // true if this session was created via Clone() and shares another session's optimized model.
+  // Initialize() then skips the graph transformation/resolve steps as they have already run.
+  bool is_clone_ = false;
 
 #ifdef ENABLE_LANGUAGE_INTEROP_OPS
   InterOpDomains interop_domains_;
@@ -681,11 +812,13 @@ class InferenceSession {
 
   struct Telemetry {
     Telemetry() : time_sent_last_() {}
-    uint32_t total_runs_since_last_ = 0;           // the total number of Run() calls since the last report
-    long long total_run_duration_since_last_ = 0;  // the total duration (us) of Run() calls since the last report
-    std::string event_name_;                       // where the model is loaded from: ["model_loading_uri", "model_loading_proto", "model_loading_istream"]
+    // counters are updated with relaxed atomics so concurrent Run() calls don't serialize on them
+    std::atomic<uint32_t> total_runs_since_last_{0};           // the total number of Run() calls since the last report
+    std::atomic<long long> total_run_duration_since_last_{0};  // the total duration (us) of Run() calls since the last report
+    std::string event_name_;                                   // where the model is loaded from: ["model_loading_uri", "model_loading_proto", "model_loading_istream"]
 
-    TimePoint time_sent_last_;  // the TimePoint of the last report
+    std::atomic<bool> sending_{false};  // ensures only one Run() thread sends/resets a report
+    TimePoint time_sent_last_;          // the TimePoint of the last report. only written by the thread that won sending_
     // Event Rate per provider < 20 peak events per second
     constexpr static long long kDurationBetweenSending = 1000 * 1000 * 60 * 10;  // duration in (us).  send a report every 10 mins
   } telemetry_;
@@ -6,8 +6,11 @@
 #include "core/session/inference_session_utils.h"
 #include "core/session/IOBinding.h"
 #include "core/framework/allocator.h"
+#include "core/framework/allocator_stats.h"
 #include "core/framework/error_code_helper.h"
 #include "core/framework/execution_provider.h"
+#include "core/framework/random_seed.h"
+#include "core/framework/run_cost_summary.h"
 #include "core/framework/tensor_type_and_shape.h"
 #include "core/framework/utils.h"
 #include <cassert>
@@ -36,6 +39,11 @@
 #include "abi_session_options_impl.h"
 #include "core/framework/TensorSeq.h"
 #include "core/platform/ort_mutex.h"
+#include "core/platform/threadpool.h"
+
+#ifdef ENABLE_TRAINING
+#include "core/dlpack/dlpack_converter.h"
+#endif
 
 #ifdef USE_CUDA
 #include "core/providers/cuda/cuda_provider_factory.h"
@@ -216,6 +224,41 @@ ORT_API_STATUS_IMPL(OrtApis::CreateTensorWithDataAsOrtValue, _In_ const OrtMemor
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::RebindTensorWithDataAsOrtValue, _Inout_ OrtValue* value,
+                    _In_ const OrtMemoryInfo* info, _Inout_ void* p_data, size_t p_data_len,
+                    _In_ const int64_t* shape, size_t shape_len, ONNXTensorElementDataType type) {
+  API_IMPL_BEGIN
+  auto ml_type = DataTypeImpl::TensorTypeFromONNXEnum(type)->GetElementType();
+  if (!value->IsAllocated()) {
+    return CreateTensorImpl(ml_type, shape, shape_len, info, p_data, p_data_len, *value);
+  }
+  if (!value->IsTensor()) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "only an OrtValue holding a tensor can be rebound");
+  }
+
+  TensorShape tensor_shape(shape, shape_len);
+  if (std::any_of(tensor_shape.GetDims().cbegin(), tensor_shape.GetDims().cend(), [](int64_t v) { return v < 0; })) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "tried creating tensor with negative value in shape");
+  }
+
+  auto elem_count = gsl::narrow<size_t>(tensor_shape.Size());
+  size_t size_required;
+  if (!IAllocator::CalcMemSizeForArray(ml_type->Size(), elem_count, &size_required)) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "size overflow");
+  }
+  if (size_required > p_data_len) {
+    std::ostringstream oss;
+    oss << "not enough space: expected " << size_required << ", got " << p_data_len;
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, oss.str().c_str());
+  }
+
+  // Move-assigning over the existing tensor releases any buffer it owned and reuses both the
+  // OrtValue and the heap Tensor it wraps, so a slot rebound per request allocates nothing.
+  *value->GetMutable<Tensor>() = Tensor(ml_type, tensor_shape, p_data, *info);
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::CreateTensorAsOrtValue, _Inout_ OrtAllocator* allocator,
                     _In_ const int64_t* shape, size_t shape_len, ONNXTensorElementDataType type,
                     _Outptr_ OrtValue** out) {
@@ -749,6 +792,135 @@ ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRu
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::RunAsync, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _In_reads_(input_len) const char* const* input_names,
+                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                    _Inout_updates_all_(output_names_len) OrtValue** output,
+                    _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+
+  // prefer the inter-op pool so async requests don't compete with intra-op parallelism of the runs
+  // they queue behind. fall back to the intra-op pool for sessions without one.
+  auto* tp = session->GetInterOpThreadPoolToUse();
+  if (tp == nullptr) {
+    tp = session->GetIntraOpThreadPoolToUse();
+  }
+
+  if (tp == nullptr) {
+    return OrtApis::CreateStatus(ORT_FAIL, "RunAsync requires the session to have a thread pool to schedule the request on");
+  }
+
+  if (run_async_callback == nullptr) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "run_async_callback cannot be null");
+  }
+
+  const int queue_id = 0;
+
+  // copy everything the run needs up front as the caller's arrays (other than 'output') may be
+  // freed once this call returns
+  std::vector<std::string> feed_names(input_len);
+  std::vector<OrtValue> feeds(input_len);
+
+  for (size_t i = 0; i != input_len; ++i) {
+    if (input_names[i] == nullptr || input_names[i][0] == '\0') {
+      return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "input name cannot be empty");
+    }
+
+    feed_names[i] = input_names[i];
+    auto& ort_value = feeds[i] = *reinterpret_cast<const ::OrtValue*>(input[i]);
+
+    if (ort_value.Fence()) ort_value.Fence()->BeforeUsingAsInput(onnxruntime::kCpuExecutionProvider, queue_id);
+  }
+
+  std::vector<std::string> output_names(output_names_len);
+  for (size_t i = 0; i != output_names_len; ++i) {
+    if (output_names1[i] == nullptr || output_names1[i][0] == '\0') {
+      return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "output name cannot be empty");
+    }
+    output_names[i] = output_names1[i];
+  }
+
+  std::vector<OrtValue> fetches(output_names_len);
+  for (size_t i = 0; i != output_names_len; ++i) {
+    if (output[i] != nullptr) {
+      ::OrtValue& value = *(output[i]);
+      if (value.Fence())
+        value.Fence()->BeforeUsingAsOutput(onnxruntime::kCpuExecutionProvider, queue_id);
+      fetches[i] = value;
+    }
+  }
+
+  OrtRunOptions run_options_copy = run_options != nullptr ? *run_options : OrtRunOptions{};
+
+  onnxruntime::concurrency::ThreadPool::Schedule(
+      tp,
+      [session, run_options = std::move(run_options_copy), feed_names = std::move(feed_names),
+       feeds = std::move(feeds), output_names = std::move(output_names), fetches = std::move(fetches),
+       output, output_names_len, run_async_callback, user_data, queue_id]() mutable {
+        Status status = session->Run(run_options, feed_names, feeds, output_names, &fetches, nullptr);
+
+        if (status.IsOK()) {
+          for (size_t i = 0; i != output_names_len; ++i) {
+            ::OrtValue& value = fetches[i];
+            if (value.Fence())
+              value.Fence()->BeforeUsingAsInput(onnxruntime::kCpuExecutionProvider, queue_id);
+            if (output[i] == nullptr) {
+              output[i] = new OrtValue(value);
+            }
+          }
+        }
+
+        run_async_callback(user_data, output, output_names_len, ToOrtStatus(status));
+      });
+
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::CreateValueFromDlpack, _In_ struct DLManagedTensor* dlmanaged_tensor, int is_bool_tensor,
+                    _Outptr_ OrtValue** out) {
+  API_IMPL_BEGIN
+#ifdef ENABLE_TRAINING
+  if (dlmanaged_tensor == nullptr) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "dlmanaged_tensor cannot be null");
+  }
+
+  auto value = std::make_unique<OrtValue>(onnxruntime::dlpack::DlpackToOrtValue(dlmanaged_tensor, is_bool_tensor != 0));
+  *out = value.release();
+  return nullptr;
+#else
+  ORT_UNUSED_PARAMETER(dlmanaged_tensor);
+  ORT_UNUSED_PARAMETER(is_bool_tensor);
+  ORT_UNUSED_PARAMETER(out);
+  return OrtApis::CreateStatus(ORT_FAIL, "DLPack interop is not supported in this build.");
+#endif
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::CreateDlpackFromValue, _In_ OrtValue* value, _Outptr_ struct DLManagedTensor** out) {
+  API_IMPL_BEGIN
+#ifdef ENABLE_TRAINING
+  if (value == nullptr || !value->IsAllocated()) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "value cannot be null or unallocated");
+  }
+  if (!value->IsTensor()) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "only tensor OrtValues can be exported as DLPack");
+  }
+
+  // the conversion adds its own ownership of the buffer, so the DLPack tensor remains valid
+  // independently of the OrtValue's lifetime
+  *out = onnxruntime::dlpack::OrtValueToDlpack(*value);
+  return nullptr;
+#else
+  ORT_UNUSED_PARAMETER(value);
+  ORT_UNUSED_PARAMETER(out);
+  return OrtApis::CreateStatus(ORT_FAIL, "DLPack interop is not supported in this build.");
+#endif
+  API_IMPL_END
+}
+
 struct OrtIoBinding {
   std::unique_ptr<::onnxruntime::IOBinding> binding_;
   explicit OrtIoBinding(std::unique_ptr<::onnxruntime::IOBinding>&& binding) : binding_(std::move(binding)) {}
@@ -1201,6 +1373,75 @@ ORT_API_STATUS_IMPL(OrtApis::SessionEndProfiling, _In_ OrtSession* sess, _Inout_
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::SessionGetOpTypeStats, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  auto stats = session->GetOpTypeStats();
+  *out = StrDup(stats, allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SessionGetAllocatorStats, _In_ const OrtSession* sess,
+                    _In_ const OrtMemoryInfo* mem_info, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  auto allocator_ptr = session->GetAllocator(*mem_info);
+  if (!allocator_ptr) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "No requested allocator available");
+  }
+  ::onnxruntime::AllocatorStats stats;
+  allocator_ptr->GetStats(&stats);
+  std::ostringstream oss;
+  oss << "{\"bytes_in_use\":" << stats.bytes_in_use
+      << ",\"max_bytes_in_use\":" << stats.max_bytes_in_use
+      << ",\"total_allocated_bytes\":" << stats.total_allocated_bytes
+      << ",\"bytes_limit\":" << stats.bytes_limit
+      << ",\"max_alloc_size\":" << stats.max_alloc_size
+      << ",\"num_allocs\":" << stats.num_allocs
+      << ",\"num_reserves\":" << stats.num_reserves
+      << ",\"num_arena_extensions\":" << stats.num_arena_extensions
+      << ",\"num_arena_shrinkages\":" << stats.num_arena_shrinkages << "}";
+  *out = StrDup(oss.str(), allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsGetCostSummary, _In_ const OrtRunOptions* options,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  const auto* summary = options->cost_summary.get();
+  *out = StrDup(summary != nullptr ? summary->ToJson() : "{}", allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SessionGetIntraOpThreadPoolStats, _In_ const OrtSession* sess,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  *out = StrDup(session->GetIntraOpThreadPoolStats(), allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SessionResetIntraOpThreadPoolStats, _Inout_ OrtSession* sess) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+  session->ResetIntraOpThreadPoolStats();
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SetGlobalRandomSeed, int64_t seed) {
+  API_IMPL_BEGIN
+  onnxruntime::utils::SetRandomSeed(seed);
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::SessionGetModelMetadata, _In_ const OrtSession* sess,
                     _Outptr_ OrtModelMetadata** out) {
   API_IMPL_BEGIN
@@ -2012,6 +2253,10 @@ ORT_API_STATUS_IMPL(OrtApis::CreateArenaCfgV2, _In_reads_(num_keys) const char*
       cfg->max_dead_bytes_per_chunk = static_cast<int>(arena_config_values[i]);
     } else if (strcmp(arena_config_keys[i], "initial_growth_chunk_size_bytes") == 0) {
       cfg->initial_growth_chunk_size_bytes = static_cast<int>(arena_config_values[i]);
+    } else if (strcmp(arena_config_keys[i], "numa_aware") == 0) {
+      cfg->numa_aware = static_cast<int>(arena_config_values[i]);
+    } else if (strcmp(arena_config_keys[i], "huge_page_threshold_bytes") == 0) {
+      cfg->huge_page_threshold_bytes = arena_config_values[i];
     } else {
       std::ostringstream oss;
       oss << "Invalid key found: " << arena_config_keys[i];
@@ -2365,6 +2610,18 @@ static constexpr OrtApi ort_api_1_to_9 = {
     // End of Version 9 - DO NOT MODIFY ABOVE (see above text for more information)
 
     // Version 10 - In development, feel free to add/remove/rearrange here
+    &OrtApis::RunAsync,
+    &OrtApis::CreateValueFromDlpack,
+    &OrtApis::CreateDlpackFromValue,
+    &OrtApis::KernelContext_GetTempSpaceAllocator,
+    &OrtApis::KernelContext_ParallelFor,
+    &OrtApis::SessionGetOpTypeStats,
+    &OrtApis::SessionGetAllocatorStats,
+    &OrtApis::RunOptionsGetCostSummary,
+    &OrtApis::SessionGetIntraOpThreadPoolStats,
+    &OrtApis::SessionResetIntraOpThreadPoolStats,
+    &OrtApis::SetGlobalRandomSeed,
+    &OrtApis::RebindTensorWithDataAsOrtValue,
 };
 
 // Asserts to do a some checks to ensure older Versions of the OrtApi never change (will detect an addition or deletion but not if they cancel out each other)
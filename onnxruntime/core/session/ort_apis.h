@@ -51,6 +51,40 @@ ORT_API_STATUS_IMPL(Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions*
                     _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
                     _Inout_updates_all_(output_names_len) OrtValue** output);
 
+ORT_API_STATUS_IMPL(RunAsync, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _In_reads_(input_len) const char* const* input_names,
+                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                    _Inout_updates_all_(output_names_len) OrtValue** output,
+                    _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data);
+
+ORT_API_STATUS_IMPL(CreateValueFromDlpack, _In_ struct DLManagedTensor* dlmanaged_tensor, int is_bool_tensor,
+                    _Outptr_ OrtValue** out);
+ORT_API_STATUS_IMPL(CreateDlpackFromValue, _In_ OrtValue* value, _Outptr_ struct DLManagedTensor** out);
+
+ORT_API_STATUS_IMPL(KernelContext_GetTempSpaceAllocator, _In_ const OrtKernelContext* context,
+                    _Outptr_ OrtAllocator** out);
+ORT_API_STATUS_IMPL(KernelContext_ParallelFor, _In_ const OrtKernelContext* context,
+                    _In_ void (ORT_API_CALL* fn)(void*, size_t), _In_ size_t total, _In_ size_t num_batch,
+                    _In_opt_ void* usr_data);
+
+ORT_API_STATUS_IMPL(SessionGetOpTypeStats, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
+
+ORT_API_STATUS_IMPL(SessionGetAllocatorStats, _In_ const OrtSession* sess, _In_ const OrtMemoryInfo* mem_info,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** out);
+
+ORT_API_STATUS_IMPL(RunOptionsGetCostSummary, _In_ const OrtRunOptions* options, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
+
+ORT_API_STATUS_IMPL(SessionGetIntraOpThreadPoolStats, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
+ORT_API_STATUS_IMPL(SessionResetIntraOpThreadPoolStats, _Inout_ OrtSession* sess);
+ORT_API_STATUS_IMPL(SetGlobalRandomSeed, int64_t seed);
+ORT_API_STATUS_IMPL(RebindTensorWithDataAsOrtValue, _Inout_ OrtValue* value, _In_ const OrtMemoryInfo* info,
+                    _Inout_ void* p_data, size_t p_data_len, _In_ const int64_t* shape, size_t shape_len,
+                    ONNXTensorElementDataType type);
+
 ORT_API_STATUS_IMPL(CreateSessionOptions, OrtSessionOptions** out);
 ORT_API_STATUS_IMPL(CloneSessionOptions, const OrtSessionOptions* input, OrtSessionOptions** out);
 ORT_API_STATUS_IMPL(SetSessionExecutionMode, _In_ OrtSessionOptions* options, ExecutionMode execution_mode);
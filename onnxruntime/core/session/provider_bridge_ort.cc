@@ -139,6 +139,31 @@ struct ProviderHostImpl : ProviderHost {
   void* HeapAllocate(size_t size) override { return new uint8_t[size]; }
   void HeapFree(void* p) override { delete[] reinterpret_cast<uint8_t*>(p); }
 
+  const ProviderHostFastPath* GetFastPath(uint32_t version) noexcept override {
+    if (version != kProviderHostFastPathVersion)
+      return nullptr;
+
+    static const ProviderHostFastPath fast_path = [] {
+      ProviderHostFastPath table;
+      table.version = kProviderHostFastPathVersion;
+
+      table.Tensor_DataRaw = [](const Tensor* p) -> const void* { return p->DataRaw(); };
+      table.Tensor_MutableDataRaw = [](Tensor* p) -> void* { return p->MutableDataRaw(); };
+      table.Tensor_Shape = [](const Tensor* p) -> const TensorShape& { return p->Shape(); };
+      table.Tensor_SizeInBytes = [](const Tensor* p) { return p->SizeInBytes(); };
+      table.Tensor_Location = [](const Tensor* p) -> const OrtMemoryInfo& { return p->Location(); };
+      table.Tensor_GetElementType = [](const Tensor* p) { return p->GetElementType(); };
+
+      table.TensorShape_SizeHelper = [](const TensorShape* p, size_t start, size_t end) { return p->SizeHelper(start, end); };
+
+      table.CPUAllocator_Alloc = [](CPUAllocator* p, size_t size) { return p->CPUAllocator::Alloc(size); };
+      table.CPUAllocator_Free = [](CPUAllocator* p, void* allocation) { p->CPUAllocator::Free(allocation); };
+      return table;
+    }();
+
+    return &fast_path;
+  }
+
   logging::Logger* LoggingManager_GetDefaultLogger() override {
     return const_cast<logging::Logger*>(&logging::LoggingManager::DefaultLogger());
   }
@@ -9,24 +9,65 @@
 
 namespace onnxruntime {
 namespace concurrency {
+// Removes the processors that share a physical core with a lower numbered entry, so that no two
+// of the remaining processors are SMT siblings. Leaves the list untouched when the core topology
+// cannot be queried.
+static void KeepOneProcessorPerCore(std::vector<size_t>& cpus) {
+  std::vector<size_t> core_cpus = Env::Default().GetPhysicalCoreProcessors();
+  if (core_cpus.empty())
+    return;
+  cpus.erase(std::remove_if(cpus.begin(), cpus.end(),
+                            [&core_cpus](size_t cpu) {
+                              return std::find(core_cpus.begin(), core_cpus.end(), cpu) == core_cpus.end();
+                            }),
+             cpus.end());
+}
+
 static std::unique_ptr<ThreadPool>
 CreateThreadPoolHelper(Env* env, OrtThreadPoolParams options) {
   if (options.thread_pool_size == 1)
     return nullptr;
   std::vector<size_t> cpu_list;
   ThreadOptions to;
-  if (options.affinity_vec_len != 0) {
+  if (!options.affinity_masks.empty()) {
+    // explicit per-thread masks win over every other affinity setting
+    to.affinity_masks = options.affinity_masks;
+    if (options.thread_pool_size <= 0)
+      options.thread_pool_size = static_cast<int>(to.affinity_masks.size());
+  } else if (options.numa_node >= 0) {
+    // bind every thread to the processors of the requested node rather than pinning each thread
+    // to one processor; the OS scheduler balances the threads within the node
+    std::vector<size_t> node_cpus = Env::Default().GetNumaNodeProcessors(options.numa_node);
+    if (options.avoid_smt_siblings)
+      KeepOneProcessorPerCore(node_cpus);
+    if (!node_cpus.empty()) {
+      if (options.thread_pool_size <= 0)
+        options.thread_pool_size = static_cast<int>(node_cpus.size());
+      to.affinity_masks.assign(options.thread_pool_size, node_cpus);
+    }
+  } else if (options.affinity_vec_len != 0) {
     to.affinity.assign(options.affinity_vec, options.affinity_vec + options.affinity_vec_len);
   }
   if (options.thread_pool_size <= 0) {  // default
     cpu_list = Env::Default().GetThreadAffinityMasks();
+    if (options.avoid_smt_siblings) {
+      // GetThreadAffinityMasks already approximates one processor per core by halving the logical
+      // processor count; prefer the real topology when it is available
+      std::vector<size_t> core_cpus = Env::Default().GetPhysicalCoreProcessors();
+      if (!core_cpus.empty())
+        cpu_list = std::move(core_cpus);
+    }
     if (cpu_list.empty() || cpu_list.size() == 1)
       return nullptr;
     options.thread_pool_size = static_cast<int>(cpu_list.size());
     if (options.auto_set_affinity)
       to.affinity = cpu_list;
   }
+  to.worker_spin_count = options.worker_spin_count;
+  to.num_hot_standby_threads = options.num_hot_standby_threads;
   to.set_denormal_as_zero = options.set_denormal_as_zero;
+  to.worker_nice_value = options.worker_nice_value;
+  to.worker_init_fn = options.worker_init_fn;
 
   return std::make_unique<ThreadPool>(env, to, options.name, options.thread_pool_size,
                                               options.allow_spinning);
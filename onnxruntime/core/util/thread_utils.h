@@ -4,8 +4,10 @@
 #pragma once
 #include "core/platform/threadpool.h"
 #include "core/session/onnxruntime_c_api.h"
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 struct OrtThreadPoolParams {
   //0: Use default setting. (All the physical cores or half of the logical cores)
@@ -19,15 +21,53 @@ struct OrtThreadPoolParams {
   //If it is true, the thread pool will spin a while after the queue became empty.
   bool allow_spinning = true;
 
+  // Number of iterations a worker spins waiting for work before parking. 0 (the default) keeps
+  // the built-in spin duration. Larger values lower the wakeup latency at the start of a parallel
+  // region at the cost of CPU time; no effect when allow_spinning is false.
+  unsigned int worker_spin_count = 0;
+
+  // Keep the first N workers of the pool busy-polling between requests instead of parking them,
+  // so short parallel regions never pay the futex wakeup cost. Trades continuous CPU usage on the
+  // hot workers for latency. 0 (the default) disables hot standby.
+  int num_hot_standby_threads = 0;
+
   unsigned int stack_size = 0;
   //Index is thread id, value is processor ID
   //If the vector is empty, no explict affinity binding
   size_t* affinity_vec = nullptr;
   size_t affinity_vec_len = 0;
+
+  // Per-thread affinity masks: entry i lists the logical processors thread i may run on.
+  // Takes precedence over affinity_vec; unlike affinity_vec a thread is bound to its whole mask
+  // rather than pinned to a single processor. When set and thread_pool_size is 0, the pool is
+  // sized to the number of masks.
+  std::vector<std::vector<size_t>> affinity_masks;
+
+  // Bind every thread of the pool to the logical processors of this NUMA node, so the threads and
+  // the memory they touch stay node local. -1 (the default) means no NUMA binding.
+  // Ignored when affinity_masks is set.
+  int numa_node = -1;
+
+  // When the processors for the pool are selected automatically (default thread_pool_size or NUMA
+  // binding), use only one logical processor per physical core so pool threads don't contend with
+  // their SMT siblings for core resources.
+  bool avoid_smt_siblings = false;
+
   const ORTCHAR_T* name = nullptr;
 
   // Set or unset denormal as zero
   bool set_denormal_as_zero = false;
+
+  // Nice value each worker thread applies to itself before processing work. Positive values lower
+  // the workers' scheduling priority relative to the application's own threads. 0 (the default)
+  // keeps the inherited priority; ignored on platforms without per-thread scheduling priority.
+  int worker_nice_value = 0;
+
+  // Invoked once on every worker thread of the pool before it processes its first work item,
+  // after the built-in per-worker initialization (denormal control, scheduling priority). Runs on
+  // the worker itself with the worker's thread index, so thread-local state set up here is
+  // visible to all work the thread later runs. Must not throw or block.
+  std::function<void(int)> worker_init_fn;
 };
 
 struct OrtThreadingOptions {
@@ -610,6 +610,15 @@ class OrtValue:
         '''
         return self._ortvalue.numpy()
 
+    def numpy_view(self):
+        '''
+        Returns a Numpy object sharing the OrtValue's data buffer instead of copying it.
+        Valid only for OrtValues holding CPU Tensors of primitive (non-string) types.
+        The buffer stays alive for as long as the returned array (or a view of it) does,
+        and writes through the array are visible to anything else holding the OrtValue.
+        '''
+        return self._ortvalue.numpy_view()
+
 
 class OrtDevice:
     '''
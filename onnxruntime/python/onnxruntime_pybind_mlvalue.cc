@@ -830,6 +830,21 @@ void CreateGenericMLValue(const onnxruntime::InputDefList* input_def_list, const
     // This should just increase the ref counts of the underlying shared_ptrs in the native OrtValue
     // and the ref count will be decreased when the OrtValue used for Run() is destroyed upon exit.
     *p_mlvalue = *value.attr(PYTHON_ORTVALUE_NATIVE_OBJECT_ATTR).cast<OrtValue*>();
+  } else if (!accept_only_numpy_array && PyObject_HasAttrString(value.ptr(), "__array_interface__")) {
+    // Objects that export the array interface protocol can be wrapped without a copy:
+    // numpy creates a view over the exporter's buffer and the view keeps the exporter alive.
+    // The allocator below owns the view reference (and makes a contiguous copy only if the
+    // exporter's buffer is not contiguous).
+    PyArrayObject* arr = reinterpret_cast<PyArrayObject*>(
+        PyArray_FromAny(value.ptr(), nullptr, 0, 0, 0, nullptr));
+    if (!arr) {
+      PyErr_Clear();
+      throw std::runtime_error("Unable to create a tensor from the __array_interface__ of input '" +
+                               name_input + "'.");
+    }
+
+    auto pybind_alloc = std::make_shared<OrtPybindSingleUseAllocator>(arr, name_input, alloc->Info());
+    CreateTensorMLValueOwned(pybind_alloc, alloc, p_mlvalue);
   } else if (!accept_only_numpy_array) {
     auto iterator = PyObject_GetIter(value.ptr());
     if (iterator == NULL) {
@@ -50,6 +50,8 @@ void CopyDataToTensor(const pybind11::array& py_array, int npy_type, Tensor& ten
 pybind11::object AddTensorAsPyObj(const OrtValue& val, const DataTransferManager* data_transfer_manager,
                                   const std::unordered_map<OrtDevice::DeviceType, MemCpyFunc>* mem_cpy_to_host_functions);
 
+pybind11::object GetNumpyViewFromOrtValue(const OrtValue& val);
+
 pybind11::object GetPyObjectFromSparseTensor(size_t pos, const OrtValue& ort_value, const DataTransferManager* data_transfer_manager);
 
 pybind11::object AddNonTensorAsPyObj(const OrtValue& val,
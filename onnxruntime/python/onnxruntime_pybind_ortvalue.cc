@@ -207,6 +207,11 @@ void addOrtValueMethods(pybind11::module& m) {
 #endif
         return obj;
       })
+      // Exposes the Tensor as a numpy array sharing the OrtValue's buffer instead of copying it.
+      // The array keeps the OrtValue's buffer alive through its base object.
+      .def("numpy_view", [](const OrtValue* ml_value) -> py::object {
+        return GetNumpyViewFromOrtValue(*ml_value);
+      })
 #ifdef ENABLE_TRAINING
       .def("to_dlpack", [](OrtValue* ort_value) -> py::object {
         return py::reinterpret_steal<py::object>(ToDlpack(*ort_value));
@@ -282,6 +282,49 @@ py::object AddTensorAsPyObj(const OrtValue& val, const DataTransferManager* data
   return obj;
 }
 
+// Returns a numpy array that aliases the tensor buffer of the OrtValue instead of copying it.
+// The array's base object holds a reference to the OrtValue, so the buffer stays alive for as
+// long as the array (or any view derived from it) does. Only CPU tensors of primitive types
+// can be aliased; the OrtValue must outlast the call (the copy taken here shares the buffer).
+py::object GetNumpyViewFromOrtValue(const OrtValue& val) {
+  ORT_ENFORCE(val.IsTensor(), "Only OrtValues that are Tensors can be exposed as numpy views");
+  const Tensor& rtensor = val.Get<Tensor>();
+  ORT_ENFORCE(rtensor.Location().device.Type() == OrtDevice::CPU,
+              "Only CPU tensors can be exposed as numpy views. Copy the OrtValue to CPU first.");
+
+  MLDataType dtype = rtensor.DataType();
+  const int numpy_type = OnnxRuntimeTensorToNumpyType(dtype);
+  ORT_ENFORCE(numpy_type != NPY_OBJECT, "String tensors cannot be exposed as numpy views");
+
+  const TensorShape& shape = rtensor.Shape();
+  std::vector<npy_intp> npy_dims;
+  for (size_t n = 0; n < shape.NumDimensions(); ++n) {
+    npy_dims.push_back(shape[n]);
+  }
+
+  // An empty tensor may have a null data pointer which numpy will not wrap - return a copy.
+  if (shape.Size() == 0) {
+    return AddTensorAsPyObj(val, nullptr, nullptr);
+  }
+
+  py::object obj = py::reinterpret_steal<py::object>(PyArray_SimpleNewFromData(
+      static_cast<int>(shape.NumDimensions()), npy_dims.data(), numpy_type,
+      const_cast<void*>(rtensor.DataRaw())));
+  ThrowIfPyErrOccured();
+
+  // Tie the lifetime of the buffer to the array via a capsule holding a shared reference
+  // to the OrtValue. PyArray_SetBaseObject steals the capsule reference on success.
+  auto holder = std::make_unique<OrtValue>(val);
+  py::capsule base(holder.get(), [](void* p) { delete reinterpret_cast<OrtValue*>(p); });
+  holder.release();
+  if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(obj.ptr()), base.release().ptr()) != 0) {
+    ThrowIfPyErrOccured();
+    throw std::runtime_error("Failed to set the base object of the numpy view");
+  }
+
+  return obj;
+}
+
 static std::unique_ptr<onnxruntime::IExecutionProvider> LoadExecutionProvider(
     const std::string& ep_shared_lib_path,
     const ProviderOptions& provider_options = {},
@@ -953,7 +996,9 @@ void addObjectMethods(py::module& m, Environment& env, ExecutionProviderRegistra
 
   py::enum_<ExecutionOrder>(m, "ExecutionOrder")
       .value("DEFAULT", ExecutionOrder::DEFAULT)
-      .value("PRIORITY_BASED", ExecutionOrder::PRIORITY_BASED);
+      .value("PRIORITY_BASED", ExecutionOrder::PRIORITY_BASED)
+      .value("MEMORY_EFFICIENT", ExecutionOrder::MEMORY_EFFICIENT)
+      .value("LOCALITY_AWARE", ExecutionOrder::LOCALITY_AWARE);
 
   py::enum_<OrtAllocatorType>(m, "OrtAllocatorType")
       .value("INVALID", OrtAllocatorType::Invalid)
@@ -1424,6 +1469,8 @@ including arg name, arg type (contains both type and shape).)pbdoc")
           py::return_value_policy::reference_internal)
       .def("run_with_iobinding", [](PyInferenceSession* sess, SessionIOBinding& io_binding, RunOptions* run_options = nullptr) -> void {
         Status status;
+        // release GIL to allow multiple python threads to invoke Run() in parallel.
+        py::gil_scoped_release release;
         if (!run_options)
           status = sess->GetSessionHandle()->Run(*io_binding.Get());
         else
@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(FusedElementwiseTest, ChainWithBroadcastScalarAndFullOperands) {
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"Add", "Mul", "SubRev"});
+  test.AddInput<float>("X", {2, 3}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+  test.AddInput<float>("B0", {3}, {1.f, 0.5f, 2.f});
+  test.AddInput<float>("B1", {}, {2.f});
+  test.AddInput<float>("B2", {2, 3}, {10.f, 10.f, 10.f, 20.f, 20.f, 20.f});
+  // ((X + B0) * B1) then B2 - acc
+  test.AddOutput<float>("Y", {2, 3}, {6.f, 5.f, 0.f, 10.f, 9.f, 4.f});
+  test.Run();
+}
+
+TEST(FusedElementwiseTest, SubThenDivByScalar) {
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"Sub", "Div"});
+  test.AddInput<float>("X", {4}, {8.f, 6.f, 4.f, 2.f});
+  test.AddInput<float>("B0", {4}, {1.f, 2.f, 3.f, 4.f});
+  test.AddInput<float>("B1", {1}, {2.f});
+  test.AddOutput<float>("Y", {4}, {3.5f, 2.f, 0.5f, -1.f});
+  test.Run();
+}
+
+TEST(FusedElementwiseTest, DivRev) {
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"DivRev"});
+  test.AddInput<float>("X", {2, 2}, {1.f, 2.f, 4.f, 8.f});
+  test.AddInput<float>("B0", {}, {8.f});
+  test.AddOutput<float>("Y", {2, 2}, {8.f, 4.f, 2.f, 1.f});
+  test.Run();
+}
+
+TEST(FusedElementwiseTest, MiddleDimBroadcast) {
+  // exercises the strided gather path where the operand broadcasts over a non-trailing dim
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"Mul"});
+  test.AddInput<float>("X", {2, 2, 2}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+  test.AddInput<float>("B0", {2, 1, 2}, {1.f, 2.f, 3.f, 4.f});
+  test.AddOutput<float>("Y", {2, 2, 2}, {1.f, 4.f, 3.f, 8.f, 15.f, 24.f, 21.f, 32.f});
+  test.Run();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
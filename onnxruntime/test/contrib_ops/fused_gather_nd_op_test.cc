@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(FusedGatherNDTest, ScaleVectorAndBiasScalar) {
+  OpTester test("FusedGatherND", 1, onnxruntime::kMSDomain);
+  test.AddInput<float>("data", {3, 2}, {0.f, 1.f, 2.f, 3.f, 4.f, 5.f});
+  test.AddInput<int64_t>("indices", {2, 1}, {2, 0});
+  test.AddInput<float>("scale", {2}, {2.f, 3.f});
+  test.AddInput<float>("bias", {}, {1.f});
+  test.AddOutput<float>("output", {2, 2}, {9.f, 16.f, 1.f, 4.f});
+  test.Run();
+}
+
+TEST(FusedGatherNDTest, ScaleOnly) {
+  OpTester test("FusedGatherND", 1, onnxruntime::kMSDomain);
+  test.AddInput<float>("data", {2, 2}, {1.f, 2.f, 3.f, 4.f});
+  test.AddInput<int64_t>("indices", {2, 2}, {0, 1, 1, 0});
+  test.AddInput<float>("scale", {}, {0.5f});
+  test.AddOutput<float>("output", {2}, {1.f, 1.5f});
+  test.Run();
+}
+
+TEST(FusedGatherNDTest, BiasOnlyWithMissingScale) {
+  OpTester test("FusedGatherND", 1, onnxruntime::kMSDomain);
+  test.AddInput<float>("data", {2, 3}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+  test.AddInput<int64_t>("indices", {1, 1}, {1});
+  test.AddOptionalInputEdge<float>();  // scale
+  test.AddInput<float>("bias", {3}, {10.f, 20.f, 30.f});
+  test.AddOutput<float>("output", {1, 3}, {14.f, 25.f, 36.f});
+  test.Run();
+}
+
+TEST(FusedGatherNDTest, BatchDims) {
+  OpTester test("FusedGatherND", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<int64_t>("batch_dims", 1);
+  test.AddInput<float>("data", {2, 2, 2}, {0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f});
+  test.AddInput<int64_t>("indices", {2, 1}, {1, 0});
+  test.AddInput<float>("scale", {2}, {1.f, 2.f});
+  test.AddInput<float>("bias", {2}, {1.f, 1.f});
+  test.AddOutput<float>("output", {2, 2}, {3.f, 7.f, 5.f, 11.f});
+  test.Run();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test/common/tensor_op_test_utils.h"
+#include "test/providers/provider_test_utils.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+// Reference implementation: dequantize the packed weight and run a plain float matmul.
+static void RunMatMulIntNWeight(const std::vector<int64_t>& a_dims,
+                                int64_t K, int64_t N,
+                                int64_t bits, int64_t group_size,
+                                bool has_zero_points) {
+  RandomValueGenerator random{};
+  std::vector<float> a_data = random.Uniform<float>(a_dims, -1.0f, 1.0f);
+
+  const int64_t q_levels = bits == 4 ? 16 : 256;
+  const uint8_t default_zp = bits == 4 ? 8 : 128;
+  const int64_t rows_per_group = group_size == 0 ? K : group_size;
+  const int64_t group_count = (K + rows_per_group - 1) / rows_per_group;
+
+  std::vector<int> q_data = random.Uniform<int32_t>({K, N}, 0, static_cast<int32_t>(q_levels));
+  std::vector<float> scales = random.Uniform<float>({group_count, N}, 0.01f, 0.1f);
+  std::vector<int> zp_values;
+  if (has_zero_points) {
+    zp_values = random.Uniform<int32_t>({group_count, N}, 0, static_cast<int32_t>(q_levels));
+  }
+
+  const int64_t packed_k = bits == 4 ? (K + 1) / 2 : K;
+  std::vector<uint8_t> b_data(packed_k * N, 0);
+  for (int64_t k = 0; k < K; ++k) {
+    for (int64_t n = 0; n < N; ++n) {
+      const uint8_t q = static_cast<uint8_t>(q_data[k * N + n]);
+      if (bits == 4) {
+        b_data[(k >> 1) * N + n] |= static_cast<uint8_t>(q << ((k & 1) ? 4 : 0));
+      } else {
+        b_data[k * N + n] = q;
+      }
+    }
+  }
+
+  const int64_t M = std::accumulate(a_dims.begin(), a_dims.end() - 1, int64_t{1}, std::multiplies<int64_t>());
+  std::vector<int64_t> y_dims(a_dims);
+  y_dims.back() = N;
+  std::vector<float> y_data(M * N, 0.f);
+  for (int64_t m = 0; m < M; ++m) {
+    for (int64_t k = 0; k < K; ++k) {
+      const int64_t group = k / rows_per_group;
+      for (int64_t n = 0; n < N; ++n) {
+        const int32_t zp = has_zero_points ? zp_values[group * N + n] : default_zp;
+        const float b = static_cast<float>(q_data[k * N + n] - zp) * scales[group * N + n];
+        y_data[m * N + n] += a_data[m * K + k] * b;
+      }
+    }
+  }
+
+  OpTester test("MatMulIntNWeight", 1, kMSDomain);
+  test.AddAttribute<int64_t>("K", K);
+  test.AddAttribute<int64_t>("bits", bits);
+  test.AddAttribute<int64_t>("group_size", group_size);
+  test.AddInput<float>("A", a_dims, a_data);
+  test.AddInput<uint8_t>("B", {packed_k, N}, b_data, true);
+  test.AddInput<float>("scales", {group_count, N}, scales, true);
+  if (has_zero_points) {
+    std::vector<uint8_t> zp_data;
+    std::transform(zp_values.begin(), zp_values.end(), std::back_inserter(zp_data),
+                   [](int32_t v) -> uint8_t { return static_cast<uint8_t>(v); });
+    test.AddInput<uint8_t>("zero_points", {group_count, N}, zp_data, true);
+  }
+  test.AddOutput<float>("Y", y_dims, y_data);
+  test.Run();
+}
+
+TEST(MatMulIntNWeight, Int8PerTensor) {
+  RunMatMulIntNWeight({2, 8}, 8, 16, 8, 0, false);
+}
+
+TEST(MatMulIntNWeight, Int8Grouped) {
+  // K not a multiple of the group size exercises the ragged last group
+  RunMatMulIntNWeight({3, 20}, 20, 9, 8, 8, true);
+}
+
+TEST(MatMulIntNWeight, Int4OddK) {
+  // odd K leaves the high nibble of the last packed row unused
+  RunMatMulIntNWeight({2, 2, 7}, 7, 12, 4, 4, false);
+}
+
+TEST(MatMulIntNWeight, Int4WithZeroPoints) {
+  RunMatMulIntNWeight({4, 16}, 16, 8, 4, 8, true);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -79,6 +79,52 @@ TEST(InvokerTest, Inplace) {
   }
 }
 
+TEST(InvokerTest, DispatchCacheReuse) {
+  std::unique_ptr<IExecutionProvider> cpu_execution_provider = std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false));
+  const std::string logger_id{"InvokerTest"};
+  auto logging_manager = std::make_unique<logging::LoggingManager>(
+      std::unique_ptr<logging::ISink>{new logging::CLogSink{}},
+      logging::Severity::kVERBOSE, false,
+      logging::LoggingManager::InstanceType::Default,
+      &logger_id);
+  std::unique_ptr<Environment> env;
+  Environment::Create(std::move(logging_manager), env);
+  IOnnxRuntimeOpSchemaRegistryList tmp_op_registry = {};
+  ORTInvoker kernel_invoker(std::move(cpu_execution_provider), env->GetLoggingManager()->DefaultLogger(), tmp_op_registry);
+
+  // Invoke the same op twice with different values and shapes. The second call
+  // hits the dispatch cache and must still compute on the new inputs.
+  std::vector<int64_t> dims_mul_x = {3, 2};
+  std::vector<float> values_mul_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue A, B;
+  CreateMLValue<float>(kernel_invoker.GetCurrentExecutionProvider().GetAllocator(0, OrtMemTypeDefault), dims_mul_x, values_mul_x,
+                       &A);
+  CreateMLValue<float>(kernel_invoker.GetCurrentExecutionProvider().GetAllocator(0, OrtMemTypeDefault), dims_mul_x, values_mul_x,
+                       &B);
+  std::vector<OrtValue> result(1);
+  auto status = kernel_invoker.Invoke("Add", {A, B}, result, nullptr);
+  ASSERT_TRUE(status.IsOK());
+
+  std::vector<int64_t> dims_mul_y = {2, 2};
+  std::vector<float> values_mul_y = {10.0f, 20.0f, 30.0f, 40.0f};
+  OrtValue C, D;
+  CreateMLValue<float>(kernel_invoker.GetCurrentExecutionProvider().GetAllocator(0, OrtMemTypeDefault), dims_mul_y, values_mul_y,
+                       &C);
+  CreateMLValue<float>(kernel_invoker.GetCurrentExecutionProvider().GetAllocator(0, OrtMemTypeDefault), dims_mul_y, values_mul_y,
+                       &D);
+  std::vector<OrtValue> result2(1);
+  status = kernel_invoker.Invoke("Add", {C, D}, result2, nullptr);
+  ASSERT_TRUE(status.IsOK());
+
+  const Tensor& E = result2.back().Get<Tensor>();
+  EXPECT_EQ(E.Shape().GetDims(), dims_mul_y);
+  std::vector<float> expected_result = {20.0f, 40.0f, 60.0f, 80.0f};
+  auto* e_data = E.Data<float>();
+  for (size_t i = 0; i < expected_result.size(); ++i) {
+    EXPECT_EQ(e_data[i], expected_result[i]);
+  }
+}
+
 class TestKernel final : public OpKernel {
  public:
   TestKernel(const OpKernelInfo& info) : OpKernel(info) {}
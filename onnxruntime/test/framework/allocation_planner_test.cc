@@ -12,6 +12,7 @@
 #include "core/framework/op_kernel.h"
 #include "test/framework/model_builder_utils.h"
 #include "core/framework/allocation_planner.h"
+#include "core/framework/execution_plan_cache.h"
 #include "core/session/inference_session.h"
 #include "core/graph/model.h"
 #include "core/providers/cpu/cpu_execution_provider.h"
@@ -513,6 +514,67 @@ TEST_F(PlannerTest, PlanOutputTest) {
   }
 }
 
+TEST_F(PlannerTest, ExecutionPlanCacheRoundTrip) {
+  // tensor variables:
+  std::string W("W"), X("X"), B("B"), Y("Y"), Z("Z");
+
+  // graph structure: same chain as ChainTest so the plan exercises an initializer, reuse and a free list.
+  ONNX_NAMESPACE::TensorProto tensor;
+  tensor.add_dims(1);
+  tensor.add_float_data(1.0f);
+  tensor.set_data_type(TensorProto_DataType_FLOAT);
+  tensor.set_name("W");
+  GetGraph().AddInitializedTensor(tensor);
+
+  AddNormalNode(W, X);
+  AddNormalNode(X, B);
+  AddNormalNode(B, Y);
+  AddNormalNode(Y, Z);
+
+  // simulate shape-inference results:
+  Shape shape1{50, 100};
+  auto shape = &shape1.value;
+  SetShape({{X, shape}, {B, shape}, {Y, shape}, {Z, shape}});
+
+  CreatePlan();
+
+  const std::basic_string<PATH_CHAR_TYPE> path{ORT_TSTR("execution_plan_cache_round_trip.bin")};
+  ASSERT_STATUS_OK(execution_plan_cache::SaveExecutionPlan(path, GetPlan()));
+
+  SequentialExecutionPlan loaded;
+  ASSERT_STATUS_OK(execution_plan_cache::LoadExecutionPlan(path, GraphViewer(GetGraph()),
+                                                           GetState().GetOrtValueNameIdxMap(), GetState(), loaded));
+
+#ifdef _WIN32
+  _wremove(path.c_str());
+#else
+  std::remove(path.c_str());
+#endif
+
+  const SequentialExecutionPlan& original = GetPlan();
+  ASSERT_EQ(loaded.allocation_plan.size(), original.allocation_plan.size());
+  for (size_t i = 0; i < original.allocation_plan.size(); ++i) {
+    EXPECT_EQ(loaded.allocation_plan[i].alloc_kind, original.allocation_plan[i].alloc_kind) << "value " << i;
+    EXPECT_EQ(loaded.allocation_plan[i].value_type, original.allocation_plan[i].value_type) << "value " << i;
+    EXPECT_EQ(loaded.allocation_plan[i].location, original.allocation_plan[i].location) << "value " << i;
+    EXPECT_EQ(loaded.allocation_plan[i].reused_buffer, original.allocation_plan[i].reused_buffer) << "value " << i;
+    EXPECT_EQ(loaded.allocation_plan[i].create_fence_if_async, original.allocation_plan[i].create_fence_if_async)
+        << "value " << i;
+  }
+
+  EXPECT_EQ(loaded.initializer_allocation_order, original.initializer_allocation_order);
+  EXPECT_EQ(loaded.activation_allocation_order, original.activation_allocation_order);
+  EXPECT_EQ(loaded.to_be_freed, original.to_be_freed);
+  EXPECT_EQ(loaded.node_has_fence, original.node_has_fence);
+
+  ASSERT_EQ(loaded.execution_plan.size(), original.execution_plan.size());
+  for (size_t i = 0; i < original.execution_plan.size(); ++i) {
+    EXPECT_EQ(loaded.execution_plan[i].node_index, original.execution_plan[i].node_index) << "step " << i;
+    EXPECT_EQ(loaded.execution_plan[i].free_from_index, original.execution_plan[i].free_from_index) << "step " << i;
+    EXPECT_EQ(loaded.execution_plan[i].free_to_index, original.execution_plan[i].free_to_index) << "step " << i;
+  }
+}
+
 #ifdef USE_CUDA
 TEST_F(PlannerTest, LocationPlanningForPassThroughExplicitAndImplicitSubgraphInputs) {
   // Types
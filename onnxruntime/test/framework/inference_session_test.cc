@@ -6,10 +6,12 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <cstdio>
 #include <functional>
 #include <iterator>
 #include <thread>
 #include <fstream>
+#include <sstream>
 
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include "core/common/denormal.h"
@@ -21,6 +23,9 @@
 #include "core/framework/execution_provider.h"
 #include "core/framework/kernel_registry.h"
 #include "core/framework/op_kernel.h"
+#include "core/framework/random_seed.h"
+#include "core/framework/replay_capture.h"
+#include "core/framework/run_cost_summary.h"
 #include "core/framework/session_state.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/bfc_arena.h"
@@ -29,6 +34,7 @@
 #include "core/graph/op.h"
 #include "core/optimizer/rule_based_graph_transformer.h"
 #include "core/platform/env.h"
+#include "core/platform/path_lib.h"
 #include "core/providers/cpu/cpu_execution_provider.h"
 #include "core/providers/cpu/math/element_wise_ops.h"
 #include "core/providers/cuda/cuda_provider_factory.h"
@@ -50,6 +56,7 @@
 #include "test/optimizer/dummy_graph_transformer.h"
 #include "test/util/include/default_providers.h"
 #include "test/util/include/inference_session_wrapper.h"
+#include "test/util/include/temp_dir.h"
 
 #include "gtest/gtest.h"
 
@@ -403,6 +410,142 @@ TEST(InferenceSessionTests, OnlyExecutePathToFetches) {
   RunModel(session_object, run_options);
 }
 
+TEST(InferenceSessionTests, ActivationRangeTracking) {
+  TemporaryDirectory temp_dir{ORT_TSTR("activation_range_tracking_test_dir")};
+  const std::string range_file = ToMBString(temp_dir.Path()) + "/activation_ranges.json";
+
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.ActivationRangeTracking";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigActivationRangeTrackingRuns, "2"));
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigActivationRangeTrackingFile,
+                                                    range_file.c_str()));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "activation range tracking";
+  RunModel(session_object, run_options);
+
+  // the range file is only written once the configured number of runs has completed
+  ASSERT_FALSE(std::ifstream(range_file).good());
+
+  RunModel(session_object, run_options);
+
+  std::ifstream range_stream(range_file);
+  ASSERT_TRUE(range_stream.good());
+  std::stringstream buffer;
+  buffer << range_stream.rdbuf();
+  const std::string ranges = buffer.str();
+  // the model's output tensor Y must have a recorded range
+  ASSERT_NE(ranges.find("\"Y\""), std::string::npos);
+}
+
+TEST(InferenceSessionTests, CollectOpTypeStats) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.CollectOpTypeStats";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigCollectOpStats, "1"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // nothing has executed yet
+  ASSERT_EQ(session_object.GetOpTypeStats(), "{}");
+
+  RunOptions run_options;
+  run_options.run_tag = "collect op type stats";
+  RunModel(session_object, run_options);
+  RunModel(session_object, run_options);
+
+  // the model consists of a single Mul node, executed twice
+  const std::string stats = session_object.GetOpTypeStats();
+  ASSERT_NE(stats.find("\"Mul\":{\"count\":2,"), std::string::npos) << stats;
+}
+
+TEST(InferenceSessionTests, OpTypeStatsDisabledByDefault) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.OpTypeStatsDisabledByDefault";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "op type stats disabled";
+  RunModel(session_object, run_options);
+
+  ASSERT_EQ(session_object.GetOpTypeStats(), "{}");
+}
+
+TEST(InferenceSessionTests, CollectRunCostBreakdown) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.CollectRunCostBreakdown";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "collect run cost breakdown";
+  ASSERT_STATUS_OK(run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigCollectCostBreakdown, "1"));
+
+  // no breakdown exists before the first run
+  ASSERT_EQ(run_options.cost_summary, nullptr);
+
+  RunModel(session_object, run_options);
+
+  ASSERT_NE(run_options.cost_summary, nullptr);
+  const RunCostSummary& summary = *run_options.cost_summary;
+  // the model is a single CPU Mul node: kernel time was measured, there are no copies,
+  // and the buckets are consistent with the run wall time
+  EXPECT_GT(summary.KernelTimeNs(), 0u);
+  EXPECT_EQ(summary.CopyTimeNs(), 0u);
+  EXPECT_GE(summary.TotalTimeNs(), summary.KernelTimeNs() + summary.CopyTimeNs());
+  EXPECT_EQ(summary.TotalTimeNs(), summary.KernelTimeNs() + summary.CopyTimeNs() + summary.FrameworkTimeNs());
+
+  // each collecting run replaces the summary of the previous one
+  RunModel(session_object, run_options);
+  ASSERT_NE(run_options.cost_summary.get(), &summary);
+}
+
+TEST(InferenceSessionTests, ReplayCaptureRoundTrip) {
+  const std::string capture_file = "inference_session_test_replay.capture";
+
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.ReplayCaptureRoundTrip";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigReplayCaptureFile,
+                                                    capture_file.c_str()));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "replay capture round trip";
+  RunModel(session_object, run_options);
+
+  // the run must have serialized its feeds; load them back and compare with what RunModel fed
+  ReplayCapture capture;
+  ASSERT_STATUS_OK(LoadReplayCapture(capture_file,
+                                     TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), capture));
+
+  EXPECT_EQ(capture.random_seed, utils::GetRandomSeed());
+  EXPECT_EQ(capture.run_tag, run_options.run_tag);
+  ASSERT_EQ(capture.feed_names.size(), 1u);
+  EXPECT_EQ(capture.feed_names[0], "X");
+
+  const Tensor& replayed = capture.feeds[0].Get<Tensor>();
+  const std::vector<int64_t> expected_dims = {3, 2};
+  const std::vector<float> expected_values = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  ASSERT_EQ(replayed.Shape().GetDims(), expected_dims);
+  auto replayed_span = replayed.DataAsSpan<float>();
+  EXPECT_TRUE(std::equal(replayed_span.begin(), replayed_span.end(), expected_values.begin()));
+
+  std::remove(capture_file.c_str());
+}
+
 TEST(InferenceSessionTests, DisableCPUArena) {
   SessionOptions so;
 
@@ -480,6 +623,70 @@ TEST(InferenceSessionTests, TestModelSerialization) {
   ASSERT_TRUE(session_object_emptyValidation.Initialize().IsOK());
 }
 
+#if defined(ENABLE_ORT_FORMAT_LOAD)
+TEST(InferenceSessionTests, OptimizedModelCache) {
+  TemporaryDirectory temp_dir{ORT_TSTR("optimized_model_cache_test_dir")};
+  const std::string cache_dir = ToMBString(temp_dir.Path());
+
+  // the first session populates the cache
+  {
+    SessionOptions so;
+    so.session_logid = "InferenceSessionTests.OptimizedModelCache.Populate";
+    ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigOptimizedModelCacheDir,
+                                                      cache_dir.c_str()));
+
+    InferenceSession session_object{so, GetEnvironment()};
+    ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+    ASSERT_STATUS_OK(session_object.Initialize());
+
+    RunOptions run_options;
+    run_options.run_tag = "populate";
+    RunModel(session_object, run_options);
+  }
+
+  // exactly one artifact should have been written
+  int num_artifacts = 0;
+  LoopDir(temp_dir.Path(), [&num_artifacts](const PathChar* filename, OrtFileType) {
+    if (filename[0] != ORT_TSTR('.')) {
+      ++num_artifacts;
+    }
+    return true;
+  });
+  ASSERT_EQ(num_artifacts, 1);
+
+  // the second session with a matching key initializes from the cached artifact. use a capturing
+  // sink so the cache hit can be observed.
+  auto capturing_sink = new CapturingSink();
+  auto logging_manager = std::make_unique<logging::LoggingManager>(
+      std::unique_ptr<ISink>(capturing_sink), logging::Severity::kINFO, false,
+      LoggingManager::InstanceType::Temporal);
+
+  std::unique_ptr<Environment> env;
+  ASSERT_STATUS_OK(Environment::Create(std::move(logging_manager), env));
+
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.OptimizedModelCache.Hit";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigOptimizedModelCacheDir,
+                                                    cache_dir.c_str()));
+
+  InferenceSession session_object{so, *env};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  const auto& msgs = capturing_sink->Messages();
+  const bool initialized_from_cache =
+      std::find_if(msgs.begin(), msgs.end(),
+                   [](const std::string& msg) {
+                     return msg.find("Initializing from the optimized model cache.") != std::string::npos;
+                   }) != msgs.end();
+  ASSERT_TRUE(initialized_from_cache);
+
+  RunOptions run_options;
+  run_options.run_tag = "cache_hit";
+  RunModel(session_object, run_options);
+}
+#endif  // defined(ENABLE_ORT_FORMAT_LOAD)
+
 #ifdef ORT_RUN_EXTERNAL_ONNX_TESTS
 static bool Compare(const InputDefList& f_arg, const InputDefList& s_arg) {
   if (f_arg.size() != s_arg.size()) {
@@ -648,6 +855,18 @@ TEST(InferenceSessionTests, CheckRunProfilerWithSessionOptions) {
       ASSERT_TRUE(lines[i].find(s) != string::npos);
     }
   }
+
+  // The profile should also contain events for the graph transformer passes
+  // that ran during session initialization.
+  bool has_transformer_pass_event = false;
+  for (size_t i = 1; i < size - 1; ++i) {
+    if (lines[i].find("_pass") != string::npos &&
+        lines[i].find("graph_transformer_step") != string::npos) {
+      has_transformer_pass_event = true;
+      break;
+    }
+  }
+  ASSERT_TRUE(has_transformer_pass_event);
 }
 
 TEST(InferenceSessionTests, CheckRunProfilerWithStartProfile) {
@@ -2695,6 +2914,64 @@ TEST(InferenceSessionTests, InitializerSharing_EnsureSessionsUseUserAddedInitial
   ASSERT_NE(so3_init_buffer, val_to_share.Get<Tensor>().Data<float>());
 }
 
+TEST(InferenceSessionTests, WeightHotSwap) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.WeightHotSwap";
+  InferenceSessionWrapper session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<int64_t> dims{3, 2};
+  std::vector<float> x_values{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue x_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims, x_values, &x_value);
+  NameMLValMap feeds{{"X", x_value}};
+  std::vector<std::string> output_names{"Y"};
+
+  RunOptions run_options;
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches));
+  // W is [1, 2, 3, 4, 5, 6] in the model, so Y = X * W is the element-wise squares
+  VerifyOutputs(fetches, dims, {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f});
+  ASSERT_EQ(session_object.GetSessionState().GetWeightsVersion(), 0u);
+
+  // updates that don't match the existing initializer are rejected at staging time
+  OrtValue bad_shape;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {2, 2},
+                       std::vector<float>{1.0f, 1.0f, 1.0f, 1.0f}, &bad_shape);
+  ASSERT_FALSE(session_object.StageWeightUpdate("W", bad_shape).IsOK());
+  ASSERT_FALSE(session_object.StageWeightUpdate("does_not_exist", bad_shape).IsOK());
+
+  // stage a shape-identical replacement; it takes effect at the start of the next Run
+  OrtValue new_w;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims,
+                       std::vector<float>{2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f}, &new_w);
+  ASSERT_STATUS_OK(session_object.StageWeightUpdate("W", new_w));
+
+  fetches.clear();
+  ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches));
+  VerifyOutputs(fetches, dims, {2.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f});
+  ASSERT_EQ(session_object.GetSessionState().GetWeightsVersion(), 1u);
+}
+
+TEST(InferenceSessionTests, WarmUp) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.WarmUp";
+  InferenceSession session_object{so, GetEnvironment()};
+
+  // not valid before the session is initialized
+  ASSERT_FALSE(session_object.WarmUp().IsOK());
+
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+  ASSERT_STATUS_OK(session_object.WarmUp());
+
+  // warming up must not disturb the weights
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+}
+
 void RunModelWithDenormalAsZero(InferenceSession& session_object,
                                 const RunOptions& run_options,
                                 bool set_denormal_as_zero) {
@@ -124,6 +124,40 @@ TEST(CApiTensorTest, load_float_tensor_with_external_data) {
   run_external_data_test<false>();
 }
 
+TEST(CApiTensorTest, get_external_data_info) {
+  FILE* fp;
+  std::basic_string<ORTCHAR_T> filename(ORT_TSTR("tensor_XXXXXX"));
+  CreateTestFile(fp, filename);
+  std::unique_ptr<ORTCHAR_T, decltype(&DeleteFileFromDisk)> file_deleter(const_cast<ORTCHAR_T*>(filename.c_str()),
+                                                                         DeleteFileFromDisk);
+  float test_data[] = {0.0f, 1.0f, 2.2f, 3.5f};
+  ASSERT_EQ(sizeof(test_data), fwrite(test_data, 1, sizeof(test_data), fp));
+  ASSERT_EQ(0, fclose(fp));
+  // construct a tensor proto whose data starts at an offset within the file
+  onnx::TensorProto p;
+  onnx::StringStringEntryProto* location = p.mutable_external_data()->Add();
+  location->set_key("location");
+  location->set_value(ToMBString(filename));
+  onnx::StringStringEntryProto* offset = p.mutable_external_data()->Add();
+  offset->set_key("offset");
+  offset->set_value("4");
+  onnx::StringStringEntryProto* length = p.mutable_external_data()->Add();
+  length->set_key("length");
+  length->set_value("12");
+  p.mutable_dims()->Add(3);
+  p.set_data_location(onnx::TensorProto_DataLocation_EXTERNAL);
+  p.set_data_type(onnx::TensorProto_DataType_FLOAT);
+
+  std::basic_string<ORTCHAR_T> external_file_path;
+  FileOffsetType file_offset;
+  size_t tensor_byte_size;
+  auto st = utils::GetExternalDataInfo(p, nullptr, external_file_path, file_offset, tensor_byte_size);
+  ASSERT_TRUE(st.IsOK()) << st.ErrorMessage();
+  ASSERT_EQ(external_file_path, filename);
+  ASSERT_EQ(file_offset, 4);
+  ASSERT_EQ(tensor_byte_size, 3 * sizeof(float));
+}
+
 #if defined(__amd64__) || defined(_M_X64)
 #ifndef __ANDROID__
 #ifdef NDEBUG
@@ -790,6 +790,182 @@ TEST_F(GraphTest, GraphConstruction_CheckIsAcyclic) {
   }
 }
 
+TEST_F(GraphTest, GraphConstruction_PruneToOutputs) {
+  Model model("graph_1", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  /*
+   *                 node_1 (Identity)
+   *                 /       \
+   *     node_2 (NoOp)     node_3 (NoOp)
+   *          |                 |
+   *      (output_kept)    node_4 (NoOp)
+   *                            |
+   *                      (output_dropped)
+   */
+  TypeProto tensor_int32;
+  tensor_int32.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT32);
+  tensor_int32.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  auto& input_arg1 = graph.GetOrCreateNodeArg("node_1_in_1", &tensor_int32);
+  auto& output_arg1 = graph.GetOrCreateNodeArg("node_1_out_1", &tensor_int32);
+  graph.AddNode("node_1", "Identity_Fake", "node 1", {&input_arg1}, {&output_arg1});
+
+  auto& output_arg2 = graph.GetOrCreateNodeArg("node_2_out_1", &tensor_int32);
+  graph.AddNode("node_2", "NoOp_Fake", "node 2", {&output_arg1}, {&output_arg2});
+
+  auto& output_arg3 = graph.GetOrCreateNodeArg("node_3_out_1", &tensor_int32);
+  graph.AddNode("node_3", "NoOp_Fake", "node 3", {&output_arg1}, {&output_arg3});
+
+  auto& output_arg4 = graph.GetOrCreateNodeArg("node_4_out_1", &tensor_int32);
+  graph.AddNode("node_4", "NoOp_Fake", "node 4", {&output_arg3}, {&output_arg4});
+
+  auto status = graph.Resolve();
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+  EXPECT_EQ(graph.GetOutputs().size(), 2u);
+
+  // an arg that is not a graph output is rejected
+  status = graph.PruneToOutputs({&output_arg3});
+  EXPECT_FALSE(status.IsOK());
+
+  // prune to the first output. node_3 and node_4 only contribute to the dropped output.
+  status = graph.PruneToOutputs({&output_arg2});
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+
+  status = graph.Resolve();
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+
+  EXPECT_EQ(graph.NumberOfNodes(), 2);
+  EXPECT_EQ(graph.GetOutputs().size(), 1u);
+  EXPECT_EQ(graph.GetOutputs()[0]->Name(), "node_2_out_1");
+  for (const auto& node : graph.Nodes()) {
+    EXPECT_TRUE(node.Name() == "node_1" || node.Name() == "node_2");
+  }
+}
+
+TEST_F(GraphTest, GraphConstruction_IncrementalResolve) {
+  Model model("graph_1", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto tensor_int32;
+  tensor_int32.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT32);
+  tensor_int32.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  auto& input_arg1 = graph.GetOrCreateNodeArg("node_1_in_1", &tensor_int32);
+  auto& output_arg1 = graph.GetOrCreateNodeArg("node_1_out_1", &tensor_int32);
+  graph.AddNode("node_1", "Identity_Fake", "node 1", {&input_arg1}, {&output_arg1});
+
+  auto& output_arg2 = graph.GetOrCreateNodeArg("node_2_out_1", &tensor_int32);
+  auto& node_2 = graph.AddNode("node_2", "Identity_Fake", "node 2", {&output_arg1}, {&output_arg2});
+
+  auto status = graph.Resolve();
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+  EXPECT_EQ(graph.GetOutputs()[0]->Name(), "node_2_out_1");
+
+  // append a consumer of the current output and rewire node_2, the way a transformer would
+  auto& output_arg3 = graph.GetOrCreateNodeArg("node_3_out_1", nullptr);
+  graph.AddNode("node_3", "Identity_Fake", "node 3", {&output_arg2}, {&output_arg3});
+  node_2.MutableInputDefs()[0] = &output_arg1;  // touch node_2 so it is marked modified
+
+  Graph::ResolveOptions resolve_options;
+  resolve_options.incremental = true;
+  status = graph.Resolve(resolve_options);
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+
+  // graph outputs are recomputed and the type of the new node's output is inferred
+  EXPECT_EQ(graph.GetOutputs().size(), 1u);
+  EXPECT_EQ(graph.GetOutputs()[0]->Name(), "node_3_out_1");
+  ASSERT_NE(output_arg3.Type(), nullptr);
+  EXPECT_EQ(*output_arg3.Type(), "tensor(int32)");
+
+  // an incremental resolve with no further changes is a no-op
+  status = graph.Resolve(resolve_options);
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+}
+
+TEST_F(GraphTest, ShapeInferenceMemoRespectsConstantInputData) {
+  Model model("graph_1", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto float_1d;
+  float_1d.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_1d.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(6);
+
+  TypeProto int64_1d;
+  int64_1d.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT64);
+  int64_1d.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& data_0 = graph.GetOrCreateNodeArg("data_0", &float_1d);
+  auto& data_1 = graph.GetOrCreateNodeArg("data_1", &float_1d);
+
+  // two Reshape nodes that are identical apart from the values of their constant shape inputs.
+  // the shape inference memo must not share a result between them as Reshape reads the data.
+  auto add_shape_initializer = [&graph](const std::string& name, int64_t dim_0, int64_t dim_1) {
+    TensorProto shape_tensor;
+    shape_tensor.set_name(name);
+    shape_tensor.set_data_type(TensorProto_DataType_INT64);
+    shape_tensor.add_dims(2);
+    shape_tensor.add_int64_data(dim_0);
+    shape_tensor.add_int64_data(dim_1);
+    graph.AddInitializedTensor(shape_tensor);
+  };
+
+  add_shape_initializer("shape_0", 2, 3);
+  add_shape_initializer("shape_1", 3, 2);
+
+  auto& shape_0 = graph.GetOrCreateNodeArg("shape_0", &int64_1d);
+  auto& shape_1 = graph.GetOrCreateNodeArg("shape_1", &int64_1d);
+  auto& reshaped_0 = graph.GetOrCreateNodeArg("reshaped_0", nullptr);
+  auto& reshaped_1 = graph.GetOrCreateNodeArg("reshaped_1", nullptr);
+
+  graph.AddNode("reshape_0", "Reshape", "reshape 0", {&data_0, &shape_0}, {&reshaped_0});
+  graph.AddNode("reshape_1", "Reshape", "reshape 1", {&data_1, &shape_1}, {&reshaped_1});
+  graph.SetInputs({&data_0, &data_1});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  ASSERT_NE(reshaped_0.Shape(), nullptr);
+  ASSERT_NE(reshaped_1.Shape(), nullptr);
+  ASSERT_EQ(reshaped_0.Shape()->dim_size(), 2);
+  ASSERT_EQ(reshaped_1.Shape()->dim_size(), 2);
+  EXPECT_EQ(reshaped_0.Shape()->dim(0).dim_value(), 2);
+  EXPECT_EQ(reshaped_0.Shape()->dim(1).dim_value(), 3);
+  EXPECT_EQ(reshaped_1.Shape()->dim(0).dim_value(), 3);
+  EXPECT_EQ(reshaped_1.Shape()->dim(1).dim_value(), 2);
+}
+
+TEST_F(GraphTest, GraphViewer_TraversalOrderCacheInvalidation) {
+  Model model("graph_1", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto tensor_int32;
+  tensor_int32.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT32);
+  tensor_int32.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  auto& input_arg1 = graph.GetOrCreateNodeArg("node_1_in_1", &tensor_int32);
+  auto& output_arg1 = graph.GetOrCreateNodeArg("node_1_out_1", &tensor_int32);
+  graph.AddNode("node_1", "Identity_Fake", "node 1", {&input_arg1}, {&output_arg1});
+
+  auto& output_arg2 = graph.GetOrCreateNodeArg("node_2_out_1", &tensor_int32);
+  graph.AddNode("node_2", "Identity_Fake", "node 2", {&output_arg1}, {&output_arg2});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  // the first viewer computes the traversal orders, the second reuses the cached copy
+  GraphViewer viewer_1(graph);
+  GraphViewer viewer_2(graph);
+  EXPECT_EQ(viewer_1.GetNodesInTopologicalOrder(), viewer_2.GetNodesInTopologicalOrder());
+  EXPECT_EQ(viewer_1.GetRootNodes(), viewer_2.GetRootNodes());
+
+  // mutating the graph must invalidate the cache so new viewers see the new node
+  auto& output_arg3 = graph.GetOrCreateNodeArg("node_3_out_1", &tensor_int32);
+  graph.AddNode("node_3", "Identity_Fake", "node 3", {&output_arg2}, {&output_arg3});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  GraphViewer viewer_3(graph);
+  EXPECT_EQ(viewer_3.GetNodesInTopologicalOrder().size(), 3u);
+}
+
 TEST_F(GraphTest, GraphConstruction_CheckInputNodeOrderMaintained) {
   Model model("graph_1", false, *logger_);
   auto& graph = model.MainGraph();
@@ -927,6 +1103,60 @@ TEST_F(GraphTest, GraphConstruction_PriorityBasedTopologicalSort_CompressDecompr
   }
 }
 
+TEST_F(GraphTest, GraphConstruction_LocalityAwareTopologicalSort) {
+  Model model("graph_1", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  /*
+                      node_0 (Identity)
+                      /              \
+     big_prod (1024x1024 out)      small_prod (1 out)
+              |                        |
+          big_cons                 small_cons
+                      \              /
+                       node_5 (Merge)
+  */
+
+  TypeProto tensor_int32;
+  tensor_int32.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT32);
+  tensor_int32.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  TypeProto tensor_int32_big;
+  tensor_int32_big.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT32);
+  tensor_int32_big.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1024);
+  tensor_int32_big.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1024);
+
+  auto& input_arg0 = graph.GetOrCreateNodeArg("node_0_in_1", &tensor_int32);
+  auto& output_arg0 = graph.GetOrCreateNodeArg("node_0_out_1", &tensor_int32);
+  auto& big_out = graph.GetOrCreateNodeArg("big_prod_out_1", &tensor_int32_big);
+  auto& small_out = graph.GetOrCreateNodeArg("small_prod_out_1", &tensor_int32);
+  auto& big_cons_out = graph.GetOrCreateNodeArg("big_cons_out_1", &tensor_int32);
+  auto& small_cons_out = graph.GetOrCreateNodeArg("small_cons_out_1", &tensor_int32);
+  auto& output_arg5 = graph.GetOrCreateNodeArg("node_5_out_1", &tensor_int32);
+
+  graph.AddNode("node_0", "Identity_Fake", "node 0", {&input_arg0}, {&output_arg0});
+  graph.AddNode("big_prod", "Identity_Fake", "produces a large tensor", {&output_arg0}, {&big_out});
+  graph.AddNode("small_prod", "Identity_Fake", "produces a small tensor", {&output_arg0}, {&small_out});
+  graph.AddNode("big_cons", "Identity_Fake", "consumes the large tensor", {&big_out}, {&big_cons_out});
+  graph.AddNode("small_cons", "Identity_Fake", "consumes the small tensor", {&small_out}, {&small_cons_out});
+  graph.AddNode("node_5", "Merge_Fake", "merge", {&big_cons_out, &small_cons_out}, {&output_arg5});
+
+  auto status = graph.Resolve();
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+  GraphViewer graph_viewer(graph);
+
+  // the consumer of the large tensor must be scheduled right after its producer, before the
+  // small branch runs
+  auto& order = graph_viewer.GetNodesInTopologicalOrder(ExecutionOrder::LOCALITY_AWARE);
+  const std::vector<std::string> expected_locality_aware_order =
+      {"node_0", "big_prod", "big_cons", "small_prod", "small_cons", "node_5"};
+  ASSERT_EQ(order.size(), expected_locality_aware_order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    auto node = graph.GetNode(order[i]);
+    EXPECT_TRUE(node->Name() == expected_locality_aware_order[i]) << "Locality aware execution order is wrong.";
+  }
+}
+
 TEST_F(GraphTest, GraphConstruction_PriorityBasedTopologicalSort_CompressDecompress_Nested) {
   Model model("graph_1", false, *logger_);
   auto& graph = model.MainGraph();
@@ -132,3 +132,23 @@ TEST(SchemaRegistryManager, OpsetRegTest) {
   ASSERT_TRUE(manager.GetSchema("Op5", 5, "Domain1")->since_version() == 1);
   ASSERT_TRUE(manager.GetSchema("Op5", 1, "Domain1")->since_version() == 1);
 }
+
+TEST(SchemaRegistryManager, CachedLookupInvalidatedByRegisterRegistry) {
+  SchemaRegistryManager manager;
+
+  // miss gets cached
+  ASSERT_TRUE(manager.GetSchema("Op1", 1, "Domain1") == nullptr);
+
+  // repeated lookups of the same (op, domain, version) hit the cache and must agree
+  const ONNX_NAMESPACE::OpSchema* gemm = manager.GetSchema("Gemm", 10, "");
+  ASSERT_NE(gemm, nullptr);
+  ASSERT_EQ(manager.GetSchema("Gemm", 10, ""), gemm);
+
+  // registering a registry that supplies the previously missing schema must invalidate the cache
+  std::shared_ptr<onnxruntime::OnnxRuntimeOpSchemaRegistry> registry = std::make_shared<OnnxRuntimeOpSchemaRegistry>();
+  std::vector<ONNX_NAMESPACE::OpSchema> schema = {CreateTestSchema("Op1", "Domain1", 1)};
+  ASSERT_STATUS_OK(registry->RegisterOpSet(schema, "Domain1", 0, 1));
+  manager.RegisterRegistry(registry);
+
+  ASSERT_TRUE(manager.GetSchema("Op1", 1, "Domain1") != nullptr);
+}
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "mlas.h"
+#include "bench_util.h"
+
+#include <stdexcept>
+
+static const std::vector<std::string> activation_bench_arg_names = {"M", "N"};
+
+void ACTIVATION(benchmark::State& state, MLAS_ACTIVATION_KIND kind) {
+  if (state.range(0) <= 0) throw std::invalid_argument("M must greater than 0!");
+  if (state.range(1) <= 0) throw std::invalid_argument("N must greater than 0!");
+
+  const size_t M = static_cast<size_t>(state.range(0));
+  const size_t N = static_cast<size_t>(state.range(1));
+
+  MLAS_ACTIVATION activation;
+  activation.ActivationKind = kind;
+  if (kind == MlasLeakyReluActivation) {
+    activation.Parameters.LeakyRelu.alpha = 0.01f;
+  } else if (kind == MlasClipActivation) {
+    activation.Parameters.Clip.minimum = 0.0f;
+    activation.Parameters.Clip.maximum = 6.0f;
+  } else if (kind == MlasHardSigmoidActivation) {
+    activation.Parameters.HardSigmoid.alpha = 0.2f;
+    activation.Parameters.HardSigmoid.beta = 0.5f;
+  }
+
+  auto buffer = RandomVectorUniform(M * N, -2.0f, 2.0f);
+
+  // warm up first round.
+  MlasActivation(&activation, buffer.data(), nullptr, M, N, N);
+
+  for (auto _ : state) {
+    MlasActivation(&activation, buffer.data(), nullptr, M, N, N);
+  }
+
+  // the buffer is transformed in place, so one read and one write per element
+  state.counters["Bytes"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) * 2.0 * M * N * sizeof(float),
+      benchmark::Counter::kIsRate);
+}
+
+void ELEMENTWISE(benchmark::State& state, void (MLASCALL* compute)(const float*, float*, size_t)) {
+  if (state.range(0) <= 0) throw std::invalid_argument("M must greater than 0!");
+  if (state.range(1) <= 0) throw std::invalid_argument("N must greater than 0!");
+
+  const size_t total = static_cast<size_t>(state.range(0)) * static_cast<size_t>(state.range(1));
+
+  auto input = RandomVectorUniform(total, -2.0f, 2.0f);
+  std::vector<float> output(total);
+
+  // warm up first round.
+  compute(input.data(), output.data(), total);
+
+  for (auto _ : state) {
+    compute(input.data(), output.data(), total);
+  }
+
+  state.counters["Bytes"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) * 2.0 * total * sizeof(float),
+      benchmark::Counter::kIsRate);
+}
+
+static void ActivationSize(benchmark::internal::Benchmark* b) {
+  b->ArgNames(activation_bench_arg_names);
+  ArgsProduct(b, {{1, 64, 512}, {1024, 65536}});
+}
+
+BENCHMARK_CAPTURE(ACTIVATION, Relu, MlasReluActivation)->Apply(ActivationSize)->UseRealTime();
+BENCHMARK_CAPTURE(ACTIVATION, LeakyRelu, MlasLeakyReluActivation)->Apply(ActivationSize)->UseRealTime();
+BENCHMARK_CAPTURE(ACTIVATION, Tanh, MlasTanhActivation)->Apply(ActivationSize)->UseRealTime();
+BENCHMARK_CAPTURE(ACTIVATION, Logistic, MlasLogisticActivation)->Apply(ActivationSize)->UseRealTime();
+BENCHMARK_CAPTURE(ACTIVATION, Clip, MlasClipActivation)->Apply(ActivationSize)->UseRealTime();
+BENCHMARK_CAPTURE(ACTIVATION, HardSigmoid, MlasHardSigmoidActivation)->Apply(ActivationSize)->UseRealTime();
+
+BENCHMARK_CAPTURE(ELEMENTWISE, Erf, MlasComputeErf)->Apply(ActivationSize)->UseRealTime();
+BENCHMARK_CAPTURE(ELEMENTWISE, Exp, MlasComputeExp)->Apply(ActivationSize)->UseRealTime();
+BENCHMARK_CAPTURE(ELEMENTWISE, Logistic, MlasComputeLogistic)->Apply(ActivationSize)->UseRealTime();
+BENCHMARK_CAPTURE(ELEMENTWISE, Tanh, MlasComputeTanh)->Apply(ActivationSize)->UseRealTime();
\ No newline at end of file
@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "mlas.h"
+#include "bench_util.h"
+#include "core/util/thread_utils.h"
+
+#include <stdexcept>
+#include <memory>
+#include <numeric>
+
+static const std::vector<std::string> pool2d_bench_arg_names = {"N", "C", "H", "W", "Kernel", "Threads"};
+
+void POOL2D(benchmark::State& state, MLAS_POOLING_KIND kind) {
+  if (state.range(0) <= 0) throw std::invalid_argument("N must greater than 0!");
+  if (state.range(1) <= 0) throw std::invalid_argument("C must greater than 0!");
+  if (state.range(2) <= 0) throw std::invalid_argument("H must greater than 0!");
+  if (state.range(3) <= 0) throw std::invalid_argument("W must greater than 0!");
+  if (state.range(4) <= 0) throw std::invalid_argument("Kernel must greater than 0!");
+  if (state.range(5) <= 0) throw std::invalid_argument("Threads must greater than 0!");
+
+  const int64_t batch_size = state.range(0);
+  const int64_t channels = state.range(1);
+  const int64_t height = state.range(2);
+  const int64_t width = state.range(3);
+  const int64_t kernel = state.range(4);
+  const size_t threads = static_cast<size_t>(state.range(5));
+
+  OrtThreadPoolParams tpo;
+  tpo.thread_pool_size = int(threads);
+  tpo.auto_set_affinity = true;
+  std::unique_ptr<onnxruntime::concurrency::ThreadPool> tp(
+      onnxruntime::concurrency::CreateThreadPool(&onnxruntime::Env::Default(),
+      tpo, onnxruntime::concurrency::ThreadPoolType::INTRA_OP));
+
+  const std::vector<int64_t> input_shape = {batch_size, channels, height, width};
+  const std::vector<int64_t> kernel_shape = {kernel, kernel};
+  const std::vector<int64_t> padding = {0, 0, 0, 0};
+  const std::vector<int64_t> strides = {kernel, kernel};
+  const std::vector<int64_t> output_shape = {batch_size, channels,
+                                             (height - kernel) / kernel + 1,
+                                             (width - kernel) / kernel + 1};
+
+  auto input = RandomVectorUniform(input_shape, -2.0f, 2.0f);
+  const int64_t output_size = std::accumulate(output_shape.begin(), output_shape.end(),
+                                              1LL, std::multiplies<int64_t>());
+  std::vector<float> output(static_cast<size_t>(output_size));
+
+  // warm up first round.
+  MlasPool(kind, 2, input_shape.data(), kernel_shape.data(), padding.data(),
+           strides.data(), output_shape.data(), input.data(), output.data(), tp.get());
+
+  for (auto _ : state) {
+    MlasPool(kind, 2, input_shape.data(), kernel_shape.data(), padding.data(),
+             strides.data(), output_shape.data(), input.data(), output.data(), tp.get());
+  }
+
+  state.counters["Bytes"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) * (input.size() + output.size()) * sizeof(float),
+      benchmark::Counter::kIsRate);
+}
+
+static void Pool2dSize(benchmark::internal::Benchmark* b) {
+  b->ArgNames(pool2d_bench_arg_names);
+  // Args for  "N", "C", "H", "W", "Kernel", "Threads"
+  b->Args({1, 64, 112, 112, 2, 1});
+  b->Args({1, 64, 112, 112, 2, 4});
+  b->Args({1, 64, 112, 112, 3, 1});
+  b->Args({1, 64, 112, 112, 3, 4});
+  b->Args({1, 256, 56, 56, 2, 1});
+  b->Args({1, 256, 56, 56, 2, 4});
+  b->Args({1, 512, 28, 28, 2, 1});
+  b->Args({1, 512, 28, 28, 2, 4});
+  b->Args({1, 2048, 7, 7, 7, 1});
+  b->Args({1, 2048, 7, 7, 7, 4});
+}
+
+BENCHMARK_CAPTURE(POOL2D, Maximum, MlasMaximumPooling)->Apply(Pool2dSize)->UseRealTime();
+BENCHMARK_CAPTURE(POOL2D, AverageExcludePad, MlasAveragePoolingExcludePad)->Apply(Pool2dSize)->UseRealTime();
+BENCHMARK_CAPTURE(POOL2D, AverageIncludePad, MlasAveragePoolingIncludePad)->Apply(Pool2dSize)->UseRealTime();
@@ -76,6 +76,9 @@ void QGEMM(benchmark::State& state, bool pack_b) {
   for (auto _ : state) {
     MlasGemmBatch(gemm_shape, gemm_data_vec.data(), batch, tp.get());
   }
+
+  state.counters["OPS"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) * 2.0 * M * N * K * batch, benchmark::Counter::kIsRate);
 }
 
 static void QGemmSize(benchmark::internal::Benchmark* b) {
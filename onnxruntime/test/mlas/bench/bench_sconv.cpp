@@ -135,6 +135,15 @@ void SCONV_NCHW(benchmark::State& state, const char* /*dummy*/) {
              Y.data(),
              nullptr);
   }
+
+  const int64_t kernel_size = std::accumulate(kernel_shape.begin(), kernel_shape.end(),
+                                              1LL, std::multiplies<int64_t>());
+  const int64_t output_size = std::accumulate(output_shape.begin(), output_shape.end(),
+                                              1LL, std::multiplies<int64_t>());
+  state.counters["FLOPS"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) * 2.0 * batch_size * GF * output_size *
+          input_channels_per_group * kernel_size,
+      benchmark::Counter::kIsRate);
 }
 
 static void ResNet50(benchmark::internal::Benchmark* b) {
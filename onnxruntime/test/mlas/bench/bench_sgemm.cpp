@@ -92,6 +92,9 @@ void SGEMM(benchmark::State& state, bool pack_b, bool trans_a, bool trans_b, flo
           nullptr);
     }
   }
+
+  state.counters["FLOPS"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) * 2.0 * M * N * K, benchmark::Counter::kIsRate);
 }
 
 static void GemmSizeWithOne(benchmark::internal::Benchmark* b) {
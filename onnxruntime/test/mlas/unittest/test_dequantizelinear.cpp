@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <typename xint8_t>
+class MlasDequantizeLinearTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<xint8_t> BufferInput;
+  MatrixGuardBuffer<float> BufferOutput;
+  MatrixGuardBuffer<float> BufferOutputReference;
+
+  void GenerateReference(const xint8_t* Input, float* OutputReference, size_t N, float Scale, xint8_t ZeroPoint) {
+    for (size_t n = 0; n < N; n++) {
+      OutputReference[n] = static_cast<float>(static_cast<int32_t>(Input[n]) - static_cast<int32_t>(ZeroPoint)) * Scale;
+    }
+  }
+
+  void Test(size_t N) {
+    xint8_t* Input = BufferInput.GetBuffer(N);
+    float* Output = BufferOutput.GetBuffer(N);
+    float* OutputReference = BufferOutputReference.GetBuffer(N);
+
+    std::default_random_engine generator(static_cast<unsigned>(N));
+
+    std::uniform_real_distribution<float> scale_gen(10e-3f, 1.f);
+    float Scale = scale_gen(generator);
+
+    std::uniform_int_distribution<int32_t> zp_distribution(std::numeric_limits<xint8_t>::min(), std::numeric_limits<xint8_t>::max());
+    xint8_t ZeroPoint = static_cast<xint8_t>(zp_distribution(generator));
+
+    std::uniform_int_distribution<int32_t> distribution(std::numeric_limits<xint8_t>::min(), std::numeric_limits<xint8_t>::max());
+    for (size_t n = 0; n < N; n++) {
+      Input[n] = static_cast<xint8_t>(distribution(generator));
+    }
+
+    GenerateReference(Input, OutputReference, N, Scale, ZeroPoint);
+    MlasDequantizeLinear(Input, Output, N, Scale, ZeroPoint);
+
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_EQ(Output[n], OutputReference[n]) << ", size=" << N << ", index=" << n;
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(std::is_signed<xint8_t>::value ? "DequantizeLinearS8" : "DequantizeLinearU8");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    for (size_t n = 1; n <= 512; n++) {
+      Test(n);
+    }
+  }
+};
+
+template <> MlasDequantizeLinearTest<int8_t>* MlasTestFixture<MlasDequantizeLinearTest<int8_t>>::mlas_tester(nullptr);
+template <> MlasDequantizeLinearTest<uint8_t>* MlasTestFixture<MlasDequantizeLinearTest<uint8_t>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+      count += MlasDirectShortExecuteTests<MlasDequantizeLinearTest<int8_t>>::RegisterShortExecute();
+      count += MlasDirectShortExecuteTests<MlasDequantizeLinearTest<uint8_t>>::RegisterShortExecute();
+  }
+  return count;
+});
@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <typename IndexType, bool Threaded>
+class MlasGatherTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<uint8_t> BufferInput;
+  MatrixGuardBuffer<IndexType> BufferIndices;
+  MatrixGuardBuffer<uint8_t> BufferOutput;
+  MatrixGuardBuffer<uint8_t> BufferOutputReference;
+  MLAS_THREADPOOL* threadpool_;
+
+  void Test(size_t IndexCount, size_t RowCount, size_t RowBytes) {
+    uint8_t* Input = BufferInput.GetBuffer(RowCount * RowBytes);
+    IndexType* Indices = BufferIndices.GetBuffer(IndexCount);
+    uint8_t* Output = BufferOutput.GetBuffer(IndexCount * RowBytes);
+    uint8_t* OutputReference = BufferOutputReference.GetBuffer(IndexCount * RowBytes);
+
+    std::default_random_engine generator(static_cast<unsigned>(IndexCount * RowBytes));
+
+    std::uniform_int_distribution<int32_t> byte_distribution(0, 255);
+    for (size_t n = 0; n < RowCount * RowBytes; n++) {
+      Input[n] = static_cast<uint8_t>(byte_distribution(generator));
+    }
+
+    // Exercise negative indices, which wrap by the row count.
+    std::uniform_int_distribution<int64_t> index_distribution(-int64_t(RowCount), int64_t(RowCount) - 1);
+    for (size_t n = 0; n < IndexCount; n++) {
+      Indices[n] = static_cast<IndexType>(index_distribution(generator));
+    }
+
+    for (size_t n = 0; n < IndexCount; n++) {
+      int64_t idx = int64_t(Indices[n]);
+      if (idx < 0) {
+        idx += int64_t(RowCount);
+      }
+      memcpy(OutputReference + n * RowBytes, Input + size_t(idx) * RowBytes, RowBytes);
+    }
+
+    MlasGather(Input, Indices, Output, IndexCount, RowCount, RowBytes, threadpool_);
+
+    ASSERT_EQ(memcmp(Output, OutputReference, IndexCount * RowBytes), 0)
+        << " IndexCount=" << IndexCount << ", RowCount=" << RowCount << ", RowBytes=" << RowBytes;
+  }
+
+ public:
+  MlasGatherTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name = std::string(std::is_same<IndexType, int32_t>::value ? "GatherI32" : "GatherI64") +
+                                          (Threaded ? "_Threaded" : "_SingleThread");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    // Cover the vectorized path (row bytes a multiple of the vector size)
+    // and the byte copy fallback, with index counts spanning the threading
+    // threshold.
+    for (size_t RowBytes : {1, 3, 4, 16, 60, 64, 256, 1024}) {
+      for (size_t IndexCount : {1, 7, 128, 2000}) {
+        Test(IndexCount, 50, RowBytes);
+      }
+    }
+    Test(1000, 1, 128);
+    Test(0, 50, 64);
+  }
+};
+
+template <> MlasGatherTest<int32_t, false>* MlasTestFixture<MlasGatherTest<int32_t, false>>::mlas_tester(nullptr);
+template <> MlasGatherTest<int64_t, false>* MlasTestFixture<MlasGatherTest<int64_t, false>>::mlas_tester(nullptr);
+template <> MlasGatherTest<int32_t, true>* MlasTestFixture<MlasGatherTest<int32_t, true>>::mlas_tester(nullptr);
+template <> MlasGatherTest<int64_t, true>* MlasTestFixture<MlasGatherTest<int64_t, true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasGatherTest<int32_t, false>>::RegisterShortExecute();
+    count += MlasDirectShortExecuteTests<MlasGatherTest<int64_t, false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasGatherTest<int32_t, true>>::RegisterShortExecute();
+      count += MlasDirectShortExecuteTests<MlasGatherTest<int64_t, true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
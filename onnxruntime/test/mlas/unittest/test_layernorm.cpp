@@ -0,0 +1,163 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Threaded>
+class MlasLayerNormTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferInput;
+  MatrixGuardBuffer<float> BufferSkip;
+  MatrixGuardBuffer<float> BufferBias;
+  MatrixGuardBuffer<float> BufferGamma;
+  MatrixGuardBuffer<float> BufferBeta;
+  MatrixGuardBuffer<float> BufferOutput;
+  MatrixGuardBuffer<float> BufferOutputReference;
+  MatrixGuardBuffer<float> BufferMean;
+  MatrixGuardBuffer<float> BufferMeanReference;
+  MatrixGuardBuffer<float> BufferInvStdDev;
+  MatrixGuardBuffer<float> BufferInvStdDevReference;
+  MLAS_THREADPOOL* threadpool_;
+
+  void Test(size_t N, size_t D, bool HasSkip, bool HasBias, bool HasBeta, bool SimplifiedLayerNorm) {
+    float* Input = BufferInput.GetBuffer(N * D);
+    float* Skip = HasSkip ? BufferSkip.GetBuffer(N * D) : nullptr;
+    float* Bias = HasBias ? BufferBias.GetBuffer(D) : nullptr;
+    float* Gamma = BufferGamma.GetBuffer(D);
+    float* Beta = HasBeta ? BufferBeta.GetBuffer(D) : nullptr;
+    float* Output = BufferOutput.GetBuffer(N * D);
+    float* OutputReference = BufferOutputReference.GetBuffer(N * D);
+    float* Mean = BufferMean.GetBuffer(N);
+    float* MeanReference = BufferMeanReference.GetBuffer(N);
+    float* InvStdDev = BufferInvStdDev.GetBuffer(N);
+    float* InvStdDevReference = BufferInvStdDevReference.GetBuffer(N);
+
+    constexpr float Epsilon = 1e-5f;
+
+    std::default_random_engine generator(static_cast<unsigned>(N * D));
+    std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+
+    for (size_t nd = 0; nd < N * D; nd++) {
+      Input[nd] = distribution(generator);
+      if (HasSkip) {
+        Skip[nd] = distribution(generator);
+      }
+    }
+
+    for (size_t d = 0; d < D; d++) {
+      Gamma[d] = distribution(generator);
+      if (HasBias) {
+        Bias[d] = distribution(generator);
+      }
+      if (HasBeta) {
+        Beta[d] = distribution(generator);
+      }
+    }
+
+    MlasComputeLayerNorm(Input, Skip, Bias, Gamma, Beta, Output, Mean, InvStdDev,
+                         N, D, Epsilon, SimplifiedLayerNorm, threadpool_);
+    ReferenceLayerNorm(Input, Skip, Bias, Gamma, Beta, OutputReference, MeanReference,
+                       InvStdDevReference, N, D, Epsilon, SimplifiedLayerNorm);
+
+    constexpr float AbsoluteTolerance = 5e-4f;
+    constexpr float RelativeTolerance = 1e-4f;
+
+    for (size_t nd = 0; nd < N * D; nd++) {
+      float diff = std::fabs(Output[nd] - OutputReference[nd]);
+      ASSERT_TRUE(diff <= AbsoluteTolerance || diff <= std::fabs(OutputReference[nd]) * RelativeTolerance)
+          << " N=" << N << ", D=" << D << ", skip=" << int(HasSkip) << ", bias=" << int(HasBias)
+          << ", beta=" << int(HasBeta) << ", simplified=" << int(SimplifiedLayerNorm)
+          << ", got: " << Output[nd] << ", expecting: " << OutputReference[nd];
+    }
+
+    for (size_t n = 0; n < N; n++) {
+      float mean_diff = std::fabs(Mean[n] - MeanReference[n]);
+      ASSERT_TRUE(mean_diff <= AbsoluteTolerance || mean_diff <= std::fabs(MeanReference[n]) * RelativeTolerance)
+          << " mean difference at row " << n << ", got: " << Mean[n] << ", expecting: " << MeanReference[n];
+      float inv_std_dev_diff = std::fabs(InvStdDev[n] - InvStdDevReference[n]);
+      ASSERT_TRUE(inv_std_dev_diff <= AbsoluteTolerance ||
+                  inv_std_dev_diff <= std::fabs(InvStdDevReference[n]) * RelativeTolerance)
+          << " inv_std_dev difference at row " << n << ", got: " << InvStdDev[n]
+          << ", expecting: " << InvStdDevReference[n];
+    }
+  }
+
+  void ReferenceLayerNorm(const float* Input, const float* Skip, const float* Bias, const float* Gamma,
+                          const float* Beta, float* Output, float* Mean, float* InvStdDev,
+                          size_t N, size_t D, float Epsilon, bool SimplifiedLayerNorm) {
+    for (size_t n = 0; n < N; n++) {
+      double Sum = 0.0;
+      double SumSquares = 0.0;
+
+      for (size_t d = 0; d < D; d++) {
+        double Value = double(Input[d]);
+        if (Skip != nullptr) {
+          Value += double(Skip[d]);
+        }
+        if (Bias != nullptr) {
+          Value += double(Bias[d]);
+        }
+        Output[d] = float(Value);
+        Sum += Value;
+        SumSquares += Value * Value;
+      }
+
+      double RowMean = SimplifiedLayerNorm ? 0.0 : Sum / double(D);
+      double Variance = SumSquares / double(D) - RowMean * RowMean;
+      double RowInvStdDev = 1.0 / std::sqrt(Variance + double(Epsilon));
+
+      for (size_t d = 0; d < D; d++) {
+        double Value = (double(Output[d]) - RowMean) * RowInvStdDev * double(Gamma[d]);
+        if (Beta != nullptr) {
+          Value += double(Beta[d]);
+        }
+        Output[d] = float(Value);
+      }
+
+      Mean[n] = float(RowMean);
+      InvStdDev[n] = float(RowInvStdDev);
+
+      Input += D;
+      if (Skip != nullptr) {
+        Skip += D;
+      }
+      Output += D;
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(Threaded ? "LayerNorm_Threaded" : "LayerNorm_SingleThread");
+    return suite_name.c_str();
+  }
+
+  MlasLayerNormTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  void ExecuteShort(void) override {
+    // Cover the vectorized path and the scalar tail, with and without the
+    // fused residual/bias additions and the optional shift vector.
+    for (size_t d : {1, 3, 4, 17, 128, 255, 768}) {
+      Test(7, d, false, false, false, false);
+      Test(7, d, false, false, true, false);
+      Test(7, d, true, true, true, false);
+      Test(7, d, false, false, false, true);
+    }
+
+    Test(1, 1024, true, false, true, false);
+    Test(129, 768, true, true, true, false);
+  }
+};
+
+template <> MlasLayerNormTest<false>* MlasTestFixture<MlasLayerNormTest<false>>::mlas_tester(nullptr);
+template <> MlasLayerNormTest<true>* MlasTestFixture<MlasLayerNormTest<true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasLayerNormTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasLayerNormTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
@@ -0,0 +1,136 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test/framework/test_utils.h"
+#include "test/test_environment.h"
+#include "graph_transform_test_builder.h"
+
+#include "asserts.h"
+#include "core/graph/graph.h"
+#include "core/graph/model.h"
+#include "core/optimizer/auto_mixed_precision_transformer.h"
+#include "core/optimizer/graph_transformer_mgr.h"
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+// builds a model, assigns every node to the CUDA EP and runs the transformer on it
+void ApplyAutoMixedPrecision(const std::function<void(ModelTestBuilder&)>& build_test_case,
+                             const std::function<void(Graph&)>& check_graph,
+                             const std::unordered_set<std::string>& allow_ops = {},
+                             const std::unordered_set<std::string>& deny_ops = {}) {
+  const auto& logger = DefaultLoggingManager().DefaultLogger();
+  Model model("AutoMixedPrecisionTest", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 13}}, {}, logger);
+  Graph& graph = model.MainGraph();
+
+  ModelTestBuilder builder(graph);
+  build_test_case(builder);
+  builder.SetGraphOutputs();
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  for (auto& node : graph.Nodes()) {
+    node.SetExecutionProviderType(kCudaExecutionProvider);
+  }
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(
+      std::make_unique<AutoMixedPrecisionTransformer>(allow_ops, deny_ops,
+                                                      std::unordered_set<std::string>{kCudaExecutionProvider}),
+      TransformerLevel::Level2));
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2, logger));
+
+  check_graph(graph);
+}
+
+int CountNodesWithOutputType(const Graph& graph, const std::string& op_type, const std::string& elem_type) {
+  int count = 0;
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == op_type && node.OutputDefs()[0]->Type() != nullptr &&
+        *node.OutputDefs()[0]->Type() == elem_type) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(AutoMixedPrecisionTests, ConvertsAllowedRegionAndKeepsSoftmaxInFloat) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({2, 8}, -1.f, 1.f);
+    auto* weight = builder.MakeInitializer<float>({8, 8}, -1.f, 1.f);
+    auto* matmul_out = builder.MakeIntermediate();
+    auto* relu_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+
+    builder.AddNode("MatMul", {input_arg, weight}, {matmul_out});
+    builder.AddNode("Relu", {matmul_out}, {relu_out});
+    builder.AddNode("Softmax", {relu_out}, {output_arg});
+  };
+
+  auto check_graph = [](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    // one cast into the region, one out of it before the Softmax; the MatMul -> Relu
+    // boundary connects in float16 directly
+    EXPECT_EQ(op_to_count["Cast"], 2);
+    EXPECT_EQ(CountNodesWithOutputType(graph, "MatMul", "tensor(float16)"), 1);
+    EXPECT_EQ(CountNodesWithOutputType(graph, "Relu", "tensor(float16)"), 1);
+    EXPECT_EQ(CountNodesWithOutputType(graph, "Softmax", "tensor(float)"), 1);
+
+    // the weight is converted in place rather than cast at runtime
+    for (const auto& node : graph.Nodes()) {
+      if (node.OpType() == "MatMul") {
+        EXPECT_EQ(*node.InputDefs()[1]->Type(), "tensor(float16)");
+      }
+    }
+  };
+
+  ApplyAutoMixedPrecision(build_test_case, check_graph);
+}
+
+TEST(AutoMixedPrecisionTests, DenyListKeepsOpInFloat) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({2, 8}, -1.f, 1.f);
+    auto* weight = builder.MakeInitializer<float>({8, 8}, -1.f, 1.f);
+    auto* matmul_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+
+    builder.AddNode("MatMul", {input_arg, weight}, {matmul_out});
+    builder.AddNode("Relu", {matmul_out}, {output_arg});
+  };
+
+  auto check_graph = [](Graph& graph) {
+    EXPECT_EQ(CountNodesWithOutputType(graph, "MatMul", "tensor(float)"), 1);
+    EXPECT_EQ(CountNodesWithOutputType(graph, "Relu", "tensor(float16)"), 1);
+  };
+
+  ApplyAutoMixedPrecision(build_test_case, check_graph, {}, {"MatMul"});
+}
+
+TEST(AutoMixedPrecisionTests, GraphOutputOfConvertedNodeIsCastBackToFloat) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({4, 4}, -1.f, 1.f);
+    auto* weight = builder.MakeInitializer<float>({4, 4}, -1.f, 1.f);
+    auto* output_arg = builder.MakeOutput();
+
+    builder.AddNode("MatMul", {input_arg, weight}, {output_arg});
+  };
+
+  auto check_graph = [](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    // cast in for the fed input, cast out to keep the graph output in float
+    EXPECT_EQ(op_to_count["Cast"], 2);
+    EXPECT_EQ(CountNodesWithOutputType(graph, "MatMul", "tensor(float16)"), 1);
+    EXPECT_EQ(*graph.GetOutputs()[0]->Type(), "tensor(float)");
+  };
+
+  ApplyAutoMixedPrecision(build_test_case, check_graph);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
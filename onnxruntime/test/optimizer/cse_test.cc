@@ -247,6 +247,74 @@ TEST(CseTests, Subgraph) {
   }
 }
 
+TEST(CseTests, HoistCommonExpressionsAboveIf) {
+  const auto& logger = DefaultLoggingManager().DefaultLogger();
+
+  ONNX_NAMESPACE::TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  ONNX_NAMESPACE::TypeProto bool_tensor;
+  bool_tensor.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_BOOL);
+  bool_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  // Both branches compute Mul(Add(x, x), Add(x, x)) from the outer scope value 'x'. The Add should
+  // be hoisted in front of the If node; the Mul produces the branch output so it must stay in place.
+  ONNX_NAMESPACE::GraphProto branch_proto;
+  {
+    Model branch_model("cse_if_branch", false, ModelMetaData(), PathString(),
+                       IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {}, logger);
+    Graph& branch = branch_model.MainGraph();
+
+    auto& x = branch.GetOrCreateNodeArg("x", &float_tensor);
+    branch.AddOuterScopeNodeArg("x");
+
+    auto& add_out = branch.GetOrCreateNodeArg("add_out", &float_tensor);
+    branch.AddNode("branch_add", "Add", "Expression common to both branches.", {&x, &x}, {&add_out});
+
+    auto& branch_out = branch.GetOrCreateNodeArg("branch_out", &float_tensor);
+    branch.AddNode("branch_mul", "Mul", "Produces the branch output.", {&add_out, &add_out}, {&branch_out});
+
+    ASSERT_TRUE(branch.Resolve().IsOK());
+    branch_proto = branch.ToGraphProto();
+  }
+
+  Model model("cse_if_main", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {}, logger);
+  Graph& graph = model.MainGraph();
+
+  auto& cond = graph.GetOrCreateNodeArg("b", &bool_tensor);
+  auto& x = graph.GetOrCreateNodeArg("x", &float_tensor);
+  auto& result = graph.GetOrCreateNodeArg("Result", &float_tensor);
+
+  auto& if_node = graph.AddNode("if", "If", "If node with a common expression in both branches.",
+                                {&cond}, {&result});
+  if_node.AddAttribute("then_branch", branch_proto);
+  if_node.AddAttribute("else_branch", branch_proto);
+
+  // 'x' is only consumed from the branches, so it has to be listed as a graph input explicitly
+  graph.SetInputs({&cond, &x});
+  ASSERT_TRUE(graph.Resolve().IsOK());
+
+  auto op_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_count["Add"], 2);
+  ASSERT_EQ(op_count["Mul"], 2);
+
+  ApplyCse(model);
+
+  op_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_count["Add"], 1);
+  ASSERT_EQ(op_count["Mul"], 2);
+
+  // the hoisted Add lives in the main graph; each branch retains only its Mul
+  op_count = CountOpsInGraph(graph, /*recurse_into_subgraphs*/ false);
+  ASSERT_EQ(op_count["Add"], 1);
+  ASSERT_EQ(op_count["If"], 1);
+
+  const auto& output_names = GetSortedNames(graph.GetOutputs());
+  ASSERT_EQ(output_names, (std::vector<std::string>{"Result"}));
+}
+
 TEST(CseTests, MergedValueAndGraphOutputAreOutputsOfSameNode) {
   auto model_uri = ORT_TSTR("testdata/transform/cse/cse_only_one_graph_output.onnx");
   std::shared_ptr<Model> model;
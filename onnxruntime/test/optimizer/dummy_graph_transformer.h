@@ -26,6 +26,29 @@ class DummyGraphTransformer : public GraphTransformer {
   }
 };
 
+// Dummy graph transformer that counts how often it is applied and reports the graph as modified
+// for a fixed number of applications. This is used to test the re-application logic in
+// GraphTransformerManager::ApplyTransformers.
+class CountingGraphTransformer : public GraphTransformer {
+ public:
+  CountingGraphTransformer(const std::string& name, int num_modifying_applications) noexcept
+      : GraphTransformer(name), num_modifying_applications_(num_modifying_applications) {}
+
+  int ApplyCount() const {
+    return apply_count_;
+  }
+
+ private:
+  int num_modifying_applications_;
+  mutable int apply_count_ = 0;
+
+  Status ApplyImpl(Graph& /*graph*/, bool& modified, int /*graph_level*/, const logging::Logger&) const override {
+    modified = apply_count_ < num_modifying_applications_;
+    ++apply_count_;
+    return Status::OK();
+  }
+};
+
 // Dummy graph transformer that does nothing, but just sets the modified value
 // This is currently used to test custom transformer selection feature
 class DummyRewriteRule : public RewriteRule {
@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "graph_transform_test_builder.h"
+
+#include "core/graph/graph.h"
+
+namespace onnxruntime {
+namespace test {
+
+#ifndef DISABLE_CONTRIB_OPS
+
+TEST(ElementwiseFusionTests, FuseChainWithScalarAndVectorOperands) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({2, 3, 8}, -1.f, 1.f);
+    auto* mul_out = builder.MakeIntermediate();
+    auto* add_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* scale = builder.MakeInitializer<float>({8}, -1.f, 1.f);
+    auto* shift = builder.MakeScalarInitializer<float>(1.25f);
+    auto* residual = builder.MakeInitializer<float>({2, 3, 8}, -1.f, 1.f);
+
+    builder.AddNode("Mul", {input_arg, scale}, {mul_out});
+    builder.AddNode("Add", {mul_out, shift}, {add_out});
+    builder.AddNode("Sub", {add_out, residual}, {output_arg});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Mul"], 0);
+    EXPECT_EQ(op_to_count["Add"], 0);
+    EXPECT_EQ(op_to_count["Sub"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedElementwise"], 1);
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Level1,
+                    TransformerLevel::Level2);
+}
+
+TEST(ElementwiseFusionTests, FuseChainWithReversedOperandOrder) {
+  // the accumulated value feeds input 1 of the Sub and Div nodes, so the fused node
+  // must record the reversed variants
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({3, 16}, 1.f, 2.f);
+    auto* sub_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* minuend = builder.MakeInitializer<float>({3, 16}, 3.f, 4.f);
+    auto* dividend = builder.MakeInitializer<float>({16}, 1.f, 2.f);
+
+    builder.AddNode("Sub", {minuend, input_arg}, {sub_out});
+    builder.AddNode("Div", {dividend, sub_out}, {output_arg});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Sub"], 0);
+    EXPECT_EQ(op_to_count["Div"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedElementwise"], 1);
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Level1,
+                    TransformerLevel::Level2);
+}
+
+TEST(ElementwiseFusionTests, NoFusionWhenIntermediateHasMultipleConsumers) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({2, 8}, -1.f, 1.f);
+    auto* mul_out = builder.MakeIntermediate();
+    auto* add_output = builder.MakeOutput();
+    auto* sub_output = builder.MakeOutput();
+    auto* scale = builder.MakeScalarInitializer<float>(0.5f);
+    auto* shift = builder.MakeScalarInitializer<float>(1.f);
+
+    builder.AddNode("Mul", {input_arg, scale}, {mul_out});
+    builder.AddNode("Add", {mul_out, shift}, {add_output});
+    builder.AddNode("Sub", {mul_out, shift}, {sub_output});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Mul"], 1);
+    EXPECT_EQ(op_to_count["Add"], 1);
+    EXPECT_EQ(op_to_count["Sub"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedElementwise"], 0);
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Level1,
+                    TransformerLevel::Level2);
+}
+
+TEST(ElementwiseFusionTests, NoFusionWhenShapeExpandsMidChain) {
+  // the Add broadcasts the accumulated [16] value up to [3, 16], so the chain must not
+  // include the starting Mul
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({16}, -1.f, 1.f);
+    auto* mul_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* scale = builder.MakeInitializer<float>({16}, -1.f, 1.f);
+    auto* expander = builder.MakeInitializer<float>({3, 16}, -1.f, 1.f);
+
+    builder.AddNode("Mul", {input_arg, scale}, {mul_out});
+    builder.AddNode("Add", {mul_out, expander}, {output_arg});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Mul"], 1);
+    EXPECT_EQ(op_to_count["Add"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedElementwise"], 0);
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Level1,
+                    TransformerLevel::Level2);
+}
+
+#endif  // DISABLE_CONTRIB_OPS
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "graph_transform_test_builder.h"
+
+#include "core/graph/graph.h"
+
+namespace onnxruntime {
+namespace test {
+
+#ifndef DISABLE_CONTRIB_OPS
+
+TEST(GatherNDFusionTests, FuseGatherNDMulAdd) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* data_arg = builder.MakeInput<float>({4, 8}, -1.f, 1.f);
+    auto* gather_out = builder.MakeIntermediate();
+    auto* mul_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* indices = builder.MakeInitializer<int64_t>({3, 1}, {2, 0, 3});
+    auto* scale = builder.MakeInitializer<float>({8}, -1.f, 1.f);
+    auto* bias = builder.MakeScalarInitializer<float>(0.5f);
+
+    builder.AddNode("GatherND", {data_arg, indices}, {gather_out});
+    builder.AddNode("Mul", {gather_out, scale}, {mul_out});
+    builder.AddNode("Add", {mul_out, bias}, {output_arg});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["GatherND"], 0);
+    EXPECT_EQ(op_to_count["Mul"], 0);
+    EXPECT_EQ(op_to_count["Add"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedGatherND"], 1);
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Level1,
+                    TransformerLevel::Level2);
+}
+
+TEST(GatherNDFusionTests, FuseGatherNDAddOnly) {
+  // the bias feeds input 0 of the Add and the gather keeps a 2-D slice shape
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* data_arg = builder.MakeInput<float>({5, 2, 4}, -1.f, 1.f);
+    auto* gather_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* indices = builder.MakeInitializer<int64_t>({2, 1}, {4, 1});
+    auto* bias = builder.MakeInitializer<float>({2, 4}, -1.f, 1.f);
+
+    builder.AddNode("GatherND", {data_arg, indices}, {gather_out});
+    builder.AddNode("Add", {bias, gather_out}, {output_arg});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["GatherND"], 0);
+    EXPECT_EQ(op_to_count["Add"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedGatherND"], 1);
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Level1,
+                    TransformerLevel::Level2);
+}
+
+TEST(GatherNDFusionTests, NoFusionWhenOperandBroadcastsWithinSlice) {
+  // the operand covers only part of a slice, so the per-slice epilogue cannot express the
+  // original broadcast and the nodes must stay separate
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* data_arg = builder.MakeInput<float>({5, 2, 4}, -1.f, 1.f);
+    auto* gather_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* indices = builder.MakeInitializer<int64_t>({2, 1}, {4, 1});
+    auto* scale = builder.MakeInitializer<float>({4}, -1.f, 1.f);
+
+    builder.AddNode("GatherND", {data_arg, indices}, {gather_out});
+    builder.AddNode("Mul", {gather_out, scale}, {output_arg});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["GatherND"], 1);
+    EXPECT_EQ(op_to_count["Mul"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedGatherND"], 0);
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Level1,
+                    TransformerLevel::Level2);
+}
+
+TEST(GatherNDFusionTests, NoFusionWhenOperandIsNotConstant) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* data_arg = builder.MakeInput<float>({4, 8}, -1.f, 1.f);
+    auto* scale_arg = builder.MakeInput<float>({8}, -1.f, 1.f);
+    auto* gather_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* indices = builder.MakeInitializer<int64_t>({3, 1}, {2, 0, 3});
+
+    builder.AddNode("GatherND", {data_arg, indices}, {gather_out});
+    builder.AddNode("Mul", {gather_out, scale_arg}, {output_arg});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["GatherND"], 1);
+    EXPECT_EQ(op_to_count["Mul"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedGatherND"], 0);
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Level1,
+                    TransformerLevel::Level2);
+}
+
+#endif  // DISABLE_CONTRIB_OPS
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -46,6 +46,7 @@
 #include "core/optimizer/layer_norm_fusion.h"
 #include "core/optimizer/matmul_add_fusion.h"
 #include "core/optimizer/matmul_integer_to_float.h"
+#include "core/optimizer/matmul_intn_weight_quantization.h"
 #include "core/optimizer/matmul_scale_fusion.h"
 #include "core/optimizer/matmul_transpose_fusion.h"
 #include "core/optimizer/noop_elimination.h"
@@ -68,6 +69,7 @@
 #include "test/common/tensor_op_test_utils.h"
 #include "test/compare_ortvalue.h"
 #include "test/framework/test_utils.h"
+#include "test/optimizer/graph_transform_test_builder.h"
 #include "test/optimizer/graph_transform_test_fixture.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/test_environment.h"
@@ -348,6 +350,68 @@ TEST_F(GraphTransformationTests, ConstantFoldingSubgraph) {
       << "Constant folding should have been able to remove the Add node in both subgraphs";
 }
 
+TEST_F(GraphTransformationTests, ConstantFoldingSharedConstantSubexpressions) {
+  // two Add nodes compute the same value from distinct but identical initializers. the second fold
+  // reuses the result that was computed for the first one, and both folded outputs must be correct.
+  Model model("ConstantFoldingSharedSubexpressionsTest", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {}, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto float_tensor_type;
+  float_tensor_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  auto add_initializer = [&graph](const std::string& name, float value) {
+    TensorProto value_tensor;
+    value_tensor.set_name(name);
+    value_tensor.add_dims(1);
+    value_tensor.add_float_data(value);
+    value_tensor.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    graph.AddInitializedTensor(value_tensor);
+  };
+
+  add_initializer("c0", 1.f);
+  add_initializer("c1", 2.f);
+  add_initializer("c2", 1.f);
+  add_initializer("c3", 2.f);
+
+  auto& c0_arg = graph.GetOrCreateNodeArg("c0", &float_tensor_type);
+  auto& c1_arg = graph.GetOrCreateNodeArg("c1", &float_tensor_type);
+  auto& c2_arg = graph.GetOrCreateNodeArg("c2", &float_tensor_type);
+  auto& c3_arg = graph.GetOrCreateNodeArg("c3", &float_tensor_type);
+  auto& input_arg = graph.GetOrCreateNodeArg("input", &float_tensor_type);
+  auto& add0_out = graph.GetOrCreateNodeArg("add0_out", &float_tensor_type);
+  auto& add1_out = graph.GetOrCreateNodeArg("add1_out", &float_tensor_type);
+  auto& mul0_out = graph.GetOrCreateNodeArg("mul0_out", &float_tensor_type);
+  auto& mul1_out = graph.GetOrCreateNodeArg("mul1_out", &float_tensor_type);
+
+  graph.AddNode("add0", "Add", "Add identical constants.", {&c0_arg, &c1_arg}, {&add0_out});
+  graph.AddNode("add1", "Add", "Add identical constants.", {&c2_arg, &c3_arg}, {&add1_out});
+  graph.AddNode("mul0", "Mul", "Consume the first folded value.", {&input_arg, &add0_out}, {&mul0_out});
+  graph.AddNode("mul1", "Mul", "Consume the second folded value.", {&input_arg, &add1_out}, {&mul1_out});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  std::unique_ptr<CPUExecutionProvider> e =
+      std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(std::make_unique<ConstantFolding>(*e.get(), false /*skip_dequantize_linear*/), TransformerLevel::Level1);
+
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  ASSERT_TRUE(op_to_count["Add"] == 0);
+  ASSERT_TRUE(op_to_count["Mul"] == 2);
+
+  for (const auto* folded_name : {"add0_out", "add1_out"}) {
+    const auto* folded_tensor = graph_utils::GetConstantInitializer(graph, folded_name);
+    ASSERT_TRUE(folded_tensor != nullptr);
+    Initializer folded_value(*folded_tensor, graph.ModelPath());
+    ASSERT_TRUE(folded_value.size() == 1);
+    EXPECT_EQ(*folded_value.data<float>(), 3.f);
+  }
+}
+
 TEST_F(GraphTransformationTests, ConstantFoldingWithShapeToInitializer) {
   auto model_uri = MODEL_FOLDER "fusion/constant_folding_with_shape_to_initializer.onnx";
   std::shared_ptr<Model> model;
@@ -405,6 +469,79 @@ TEST_F(GraphTransformationTests, ConstantFoldingWithScalarShapeToInitializer) {
   ASSERT_TRUE(op_to_count["Add"] == 1);
 }
 
+TEST_F(GraphTransformationTests, ConstantFoldingGatherOfShapeWithSymbolicDims) {
+  // the Shape node itself can't fold because the batch dim is symbolic, but the Gather only
+  // selects the static dims, so it and the downstream shape-computation chain should fold.
+  Model model("ConstantFoldingGatherOfShapeTest", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {}, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto input_type;
+  input_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("batch");
+  input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(8);
+  input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(16);
+
+  TypeProto shape_out_type;
+  shape_out_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT64);
+  shape_out_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+
+  TypeProto indices_type;
+  indices_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT64);
+  indices_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  TypeProto gather_out_type;
+  gather_out_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT64);
+  gather_out_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  TypeProto matrix_type;
+  matrix_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  matrix_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(8);
+  matrix_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(16);
+
+  TensorProto indices_tensor;
+  indices_tensor.set_name("gather_indices");
+  indices_tensor.add_dims(2);
+  indices_tensor.add_int64_data(1);
+  indices_tensor.add_int64_data(2);
+  indices_tensor.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_INT64);
+  graph.AddInitializedTensor(indices_tensor);
+
+  auto& input_arg = graph.GetOrCreateNodeArg("input", &input_type);
+  auto& addend_arg = graph.GetOrCreateNodeArg("addend", &matrix_type);
+  auto& shape_out = graph.GetOrCreateNodeArg("shape_out", &shape_out_type);
+  auto& indices_arg = graph.GetOrCreateNodeArg("gather_indices", &indices_type);
+  auto& gather_out = graph.GetOrCreateNodeArg("gather_out", &gather_out_type);
+  auto& cos_out = graph.GetOrCreateNodeArg("cos_out", &matrix_type);
+  auto& add_out = graph.GetOrCreateNodeArg("add_out", &matrix_type);
+
+  graph.AddNode("shape", "Shape", "Shape with a symbolic batch dim.", {&input_arg}, {&shape_out});
+  graph.AddNode("gather", "Gather", "Select the static dims.", {&shape_out, &indices_arg}, {&gather_out});
+  graph.AddNode("cos", "ConstantOfShape", "Consume the folded dims.", {&gather_out}, {&cos_out});
+  graph.AddNode("add", "Add", "Keep a non-constant consumer.", {&cos_out, &addend_arg}, {&add_out});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  std::unique_ptr<CPUExecutionProvider> e =
+      std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(std::make_unique<ConstantFolding>(*e.get(), false /*skip_dequantize_linear*/), TransformerLevel::Level1);
+
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  ASSERT_TRUE(op_to_count["Shape"] == 0);
+  ASSERT_TRUE(op_to_count["Gather"] == 0);
+  ASSERT_TRUE(op_to_count["ConstantOfShape"] == 0);
+  ASSERT_TRUE(op_to_count["Add"] == 1);
+
+  // the whole chain collapsed into the ConstantOfShape output, shaped by the gathered dims
+  const auto* folded_tensor = graph_utils::GetConstantInitializer(graph, "cos_out");
+  ASSERT_TRUE(folded_tensor != nullptr);
+  Initializer folded_value(*folded_tensor, graph.ModelPath());
+  ASSERT_TRUE(folded_value.size() == 8 * 16);
+}
+
 static void VerifyConstantFoldingWithDequantizeLinear(int quantize_linear_count,
                                                       int dequantize_linear_count,
                                                       int conv_count,
@@ -1096,6 +1233,31 @@ TEST_F(GraphTransformationTests, TransposeMatmulFusionOnThreeTranspose) {
   ASSERT_TRUE(static_cast<bool>(node.GetAttributes().at("transB").i()));
 }
 
+TEST_F(GraphTransformationTests, TransposeReshapeMatmulFusion) {
+  auto model_uri = MODEL_FOLDER "fusion/transpose_reshape_matmul_fusion.onnx";
+  std::shared_ptr<Model> p_model;
+  ASSERT_STATUS_OK(Model::Load(model_uri, p_model, nullptr, *logger_));
+  Graph& graph = p_model->MainGraph();
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(
+      std::make_unique<MatmulTransposeFusion>(), TransformerLevel::Level1));
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_to_count["Transpose"], 0);
+  ASSERT_EQ(op_to_count["MatMul"], 0);
+  ASSERT_EQ(op_to_count["Reshape"], 1);
+  ASSERT_EQ(op_to_count["com.microsoft.FusedMatMul"], 1);
+
+  for (const Node& node : graph.Nodes()) {
+    if (node.OpType() == "FusedMatMul") {
+      ASSERT_TRUE(static_cast<bool>(node.GetAttributes().at("transA").i()));
+      ASSERT_FALSE(static_cast<bool>(node.GetAttributes().at("transB").i()));
+    }
+  }
+}
+
 TEST_F(GraphTransformationTests, TransposeMatmulNoFusionOnInvalidInput) {
   const std::vector<PathString> model_uris = {
       MODEL_FOLDER "fusion/transpose_matmul_4d_fusion_invalid_perm.onnx",
@@ -2381,6 +2543,40 @@ TEST_F(GraphTransformationTests, AttentionFusionFloat32Test) {
   ValidateAttention(graph);
 }
 
+// Test Attention Fusion with an additive bias (e.g. ALiBi) on the QxK' scores instead of a key padding mask
+TEST_F(GraphTransformationTests, AttentionFusionAdditiveMaskTest) {
+  auto model_uri = MODEL_FOLDER "fusion/attention_additive_mask.onnx";
+  std::shared_ptr<Model> p_model;
+  ASSERT_STATUS_OK(Model::Load(model_uri, p_model, nullptr, *logger_));
+  Graph& graph = p_model->MainGraph();
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(std::make_unique<AttentionFusion>(), TransformerLevel::Level2);
+  auto ret = graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2, *logger_);
+  ASSERT_TRUE(ret.IsOK());
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  EXPECT_EQ(op_to_count["MatMul"], 1);
+  EXPECT_EQ(op_to_count["Add"], 2);
+  EXPECT_EQ(op_to_count["Transpose"], 0);
+  EXPECT_EQ(op_to_count["Reshape"], 0);
+  EXPECT_EQ(op_to_count["Div"], 0);
+  EXPECT_EQ(op_to_count["Softmax"], 0);
+  EXPECT_EQ(op_to_count["com.microsoft.Attention"], 1);
+
+  // The bias feeds the fused node through the optional extra_add input.
+  for (const Node& node : graph.Nodes()) {
+    if (node.OpType() == "Attention") {
+      ASSERT_EQ(node.InputDefs().size(), 6u);
+      EXPECT_FALSE(node.InputDefs()[3]->Exists());
+      EXPECT_FALSE(node.InputDefs()[4]->Exists());
+      EXPECT_EQ(node.InputDefs()[5]->Name(), "additive_bias");
+    }
+  }
+
+  ValidateAttention(graph);
+}
+
 // Test GPT-2 Attention Fusion with past and unidirectional mask
 TEST_F(GraphTransformationTests, AttentionFusionWithPastAndUnidirMaskTest) {
   auto model_uri = MODEL_FOLDER "fusion/attention_past_unidir.onnx";
@@ -2705,6 +2901,81 @@ TEST_F(GraphTransformationTests, GeluApproximation_SessionOptionConfig) {
   VerifyGeluApproximation(false, session_options);
 }
 
+static void VerifyWeightOnlyQuantization(bool is_enabled, SessionOptions& session_options) {
+  std::unique_ptr<CPUExecutionProvider> e =
+      std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+
+  bool has_weight_only_quantization = false;
+  auto transformers = optimizer_utils::GenerateTransformers(TransformerLevel::Level2, session_options, *e.get(), {});
+  for (auto& transformer : transformers) {
+    if (transformer->Name() == "MatMulIntNWeightQuantization") {
+      has_weight_only_quantization = true;
+    }
+  }
+
+  EXPECT_EQ(has_weight_only_quantization, is_enabled);
+}
+
+// Test session option configuration for MatMulIntNWeightQuantization
+TEST_F(GraphTransformationTests, MatMulIntNWeightQuantization_SessionOptionConfig) {
+  SessionOptions session_options;
+
+  // Weight only quantization is not enabled by default.
+  VerifyWeightOnlyQuantization(false, session_options);
+
+  session_options.config_options.AddConfigEntry(kOrtSessionOptionsWeightOnlyQuantBits, "4");
+  VerifyWeightOnlyQuantization(true, session_options);
+
+  session_options.config_options.AddConfigEntry(kOrtSessionOptionsWeightOnlyQuantBits, "8");
+  VerifyWeightOnlyQuantization(true, session_options);
+
+  session_options.config_options.AddConfigEntry(kOrtSessionOptionsWeightOnlyQuantBits, "0");
+  VerifyWeightOnlyQuantization(false, session_options);
+}
+
+// Test MatMul with a large constant weight -> MatMulIntNWeight
+TEST_F(GraphTransformationTests, MatMulIntNWeightQuantization_MatMul) {
+  for (const int64_t bits : {int64_t{4}, int64_t{8}}) {
+    // Build a weight whose values are exactly representable at the chosen bit width so the
+    // rewritten graph reproduces the float results up to summation order.
+    constexpr int64_t K = 128;
+    constexpr int64_t N = 128;
+    constexpr int64_t group_size = 64;  // matches the transformer's group size
+    const int64_t q_max = bits == 4 ? 7 : 127;
+    const float scale = bits == 4 ? 1.f / 8.f : 1.f / 64.f;
+    std::default_random_engine generator{42};
+    std::uniform_int_distribution<int64_t> distribution(-q_max, q_max);
+    std::vector<float> weight_data(K * N);
+    for (int64_t k = 0; k < K; ++k) {
+      for (int64_t n = 0; n < N; ++n) {
+        // pin the first row of each group to the max magnitude so the computed scale is exact
+        const int64_t q = (k % group_size == 0) ? q_max : distribution(generator);
+        weight_data[k * N + n] = static_cast<float>(q) * scale;
+      }
+    }
+
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<float>({2, K}, -1.f, 1.f);
+      auto* weight_arg = builder.MakeInitializer<float>({K, N}, weight_data);
+      auto* output_arg = builder.MakeOutput();
+      builder.AddNode("MatMul", {input_arg, weight_arg}, {output_arg});
+    };
+
+    auto check_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["MatMul"], 0);
+      EXPECT_EQ(op_to_count["com.microsoft.MatMulIntNWeight"], 1);
+    };
+
+    TransformerTester(build_test_case, check_graph,
+                      TransformerLevel::Level1, TransformerLevel::Level2,
+                      12 /*opset_version*/,
+                      1e-4 /*per_sample_tolerance*/,
+                      1e-4 /*relative_per_sample_tolerance*/,
+                      std::make_unique<MatMulIntNWeightQuantization>(bits));
+  }
+}
+
 // Test Gelu -> FastGelu
 TEST_F(GraphTransformationTests, GeluApproximation_Gelu) {
   auto model_uri = MODEL_FOLDER "approximation/gelu.onnx";
@@ -708,6 +708,70 @@ TEST(NchwcOptimizerTests, ConvBinaryBroadcast) {
   }
 }
 
+TEST(NchwcOptimizerTests, ConvBinaryMixedLayout) {
+  auto test_case = [&](const std::string& op_type) {
+    auto build_test_case = [&](NchwcTestHelper& helper) {
+      auto* input_arg = helper.MakeInput<float>({1, 32, 23, 23});
+      auto* side_input_arg = helper.MakeInput<float>({1, 32, 21, 21});
+      auto* conv1_output_arg = helper.MakeIntermediate();
+      auto* binary_output_arg = helper.MakeIntermediate();
+      auto* output_arg = helper.MakeOutput();
+
+      helper.AddConvNode(input_arg, conv1_output_arg, {32, 32, 3, 3});
+      helper.AddNode(op_type, {conv1_output_arg, side_input_arg}, {binary_output_arg});
+      helper.AddConvNode(binary_output_arg, output_arg, {32, 32, 3, 3});
+    };
+
+    auto check_nchwc_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.Conv"], 2);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderInput"], 2);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderOutput"], 1);
+      EXPECT_EQ(op_to_count[op_type], 1);
+    };
+
+    NchwcOptimizerTester(build_test_case, check_nchwc_graph);
+  };
+
+  // Verify that a binary operator with one NCHWc input and one NCHW input is
+  // converted by reordering the NCHW input when a downstream node wants the
+  // output in NCHWc format, instead of reordering around the binary operator.
+  std::vector<std::string> op_types{"Add", "Sum", "Mul"};
+  for (auto& op_type : op_types) {
+    test_case(op_type);
+  }
+}
+
+TEST(NchwcOptimizerTests, ConvBinaryMixedLayoutFromNode) {
+  auto build_test_case = [&](NchwcTestHelper& helper) {
+    auto* input_arg = helper.MakeInput<float>({1, 32, 23, 23});
+    auto* side_input_arg = helper.MakeInput<float>({1, 32, 21, 21});
+    auto* neg_output_arg = helper.MakeIntermediate();
+    auto* conv1_output_arg = helper.MakeIntermediate();
+    auto* add_output_arg = helper.MakeIntermediate();
+    auto* output_arg = helper.MakeOutput();
+
+    helper.AddConvNode(input_arg, conv1_output_arg, {32, 32, 3, 3});
+    helper.AddNode("Neg", {side_input_arg}, {neg_output_arg});
+    helper.AddNode("Add", {conv1_output_arg, neg_output_arg}, {add_output_arg});
+    helper.AddConvNode(add_output_arg, output_arg, {32, 32, 3, 3});
+  };
+
+  auto check_nchwc_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.Conv"], 2);
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderInput"], 2);
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderOutput"], 1);
+    EXPECT_EQ(op_to_count["Add"], 1);
+    EXPECT_EQ(op_to_count["Neg"], 1);
+  };
+
+  // Same as above, but with the NCHW input produced by a node that this
+  // transformer does not understand, so the binary operator still has an
+  // input edge when it is visited.
+  NchwcOptimizerTester(build_test_case, check_nchwc_graph);
+}
+
 TEST(NchwcOptimizerTests, ConvConcat) {
   auto test_case = [&](int axis, int channel_count, int reorder_output_count) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "graph_transform_test_builder.h"
+
+#include "core/graph/graph.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(PadFusionTests, FusePadIntoConv) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* data_arg = builder.MakeInput<float>({1, 3, 8, 8}, -1.f, 1.f);
+    auto* pad_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* pads = builder.MakeInitializer<int64_t>({8}, {0, 0, 1, 2, 0, 0, 3, 4});
+    auto* weights = builder.MakeInitializer<float>({4, 3, 3, 3}, -1.f, 1.f);
+
+    builder.AddNode("Pad", {data_arg, pads}, {pad_out});
+    Node& conv_node = builder.AddNode("Conv", {pad_out, weights}, {output_arg});
+    conv_node.AddAttribute("pads", std::vector<int64_t>{1, 0, 1, 0});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Pad"], 0);
+    EXPECT_EQ(op_to_count["Conv"], 1);
+
+    // the Pad's spatial padding is accumulated into the existing Conv pads
+    for (const auto& node : session.GetGraph().Nodes()) {
+      if (node.OpType() == "Conv") {
+        const auto& pads = node.GetAttributes().at("pads").ints();
+        ASSERT_EQ(pads.size(), 4);
+        EXPECT_EQ(pads.Get(0), 2);
+        EXPECT_EQ(pads.Get(1), 2);
+        EXPECT_EQ(pads.Get(2), 4);
+        EXPECT_EQ(pads.Get(3), 4);
+      }
+    }
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Default,
+                    TransformerLevel::Level1);
+}
+
+TEST(PadFusionTests, NoFusionWhenPadValueIsNotZero) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* data_arg = builder.MakeInput<float>({1, 3, 8, 8}, -1.f, 1.f);
+    auto* pad_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* pads = builder.MakeInitializer<int64_t>({8}, {0, 0, 1, 1, 0, 0, 1, 1});
+    auto* pad_value = builder.MakeScalarInitializer<float>(1.f);
+    auto* weights = builder.MakeInitializer<float>({4, 3, 3, 3}, -1.f, 1.f);
+
+    builder.AddNode("Pad", {data_arg, pads, pad_value}, {pad_out});
+    builder.AddNode("Conv", {pad_out, weights}, {output_arg});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Pad"], 1);
+    EXPECT_EQ(op_to_count["Conv"], 1);
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Default,
+                    TransformerLevel::Level1);
+}
+
+TEST(PadFusionTests, NoFusionWhenPaddingOnChannelDim) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* data_arg = builder.MakeInput<float>({1, 3, 8, 8}, -1.f, 1.f);
+    auto* pad_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* pads = builder.MakeInitializer<int64_t>({8}, {0, 1, 1, 1, 0, 1, 1, 1});
+    auto* weights = builder.MakeInitializer<float>({4, 5, 3, 3}, -1.f, 1.f);
+
+    builder.AddNode("Pad", {data_arg, pads}, {pad_out});
+    builder.AddNode("Conv", {pad_out, weights}, {output_arg});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Pad"], 1);
+    EXPECT_EQ(op_to_count["Conv"], 1);
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Default,
+                    TransformerLevel::Level1);
+}
+
+TEST(PadFusionTests, NoFusionWhenPadsAreNotConstant) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* data_arg = builder.MakeInput<float>({1, 3, 8, 8}, -1.f, 1.f);
+    // zero pads fed at runtime; the rule must not trigger because they are not a constant initializer
+    auto* pads_arg = builder.MakeInput<int64_t>({8}, int64_t(0), int64_t(0));
+    auto* pad_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* weights = builder.MakeInitializer<float>({4, 3, 3, 3}, -1.f, 1.f);
+
+    builder.AddNode("Pad", {data_arg, pads_arg}, {pad_out});
+    builder.AddNode("Conv", {pad_out, weights}, {output_arg});
+  };
+
+  auto check_fused_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Pad"], 1);
+    EXPECT_EQ(op_to_count["Conv"], 1);
+  };
+
+  TransformerTester(build_test_case,
+                    check_fused_graph,
+                    TransformerLevel::Default,
+                    TransformerLevel::Level1);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -1443,6 +1443,100 @@ TEST(QDQTransformerTests, QDQPropagation_DQ_Q) {
   test_case({1, 13, 13, 23});
 }
 
+TEST(QDQTransformerTests, QDQPropagation_SqueezeUnsqueeze) {
+  auto test_case = [&](const std::vector<int64_t>& input_shape) {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<float>(input_shape, -1.f, 1.f);
+      auto* output_arg = builder.MakeOutput();
+
+      // add QDQ
+      auto* qdq_output = AddQDQNodePair<uint8_t>(builder, input_arg, .004f, 129);
+
+      // add Squeeze
+      auto* squeeze_output = builder.MakeIntermediate();
+      Node& squeeze_node = builder.AddNode("Squeeze", {qdq_output}, {squeeze_output});
+      squeeze_node.AddAttribute("axes", std::vector<int64_t>{0});
+
+      // add Unsqueeze
+      auto* unsqueeze_output = builder.MakeIntermediate();
+      Node& unsqueeze_node = builder.AddNode("Unsqueeze", {squeeze_output}, {unsqueeze_output});
+      unsqueeze_node.AddAttribute("axes", std::vector<int64_t>{0});
+
+      // add Q
+      builder.AddQuantizeLinearNode<uint8_t>(unsqueeze_output, .004f, 129, output_arg);
+    };
+
+    auto check_squeeze_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["Squeeze"], 1);
+      EXPECT_EQ(op_to_count["Unsqueeze"], 1);
+      EXPECT_EQ(op_to_count["QuantizeLinear"], 1);
+      EXPECT_EQ(op_to_count["DequantizeLinear"], 0);
+    };
+
+    TransformerTester(build_test_case,
+                      check_squeeze_graph,
+                      TransformerLevel::Level1,
+                      TransformerLevel::Level2,
+                      12 /*opset_version*/);
+  };
+
+  test_case({1, 13, 13, 23});
+}
+
+TEST(QDQTransformerTests, QDQPropagation_Concat) {
+  auto test_case = [&](const std::vector<std::vector<int64_t>>& input_shapes, int64_t axis,
+                       bool same_scale, bool has_trailing_q) {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      std::vector<NodeArg*> concat_inputs;
+      for (size_t i = 0; i < input_shapes.size(); i++) {
+        auto* input_arg = builder.MakeInput<float>(input_shapes[i], -1.f, 1.f);
+        concat_inputs.push_back(
+            AddQDQNodePair<uint8_t>(builder, input_arg, (!same_scale && i == 0) ? .0039f : .004f, 129));
+      }
+
+      auto* concat_output = builder.MakeIntermediate();
+      Node& concat_node = builder.AddNode("Concat", concat_inputs, {concat_output});
+      concat_node.AddAttribute("axis", axis);
+
+      auto* output_arg = builder.MakeOutput();
+      if (has_trailing_q) {
+        // add Q + DQ on the Concat output
+        auto* q_output = builder.MakeIntermediate();
+        builder.AddQuantizeLinearNode<uint8_t>(concat_output, .004f, 129, q_output);
+        builder.AddDequantizeLinearNode<uint8_t>(q_output, .004f, 129, output_arg);
+      } else {
+        builder.AddNode("Identity", {concat_output}, {output_arg});
+      }
+    };
+
+    auto check_concat_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["Concat"], 1);
+      EXPECT_EQ(op_to_count["QuantizeLinear"], static_cast<int>(input_shapes.size()));
+      if (same_scale) {
+        // the Concat runs on uint8 with a single DequantizeLinear on its output, and the trailing
+        // Q/DQ pair cancels against it
+        EXPECT_EQ(op_to_count["DequantizeLinear"], 1);
+      } else {
+        EXPECT_EQ(op_to_count["DequantizeLinear"], static_cast<int>(input_shapes.size()) + (has_trailing_q ? 1 : 0));
+      }
+    };
+
+    TransformerTester(build_test_case,
+                      check_concat_graph,
+                      TransformerLevel::Level1,
+                      TransformerLevel::Level2,
+                      12 /*opset_version*/);
+  };
+
+  test_case({{1, 6, 36}, {1, 3, 36}}, 1, true, true);
+  test_case({{1, 6, 36}, {1, 6, 8}, {1, 6, 2}}, 2, true, false);
+  // differing scales must not propagate; without a trailing Q the QDQ selectors leave the
+  // DQ -> Concat subgraph alone as well
+  test_case({{1, 6, 36}, {1, 6, 8}, {1, 6, 2}}, 2, false, false);
+}
+
 TEST(QDQTransformerTests, Concat_UInt8) {
   auto test_case = [&](const std::vector<std::vector<int64_t>>& input_shapes,
                        int64_t axis,
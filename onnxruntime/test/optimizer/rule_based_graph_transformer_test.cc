@@ -56,6 +56,38 @@ TEST(RuleBasedGraphTransformerTest, TestCompatibleProviders) {
   ASSERT_TRUE(dummy_rule1_ptr->IsRewriteRuleInvoked());
 }
 
+TEST(RuleBasedGraphTransformerTest, TransformerSkippedWhenGraphUnchangedSinceLastRun) {
+  auto model_uri = ORT_TSTR("testdata/transform/fusion/fuse-conv-bn-mul-add-unsqueeze.onnx");
+
+  std::shared_ptr<Model> model;
+  ASSERT_TRUE(Model::Load(model_uri, model, nullptr,
+                          DefaultLoggingManager().DefaultLogger())
+                  .IsOK());
+  Graph& graph = model->MainGraph();
+
+  // The first transformer reports modifications for its first two applications, the second one
+  // never modifies the graph.
+  auto modifier = std::make_unique<CountingGraphTransformer>("Modifier", 2);
+  const auto* modifier_ptr = modifier.get();
+  auto observer = std::make_unique<CountingGraphTransformer>("Observer", 0);
+  const auto* observer_ptr = observer.get();
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_TRUE(graph_transformation_mgr.Register(std::move(modifier), TransformerLevel::Level2).IsOK());
+  ASSERT_TRUE(graph_transformation_mgr.Register(std::move(observer), TransformerLevel::Level2).IsOK());
+
+  ASSERT_TRUE(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2,
+                                                         DefaultLoggingManager().DefaultLogger())
+                  .IsOK());
+
+  // The modifier is re-applied until it stops reporting changes.
+  ASSERT_EQ(modifier_ptr->ApplyCount(), 3);
+
+  // The observer runs again after each modification, but is skipped in the final step because the
+  // graph has not changed since it last saw it.
+  ASSERT_EQ(observer_ptr->ApplyCount(), 2);
+}
+
 TEST(RuleBasedGraphTransformerTest, TestSettingStepsInGraphTransformerManager) {
   // steps provided at object construction time
   onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
@@ -0,0 +1,234 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/graph/model.h"
+#include "core/graph/onnx_protobuf.h"
+#include "core/session/environment.h"
+#include "core/session/inference_session.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "test/compare_ortvalue.h"
+#include "test/test_environment.h"
+#include "test/framework/test_utils.h"
+#include "test/util/include/inference_session_wrapper.h"
+#include <cstring>
+#include <numeric>
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+struct SpatialTilingTestHelper {
+  SpatialTilingTestHelper(Graph& graph) : graph_(graph), fill_value_(0) {
+  }
+
+  NodeArg* MakeInput(const std::vector<int64_t>& shape) {
+    OrtValue input_value;
+    CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), shape,
+                         FillRandomData(shape), &input_value);
+    std::string name = graph_.GenerateNodeArgName("input");
+    feeds_.insert(std::make_pair(name, input_value));
+
+    ONNX_NAMESPACE::TypeProto type_proto;
+    type_proto.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    for (auto& dim : shape) {
+      type_proto.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+    }
+
+    return &graph_.GetOrCreateNodeArg(name, &type_proto);
+  }
+
+  NodeArg* MakeOutput() {
+    std::string name = graph_.GenerateNodeArgName("output");
+    output_names_.push_back(name);
+    return &graph_.GetOrCreateNodeArg(name, nullptr);
+  }
+
+  NodeArg* MakeIntermediate() {
+    std::string name = graph_.GenerateNodeArgName("node");
+    return &graph_.GetOrCreateNodeArg(name, nullptr);
+  }
+
+  NodeArg* MakeInitializer(const std::vector<int64_t>& shape) {
+    std::string name = graph_.GenerateNodeArgName("constant");
+    auto data = FillRandomData(shape);
+    ONNX_NAMESPACE::TensorProto tensor_proto;
+    tensor_proto.set_name(name);
+    tensor_proto.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    tensor_proto.set_raw_data(data.data(), data.size() * sizeof(float));
+    for (auto& dim : shape) {
+      tensor_proto.add_dims(dim);
+    }
+    graph_.AddInitializedTensor(tensor_proto);
+
+    return &graph_.GetOrCreateNodeArg(name, nullptr);
+  }
+
+  Node& AddNode(const std::string& op_type,
+                const std::vector<NodeArg*>& input_args,
+                const std::vector<NodeArg*>& output_args) {
+    return graph_.AddNode(graph_.GenerateNodeName("node"),
+                          op_type,
+                          "description",
+                          input_args,
+                          output_args);
+  }
+
+  Node& AddConvNode(NodeArg* input_arg, NodeArg* output_arg, const std::vector<int64_t>& weights_shape) {
+    auto* weights_arg = MakeInitializer(weights_shape);
+    auto* biases_arg = MakeInitializer({weights_shape[0]});
+    return AddNode("Conv", {input_arg, weights_arg, biases_arg}, {output_arg});
+  }
+
+  std::vector<float> FillRandomData(const std::vector<int64_t>& shape) {
+    constexpr int min_fill_value = -23;
+    constexpr int max_fill_value = 23;
+
+    int64_t num_elements = std::accumulate(shape.begin(), shape.end(), int64_t(1), std::multiplies<int64_t>{});
+    std::vector<float> random_data;
+    random_data.resize(static_cast<size_t>(num_elements));
+    for (auto& value : random_data) {
+      value = static_cast<float>(fill_value_);
+      fill_value_++;
+      if (fill_value_ == max_fill_value) {
+        fill_value_ = min_fill_value;
+      }
+    }
+    return random_data;
+  }
+
+  Graph& graph_;
+  NameMLValMap feeds_;
+  std::vector<std::string> output_names_;
+  int fill_value_;
+};
+
+// Runs the model with and without spatial tiling enabled and verifies the
+// fetches match exactly. The fill data is small integers, so the float math is
+// exact and any tiling mistake shows up as a hard mismatch.
+void SpatialTilingTester(const std::function<void(SpatialTilingTestHelper& helper)>& build_test_case,
+                         const std::function<void(InferenceSessionWrapper& session)>& check_tiled_graph,
+                         int opset_version = 13) {
+  // Build the model for this test.
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = opset_version;
+  Model model("spatial_tiling", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              domain_to_version, {}, DefaultLoggingManager().DefaultLogger());
+  SpatialTilingTestHelper helper(model.MainGraph());
+  build_test_case(helper);
+  ASSERT_TRUE(model.MainGraph().Resolve().IsOK());
+
+  // Serialize the model to a string.
+  std::string model_data;
+  model.ToProto().SerializeToString(&model_data);
+
+  auto run_model = [&](const char* tile_count, std::vector<OrtValue>& fetches) {
+    SessionOptions session_options;
+    // Level2 runs the tiling transformer without the Level3 layout changes, so
+    // the op counts checked below stay platform independent.
+    session_options.graph_optimization_level = TransformerLevel::Level2;
+    session_options.session_logid = "SpatialTilingTests";
+    session_options.config_options.AddConfigEntry(kOrtSessionOptionsSpatialTilingTileCount, tile_count);
+    InferenceSessionWrapper session{session_options, GetEnvironment()};
+    ASSERT_TRUE(session.Load(model_data.data(), static_cast<int>(model_data.size())).IsOK());
+    ASSERT_TRUE(session.Initialize().IsOK());
+
+    RunOptions run_options;
+    auto status = session.Run(run_options, helper.feeds_, helper.output_names_, &fetches);
+    if (!status.IsOK()) {
+      std::cout << "Run failed with status message: " << status.ErrorMessage() << std::endl;
+    }
+    ASSERT_TRUE(status.IsOK());
+
+    if (strcmp(tile_count, "0") != 0) {
+      check_tiled_graph(session);
+    }
+  };
+
+  std::vector<OrtValue> baseline_fetches;
+  run_model("0", baseline_fetches);
+
+  std::vector<OrtValue> tiled_fetches;
+  run_model("3", tiled_fetches);
+
+  size_t num_outputs = baseline_fetches.size();
+  ASSERT_TRUE(num_outputs == tiled_fetches.size());
+
+  for (size_t i = 0; i < num_outputs; i++) {
+    std::pair<COMPARE_RESULT, std::string> ret =
+        CompareOrtValue(tiled_fetches[i], baseline_fetches[i], 0.0, 0.0, false);
+    EXPECT_EQ(ret.first, COMPARE_RESULT::SUCCESS) << ret.second;
+  }
+}
+
+TEST(SpatialTilingTransformerTest, ConvReluConvChain) {
+  auto build_test_case = [&](SpatialTilingTestHelper& helper) {
+    auto* input_arg = helper.MakeInput({1, 8, 30, 30});
+    auto* conv1_output_arg = helper.MakeIntermediate();
+    auto* relu_output_arg = helper.MakeIntermediate();
+    auto* output_arg = helper.MakeOutput();
+    helper.AddConvNode(input_arg, conv1_output_arg, {16, 8, 3, 3})
+        .AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+    helper.AddNode("Relu", {conv1_output_arg}, {relu_output_arg});
+    helper.AddConvNode(relu_output_arg, output_arg, {16, 16, 3, 3});
+  };
+
+  auto check_tiled_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Slice"], 3);
+    EXPECT_EQ(op_to_count["Concat"], 1);
+    EXPECT_EQ(op_to_count["Conv"], 6);
+    EXPECT_EQ(op_to_count["Relu"], 3);
+  };
+
+  SpatialTilingTester(build_test_case, check_tiled_graph);
+}
+
+TEST(SpatialTilingTransformerTest, IntermediateWithMultipleConsumersNotTiled) {
+  auto build_test_case = [&](SpatialTilingTestHelper& helper) {
+    auto* input_arg = helper.MakeInput({1, 8, 30, 30});
+    auto* conv1_output_arg = helper.MakeIntermediate();
+    auto* relu_output_arg = helper.MakeIntermediate();
+    auto* conv2_output_arg = helper.MakeOutput();
+    auto* pool_output_arg = helper.MakeOutput();
+    helper.AddConvNode(input_arg, conv1_output_arg, {16, 8, 3, 3});
+    helper.AddNode("Relu", {conv1_output_arg}, {relu_output_arg});
+    helper.AddConvNode(relu_output_arg, conv2_output_arg, {16, 16, 3, 3});
+    // Second consumer of the Relu output keeps the chain from being tiled.
+    helper.AddNode("GlobalAveragePool", {relu_output_arg}, {pool_output_arg});
+  };
+
+  auto check_tiled_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Slice"], 0);
+    EXPECT_EQ(op_to_count["Concat"], 0);
+    EXPECT_EQ(op_to_count["Conv"], 2);
+  };
+
+  SpatialTilingTester(build_test_case, check_tiled_graph);
+}
+
+TEST(SpatialTilingTransformerTest, StridedConvBreaksChain) {
+  auto build_test_case = [&](SpatialTilingTestHelper& helper) {
+    auto* input_arg = helper.MakeInput({1, 8, 30, 30});
+    auto* conv1_output_arg = helper.MakeIntermediate();
+    auto* output_arg = helper.MakeOutput();
+    helper.AddConvNode(input_arg, conv1_output_arg, {16, 8, 3, 3});
+    // A strided convolution is not tileable, so a chain of only two
+    // convolutions ending in it is left alone.
+    helper.AddConvNode(conv1_output_arg, output_arg, {16, 16, 3, 3})
+        .AddAttribute("strides", std::vector<int64_t>{2, 2});
+  };
+
+  auto check_tiled_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Slice"], 0);
+    EXPECT_EQ(op_to_count["Concat"], 0);
+    EXPECT_EQ(op_to_count["Conv"], 2);
+  };
+
+  SpatialTilingTester(build_test_case, check_tiled_graph);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
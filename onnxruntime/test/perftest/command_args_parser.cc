@@ -40,6 +40,13 @@ namespace perftest {
       "\t-r [repeated_times]: Specifies the repeated times if running in 'times' test mode.Default:1000.\n"
       "\t-t [seconds_to_run]: Specifies the seconds to run for 'duration' mode. Default:600.\n"
       "\t-p [profile_file]: Specifies the profile name to enable profiling and dump the profile data to the file.\n"
+      "\t-B [baseline_file]: Enables per-node regression checking. Per-node kernel timings are captured via the profiler;\n"
+      "\t\tif the file does not exist a baseline keyed by model hash and provider is written, otherwise the run is diffed\n"
+      "\t\tagainst it, regressed nodes are reported and the full diff is written to <baseline_file>.diff.csv.\n"
+      "\t-T [threshold_pct]: Per-node time increase in percent tolerated before a node is flagged as regressed with -B. Default: 10.\n"
+      "\t-R [replay_file]: Replay a capture written by the \"session.replay_capture_file\" session option: the captured\n"
+      "\t\tfeeds are used as the test inputs and the captured random seed is restored, so a production request can be\n"
+      "\t\tre-executed offline, typically together with -p to attach the profiler.\n"
       "\t-s: Show statistics result, like P75, P90. If no result_file provided this defaults to on.\n"
       "\t-v: Show verbose information.\n"
       "\t-x [intra_op_num_threads]: Sets the number of threads used to parallelize the execution within nodes, A value of 0 means ORT will pick a default. Must >=0.\n"
@@ -107,7 +114,7 @@ static bool ParseDimensionOverride(std::basic_string<ORTCHAR_T>& dim_identifier,
 
 /*static*/ bool CommandLineParser::ParseArguments(PerformanceTestConfig& test_config, int argc, ORTCHAR_T* argv[]) {
   int ch;
-  while ((ch = getopt(argc, argv, ORT_TSTR("b:m:e:r:t:p:x:y:c:d:o:u:i:f:F:AMPIvhsqz"))) != -1) {
+  while ((ch = getopt(argc, argv, ORT_TSTR("b:m:e:r:t:p:x:y:c:d:o:u:i:f:F:B:T:R:AMPIvhsqz"))) != -1) {
     switch (ch) {
       case 'f': {
         std::basic_string<ORTCHAR_T> dim_name;
@@ -142,6 +149,19 @@ static bool ParseDimensionOverride(std::basic_string<ORTCHAR_T>& dim_identifier,
       case 'p':
         test_config.run_config.profile_file = optarg;
         break;
+      case 'B':
+        test_config.run_config.baseline_file = optarg;
+        break;
+      case 'R':
+        test_config.run_config.replay_file = optarg;
+        break;
+      case 'T':
+        test_config.run_config.regression_threshold_pct =
+            static_cast<int>(OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr));
+        if (test_config.run_config.regression_threshold_pct <= 0) {
+          return false;
+        }
+        break;
       case 'M':
         test_config.run_config.enable_memory_pattern = false;
         break;
@@ -270,6 +290,11 @@ static bool ParseDimensionOverride(std::basic_string<ORTCHAR_T>& dim_identifier,
     }
   }
 
+  // baseline diffing needs the per-node profiler events even when no profile dump was requested
+  if (!test_config.run_config.baseline_file.empty() && test_config.run_config.profile_file.empty()) {
+    test_config.run_config.profile_file = ORT_TSTR("onnxruntime_profile_node_baseline");
+  }
+
   // parse model_path and result_file_path
   argc -= optind;
   argv += optind;
@@ -0,0 +1,191 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "node_timing.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <core/platform/path_lib.h>
+
+namespace onnxruntime {
+namespace perftest {
+
+namespace {
+
+// extracts the string value of `"key" :"value"` (with or without a space before the value) from
+// one line of the profile; returns an empty string when the key is absent
+std::string ExtractJsonString(const std::string& line, const std::string& key) {
+  const std::string marker = "\"" + key + "\" :";
+  size_t pos = line.find(marker);
+  if (pos == std::string::npos) {
+    return std::string();
+  }
+  pos = line.find('"', pos + marker.size());
+  if (pos == std::string::npos) {
+    return std::string();
+  }
+  const size_t end = line.find('"', pos + 1);
+  if (end == std::string::npos) {
+    return std::string();
+  }
+  return line.substr(pos + 1, end - pos - 1);
+}
+
+double ExtractJsonNumber(const std::string& line, const std::string& key) {
+  const std::string marker = "\"" + key + "\" :";
+  const size_t pos = line.find(marker);
+  if (pos == std::string::npos) {
+    return 0.0;
+  }
+  return strtod(line.c_str() + pos + marker.size(), nullptr);
+}
+
+// 64-bit FNV-1a over the model file contents, so baselines recorded for one model revision are
+// never diffed against another
+uint64_t HashModelFile(const std::basic_string<ORTCHAR_T>& model_path) {
+  std::ifstream model_stream(model_path, std::ios::binary);
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  char buffer[4096];
+  while (model_stream.read(buffer, sizeof(buffer)) || model_stream.gcount() > 0) {
+    const std::streamsize read_bytes = model_stream.gcount();
+    for (std::streamsize i = 0; i < read_bytes; ++i) {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= 0x100000001b3ULL;
+    }
+  }
+  return hash;
+}
+
+}  // namespace
+
+std::map<std::string, NodeTiming> ParseProfileNodeTimings(const std::string& profile_path) {
+  static const std::string kKernelTimeSuffix = "_kernel_time";
+
+  std::map<std::string, NodeTiming> timings;
+  std::ifstream profile_stream(profile_path);
+  std::string line;
+  // the profiler writes one event per line, so the chromium trace can be scanned without a JSON
+  // parser
+  while (std::getline(profile_stream, line)) {
+    std::string name = ExtractJsonString(line, "name");
+    if (name.size() <= kKernelTimeSuffix.size() ||
+        name.compare(name.size() - kKernelTimeSuffix.size(), kKernelTimeSuffix.size(),
+                     kKernelTimeSuffix) != 0) {
+      continue;
+    }
+    name.resize(name.size() - kKernelTimeSuffix.size());
+
+    NodeTiming& timing = timings[name];
+    if (timing.op_name.empty()) {
+      timing.op_name = ExtractJsonString(line, "op_name");
+    }
+    timing.count++;
+    timing.total_dur_us += ExtractJsonNumber(line, "dur");
+  }
+  return timings;
+}
+
+Status CheckNodeTimingBaseline(const std::map<std::string, NodeTiming>& timings,
+                               const PerformanceTestConfig& config) {
+  const std::basic_string<ORTCHAR_T>& baseline_path = config.run_config.baseline_file;
+  const uint64_t model_hash = HashModelFile(config.model_info.model_file_path);
+  const std::string& machine_class = config.machine_config.provider_type_name;
+
+  std::ifstream baseline_stream(baseline_path);
+  if (!baseline_stream.good()) {
+    // first run on this model/machine combination: record the baseline
+    std::ofstream out(baseline_path);
+    if (!out.good()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "failed to open baseline file '",
+                             ToMBString(baseline_path.c_str()), "' for writing.");
+    }
+    out << "model_hash," << std::hex << model_hash << std::dec << "\n";
+    out << "machine," << machine_class << "\n";
+    out << "node,op,count,avg_dur_us\n";
+    for (const auto& entry : timings) {
+      out << entry.first << "," << entry.second.op_name << "," << entry.second.count << ","
+          << entry.second.AvgDurUs() << "\n";
+    }
+    std::cout << "Node timing baseline written to " << ToMBString(baseline_path.c_str())
+              << " (" << timings.size() << " nodes)." << std::endl;
+    return Status::OK();
+  }
+
+  // validate the baseline key before diffing
+  std::string line;
+  uint64_t baseline_hash = 0;
+  std::string baseline_machine;
+  while (std::getline(baseline_stream, line)) {
+    if (line.compare(0, 11, "model_hash,") == 0) {
+      baseline_hash = strtoull(line.c_str() + 11, nullptr, 16);
+    } else if (line.compare(0, 8, "machine,") == 0) {
+      baseline_machine = line.substr(8);
+    } else {
+      break;  // header row of the timing table
+    }
+  }
+  if (baseline_hash != model_hash || baseline_machine != machine_class) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "baseline '", ToMBString(baseline_path.c_str()),
+                           "' was recorded for a different model or machine class; delete it to "
+                           "record a new baseline.");
+  }
+
+  std::map<std::string, NodeTiming> baseline;
+  while (std::getline(baseline_stream, line)) {
+    std::istringstream row(line);
+    std::string name, op, count_str, avg_str;
+    if (!std::getline(row, name, ',') || !std::getline(row, op, ',') ||
+        !std::getline(row, count_str, ',') || !std::getline(row, avg_str, ',')) {
+      continue;
+    }
+    NodeTiming& timing = baseline[name];
+    timing.op_name = op;
+    timing.count = 1;
+    timing.total_dur_us = strtod(avg_str.c_str(), nullptr);
+  }
+
+  const double threshold = config.run_config.regression_threshold_pct / 100.0;
+  const std::basic_string<ORTCHAR_T> diff_path = baseline_path + ORT_TSTR(".diff.csv");
+  std::ofstream diff(diff_path);
+  diff << "node,op,baseline_avg_us,current_avg_us,delta_us,delta_pct,regressed\n";
+
+  size_t regressions = 0;
+  for (const auto& entry : timings) {
+    const auto baseline_it = baseline.find(entry.first);
+    if (baseline_it == baseline.end()) {
+      continue;  // node did not exist in the baseline (e.g. different optimization level)
+    }
+    const double baseline_avg = baseline_it->second.AvgDurUs();
+    const double current_avg = entry.second.AvgDurUs();
+    const double delta = current_avg - baseline_avg;
+    const double delta_pct = baseline_avg > 0.0 ? delta / baseline_avg : 0.0;
+    // a relative threshold alone flags noise on sub-microsecond nodes, so require an absolute
+    // movement as well
+    const bool regressed = delta_pct > threshold && delta > 1.0;
+    diff << entry.first << "," << entry.second.op_name << "," << baseline_avg << ","
+         << current_avg << "," << delta << "," << delta_pct * 100.0 << ","
+         << (regressed ? 1 : 0) << "\n";
+    if (regressed) {
+      ++regressions;
+      std::cout << "Regression: " << entry.first << " (" << entry.second.op_name << ") "
+                << baseline_avg << " us -> " << current_avg << " us (+"
+                << delta_pct * 100.0 << "%)" << std::endl;
+    }
+  }
+
+  std::cout << "Node timing diff written to " << ToMBString(diff_path.c_str()) << "." << std::endl;
+  if (regressions > 0) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, regressions, " node(s) regressed more than ",
+                           config.run_config.regression_threshold_pct, "% against the baseline.");
+  }
+  std::cout << "No node regressed more than " << config.run_config.regression_threshold_pct
+            << "% against the baseline." << std::endl;
+  return Status::OK();
+}
+
+}  // namespace perftest
+}  // namespace onnxruntime
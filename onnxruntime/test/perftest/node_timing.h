@@ -0,0 +1,37 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include <core/common/status.h>
+
+#include "test_configuration.h"
+
+namespace onnxruntime {
+namespace perftest {
+
+struct NodeTiming {
+  std::string op_name;
+  size_t count{0};
+  double total_dur_us{0.0};
+
+  double AvgDurUs() const { return count == 0 ? 0.0 : total_dur_us / static_cast<double>(count); }
+};
+
+// Extracts the per-node "_kernel_time" events from a chromium format profile file written by the
+// session profiler and aggregates them by node name across all recorded runs.
+std::map<std::string, NodeTiming> ParseProfileNodeTimings(const std::string& profile_path);
+
+// Per-node regression checking against a stored baseline. When the baseline file does not exist
+// the current timings are written to it, keyed by model hash and machine class (the provider
+// type), and the run succeeds. When it exists and the keys match, the current timings are diffed
+// against it: every node is written to <baseline_file>.diff.csv, nodes slower than the configured
+// threshold are printed, and a failure status is returned so the exit code can gate automation.
+Status CheckNodeTimingBaseline(const std::map<std::string, NodeTiming>& timings,
+                               const PerformanceTestConfig& config);
+
+}  // namespace perftest
+}  // namespace onnxruntime
@@ -34,6 +34,14 @@ class OnnxRuntimeTestSession : public TestSession {
   }
   std::chrono::duration<double> Run() override;
 
+  std::string EndProfiling() override {
+    Ort::AllocatorWithDefaultOptions allocator;
+    char* profile_file = session_.EndProfiling(allocator);
+    std::string result(profile_file);
+    allocator.Free(profile_file);
+    return result;
+  }
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(OnnxRuntimeTestSession);
 
  private:
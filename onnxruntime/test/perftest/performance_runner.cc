@@ -7,10 +7,13 @@
 #endif
 
 #include "performance_runner.h"
+#include <algorithm>
 #include <iostream>
 
 #include "TestCase.h"
 #include "TFModelInfo.h"
+#include "node_timing.h"
+#include "replay_loader.h"
 #include "utils.h"
 #include "ort_test_session.h"
 #ifdef HAVE_TENSORFLOW
@@ -143,6 +146,15 @@ Status PerformanceRunner::Run() {
             << "Peak working set size: " << performance_result_.peak_workingset_size << " bytes"
             << std::endl;
 
+  if (!performance_test_config_.run_config.baseline_file.empty()) {
+    const std::string profile_path = session_->EndProfiling();
+    if (profile_path.empty()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "per-node baseline checking requires the ort backend.");
+    }
+    ORT_RETURN_IF_ERROR(CheckNodeTimingBaseline(ParseProfileNodeTimings(profile_path),
+                                                performance_test_config_));
+  }
+
   return Status::OK();
 }
 
@@ -300,6 +312,36 @@ bool PerformanceRunner::Initialize() {
   TestModelInfo* test_model_info = test_model_info_.get();
   test_case_ = CreateOnnxTestCase(narrow_model_name, std::move(test_model_info_), 0.0, 0.0);
 
+  // a replay capture supplies the inputs directly; on-disk test data and input generation are skipped
+  if (!performance_test_config_.run_config.replay_file.empty()) {
+    ReplayData replay_data;
+    auto status = LoadReplayFile(ToMBString(performance_test_config_.run_config.replay_file), replay_data);
+    if (!status.IsOK()) {
+      std::cerr << status.ErrorMessage() << std::endl;
+      return false;
+    }
+
+    // restore the random sequence the captured request saw
+    Ort::ThrowOnError(Ort::GetApi().SetGlobalRandomSeed(replay_data.random_seed));
+
+    if (!replay_data.run_tag.empty()) {
+      std::cout << "replaying captured request with run tag: " << replay_data.run_tag << std::endl;
+    }
+
+    int input_count = test_model_info->GetInputCount();
+    for (int i = 0; i != input_count; ++i) {
+      const std::string& input_name = test_model_info->GetInputName(i);
+      auto iter = std::find(replay_data.feed_names.begin(), replay_data.feed_names.end(), input_name);
+      if (iter == replay_data.feed_names.end()) {
+        std::cout << "the replay capture has no data for input " << input_name << std::endl;
+        return false;
+      }
+      size_t feed_index = static_cast<size_t>(iter - replay_data.feed_names.begin());
+      session_->PreLoadTestData(0, static_cast<size_t>(i), std::move(replay_data.feeds[feed_index]));
+    }
+    return true;
+  }
+
   if (performance_test_config_.run_config.generate_model_input_binding) {
     return static_cast<OnnxRuntimeTestSession*>(session_.get())->PopulateGeneratedInputTestData();
   }
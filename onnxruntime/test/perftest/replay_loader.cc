@@ -0,0 +1,137 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "replay_loader.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace onnxruntime {
+namespace perftest {
+
+namespace {
+
+constexpr char kReplayMagic[8] = {'O', 'R', 'T', 'R', 'P', 'L', 'Y', '1'};
+constexpr uint32_t kReplayVersion = 1;
+
+template <typename T>
+Status ReadPod(std::ifstream& in, T& value) {
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  if (!in) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "replay capture is truncated");
+  }
+  return Status::OK();
+}
+
+Status ReadString(std::ifstream& in, std::string& value) {
+  uint32_t length;
+  ORT_RETURN_IF_ERROR(ReadPod(in, length));
+  value.resize(length);
+  in.read(&value[0], static_cast<std::streamsize>(length));
+  if (!in) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "replay capture is truncated");
+  }
+  return Status::OK();
+}
+
+// size in bytes of one element of the given type, or 0 for types a capture cannot contain
+size_t ElementSize(int32_t elem_type) {
+  switch (elem_type) {
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+      return 1;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_BFLOAT16:
+      return 2;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+      return 4;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+}  // namespace
+
+Status LoadReplayFile(const std::string& replay_path, ReplayData& replay_data) {
+  std::ifstream in{replay_path, std::ios::binary};
+  if (!in) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "failed to open replay file '", replay_path, "'");
+  }
+
+  char magic[sizeof(kReplayMagic)];
+  in.read(magic, sizeof(magic));
+  if (!in || std::memcmp(magic, kReplayMagic, sizeof(kReplayMagic)) != 0) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "'", replay_path, "' is not a replay capture");
+  }
+
+  uint32_t version;
+  ORT_RETURN_IF_ERROR(ReadPod(in, version));
+  if (version != kReplayVersion) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "unsupported replay capture version ", version);
+  }
+
+  ORT_RETURN_IF_ERROR(ReadPod(in, replay_data.random_seed));
+  ORT_RETURN_IF_ERROR(ReadString(in, replay_data.run_tag));
+
+  uint32_t num_config_entries;
+  ORT_RETURN_IF_ERROR(ReadPod(in, num_config_entries));
+  replay_data.run_config_entries.resize(num_config_entries);
+  for (auto& entry : replay_data.run_config_entries) {
+    ORT_RETURN_IF_ERROR(ReadString(in, entry.first));
+    ORT_RETURN_IF_ERROR(ReadString(in, entry.second));
+  }
+
+  uint32_t num_feeds;
+  ORT_RETURN_IF_ERROR(ReadPod(in, num_feeds));
+  Ort::AllocatorWithDefaultOptions allocator;
+  replay_data.feed_names.resize(num_feeds);
+  for (uint32_t i = 0; i < num_feeds; ++i) {
+    ORT_RETURN_IF_ERROR(ReadString(in, replay_data.feed_names[i]));
+
+    int32_t elem_type;
+    ORT_RETURN_IF_ERROR(ReadPod(in, elem_type));
+    const size_t element_size = ElementSize(elem_type);
+    if (element_size == 0) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "replay feed '", replay_data.feed_names[i],
+                             "' has unsupported element type ", elem_type);
+    }
+
+    uint32_t rank;
+    ORT_RETURN_IF_ERROR(ReadPod(in, rank));
+    std::vector<int64_t> dims(rank);
+    uint64_t element_count = 1;
+    for (auto& dim : dims) {
+      ORT_RETURN_IF_ERROR(ReadPod(in, dim));
+      element_count *= static_cast<uint64_t>(dim);
+    }
+
+    uint64_t data_size;
+    ORT_RETURN_IF_ERROR(ReadPod(in, data_size));
+    if (data_size != element_count * element_size) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "replay feed '", replay_data.feed_names[i],
+                             "' data size ", data_size, " does not match its shape");
+    }
+
+    Ort::Value value = Ort::Value::CreateTensor(allocator, dims.data(), dims.size(),
+                                                static_cast<ONNXTensorElementDataType>(elem_type));
+    in.read(value.GetTensorMutableData<char>(), static_cast<std::streamsize>(data_size));
+    if (!in) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "replay capture is truncated");
+    }
+    replay_data.feeds.emplace_back(std::move(value));
+  }
+
+  return Status::OK();
+}
+
+}  // namespace perftest
+}  // namespace onnxruntime
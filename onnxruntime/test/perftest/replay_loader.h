@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <core/common/status.h>
+#include <core/session/onnxruntime_cxx_api.h>
+
+namespace onnxruntime {
+namespace perftest {
+
+// A replay capture written by an inference session with the "session.replay_capture_file"
+// session option (see core/framework/replay_capture.h for the file format), loaded through the
+// public API so the feeds can be handed straight to a test session.
+struct ReplayData {
+  int64_t random_seed{0};
+  std::string run_tag;
+  std::vector<std::pair<std::string, std::string>> run_config_entries;
+  std::vector<std::string> feed_names;
+  std::vector<Ort::Value> feeds;
+};
+
+// Reads a replay capture file into 'replay_data', materializing the feeds as CPU tensors.
+Status LoadReplayFile(const std::string& replay_path, ReplayData& replay_data);
+
+}  // namespace perftest
+}  // namespace onnxruntime
@@ -55,6 +55,9 @@ struct RunConfig {
   bool do_cuda_copy_in_separate_stream{false};
   bool set_denormal_as_zero{false};
   std::basic_string<ORTCHAR_T> ep_runtime_config_string;
+  std::basic_string<ORTCHAR_T> baseline_file;
+  std::basic_string<ORTCHAR_T> replay_file;
+  int regression_threshold_pct{10};
   std::map<std::basic_string<ORTCHAR_T>, int64_t> free_dim_name_overrides;
   std::map<std::basic_string<ORTCHAR_T>, int64_t> free_dim_denotation_overrides;
 };
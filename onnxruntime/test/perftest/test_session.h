@@ -3,6 +3,7 @@
 
 #pragma once
 #include <stdlib.h>
+#include <string>
 
 #include "OrtValueList.h"
 
@@ -17,6 +18,10 @@ class TestSession {
   void ThreadSafeRun() { abort(); }
   virtual void PreLoadTestData(size_t test_data_id, size_t input_id, Ort::Value&& value) = 0;
 
+  // Ends profiling and returns the path of the written profile file, or an empty string when the
+  // backend does not support profiling.
+  virtual std::string EndProfiling() { return std::string(); }
+
   virtual ~TestSession() = default;
 };
 }  // namespace perftest
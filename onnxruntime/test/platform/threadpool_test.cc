@@ -263,6 +263,37 @@ TEST(ThreadPoolTest, TestBatchParallelFor_2_Thread_81_Task_20_Batch) {
   TestBatchParallelFor("TestBatchParallelFor_2_Thread_81_Task_20_Batch", 2, 81, 20);
 }
 
+TEST(ThreadPoolTest, TestStats) {
+  // a null pool (work runs inline in the caller) reports zeroed stats
+  ThreadPoolStats empty = ThreadPool::GetStats(nullptr);
+  ASSERT_EQ(empty.num_threads, 0u);
+  ASSERT_EQ(empty.tasks_executed, 0u);
+
+  CreateThreadPoolAndTest("TestStats", 4, [](ThreadPool* tp) {
+    // degree of parallelism 4 is supported by 3 pool threads plus the calling thread
+    ThreadPoolStats stats = ThreadPool::GetStats(tp);
+    ASSERT_EQ(stats.num_threads, 3u);
+    ASSERT_EQ(stats.tasks_executed, 0u);
+
+    constexpr int num_tasks = 1000;
+    std::atomic<int> counter{0};
+    for (int rep = 0; rep < 10; rep++) {
+      ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t) { ++counter; });
+    }
+    ASSERT_EQ(counter, 10 * num_tasks);
+
+    stats = ThreadPool::GetStats(tp);
+    ASSERT_GT(stats.tasks_executed, 0u);
+
+    // folding the counters into the baseline restarts the reporting interval
+    ThreadPool::ResetStats(tp);
+    stats = ThreadPool::GetStats(tp);
+    ASSERT_EQ(stats.tasks_executed, 0u);
+    ASSERT_EQ(stats.steals, 0u);
+    ASSERT_EQ(stats.num_threads, 3u);
+  });
+}
+
 TEST(ThreadPoolTest, TestConcurrentParallelFor_0Thread_1Conc_0Tasks) {
   TestConcurrentParallelFor("TestConcurrentParallelFor_0Thread_1Conc_0Tasks", 0, 1, 0);
 }
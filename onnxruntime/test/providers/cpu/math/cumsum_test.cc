@@ -218,5 +218,32 @@ TEST(CumSumTest, _1DTestdouble_WithInt64Axis) {
   test.AddOutput<double>("y", {5}, {1., 3., 6., 10., 15.});
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
 }
+TEST(CumSumTest, _1DTestLargeInt32) {
+  // large enough to hit the blocked parallel scan path
+  constexpr int64_t n = 100000;
+  std::vector<int32_t> x(n, 1);
+  std::vector<int32_t> y(n);
+  for (int64_t i = 0; i < n; ++i)
+    y[i] = static_cast<int32_t>(i + 1);
+  OpTester test("CumSum", 11, onnxruntime::kOnnxDomain);
+  test.AddInput<int32_t>("x", {n}, x);
+  test.AddInput<int32_t>("axis", {1}, {0});
+  test.AddOutput<int32_t>("y", {n}, y);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+TEST(CumSumTest, _1DTestLargeInt32ReverseExclusive) {
+  constexpr int64_t n = 100000;
+  std::vector<int32_t> x(n, 1);
+  std::vector<int32_t> y(n);
+  for (int64_t i = 0; i < n; ++i)
+    y[i] = static_cast<int32_t>(n - 1 - i);
+  OpTester test("CumSum", 11, onnxruntime::kOnnxDomain);
+  test.AddAttribute<int64_t>("reverse", 1);
+  test.AddAttribute<int64_t>("exclusive", 1);
+  test.AddInput<int32_t>("x", {n}, x);
+  test.AddInput<int32_t>("axis", {1}, {0});
+  test.AddOutput<int32_t>("y", {n}, y);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
 }  // namespace test
 }  // namespace onnxruntime
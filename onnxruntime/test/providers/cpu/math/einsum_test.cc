@@ -236,6 +236,24 @@ TEST(Einsum, ExplicitEinsumAsBatchedMatmulWithBroadcasting_1) {
   test.Run();
 }
 
+TEST(Einsum, ExplicitEinsumAsMatmulWithTransposedFirstInput) {
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "ji,jk->ik");
+  test.AddInput<float>("x", {2, 2}, {1.f, 2.f, 3.f, 4.f});
+  test.AddInput<float>("y", {2, 2}, {1.f, 2.f, 3.f, 4.f});
+  test.AddOutput<float>("o", {2, 2}, {10.f, 14.f, 14.f, 20.f});
+  test.Run();
+}
+
+TEST(Einsum, ExplicitEinsumAsBatchedMatmulWithTransposedSecondInput) {
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "bij,bkj->bik");
+  test.AddInput<float>("x", {2, 2, 2}, {1.f, 2.f, 3.f, 4.f, 1.f, 2.f, 3.f, 4.f});
+  test.AddInput<float>("y", {2, 2, 2}, {1.f, 2.f, 3.f, 4.f, 1.f, 2.f, 3.f, 4.f});
+  test.AddOutput<float>("o", {2, 2, 2}, {5.f, 11.f, 11.f, 25.f, 5.f, 11.f, 11.f, 25.f});
+  test.Run();
+}
+
 TEST(Einsum, ExplicitEinsumAsMatmul_OutputTransposed) {
   OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
   test.AddAttribute<std::string>("equation", "ij,jk->ki");
@@ -842,5 +842,15 @@ TEST(TopKOperator, SelectTopKThreaded) {
   TestThreaded<double>(k, n, batch_size);
 }
 
+// create input of 2x2048 and select 16 so the sampled-threshold filter path is used
+// (contiguous axis with at least 1024 items and k * 8 <= item count)
+TEST(TopKOperator, ThresholdFilterTopK) {
+  const int64_t k = 16;
+  const int64_t n = 2;
+  const int64_t batch_size = 2048;
+  TestThreaded<float>(k, n, batch_size);
+  TestThreaded<double>(k, n, batch_size);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -43,5 +43,31 @@ TEST(CategoryMapper, IntToString) {
 
   RunTest(dims, input, output);
 }
+
+TEST(CategoryMapper, StringToIntLongKeys) {
+  OpTester test("CategoryMapper", 1, onnxruntime::kMLDomain);
+
+  // Keys longer than eight bytes that share a common prefix, plus keys that are
+  // strict prefixes of one another, to exercise the full key comparison in the
+  // lookup table beyond its inline prefix word.
+  const std::vector<std::string> categories = {"category_alpha", "category_alphabet", "category", "cat"};
+  const std::vector<int64_t> indexes = {1, 2, 3, 4};
+
+  test.AddAttribute("cats_strings", categories);
+  test.AddAttribute("cats_int64s", indexes);
+
+  test.AddAttribute("default_string", "default");
+  test.AddAttribute<int64_t>("default_int64", 99);
+
+  std::vector<int64_t> dims{7};
+  std::vector<std::string> input{
+      "category_alphabet", "category_alpha", "cat", "category", "category_alp", "category_alphabets", ""};
+  std::vector<int64_t> output{2, 1, 4, 3, 99, 99, 99};
+
+  test.AddInput<std::string>("X", dims, input);
+  test.AddOutput<int64_t>("Y", dims, output);
+
+  test.Run();
+}
 }  // namespace test
 }  // namespace onnxruntime
@@ -673,6 +673,28 @@ TEST(QLinearConvTest, Conv1D_U8S8_Strides) {
   test.Run();
 }
 
+TEST(QLinearConvTest, Conv1D_U8S8_NoPad) {
+  // Overlapping direct GEMM rows: no padding, unit strides and dilations.
+  QLinearConvOpTester<uint8_t, int8_t> test;
+  test.GenerateRandomInput({2, 8, 21}, .04f, 14);
+  test.GenerateRandomWeights({16, 8, 3}, .12f, 0);
+  test.GenerateRandomBias();
+  test.SetOutputScaleAndZeroPoint(.28f, 22);
+  test.Run();
+}
+
+TEST(QLinearConvTest, Conv2D_U8S8_FullWidthKernel) {
+  // The kernel covers the full input width, so the im2col rows are
+  // contiguous slices of the input.
+  QLinearConvOpTester<uint8_t, int8_t> test;
+  test.GenerateRandomInput({1, 6, 16, 9}, .03f, 12);
+  test.GenerateRandomWeights({8, 6, 3, 9}, .13f, 0);
+  test.GenerateRandomBias();
+  test.SetStrides({2, 1});
+  test.SetOutputScaleAndZeroPoint(.26f, 18);
+  test.Run();
+}
+
 TEST(QLinearConvTest, Conv2D_U8S8_Strides) {
   QLinearConvOpTester<uint8_t, int8_t> test;
   test.GenerateRandomInput({1, 7, 18, 24}, .04f, 16);
@@ -288,6 +288,49 @@ TEST(NonMaxSuppressionOpTest, SelectFromIdenticalBoxes) {
   test.Run();
 }
 
+TEST(NonMaxSuppressionOpTest, SelectFromOverlappingStripTwoClasses) {
+  // 64 unit-width boxes spaced 0.5 apart along x: each box overlaps its direct
+  // neighbors (IOU 1/3) and exactly touches the boxes two steps away, so NMS keeps
+  // every other box. Class 0 scores descend with the index, class 1 scores ascend.
+  const int64_t num_boxes = 64;
+  std::vector<float> boxes;
+  std::vector<float> scores;
+  boxes.reserve(num_boxes * 4);
+  for (int64_t i = 0; i < num_boxes; ++i) {
+    boxes.push_back(0.0f);
+    boxes.push_back(i * 0.5f);
+    boxes.push_back(1.0f);
+    boxes.push_back(i * 0.5f + 1.0f);
+  }
+  for (int64_t i = 0; i < num_boxes; ++i) {
+    scores.push_back(1.0f - i * 0.01f);
+  }
+  for (int64_t i = 0; i < num_boxes; ++i) {
+    scores.push_back(0.01f + i * 0.01f);
+  }
+
+  std::vector<int64_t> expected;
+  for (int64_t i = 0; i < num_boxes; i += 2) {
+    expected.push_back(0);
+    expected.push_back(0);
+    expected.push_back(i);
+  }
+  for (int64_t i = num_boxes - 1; i >= 0; i -= 2) {
+    expected.push_back(0);
+    expected.push_back(1);
+    expected.push_back(i);
+  }
+
+  OpTester test("NonMaxSuppression", 10, kOnnxDomain);
+  test.AddInput<float>("boxes", {1, num_boxes, 4}, boxes);
+  test.AddInput<float>("scores", {1, 2, num_boxes}, scores);
+  test.AddInput<int64_t>("max_output_boxes_per_class", {}, {100L});
+  test.AddInput<float>("iou_threshold", {}, {0.3f});
+  test.AddInput<float>("score_threshold", {}, {0.0f});
+  test.AddOutput<int64_t>("selected_indices", {num_boxes, 3}, expected);
+  test.Run();
+}
+
 TEST(NonMaxSuppressionOpTest, InconsistentBoxAndScoreShapes) {
   OpTester test("NonMaxSuppression", 10, kOnnxDomain);
   test.AddInput<float>("boxes", {1, 6, 4},
@@ -3984,5 +3984,37 @@ TEST(ReductionOpTest, ReduceSum_RKRK_keepdims) {
   test.Run();
 }
 
+TEST(ReductionOpTest, ReduceSum_R_parallel) {
+  // large enough to split the flattened input across threads (partial sums + tree combine)
+  const int64_t n = 65536;
+  std::vector<float> data(n);
+  double expected = 0;
+  for (int64_t i = 0; i < n; ++i) {
+    data[i] = static_cast<float>(i % 17) * 0.0625f;
+    expected += data[i];
+  }
+  OpTester test("ReduceSum");
+  test.AddAttribute("keepdims", (int64_t)0);
+  test.AddInput<float>("data", {16, 64, 64}, data);
+  test.AddOutput<float>("reduced", {}, {static_cast<float>(expected)});
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  //TensorRT: full reduce without keepDimensions is not supported with explicit batch
+}
+
+TEST(ReductionOpTest, ReduceMean_R_parallel) {
+  const int64_t n = 65536;
+  std::vector<float> data(n);
+  double expected = 0;
+  for (int64_t i = 0; i < n; ++i) {
+    data[i] = static_cast<float>(i % 31) * 0.125f;
+    expected += data[i];
+  }
+  expected /= static_cast<double>(n);
+  OpTester test("ReduceMean");
+  test.AddAttribute("keepdims", (int64_t)1);
+  test.AddInput<float>("data", {64, 32, 32}, data);
+  test.AddOutput<float>("reduced", {1, 1, 1}, {static_cast<float>(expected)});
+  test.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -872,7 +872,40 @@ class TestInferenceSession(unittest.TestCase):
 
             # The constructed OrtValue should still be valid after being used in a session
             self.assertTrue(np.array_equal(ortvalue2.numpy(), numpy_arr_input))
-            
+
+    def testOrtValueNumpyView(self):
+
+        numpy_arr_input = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        ortvalue = onnxrt.OrtValue.ortvalue_from_numpy(numpy_arr_input)
+
+        view = ortvalue.numpy_view()
+        self.assertEqual(view.shape, (3, 2))
+        self.assertEqual(view.dtype, np.float32)
+        self.assertTrue(np.array_equal(view, numpy_arr_input))
+
+        # The view aliases the OrtValue's buffer instead of copying it
+        self.assertEqual(view.__array_interface__['data'][0], ortvalue.data_ptr())
+
+        # Writes through the view are visible to the OrtValue
+        view[0][0] = 7.0
+        self.assertEqual(ortvalue.numpy()[0][0], 7.0)
+
+        # The view keeps the buffer alive after the OrtValue is released
+        del ortvalue
+        self.assertEqual(view[0][0], 7.0)
+
+    def testRunWithArrayInterfaceInput(self):
+
+        class ArrayInterfaceWrapper:
+            def __init__(self, array):
+                self.__array_interface__ = array.__array_interface__
+                self._base = array
+
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"))
+        res = sess.run(["Y"], {"X": ArrayInterfaceWrapper(x)})
+        self.assertTrue(np.array_equal(res[0], np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)))
+
     def testSparseTensorCooFormat(self):
         cpu_device = onnxrt.OrtDevice.make('cpu', 0)
         shape = [9,9]
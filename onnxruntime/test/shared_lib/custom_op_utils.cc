@@ -39,9 +39,19 @@ void MyCustomKernel::Compute(OrtKernelContext* context) {
   // cudaStreamSynchronize(nullptr);
 #else
   ORT_UNUSED_PARAMETER(compute_stream_);
-  for (int64_t i = 0; i < size; i++) {
-    out[i] = X[i] + Y[i];
-  }
+  // Use the session's intra-op thread pool to also cover KernelContext_ParallelFor
+  struct AddData {
+    const float* x;
+    const float* y;
+    float* out;
+  } add_data{X, Y, out};
+  ort_.KernelContext_ParallelFor(
+      context,
+      [](void* usr_data, size_t i) {
+        auto* data = static_cast<AddData*>(usr_data);
+        data->out[i] = data->x[i] + data->y[i];
+      },
+      static_cast<size_t>(size), 0, &add_data);
 #endif
 }
 
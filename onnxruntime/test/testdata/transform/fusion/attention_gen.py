@@ -286,5 +286,85 @@ def GenerateModel2(model_name):
     onnx.save(model, model_name)
 
 
+def GenerateModel3(model_name):
+    nodes = [  # Attention subgraph with additive bias (e.g. ALiBi) instead of a key padding mask
+        helper.make_node("LayerNormalization", ["input_1", "layer_norm_weight", "layer_norm_bias"],
+                        ["layernorm_out"],
+                         "layernorm",
+                         axis=-1,
+                         epsion=0.000009999999747378752),
+
+        # q nodes
+        helper.make_node("MatMul", ["layernorm_out", "matmul_q_weight"], ["matmul_q_out"], "matmul_q"),
+        helper.make_node("Add", ["matmul_q_out", "add_q_weight"], ["add_q_out"], "add_q"),
+        helper.make_node("Reshape", ["add_q_out", "reshape_weight_1"], ["reshape_q_out"], "reshape_q"),
+        helper.make_node("Transpose", ["reshape_q_out"], ["transpose_q_out"], "transpose_q",
+            perm=[0,2,1,3]),
+
+        # k nodes
+        helper.make_node("MatMul", ["layernorm_out", "matmul_k_weight"], ["matmul_k_out"], "matmul_k"),
+        helper.make_node("Add", ["matmul_k_out", "add_k_weight"], ["add_k_out"], "add_k"),
+        helper.make_node("Reshape", ["add_k_out", "reshape_weight_1"], ["reshape_k_out"], "reshape_k"),
+        helper.make_node("Transpose", ["reshape_k_out"], ["transpose_k_out"], "transpose_k",
+            perm=[0,2,3,1]),
+
+        # qk nodes, with the bias added to the scaled QxK' scores
+        helper.make_node("MatMul", ["transpose_q_out", "transpose_k_out"], ["matmul_qk_out"], "matmul_qk"),
+        helper.make_node("Div", ["matmul_qk_out", "div_weight"], ["div_qk_out"], "div_qk"),
+        helper.make_node("Add", ["div_qk_out", "additive_bias"], ["add_qk_out"], "add_qk"),
+        helper.make_node("Softmax", ["add_qk_out"], ["softmax_qk_out"], "softmax_qk", axis=3),
+
+        # v nodes
+        helper.make_node("MatMul", ["layernorm_out", "matmul_v_weight"], ["matmul_v_out"], "matmul_v"),
+        helper.make_node("Add", ["matmul_v_out", "add_v_weight"], ["add_v_out"], "add_v"),
+        helper.make_node("Reshape", ["add_v_out", "reshape_weight_1"], ["reshape_v_out"], "reshape_v"),
+        helper.make_node("Transpose", ["reshape_v_out"], ["transpose_v_out"], "transpose_v",
+            perm=[0,2,1,3]),
+
+        # qkv nodes
+        helper.make_node("MatMul", ["softmax_qk_out", "transpose_v_out"], ["matmul_qkv_1_out"], "matmul_qkv_1"),
+        helper.make_node("Transpose", ["matmul_qkv_1_out"], ["transpose_qkv_out"], "transpose_qkv",
+            perm=[0,2,1,3]
+        ),
+        helper.make_node("Reshape", ["transpose_qkv_out", "reshape_weight_2"], ["reshape_qkv_out"], "reshape_qkv"),
+        helper.make_node("MatMul", ["reshape_qkv_out", "matmul_qkv_weight"], ["matmul_qkv_2_out"], "matmul_qkv_2"),
+        helper.make_node("Add", ["matmul_qkv_2_out", "add_qkv_weight"], ["add_qkv_out"], "add_qkv"),
+
+        helper.make_node("Add", ["add_qkv_out", "layernorm_out"], ["output"], "add"),
+    ]
+
+    initializers = [  # initializers
+        helper.make_tensor('layer_norm_weight', TensorProto.FLOAT, [8], [1.0, 2.0, 3.0, 4.0, 1.0, 2.0, 3.0, 4.0]),
+        helper.make_tensor('layer_norm_bias', TensorProto.FLOAT, [8], [0.1, 0.2, 0.3, 0.4, 0.1, 0.2, 0.3, 0.4]),
+        helper.make_tensor('matmul_q_weight', TensorProto.FLOAT, [8, 8], matmul_q_weights),
+        helper.make_tensor('matmul_k_weight', TensorProto.FLOAT, [8, 8], matmul_k_weights),
+        helper.make_tensor('matmul_v_weight', TensorProto.FLOAT, [8, 8], matmul_v_weights),
+        helper.make_tensor('matmul_qkv_weight', TensorProto.FLOAT, [8, 8], matmul_qkv_weights),
+        helper.make_tensor('div_weight', TensorProto.FLOAT, [1], [2]),
+        helper.make_tensor('add_q_weight', TensorProto.FLOAT, [8], add_q_weight),
+        helper.make_tensor('add_k_weight', TensorProto.FLOAT, [8], add_k_weight),
+        helper.make_tensor('add_v_weight', TensorProto.FLOAT, [8], add_v_weight),
+        helper.make_tensor('add_qkv_weight', TensorProto.FLOAT, [8], add_qkv_weight),
+        helper.make_tensor('reshape_weight_1', TensorProto.INT64, [4], [0, 0, 2, 4]),
+        helper.make_tensor('reshape_weight_2', TensorProto.INT64, [3], [0, 0, 8]),
+    ]
+
+    graph = helper.make_graph(
+        nodes,
+        "AttentionFusionAdditiveMask",  #name
+        [  # inputs
+            helper.make_tensor_value_info('input_1', TensorProto.FLOAT, [1, 3, 8]),
+            helper.make_tensor_value_info('additive_bias', TensorProto.FLOAT, [1, 2, 3, 3]),
+        ],
+        [  # outputs
+            helper.make_tensor_value_info('output', TensorProto.FLOAT, [1, 3, 8]),
+        ],
+        initializers)
+
+    model = helper.make_model(graph)
+    onnx.save(model, model_name)
+
+
 GenerateModel('attention_mask_no_cast.onnx')
 GenerateModel2('attention_distilbert.onnx')
+GenerateModel3('attention_additive_mask.onnx')
@@ -252,3 +252,42 @@ def gen_transpose_fusion_invalid_datatype(model_path, datatype):
 
 gen_transpose_fusion_invalid_datatype("transpose_matmul_4d_fusion_invalid_datatype_int32.onnx", TensorProto.INT32)
 gen_transpose_fusion_invalid_datatype("transpose_matmul_4d_fusion_invalid_datatype_int64.onnx", TensorProto.INT64)
+
+
+def gen_transpose_reshape_fusion(model_path):
+    nodes = [
+        helper.make_node(
+            "Transpose",
+            ["input_0"],
+            ["transposed_input_0"],
+            perm=[0, 1, 3, 2]),
+        helper.make_node(
+            "Reshape",
+            ["transposed_input_0", "shape"],
+            ["reshaped_input_0"]),
+        helper.make_node(
+            "MatMul",
+            ["reshaped_input_0", "input_1"],
+            ["output"])
+    ]
+
+    inputs = [
+        helper.make_tensor_value_info(
+            "input_0", TensorProto.FLOAT, [2, 3, 5, 4]),
+        helper.make_tensor_value_info(
+            "input_1", TensorProto.FLOAT, [6, 5, 7])
+    ]
+
+    outputs = [
+        helper.make_tensor_value_info(
+            "output", TensorProto.FLOAT, [6, 4, 7])
+    ]
+
+    initializers = [
+        helper.make_tensor("shape", TensorProto.INT64, [3], [6, 4, 5])
+    ]
+
+    save(model_path, nodes, inputs, outputs, initializers)
+
+
+gen_transpose_reshape_fusion("transpose_reshape_matmul_fusion.onnx")
@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "orttraining/core/framework/activation_recompute_planner.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "core/framework/data_types.h"
+#include "core/graph/graph_viewer.h"
+
+namespace onnxruntime {
+namespace training {
+
+namespace {
+
+// statically known size of an activation in bytes, 0 when any dimension is symbolic
+size_t EstimateActivationBytes(const NodeArg& arg) {
+  const auto* type_proto = arg.TypeAsProto();
+  if (type_proto == nullptr || !type_proto->has_tensor_type() || !type_proto->tensor_type().has_shape()) {
+    return 0;
+  }
+
+  int64_t elements = 1;
+  for (const auto& dim : type_proto->tensor_type().shape().dim()) {
+    if (!dim.has_dim_value() || dim.dim_value() < 0) {
+      return 0;
+    }
+    elements *= dim.dim_value();
+  }
+
+  const int32_t elem_type = type_proto->tensor_type().elem_type();
+  if (elem_type == ONNX_NAMESPACE::TensorProto_DataType_UNDEFINED ||
+      elem_type == ONNX_NAMESPACE::TensorProto_DataType_STRING) {
+    return 0;
+  }
+
+  const auto* tensor_type = DataTypeImpl::TensorTypeFromONNXEnum(elem_type);
+  return static_cast<size_t>(elements) * tensor_type->GetElementType()->Size();
+}
+
+bool IsGeluCandidate(const Node& node) {
+  static const std::unordered_set<std::string> gelu_ops{"Gelu", "FastGelu", "BiasGelu"};
+  if (gelu_ops.find(node.OpType()) == gelu_ops.end()) {
+    return false;
+  }
+
+  const auto next_node = node.OutputNodesBegin();
+  return next_node != node.OutputNodesEnd() && next_node->OpType() == "MatMul";
+}
+
+bool IsLayerNormCandidate(const Node& node) {
+  static const std::unordered_set<std::string> layernorm_ops{"LayerNormalization", "SkipLayerNormalization"};
+  return layernorm_ops.find(node.OpType()) != layernorm_ops.end();
+}
+
+bool IsAttentionDropoutCandidate(const Node& node) {
+  if (node.OpType() != "Dropout") {
+    return false;
+  }
+
+  const auto prev_node = node.InputNodesBegin();
+  const auto next_node = node.OutputNodesBegin();
+  return prev_node != node.InputNodesEnd() && prev_node->OpType() == "Softmax" &&
+         next_node != node.OutputNodesEnd() && next_node->OpType() == "MatMul";
+}
+
+}  // namespace
+
+ActivationRecomputePlan PlanActivationRecompute(Graph& graph, int64_t target_saved_bytes,
+                                                const logging::Logger& logger) {
+  ActivationRecomputePlan plan;
+  std::vector<RecomputeCandidate> candidates;
+
+  GraphViewer graph_viewer(graph);
+  for (auto node_index : graph_viewer.GetNodesInTopologicalOrder()) {
+    Node& node = *graph.GetNode(node_index);
+
+    RecomputeCandidate candidate;
+    if (IsGeluCandidate(node) || IsLayerNormCandidate(node)) {
+      candidate.node = &node;
+    } else if (IsAttentionDropoutCandidate(node)) {
+      candidate.node = &node;
+      candidate.is_attention_dropout = true;
+    } else {
+      continue;
+    }
+
+    candidate.activation_bytes = EstimateActivationBytes(*node.OutputDefs()[0]);
+    plan.total_candidate_bytes += candidate.activation_bytes;
+    candidates.push_back(candidate);
+  }
+
+  // free the biggest activations first so a byte target is reached with the fewest recomputes.
+  // stable sort keeps topological order between equally sized candidates
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const RecomputeCandidate& a, const RecomputeCandidate& b) {
+                     return a.activation_bytes > b.activation_bytes;
+                   });
+
+  for (const auto& candidate : candidates) {
+    if (target_saved_bytes > 0) {
+      if (plan.estimated_saved_bytes >= static_cast<size_t>(target_saved_bytes)) {
+        break;
+      }
+      // a symbolic shape can't be counted towards the target, so don't trade compute for it
+      if (candidate.activation_bytes == 0) {
+        continue;
+      }
+    }
+    plan.estimated_saved_bytes += candidate.activation_bytes;
+    plan.selected.push_back(candidate);
+  }
+
+  LOGS(logger, INFO) << "Activation recompute plan: selected " << plan.selected.size() << " of "
+                     << candidates.size() << " candidate activations, estimated "
+                     << plan.estimated_saved_bytes << " of " << plan.total_candidate_bytes
+                     << " candidate bytes saved (target "
+                     << (target_saved_bytes > 0 ? std::to_string(target_saved_bytes) : "all") << ").";
+
+  return plan;
+}
+
+}  // namespace training
+}  // namespace onnxruntime
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <vector>
+
+#include "core/graph/graph.h"
+
+namespace onnxruntime {
+namespace training {
+
+// An activation the planner selected to drop in forward and rematerialize in backward.
+struct RecomputeCandidate {
+  // forward node producing the activation
+  Node* node{nullptr};
+  // statically known size of the stashed activation in bytes, 0 when the shape is symbolic
+  size_t activation_bytes{0};
+  // attention dropout is rematerialized by re-running dropout with the original mask rather than
+  // by duplicating the node, so it needs different insertion handling
+  bool is_attention_dropout{false};
+};
+
+struct ActivationRecomputePlan {
+  std::vector<RecomputeCandidate> selected;
+  // bytes of activation memory the selected candidates free, summed over statically known shapes
+  size_t estimated_saved_bytes{0};
+  // same sum over every candidate found, selected or not
+  size_t total_candidate_bytes{0};
+};
+
+/**
+ * Plans activation recomputation for a forward graph before the gradient graph is built.
+ *
+ * Candidates are limited to activations that are cheap to rematerialize relative to the memory
+ * they hold: Gelu/FastGelu/BiasGelu outputs feeding a MatMul, LayerNormalization and
+ * SkipLayerNormalization outputs, and dropout in the attention pattern (Softmax -> Dropout ->
+ * MatMul). Candidates are selected largest first until 'target_saved_bytes' of activation memory
+ * is freed; 0 selects every candidate. Candidates with symbolic shapes can't be sized, so they
+ * are only selected when no target is set.
+ *
+ * The caller inserts the recompute nodes for the selected candidates (see
+ * PlannedActivationRecompute); the gradient graph builder then wires gradient nodes to the
+ * "<name>_recompute" args instead of keeping the forward activations alive.
+ */
+ActivationRecomputePlan PlanActivationRecompute(Graph& graph, int64_t target_saved_bytes,
+                                                const logging::Logger& logger);
+
+}  // namespace training
+}  // namespace onnxruntime
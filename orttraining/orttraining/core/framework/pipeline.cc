@@ -84,14 +84,20 @@ const PipelineTask& PipelineSlot::GetFrontAction() const {
 }
 
 PipelineScheduler::PipelineScheduler() : num_stages_(0),
-                                         num_batches_(0) {}
+                                         num_batches_(0),
+                                         max_in_flight_batches_(0) {}
 
 PipelineScheduler::PipelineScheduler(
     int num_batches,
     const int num_stages,
-    const std::vector<int>& stage_id_to_rank_id_map) : num_stages_(num_stages),
-                                                       num_batches_(num_batches),
-                                                       stage_id_to_rank_id_map_(stage_id_to_rank_id_map) {
+    const std::vector<int>& stage_id_to_rank_id_map,
+    const int max_in_flight_batches) : num_stages_(num_stages),
+                                       num_batches_(num_batches),
+                                       max_in_flight_batches_(
+                                           max_in_flight_batches <= 0 || max_in_flight_batches > num_stages
+                                               ? num_stages
+                                               : max_in_flight_batches),
+                                       stage_id_to_rank_id_map_(stage_id_to_rank_id_map) {
   if (stage_id_to_rank_id_map.size() != static_cast<size_t>(num_stages)) {
     throw std::invalid_argument("stage_id_to_rank_id_map should contain the MPI ranks from the first to the last pipeline stages");
   }
@@ -195,7 +201,7 @@ std::vector<int> PipelineScheduler::FindForwardComputeTime(const std::vector<int
         continue;
       }
 
-      if (compute_batch_count_.at(t) >= num_stages_) {
+      if (compute_batch_count_.at(t) >= max_in_flight_batches_) {
         // At time t, the number of running batches is at maximum,
         // so we need to put this stage to another time slot.
         continue;
@@ -228,7 +234,7 @@ std::vector<int> PipelineScheduler::FindBackwardComputeTime(const std::vector<in
         continue;
       }
 
-      if (compute_batch_count_.at(t) >= num_stages_) {
+      if (compute_batch_count_.at(t) >= max_in_flight_batches_) {
         continue;
       }
 
@@ -435,7 +441,13 @@ void PipelineScheduler::InsertBackwardCompute(const int batch_id, const std::vec
 
 void PipelineScheduler::CreateComputeSchedule() {
   // Expand table to accomonadate the new batch.
-  const int compute_max_time = 2 * num_stages_ + 2 * (num_batches_ - 1);
+  int compute_max_time = 2 * num_stages_ + 2 * (num_batches_ - 1);
+  if (max_in_flight_batches_ < num_stages_ && num_batches_ > max_in_flight_batches_) {
+    // A bound tighter than the 1F1B limit stalls later forwards until earlier
+    // backwards retire, so reserve extra slots for those stalls. This is an
+    // upper bound; unused trailing slots stay empty.
+    compute_max_time += 2 * (num_batches_ - max_in_flight_batches_) * (num_stages_ - max_in_flight_batches_);
+  }
 
   compute_table_.resize(compute_max_time, std::vector<PipelineSlot>(num_stages_));
   compute_batch_count_.resize(compute_max_time);
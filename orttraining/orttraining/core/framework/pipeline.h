@@ -146,7 +146,10 @@ class PipelineSlot {
 class PipelineScheduler {
  public:
   PipelineScheduler();
-  PipelineScheduler(const int num_batches, const int num_stages, const std::vector<int>& stage_id_to_rank_id_map);
+  // max_in_flight_batches bounds the number of micro-batches concurrently in flight
+  // (forward done, backward pending), and therefore the activations stashed per stage.
+  // 0 or any value above num_stages falls back to num_stages, the 1F1B bound.
+  PipelineScheduler(const int num_batches, const int num_stages, const std::vector<int>& stage_id_to_rank_id_map, const int max_in_flight_batches = 0);
 
   // Number of time steps.
   size_t GetScheduleSize() const { return compute_commute_table_.size(); }
@@ -215,6 +218,10 @@ class PipelineScheduler {
   int num_stages_;
   // Number of micro-batches.
   int num_batches_;
+  // Upper bound on the number of micro-batches in flight at any time.
+  // At most this many batches have started their forward but not finished
+  // their backward, which caps the stashed activations per stage.
+  int max_in_flight_batches_;
   // Compute-only pipeline schedule as a 2-D table. table_[i][j] is the computation happening in
   // the i-th time slot at the j-th stage. For example, PipeDream schedule may have
   //   1. table_[0][0].batch_id is 0 and table_[0][0].type is Forward.
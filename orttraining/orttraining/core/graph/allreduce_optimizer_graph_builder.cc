@@ -16,10 +16,30 @@ static bool IsNcclAvailable() {
 #endif
 }
 
+// statically known size of a gradient in bytes, or 'bucket_size_bytes' when the shape is
+// symbolic so an unsized gradient always closes the bucket it joins
+static int64_t GradientSizeInBytes(const ArgDef& gradient_argdef, int64_t elem_size, int64_t bucket_size_bytes) {
+  if (gradient_argdef.type_proto == nullptr || !gradient_argdef.type_proto->tensor_type().has_shape()) {
+    return bucket_size_bytes;
+  }
+
+  int64_t elements = 1;
+  for (const auto& dim : gradient_argdef.type_proto->tensor_type().shape().dim()) {
+    if (!dim.has_dim_value() || dim.dim_value() < 0) {
+      return bucket_size_bytes;
+    }
+    elements *= dim.dim_value();
+  }
+
+  return elements * elem_size;
+}
+
 static Status AddNcclAllReduceForGradients(
     std::vector<ArgDef>& gradient_argdefs,
     std::vector<ArgDef>& input_gradient_argdef,
-    GraphAugmenter::GraphDefs& graph_defs) {
+    GraphAugmenter::GraphDefs& graph_defs,
+    int64_t bucket_size_bytes,
+    int64_t elem_size) {
   std::vector<ArgDef> allreduce_outputs(gradient_argdefs.size());
   for (size_t i = 0; i < gradient_argdefs.size(); i++) {
     TypeProto* allreduced_gradient_type_proto = graph_defs.CopyTypeProto(gradient_argdefs[i]);
@@ -29,13 +49,45 @@ static Status AddNcclAllReduceForGradients(
     allreduce_outputs[i] = ArgDef(gradient_argdefs[i].name + "_AllReduce_Out", allreduced_gradient_type_proto);
   }
 
-  // Add NCCL Allreduce node.
-  graph_defs.AddNodeDefs({NodeDef(OpDef{"NcclAllReduce", kMSDomain, 1},
-                                  input_gradient_argdef,
-                                  allreduce_outputs,
-                                  {ONNX_NAMESPACE::MakeAttribute("group_type",
-                                                                 static_cast<int64_t>(WorkerGroupType::DataParallel))},
-                                  "NcclAllReduce")});
+  if (bucket_size_bytes <= 0) {
+    // Add a single NCCL Allreduce node covering every gradient. It only becomes ready once the
+    // last gradient is produced, so all communication happens after backward completes.
+    graph_defs.AddNodeDefs({NodeDef(OpDef{"NcclAllReduce", kMSDomain, 1},
+                                    input_gradient_argdef,
+                                    allreduce_outputs,
+                                    {ONNX_NAMESPACE::MakeAttribute("group_type",
+                                                                   static_cast<int64_t>(WorkerGroupType::DataParallel))},
+                                    "NcclAllReduce")});
+  } else {
+    // Add one NCCL Allreduce node per bucket of up to 'bucket_size_bytes'. Gradients are bucketed
+    // contiguously in weight order, which backward produces in reverse, so each bucket's allreduce
+    // becomes ready as soon as its own gradients finalize and overlaps with the remaining
+    // backward compute instead of waiting for the full gradient set.
+    size_t bucket_start = 0;
+    int64_t bucket_bytes = 0;
+    int bucket_index = 0;
+    for (size_t i = 0; i < gradient_argdefs.size(); i++) {
+      const int64_t gradient_bytes = GradientSizeInBytes(input_gradient_argdef[i], elem_size, bucket_size_bytes);
+      if (i > bucket_start && bucket_bytes + gradient_bytes > bucket_size_bytes) {
+        graph_defs.AddNodeDefs({NodeDef(OpDef{"NcclAllReduce", kMSDomain, 1},
+                                        {input_gradient_argdef.begin() + bucket_start, input_gradient_argdef.begin() + i},
+                                        {allreduce_outputs.begin() + bucket_start, allreduce_outputs.begin() + i},
+                                        {ONNX_NAMESPACE::MakeAttribute("group_type",
+                                                                       static_cast<int64_t>(WorkerGroupType::DataParallel))},
+                                        "NcclAllReduce_bucket_" + std::to_string(bucket_index++))});
+        bucket_start = i;
+        bucket_bytes = 0;
+      }
+      bucket_bytes += gradient_bytes;
+    }
+
+    graph_defs.AddNodeDefs({NodeDef(OpDef{"NcclAllReduce", kMSDomain, 1},
+                                    {input_gradient_argdef.begin() + bucket_start, input_gradient_argdef.end()},
+                                    {allreduce_outputs.begin() + bucket_start, allreduce_outputs.end()},
+                                    {ONNX_NAMESPACE::MakeAttribute("group_type",
+                                                                   static_cast<int64_t>(WorkerGroupType::DataParallel))},
+                                    "NcclAllReduce_bucket_" + std::to_string(bucket_index))});
+  }
 
   gradient_argdefs = allreduce_outputs;
   return Status::OK();
@@ -83,7 +135,11 @@ Status AllreduceOptimizerGraphBuilder::BuildInternal(
   ORT_RETURN_IF_ERROR(AddGradientScalingNodes(nodearg_name_generator, scale, gradient_argdefs, output_gradient_argdef, graph_defs,
                                               opt_graph_config_.AllReduceDataType()));
 
-  ORT_RETURN_IF_ERROR(AddNcclAllReduceForGradients(gradient_argdefs, output_gradient_argdef, graph_defs));
+  const int64_t allreduce_elem_size =
+      opt_graph_config_.AllReduceDataType() == ONNX_NAMESPACE::TensorProto_DataType_FLOAT ? 4 : 2;
+  ORT_RETURN_IF_ERROR(AddNcclAllReduceForGradients(gradient_argdefs, output_gradient_argdef, graph_defs,
+                                                   opt_graph_config_.allreduce_bucket_size_bytes,
+                                                   allreduce_elem_size));
 
   // check if all gradients are finite
   ArgDef global_grad_norm_argdef;
@@ -31,7 +31,10 @@ enum MixedPrecisionDataType {
 
 // Configuration for the DeepSpeed ZeRO technique.  Currently only the stage
 // setting is supported, and only with stages 0 (disabled) and 1 (optimizer
-// state partitioning).
+// state partitioning).  With stage 1 each data-parallel rank owns a contiguous
+// shard of the flattened parameters: gradients are reduce-scattered so each
+// rank reduces only its shard, the optimizer (and its moments) runs on that
+// shard alone, and updated weights are allgathered back to every rank.
 
 struct ZeROConfig {
   // Default configuration
@@ -73,6 +76,10 @@ struct OptimizerGraphConfig {
   std::string loss_scale_input_name{};  // empty string means no loss scaling factor is applied
   AdasumReductionType adasum_reduction_type{AdasumReductionType::None};
   bool enable_grad_norm_clip{true};
+  // Split the gradient allreduce into buckets of up to this many bytes, so each bucket's
+  // allreduce launches as soon as its gradients finalize during backward and communication
+  // overlaps with the remaining backward compute. 0 keeps the single fused allreduce.
+  int64_t allreduce_bucket_size_bytes{0};
 
   NameMLValMap shared_optimizer_states{};  // initial states for shared params, eg. 'Step' for lamb
 
@@ -21,6 +21,11 @@ struct TrainingGraphTransformerConfiguration : public GraphTransformerConfigurat
   bool transformer_layer_recompute{false};
   // Number of layers to apply recompute
   int number_recompute_layers{0};
+  // Enable the planner that automatically selects cheap-to-recompute activations
+  // (Gelu, LayerNorm, attention dropout) to drop and rematerialize in backward
+  bool auto_recompute{false};
+  // Stop selecting activations once this much activation memory is freed. 0 selects every candidate.
+  int64_t auto_recompute_target_saved_bytes{0};
   bool allow_layer_norm_mod_precision{false};
 };
 
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/graph/graph_utils.h"
+#include "orttraining/core/framework/activation_recompute_planner.h"
 #include "orttraining/core/graph/recompute_graph_utils.h"
 #include "orttraining/core/optimizer/localized_recompute.h"
 #include "orttraining/core/optimizer/dropout_recompute.h"
@@ -91,4 +92,43 @@ Status AttentionDropoutRecompute::ApplyImpl(Graph& graph, bool& modified, int /*
   return Status::OK();
 }
 
+Status PlannedActivationRecompute::ApplyImpl(Graph& graph, bool& modified, int /*graph_level*/,
+                                             const logging::Logger& logger) const {
+  const auto plan = training::PlanActivationRecompute(graph, target_saved_bytes_, logger);
+
+  for (const auto& candidate : plan.selected) {
+    Node& node = *candidate.node;
+
+    if (candidate.is_attention_dropout) {
+      // recomputed dropout must reproduce the original output, so it reuses the original mask
+      Node& recompute_node = InsertDropoutRecompute(graph, node, /*use_original_input*/ true);
+      recompute_node.SetPriority(static_cast<int>(ExecutionPriority::LOCAL_LOW));
+      modified = true;
+      continue;
+    }
+
+    // duplicate every output so gradients of ops like LayerNormalization, which consume the
+    // saved mean/inv_std_dev as well, find a recomputed version of each
+    std::vector<NodeArg*> recomputed_outputs;
+    for (NodeArg* output : node.MutableOutputDefs()) {
+      auto& recomputed_output = graph.GetOrCreateNodeArg(graph_utils::RecomputeName(output->Name()),
+                                                         output->TypeAsProto());
+      recomputed_outputs.push_back(&recomputed_output);
+    }
+
+    Node& recompute_node = graph.AddNode(node.Name() + "_recompute",
+                                         node.OpType(),
+                                         "Recompute of " + node.Name(),
+                                         node.MutableInputDefs(),
+                                         recomputed_outputs,
+                                         &node.GetAttributes(),
+                                         node.Domain());
+
+    recompute_node.SetPriority(static_cast<int>(ExecutionPriority::LOCAL_LOW));
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
 }  // namespace onnxruntime
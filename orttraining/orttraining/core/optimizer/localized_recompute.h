@@ -43,4 +43,25 @@ class AttentionDropoutRecompute : public GraphTransformer {
   bool SatisfyCondition(const Node& node) const;
 };
 
+/**
+@Class PlannedActivationRecompute
+
+Recompute the cheap activations selected by the activation recompute planner
+(Gelu, LayerNorm, attention dropout), largest first, until the configured amount
+of activation memory is freed
+
+*/
+class PlannedActivationRecompute : public GraphTransformer {
+ public:
+  explicit PlannedActivationRecompute(int64_t target_saved_bytes = 0) noexcept
+      : GraphTransformer("PlannedActivationRecompute"), target_saved_bytes_(target_saved_bytes) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  bool ShouldOnlyApplyOnce() const override { return true; }
+
+ private:
+  int64_t target_saved_bytes_;
+};
+
 }  // namespace onnxruntime
@@ -121,6 +121,12 @@ Status SetupOptimizerParams(
   opt_graph_config.use_nccl = optimizer_config.use_nccl;
   opt_graph_config.adasum_reduction_type = optimizer_config.adasum_reduction_type;
   opt_graph_config.enable_grad_norm_clip = optimizer_config.enable_grad_norm_clip;
+  opt_graph_config.allreduce_bucket_size_bytes = optimizer_config.allreduce_bucket_size_bytes;
+  // Only ZeRO stages 0 (disabled) and 1 (optimizer state partitioning) are implemented.
+  // Fail loudly rather than silently running an unsupported stage as stage 1.
+  ORT_RETURN_IF_NOT(optimizer_config.deepspeed_zero.stage >= 0 && optimizer_config.deepspeed_zero.stage <= 1,
+                    "Invalid ZeRO stage ", optimizer_config.deepspeed_zero.stage,
+                    ". Supported stages are 0 (disabled) and 1 (optimizer state partitioning).");
   opt_graph_config.deepspeed_zero = optimizer_config.deepspeed_zero;
 
   // check if shared initial optimizer states have been provided
@@ -1601,7 +1607,8 @@ Status PipelineTrainingSession::SetEventSynchronization(
   const int num_pipeline_stages = distributed_config.value().pipeline_parallel_size;
   pipeline_schedule_ = pipeline::PipelineScheduler(num_pipeline_micro_batches,
                                                    num_pipeline_stages,
-                                                   DistributedRunContext::GetRanks(WorkerGroupType::PipelineParallel));
+                                                   DistributedRunContext::GetRanks(WorkerGroupType::PipelineParallel),
+                                                   distributed_config.value().max_pipeline_in_flight_batches);
   pipeline_worker_pool_ = pipeline::PipelineWorkerPool(num_pipeline_stages);
 
   // Insert PipelineOps may access "sliced_schema" from "pipeline_context_".
@@ -94,6 +94,11 @@ class TrainingSession : public InferenceSession {
       int pipeline_parallel_size{1};
       // The number of micro-batches run by pipeline parallel after calling one session.Run(...).
       int num_pipeline_micro_batches{1};
+      // The maximum number of micro-batches concurrently in flight in the pipeline.
+      // It bounds the activations stashed per stage between forward and backward.
+      // 0 or any value above pipeline_parallel_size falls back to
+      // pipeline_parallel_size, the 1F1B bound.
+      int max_pipeline_in_flight_batches{0};
       // We assume one process only run a portion of the graph when pipeline parallel is enabled.
       // This field is the graph partition's ID this process run.
       int pipeline_stage_id{0};
@@ -192,6 +197,10 @@ class TrainingSession : public InferenceSession {
       AdasumReductionType adasum_reduction_type{AdasumReductionType::None};
       // Whether to enable gradient clipping.
       bool enable_grad_norm_clip{true};
+      // Bucket size in bytes for the gradient allreduce. Buckets launch as their gradients
+      // finalize during backward, overlapping communication with compute. 0 keeps the single
+      // fused allreduce after backward.
+      int64_t allreduce_bucket_size_bytes{0};
     };
     // The optimizer configuration.
     // If not provided, no optimizer is added.
@@ -111,6 +111,7 @@ Status TrainingRunner::Initialize() {
   config.distributed_config.data_parallel_size = params_.data_parallel_size;
   config.distributed_config.horizontal_parallel_size = params_.horizontal_parallel_size;
   config.distributed_config.pipeline_parallel_size = params_.pipeline_parallel_size;
+  config.distributed_config.max_pipeline_in_flight_batches = params_.max_pipeline_in_flight_batches;
 
   if (params_.use_mixed_precision) {
     TrainingSession::TrainingConfiguration::MixedPrecisionConfiguration mp{};
@@ -221,7 +222,8 @@ Status TrainingRunner::Initialize() {
     pipeline_schedule_ = pipeline::PipelineScheduler(
         params_.gradient_accumulation_steps,
         params_.pipeline_parallel_size,
-        DistributedRunContext::GetRanks(WorkerGroupType::PipelineParallel));
+        DistributedRunContext::GetRanks(WorkerGroupType::PipelineParallel),
+        params_.max_pipeline_in_flight_batches);
     pipeline_worker_pool_ = pipeline::PipelineWorkerPool(params_.pipeline_parallel_size);
 
     fetch_names = config_result.pipeline_config_result.value().fetch_names;
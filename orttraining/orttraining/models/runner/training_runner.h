@@ -173,6 +173,9 @@ class TrainingRunner {
     // pipeline_parallel_size > 1 means pipeline is enabled.
     // pipeline_parallel_size == 1 means pipeline is disabled.
     int pipeline_parallel_size = 1;
+    // Upper bound on micro-batches concurrently in flight in the pipeline.
+    // 0 means the 1F1B bound, i.e., pipeline_parallel_size.
+    int max_pipeline_in_flight_batches = 0;
     // pipeline partition information to do online-partition. If the graph is
     // pre-partitioned, no need to fill this value.
     std::vector<TrainingSession::TrainingConfiguration::CutInfo> pipeline_partition_cut_list;
@@ -66,8 +66,10 @@ struct TrainingParameters {
   int horizontal_parallel_size = 1;
   int pipeline_parallel_size = 1;
   int num_pipeline_micro_batches = 1;
+  int max_pipeline_in_flight_batches = 0;
   int deepspeed_zero_stage = 0;
   bool enable_grad_norm_clip = true;
+  int64_t allreduce_bucket_size_bytes = 0;
   bool set_gradients_as_graph_outputs = false;
   bool use_memory_efficient_gradient = false;
 
@@ -132,6 +134,7 @@ TrainingConfigurationResult ConfigureSessionForTraining(
   config.distributed_config.horizontal_parallel_size = parameters.horizontal_parallel_size;
   config.distributed_config.pipeline_parallel_size = parameters.pipeline_parallel_size;
   config.distributed_config.num_pipeline_micro_batches = parameters.num_pipeline_micro_batches;
+  config.distributed_config.max_pipeline_in_flight_batches = parameters.max_pipeline_in_flight_batches;
   config.distributed_config.sliced_schema = parameters.sliced_schema;
   config.distributed_config.sliced_axes = parameters.sliced_axes;
   config.distributed_config.sliced_tensor_names = parameters.sliced_tensor_names;
@@ -225,6 +228,7 @@ TrainingConfigurationResult ConfigureSessionForTraining(
     opt.use_nccl = parameters.allreduce_post_accumulation;
     opt.deepspeed_zero = onnxruntime::training::ZeROConfig(parameters.deepspeed_zero_stage);
     opt.enable_grad_norm_clip = parameters.enable_grad_norm_clip;
+    opt.allreduce_bucket_size_bytes = parameters.allreduce_bucket_size_bytes;
 
     // TODO reduction types
     if (parameters.enable_adasum) {
@@ -386,9 +390,11 @@ void addObjectMethodsForTraining(py::module& m, ExecutionProviderRegistrationFn
       .def_readwrite("pipeline_parallel_size", &TrainingParameters::pipeline_parallel_size)
       .def_readwrite("pipeline_cut_info_string", &TrainingParameters::pipeline_cut_info_string)
       .def_readwrite("num_pipeline_micro_batches", &TrainingParameters::num_pipeline_micro_batches)
+      .def_readwrite("max_pipeline_in_flight_batches", &TrainingParameters::max_pipeline_in_flight_batches)
       .def_readwrite("gradient_accumulation_steps", &TrainingParameters::gradient_accumulation_steps)
       .def_readwrite("deepspeed_zero_stage", &TrainingParameters::deepspeed_zero_stage)
       .def_readwrite("enable_grad_norm_clip", &TrainingParameters::enable_grad_norm_clip)
+      .def_readwrite("allreduce_bucket_size_bytes", &TrainingParameters::allreduce_bucket_size_bytes)
       .def_readwrite("set_gradients_as_graph_outputs", &TrainingParameters::set_gradients_as_graph_outputs)
       .def_readwrite("use_memory_efficient_gradient", &TrainingParameters::use_memory_efficient_gradient)
       .def_readwrite("attn_dropout_recompute", &TrainingParameters::attn_dropout_recompute)
@@ -657,6 +663,8 @@ void addObjectMethodsForTraining(py::module& m, ExecutionProviderRegistrationFn
       .def_readwrite("gelu_recompute", &TrainingGraphTransformerConfiguration::gelu_recompute)
       .def_readwrite("transformer_layer_recompute", &TrainingGraphTransformerConfiguration::transformer_layer_recompute)
       .def_readwrite("number_recompute_layers", &TrainingGraphTransformerConfiguration::number_recompute_layers)
+      .def_readwrite("auto_recompute", &TrainingGraphTransformerConfiguration::auto_recompute)
+      .def_readwrite("auto_recompute_target_saved_bytes", &TrainingGraphTransformerConfiguration::auto_recompute_target_saved_bytes)
       .def_readwrite("allow_layer_norm_mod_precision", &TrainingGraphTransformerConfiguration::allow_layer_norm_mod_precision)
       .def_readwrite("propagate_cast_ops_config", &TrainingGraphTransformerConfiguration::GraphTransformerConfiguration::propagate_cast_ops_config);
 
@@ -112,5 +112,27 @@ TEST(Pipeline, ScheduleB5S3) {
   TestPipelineScheduler(num_batches, num_stages, baseline_events);
 }
 
+TEST(Pipeline, ScheduleBoundedInFlightB5S3) {
+  const int num_batches = 5;
+  const int num_stages = 3;
+
+  // With the in-flight bound set to 1, a batch's forward cannot start until the
+  // previous batch's backward has finished, so on every stage the event waited
+  // by a forward compute must not precede the event recorded by the previous
+  // batch's backward compute.
+  onnxruntime::training::pipeline::PipelineScheduler bounded(num_batches, num_stages, {0, 1, 2}, 1);
+  for (int s = 0; s < num_stages; ++s) {
+    for (int b = 1; b < num_batches; ++b) {
+      EXPECT_GE(bounded.GetForwardComputeWaitedEvent(b, s), bounded.GetBackwardComputeRecordedEvent(b - 1, s))
+          << " batch " << b << " stage " << s;
+    }
+  }
+
+  // The default bound (num_stages batches in flight) overlaps batches, so on the
+  // first stage the third forward runs before the first backward.
+  onnxruntime::training::pipeline::PipelineScheduler unbounded(num_batches, num_stages, {0, 1, 2});
+  EXPECT_LT(unbounded.GetForwardComputeWaitedEvent(2, 0), unbounded.GetBackwardComputeRecordedEvent(0, 0));
+}
+
 }  // namespace test
 }  // namespace onnxruntime
\ No newline at end of file
@@ -477,6 +477,21 @@ TEST_F(OptimizerGraphBuilderTest, Allreduce_WithGradientAccumulation_WithMixedPr
   TestAllreduceOptimizerGraphBuilder(config, graph_);
 }
 
+TEST_F(OptimizerGraphBuilderTest, Allreduce_Bucketed) {
+  OptimizerGraphConfig config;
+  config.data_parallel_group_size = 4;
+  config.use_nccl = true;
+  config.gradient_accumulation_steps = 1;
+  config.use_mixed_precision = false;
+  // each test gradient is a single float, so a 4 byte bucket holds exactly one gradient and
+  // every gradient gets its own allreduce
+  config.allreduce_bucket_size_bytes = 4;
+  TestAllreduceOptimizerGraphBuilder(config, graph_);
+
+  auto op_counts = CountOpsInGraph(graph_, false);
+  ASSERT_EQ(GetOpCount(op_counts, k_all_reduce_op_name), k_weight_names.size());
+}
+
 static void TestZeROOptimizerGraphBuilder(OptimizerGraphConfig config, Graph& graph) {
   std::unordered_map<std::string, std::string> updated_weight_names_map;
   std::unordered_map<std::string, training::TrainingSession::PartitionInfo> weight_partition_info;
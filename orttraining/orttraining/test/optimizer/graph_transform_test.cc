@@ -536,6 +536,32 @@ TEST_F(GraphTransformationTests, BiasGeluRecomputeTest) {
   }
 }
 
+TEST_F(GraphTransformationTests, PlannedActivationRecomputeTest) {
+  auto model_uri = MODEL_FOLDER "fusion/bias_gelu_fusion_recompute.onnx";
+  std::shared_ptr<Model> p_model;
+  ASSERT_STATUS_OK(Model::Load(model_uri, p_model, nullptr, *logger_));
+  Graph& graph = p_model->MainGraph();
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(std::make_unique<GeluFusion>(), TransformerLevel::Level2);
+  graph_transformation_mgr.Register(std::make_unique<BiasGeluFusion>(), TransformerLevel::Level2);
+  // no byte target: the planner selects every cheap candidate, as GeluRecompute would
+  graph_transformation_mgr.Register(std::make_unique<PlannedActivationRecompute>(), TransformerLevel::Level2);
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2, *logger_));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  ASSERT_TRUE(op_to_count["com.microsoft.BiasGelu"] == 2);
+
+  int recompute_nodes = 0;
+  for (auto& node : graph.Nodes()) {
+    if (node.Description().find("Recompute of ") == 0) {
+      ++recompute_nodes;
+      ASSERT_EQ(node.Priority(), static_cast<int>(ExecutionPriority::LOCAL_LOW));
+    }
+  }
+  ASSERT_EQ(recompute_nodes, 1);
+}
+
 TEST_F(GraphTransformationTests, SoftmaxCrossEntropyLossInternalFusionWithoutCast) {
   Model model("SoftmaxCrossEntropyLossInternalFusion", true, ModelMetaData(), PathString(),
               IOnnxRuntimeOpSchemaRegistryList(), {{"", 12}, {"com.microsoft", 1}}, {}, *logger_);
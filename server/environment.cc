@@ -129,6 +129,19 @@ std::shared_ptr<spdlog::logger> ServerEnvironment::GetAppLogger() const {
   return default_logger_;
 }
 
+void ServerEnvironment::SetRequestThrottling(int max_concurrent_requests, int max_queue_delay_ms) {
+  if (max_concurrent_requests <= 0) {
+    request_throttler_ = nullptr;
+    return;
+  }
+
+  request_throttler_ = std::make_unique<RequestThrottler>(max_concurrent_requests, max_queue_delay_ms);
+}
+
+RequestThrottler* ServerEnvironment::GetRequestThrottler() const {
+  return request_throttler_.get();
+}
+
 void ServerEnvironment::UnloadModel(const std::string& model_name, const std::string& model_version) {
   auto identifier = std::make_pair(model_name, model_version);
   auto it = sessions_.find(identifier);
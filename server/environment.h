@@ -11,6 +11,8 @@
 #include <unordered_map>
 #include <boost/functional/hash.hpp>
 
+#include "request_throttler.h"
+
 namespace onnxruntime {
 namespace server {
 
@@ -30,6 +32,12 @@ class ServerEnvironment {
   void UnloadModel(const std::string& model_name, const std::string& model_version);
   void RegisterExecutionProviders();
 
+  // Bounds the number of concurrently running predictions across all frontends.
+  // A max_concurrent_requests of 0 disables admission control.
+  void SetRequestThrottling(int max_concurrent_requests, int max_queue_delay_ms);
+  // Returns nullptr when admission control is disabled.
+  RequestThrottler* GetRequestThrottler() const;
+
  private:
   const OrtLoggingLevel severity_;
   const std::string logger_id_;
@@ -52,6 +60,7 @@ class ServerEnvironment {
   };
 
   std::unordered_map<std::pair<std::string, std::string>, ServerEnvironment::SessionHolder, boost::hash<std::pair<std::string, std::string>>> sessions_;
+  std::unique_ptr<RequestThrottler> request_throttler_;
 };
 
 }  // namespace server
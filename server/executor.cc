@@ -23,6 +23,18 @@ protobufutil::Status Executor::SetMLValue(const onnx::TensorProto& input_tensor,
                                           /* out */ Ort::Value& ml_value) {
   auto logger = env_->GetLogger(request_id_);
 
+  // Zero-copy path: when the request carries raw_data the value can alias the proto's buffer
+  // directly. The request proto outlives the Run call, so the aliased memory stays valid and
+  // the unpack copy (and its allocation) is skipped entirely.
+  try {
+    if (onnxruntime::server::TensorProtoToMLValueZeroCopy(input_tensor, *cpu_memory_info, ml_value)) {
+      return protobufutil::Status::OK;
+    }
+  } catch (const Ort::Exception& e) {
+    logger->error("TensorProtoToMLValueZeroCopy() failed. Error Message: {}", e.what());
+    return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+  }
+
   size_t cpu_tensor_length = 0;
   try {
     onnxruntime::server::GetSizeInBytesFromTensorProto<0>(input_tensor, &cpu_tensor_length);
@@ -103,6 +115,15 @@ protobufutil::Status Executor::Predict(const std::string& model_name,
                                        /* out */ onnxruntime::server::PredictResponse& response) {
   auto logger = env_->GetLogger(request_id_);
 
+  // Admission control: bound how many predictions run (and wait) at once so that an
+  // overloaded server sheds requests quickly instead of queueing them without limit.
+  RequestThrottler::Slot slot(env_->GetRequestThrottler());
+  if (!slot.acquired()) {
+    logger->error("Prediction rejected: server is at its concurrent request limit");
+    return protobufutil::Status(protobufutil::error::Code::UNAVAILABLE,
+                                "Server is temporarily over capacity. Please retry the request.");
+  }
+
   // Convert PredictRequest to NameMLValMap
   MemBufferArray buffer_array;
   std::vector<std::string> input_names;
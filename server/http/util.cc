@@ -29,10 +29,12 @@ boost::beast::http::status GetHttpStatusCode(const protobufutil::Status& status)
     case protobufutil::error::Code::ABORTED:
     case protobufutil::error::Code::UNIMPLEMENTED:
     case protobufutil::error::Code::INTERNAL:
-    case protobufutil::error::Code::UNAVAILABLE:
     case protobufutil::error::Code::DATA_LOSS:
       return boost::beast::http::status::internal_server_error;
 
+    case protobufutil::error::Code::UNAVAILABLE:
+      return boost::beast::http::status::service_unavailable;
+
     case protobufutil::error::Code::CANCELLED:
     case protobufutil::error::Code::INVALID_ARGUMENT:
     case protobufutil::error::Code::ALREADY_EXISTS:
@@ -72,6 +72,11 @@ int main(int argc, char* argv[]) {
     exit(EXIT_FAILURE);
   }
 
+  env->SetRequestThrottling(config.max_concurrent_requests, config.max_request_queue_delay_ms);
+  if (config.max_concurrent_requests > 0) {
+    logger->info("Limiting to {} concurrent predictions, queue delay budget: {}ms", config.max_concurrent_requests, config.max_request_queue_delay_ms);
+  }
+
   //Setup GRPC Server
   auto const grpc_address = config.address;
   auto const grpc_port = config.grpc_port;
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "request_throttler.h"
+
+namespace onnxruntime {
+namespace server {
+
+RequestThrottler::RequestThrottler(int max_concurrent_requests, int max_queue_delay_ms)
+    : max_concurrent_(max_concurrent_requests),
+      max_queue_delay_(std::chrono::milliseconds(max_queue_delay_ms)) {
+}
+
+bool RequestThrottler::TryAcquire() {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  if (active_ < max_concurrent_) {
+    ++active_;
+    return true;
+  }
+
+  // The queue holds at most as many waiters as there are slots. A request arriving
+  // beyond that would spend its whole delay budget behind the existing waiters, so
+  // shed it immediately rather than letting it queue.
+  if (waiting_ >= max_concurrent_) {
+    return false;
+  }
+
+  ++waiting_;
+  bool got_slot = slot_released_.wait_for(lock, max_queue_delay_, [this] { return active_ < max_concurrent_; });
+  --waiting_;
+
+  if (!got_slot) {
+    return false;
+  }
+
+  ++active_;
+  return true;
+}
+
+void RequestThrottler::Release() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --active_;
+  }
+  slot_released_.notify_one();
+}
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace onnxruntime {
+namespace server {
+
+// Admission control for prediction requests, shared by the HTTP and GRPC frontends.
+// At most max_concurrent_requests predictions run at once and up to the same number again
+// may wait in a bounded queue for a free slot. A request is shed when the queue is already
+// full or when it has waited longer than the queue-delay budget, so queueing delay stays
+// bounded under overload instead of growing with the offered load.
+class RequestThrottler {
+ public:
+  RequestThrottler(int max_concurrent_requests, int max_queue_delay_ms);
+  RequestThrottler(const RequestThrottler&) = delete;
+  RequestThrottler& operator=(const RequestThrottler&) = delete;
+
+  // Blocks until a prediction slot is free or the queue-delay budget runs out.
+  // Returns true when a slot was acquired, in which case the caller must pair it
+  // with a Release call. Returns false when the request should be rejected.
+  bool TryAcquire();
+
+  // Returns a slot acquired with TryAcquire and wakes one waiter.
+  void Release();
+
+  // Scoped holder of a prediction slot. A null throttler means admission control is
+  // disabled and the slot is always considered acquired.
+  class Slot {
+   public:
+    explicit Slot(RequestThrottler* throttler)
+        : throttler_(throttler), acquired_(throttler == nullptr || throttler->TryAcquire()) {}
+    ~Slot() {
+      if (throttler_ != nullptr && acquired_) {
+        throttler_->Release();
+      }
+    }
+    Slot(const Slot&) = delete;
+    Slot& operator=(const Slot&) = delete;
+
+    bool acquired() const { return acquired_; }
+
+   private:
+    RequestThrottler* throttler_;
+    bool acquired_;
+  };
+
+ private:
+  const int max_concurrent_;
+  const std::chrono::milliseconds max_queue_delay_;
+
+  std::mutex mutex_;
+  std::condition_variable slot_released_;
+  int active_ = 0;
+  int waiting_ = 0;
+};
+
+}  // namespace server
+}  // namespace onnxruntime
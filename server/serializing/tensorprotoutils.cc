@@ -378,6 +378,44 @@ void TensorProtoToMLValue(const onnx::TensorProto& tensor_proto, const MemBuffer
   value = Ort::Value::CreateTensor(&allocator, tensor_data, m.GetLen(), tensor_shape_vec.data(), tensor_shape_vec.size(), (ONNXTensorElementDataType)tensor_proto.data_type());
   return;
 }
+bool TensorProtoToMLValueZeroCopy(const onnx::TensorProto& tensor_proto, const OrtMemoryInfo& memory_info,
+                                  Ort::Value& value) {
+  // raw_data is little-endian by spec, so a big-endian host needs the byte-swapping copy path
+  if (!tensor_proto.has_raw_data() || !IsLittleEndianOrder()) {
+    return false;
+  }
+
+  ONNXTensorElementDataType ele_type = GetTensorElementType(tensor_proto);
+  switch (ele_type) {
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_COMPLEX64:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_COMPLEX128:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED:
+      return false;
+    default:
+      break;
+  }
+
+  for (auto dim : tensor_proto.dims()) {
+    if (dim < 0) {
+      return false;
+    }
+  }
+
+  size_t expected_size = 0;
+  GetSizeInBytesFromTensorProto<0>(tensor_proto, &expected_size);
+  if (tensor_proto.raw_data().size() != expected_size) {
+    return false;
+  }
+
+  std::vector<int64_t> tensor_shape_vec = GetTensorShapeFromTensorProto(tensor_proto);
+  // CreateTensor only reads through the pointer for inputs, but takes a mutable one
+  void* data = const_cast<char*>(tensor_proto.raw_data().data());
+  value = Ort::Value::CreateTensor(&memory_info, data, expected_size,
+                                   tensor_shape_vec.data(), tensor_shape_vec.size(), ele_type);
+  return true;
+}
+
 template void GetSizeInBytesFromTensorProto<256>(const onnx::TensorProto& tensor_proto,
                                                  size_t* out);
 template void GetSizeInBytesFromTensorProto<0>(const onnx::TensorProto& tensor_proto, size_t* out);
@@ -27,6 +27,16 @@ void GetSizeInBytesFromTensorProto(const onnx::TensorProto& tensor_proto, size_t
  */
 void TensorProtoToMLValue(const onnx::TensorProto& input, const server::MemBuffer& m, /* out */ Ort::Value& value);
 
+/**
+ * Try to create a value that aliases the TensorProto's raw_data instead of unpacking it into a
+ * separate buffer. Returns false when there is no raw_data, the element type cannot be aliased
+ * (strings), the host is not little-endian (raw_data is little-endian by spec and would need
+ * swapping), or the raw_data size does not match the tensor shape; the caller should then fall
+ * back to TensorProtoToMLValue. The proto must outlive the returned value.
+ */
+bool TensorProtoToMLValueZeroCopy(const onnx::TensorProto& input, const OrtMemoryInfo& memory_info,
+                                  /* out */ Ort::Value& value);
+
 template <typename T>
 void UnpackTensor(const onnx::TensorProto& tensor, const void* raw_data, size_t raw_data_len,
                   /*out*/ T* p_data, int64_t expected_size);
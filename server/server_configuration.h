@@ -45,6 +45,8 @@ class ServerConfiguration {
   unsigned short http_port = 8001;
   unsigned short grpc_port = 50051;
   int num_http_threads = std::thread::hardware_concurrency();
+  int max_concurrent_requests = std::thread::hardware_concurrency();
+  int max_request_queue_delay_ms = 1000;
   OrtLoggingLevel logging_level{};
 
   ServerConfiguration() {
@@ -57,6 +59,8 @@ class ServerConfiguration {
     desc.add_options()("http_port", po::value(&http_port)->default_value(http_port), "HTTP port to listen to requests");
     desc.add_options()("num_http_threads", po::value(&num_http_threads)->default_value(num_http_threads), "Number of http threads");
     desc.add_options()("grpc_port", po::value(&grpc_port)->default_value(grpc_port), "GRPC port to listen to requests");
+    desc.add_options()("max_concurrent_requests", po::value(&max_concurrent_requests)->default_value(max_concurrent_requests), "Maximum number of predictions running at once. 0 disables the limit");
+    desc.add_options()("max_request_queue_delay_ms", po::value(&max_request_queue_delay_ms)->default_value(max_request_queue_delay_ms), "How long in milliseconds a request may wait for a prediction slot before being rejected");
   }
 
   // Parses argc and argv and sets the values for the class
@@ -103,6 +107,12 @@ class ServerConfiguration {
     } else if (num_http_threads <= 0) {
       PrintHelp(std::cerr, "num_http_threads must be greater than 0");
       return Result::ExitFailure;
+    } else if (max_concurrent_requests < 0) {
+      PrintHelp(std::cerr, "max_concurrent_requests must not be negative");
+      return Result::ExitFailure;
+    } else if (max_request_queue_delay_ms < 0) {
+      PrintHelp(std::cerr, "max_request_queue_delay_ms must not be negative");
+      return Result::ExitFailure;
     } else if (!file_exists(model_path)) {
       PrintHelp(std::cerr, "model_path must be the location of a valid file");
       return Result::ExitFailure;
@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "request_throttler.h"
+
+namespace onnxruntime {
+namespace server {
+namespace test {
+
+TEST(RequestThrottlerTests, AcquireBelowLimit) {
+  RequestThrottler throttler(2, /* max_queue_delay_ms */ 10);
+
+  EXPECT_TRUE(throttler.TryAcquire());
+  EXPECT_TRUE(throttler.TryAcquire());
+  throttler.Release();
+  throttler.Release();
+}
+
+TEST(RequestThrottlerTests, ShedWhenQueueDelayExceeded) {
+  RequestThrottler throttler(1, /* max_queue_delay_ms */ 10);
+
+  EXPECT_TRUE(throttler.TryAcquire());
+  // The slot is held, so the second request waits out its budget and is shed.
+  EXPECT_FALSE(throttler.TryAcquire());
+  throttler.Release();
+
+  // With the slot back, requests are admitted again.
+  EXPECT_TRUE(throttler.TryAcquire());
+  throttler.Release();
+}
+
+TEST(RequestThrottlerTests, WaiterAdmittedWhenSlotFrees) {
+  RequestThrottler throttler(1, /* max_queue_delay_ms */ 5000);
+
+  ASSERT_TRUE(throttler.TryAcquire());
+
+  bool waiter_admitted = false;
+  std::thread waiter([&throttler, &waiter_admitted]() {
+    waiter_admitted = throttler.TryAcquire();
+    if (waiter_admitted) {
+      throttler.Release();
+    }
+  });
+
+  throttler.Release();
+  waiter.join();
+  EXPECT_TRUE(waiter_admitted);
+}
+
+TEST(RequestThrottlerTests, SlotReleasesOnDestruction) {
+  RequestThrottler throttler(1, /* max_queue_delay_ms */ 10);
+
+  {
+    RequestThrottler::Slot slot(&throttler);
+    EXPECT_TRUE(slot.acquired());
+
+    RequestThrottler::Slot rejected(&throttler);
+    EXPECT_FALSE(rejected.acquired());
+  }
+
+  RequestThrottler::Slot slot(&throttler);
+  EXPECT_TRUE(slot.acquired());
+}
+
+TEST(RequestThrottlerTests, NullThrottlerAlwaysAdmits) {
+  RequestThrottler::Slot slot(nullptr);
+  EXPECT_TRUE(slot.acquired());
+}
+
+}  // namespace test
+}  // namespace server
+}  // namespace onnxruntime
@@ -18,6 +18,7 @@ contrib_ops_excluded_files = [
                     'bert/attention_impl.h',
                     'bert/attention_transpose.cu',
                     'bert/attention_past.cu',
+                    'bert/attention_single_token.cu',
                     'bert/embed_layer_norm.cc',
                     'bert/embed_layer_norm.h',
                     'bert/embed_layer_norm_impl.cu',
@@ -44,6 +45,10 @@ contrib_ops_excluded_files = [
                     'math/fft_ops.h',
                     'math/fft_ops_impl.cu',
                     'math/fft_ops_impl.h',
+                    'math/fused_elementwise.cc',
+                    'math/fused_elementwise.h',
+                    'math/fused_elementwise_impl.cu',
+                    'math/fused_elementwise_impl.h',
                     'quantization/attention_quantization.cc',
                     'quantization/attention_quantization.h',
                     'quantization/attention_quantization_impl.cu',
@@ -162,6 +167,8 @@ provider_excluded_files = [
                 'cuda_fence.cc',
                 'cuda_fence.h',
                 'cuda_fwd.h',
+                'cuda_graph.cc',
+                'cuda_graph.h',
                 'cuda_kernel.h',
                 'cuda_pch.cc',
                 'cuda_pch.h',
@@ -0,0 +1,223 @@
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+# --------------------------------------------------------------------------
+# Combines a full-precision model and a reduced-precision variant of the same
+# logical model (e.g. fp32 and int8/fp16) into a single ONNX model whose
+# precision is selected per request by a boolean input.
+#
+# The two graphs become the branches of an If node, so one session serves both
+# precisions and traffic can be shifted between them instantly by changing a
+# feed, instead of running two sessions with duplicated per-session state.
+# Initializers with identical content in both branches (weights the
+# quantization left untouched, such as embeddings) are deduplicated into a
+# single copy in the main graph that both branches reference from outer scope.
+
+import argparse
+import copy
+import hashlib
+import logging
+import sys
+
+import onnx
+from onnx import TensorProto, helper
+
+logger = logging.getLogger(__name__)
+
+
+def _initializer_digest(initializer):
+    """Content hash used to detect initializers that are identical in both branches."""
+    digest = hashlib.sha256()
+    digest.update(str(initializer.data_type).encode())
+    digest.update(str(list(initializer.dims)).encode())
+    digest.update(onnx.numpy_helper.to_array(initializer).tobytes())
+    return digest.hexdigest()
+
+
+def _rename_in_graph(graph, rename_map):
+    """Applies rename_map to every value reference in graph, recursing into subgraphs."""
+
+    def _renamed(name):
+        return rename_map.get(name, name)
+
+    for initializer in list(graph.initializer) + [entry.values for entry in graph.sparse_initializer]:
+        initializer.name = _renamed(initializer.name)
+
+    for value_info in list(graph.value_info) + list(graph.input) + list(graph.output):
+        value_info.name = _renamed(value_info.name)
+
+    for node in graph.node:
+        for i, name in enumerate(node.input):
+            node.input[i] = _renamed(name)
+        for i, name in enumerate(node.output):
+            node.output[i] = _renamed(name)
+        for attr in node.attribute:
+            if attr.type == onnx.AttributeProto.GRAPH:
+                _rename_in_graph(attr.g, rename_map)
+            elif attr.type == onnx.AttributeProto.GRAPHS:
+                for subgraph in attr.graphs:
+                    _rename_in_graph(subgraph, rename_map)
+
+
+def _prefix_graph_names(graph, prefix, preserved_names):
+    """Prefixes every name the branch defines so the two branches cannot collide.
+
+    Names in preserved_names (the shared main-graph inputs the branches capture
+    from outer scope) are left untouched. Returns the rename map applied.
+    """
+    rename_map = {}
+
+    def _add(name):
+        if name and name not in preserved_names and name not in rename_map:
+            rename_map[name] = prefix + name
+
+    for initializer in graph.initializer:
+        _add(initializer.name)
+    for node in graph.node:
+        for name in node.output:
+            _add(name)
+    for value_info in graph.output:
+        _add(value_info.name)
+
+    _rename_in_graph(graph, rename_map)
+    return rename_map
+
+
+def _deduplicate_initializers(branch_a, branch_b, prefix_a):
+    """Removes initializers with identical content from both branches and returns
+    single copies to be placed in the main graph, which both branches reference
+    from outer scope."""
+    digests_a = {_initializer_digest(init): init for init in branch_a.initializer}
+    shared_initializers = []
+    shared_bytes = 0
+
+    for init_b in list(branch_b.initializer):
+        digest = _initializer_digest(init_b)
+        init_a = digests_a.get(digest)
+        if init_a is None:
+            continue
+
+        # Strip the branch prefixes so the hoisted copy has a neutral name.
+        shared_name = "shared." + (init_a.name[len(prefix_a):] if init_a.name.startswith(prefix_a) else init_a.name)
+
+        branch_b.initializer.remove(init_b)
+        branch_a.initializer.remove(init_a)
+        _rename_in_graph(branch_a, {init_a.name: shared_name})
+        _rename_in_graph(branch_b, {init_b.name: shared_name})
+
+        init_a.name = shared_name
+        shared_initializers.append(init_a)
+        del digests_a[digest]
+
+        shared_bytes += init_a.ByteSize()
+
+    logger.info("Deduplicated %d initializers (%d bytes) shared by both branches.",
+                len(shared_initializers), shared_bytes)
+    return shared_initializers
+
+
+def _check_signatures_match(full_graph, reduced_graph):
+    def _signature(graph):
+        initializer_names = {init.name for init in graph.initializer}
+        inputs = [(i.name, i.type.tensor_type.elem_type) for i in graph.input if i.name not in initializer_names]
+        outputs = [(o.name, o.type.tensor_type.elem_type) for o in graph.output]
+        return inputs, outputs
+
+    full_signature = _signature(full_graph)
+    reduced_signature = _signature(reduced_graph)
+    if full_signature != reduced_signature:
+        raise ValueError(
+            "The two models must have identical input and output names and types. "
+            "Full precision: {} Reduced precision: {}".format(full_signature, reduced_signature))
+
+
+def _merged_opset_imports(full_model, reduced_model):
+    domain_to_version = {}
+    for model in (full_model, reduced_model):
+        for opset in model.opset_import:
+            version = domain_to_version.get(opset.domain, 0)
+            domain_to_version[opset.domain] = max(version, opset.version)
+    return [helper.make_opsetid(domain, version) for domain, version in sorted(domain_to_version.items())]
+
+
+def create_precision_ensemble(full_model_path, reduced_model_path, output_path,
+                              selector_input_name="use_reduced_precision"):
+    full_model = onnx.load(full_model_path)
+    reduced_model = onnx.load(reduced_model_path)
+
+    full_graph = full_model.graph
+    reduced_graph = reduced_model.graph
+    _check_signatures_match(full_graph, reduced_graph)
+
+    initializer_names = {init.name for init in full_graph.initializer}
+    graph_input_names = {i.name for i in full_graph.input if i.name not in initializer_names}
+    # Copy the shared signature before the branches are renamed in place.
+    main_inputs = [copy.deepcopy(i) for i in full_graph.input if i.name in graph_input_names]
+    main_outputs = [copy.deepcopy(o) for o in full_graph.output]
+    output_names = [o.name for o in main_outputs]
+
+    # Rename everything each branch defines so names cannot collide between the
+    # branches or with the main graph. Graph inputs keep their names; the
+    # branches capture them from the outer scope, so neither branch declares
+    # explicit subgraph inputs.
+    full_prefix = "full."
+    reduced_prefix = "reduced."
+    _prefix_graph_names(full_graph, full_prefix, graph_input_names)
+    _prefix_graph_names(reduced_graph, reduced_prefix, graph_input_names)
+    del full_graph.input[:]
+    del reduced_graph.input[:]
+    full_graph.name = "full_precision"
+    reduced_graph.name = "reduced_precision"
+
+    shared_initializers = _deduplicate_initializers(full_graph, reduced_graph, full_prefix)
+
+    if_node = helper.make_node(
+        "If",
+        inputs=[selector_input_name],
+        outputs=output_names,
+        name="precision_selector",
+        then_branch=reduced_graph,
+        else_branch=full_graph)
+
+    selector_input = helper.make_tensor_value_info(selector_input_name, TensorProto.BOOL, [])
+    ensemble_graph = helper.make_graph(
+        [if_node],
+        "precision_ensemble",
+        main_inputs + [selector_input],
+        main_outputs,
+        initializer=shared_initializers)
+
+    ensemble_model = helper.make_model(
+        ensemble_graph,
+        opset_imports=_merged_opset_imports(full_model, reduced_model),
+        producer_name="create_precision_ensemble")
+    ensemble_model.ir_version = max(full_model.ir_version, reduced_model.ir_version)
+
+    onnx.checker.check_model(ensemble_model)
+    onnx.save(ensemble_model, output_path)
+    logger.info("Saved precision ensemble to %s. Feed %s=True for the reduced-precision branch.",
+                output_path, selector_input_name)
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Combine full- and reduced-precision variants of a model into one model "
+                    "with per-request precision selection via a boolean input.")
+    parser.add_argument("--full_precision_model", required=True, help="Path to the full-precision (e.g. fp32) model.")
+    parser.add_argument("--reduced_precision_model", required=True,
+                        help="Path to the reduced-precision (e.g. int8 or fp16) variant.")
+    parser.add_argument("--output", required=True, help="Path to write the combined model to.")
+    parser.add_argument("--selector_input_name", default="use_reduced_precision",
+                        help="Name of the added boolean input that selects the reduced-precision branch.")
+    return parser.parse_args()
+
+
+def main():
+    logging.basicConfig(level=logging.INFO, format="%(message)s")
+    args = parse_args()
+    create_precision_ensemble(args.full_precision_model, args.reduced_precision_model, args.output,
+                              args.selector_input_name)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+
+import argparse
+import json
+import os
+import onnx
+import pathlib
+import sys
+
+
+def _load_profile_events(profile_path):
+    '''Load the event list from a profile file written by the ORT session profiler.'''
+
+    with open(profile_path, 'r') as f:
+        events = json.load(f)
+
+    # the profiler writes a plain JSON array, but tooling that post-processes traces sometimes
+    # wraps it in a chromium trace object with a 'traceEvents' key
+    if isinstance(events, dict):
+        events = events.get('traceEvents', [])
+
+    return events
+
+
+def _extract_executed_ops(profile_path_or_dir):
+    '''Extract the op types that actually executed, with invocation counts and total kernel time
+    in microseconds, from one profile file or all profile files found under a directory.'''
+
+    if not os.path.exists(profile_path_or_dir):
+        raise ValueError('Path to profile/s does not exist: {}'.format(profile_path_or_dir))
+
+    profile_paths = []
+    if os.path.isfile(profile_path_or_dir):
+        profile_paths.append(profile_path_or_dir)
+    else:
+        for root, _, files in os.walk(profile_path_or_dir):
+            for file in files:
+                if file.lower().endswith('.json'):
+                    profile_paths.append(os.path.join(root, file))
+
+    executed_ops = {}  # op_type -> {'count': n, 'total_dur_us': us}
+    for profile_path in profile_paths:
+        for event in _load_profile_events(profile_path):
+            if event.get('cat') != 'Node' or not event.get('name', '').endswith('_kernel_time'):
+                continue
+            op_name = event.get('args', {}).get('op_name')
+            if not op_name:
+                continue
+            entry = executed_ops.setdefault(op_name, {'count': 0, 'total_dur_us': 0.0})
+            entry['count'] += 1
+            entry['total_dur_us'] += float(event.get('dur', 0))
+
+    return executed_ops
+
+
+def _extract_ops_from_onnx_graph(graph, executed_op_types, operators, domain_opset_map, unexecuted_ops):
+    '''Extract ops from an ONNX graph and all subgraphs, splitting them into ops that executed
+    according to the profile and ops that did not (e.g. constant folded or fused away).'''
+
+    for operator in graph.node:
+        # empty domain is used as an alias for 'ai.onnx'
+        domain = operator.domain if operator.domain else 'ai.onnx'
+
+        if domain in operators and domain in domain_opset_map:
+            if operator.op_type in executed_op_types:
+                operators[domain][domain_opset_map[domain]].add(operator.op_type)
+            else:
+                unexecuted_ops.add('{}:{}'.format(domain, operator.op_type))
+
+        for attr in operator.attribute:
+            if attr.type == onnx.AttributeProto.GRAPH:  # process subgraph
+                _extract_ops_from_onnx_graph(attr.g, executed_op_types, operators, domain_opset_map,
+                                             unexecuted_ops)
+            elif attr.type == onnx.AttributeProto.GRAPHS:
+                # Currently no ONNX operators use GRAPHS.
+                # Fail noisily if we encounter this so we can implement support
+                raise RuntimeError('Unexpected attribute proto of GRAPHS')
+
+
+def _process_onnx_model(model_path, executed_op_types, required_ops, unexecuted_ops):
+    model = onnx.load(model_path)
+
+    # create map of domain to opset for the model
+    domain_opset_map = {}
+    for opset in model.opset_import:
+        # empty domain == ai.onnx
+        domain = opset.domain if opset.domain else 'ai.onnx'
+        domain_opset_map[domain] = opset.version
+
+        if domain not in required_ops:
+            required_ops[domain] = {opset.version: set()}
+        elif opset.version not in required_ops[domain]:
+            required_ops[domain][opset.version] = set()
+
+    if domain_opset_map:
+        _extract_ops_from_onnx_graph(model.graph, executed_op_types, required_ops, domain_opset_map,
+                                     unexecuted_ops)
+
+
+def _extract_required_ops(model_path_or_dir, executed_op_types):
+    '''Extract the profiled subset of ops from a single ONNX model, or from all ONNX models found
+    by recursing model_path_or_dir.'''
+
+    if not os.path.exists(model_path_or_dir):
+        raise ValueError('Path to model/s does not exist: {}'.format(model_path_or_dir))
+
+    required_ops = {}
+    unexecuted_ops = set()
+
+    if os.path.isfile(model_path_or_dir):
+        _process_onnx_model(model_path_or_dir, executed_op_types, required_ops, unexecuted_ops)
+    else:
+        for root, _, files in os.walk(model_path_or_dir):
+            for file in files:
+                if file.lower().endswith('.onnx'):
+                    _process_onnx_model(os.path.join(root, file), executed_op_types, required_ops,
+                                        unexecuted_ops)
+
+    return required_ops, unexecuted_ops
+
+
+def _write_config(output_file, profile_path_or_dir, model_path_or_dir, required_ops):
+    directory, filename = os.path.split(output_file)
+    if not filename:
+        raise RuntimeError("Invalid output path for configuation: {}".format(output_file))
+
+    if directory and not os.path.exists(directory):
+        os.makedirs(directory)
+
+    with open(output_file, 'w') as out:
+        out.write("# Generated from profile/s at {} and ONNX models path of {}\n"
+                  .format(profile_path_or_dir, model_path_or_dir))
+
+        for domain in sorted(required_ops.keys()):
+            for opset in sorted(required_ops[domain].keys()):
+                ops = required_ops[domain][opset]
+                if ops:
+                    out.write("{};{};{}\n".format(domain, opset, ','.join(sorted(ops))))
+
+
+def _write_report(out, executed_ops, required_ops, unexecuted_ops, full_binary_size_bytes):
+    retained = sorted({op for opsets in required_ops.values() for ops in opsets.values() for op in ops})
+    total_model_ops = len(retained) + len(unexecuted_ops)
+    total_dur_us = sum(entry['total_dur_us'] for entry in executed_ops.values())
+
+    out.write('Profiled kernel usage\n')
+    out.write('{:<32}{:>12}{:>16}{:>10}\n'.format('op type', 'invocations', 'kernel time us', 'share'))
+    for op_name in sorted(executed_ops, key=lambda op: -executed_ops[op]['total_dur_us']):
+        entry = executed_ops[op_name]
+        share = entry['total_dur_us'] / total_dur_us if total_dur_us > 0 else 0.0
+        out.write('{:<32}{:>12}{:>16.1f}{:>9.1%}\n'
+                  .format(op_name, entry['count'], entry['total_dur_us'], share))
+
+    out.write('\nOp types in model/s: {}, retained after profiling: {}, dropped: {}\n'
+              .format(total_model_ops, len(retained), len(unexecuted_ops)))
+    if unexecuted_ops:
+        out.write('Dropped (present in model/s but never executed, e.g. constant folded or fused):\n')
+        for op in sorted(unexecuted_ops):
+            out.write('  {}\n'.format(op))
+
+    if full_binary_size_bytes and total_model_ops > 0:
+        # crude linear estimate: kernel code dominates the binary and scales with the op count.
+        # cold start page-in time scales with the binary size, so the same ratio applies there.
+        estimated = full_binary_size_bytes * len(retained) / total_model_ops
+        out.write('\nEstimated reduced binary size: {:.1f} MB of {:.1f} MB ({:.0%} of the full build).\n'
+                  .format(estimated / (1024 * 1024), full_binary_size_bytes / (1024 * 1024),
+                          len(retained) / total_model_ops))
+        out.write('This is a linear estimate; measure the actual size by building with '
+                  '--include_ops_by_config.\n')
+
+
+def main():
+    argparser = argparse.ArgumentParser(
+        'Script to create a reduced build config file from session profile/s, so the build only '
+        'includes the kernels production traffic actually executed. Run the model/s with profiling '
+        'enabled under representative traffic, then pass the profile file/s and the model/s here. '
+        'Ops present in a model but never executed (e.g. constant folded or fused away at session '
+        'initialization) are excluded from the configuration. '
+        'See /docs/Reduced_Operator_Kernel_build.md for more information.',
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+
+    argparser.add_argument('--report_path', type=pathlib.Path, default=None,
+                           help='Path to write the usage/size report to. Default is to print it.')
+    argparser.add_argument('--full_binary_size_bytes', type=int, default=None,
+                           help='Size in bytes of the full (unreduced) binary. When given, the '
+                                'report includes a linear estimate of the reduced binary size.')
+    argparser.add_argument('profile_path_or_dir', type=pathlib.Path,
+                           help='Path to a session profile JSON file, or a directory that will be '
+                                'recursively searched for profile files to process.')
+    argparser.add_argument('model_path_or_dir', type=pathlib.Path,
+                           help='Path to a single ONNX model, or a directory that will be '
+                                'recursively searched for models to process.')
+    argparser.add_argument('config_path', nargs='?', type=pathlib.Path, default=None,
+                           help='Path to write configuration file to. Default is to write '
+                                'required_operators_profiled.config in the same directory as the '
+                                'models.')
+
+    args = argparser.parse_args()
+
+    executed_ops = _extract_executed_ops(str(args.profile_path_or_dir.resolve()))
+    if not executed_ops:
+        print('No kernel events found in the profile/s. Was the session run with profiling enabled?',
+              file=sys.stderr)
+        sys.exit(-1)
+
+    model_path_or_dir = args.model_path_or_dir.resolve()
+    if args.config_path:
+        config_path = args.config_path.resolve()
+    else:
+        config_path = model_path_or_dir if model_path_or_dir.is_dir() else model_path_or_dir.parent
+
+    if config_path.is_dir():
+        config_path = config_path.joinpath('required_operators_profiled.config')
+
+    required_ops, unexecuted_ops = _extract_required_ops(str(model_path_or_dir), set(executed_ops))
+    _write_config(str(config_path), str(args.profile_path_or_dir), str(model_path_or_dir),
+                  required_ops)
+
+    if args.report_path:
+        with open(str(args.report_path.resolve()), 'w') as report:
+            _write_report(report, executed_ops, required_ops, unexecuted_ops,
+                          args.full_binary_size_bytes)
+    else:
+        _write_report(sys.stdout, executed_ops, required_ops, unexecuted_ops,
+                      args.full_binary_size_bytes)
+
+
+if __name__ == "__main__":
+    main()
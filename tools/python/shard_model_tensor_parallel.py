@@ -0,0 +1,189 @@
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+# --------------------------------------------------------------------------
+# Shards the large MatMul weights of an ONNX model across a tensor-parallel
+# group, writing one model per rank. Each selected MatMul(A, W) becomes a
+# row-parallel matmul: rank r keeps rows [r*K/n, (r+1)*K/n) of W, slices the
+# matching columns out of A, and an inserted com.microsoft NcclAllReduce sums
+# the partial products back into the original output, so every rank's model
+# exposes the same inputs and outputs as the original. The per-rank models are
+# run with the CUDA execution provider in a build with NCCL enabled (one
+# session per rank, as in ORT training's Megatron-style horizontal
+# parallelism); the collectives execute on the NCCL stream, so communication
+# for one matmul overlaps with compute for the next.
+#
+# Attention projections whose weights are plain MatMul initializers (Q/K/V and
+# output projections exported as individual MatMuls) are covered by the same
+# rewrite. Weights consumed by any node other than a MatMul, with a
+# non-divisible inner dimension, or below the size threshold are left
+# unsharded and replicated into every rank's model.
+
+import argparse
+import copy
+import logging
+import sys
+
+import numpy as np
+import onnx
+from onnx import TensorProto, helper
+
+logger = logging.getLogger(__name__)
+
+# element types NcclAllReduce accepts (see orttraining training_op_defs.cc)
+_SHARDABLE_ELEM_TYPES = (TensorProto.FLOAT, TensorProto.FLOAT16, TensorProto.DOUBLE)
+
+# group_type value for the horizontal (tensor) parallel group, matching
+# onnxruntime::training::WorkerGroupType::HorizontalParallel
+_HORIZONTAL_PARALLEL_GROUP = 4
+
+_MS_DOMAIN = "com.microsoft"
+
+
+def _elem_type_size(elem_type):
+    return {TensorProto.FLOAT: 4, TensorProto.FLOAT16: 2, TensorProto.DOUBLE: 8}[elem_type]
+
+
+def _select_shardable_weights(graph, world_size, min_bytes):
+    """Returns the names of initializers that every consumer uses as the second input of a
+    MatMul and that can be split into world_size row shards."""
+    initializers = {i.name: i for i in graph.initializer}
+    consumers = {}  # initializer name -> list of (node, is shardable use)
+    for node in graph.node:
+        for input_index, input_name in enumerate(node.input):
+            if input_name in initializers:
+                shardable_use = node.op_type == "MatMul" and input_index == 1
+                consumers.setdefault(input_name, []).append(shardable_use)
+
+    selected = []
+    for name, uses in consumers.items():
+        if not all(uses):
+            continue
+        initializer = initializers[name]
+        if initializer.data_type not in _SHARDABLE_ELEM_TYPES or len(initializer.dims) != 2:
+            continue
+        k, n = initializer.dims
+        if k % world_size != 0:
+            logger.info("skipping %s: inner dimension %d not divisible by world size %d", name, k, world_size)
+            continue
+        if k * n * _elem_type_size(initializer.data_type) < min_bytes:
+            continue
+        selected.append(name)
+    return selected
+
+
+def _shard_initializer(initializer, rank, world_size):
+    """Returns rows [rank*K/n, (rank+1)*K/n) of a 2-D initializer as a new TensorProto."""
+    array = onnx.numpy_helper.to_array(initializer)
+    rows_per_rank = array.shape[0] // world_size
+    shard = array[rank * rows_per_rank:(rank + 1) * rows_per_rank, :]
+    return onnx.numpy_helper.from_array(shard.copy(), "%s_rank_%d" % (initializer.name, rank))
+
+
+def _shard_graph_for_rank(graph, shard_names, rank, world_size):
+    """Rewrites every MatMul consuming a weight in shard_names into slice/matmul/allreduce."""
+    initializers = {i.name: i for i in graph.initializer}
+    rows = {}  # weight name -> rows per rank, for the activation slice bounds
+
+    for name in shard_names:
+        initializer = initializers[name]
+        rows[name] = initializer.dims[0] // world_size
+        graph.initializer.remove(initializer)
+        graph.initializer.append(_shard_initializer(initializer, rank, world_size))
+
+    new_nodes = []
+    for node in graph.node:
+        if node.op_type != "MatMul" or node.input[1] not in rows:
+            new_nodes.append(node)
+            continue
+
+        weight_name = node.input[1]
+        rows_per_rank = rows[weight_name]
+        base = node.name if node.name else node.output[0]
+
+        # slice the columns of A that pair with this rank's weight rows
+        slice_output = "%s_a_shard" % base
+        starts = onnx.numpy_helper.from_array(
+            np.array([rank * rows_per_rank], dtype=np.int64), "%s_starts" % base)
+        ends = onnx.numpy_helper.from_array(
+            np.array([(rank + 1) * rows_per_rank], dtype=np.int64), "%s_ends" % base)
+        axes = onnx.numpy_helper.from_array(np.array([-1], dtype=np.int64), "%s_axes" % base)
+        graph.initializer.extend([starts, ends, axes])
+        new_nodes.append(helper.make_node(
+            "Slice", [node.input[0], starts.name, ends.name, axes.name], [slice_output],
+            name="%s_a_shard" % base))
+
+        partial_output = "%s_partial" % base
+        matmul = helper.make_node(
+            "MatMul", [slice_output, "%s_rank_%d" % (weight_name, rank)], [partial_output], name=node.name)
+        new_nodes.append(matmul)
+
+        allreduce = helper.make_node(
+            "NcclAllReduce", [partial_output], list(node.output),
+            name="%s_allreduce" % base, domain=_MS_DOMAIN)
+        allreduce.attribute.append(helper.make_attribute("group_type", _HORIZONTAL_PARALLEL_GROUP))
+        new_nodes.append(allreduce)
+
+    del graph.node[:]
+    graph.node.extend(new_nodes)
+
+
+def _ensure_ms_opset(model):
+    for opset in model.opset_import:
+        if opset.domain == _MS_DOMAIN:
+            return
+    model.opset_import.append(helper.make_opsetid(_MS_DOMAIN, 1))
+
+
+def shard_model(model_path, world_size, output_prefix, min_bytes):
+    model = onnx.load(model_path)
+    shard_names = _select_shardable_weights(model.graph, world_size, min_bytes)
+    if not shard_names:
+        logger.error("no shardable MatMul weights of at least %d bytes found", min_bytes)
+        return 1
+
+    total_bytes = 0
+    initializers = {i.name: i for i in model.graph.initializer}
+    for name in shard_names:
+        i = initializers[name]
+        total_bytes += i.dims[0] * i.dims[1] * _elem_type_size(i.data_type)
+    logger.info("sharding %d weights (%.1f MiB total, %.1f MiB per rank) across %d ranks",
+                len(shard_names), total_bytes / 2**20, total_bytes / 2**20 / world_size, world_size)
+
+    for rank in range(world_size):
+        rank_model = copy.deepcopy(model)
+        _shard_graph_for_rank(rank_model.graph, shard_names, rank, world_size)
+        _ensure_ms_opset(rank_model)
+        rank_model.producer_name = "shard_model_tensor_parallel"
+        output_path = "%s_rank_%d.onnx" % (output_prefix, rank)
+        onnx.save(rank_model, output_path)
+        logger.info("saved %s", output_path)
+
+    return 0
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Shard the large MatMul weights of a model across a tensor-parallel group, "
+                    "writing one model per rank with NcclAllReduce collectives at the sharding "
+                    "boundaries.")
+    parser.add_argument("--model", required=True, help="Path to the model to shard.")
+    parser.add_argument("--world_size", required=True, type=int, help="Number of ranks to shard across.")
+    parser.add_argument("--output_prefix", required=True,
+                        help="Per-rank models are written to <prefix>_rank_<r>.onnx.")
+    parser.add_argument("--min_initializer_bytes", type=int, default=2**20,
+                        help="Only shard MatMul weights of at least this many bytes (default 1 MiB).")
+    return parser.parse_args()
+
+
+def main():
+    logging.basicConfig(level=logging.INFO, format="%(message)s")
+    args = parse_args()
+    if args.world_size < 2:
+        logger.error("--world_size must be at least 2")
+        return 1
+    return shard_model(args.model, args.world_size, args.output_prefix, args.min_initializer_bytes)
+
+
+if __name__ == "__main__":
+    sys.exit(main())